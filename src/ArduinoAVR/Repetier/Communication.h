@@ -46,6 +46,12 @@ class GCodeSource {
     static fast8_t numWriteSources;
     static GCodeSource* sources[MAX_DATA_SOURCES];
     static GCodeSource* writeableSources[MAX_DATA_SOURCES];
+#if OUTPUT_BUFFER_SIZE
+    static uint8_t outputBuffer[OUTPUT_BUFFER_SIZE]; ///< Collects output until a line is complete
+    static uint8_t outputLength;
+    static bool outputToAll;           ///< Com::writeToAll when the buffered output started
+    static GCodeSource* outputSource;  ///< Receiver of buffered output if not outputToAll
+#endif
 
 public:
     static GCodeSource* activeSource;
@@ -53,6 +59,11 @@ public:
     static void removeSource(GCodeSource* delSource);
     static void rotateSource();           ///< Move active to next source
     static void writeToAll(uint8_t byte); ///< Write to all listening sources
+#if OUTPUT_BUFFER_SIZE
+    static void flushOutput(); ///< Send buffered output to its receivers
+#else
+    static inline void flushOutput() { }
+#endif
     static void prefetchAll();
     static void printAllFLN(FSTRINGPARAM(text));
     static void printAllFLN(FSTRINGPARAM(text), int32_t v);
@@ -61,6 +72,7 @@ public:
                                             ///< in binary mode?
     millis_t timeOfLastDataPacket;
     int8_t waitingForResend; ///< Waiting for line to be resend. -1 = no wait.
+    bool sendFreeBuffers;    ///< Append free move and command buffer entries to ok, see M538
 
     GCodeSource();
     virtual ~GCodeSource() { }
@@ -72,7 +84,13 @@ public:
     virtual int readByte() = 0;
     virtual void close() = 0;
     virtual void writeByte(uint8_t byte) = 0;
+    virtual void write(const uint8_t* data, uint8_t length) { ///< Write a block of bytes
+        while (length--)
+            writeByte(*data++);
+    }
     virtual void prefetchContent() { } // Used for emergency parsing to read ahaed
+    /** Commands of maximum length that still fit into the receive buffer. */
+    virtual uint8_t freeInputLines() { return 0; }
 };
 
 class Com {
@@ -142,6 +160,8 @@ public:
     FSTRINGVAR(tJSONFileInfoStart)
     FSTRINGVAR(tJSONFileInfoHeight)
     FSTRINGVAR(tJSONFileInfoLayerHeight)
+    FSTRINGVAR(tJSONFileInfoLayers)
+    FSTRINGVAR(tJSONFileInfoPrintTime)
     FSTRINGVAR(tJSONFileInfoFilament)
     FSTRINGVAR(tJSONFileInfoGeneratedBy)
     FSTRINGVAR(tJSONFileInfoName)
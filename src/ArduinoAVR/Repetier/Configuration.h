@@ -1137,6 +1137,15 @@ on this endstop.
     180 // Move accurate setting for print moves
 #define DELTA_SEGMENTS_PER_SECOND_MOVE \
     70 // Less accurate setting for other moves
+/** \brief Maximum deviation from the straight path in micrometer for delta
+printers
+
+With a value > 0 the number of delta segments of a move is computed from the
+effector deviation caused by moving the towers linear inside a segment, so moves
+near the center get few segments and moves near the edge more. The segments per
+second above stay the upper limit. 0 uses the segments per second.
+*/
+#define DELTA_SEGMENT_TOLERANCE 0
 
 // Delta settings
 #if DRIVE_SYSTEM == DELTA
@@ -1245,6 +1254,15 @@ min is 5 * (200 + (7*10=70) =270) = 1350
  This leaves ~1K free RAM on an Arduino which has only 8k
 Mega. Used only for nonlinear systems like delta or tuga. */
 #define DELTASEGMENTS_PER_PRINTLINE 22
+/** \brief Number of delta segments shared by all lines.
+
+With a value > 0 lines take only the delta segments they need from one common
+pool instead of reserving DELTASEGMENTS_PER_PRINTLINE segments each. Short moves
+need only a few segments, so the same RAM buffers more lines. Long moves fill
+all segments of their lines, then the pool holds fewer lines than the per line
+segments, see make bench-delta in src/Simulator. Needs 7 bytes per segment and
+must be at least 2 * DELTASEGMENTS_PER_PRINTLINE. 0 = segments per line. */
+#define NONLINEAR_SEGMENT_POOL 0
 
 /** After x seconds of inactivity, the stepper motors are disabled.
     Set to 0 to leave them enabled.
@@ -1323,6 +1341,26 @@ own weight, so this is nearly never needed. */
 
 /** Comment this to disable ramp acceleration */
 #define RAMP_ACCELERATION 1
+/** \brief Table based step timing for acceleration and deceleration ramps.
+
+With constant acceleration the squared speed grows linear with the steps done. If enabled, the stepper interrupt only adds
+the acceleration to the squared speed and gets the step interval from a small reciprocal square root table. This replaces
+the speed computation and the division in every ramp step and reduces the worst case interrupt time, so higher step
+rates are possible. Lines with advance or start/end speeds below 64 steps/s use the normal computation.
+*/
+#define STEP_TIMING_TABLE 0
+/** \brief Jerk limited (S-curve) acceleration.
+
+Instead of a constant acceleration the speed follows v0 + dv * (3t^2 - 2t^3) during acceleration and deceleration, so
+the acceleration rises and falls smoothly and the ramps do not excite ringing. The peak acceleration of such a ramp is
+1.5 times its mean, so lines get planned with 2/3 of the configured acceleration and the peak stays within the limit.
+Ramps take 1.5 times longer than with constant acceleration.
+Can be switched at runtime with M537.
+*/
+#define S_CURVE_ACCELERATION 0
+/** Input shaping of the X and Y acceleration ramps, see M540. Only available
+on ARM boards. */
+#define INPUT_SHAPING 0
 
 /** If your stepper needs a longer high signal then given, you can add a delay
 here. The delay is realized as a simple loop wasting time, which is not
@@ -1416,6 +1454,15 @@ Overridden if EEPROM activated.
 */
 #define MAX_JERK 20.0
 #define MAX_ZJERK 0.3
+/** \brief Corner speed from junction deviation instead of jerk.
+
+If enabled, the speed at the join of two moves in x/y follows from the angle between them. It is the speed that
+drives a circle touching both moves JUNCTION_DEVIATION_MM from the corner with the acceleration of the moves. Curves
+made of many short lines run as fast as their radius allows, sharp corners slow down more than with MAX_JERK.
+MAX_JERK still sets the start speed, moves without x/y part and the z and extruder limits are unchanged.
+*/
+#define JUNCTION_DEVIATION 0
+#define JUNCTION_DEVIATION_MM 0.02
 
 /** \brief Number of moves we can cache in advance.
 
@@ -1471,6 +1518,9 @@ Set 1 to allow, 0 disallow a quadratic advance dependency. Linear is the
 dominant value, so no real need to activate the quadratic term. Only adds lots
 of computations and storage usage. */
 #define ENABLE_QUADRATIC_ADVANCE 0
+/** Execute advance in the stepper interrupt instead of an extruder timer. Only
+available on ARM boards. */
+#define ADVANCE_IN_STEPPER 0
 
 // ##########################################################################################
 // ##                           Communication configuration ##
@@ -1528,6 +1578,11 @@ software to send the next command. Not receiving it will cause your printer to
 stop. Sending this string every second, if our queue is empty should prevent
 this. Comment it, if you don't want this feature. */
 #define WAITING_IDENTIFIER "wait"
+/** Size of the output line buffer in bytes. Responses get collected here and
+are sent with one write per connection when a line is complete, instead of one
+call per character and connection. 0 disables buffering. This only helps
+connections where every write call is a transfer of its own. */
+#define OUTPUT_BUFFER_SIZE 0
 
 /** \brief Sets time for echo debug
 
@@ -1556,6 +1611,16 @@ as they are taken from the EEPROM.
 */
 #define EEPROM_MODE 2
 
+/* With EEPROM_RAM_CACHE 1 the often used settings from EPR_Z_PROBE_X_OFFSET to
+EPR_CUSTOM_START are kept in RAM (~420 bytes with dirty flags, wear counters
+and queue). Changed bytes get burned one per call of the periodical actions
+instead of blocking 3.4ms each, unchanged bytes are not written at all. Writes
+outside that range go through a 16 byte queue, storing more changed bytes there
+at once still waits for each extra byte. Rescue data is still written directly.
+M542 reports the burns per 256 byte block since start.
+*/
+#define EEPROM_RAM_CACHE 0
+
 /**************** duplicate motor driver ***************
 
 If you have unused extruder steppers free, you could use it to drive the second
@@ -1980,9 +2045,39 @@ ended. Separate commands by \n */
 #define SD_RUN_ON_STOP ""
 /** Disable motors and heaters when print was stopped. */
 #define SD_STOP_HEATER_AND_MOTORS_ON_STOP 1
+/** M34 filename converts an ASCII G-code file into the binary format and
+stores it as sidecar file with extension .bgc. Selecting the ASCII file then
+prints the sidecar, so no ASCII parsing is needed while printing. The sidecar
+stores size, first cluster and modification time of the source file and is
+ignored if the source file was changed. Lines with format errors are skipped
+and reported, a command longer than MAX_CMD_SIZE aborts the compilation.
+Compiling reads whole blocks and needs about 700 bytes of stack. */
+#define SD_BINARY_SIDECAR 0
+/** Read ahead buffer for printing from SD card in bytes. Two buffers of this
+size get filled with whole blocks while the firmware is idle, so reading
+commands does not wait for the card. 512 reads complete card blocks but needs
+1 KB RAM, 0 reads byte by byte. Must be a power of 2. */
+#define SD_READ_BUFFER_SIZE 0
+/** Number of files of a folder the LCD file browser indexes. The index stores
+where each file starts in the folder, so scrolling and selecting a file reads
+only its own entry instead of all entries before it. Needs 4 byte RAM per
+file, 0 disables the index. */
+#define SD_DIR_INDEX_SIZE 0
+/** Number of files whose G-code information (M36, selected file) is stored in
+fileinfo.bin on the card, so each file gets parsed only once. The files of a
+folder listed with M20 S2 get parsed while the printer is idle. Uses 64 byte
+on the card per file, must be a multiple of 8. Only used with JSON_OUTPUT,
+0 disables the cache. */
+#define SD_INFO_CACHE_SIZE 0
 
 // If you want support for G2/G3 arc commands set to true, otherwise false.
 #define ARC_SUPPORT 1
+/** Maximum distance in mm between an arc and the chords it gets printed with. Chords get as long as this allows, but
+never shorter than MM_PER_ARC_SEGMENT, so large radii need less lines. 0 uses the fixed chord length. */
+#define ARC_CHORD_TOLERANCE 0.01
+/** Interpolate G2/G3 arcs in the stepper interrupt instead of
+splitting them into chords. Only available on ARM boards. */
+#define ARC_IN_STEPPER 0
 
 /** You can store the current position with M401 and go back to it with M402.
    This works only if feature is set to true. */
@@ -120,6 +120,9 @@ void EEPROM::restoreEEPROMSettingsFromConfiguration() {
     Printer::radius0 = 0;
 #endif
 #endif
+#if INPUT_SHAPING
+    InputShaper::setDefaults();
+#endif
 #if ENABLE_BACKLASH_COMPENSATION
     Printer::backlashX = X_BACKLASH;
     Printer::backlashY = Y_BACKLASH;
@@ -412,6 +415,14 @@ void EEPROM::storeDataIntoEEPROM(uint8_t corrupted) {
     HAL::eprSetFloat(EPR_HEATED_BED_GAIN, 1.0);
     HAL::eprSetFloat(EPR_HEATED_BED_BIAS, 0.0);
 #endif
+#endif
+#if INPUT_SHAPING
+    HAL::eprSetByte(EPR_INPUT_SHAPER_X_TYPE, InputShaper::axis[X_AXIS].type);
+    HAL::eprSetByte(EPR_INPUT_SHAPER_Y_TYPE, InputShaper::axis[Y_AXIS].type);
+    HAL::eprSetFloat(EPR_INPUT_SHAPER_X_FREQUENCY, InputShaper::axis[X_AXIS].frequency);
+    HAL::eprSetFloat(EPR_INPUT_SHAPER_Y_FREQUENCY, InputShaper::axis[Y_AXIS].frequency);
+    HAL::eprSetFloat(EPR_INPUT_SHAPER_X_DAMPING, InputShaper::axis[X_AXIS].damping);
+    HAL::eprSetFloat(EPR_INPUT_SHAPER_Y_DAMPING, InputShaper::axis[Y_AXIS].damping);
 #endif
     // SHOT("storeDataIntoEEPROM");
     // SHOWM(Printer::xMin);SHOWM(Printer::yMin);SHOWM(Printer::zMin);
@@ -629,6 +640,24 @@ void EEPROM::readDataFromEEPROM(bool includeExtruder) {
     heatedBedController.tempGain = HAL::eprGetFloat(EPR_HEATED_BED_GAIN);
     heatedBedController.tempBias = HAL::eprGetFloat(EPR_HEATED_BED_BIAS);
 #endif
+#endif
+#if INPUT_SHAPING
+    if (version < 21) {
+        HAL::eprSetByte(EPR_INPUT_SHAPER_X_TYPE, INPUT_SHAPER_X_TYPE);
+        HAL::eprSetByte(EPR_INPUT_SHAPER_Y_TYPE, INPUT_SHAPER_Y_TYPE);
+        HAL::eprSetFloat(EPR_INPUT_SHAPER_X_FREQUENCY, INPUT_SHAPER_X_FREQUENCY);
+        HAL::eprSetFloat(EPR_INPUT_SHAPER_Y_FREQUENCY, INPUT_SHAPER_Y_FREQUENCY);
+        HAL::eprSetFloat(EPR_INPUT_SHAPER_X_DAMPING, INPUT_SHAPER_X_DAMPING);
+        HAL::eprSetFloat(EPR_INPUT_SHAPER_Y_DAMPING, INPUT_SHAPER_Y_DAMPING);
+    }
+    InputShaper::axis[X_AXIS].type = HAL::eprGetByte(EPR_INPUT_SHAPER_X_TYPE);
+    InputShaper::axis[Y_AXIS].type = HAL::eprGetByte(EPR_INPUT_SHAPER_Y_TYPE);
+    InputShaper::axis[X_AXIS].frequency = HAL::eprGetFloat(EPR_INPUT_SHAPER_X_FREQUENCY);
+    InputShaper::axis[Y_AXIS].frequency = HAL::eprGetFloat(EPR_INPUT_SHAPER_Y_FREQUENCY);
+    InputShaper::axis[X_AXIS].damping = HAL::eprGetFloat(EPR_INPUT_SHAPER_X_DAMPING);
+    InputShaper::axis[Y_AXIS].damping = HAL::eprGetFloat(EPR_INPUT_SHAPER_Y_DAMPING);
+    InputShaper::axis[X_AXIS].update();
+    InputShaper::axis[Y_AXIS].update();
 #endif
     Printer::xMin = HAL::eprGetFloat(EPR_X_HOME_OFFSET);
     Printer::yMin = HAL::eprGetFloat(EPR_Y_HOME_OFFSET);
@@ -1049,6 +1078,14 @@ void EEPROM::writeSettings() {
     writeFloat(EPR_ACCELERATION_FACTOR_TOP, Com::tEPRAccelerationFactorAtTop);
 #endif
 #endif
+#endif
+#if INPUT_SHAPING
+    writeByte(EPR_INPUT_SHAPER_X_TYPE, PSTR("Input shaper X type 0-3"));
+    writeFloat(EPR_INPUT_SHAPER_X_FREQUENCY, PSTR("Input shaper X frequency [Hz]"));
+    writeFloat(EPR_INPUT_SHAPER_X_DAMPING, PSTR("Input shaper X damping"), 3);
+    writeByte(EPR_INPUT_SHAPER_Y_TYPE, PSTR("Input shaper Y type 0-3"));
+    writeFloat(EPR_INPUT_SHAPER_Y_FREQUENCY, PSTR("Input shaper Y frequency [Hz]"));
+    writeFloat(EPR_INPUT_SHAPER_Y_DAMPING, PSTR("Input shaper Y damping"), 3);
 #endif
     writeFloat(EPR_Z_PROBE_Z_OFFSET, Com::tZProbeOffsetZ);
 #if FEATURE_Z_PROBE
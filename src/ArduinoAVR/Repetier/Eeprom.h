@@ -20,7 +20,7 @@
 #define _EEPROM_H
 
 // Id to distinguish version changes
-#define EEPROM_PROTOCOL_VERSION 20
+#define EEPROM_PROTOCOL_VERSION 21
 
 /** Where to start with our data block in memory. Can be moved if you
 have problems with other modules using the eeprom */
@@ -134,6 +134,12 @@ have problems with other modules using the eeprom */
 #define EPR_PARK_Z 1064
 #define EPR_HEATED_BED_GAIN 1068
 #define EPR_HEATED_BED_BIAS 1072
+#define EPR_INPUT_SHAPER_X_TYPE 1076
+#define EPR_INPUT_SHAPER_Y_TYPE 1077
+#define EPR_INPUT_SHAPER_X_FREQUENCY 1078
+#define EPR_INPUT_SHAPER_Y_FREQUENCY 1082
+#define EPR_INPUT_SHAPER_X_DAMPING 1086
+#define EPR_INPUT_SHAPER_Y_DAMPING 1090
 
 // First address that can be used by custom code for eeprom
 #define EPR_CUSTOM_START 1100
@@ -0,0 +1,191 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/* EEPROM_RAM_CACHE, included by HAL.cpp. It only uses the eeprom_* functions
+of avr-libc, so the host simulator compiles the same code against its
+simulated 4 KB EEPROM, see src/Simulator/SimulatorEeprom.cpp. */
+
+/* Bytes from EEPROM_CACHE_START to EEPROM_CACHE_END - 1 are mirrored in RAM.
+A write only changes the RAM copy and marks the byte dirty, eprBurnStep burns
+one dirty byte per call once the last burn has finished. Other bytes are queued
+up to EEPROM_QUEUE_SIZE entries, a full queue burns its oldest entry directly,
+so storing more changed bytes outside the cache waits for each extra burn.
+EPR_INTEGRITY_BYTE is burned after everything else, so an interrupted store
+fails the checksum. Rescue data is written directly as it is stored on power
+loss. */
+#define EEPROM_CACHE_START EPR_Z_PROBE_X_OFFSET
+#define EEPROM_CACHE_END EPR_CUSTOM_START
+#define EEPROM_CACHE_SIZE (EEPROM_CACHE_END - EEPROM_CACHE_START)
+#define EEPROM_QUEUE_SIZE 16
+
+static uint8_t eprCache[EEPROM_CACHE_SIZE];
+static uint8_t eprDirty[(EEPROM_CACHE_SIZE + 7) >> 3];
+static uint16_t eprDirtyCount = 0;
+static uint16_t eprNextDirty = 0;
+static uint16_t eprQueuePos[EEPROM_QUEUE_SIZE];
+static uint8_t eprQueueValue[EEPROM_QUEUE_SIZE];
+static uint8_t eprQueueCount = 0;
+uint16_t HAL::eprWear[(E2END + 256) >> 8];
+uint32_t HAL::eprWritesSaved = 0;
+
+static uint8_t eprReadPhysical(unsigned int pos) {
+    return eeprom_read_byte((unsigned char*)(EEPROM_OFFSET + pos));
+}
+
+static void eprBurn(unsigned int pos, uint8_t value) {
+    eeprom_write_byte((unsigned char*)(EEPROM_OFFSET + pos), value);
+    HAL::eprWear[pos >> 8]++;
+}
+
+/** Burns and removes the oldest queued byte that is not EPR_INTEGRITY_BYTE.
+The integrity byte is only burned once nothing else is pending. Returns false
+if nothing may be burned yet. */
+static bool eprBurnQueued() {
+    uint8_t i = 0;
+    while (i < eprQueueCount && eprQueuePos[i] == EPR_INTEGRITY_BYTE)
+        i++;
+    if (i == eprQueueCount) {
+        if (i == 0 || eprDirtyCount)
+            return false;
+        i = 0;
+    }
+    eprBurn(eprQueuePos[i], eprQueueValue[i]);
+    eprQueueCount--;
+    for (; i < eprQueueCount; i++) {
+        eprQueuePos[i] = eprQueuePos[i + 1];
+        eprQueueValue[i] = eprQueueValue[i + 1];
+    }
+    return true;
+}
+
+static uint8_t eprReadCached(unsigned int pos) {
+    unsigned int idx = pos - EEPROM_CACHE_START;
+    if (idx < EEPROM_CACHE_SIZE)
+        return eprCache[idx];
+    for (uint8_t i = 0; i < eprQueueCount; i++)
+        if (eprQueuePos[i] == pos)
+            return eprQueueValue[i];
+    return eprReadPhysical(pos);
+}
+
+static void eprWriteCached(unsigned int pos, uint8_t value) {
+    unsigned int idx = pos - EEPROM_CACHE_START;
+    if (idx < EEPROM_CACHE_SIZE) {
+        uint8_t mask = 1 << (idx & 7);
+        if (eprCache[idx] == value) {
+            HAL::eprWritesSaved++;
+            return;
+        }
+        eprCache[idx] = value;
+        if (eprDirty[idx >> 3] & mask)
+            HAL::eprWritesSaved++; // previous value never reached the EEPROM
+        else {
+            eprDirty[idx >> 3] |= mask;
+            eprDirtyCount++;
+        }
+        return;
+    }
+    for (uint8_t i = 0; i < eprQueueCount; i++)
+        if (eprQueuePos[i] == pos) {
+            if (eprQueueValue[i] != value) {
+                eprQueueValue[i] = value;
+                HAL::eprWritesSaved++;
+            }
+            return;
+        }
+    if (eprReadPhysical(pos) == value) {
+        HAL::eprWritesSaved++;
+        return;
+    }
+#if HOST_RESCUE
+    if (pos >= EPR_RESCUE_START) {
+        eprBurn(pos, value);
+        return;
+    }
+#endif
+    if (eprQueueCount == EEPROM_QUEUE_SIZE)
+        eprBurnQueued();
+    eprQueuePos[eprQueueCount] = pos;
+    eprQueueValue[eprQueueCount++] = value;
+}
+
+void HAL::eprInitCache() {
+    eeprom_read_block(eprCache, (void*)(EEPROM_OFFSET + EEPROM_CACHE_START), EEPROM_CACHE_SIZE);
+}
+
+void HAL::eprRead(unsigned int pos, void* dst, uint8_t size) {
+    uint8_t* d = (uint8_t*)dst;
+    while (size--)
+        *d++ = eprReadCached(pos++);
+}
+
+void HAL::eprWrite(unsigned int pos, const void* src, uint8_t size) {
+    const uint8_t* s = (const uint8_t*)src;
+    while (size--)
+        eprWriteCached(pos++, *s++);
+}
+
+void HAL::eprBurnStep() {
+    if (!eeprom_is_ready())
+        return;
+    if (eprBurnQueued())
+        return;
+    while (eprDirtyCount) {
+        unsigned int idx = eprNextDirty;
+        eprNextDirty = (idx + 1 < EEPROM_CACHE_SIZE ? idx + 1 : 0);
+        if (eprDirty[idx >> 3] == 0) { // skip clean groups of 8 bytes fast
+            eprNextDirty = ((idx | 7) + 1 < EEPROM_CACHE_SIZE ? (idx | 7) + 1 : 0);
+            continue;
+        }
+        uint8_t mask = 1 << (idx & 7);
+        if (!(eprDirty[idx >> 3] & mask))
+            continue;
+        eprDirty[idx >> 3] &= ~mask;
+        eprDirtyCount--;
+        if (eprReadPhysical(idx + EEPROM_CACHE_START) != eprCache[idx]) {
+            eprBurn(idx + EEPROM_CACHE_START, eprCache[idx]);
+            return;
+        }
+        eprWritesSaved++; // changed back before it was burned
+    }
+    eprBurnQueued(); // Integrity byte after the last cached byte
+}
+
+void HAL::eprFlush() {
+    while (eprPending()) {
+        eeprom_busy_wait();
+        eprBurnStep();
+    }
+    eeprom_busy_wait();
+}
+
+uint16_t HAL::eprPending() {
+    return eprDirtyCount + eprQueueCount;
+}
+
+void HAL::eprReport() {
+    uint32_t total = 0;
+    Com::printF(PSTR("EEPROM burns per 256 byte block:"));
+    for (uint8_t i = 0; i < (E2END + 256) >> 8; i++) {
+        Com::printF(Com::tSpace, (int32_t)eprWear[i]);
+        total += eprWear[i];
+    }
+    Com::println();
+    Com::printF(PSTR("EEPROM burns:"), total);
+    Com::printF(PSTR(" saved:"), eprWritesSaved);
+    Com::printFLN(PSTR(" pending:"), (int32_t)eprPending());
+}
@@ -84,6 +84,8 @@ public:
   float getStatefulTemperature();
   void setTargetTemperature(float target);
   void updateCurrentTemperature();
+  const int16_t *conversionTable(uint8_t &num, bool &inRam);
+  float tableTemperature(int16_t raw);
   void updateTempControlVars();
   inline bool isAlarm() { return flags & TEMPERATURE_CONTROLLER_FLAG_ALARM; }
   inline void setAlarm(bool on) {
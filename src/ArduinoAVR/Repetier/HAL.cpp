@@ -290,9 +290,16 @@ void (*resetFunc)(void) = 0; //declare reset function @ address 0
 
 void HAL::resetHardware()
 {
+#if EEPROM_RAM_CACHE
+    eprFlush();
+#endif
     resetFunc();
 }
 
+#if EEPROM_RAM_CACHE
+#include "EepromCache.h"
+#endif
+
 void HAL::analogStart()
 {
 #if ANALOG_INPUTS > 0
@@ -714,12 +721,22 @@ ISR(TIMER1_COMPA_vect)
     //        :[ex]"=&d"(doExit),[stepperWait]"=&d"(stepperWait):[ocr]"i" (_SFR_MEM_ADDR(OCR1A)):"r22","r23" );
     if (doExit)
         return;
+#ifdef DEBUG_ISR_PROFILE
+    uint16_t profileStart = HAL::cycleCounter();
+    IsrProfile::branch = ISR_BRANCH_IDLE;
+#endif
     cbi(TIMSK1, OCIE1A); // prevent retrigger timer by disabling timer interrupt. Should be faster the guarding with insideTimer1.
     // insideTimer1 = 1;
     OCR1A = 61000;
     if (PrintLine::hasLines())
     {
+#ifdef DEBUG_STEP_TIMELINE
+        uint32_t delay = PrintLine::bresenhamStep();
+        StepTimeline::advance(delay);
+        setTimer(delay);
+#else
         setTimer(PrintLine::bresenhamStep());
+#endif
     }
 #if FEATURE_BABYSTEPPING
     else if (Printer::zBabystepsMissing)
@@ -757,6 +774,9 @@ ISR(TIMER1_COMPA_vect)
         OCR1A = 65500;   // Wait for next move
     }
     DEBUG_MEMORY;
+#ifdef DEBUG_ISR_PROFILE
+    IsrProfile::stepper[IsrProfile::branch].add(HAL::cyclesSince(profileStart));
+#endif
     sbi(TIMSK1, OCIE1A);
     //insideTimer1 = 0;
 }
@@ -827,6 +847,9 @@ This timer is called 3906 timer per second. It is used to update pwm values for
 */
 ISR(PWM_TIMER_VECTOR)
 {
+#ifdef DEBUG_ISR_PROFILE
+    uint16_t profileStart = HAL::cycleCounter();
+#endif
     static uint8_t pwm_count_cooler = 0;
     static uint8_t pwm_count_heater = 0;
     static uint8_t pwm_pos_set[NUM_PWM];
@@ -1142,6 +1165,9 @@ ISR(PWM_TIMER_VECTOR)
         HAL::wdPinged = false;
     }
 #endif
+#ifdef DEBUG_ISR_PROFILE
+    IsrProfile::pwm.add(HAL::cyclesSince(profileStart));
+#endif
 }
 #if USE_ADVANCE
 
@@ -1168,11 +1194,16 @@ ISR(EXTRUDER_TIMER_VECTOR)
     uint8_t timer = EXTRUDER_OCR;
     if (!Printer::isAdvanceActivated())
         return; // currently no need
+#ifdef DEBUG_STEP_TIMELINE
+    if (StepTimeline::recording)
+        StepTimeline::extruderInterrupts++;
+#endif
     if (Printer::extruderStepsNeeded > 0 && extruderLastDirection != 1)
     {
         if (Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS)
         {
             Extruder::setDirection(true);
+            STEP_TIMELINE_REVERSAL
             extruderLastDirection = 1;
             timer += 40; // Add some more wait time to prevent blocking
         }
@@ -1182,6 +1213,7 @@ ISR(EXTRUDER_TIMER_VECTOR)
         if (-Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS)
         {
             Extruder::setDirection(false);
+            STEP_TIMELINE_REVERSAL
             extruderLastDirection = -1;
             timer += 40; // Add some more wait time to prevent blocking
         }
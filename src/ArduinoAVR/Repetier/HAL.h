@@ -274,7 +274,11 @@ public:
 #endif
     HAL();
     virtual ~HAL();
-    static inline void hwSetup(void) { }
+    static inline void hwSetup(void) {
+#if EEPROM_RAM_CACHE
+        eprInitCache();
+#endif
+    }
     // return val*val
     static uint16_t integerSqrt(uint32_t a);
     /** \brief Optimized division
@@ -512,6 +516,53 @@ public:
     }
     static inline void tone(uint8_t pin, int duration) { ::tone(pin, duration); }
     static inline void noTone(uint8_t pin) { ::noTone(pin); }
+#if EEPROM_RAM_CACHE
+    /** Burns per 256 byte EEPROM block since start. */
+    static uint16_t eprWear[(E2END + 256) >> 8];
+    /** Writes that did not need a burn because the value was unchanged or overwritten before burning. */
+    static uint32_t eprWritesSaved;
+    static void eprInitCache();
+    static void eprRead(unsigned int pos, void* dst, uint8_t size);
+    static void eprWrite(unsigned int pos, const void* src, uint8_t size);
+    /** Burns the next pending byte if the EEPROM is ready. Never waits. */
+    static void eprBurnStep();
+    /** Burns all pending bytes. */
+    static void eprFlush();
+    static uint16_t eprPending();
+    static void eprReport();
+    static inline void eprSetByte(unsigned int pos, uint8_t value) {
+        eprWrite(pos, &value, 1);
+    }
+    static inline void eprSetInt16(unsigned int pos, int16_t value) {
+        eprWrite(pos, &value, 2);
+    }
+    static inline void eprSetInt32(unsigned int pos, int32_t value) {
+        eprWrite(pos, &value, 4);
+    }
+    static inline void eprSetFloat(unsigned int pos, float value) {
+        eprWrite(pos, &value, 4);
+    }
+    static inline uint8_t eprGetByte(unsigned int pos) {
+        uint8_t v;
+        eprRead(pos, &v, 1);
+        return v;
+    }
+    static inline int16_t eprGetInt16(unsigned int pos) {
+        int16_t v;
+        eprRead(pos, &v, 2);
+        return v;
+    }
+    static inline int32_t eprGetInt32(unsigned int pos) {
+        int32_t v;
+        eprRead(pos, &v, 4);
+        return v;
+    }
+    static inline float eprGetFloat(unsigned int pos) {
+        float v;
+        eprRead(pos, &v, 4);
+        return v;
+    }
+#else
     static inline void eprSetByte(unsigned int pos, uint8_t value) {
         eeprom_write_byte((unsigned char*)(EEPROM_OFFSET + pos), value);
     }
@@ -539,6 +590,7 @@ public:
                           4); // newer gcc have eeprom_read_block but not arduino 22
         return v;
     }
+#endif
 
     // Faster version of InterruptProtectedBlock.
     // For safety it may only be called from within an
@@ -550,6 +602,16 @@ public:
     // interrupt handler.
     static inline void forbidInterrupts() { cli(); }
     static inline millis_t timeInMilliseconds() { return millis(); }
+    static inline uint32_t timeInMicroseconds() { return micros(); }
+#ifdef DEBUG_ISR_PROFILE
+    /** Timer 1 runs with CPU clock. It restarts at OCR1A, so differences need
+    OCR1A + 1 added if the counter wrapped. */
+    static inline uint16_t cycleCounter() { return TCNT1; }
+    static inline uint32_t cyclesSince(uint16_t start) {
+        uint16_t now = TCNT1;
+        return now >= start ? now - start : static_cast<uint32_t>(OCR1A) + 1 - start + now;
+    }
+#endif
     static inline char readFlashByte(PGM_P ptr) { return pgm_read_byte(ptr); }
     static inline int16_t readFlashWord(const uint16_t* ptr) { return pgm_read_word((PGM_P)ptr); }
     static inline void serialSetBaudrate(long baud) {
@@ -0,0 +1,120 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef _ISR_PROFILE_H
+#define _ISR_PROFILE_H
+
+/* Only depends on stdint.h so the statistics can also be compiled and
+   checked on a PC. Reporting is done in motion.cpp. */
+#include <stdint.h>
+
+#ifndef ISR_PROFILE_SUB_BITS
+#define ISR_PROFILE_SUB_BITS 1
+#endif
+/** Histogram buckets: 2^ISR_PROFILE_SUB_BITS buckets per power of 2 up to 65535 cycles. */
+#define ISR_PROFILE_BUCKETS (16 << ISR_PROFILE_SUB_BITS)
+
+/** Branches of the stepper interrupt with separate statistics. The first three
+match the phase of the step timeline. */
+enum IsrBranch {
+    ISR_BRANCH_ACCELERATE = 0, ///< Steps of an accelerating line
+    ISR_BRANCH_NOMINAL,        ///< Steps at constant speed
+    ISR_BRANCH_DECELERATE,     ///< Steps of a decelerating line
+    ISR_BRANCH_NEW_LINE,       ///< Setup of the next line
+    ISR_BRANCH_IDLE,           ///< No line to execute
+    ISR_BRANCHES
+};
+
+/** \brief Cycle statistics of one interrupt or interrupt branch.
+
+Keeps count, min, max, sum and a histogram with logarithmic buckets. Each power
+of 2 gets 2^ISR_PROFILE_SUB_BITS buckets, so short and long calls get the same
+relative resolution. Calls above 65535 cycles end in the last bucket but still
+count for max and average.
+*/
+class IsrCycleStats {
+public:
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t sumCycles;
+    uint32_t histogram[ISR_PROFILE_BUCKETS];
+
+    void reset() {
+        count = 0;
+        minCycles = 0xffffffff;
+        maxCycles = 0;
+        sumCycles = 0;
+        for (uint8_t i = 0; i < ISR_PROFILE_BUCKETS; i++)
+            histogram[i] = 0;
+    }
+    /** Bucket for a cycle count. Values below 2^ISR_PROFILE_SUB_BITS get their own bucket. */
+    static uint8_t bucket(uint32_t cycles) {
+        if (cycles > 0xffff)
+            return ISR_PROFILE_BUCKETS - 1;
+        if (cycles < (1 << ISR_PROFILE_SUB_BITS))
+            return cycles;
+        uint8_t msb = 15;
+        while (!(cycles & (1ul << msb)))
+            msb--;
+        return (msb << ISR_PROFILE_SUB_BITS) | ((cycles >> (msb - ISR_PROFILE_SUB_BITS)) & ((1 << ISR_PROFILE_SUB_BITS) - 1));
+    }
+    /** Lowest cycle count of a bucket. Buckets between the direct and the
+    logarithmic ones stay empty and return 0. */
+    static uint32_t bucketStart(uint8_t b) {
+        uint8_t msb = b >> ISR_PROFILE_SUB_BITS;
+        if (msb < ISR_PROFILE_SUB_BITS)
+            return b < (1 << ISR_PROFILE_SUB_BITS) ? b : 0;
+        return (1ul << msb) | (static_cast<uint32_t>(b & ((1 << ISR_PROFILE_SUB_BITS) - 1)) << (msb - ISR_PROFILE_SUB_BITS));
+    }
+    void add(uint32_t cycles) {
+        count++;
+        sumCycles += cycles;
+        if (cycles < minCycles)
+            minCycles = cycles;
+        if (cycles > maxCycles)
+            maxCycles = cycles;
+        histogram[bucket(cycles)]++;
+    }
+    uint32_t average() const {
+        return count ? static_cast<uint32_t>(sumCycles / count) : 0;
+    }
+};
+
+/** \brief Cycle counts of the stepper and PWM interrupts.
+
+The HAL measures every stepper and PWM interrupt call with the CPU cycle counter
+(DWT on ARM, timer 1 on AVR) and adds it to the statistics of the branch that
+bresenhamStep selected. The times include interrupts nested into the call, as
+they delay the next step the same way. M541 reports and resets the statistics.
+*/
+class IsrProfile {
+public:
+    static IsrCycleStats stepper[ISR_BRANCHES];
+    static IsrCycleStats pwm;
+    static volatile uint8_t branch; ///< Branch of the running stepper call
+
+    static void reset() {
+        for (uint8_t i = 0; i < ISR_BRANCHES; i++)
+            stepper[i].reset();
+        pwm.reset();
+    }
+    static void report();
+};
+
+#endif
@@ -103,6 +103,12 @@ uint32_t Printer::stepNumber;       ///< Step number in current move.
 int32_t Printer::advanceExecuted; ///< Executed advance steps
 #endif
 int Printer::advanceStepsSet;
+#if ADVANCE_IN_STEPPER
+int32_t Printer::advanceSmoothed = 0;
+uint32_t Printer::extruderStepTicks = 1;
+uint32_t Printer::extruderStepBudget = 0;
+int8_t Printer::extruderDirection = 0;
+#endif
 #endif
 #if NONLINEAR_SYSTEM
 int32_t Printer::maxDeltaPositionSteps;
@@ -466,6 +472,13 @@ void Printer::reportPrinterMode() {
         break;
     }
 }
+#if ADVANCE_IN_STEPPER
+/** Computes extruderStepTicks from the E max feedrate and resolution. Call
+after maxFeedrate[E_AXIS] or axisStepsPerMM[E_AXIS] changed. */
+void Printer::updateExtruderStepTicks() {
+    extruderStepTicks = static_cast<uint32_t>(F_CPU / (maxFeedrate[E_AXIS] * axisStepsPerMM[E_AXIS])) + 1;
+}
+#endif
 void Printer::updateDerivedParameter() {
 #if NONLINEAR_SYSTEM
     travelMovesPerSecond = EEPROM::deltaSegmentsPerSecondMove();
@@ -704,6 +717,9 @@ void Printer::updateAdvanceFlags() {
             Printer::setAdvanceActivated(true);
 #endif
     }
+#if ADVANCE_IN_STEPPER
+    HAL::resetExtruderDirection();
+#endif
 #endif
 }
 
@@ -1011,6 +1027,9 @@ uint8_t Printer::setDestinationStepsFromGCode(GCode* com) {
 
 void Printer::setup() {
     HAL::stopWatchdog();
+#if PRINTLINE_DYNAMIC_CACHE
+    PrintLine::allocateCache();
+#endif
     for (uint8_t i = 0; i < NUM_PWM; i++)
         pwm_pos[i] = 0;
 #if FEATURE_CONTROLLER == CONTROLLER_VIKI
@@ -1410,6 +1429,12 @@ void Printer::setup() {
     maxJerk = MAX_JERK;
 #if DRIVE_SYSTEM != DELTA
     maxZJerk = MAX_ZJERK;
+#endif
+#if INPUT_SHAPING
+    InputShaper::setDefaults();
+#endif
+#ifdef DEBUG_ISR_PROFILE
+    IsrProfile::reset();
 #endif
     offsetX = offsetY = offsetZ = 0;
     interval = 5000;
@@ -2736,7 +2761,7 @@ void Printer::showConfiguration() {
     Com::config(PSTR("ZProbe:"), FEATURE_Z_PROBE);
     Com::config(PSTR("Autolevel:"), FEATURE_AUTOLEVEL);
     Com::config(PSTR("EEPROM:"), EEPROM_MODE != 0);
-    Com::config(PSTR("PrintlineCache:"), PRINTLINE_CACHE_SIZE);
+    Com::config(PSTR("PrintlineCache:"), static_cast<int>(PRINTLINE_CACHE_LINES));
     Com::config(PSTR("JerkXY:"), maxJerk);
     Com::config(PSTR("KeepAliveInterval:"), KEEP_ALIVE_INTERVAL);
 #if DRIVE_SYSTEM != DELTA
@@ -274,6 +274,12 @@ public:
 #if ENABLE_QUADRATIC_ADVANCE || defined(DOXYGEN)
     static long advanceExecuted; ///< Executed advance steps
 #endif
+#if ADVANCE_IN_STEPPER || defined(DOXYGEN)
+    static int32_t advanceSmoothed;     ///< Low pass filtered advance in steps*65536
+    static uint32_t extruderStepTicks;  ///< Shortest time between extruder steps
+    static uint32_t extruderStepBudget; ///< Ticks left for extruder steps
+    static int8_t extruderDirection;    ///< Current extruder direction, 0 = unknown
+#endif
 #endif
     static uint16_t menuMode;
     static bool failedMode;  // In failed mode only M110 and M999 is working
@@ -1200,6 +1206,9 @@ public:
 #endif
     }
     static void updateDerivedParameter();
+#if ADVANCE_IN_STEPPER
+    static void updateExtruderStepTicks();
+#endif
     /** If we are not homing or destination check being disabled, this will reduce
   _destinationSteps_ to a valid value. In other words this works as software
   endstop. */
@@ -24,6 +24,7 @@
 #define _REPETIER_H
 
 #include <math.h>
+#include <string.h>
 #include <stdint.h>
 
 #define REPETIER_VERSION "1.0.5"
@@ -98,6 +99,18 @@ Switch it off for production, it costs execution time. */
 //#define DEBUG_REAL_JERK
 // Debug reason for not mounting a sd card
 //#define DEBUG_SD_ERROR
+// Report bytes, speed and longest read of the SD read buffer after each print
+//#define DEBUG_SD_READ
+/** Records a timeline of all executed steps (time, stepped axes, directions)
+and planner statistics. M536 starts/stops recording and sends the data to the
+host, so motion parameters can be analysed without a scope. Costs RAM and
+stepper interrupt time, so keep it disabled for normal prints. */
+//#define DEBUG_STEP_TIMELINE
+/** Measures the CPU cycles of every stepper and PWM interrupt call. Stepper calls
+are split into accelerating, constant speed, decelerating, new line and idle.
+M541 reports min/avg/max and a histogram per branch, M541 S0 resets them. Shows
+how close the interrupts are to overrunning at the current step rate. */
+//#define DEBUG_ISR_PROFILE
 // Uncomment the following line to enable debugging. You can better control
 // debugging below the following line
 //#define DEBUG
@@ -267,6 +280,9 @@ Switch it off for production, it costs execution time. */
 #pragma GCC diagnostic ignored "-Wunused-variable"
 
 #include "Configuration.h"
+#ifdef HOST_SIMULATOR
+#include "SimulatorConfig.h"
+#endif
 
 #ifndef SAFE_HOMING
 #define SAFE_HOMING 0
@@ -307,6 +323,12 @@ Switch it off for production, it costs execution time. */
 #define HOST_RESCUE 0
 #endif
 
+// The host simulator compiles the AVR cache against its simulated eeprom
+#if !defined(EEPROM_RAM_CACHE) || EEPROM_MODE == 0 || (CPU_ARCH != ARCH_AVR && !defined(HOST_SIMULATOR))
+#undef EEPROM_RAM_CACHE
+#define EEPROM_RAM_CACHE 0
+#endif
+
 #ifndef EMERGENCY_PARSER
 #if DRIVE_SYSTEM != 3 || CPU_ARCH != ARCH_AVR
 #define EMERGENCY_PARSER 1
@@ -376,6 +398,10 @@ typedef uint8_t secondspeed_t;
 #if defined(FAST_COREXYZ) && !(DRIVE_SYSTEM == XY_GANTRY || DRIVE_SYSTEM == YX_GANTRY || DRIVE_SYSTEM == XZ_GANTRY || DRIVE_SYSTEM == ZX_GANTRY || DRIVE_SYSTEM == GANTRY_FAKE)
 #undef FAST_COREXYZ
 #endif
+#if DRIVE_SYSTEM != DELTA || !defined(DELTA_SEGMENT_TOLERANCE)
+#undef DELTA_SEGMENT_TOLERANCE
+#define DELTA_SEGMENT_TOLERANCE 0
+#endif
 #ifdef FAST_COREXYZ
 #if DELTA_SEGMENTS_PER_SECOND_PRINT > 30
 #undef DELTA_SEGMENTS_PER_SECOND_PRINT
@@ -389,10 +415,10 @@ typedef uint8_t secondspeed_t;
 #endif
 
 inline void memcopy2(void* dest, void* source) {
-    *((int16_t*)dest) = *((int16_t*)source);
+    memcpy(dest, source, 2);
 }
 inline void memcopy4(void* dest, void* source) {
-    *((int32_t*)dest) = *((int32_t*)source);
+    memcpy(dest, source, 4);
 }
 
 #ifndef JSON_OUTPUT
@@ -435,7 +461,103 @@ inline void memcopy4(void* dest, void* source) {
 #endif
 #define MICROSTEP32 HIGH, HIGH
 
+#if CPU_ARCH != ARCH_ARM || !NEW_COMMUNICATION || !defined(GCODE_BUFFER_SIZE)
+#undef GCODE_BUFFER_SIZE
 #define GCODE_BUFFER_SIZE 1
+#endif
+#if GCODE_BUFFER_SIZE < 1 || GCODE_BUFFER_SIZE > 255
+#error GCODE_BUFFER_SIZE must be between 1 and 255
+#endif
+#if !NEW_COMMUNICATION || !defined(OUTPUT_BUFFER_SIZE)
+#undef OUTPUT_BUFFER_SIZE
+#define OUTPUT_BUFFER_SIZE 0
+#endif
+#if OUTPUT_BUFFER_SIZE > 255
+#error OUTPUT_BUFFER_SIZE must be less then 256
+#endif
+
+#if CPU_ARCH != ARCH_ARM || !defined(PRINTLINE_DYNAMIC_CACHE)
+#undef PRINTLINE_DYNAMIC_CACHE
+#define PRINTLINE_DYNAMIC_CACHE 0
+#endif
+#if PRINTLINE_DYNAMIC_CACHE
+#ifndef PRINTLINE_CACHE_SIZE_MAX
+#define PRINTLINE_CACHE_SIZE_MAX 256
+#endif
+#ifndef PRINTLINE_CACHE_RESERVE_RAM
+#define PRINTLINE_CACHE_RESERVE_RAM 16384
+#endif
+#if (PRINTLINE_CACHE_SIZE_MAX & (PRINTLINE_CACHE_SIZE_MAX - 1)) != 0 || PRINTLINE_CACHE_SIZE_MAX < 16
+#error PRINTLINE_CACHE_SIZE_MAX must be a power of 2 and at least 16
+#endif
+// Size of move cache is only known at runtime
+#define PRINTLINE_CACHE_LINES PrintLine::linesCacheSize
+#define PRINTLINE_INDEX_MASK PrintLine::linesCacheMask
+#else
+#define PRINTLINE_CACHE_LINES PRINTLINE_CACHE_SIZE
+#if (PRINTLINE_CACHE_SIZE & (PRINTLINE_CACHE_SIZE - 1)) == 0
+#define PRINTLINE_INDEX_MASK (PRINTLINE_CACHE_SIZE - 1)
+#endif
+#endif
+#if !defined(STEP_TIMING_TABLE) || !RAMP_ACCELERATION
+#undef STEP_TIMING_TABLE
+#define STEP_TIMING_TABLE 0
+#endif
+#if STEP_TIMING_TABLE
+/** Step interval below which the stepper executes 2 steps per interrupt */
+#define STEP_DOUBLER_INTERVAL (F_CPU / STEP_DOUBLER_FREQUENCY)
+/** Lowest start/end speed in steps/s for table based ramps */
+#define RAMP_TABLE_MIN_SPEED 64
+#endif
+#if !defined(S_CURVE_ACCELERATION) || !RAMP_ACCELERATION
+#undef S_CURVE_ACCELERATION
+#define S_CURVE_ACCELERATION 0
+#endif
+#if !defined(JUNCTION_DEVIATION) || !RAMP_ACCELERATION
+#undef JUNCTION_DEVIATION
+#define JUNCTION_DEVIATION 0
+#endif
+#ifndef JUNCTION_DEVIATION_MM
+#define JUNCTION_DEVIATION_MM 0.02
+#endif
+#if !defined(INPUT_SHAPING) || !RAMP_ACCELERATION || CPU_ARCH != ARCH_ARM
+#undef INPUT_SHAPING
+#define INPUT_SHAPING 0
+#endif
+#ifndef INPUT_SHAPING_UNSHAPED_ACCELERATION
+#define INPUT_SHAPING_UNSHAPED_ACCELERATION 100
+#endif
+#if !defined(ADVANCE_IN_STEPPER) || !USE_ADVANCE || CPU_ARCH != ARCH_ARM
+#undef ADVANCE_IN_STEPPER
+#define ADVANCE_IN_STEPPER 0
+#endif
+#if ADVANCE_IN_STEPPER
+#undef ENABLE_QUADRATIC_ADVANCE
+#define ENABLE_QUADRATIC_ADVANCE 0
+#ifndef ADVANCE_SMOOTH_TIME
+#define ADVANCE_SMOOTH_TIME 40
+#endif
+#ifndef ADVANCE_DIR_FILTER_STEPS
+#define ADVANCE_DIR_FILTER_STEPS 2
+#endif
+/** 2^32 / smoothing time in ticks, weight of one tick in the advance low pass */
+#if ADVANCE_SMOOTH_TIME > 0
+#define ADVANCE_SMOOTH_FACTOR (4294967296ULL / (ADVANCE_SMOOTH_TIME * (F_CPU / 1000)))
+#else
+#define ADVANCE_SMOOTH_FACTOR 4294967296ULL
+#endif
+#endif
+/** Maximum number of lines the path planner goes back to increase speeds.
+Older lines keep their computed speeds, which limits planning time for large
+move caches. */
+#ifndef PLANNER_MAX_WINDOW
+#define PLANNER_MAX_WINDOW 64
+#endif
+// 1 stops the backward planner at the first junction it does not change. This is not
+// step identical to planning the whole window and saved no work on the simulator tests.
+#ifndef PLANNER_EARLY_STOP
+#define PLANNER_EARLY_STOP 0
+#endif
 
 #ifndef FEATURE_BABYSTEPPING
 #define FEATURE_BABYSTEPPING 0
@@ -498,6 +620,16 @@ inline void memcopy4(void* dest, void* source) {
 #else
 #define NONLINEAR_SYSTEM 0
 #endif
+#if !NONLINEAR_SYSTEM || !defined(NONLINEAR_SEGMENT_POOL)
+#undef NONLINEAR_SEGMENT_POOL
+#define NONLINEAR_SEGMENT_POOL 0
+#endif
+#if NONLINEAR_SEGMENT_POOL && (NONLINEAR_SEGMENT_POOL < 2 * DELTASEGMENTS_PER_PRINTLINE || NONLINEAR_SEGMENT_POOL > 65535)
+#error NONLINEAR_SEGMENT_POOL must be between 2 * DELTASEGMENTS_PER_PRINTLINE and 65535
+#endif
+#if NONLINEAR_SEGMENT_POOL && DELTASEGMENTS_PER_PRINTLINE > 127
+#error DELTASEGMENTS_PER_PRINTLINE must be less then 128 with NONLINEAR_SEGMENT_POOL
+#endif
 
 #ifdef FEATURE_Z_PROBE
 #define MANUAL_CONTROL 1
@@ -516,6 +648,13 @@ inline void memcopy4(void* dest, void* source) {
 // After this count of steps a new SIN / COS calculation is started to correct
 // the circle interpolation
 #define N_ARC_CORRECTION 25
+#ifndef ARC_CHORD_TOLERANCE
+#define ARC_CHORD_TOLERANCE 0
+#endif
+#if !defined(ARC_IN_STEPPER) || !ARC_SUPPORT || CPU_ARCH != ARCH_ARM || NONLINEAR_SYSTEM || GANTRY || ENABLE_BACKLASH_COMPENSATION || FEATURE_AXISCOMP
+#undef ARC_IN_STEPPER
+#define ARC_IN_STEPPER 0
+#endif
 
 // Test for shared cooler
 #if NUM_EXTRUDER == 6 && EXT0_EXTRUDER_COOLER_PIN > -1 && EXT0_EXTRUDER_COOLER_PIN == EXT1_EXTRUDER_COOLER_PIN && EXT2_EXTRUDER_COOLER_PIN == EXT3_EXTRUDER_COOLER_PIN && EXT4_EXTRUDER_COOLER_PIN == EXT5_EXTRUDER_COOLER_PIN && EXT0_EXTRUDER_COOLER_PIN == EXT2_EXTRUDER_COOLER_PIN && EXT0_EXTRUDER_COOLER_PIN == EXT4_EXTRUDER_COOLER_PIN
@@ -681,6 +820,32 @@ inline void memcopy4(void* dest, void* source) {
 #define DEBUG_MEMORY Commands::checkFreeMemory();
 #endif
 
+#ifdef DEBUG_STEP_TIMELINE
+#ifndef STEP_TIMELINE_SIZE
+#if CPU_ARCH == ARCH_ARM
+#define STEP_TIMELINE_SIZE 1024
+#else
+#define STEP_TIMELINE_SIZE 64
+#endif
+#endif
+#define STEP_TIMELINE_MARK(x) timelineSteps |= (x);
+#define STEP_TIMELINE_REVERSAL \
+    if (StepTimeline::recording) \
+        StepTimeline::extruderReversals++;
+#else
+#define STEP_TIMELINE_MARK(x)
+#define STEP_TIMELINE_REVERSAL
+#endif
+
+#ifdef DEBUG_ISR_PROFILE
+#if CPU_ARCH != ARCH_ARM && !defined(ISR_PROFILE_SUB_BITS)
+#define ISR_PROFILE_SUB_BITS 0 // one bucket per power of 2 to save RAM
+#endif
+#define ISR_PROFILE_BRANCH(x) IsrProfile::branch = (x);
+#else
+#define ISR_PROFILE_BRANCH(x)
+#endif
+
 #define NUM_ANALOG_TEMP_SENSORS \
     EXT0_ANALOG_INPUTS + EXT1_ANALOG_INPUTS + EXT2_ANALOG_INPUTS + EXT3_ANALOG_INPUTS + EXT4_ANALOG_INPUTS + EXT5_ANALOG_INPUTS + BED_ANALOG_INPUTS + THERMO_ANALOG_INPUTS
 /** \brief number of analog input signals. Normally 1 for each temperature
@@ -729,7 +894,11 @@ inline void memcopy4(void* dest, void* source) {
 #define KEEP_ALIVE_INTERVAL 2000
 #endif
 
+#ifdef HOST_SIMULATOR
+#include "SimulatorHAL.h"
+#else
 #include "HAL.h"
+#endif
 #ifndef MAX_VFAT_ENTRIES
 #ifdef AVR_BOARD
 #define MAX_VFAT_ENTRIES (2)
@@ -761,6 +930,32 @@ inline void memcopy4(void* dest, void* source) {
 #if SDSUPPORT
 #include "src/SdFat/SdFat.h"
 #endif
+#if !defined(SD_BINARY_SIDECAR) || !SDSUPPORT
+#undef SD_BINARY_SIDECAR
+#define SD_BINARY_SIDECAR 0
+#endif
+#if !defined(SD_READ_BUFFER_SIZE) || !SDSUPPORT
+#undef SD_READ_BUFFER_SIZE
+#define SD_READ_BUFFER_SIZE 0
+#endif
+#if !defined(SD_DIR_INDEX_SIZE) || !SDSUPPORT
+#undef SD_DIR_INDEX_SIZE
+#define SD_DIR_INDEX_SIZE 0
+#endif
+#if !defined(SD_INFO_CACHE_SIZE) || !SDSUPPORT || !JSON_OUTPUT
+#undef SD_INFO_CACHE_SIZE
+#define SD_INFO_CACHE_SIZE 0
+#endif
+#if SD_INFO_CACHE_SIZE & 7
+#error SD_INFO_CACHE_SIZE must be a multiple of 8
+#endif
+#if SD_READ_BUFFER_SIZE & (SD_READ_BUFFER_SIZE - 1)
+#error SD_READ_BUFFER_SIZE must be a power of 2
+#endif
+#if SD_BINARY_SIDECAR
+#define SD_BINARY_MAGIC 0x32474252UL ///< "RBG2" at start of a sidecar file
+#define SD_BINARY_HEADER_SIZE 16     ///< Magic, size, first cluster and modification time of the source file
+#endif
 
 #include "gcode.h"
 
@@ -1041,6 +1236,8 @@ extern void finishNextSegment();
 #if NONLINEAR_SYSTEM
 extern uint8_t transformCartesianStepsToDeltaSteps(long cartesianPosSteps[],
                                                    long deltaPosSteps[]);
+extern uint8_t transformCartesianStepsToDeltaStepsBatch(int32_t posSteps[][Z_AXIS_ARRAY],
+                                                        uint8_t count);
 #if SOFTWARE_LEVELING
 extern void calculatePlane(long factors[], long p1[], long p2[], long p3[]);
 extern float calcZOffset(long factors[], long pointX, long pointY);
@@ -1064,6 +1261,9 @@ extern void microstepInit();
 
 #include "Printer.h"
 #include "motion.h"
+#ifdef DEBUG_ISR_PROFILE
+#include "IsrProfile.h"
+#endif
 extern long baudrate;
 
 // #include "HAL.h"
@@ -1116,10 +1316,16 @@ public:
     // int16_t n;
     bool savetosd;
     SdBaseFile parentFound;
+#if SD_DIR_INDEX_SIZE > 0
+    uint16_t folderChanges; ///< Files and folders the firmware created or deleted, checked by the LCD file browser index
+#endif
 
     SDCard();
     void initsd();
     void writeCommand(GCode* code);
+#if SD_BINARY_SIDECAR
+    bool compileBinary(const char* filename);
+#endif
     bool selectFile(const char* filename, bool silent = false);
     void mount();
     void unmount();
@@ -1134,13 +1340,26 @@ public:
             return;
         sdpos = newpos;
         file.seekSet(sdpos);
+#if SD_READ_BUFFER_SIZE
+        sdSource.resetBuffer();
+#endif
     }
     void printStatus();
+    /** Call after creating or deleting a file or folder, so the LCD file browser index gets rebuilt. */
+    inline void folderChanged() {
+#if SD_DIR_INDEX_SIZE > 0
+        folderChanges++;
+#endif
+    }
     void ls();
 #if JSON_OUTPUT
     void lsJSON(const char* filename);
     void JSONFileInfo(const char* filename);
     static void printEscapeChars(const char* s);
+    void loadFileInfo(SdFile& file, GCodeFileInfo& info);
+#endif
+#if SD_INFO_CACHE_SIZE
+    void updateInfoCache();
 #endif
     void startWrite(char* filename);
     void deleteFile(char* filename);
@@ -1154,6 +1373,20 @@ public:
 #endif
 private:
     uint8_t lsRecursive(SdBaseFile* parent, uint8_t level, char* findFilename);
+#if SD_INFO_CACHE_SIZE
+    SdBaseFile infoCacheFile; ///< .fileinfo.bin in root folder, opened on first use
+    SdBaseFile infoScanDir;   ///< Folder whose files get cached while idle
+    SdFile infoScanFile;      ///< File of infoScanDir being parsed while idle
+    GCodeFileInfo infoScanInfo;
+    bool openInfoCache(bool extend = false);
+    bool readInfoCache(SdFile& file, GCodeFileInfo& info);
+    void writeInfoCache(SdFile& file, GCodeFileInfo& info);
+#endif
+#if SD_BINARY_SIDECAR
+    static bool binaryFilename(const char* filename, char* buffer);
+    bool selectBinary(const char* filename);
+    void removeBinary(const char* filename);
+#endif
     // SdFile *getDirectory(char* name);
 };
 
@@ -246,8 +246,17 @@ void Commands::commandLoop() {
                 code->echoCommand();
 #endif
             } else
+#endif
+            {
+#if GCODE_BUFFER_SIZE > 1
+                GCode::readSource = GCodeSource::activeSource; // continue reading there while code executes
 #endif
                 Commands::executeGCode(code);
+#if GCODE_BUFFER_SIZE > 1
+                GCodeSource::activeSource = GCode::readSource;
+                GCode::readSource = NULL;
+#endif
+            }
             code->popCurrentCommand();
             lastCommandReceived = HAL::timeInMilliseconds();
         } else {
@@ -272,6 +281,17 @@ void Commands::checkForPeriodicalActions(bool allowNewMoves) {
 #if EMERGENCY_PARSER
     GCodeSource::prefetchAll();
 #endif
+#if SD_READ_BUFFER_SIZE
+    if (sd.sdmode == 1)
+        sdSource.fillBuffer();
+#endif
+#if SD_INFO_CACHE_SIZE
+    sd.updateInfoCache();
+#endif
+#if EEPROM_RAM_CACHE
+    HAL::eprBurnStep();
+#endif
+    GCodeSource::flushOutput(); // send incomplete lines
     EVENT_PERIODICAL;
 #if defined(DOOR_PIN) && DOOR_PIN > -1
     if (Printer::updateDoorOpen()) {
@@ -484,7 +504,7 @@ void Commands::setFanSpeed(int speed, bool immediately) {
     Printer::fanSpeed = speed;
     if (PrintLine::linesCount == 0 || immediately) {
         if (Printer::mode == PRINTER_MODE_FFF) {
-            for (fast8_t i = 0; i < PRINTLINE_CACHE_SIZE; i++)
+            for (ufast8_t i = 0; i < PRINTLINE_CACHE_LINES; i++)
                 PrintLine::lines[i].secondSpeed = speed; // fill all printline buffers with new fan speed value
         }
         Printer::setFanSpeedDirectly(speed);
@@ -1618,6 +1638,7 @@ void Commands::processGCode(GCode* com) {
         return;
     }
     uint32_t codenum; // throw away variable
+    PrintLine::startMove();
     switch (com->G) {
     case 0: // G0 -> G1
     case 1: // G1
@@ -1670,7 +1691,7 @@ void Commands::processGCode(GCode* com) {
             int wp = (int)PrintLine::linesWritePos;
             int n = (wp - lp);
             if (n < 0)
-                n += PRINTLINE_CACHE_SIZE;
+                n += PRINTLINE_CACHE_LINES;
             noInts.unprotect();
             if (n != lc)
                 Com::printFLN(PSTR("Buffer corrupted"));
@@ -1681,6 +1702,7 @@ void Commands::processGCode(GCode* com) {
         LaserDriver::laserOn = laserOn;
     }
 #endif // defined
+    PrintLine::endMove();
     break;
 #if ARC_SUPPORT
     case 2: // CW Arc
@@ -1701,6 +1723,7 @@ void Commands::processGCode(GCode* com) {
         LaserDriver::laserOn = laserOn;
     }
 #endif // defined
+    PrintLine::endMove();
     break;
 #endif
     case 4: // G4 dwell
@@ -2450,6 +2473,14 @@ void Commands::processMCode(GCode* com) {
             sd.makeDirectory(com->text);
         }
         break;
+#if SD_BINARY_SIDECAR
+    case 34: // M34 filename - Compile file to binary sidecar
+        if (com->hasString()) {
+            sd.fat.chdir();
+            sd.compileBinary(com->text);
+        }
+        break;
+#endif
 #endif
 #if JSON_OUTPUT && SDSUPPORT
     case 36: // M36 JSON File Info
@@ -2840,6 +2871,11 @@ void Commands::processMCode(GCode* com) {
         Com::cap(PSTR("EMERGENCY_PARSER:1"));
 #else
         Com::cap(PSTR("EMERGENCY_PARSER:0"));
+#endif
+#if NEW_COMMUNICATION
+        Com::cap(PSTR("STREAMING_OK:1")); // M538, not the ADVANCED_OK format of other firmwares
+#else
+        Com::cap(PSTR("STREAMING_OK:0"));
 #endif
         reportPrinterUsage();
         Printer::reportPrinterMode();
@@ -3020,6 +3056,9 @@ void Commands::processMCode(GCode* com) {
         }
         if (com->hasE()) {
             Printer::maxFeedrate[E_AXIS] = com->E / 60.0f;
+#if ADVANCE_IN_STEPPER
+            Printer::updateExtruderStepTicks();
+#endif
         }
         if (com->hasS()) {
             manageMonitor = com->S != 255;
@@ -3498,7 +3537,7 @@ void Commands::processMCode(GCode* com) {
         int wp = (int)PrintLine::linesWritePos;
         int n = (wp - lp);
         if (n < 0)
-            n += PRINTLINE_CACHE_SIZE;
+            n += PRINTLINE_CACHE_LINES;
         noInts.unprotect();
         if (n != lc)
             Com::printFLN(PSTR("Buffer corrupted"));
@@ -3533,6 +3572,33 @@ void Commands::processMCode(GCode* com) {
         if (com->hasS())
             Printer::maxRealJerk = 0;
         break;
+#endif
+#ifdef DEBUG_STEP_TIMELINE
+    case 536: // M536 S<1=start,0=stop> P1 = send recorded timeline, no parameter = statistics
+        if (com->hasS()) {
+            if (com->S)
+                StepTimeline::start();
+            else
+                StepTimeline::stop();
+        }
+        if (com->hasP() && com->P == 1)
+            StepTimeline::sendEntries();
+        else if (!com->hasS())
+            StepTimeline::reportStatistics();
+        break;
+#endif
+#if S_CURVE_ACCELERATION
+    case 537: // M537 S<1=S-curve,0=trapezoid> select acceleration profile
+        if (com->hasS()) {
+            Commands::waitUntilEndOfAllMoves();
+            PrintLine::sCurveEnabled = com->S != 0;
+        }
+        Com::printFLN(PSTR("S-curve acceleration:"), (int)PrintLine::sCurveEnabled);
+        break;
+#endif
+#if NEW_COMMUNICATION
+    case 538: // M538 S<1/0> streaming acknowledge, switched on receive in GCode::checkAndPushCommand
+        break;
 #endif
     /*      case 535:  // M535
   Com::printF(PSTR("Last commanded position:"),Printer::lastCmdPos[X_AXIS]);
@@ -3568,6 +3634,38 @@ void Commands::processMCode(GCode* com) {
             }
         }
         break;
+#if INPUT_SHAPING
+    case 540: // M540 P<0=X,1=Y> S<type> F<frequency> D<damping> configure input shaper
+        if (com->hasP() && com->P >= 0 && com->P <= 1 && (com->hasS() || com->hasF() || com->hasD())) {
+            Commands::waitUntilEndOfAllMoves();
+            InputShaper& shaper = InputShaper::axis[com->P];
+            if (com->hasS())
+                shaper.type = com->S;
+            if (com->hasF())
+                shaper.frequency = com->F;
+            if (com->hasD())
+                shaper.damping = com->D;
+            shaper.update();
+        }
+        InputShaper::report();
+        break;
+#endif
+#ifdef DEBUG_ISR_PROFILE
+    case 541: // M541 S0 reset, no parameter = report ISR cycle statistics
+        if (com->hasS() && com->S == 0) {
+            InterruptProtectedBlock noInts;
+            IsrProfile::reset();
+        } else
+            IsrProfile::report();
+        break;
+#endif
+#if EEPROM_RAM_CACHE
+    case 542: // M542 S1 burn pending bytes now, no parameter = report EEPROM burns
+        if (com->hasS() && com->S == 1)
+            HAL::eprFlush();
+        HAL::eprReport();
+        break;
+#endif
 #if FEATURE_CONTROLLER != NO_CONTROLLER && FEATURE_RETRACTION
     case 600:
         uid.executeAction(UI_ACTION_WIZARD_FILAMENTCHANGE, true);
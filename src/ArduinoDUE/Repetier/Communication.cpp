@@ -120,6 +120,8 @@ FSTRINGVALUE(Com::tJSONErrorEnd, "\"}")
 FSTRINGVALUE(Com::tJSONFileInfoStart, "{\"err\":0,\"size\":");
 FSTRINGVALUE(Com::tJSONFileInfoHeight, ",\"height\":");
 FSTRINGVALUE(Com::tJSONFileInfoLayerHeight, ",\"layerHeight\":");
+FSTRINGVALUE(Com::tJSONFileInfoLayers, ",\"layers\":");
+FSTRINGVALUE(Com::tJSONFileInfoPrintTime, ",\"printTime\":");
 FSTRINGVALUE(Com::tJSONFileInfoFilament, ",\"filament\":[");
 FSTRINGVALUE(Com::tJSONFileInfoGeneratedBy, "],\"generatedBy\":\"");
 FSTRINGVALUE(Com::tJSONFileInfoName, ",\"fileName\":\"");
@@ -1032,6 +1032,13 @@ on this endstop.
 */
 #define DELTA_SEGMENTS_PER_SECOND_PRINT 600 // Move accurate setting for print moves
 #define DELTA_SEGMENTS_PER_SECOND_MOVE 600  // Less accurate setting for other moves
+/** \brief Maximum deviation from the straight path in micrometer for delta printers
+
+With a value > 0 the number of delta segments of a move is computed from the effector deviation caused by moving the
+towers linear inside a segment, so moves near the center get few segments and moves near the edge more. The segments
+per second above stay the upper limit. 0 uses the segments per second.
+*/
+#define DELTA_SEGMENT_TOLERANCE 0
 
 // Delta settings
 #if DRIVE_SYSTEM == DELTA
@@ -1128,6 +1135,14 @@ min is 5 * (200 + (7*10=70) =270) = 1350
  This leaves ~1K free RAM on an Arduino which has only 8k
 Mega. Used only for nonlinear systems like delta or tuga. */
 #define DELTASEGMENTS_PER_PRINTLINE 22
+/** \brief Number of delta segments shared by all lines.
+
+With a value > 0 lines take only the delta segments they need from one common pool instead of reserving
+DELTASEGMENTS_PER_PRINTLINE segments each. Short moves need only a few segments, so the same RAM buffers more lines.
+Long moves fill all segments of their lines, then the pool holds fewer lines than the per line segments, see make
+bench-delta in src/Simulator. Needs 7 bytes per segment and must be at least 2 * DELTASEGMENTS_PER_PRINTLINE.
+0 = segments per line. */
+#define NONLINEAR_SEGMENT_POOL 0
 
 /** After x seconds of inactivity, the stepper motors are disabled.
     Set to 0 to leave them enabled.
@@ -1203,6 +1218,44 @@ own weight, so this is nearly never needed. */
 
 /** Comment this to disable ramp acceleration */
 #define RAMP_ACCELERATION 1
+/** \brief Table based step timing for acceleration and deceleration ramps.
+
+With constant acceleration the squared speed grows linear with the steps done. If enabled, the stepper interrupt only adds
+the acceleration to the squared speed and gets the step interval from a small reciprocal square root table. This replaces
+the speed computation and the division in every ramp step and reduces the worst case interrupt time, so higher step
+rates are possible. Lines with advance or start/end speeds below 64 steps/s use the normal computation.
+*/
+#define STEP_TIMING_TABLE 0
+/** \brief Jerk limited (S-curve) acceleration.
+
+Instead of a constant acceleration the speed follows v0 + dv * (3t^2 - 2t^3) during acceleration and deceleration, so
+the acceleration rises and falls smoothly and the ramps do not excite ringing. The peak acceleration of such a ramp is
+1.5 times its mean, so lines get planned with 2/3 of the configured acceleration and the peak stays within the limit.
+Ramps take 1.5 times longer than with constant acceleration.
+Can be switched at runtime with M537.
+*/
+#define S_CURVE_ACCELERATION 0
+/** \brief Input shaping of the X and Y acceleration ramps.
+
+Each acceleration and deceleration ramp gets convolved with a ZV, ZVD or MZV shaper, so it does not excite the
+resonance of the moving axis. Diagonal moves use both shapers convolved, which takes the sum of both durations.
+Ramps get longer by the shaper duration (ZV 0.5, MZV 0.75, ZVD 1 period), which usually allows a much higher
+acceleration with less ringing. Speed changes at junctions (jerk) are not shaped. Only available on ARM and
+overrides S-curve ramps for moves in X/Y.
+Shaper types: 0 = off, 1 = ZV, 2 = ZVD, 3 = MZV. Frequency in Hz, damping ratio of the resonance 0..0.3.
+Can be changed with M540 and is stored in EEPROM.
+Lines shorter than the shaper duration at full speed can not be shaped. They use
+INPUT_SHAPING_UNSHAPED_ACCELERATION percent of the configured acceleration, so a raised acceleration does not
+excite the resonance on short lines. make bench-shaping in src/Simulator shows the vibration and print time.
+*/
+#define INPUT_SHAPING 0
+#define INPUT_SHAPER_X_TYPE 3
+#define INPUT_SHAPER_X_FREQUENCY 40
+#define INPUT_SHAPER_X_DAMPING 0.1
+#define INPUT_SHAPER_Y_TYPE 3
+#define INPUT_SHAPER_Y_FREQUENCY 40
+#define INPUT_SHAPER_Y_DAMPING 0.1
+#define INPUT_SHAPING_UNSHAPED_ACCELERATION 50
 
 /** If your stepper needs a longer high signal then given, you can add a delay here.
 The delay is realized as a simple loop wasting time, which is not available for other
@@ -1294,6 +1347,15 @@ Overridden if EEPROM activated.
 */
 #define MAX_JERK 20.0
 #define MAX_ZJERK 0.3
+/** \brief Corner speed from junction deviation instead of jerk.
+
+If enabled, the speed at the join of two moves in x/y follows from the angle between them. It is the speed that
+drives a circle touching both moves JUNCTION_DEVIATION_MM from the corner with the acceleration of the moves. Curves
+made of many short lines run as fast as their radius allows, sharp corners slow down more than with MAX_JERK.
+MAX_JERK still sets the start speed, moves without x/y part and the z and extruder limits are unchanged.
+*/
+#define JUNCTION_DEVIATION 0
+#define JUNCTION_DEVIATION_MM 0.02
 
 /** \brief Number of moves we can cache in advance.
 
@@ -1301,6 +1363,25 @@ This number of moves can be cached in advance. If you want to cache more, increa
 many very short moves the cache may go empty. The minimum value is 5.
 */
 #define PRINTLINE_CACHE_SIZE 32
+/** \brief Size the move cache at startup from free RAM.
+
+If enabled, PRINTLINE_CACHE_SIZE is ignored. At startup the move cache gets the largest power of 2 size up to
+PRINTLINE_CACHE_SIZE_MAX (max. 256) that still leaves PRINTLINE_CACHE_RESERVE_RAM bytes of RAM free. Deeper caches help
+with many short segments like curved perimeters. PLANNER_MAX_WINDOW limits how many lines the path planner updates
+for each new line, so the planning time does not grow with the cache size. Only available on ARM boards.
+*/
+#define PRINTLINE_DYNAMIC_CACHE 0
+#define PRINTLINE_CACHE_SIZE_MAX 256
+#define PRINTLINE_CACHE_RESERVE_RAM 16384
+#define PLANNER_MAX_WINDOW 64
+/** \brief Number of parsed commands waiting for execution.
+
+With more then 1 entry the firmware keeps reading and acknowledging commands while the move cache is full, so the
+host can send the next commands while the current one waits. Each entry needs about 100 bytes. AVR boards always use 1.
+A host waiting for each ok gets no faster with more entries, a host streaming with M538 does, see make
+bench-latency in src/Simulator.
+*/
+#define GCODE_BUFFER_SIZE 1
 
 /** \brief Low filled cache size.
 
@@ -1343,6 +1424,15 @@ For more informations, read the wiki.
 Set 1 to allow, 0 disallow a quadratic advance dependency. Linear is the dominant value, so no real need
 to activate the quadratic term. Only adds lots of computations and storage usage. */
 #define ENABLE_QUADRATIC_ADVANCE 0
+/** \brief Execute advance in the stepper interrupt.
+
+Instead of a separate extruder timer the stepper interrupt executes all extruder steps including the advance
+steps, at most one per primary axis step and limited to the maximum extruder feedrate. The advance is linear
+in the speed and smoothed over ADVANCE_SMOOTH_TIME milliseconds, so speed changes do not move the extruder
+back and forth. Only available on ARM, disables the quadratic advance component.
+*/
+#define ADVANCE_IN_STEPPER 0
+#define ADVANCE_SMOOTH_TIME 40
 
 // ##########################################################################################
 // ##                           Communication configuration                                ##
@@ -1392,6 +1482,11 @@ boards you might need to make it inverting.
 the next command. Not receiving it will cause your printer to stop. Sending this string every
 second, if our queue is empty should prevent this. Comment it, if you don't want this feature. */
 #define WAITING_IDENTIFIER "wait"
+/** Size of the output line buffer in bytes. Responses get collected here and are sent with one write per
+connection when a line is complete, instead of one call per character and connection. 0 disables buffering.
+This only helps connections where every write call is a transfer of its own, like the native USB port. The
+time a temperature report or an ok needs in the simulator stays the same, see make bench-output in src/Simulator. */
+#define OUTPUT_BUFFER_SIZE 0
 
 /** \brief Sets time for echo debug
 
@@ -1803,8 +1898,34 @@ Separate commands by \n */
 #define SD_RUN_ON_STOP ""
 /** Disable motors and heaters when print was stopped. */
 #define SD_STOP_HEATER_AND_MOTORS_ON_STOP 1
+/** M34 filename converts an ASCII G-code file into the binary format and stores it as sidecar file with extension .bgc.
+Selecting the ASCII file then prints the sidecar, so no ASCII parsing is needed while printing. The sidecar stores the
+size, first cluster and modification time of the source file and is ignored if the source file was changed. Lines
+with format errors are skipped and reported, a command longer than MAX_CMD_SIZE aborts the compilation. */
+#define SD_BINARY_SIDECAR 0
+/** Read ahead buffer for printing from SD card in bytes. Two buffers of this size get filled with whole blocks while
+the firmware is idle, so reading commands does not wait for the card. Use 512 to read complete card blocks or 0 to read
+byte by byte. Must be a power of 2. DEBUG_SD_READ in Repetier.h reports the read speed after each print. */
+#define SD_READ_BUFFER_SIZE 0
+/** Number of files of a folder the LCD file browser indexes. The index stores where each file starts in the folder,
+so scrolling and selecting a file reads only its own entry instead of all entries before it. Needs 4 byte RAM per file,
+larger folders index only every 2nd, 4th, ... file. 0 disables the index, 1024 is a good value for folders with many
+files. */
+#define SD_DIR_INDEX_SIZE 0
+/** Number of files whose G-code information (M36, selected file) is stored in .fileinfo.bin on the card, so each file
+gets parsed only once. The cache file gets created and the files of a folder listed with M20 S2 get parsed while the
+printer is idle after the listing. Uses 64 byte on the card per file, must be a multiple of 8, e.g. 1024. Only used
+with JSON_OUTPUT, 0 disables the cache. */
+#define SD_INFO_CACHE_SIZE 0
 // If you want support for G2/G3 arc commands set to true, otherwise false.
 #define ARC_SUPPORT 1
+/** Maximum distance in mm between an arc and the chords it gets printed with. Chords get as long as this allows, but
+never shorter than MM_PER_ARC_SEGMENT, so large radii need less lines. 0 uses the fixed chord length. */
+#define ARC_CHORD_TOLERANCE 0.01
+/** Queue G2/G3 arcs as one line and interpolate the circle in the stepper interrupt instead of splitting it into
+chords. Arcs with bed leveling, distortion correction or axis compensation active, or arcs leaving the software
+endstops, still get chords. Only for DRIVE_SYSTEM 0 without backlash compensation, only available on ARM boards. */
+#define ARC_IN_STEPPER 0
 
 /** You can store the current position with M401 and go back to it with M402.
    This works only if feature is set to true. */
@@ -872,6 +872,9 @@ void Extruder::selectExtruderById(uint8_t extruderId) {
     if (fmax < Printer::maxFeedrate[E_AXIS]) {
         Printer::maxFeedrate[E_AXIS] = fmax;
     }
+#if ADVANCE_IN_STEPPER
+    Printer::updateExtruderStepTicks();
+#endif
 #endif // USE_ADVANCE
     Extruder::current->tempControl.updateTempControlVars();
 #if DUAL_X_AXIS
@@ -2226,7 +2229,7 @@ const short temptable_4[NUMTEMPS_4][2] PROGMEM = {
 const short temptable_8[NUMTEMPS_8][2] PROGMEM = {
     { 0, 8000 }, { 69, 2400 }, { 79, 2320 }, { 92, 2240 }, { 107, 2160 }, { 125, 2080 }, { 146, 2000 }, { 172, 1920 }, { 204, 1840 }, { 244, 1760 }, { 291, 1680 }, { 350, 1600 }, { 422, 1520 }, { 511, 1440 }, { 621, 1360 }, { 755, 1280 }, { 918, 1200 }, { 1114, 1120 }, { 1344, 1040 }, { 1608, 960 }, { 1902, 880 }, { 2216, 800 }, { 2539, 720 }, { 2851, 640 }, { 3137, 560 }, { 3385, 480 }, { 3588, 400 }, { 3746, 320 }, { 3863, 240 }, { 3945, 160 }, { 4002, 80 }, { 4038, 0 }, { 4061, -80 }, { 4075, -160 }
 };
-#define NUMTEMPS_9 67 // 100k Honeywell 135-104LAG-J01
+#define NUMTEMPS_9 58 // 100k Honeywell 135-104LAG-J01
 const short temptable_9[NUMTEMPS_9][2] PROGMEM = {
     { 1 * 4, 941 * 8 }, { 19 * 4, 362 * 8 }, { 37 * 4, 299 * 8 }, //top rating 300C
     { 55 * 4, 266 * 8 },
@@ -2418,6 +2421,76 @@ const short* const temptables[16] PROGMEM = { (short int*)&temptable_1[0][0], (s
 const uint8_t temptables_num[16] PROGMEM = { NUMTEMPS_1, NUMTEMPS_2, NUMTEMPS_3, NUMTEMPS_4, NUM_TEMPS_USERTHERMISTOR0, NUM_TEMPS_USERTHERMISTOR1, NUM_TEMPS_USERTHERMISTOR2, NUMTEMPS_8,
                                              NUMTEMPS_9, NUMTEMPS_10, NUMTEMPS_11, NUMTEMPS_12, NUMTEMPS_13, NUMTEMPS_14, NUMTEMPS_15, NUMTEMPS_16 };
 
+/** Returns the conversion table of the sensor type and its number of
+entries. Generic tables are computed at startup and are in RAM. */
+const int16_t* TemperatureController::conversionTable(uint8_t& num, bool& inRam) {
+    uint8_t type = sensorType;
+    inRam = false;
+#if defined(USE_GENERIC_THERMISTORTABLE_1) || defined(USE_GENERIC_THERMISTORTABLE_2) || defined(USE_GENERIC_THERMISTORTABLE_3)
+    if (type >= 97 && type <= 99) {
+        inRam = true;
+        num = GENERIC_THERM_NUM_ENTRIES;
+#ifdef USE_GENERIC_THERMISTORTABLE_1
+        if (type == 97)
+            return (const int16_t*)temptable_generic1;
+#endif
+#ifdef USE_GENERIC_THERMISTORTABLE_2
+        if (type == 98)
+            return (const int16_t*)temptable_generic2;
+#endif
+#ifdef USE_GENERIC_THERMISTORTABLE_3
+        if (type == 99)
+            return (const int16_t*)temptable_generic3;
+#endif
+        num = 0;
+        return NULL;
+    }
+#endif
+    if (type > 49)
+        type -= 46;
+    else
+        type--;
+    num = pgm_read_byte(&temptables_num[type]);
+    return (const int16_t*)pgm_read_word(&temptables[type]);
+}
+
+static inline int16_t readTableWord(const int16_t* table, uint8_t pos, bool inRam) {
+    return inRam ? table[pos] : static_cast<int16_t>(pgm_read_word(&table[pos]));
+}
+
+/** \brief Converts a raw value with the conversion table of the sensor.
+
+Finds the first entry with a larger raw value by binary search, which gives
+the same entry as a walk through the table from the start, and interpolates
+linear between it and its predecessor. Interpolation uses integers with 4
+extra bits, so the result is within 1/128 degree of float interpolation.
+*/
+float TemperatureController::tableTemperature(int16_t raw) {
+    uint8_t num;
+    bool inRam;
+    const int16_t* table = conversionTable(num, inRam);
+    if (num == 0)
+        return 0;
+    uint8_t low = 1, high = num;
+    while (low < high) {
+        uint8_t mid = (low + high) >> 1;
+        if (readTableWord(table, mid << 1, inRam) <= raw)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low >= num) // Overflow: Set to last value in the table
+        return TEMP_INT_TO_FLOAT(readTableWord(table, ((num - 1) << 1) + 1, inRam));
+    int16_t oldraw = readTableWord(table, (low - 1) << 1, inRam);
+    int16_t oldtemp = readTableWord(table, ((low - 1) << 1) + 1, inRam);
+    int16_t newraw = readTableWord(table, low << 1, inRam);
+    int16_t newtemp = readTableWord(table, (low << 1) + 1, inRam);
+    if (newraw == oldraw) // below a table starting with two equal raw values
+        return TEMP_INT_TO_FLOAT(oldtemp);
+    int32_t temp16 = static_cast<int32_t>(oldtemp) * 16 + static_cast<int32_t>(raw - oldraw) * (newtemp - oldtemp) * 16 / (newraw - oldraw);
+    return static_cast<float>(temp16) * (1.0f / (16 << CELSIUS_EXTRA_BITS));
+}
+
 void TemperatureController::updateCurrentTemperature() {
     uint8_t type = sensorType;
     // get raw temperature
@@ -2503,62 +2576,15 @@ void TemperatureController::updateCurrentTemperature() {
     case 12:
     case 14:
     case 15:
-    case 16: {
-        type--;
-        uint8_t num = pgm_read_byte(&temptables_num[type]) << 1;
-        uint8_t i = 2;
-        const int16_t* temptable = (const int16_t*)pgm_read_word(&temptables[type]); //pgm_read_word_near(&temptables[type]);
-        int16_t oldraw = pgm_read_word(&temptable[0]);
-        int16_t oldtemp = pgm_read_word(&temptable[1]);
-        int16_t newraw, newtemp = 0;
-        currentTemperature = (1023 << (2 - ANALOG_REDUCE_BITS)) - currentTemperature;
-        while (i < num) {
-            newraw = pgm_read_word(&temptable[i++]);
-            newtemp = pgm_read_word(&temptable[i++]);
-            if (newraw > currentTemperature) {
-                currentTemperatureC = TEMP_INT_TO_FLOAT(oldtemp + (float)(currentTemperature - oldraw) * (float)(newtemp - oldtemp) / (newraw - oldraw));
-                newtemp = 999;
-                break;
-            }
-            oldtemp = newtemp;
-            oldraw = newraw;
-        }
-        // Overflow: Set to last value in the table
-        if (newtemp != 999) {
-            currentTemperatureC = TEMP_INT_TO_FLOAT(newtemp);
-        }
-    } break;
+    case 16:
+        currentTemperatureC = tableTemperature((1023 << (2 - ANALOG_REDUCE_BITS)) - currentTemperature);
+        break;
     case 13:
     case 50: // User defined PTC thermistor
     case 51:
-    case 52: {
-        if (type > 49)
-            type -= 46;
-        else
-            type--;
-        uint8_t num = pgm_read_byte(&temptables_num[type]) << 1;
-        uint8_t i = 2;
-        const int16_t* temptable = (const int16_t*)pgm_read_word(&temptables[type]); //pgm_read_word_near(&temptables[type]);
-        int16_t oldraw = pgm_read_word(&temptable[0]);
-        int16_t oldtemp = pgm_read_word(&temptable[1]);
-        int16_t newraw, newtemp = 0;
-        while (i < num) {
-            newraw = pgm_read_word(&temptable[i++]);
-            newtemp = pgm_read_word(&temptable[i++]);
-            if (newraw > currentTemperature) {
-                currentTemperatureC = TEMP_INT_TO_FLOAT(oldtemp + (float)(currentTemperature - oldraw) * (float)(newtemp - oldtemp) / (newraw - oldraw));
-                newtemp = 999;
-                break;
-            }
-            oldtemp = newtemp;
-            oldraw = newraw;
-        }
-        // Overflow: Set to last value in the table
-        if (newtemp != 999) {
-            currentTemperatureC = TEMP_INT_TO_FLOAT(newtemp);
-        }
+    case 52:
+        currentTemperatureC = tableTemperature(currentTemperature);
         break;
-    }
     case 60: // AD8495 (Delivers 5mV/degC vs the AD595's 10mV)
 #if CPU_ARCH == ARCH_AVR
         currentTemperatureC = ((float)currentTemperature * 1000.0f / (1024 << (2 - ANALOG_REDUCE_BITS)));
@@ -2610,42 +2636,9 @@ void TemperatureController::updateCurrentTemperature() {
 #if defined(USE_GENERIC_THERMISTORTABLE_1) || defined(USE_GENERIC_THERMISTORTABLE_2) || defined(USE_GENERIC_THERMISTORTABLE_3)
     case 97:
     case 98:
-    case 99: {
-        uint8_t i = 2;
-        const short* temptable;
-#ifdef USE_GENERIC_THERMISTORTABLE_1
-        if (type == 97)
-            temptable = (const short*)temptable_generic1;
-#endif
-#ifdef USE_GENERIC_THERMISTORTABLE_2
-        if (type == 98)
-            temptable = (const short*)temptable_generic2;
-#endif
-#ifdef USE_GENERIC_THERMISTORTABLE_3
-        if (type == 99)
-            temptable = (const short*)temptable_generic3;
-#endif
-        short oldraw = temptable[0];
-        short oldtemp = temptable[1];
-        short newraw, newtemp;
-        currentTemperature = (1023 << (2 - ANALOG_REDUCE_BITS)) - currentTemperature;
-        while (i < GENERIC_THERM_NUM_ENTRIES * 2) {
-            newraw = temptable[i++];
-            newtemp = temptable[i++];
-            if (newraw > currentTemperature) {
-                currentTemperatureC = TEMP_INT_TO_FLOAT(oldtemp + (float)(currentTemperature - oldraw) * (float)(newtemp - oldtemp) / (newraw - oldraw));
-                newtemp = 999;
-                break;
-            }
-            oldtemp = newtemp;
-            oldraw = newraw;
-        }
-        // Overflow: Set to last value in the table
-        if (newtemp != 999) {
-            currentTemperatureC = TEMP_INT_TO_FLOAT(newtemp);
-        }
+    case 99:
+        currentTemperatureC = tableTemperature((1023 << (2 - ANALOG_REDUCE_BITS)) - currentTemperature);
         break;
-    }
 #endif
     }
 #if ENABLED(TEMP_GAIN)
@@ -72,8 +72,13 @@ void HAL::setupTimer() {
 
     // set 3 bits for interrupt group priority, 1 bits for sub-priority
     // NVIC_SetPriorityGrouping(4);
+#ifdef DEBUG_ISR_PROFILE
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // cycle counter for ISR profiling
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
-#if USE_ADVANCE
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
     // Timer for extruder control
     pmc_enable_periph_clk(EXTRUDER_TIMER_IRQ); // enable power to timer
     // NVIC_SetPriority((IRQn_Type)EXTRUDER_TIMER_IRQ, NVIC_EncodePriority(4, 4,
@@ -606,6 +611,7 @@ void HAL::importEEPROM() {
         Com::printFLN("EEPROM read from sd card.");
     }
     EEPROM::readDataFromEEPROM(true);
+    Extruder::selectExtruderById(Extruder::current->id);
 }
 
 #endif
@@ -1184,12 +1190,19 @@ TcChannel* stepperChannel = (TIMER1_TIMER->TC_CHANNEL + TIMER1_TIMER_CHANNEL);
 /** \brief Timer interrupt routine to drive the stepper motors.
  */
 void TIMER1_COMPA_VECTOR() {
+#ifdef DEBUG_ISR_PROFILE
+    uint32_t profileStart = HAL::cycleCounter();
+    IsrProfile::branch = ISR_BRANCH_IDLE;
+#endif
     // apparently have to read status register
     stepperChannel->TC_SR;
     stepperChannel->TC_RC = 1000000;
     uint32_t delay;
     if (PrintLine::hasLines()) {
         delay = PrintLine::bresenhamStep();
+#ifdef DEBUG_STEP_TIMELINE
+        StepTimeline::advance(delay);
+#endif
     }
 #if FEATURE_BABYSTEPPING
     else if (Printer::zBabystepsMissing != 0) {
@@ -1198,6 +1211,7 @@ void TIMER1_COMPA_VECTOR() {
     }
 #endif
     else {
+        delay = 10000;
         if (waitRelax == 0) {
 #if USE_ADVANCE
             if (Printer::advanceStepsSet) {
@@ -1207,6 +1221,16 @@ void TIMER1_COMPA_VECTOR() {
 #endif
                 Printer::advanceStepsSet = 0;
             }
+#if ADVANCE_IN_STEPPER
+            Printer::advanceSmoothed = 0;
+            if (Printer::extruderStepsNeeded && Printer::isAdvanceActivated()) { // no extruder timer, so finish them here
+                Printer::extruderStepBudget = Printer::extruderStepTicks;
+                PrintLine::advanceExtruderStep();
+                Printer::insertStepperHighDelay();
+                Extruder::unstep();
+                delay = Printer::extruderStepTicks;
+            }
+#endif
             if ((!Printer::extruderStepsNeeded) && (DISABLE_E))
                 Extruder::disableCurrentExtruderMotor();
 #else
@@ -1215,8 +1239,6 @@ void TIMER1_COMPA_VECTOR() {
 #endif
         } else
             waitRelax--;
-
-        delay = 10000;
     }
     // convert old AVR timer delay value for SAM timers
     uint32_t timer_count = (delay * TIMER1_PRESCALE);
@@ -1231,6 +1253,9 @@ void TIMER1_COMPA_VECTOR() {
     } else {
         stepperChannel->TC_RC = timer_count;
     }
+#ifdef DEBUG_ISR_PROFILE
+    IsrProfile::stepper[IsrProfile::branch].add(HAL::cyclesSince(profileStart));
+#endif
 }
 
 #if !defined(HEATER_PWM_SPEED)
@@ -1300,6 +1325,9 @@ This timer is called 3906 times per second. It is used to update
 pwm values for heater and some other frequent jobs.
 */
 void PWM_TIMER_VECTOR() {
+#ifdef DEBUG_ISR_PROFILE
+    uint32_t profileStart = HAL::cycleCounter();
+#endif
     // InterruptProtectedBlock noInt;
     // apparently have to read status register
     TC_GetStatus(PWM_TIMER, PWM_TIMER_CHANNEL);
@@ -1667,6 +1695,9 @@ void PWM_TIMER_VECTOR() {
         HAL::wdPinged = false;
     }
 #endif
+#ifdef DEBUG_ISR_PROFILE
+    IsrProfile::pwm.add(HAL::cyclesSince(profileStart));
+#endif
 }
 
 /** \brief Timer routine for extruder stepper.
@@ -1678,7 +1709,7 @@ interrupt, one step is executed. This will keep the extruder
 moving, until the total wanted movement is achieved. This will
 be done with the maximum allowable speed for the extruder.
 */
-#if USE_ADVANCE
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
 TcChannel* extruderChannel = (EXTRUDER_TIMER->TC_CHANNEL + EXTRUDER_TIMER_CHANNEL);
 #define SLOW_EXTRUDER_TICKS \
     (F_CPU_TRUE / 32 / 1000) // 250us on direction change
@@ -1700,9 +1731,14 @@ void EXTRUDER_TIMER_VECTOR() {
     if (!Printer::isAdvanceActivated()) {
         return; // currently no need
     }
+#ifdef DEBUG_STEP_TIMELINE
+    if (StepTimeline::recording)
+        StepTimeline::extruderInterrupts++;
+#endif
     if (Printer::extruderStepsNeeded > 0 && extruderLastDirection != 1) {
         if (Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS) {
             Extruder::setDirection(true);
+            STEP_TIMELINE_REVERSAL
             extruderLastDirection = 1;
             // extruderChannel->TC_RC = SLOW_EXTRUDER_TICKS;
             extruderChannel->TC_RC = Printer::maxExtruderSpeed;
@@ -1712,6 +1748,7 @@ void EXTRUDER_TIMER_VECTOR() {
     } else if (Printer::extruderStepsNeeded < 0 && extruderLastDirection != -1) {
         if (-Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS) {
             Extruder::setDirection(false);
+            STEP_TIMELINE_REVERSAL
             extruderLastDirection = -1;
             // extruderChannel->TC_RC = SLOW_EXTRUDER_TICKS;
             extruderChannel->TC_RC = Printer::maxExtruderSpeed;
@@ -1726,6 +1763,8 @@ void EXTRUDER_TIMER_VECTOR() {
         Extruder::unstep();
     }
 }
+#elif ADVANCE_IN_STEPPER
+void HAL::resetExtruderDirection() { Printer::extruderDirection = 0; }
 #endif
 
 // IRQ handler for tone generator
@@ -77,9 +77,9 @@ typedef char prog_char;
 #undef PSTR
 #define PSTR(s) s
 #undef pgm_read_byte_near
-#define pgm_read_byte_near(x) (*(int8_t*)x)
+#define pgm_read_byte_near(x) (*(int8_t*)(x))
 #undef pgm_read_byte
-#define pgm_read_byte(x) (*(int8_t*)x)
+#define pgm_read_byte(x) (*(int8_t*)(x))
 #undef pgm_read_float
 #define pgm_read_float(addr) (*(const float*)(addr))
 #undef pgm_read_word
@@ -667,6 +667,12 @@ public:
         //__disable_irq();
     }
     static inline unsigned long timeInMilliseconds() { return millis(); }
+    static inline unsigned long timeInMicroseconds() { return micros(); }
+#ifdef DEBUG_ISR_PROFILE
+    /** CPU cycles counted by the DWT unit, enabled in setupTimer. */
+    static inline uint32_t cycleCounter() { return DWT->CYCCNT; }
+    static inline uint32_t cyclesSince(uint32_t start) { return DWT->CYCCNT - start; }
+#endif
     static inline char readFlashByte(PGM_P ptr) { return pgm_read_byte(ptr); }
     static inline int16_t readFlashWord(const uint16_t* ptr) { return pgm_read_word(ptr); }
 
@@ -116,6 +116,8 @@ intensity 0-255 if driver supports this (default ignores it)
 - M29  - Stop SD write
 - M30 <filename> - Delete file on sd card
 - M32 <dirname> create subdirectory
+- M34 <filename> - Compile file into binary sidecar file used by M23. Requires
+SD_BINARY_SIDECAR.
 - M42 P<pin number> S<value 0..255> - Change output of pin P to S. Does not work
 on most important pins.
 - M80  - Turn on power supply
@@ -231,6 +233,28 @@ EEPROM!
 - M531 filename - Define filename being printed
 - M532 X<percent> L<curLayer> - update current print state progress (X=0..100)
 and layer L
+- M536 S<1/0> P1 - Start (S1) or stop (S0) step timeline recording. P1 sends
+recorded entries as TL:time,steps,dir,loops,phase. Without parameter it reports
+planner and stepper statistics. Requires DEBUG_STEP_TIMELINE.
+- M537 S<1/0> - Use S-curve (S1) or trapezoidal (S0) acceleration ramps.
+Requires S_CURVE_ACCELERATION.
+- M538 S<1/0> - Enable (S1) or disable (S0) streaming acknowledge for the
+connection sending it. Each ok, also after skip and resend, then reports how
+many moves like the last one fit into the move cache (P) and how many commands
+fit into command and receive buffer (B), e.g. "ok 123 P14 B7", so hosts can
+keep B lines in flight. Advertised as Cap:STREAMING_OK. The counts only come
+after M538 S1 and P is no count of free planner blocks, so this is not the
+ADVANCED_OK format of other firmwares. Resends work as before.
+- M540 P<0=X,1=Y> S<type> F<frequency> D<damping> - Set input shaper of X or Y.
+Types 0 = off, 1 = ZV, 2 = ZVD, 3 = MZV, frequency in Hz, damping ratio 0..0.3.
+Without parameter it reports both shapers. Store with M500. Requires
+INPUT_SHAPING.
+- M541 S0 - Without parameter report CPU cycles of stepper and PWM interrupt
+calls (min/avg/max and histogram "start=count") per stepper branch. S0 resets
+the statistics. Requires DEBUG_ISR_PROFILE.
+- M542 S1 - Report EEPROM burns per 256 byte block since start, writes saved
+by the RAM cache and bytes still waiting for their burn. S1 burns pending bytes
+first. AVR only, requires EEPROM_RAM_CACHE.
 - M600 Change filament
 - M601 S<1/0> B<1/0> P<1/0> - Pause extruders. B1 also pauses heated bed. Paused
 extrudes disable heaters and motor. Continue (S0) reheats extruder to old temp.
@@ -35,6 +35,9 @@ SDCard::SDCard() {
     sdmode = 0;
     sdactive = false;
     savetosd = false;
+#if SD_DIR_INDEX_SIZE > 0
+    folderChanges = 0;
+#endif
     Printer::setAutomount(false);
 }
 
@@ -126,6 +129,7 @@ void SDCard::initsd() {
 
 void SDCard::mount() {
     sdmode = 0;
+    folderChanged(); // Maybe a different card
     initsd();
 }
 
@@ -136,6 +140,11 @@ void SDCard::unmount() {
     Printer::setAutomount(false);
     Printer::setMenuMode(
         MENU_MODE_SD_MOUNTED + MENU_MODE_PAUSED + MENU_MODE_SD_PRINTING, false);
+#if SD_INFO_CACHE_SIZE
+    infoCacheFile.close();
+    infoScanFile.close();
+    infoScanDir.close();
+#endif
 #if UI_DISPLAY_TYPE != NO_DISPLAY && SDSUPPORT
     uid.cwd[0] = '/';
     uid.cwd[1] = 0;
@@ -414,6 +423,159 @@ void SDCard::writeCommand(GCode* code) {
     }
 }
 
+#if SD_BINARY_SIDECAR
+/** Creates the sidecar name by replacing the extension with .bgc. Returns
+false if filename is already a sidecar. */
+bool SDCard::binaryFilename(const char* filename, char* buffer) {
+    strncpy(buffer, filename, MAX_CMD_SIZE);
+    buffer[MAX_CMD_SIZE] = 0;
+    char* ext = strrchr(buffer, '.');
+    if (ext == NULL || strchr(ext, '/') != NULL)
+        ext = buffer + strlen(buffer);
+    else if (strcasecmp(ext, ".bgc") == 0)
+        return false;
+    strcpy(ext, ".bgc");
+    return true;
+}
+
+/** Sidecar header for source: magic, size, first cluster and modification
+time of the source, like the key of the file info cache. */
+static void binaryHeader(SdFile& source, uint32_t* header) {
+    dir_t dir;
+    header[0] = SD_BINARY_MAGIC;
+    header[1] = source.fileSize();
+    header[2] = source.firstCluster();
+    header[3] = source.dirEntry(&dir) ? (static_cast<uint32_t>(dir.lastWriteDate) << 16) | dir.lastWriteTime : 0;
+}
+
+/** Replaces the selected ASCII file with its sidecar if it exists and was
+compiled from this file in its current version. */
+bool SDCard::selectBinary(const char* filename) {
+    char name[MAX_CMD_SIZE + 5];
+    if (!binaryFilename(filename, name))
+        return false;
+    uint32_t expected[SD_BINARY_HEADER_SIZE / 4];
+    binaryHeader(file, expected);
+    file.close();
+    if (file.open(fat.vwd(), name, O_READ)) {
+        uint32_t header[SD_BINARY_HEADER_SIZE / 4];
+        if (file.read(header, SD_BINARY_HEADER_SIZE) == SD_BINARY_HEADER_SIZE && memcmp(header, expected, SD_BINARY_HEADER_SIZE) == 0) {
+            sdpos = SD_BINARY_HEADER_SIZE;
+            filesize = file.fileSize();
+            return true;
+        }
+        file.close();
+    }
+    file.open(fat.vwd(), filename, O_READ);
+    return false;
+}
+
+void SDCard::removeBinary(const char* filename) {
+    char name[MAX_CMD_SIZE + 5];
+    if (binaryFilename(filename, name) && fat.remove(name))
+        folderChanged();
+}
+
+/** Parses the ASCII file filename and writes all commands in binary format
+into the sidecar file. Comments are dropped and lines with format errors are
+skipped like when printing the ASCII file, skipped lines get reported. A
+command longer than MAX_CMD_SIZE would change its meaning, so it aborts the
+compilation. */
+bool SDCard::compileBinary(const char* filename) {
+    char name[MAX_CMD_SIZE + 5];
+    if (!sdactive || sdmode || savetosd || !binaryFilename(filename, name))
+        return false;
+    SdFile source;
+    if (!source.open(fat.vwd(), filename, O_READ)) {
+        Com::printFLN(Com::tFileOpenFailed);
+        return false;
+    }
+    file.close();
+    if (!file.open(fat.vwd(), name, O_CREAT | O_WRITE | O_TRUNC)) {
+        source.close();
+        Com::printFLN(Com::tOpenFailedFile, name);
+        return false;
+    }
+    folderChanged();
+    Com::printFLN(Com::tWritingToFile, name);
+    uint32_t header[SD_BINARY_HEADER_SIZE / 4];
+    binaryHeader(source, header);
+    file.write(header, SD_BINARY_HEADER_SIZE);
+    GCode code;
+    char line[MAX_CMD_SIZE];
+    uint8_t pos = 0;
+    bool tooLong = false;
+    bool comment = false;
+    uint32_t lineNumber = 0;
+    uint32_t commands = 0;
+    uint32_t skipped = 0;
+    uint32_t parseMicros = 0;
+    // Whole blocks are read past the volume cache, so the cache keeps the
+    // block of the sidecar instead of switching files for every byte.
+    uint8_t block[512];
+    int blockLength = 0;
+    int blockPos = 0;
+    int c;
+    do {
+        if (blockPos == blockLength) {
+            blockLength = source.read(block, sizeof(block));
+            blockPos = 0;
+        }
+        c = blockPos < blockLength ? block[blockPos++] : -1;
+        if (c == -1 || c == '\n' || c == '\r') {
+            if (c == '\n')
+                lineNumber++;
+            comment = false;
+            if (pos == 0)
+                continue;
+            if (tooLong)
+                break;
+            line[pos] = 0;
+            pos = 0;
+            uint32_t start = HAL::timeInMicroseconds();
+            bool ok = code.parseAscii(line, false) && !code.hasFormatError();
+            parseMicros += HAL::timeInMicroseconds() - start;
+            if (!ok) {
+                skipped++;
+                Com::printWarningF(PSTR("Skipped line "));
+                Com::printNumber(lineNumber + (c != '\n'));
+                Com::printFLN(PSTR(": "), line);
+            } else if (code.params != 0 || code.params2 != 0) { // not only a comment
+                writeCommand(&code);
+                commands++;
+                if ((commands & 255) == 0)
+                    Commands::checkForPeriodicalActions(false);
+            }
+        } else if (comment || c == ';')
+            comment = true; // dropped while reading like for ASCII prints
+        else if (pos < MAX_CMD_SIZE - 1)
+            line[pos++] = c;
+        else
+            tooLong = true;
+    } while (c != -1 && !file.getWriteError());
+    bool ok = !file.getWriteError() && !tooLong;
+    file.close();
+    source.close();
+    if (!ok) {
+        fat.remove(name);
+        if (tooLong) {
+            Com::printErrorF(PSTR("Line longer than MAX_CMD_SIZE, compile aborted at line "));
+            Com::printNumber(lineNumber + (c != '\n'));
+            Com::println();
+        } else
+            Com::printFLN(Com::tErrorWritingToFile);
+        return false;
+    }
+    Com::printF(PSTR("Compiled commands:"), (int32_t)commands);
+    Com::printF(PSTR(" skipped lines:"), (int32_t)skipped);
+    if (commands)
+        Com::printF(PSTR(" ASCII parse us/command:"), static_cast<float>(parseMicros) / static_cast<float>(commands), 1);
+    Com::println();
+    Com::printFLN(Com::tDoneSavingFile);
+    return true;
+}
+#endif
+
 char* SDCard::createFilename(char* buffer, const dir_t& p) {
     char *pos = buffer, *src = (char*)p.name;
     for (uint8_t i = 0; i < 11; i++, src++) {
@@ -480,6 +642,12 @@ void SDCard::lsJSON(const char* filename) {
     Com::printF(Com::tJSONFiles);
     dir.lsJSON();
     Com::printFLN(Com::tJSONArrayEnd);
+#if SD_INFO_CACHE_SIZE
+    // Host will most likely ask for the info of these files next
+    infoScanFile.close();
+    infoScanDir = dir;
+    infoScanDir.rewind();
+#endif
 }
 
 void SDCard::printEscapeChars(const char* s) {
@@ -514,7 +682,7 @@ void SDCard::JSONFileInfo(const char* filename) {
             return;
         }
         info = &tmpInfo;
-        info->init(targetFile);
+        loadFileInfo(targetFile, *info);
     }
     if (!targetFile.isOpen()) {
         Com::printF(Com::tJSONErrorStart);
@@ -531,6 +699,8 @@ void SDCard::JSONFileInfo(const char* filename) {
     Com::print(info->objectHeight);
     Com::printF(Com::tJSONFileInfoLayerHeight);
     Com::print(info->layerHeight);
+    Com::printF(Com::tJSONFileInfoLayers, (int32_t)info->layerCount);
+    Com::printF(Com::tJSONFileInfoPrintTime, (int32_t)info->printTime);
     Com::printF(Com::tJSONFileInfoFilament);
     Com::print(info->filamentNeeded);
     Com::printF(Com::tJSONFileInfoGeneratedBy);
@@ -545,6 +715,142 @@ void SDCard::JSONFileInfo(const char* filename) {
     Com::println();
 };
 
+/** Fills info for file from the cache or by parsing the file. */
+void SDCard::loadFileInfo(SdFile& file, GCodeFileInfo& info) {
+#if SD_INFO_CACHE_SIZE
+    if (readInfoCache(file, info))
+        return;
+    info.init(file);
+    writeInfoCache(file, info);
+#else
+    info.init(file);
+#endif
+}
+
+#if SD_INFO_CACHE_SIZE
+/** Opens .fileinfo.bin, the dot hides it from M20 and the LCD file browser.
+With extend a missing or incomplete cache file gets one more block of empty
+entries, so it gets created in short idle steps. Returns true once the file
+is complete. */
+bool SDCard::openInfoCache(bool extend) {
+    const uint32_t cacheSize = SD_INFO_CACHE_SIZE * sizeof(GCodeFileInfoCacheEntry);
+    GCodeFileInfoCacheEntry entries[8];
+    if (!infoCacheFile.isOpen()) {
+        SdBaseFile root;
+        if (!root.openRoot(fat.vol()) || !infoCacheFile.open(&root, ".fileinfo.bin", extend ? O_RDWR | O_CREAT : O_RDWR))
+            return false;
+        uint32_t size = infoCacheFile.fileSize();
+        if (size == 0)
+            folderChanged(); // Created
+        else if (size > cacheSize || size % sizeof(entries) != 0) // Size changed, start with empty entries
+            infoCacheFile.truncate(0);
+    }
+    uint32_t size = infoCacheFile.fileSize();
+    if (size == cacheSize)
+        return true;
+    if (!extend || !infoCacheFile.seekSet(size))
+        return false;
+    memset(entries, 0, sizeof(entries));
+    HAL::pingWatchdog();
+    if (infoCacheFile.write(entries, sizeof(entries)) != sizeof(entries)) {
+        infoCacheFile.close();
+        return false;
+    }
+    infoCacheFile.sync();
+    return size + sizeof(entries) == cacheSize;
+}
+
+/** Key of file for the cache. Returns the position of its 8 entry block. */
+static uint32_t infoCacheKey(SdFile& file, GCodeFileInfoCacheEntry& key) {
+    dir_t dir;
+    key.cluster = file.firstCluster();
+    key.fileSize = file.fileSize();
+    key.modified = file.dirEntry(&dir) ? (static_cast<uint32_t>(dir.lastWriteDate) << 16) | dir.lastWriteTime : 0;
+    uint32_t hash = key.cluster * 2654435761UL + key.fileSize + key.modified;
+    return ((hash >> 8) % (SD_INFO_CACHE_SIZE / 8)) * 8 * sizeof(GCodeFileInfoCacheEntry);
+}
+
+bool SDCard::readInfoCache(SdFile& file, GCodeFileInfo& info) {
+    GCodeFileInfoCacheEntry key, entry;
+    if (!file.firstCluster() || !openInfoCache())
+        return false;
+    if (!infoCacheFile.seekSet(infoCacheKey(file, key)))
+        return false;
+    for (uint8_t i = 0; i < 8; i++) {
+        if (infoCacheFile.read(&entry, sizeof(entry)) != sizeof(entry))
+            return false;
+        if (entry.version == SD_INFO_CACHE_VERSION && entry.cluster == key.cluster && entry.fileSize == key.fileSize && entry.modified == key.modified) {
+            info.fileSize = entry.fileSize;
+            info.objectHeight = entry.objectHeight;
+            info.layerHeight = entry.layerHeight;
+            info.filamentNeeded = entry.filamentNeeded;
+            info.printTime = entry.printTime;
+            info.layerCount = entry.layerCount;
+            memcpy(info.generatedBy, entry.generatedBy, GENBY_SIZE);
+            return true;
+        }
+    }
+    return false;
+}
+
+void SDCard::writeInfoCache(SdFile& file, GCodeFileInfo& info) {
+    GCodeFileInfoCacheEntry entry;
+    if (!file.firstCluster() || !openInfoCache())
+        return;
+    uint32_t pos = infoCacheKey(file, entry);
+    // Use first unused entry of the block, if all are used replace one at random
+    uint8_t slot = (entry.cluster ^ entry.modified) & 7;
+    uint16_t version;
+    for (uint8_t i = 0; i < 8; i++) {
+        if (!infoCacheFile.seekSet(pos + i * sizeof(entry) + offsetof(GCodeFileInfoCacheEntry, version)) || infoCacheFile.read(&version, sizeof(version)) != sizeof(version))
+            break;
+        if (version != SD_INFO_CACHE_VERSION) {
+            slot = i;
+            break;
+        }
+    }
+    entry.version = SD_INFO_CACHE_VERSION;
+    entry.layerCount = info.layerCount;
+    entry.printTime = info.printTime;
+    entry.objectHeight = info.objectHeight;
+    entry.layerHeight = info.layerHeight;
+    entry.filamentNeeded = info.filamentNeeded;
+    memcpy(entry.generatedBy, info.generatedBy, GENBY_SIZE);
+    memset(entry.reserved, 0, sizeof(entry.reserved));
+    if (infoCacheFile.seekSet(pos + slot * sizeof(entry)))
+        infoCacheFile.write(&entry, sizeof(entry));
+    infoCacheFile.sync();
+}
+
+/** Caches the files of the last folder listed with M20 S2. Called while idle,
+each call creates one block of the cache file, looks up one file or parses a
+few KB of the current file, so it returns within a few ms. Until the cache
+file is complete M36 and selecting a file parse the file like without cache. */
+void SDCard::updateInfoCache() {
+    if (!infoScanDir.isOpen())
+        return;
+    if (!sdactive || sdmode || savetosd || PrintLine::hasLines())
+        return;
+    if (!openInfoCache(true))
+        return;
+    if (infoScanFile.isOpen()) {
+        if (infoScanInfo.parse(infoScanFile, 4)) {
+            writeInfoCache(infoScanFile, infoScanInfo);
+            infoScanFile.close();
+        }
+        return;
+    }
+    if (!infoScanFile.openNext(&infoScanDir, O_READ)) {
+        infoScanDir.close();
+        return;
+    }
+    if (infoScanFile.isFile() && !readInfoCache(infoScanFile, infoScanInfo))
+        infoScanInfo.startParse(infoScanFile); // Parsed in the next calls
+    else
+        infoScanFile.close();
+}
+#endif
+
 #endif
 
 bool SDCard::selectFile(const char* filename, bool silent) {
@@ -566,13 +872,23 @@ bool SDCard::selectFile(const char* filename, bool silent) {
 
         if (!silent) {
             Com::printF(Com::tFileOpened, oldP);
-            Com::printFLN(Com::tSpaceSizeColon, file.fileSize());
+            Com::printFLN(Com::tSpaceSizeColon, (uint32_t)file.fileSize());
         }
 #if JSON_OUTPUT
-        fileInfo.init(file);
+        loadFileInfo(file, fileInfo);
 #endif
         sdpos = 0;
         filesize = file.fileSize();
+#if SD_BINARY_SIDECAR
+        if (selectBinary(filename) && !silent)
+            Com::printFLN(PSTR("Using binary file"));
+#endif
+#if SD_READ_BUFFER_SIZE
+        sdSource.resetBuffer();
+#ifdef DEBUG_SD_READ
+        sdSource.resetStatistics();
+#endif
+#endif
         Com::printFLN(Com::tFileSelected);
         return true;
     } else {
@@ -598,9 +914,13 @@ void SDCard::startWrite(char* filename) {
     file.close();
     sdmode = 0;
     fat.chdir();
+#if SD_BINARY_SIDECAR
+    removeBinary(filename);
+#endif
     if (!file.open(filename, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
         Com::printFLN(Com::tOpenFailedFile, filename);
     } else {
+        folderChanged();
         UI_STATUS_F(Com::translatedF(UI_TEXT_UPLOADING_ID));
         savetosd = true;
         Com::printFLN(Com::tWritingToFile, filename);
@@ -623,11 +943,16 @@ void SDCard::deleteFile(char* filename) {
     sdmode = 0;
     file.close();
     if (fat.remove(filename)) {
+        folderChanged();
+#if SD_BINARY_SIDECAR
+        removeBinary(filename);
+#endif
         Com::printFLN(Com::tFileDeleted);
     } else {
-        if (fat.rmdir(filename))
+        if (fat.rmdir(filename)) {
+            folderChanged();
             Com::printFLN(Com::tFileDeleted);
-        else
+        } else
             Com::printFLN(Com::tDeletionFailed);
     }
 }
@@ -638,6 +963,7 @@ void SDCard::makeDirectory(char* filename) {
     sdmode = 0;
     file.close();
     if (fat.mkdir(filename)) {
+        folderChanged();
         Com::printFLN(Com::tDirectoryCreated);
     } else {
         Com::printFLN(Com::tCreationFailed);
@@ -670,60 +996,76 @@ void SDCard::writeToFile() {
 // Copy date: 15 Nov 2015                                          //
 // --------------------------------------------------------------- //
 
-void GCodeFileInfo::init(SdFile& file) {
-    this->fileSize = file.fileSize();
-    this->filamentNeeded = 0.0;
-    this->objectHeight = 0.0;
-    this->layerHeight = 0.0;
-    if (!file.isOpen())
-        return;
-    bool genByFound = false, layerHeightFound = false, filamentNeedFound = false;
 #if CPU_ARCH == ARCH_AVR
 #define GCI_BUF_SIZE 120
 #else
 #define GCI_BUF_SIZE 1024
 #endif
-    // READ 4KB FROM THE BEGINNING
-    char buf[GCI_BUF_SIZE];
-    for (int i = 0; i < 4096; i += GCI_BUF_SIZE - 50) {
-        if (!file.seekSet(i))
-            break;
-        file.read(buf, GCI_BUF_SIZE);
-        if (!genByFound && findGeneratedBy(buf, this->generatedBy))
-            genByFound = true;
-        if (!layerHeightFound && findLayerHeight(buf, this->layerHeight))
-            layerHeightFound = true;
-        if (!filamentNeedFound && findFilamentNeed(buf, this->filamentNeeded))
-            filamentNeedFound = true;
-        if (genByFound && layerHeightFound && filamentNeedFound)
-            goto get_objectHeight;
-    }
-
-    // READ 4KB FROM END
-    for (int i = 0; i < 4096; i += GCI_BUF_SIZE - 50) {
-        if (!file.seekEnd(-4096 + i))
-            break;
-        file.read(buf, GCI_BUF_SIZE);
-        if (!genByFound && findGeneratedBy(buf, this->generatedBy))
-            genByFound = true;
-        if (!layerHeightFound && findLayerHeight(buf, this->layerHeight))
-            layerHeightFound = true;
-        if (!filamentNeedFound && findFilamentNeed(buf, this->filamentNeeded))
-            filamentNeedFound = true;
-        if (genByFound && layerHeightFound && filamentNeedFound)
-            goto get_objectHeight;
-    }
-
-get_objectHeight:
-    // MOVE FROM END UP IN 1KB BLOCKS UP TO 30KB
-    for (int i = GCI_BUF_SIZE; i < 30000; i += GCI_BUF_SIZE - 50) {
-        if (!file.seekEnd(-i))
-            break;
-        file.read(buf, GCI_BUF_SIZE);
-        if (findTotalHeight(buf, this->objectHeight))
-            break;
+
+void GCodeFileInfo::init(SdFile& file) {
+    startParse(file);
+    parse(file, 0xffff);
+}
+
+/** Resets all fields, parse then reads the information from file. */
+void GCodeFileInfo::startParse(SdFile& file) {
+    this->fileSize = file.fileSize();
+    this->filamentNeeded = 0.0;
+    this->objectHeight = 0.0;
+    this->layerHeight = 0.0;
+    this->printTime = 0;
+    this->layerCount = 0;
+    this->generatedBy[0] = 0;
+    parsePhase = file.isOpen() ? 0 : 3;
+    parseFound = 0;
+    parseOffset = 0;
+}
+
+/** Parses at most chunks buffers of file, continuing where the last call
+stopped. Reads 4KB from the beginning and 4KB from the end, then up to 30KB
+from the end for the object height. Returns true when done. */
+bool GCodeFileInfo::parse(SdFile& file, uint16_t chunks) {
+    char buf[GCI_BUF_SIZE + 1];
+    while (parsePhase < 3 && chunks-- > 0) {
+        bool seeked;
+        if (parsePhase == 0)
+            seeked = parseOffset < 4096 && file.seekSet(parseOffset);
+        else if (parsePhase == 1)
+            seeked = parseOffset < 4096 && file.seekEnd(-4096 + parseOffset);
+        else
+            seeked = parseOffset < 30000 - GCI_BUF_SIZE && file.seekEnd(-static_cast<int32_t>(GCI_BUF_SIZE + parseOffset));
+        if (!seeked) { // Continue with next phase
+            parsePhase++;
+            parseOffset = 0;
+            continue;
+        }
+        int16_t n = file.read(buf, GCI_BUF_SIZE);
+        buf[n > 0 ? n : 0] = 0; // The find functions search up to the terminator
+        parseOffset += GCI_BUF_SIZE - 50;
+        if (parsePhase == 2) {
+            if (findTotalHeight(buf, this->objectHeight))
+                parsePhase = 3;
+            continue;
+        }
+        if (!(parseFound & 1) && findGeneratedBy(buf, this->generatedBy))
+            parseFound |= 1;
+        if (!(parseFound & 2) && findLayerHeight(buf, this->layerHeight))
+            parseFound |= 2;
+        if (!(parseFound & 4) && findFilamentNeed(buf, this->filamentNeeded))
+            parseFound |= 4;
+        if (!this->layerCount)
+            findLayerCount(buf, this->layerCount);
+        if (!this->printTime)
+            findPrintTime(buf, this->printTime);
+        if (parseFound == 7) { // Skip to object height
+            parsePhase = 2;
+            parseOffset = 0;
+        }
     }
+    if (parsePhase < 3)
+        return false;
     file.seekSet(0);
+    return true;
 }
 
 bool GCodeFileInfo::findGeneratedBy(char* buf, char* genBy) {
@@ -811,6 +1153,86 @@ bool GCodeFileInfo::findFilamentNeed(char* buf, float& filament) {
     return false;
 }
 
+bool GCodeFileInfo::findLayerCount(char* buf, uint16_t& layers) {
+    // CURA
+    const char* layerCountCura = PSTR(";LAYER_COUNT:");
+    char* pos = strstr_P(buf, layerCountCura);
+    if (pos) {
+        layers = strtol(pos + strlen_P(layerCountCura), NULL, 10);
+        return true;
+    }
+
+    // PRUSASLICER
+    const char* layerCountPrusa = PSTR("; total layers count = ");
+    pos = strstr_P(buf, layerCountPrusa);
+    if (pos) {
+        layers = strtol(pos + strlen_P(layerCountPrusa), NULL, 10);
+        return true;
+    }
+    return false;
+}
+
+/** Converts durations like "1d 2h 3m 4s" or "1 hours 23 minutes" to seconds. */
+static uint32_t parseDuration(const char* pos) {
+    uint32_t seconds = 0;
+    while (true) {
+        while (*pos == ' ')
+            pos++;
+        if (!isDigit(*pos))
+            break;
+        char* q;
+        uint32_t value = strtol(pos, &q, 10);
+        while (*q == ' ')
+            q++;
+        switch (*q) {
+        case 'd':
+            seconds += value * 86400;
+            break;
+        case 'h':
+            seconds += value * 3600;
+            break;
+        case 'm':
+            seconds += value * 60;
+            break;
+        case 's':
+            seconds += value;
+            break;
+        default:
+            return seconds;
+        }
+        while (isalpha(*q))
+            q++;
+        pos = q;
+    }
+    return seconds;
+}
+
+bool GCodeFileInfo::findPrintTime(char* buf, uint32_t& seconds) {
+    // CURA
+    const char* timeCura = PSTR(";TIME:");
+    char* pos = strstr_P(buf, timeCura);
+    if (pos) {
+        seconds = strtol(pos + strlen_P(timeCura), NULL, 10);
+        return true;
+    }
+
+    // SLIC3R & PRUSASLICER
+    pos = strstr_P(buf, PSTR("; estimated printing time"));
+    if (pos && (pos = strchr(pos, '=')) != NULL) {
+        seconds = parseDuration(pos + 1);
+        return true;
+    }
+
+    // S3D
+    const char* timeS3D = PSTR("Build time: ");
+    pos = strstr_P(buf, timeS3D);
+    if (pos) {
+        seconds = parseDuration(pos + strlen_P(timeS3D));
+        return true;
+    }
+    return false;
+}
+
 bool GCodeFileInfo::findTotalHeight(char* buf, float& height) {
     int len = 1024;
     bool inComment, inRelativeMode = false;
@@ -43,6 +43,9 @@ bool GCode::waitUntilAllCommandsAreParsed = false; ///< Don't read until all com
                                                    ///< is misused as storage for strings.
 uint32_t GCode::actLineNumber;                     ///< Line number of current command.
 volatile uint8_t GCode::bufferLength = 0;          ///< Number of commands stored in gcode_buffer
+#if GCODE_BUFFER_SIZE > 1
+GCodeSource* GCode::readSource = NULL;
+#endif
 uint8_t GCode::formatErrors = 0;
 PGM_P GCode::fatalErrorMsg = NULL;  ///< message unset = no fatal error
 millis_t GCode::lastBusySignal = 0; ///< When was the last busy signal
@@ -230,7 +233,26 @@ void GCode::requestResend() {
     Com::println();
     Com::printFLN(Com::tResend, lastLineNumber + 1);
 #endif
-    Com::printFLN(Com::tOk);
+    printOk();
+}
+
+/** Sends an ok, followed by the free buffer entries if the host enabled them. */
+void GCode::printOk() {
+    Com::printF(Com::tOk);
+    printFreeBuffers();
+    Com::println();
+}
+
+/** Appends the free buffer entries to an ok when the host enabled them with
+M538. P is the number of moves like the last one that still fit into the move
+cache, B the number of commands that fit into the command and receive buffers. */
+void GCode::printFreeBuffers() {
+#if NEW_COMMUNICATION
+    if (!GCodeSource::activeSource->sendFreeBuffers)
+        return;
+    Com::printF(PSTR(" P"), (int32_t)PrintLine::freeMoves());
+    Com::printF(PSTR(" B"), (int32_t)(GCODE_BUFFER_SIZE - bufferLength + GCodeSource::activeSource->freeInputLines()));
+#endif
 }
 
 /**
@@ -243,11 +265,11 @@ void GCode::checkAndPushCommand() {
         {
 #if NEW_COMMUNICATION
             GCodeSource::activeSource->lastLineNumber = actLineNumber;
-            Com::printFLN(Com::tOk);
+            printOk();
             GCodeSource::activeSource->waitingForResend = -1;
 #else
             lastLineNumber = actLineNumber;
-            Com::printFLN(Com::tOk);
+            printOk();
             waitingForResend = -1;
 #endif
             return;
@@ -291,7 +313,7 @@ void GCode::checkAndPushCommand() {
                 // and we ignore it
                 commandsReceivingWritePosition = 0;
                 Com::printFLN(Com::tSkip, actLineNumber);
-                Com::printFLN(Com::tOk);
+                printOk();
             }
 #if NEW_COMMUNICATION
             else if (GCodeSource::activeSource->waitingForResend < 0) // after a resend, we have to skip the garbage in buffers, no
@@ -319,7 +341,7 @@ void GCode::checkAndPushCommand() {
 #endif
                 commandsReceivingWritePosition = 0;
                 Com::printFLN(Com::tSkip, actLineNumber);
-                Com::printFLN(Com::tOk);
+                printOk();
             }
             return;
         }
@@ -347,11 +369,18 @@ void GCode::checkAndPushCommand() {
     if (hasM() && M == 667)
         return; // omit ok
 #endif
+#if NEW_COMMUNICATION
+    // Switch streaming acknowledge here, so the host sees the result in this ok
+    if (hasM() && M == 538)
+        GCodeSource::activeSource->sendFreeBuffers = getS(1) != 0;
+#endif
 #if ACK_WITH_LINENUMBER
-    Com::printFLN(Com::tOkSpace, actLineNumber);
+    Com::printF(Com::tOkSpace, actLineNumber);
 #else
-    Com::printFLN(Com::tOk);
+    Com::printF(Com::tOk);
 #endif
+    printFreeBuffers();
+    Com::println();
 #if NEW_COMMUNICATION
     GCodeSource::activeSource->wasLastCommandReceivedAsBinary = sendAsBinary;
     keepAlive(NotBusy);
@@ -456,6 +485,26 @@ void GCode::executeFString(FSTRINGPARAM(cmd)) {
     } while (c);
 }
 
+#if GCODE_BUFFER_SIZE > 1
+/** \brief Reads the next commands while the current command waits.
+
+Executing a command switches the active source to the source of the command. Reading
+has to continue with the source readFromSerial used last, otherwise partially received
+commands would get mixed up.
+*/
+void GCode::readAhead() {
+    if (readSource == NULL) { // no command running, active source is the reading source
+        readFromSerial();
+        return;
+    }
+    GCodeSource* executing = GCodeSource::activeSource;
+    GCodeSource::activeSource = readSource;
+    readFromSerial();
+    readSource = GCodeSource::activeSource;
+    GCodeSource::activeSource = executing;
+}
+#endif
+
 /** \brief Read from serial console or sd card.
 
 This function is the main function to read the commands from serial console or
@@ -945,8 +994,129 @@ bool GCode::parseBinary(uint8_t* buffer, fast8_t length, bool fromSerial) {
     return true;
 }
 
-/**
-  Converts a ASCII GCode line into a GCode structure.
+/** Parameter classes of ASCII characters for parseAscii. Lower case letters
+map to the same class as upper case letters, 0 means ignored. */
+#define GCODE_CLASS_END 1      // '(', '%' or ';' end the command
+#define GCODE_CLASS_CHECKSUM 2 // '*'
+#define GCODE_CLASS_N 3
+#define GCODE_CLASS_G 4
+#define GCODE_CLASS_M 5
+#define GCODE_CLASS_T 6
+#define GCODE_CLASS_S 7
+#define GCODE_CLASS_P 8
+#define GCODE_CLASS_X 9  // X, Y, Z, E, F follow
+#define GCODE_CLASS_I 14 // I, J, R, D, C, H, A, B, K, L, O follow, bit in params2
+const uint8_t gcodeLetterClass[128] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 20, 21, 18, 17, 12, 13, 4, 19, 14, 15, 22, 23, 5, 3, 24,
+    8, 0, 16, 7, 6, 0, 0, 0, 9, 10, 11, 0, 0, 0, 0, 0,
+    0, 20, 21, 18, 17, 12, 13, 4, 19, 14, 15, 22, 23, 5, 3, 24,
+    8, 0, 16, 7, 6, 0, 0, 0, 9, 10, 11, 0, 0, 0, 0, 0};
+const float gcodePowersOf10[10] PROGMEM = {1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f, 10000000.0f, 100000000.0f, 1000000000.0f};
+
+/** Parses an integer at s and moves s behind it. Leading spaces and tabs are
+skipped like strtol does, an empty number is 0. All consumed characters get
+added to checksum. */
+int32_t GCode::parseLongValue(char*& s, uint8_t& checksum) {
+    while (*s == ' ' || *s == '\t')
+        checksum ^= *s++;
+    bool negative = *s == '-';
+    if (negative || *s == '+')
+        checksum ^= *s++;
+    uint32_t v = 0;
+    while (*s >= '0' && *s <= '9') {
+        v = v * 10 + (*s - '0');
+        checksum ^= *s++;
+    }
+    return negative ? -static_cast<int32_t>(v) : static_cast<int32_t>(v);
+}
+
+/** Parses a decimal number at s and moves s behind its digits. The digits
+are collected in an integer and scaled by one division at the end, which is
+much faster then strtod. Up to 9 significant digits are used.
+
+An exponent is applied like strtod does, so X1E2 is X100. As in the old
+strtod based parser the position stays at the exponent letter, so the
+following E parameter is parsed as well. */
+float GCode::parseFloatValue(char*& s, uint8_t& checksum) {
+    while (*s == ' ' || *s == '\t')
+        checksum ^= *s++;
+    bool negative = *s == '-';
+    if (negative || *s == '+')
+        checksum ^= *s++;
+    uint32_t mantissa = 0;
+    int16_t exponent = 0;
+    bool hasDigits = false;
+    while (*s >= '0' && *s <= '9') {
+        if (mantissa < 100000000UL)
+            mantissa = mantissa * 10 + (*s - '0');
+        else
+            exponent++;
+        checksum ^= *s++;
+        hasDigits = true;
+    }
+    if (*s == '.') {
+        checksum ^= *s++;
+        while (*s >= '0' && *s <= '9') {
+            if (mantissa < 100000000UL) {
+                mantissa = mantissa * 10 + (*s - '0');
+                exponent--;
+            }
+            checksum ^= *s++;
+            hasDigits = true;
+        }
+    }
+    if (hasDigits && (*s == 'E' || *s == 'e')) {
+        char* e = s + 1;
+        bool negativeExponent = *e == '-';
+        if (negativeExponent || *e == '+')
+            e++;
+        int16_t value = 0;
+        while (*e >= '0' && *e <= '9') {
+            if (value < 1000)
+                value = value * 10 + (*e - '0');
+            e++;
+        }
+        exponent += negativeExponent ? -value : value;
+    }
+    if (mantissa == 0)
+        return negative ? -0.0f : 0.0f;
+    if (mantissa < 16777216UL && exponent >= -9 && exponent <= 9) {
+        // Mantissa and power of 10 are exact floats, so the result is rounded only once
+        float f = static_cast<float>(mantissa);
+        if (exponent < 0)
+            f /= pgm_read_float(&gcodePowersOf10[-exponent]);
+        else
+            f *= pgm_read_float(&gcodePowersOf10[exponent]);
+        return negative ? -f : f;
+    }
+    // Longer numbers need the precision of double, which is float on AVR.
+    // Powers up to 1e22 are exact doubles, so there is again only one rounding.
+    double scale = 1.0;
+    int16_t e = exponent < 0 ? -exponent : exponent;
+    while (e > 0) {
+        int16_t step = e > 9 ? 9 : e;
+        scale *= pgm_read_float(&gcodePowersOf10[step]);
+        e -= step;
+    }
+    double d = static_cast<double>(mantissa);
+    d = exponent < 0 ? d / scale : d * scale;
+    return static_cast<float>(negative ? -d : d);
+}
+
+/** \brief Parses an ASCII command in one pass.
+
+Each character is classified with gcodeLetterClass, values are read by
+parseLongValue/parseFloatValue which move the position behind the number,
+and the checksum is built while scanning.
+
+Like in the old parser '(' and '%' end the command. ';' ends it as well,
+which changes nothing for the serial, sd card and flash readers, they cut
+comments off before. src/Simulator compares both parsers, see
+SimulatorParse.cpp.
 */
 bool GCode::parseAscii(char* line, bool fromSerial) {
     char* pos = line;
@@ -954,47 +1124,93 @@ bool GCode::parseAscii(char* line, bool fromSerial) {
     params2 = 0;
     internalCommand = !fromSerial;
     bool hasChecksum = false;
-    char c;
-    while ((c = *(pos++))) {
-        if (c == '(' || c == '%')
-            break; // alternative comment or program block
-        switch (c) {
-        case 'N':
-        case 'n': {
-            actLineNumber = parseLongValue(pos);
+    uint8_t checksum = 0;
+    uint8_t c;
+    while ((c = *pos)) {
+        uint8_t cl = (c & 128) ? 0 : pgm_read_byte(&gcodeLetterClass[c]);
+        pos++;
+        if (cl == GCODE_CLASS_CHECKSUM) {
+            uint8_t unused = 0;
+            uint8_t checksum_given = parseLongValue(pos, unused);
+#if FEATURE_CHECKSUM_FORCED
+            Printer::flag0 |= PRINTER_FLAG0_FORCE_CHECKSUM;
+#endif
+            if (checksum != checksum_given) {
+                if (Printer::debugErrors()) {
+                    Com::printErrorFLN(Com::tWrongChecksum);
+                }
+                return false; // mismatch
+            }
+            hasChecksum = true;
+            continue;
+        }
+        checksum ^= c;
+        if (cl == 0)
+            continue;
+        if (cl == GCODE_CLASS_END)
+            break; // comment or program block
+        if (cl >= GCODE_CLASS_I) {
+            float f = parseFloatValue(pos, checksum);
+            switch (cl - GCODE_CLASS_I) {
+            case 0:
+                I = f;
+                break;
+            case 1:
+                J = f;
+                break;
+            case 2:
+                R = f;
+                break;
+            case 3:
+                D = f;
+                break;
+            case 4:
+                C = f;
+                break;
+            case 5:
+                H = f;
+                break;
+            case 6:
+                A = f;
+                break;
+            case 7:
+                B = f;
+                break;
+            case 8:
+                K = f;
+                break;
+            case 9:
+                L = f;
+                break;
+            default:
+                O = f;
+            }
+            params2 |= 1 << (cl - GCODE_CLASS_I);
+            params |= 4096; // Needs V2 for saving
+            continue;
+        }
+        switch (cl) {
+        case GCODE_CLASS_N:
+            actLineNumber = parseLongValue(pos, checksum);
             params |= 1;
             N = actLineNumber;
             break;
-        }
-        case 'G':
-        case 'g': {
-            G = parseLongValue(pos) & 0xffff;
+        case GCODE_CLASS_G:
+            G = parseLongValue(pos, checksum) & 0xffff;
             params |= 4;
             if (G > 255)
                 params |= 4096;
             break;
-        }
-        case 'M':
-        case 'm': {
-            M = parseLongValue(pos) & 0xffff;
+        case GCODE_CLASS_M:
+            M = parseLongValue(pos, checksum) & 0xffff;
             params |= 2;
             if (M > 255)
                 params |= 4096;
             // handle non standard text arguments that some M codes have
-            if (M == 20 || M == 23 || M == 28 || M == 29 || M == 30 || M == 32 || M == 36 || M == 117 || M == 118 || M == 531) {
+            if (M == 20 || M == 23 || M == 28 || M == 29 || M == 30 || M == 32 || M == 34 || M == 36 || M == 117 || M == 118 || M == 531) {
                 // after M command we got a filename or text
-                char digit;
-                while ((digit = *pos)) {
-                    if (digit < '0' || digit > '9')
-                        break;
-                    pos++;
-                }
-                while ((digit = *pos)) {
-                    if (digit != ' ')
-                        break;
-                    pos++;
-                    // skip leading white spaces (may be no white space)
-                }
+                while (*pos == ' ')
+                    pos++; // skip leading white spaces (may be no white space)
                 text = pos;
                 while (*pos) {
                     if ((M != 117 && M != 20 && M != 531 && *pos == ' ') || *pos == '*')
@@ -1007,154 +1223,39 @@ bool GCode::parseAscii(char* line, bool fromSerial) {
                 params |= 32768;
             }
             break;
-        }
-        case 'X':
-        case 'x': {
-            X = parseFloatValue(pos);
-            params |= 8;
-            break;
-        }
-        case 'Y':
-        case 'y': {
-            Y = parseFloatValue(pos);
-            params |= 16;
-            break;
-        }
-        case 'Z':
-        case 'z': {
-            Z = parseFloatValue(pos);
-            params |= 32;
-            break;
-        }
-        case 'E':
-        case 'e': {
-            E = parseFloatValue(pos);
-            params |= 64;
-            break;
-        }
-        case 'F':
-        case 'f': {
-            F = parseFloatValue(pos);
-            params |= 256;
-            break;
-        }
-        case 'T':
-        case 't': {
-            T = parseLongValue(pos) & 0xff;
+        case GCODE_CLASS_T:
+            T = parseLongValue(pos, checksum) & 0xff;
             params |= 512;
             break;
-        }
-        case 'S':
-        case 's': {
-            S = parseLongValue(pos);
+        case GCODE_CLASS_S:
+            S = parseLongValue(pos, checksum);
             params |= 1024;
             break;
-        }
-        case 'P':
-        case 'p': {
-            P = parseLongValue(pos);
+        case GCODE_CLASS_P:
+            P = parseLongValue(pos, checksum);
             params |= 2048;
             break;
-        }
-        case 'I':
-        case 'i': {
-            I = parseFloatValue(pos);
-            params2 |= 1;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'J':
-        case 'j': {
-            J = parseFloatValue(pos);
-            params2 |= 2;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'R':
-        case 'r': {
-            R = parseFloatValue(pos);
-            params2 |= 4;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'D':
-        case 'd': {
-            D = parseFloatValue(pos);
-            params2 |= 8;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'C':
-        case 'c': {
-            C = parseFloatValue(pos);
-            params2 |= 16;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'H':
-        case 'h': {
-            H = parseFloatValue(pos);
-            params2 |= 32;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'A':
-        case 'a': {
-            A = parseFloatValue(pos);
-            params2 |= 64;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'B':
-        case 'b': {
-            B = parseFloatValue(pos);
-            params2 |= 128;
-            params |= 4096; // Needs V2 for saving
-            break;
-        }
-        case 'K':
-        case 'k': {
-            K = parseFloatValue(pos);
-            params2 |= 256;
-            params |= 4096; // Needs V2 for saving
+        case GCODE_CLASS_X:
+            X = parseFloatValue(pos, checksum);
+            params |= 8;
             break;
-        }
-        case 'L':
-        case 'l': {
-            L = parseFloatValue(pos);
-            params2 |= 512;
-            params |= 4096; // Needs V2 for saving
+        case GCODE_CLASS_X + 1:
+            Y = parseFloatValue(pos, checksum);
+            params |= 16;
             break;
-        }
-        case 'O':
-        case 'o': {
-            O = parseFloatValue(pos);
-            params2 |= 1024;
-            params |= 4096; // Needs V2 for saving
+        case GCODE_CLASS_X + 2:
+            Z = parseFloatValue(pos, checksum);
+            params |= 32;
             break;
-        }
-        case '*': // checksum
-        {
-            uint8_t checksum_given = parseLongValue(pos);
-            uint8_t checksum = 0;
-            while (line != (pos - 1))
-                checksum ^= *line++;
-#if FEATURE_CHECKSUM_FORCED
-            Printer::flag0 |= PRINTER_FLAG0_FORCE_CHECKSUM;
-#endif
-            if (checksum != checksum_given) {
-                if (Printer::debugErrors()) {
-                    Com::printErrorFLN(Com::tWrongChecksum);
-                }
-                return false; // mismatch
-            }
-            hasChecksum = true;
+        case GCODE_CLASS_X + 3:
+            E = parseFloatValue(pos, checksum);
+            params |= 64;
             break;
-        }
         default:
-            break;
-        } // end switch
-    }     // end while
+            F = parseFloatValue(pos, checksum);
+            params |= 256;
+        }
+    } // end while
 #if NEW_COMMUNICATION
     if (GCodeSource::activeSource->wasLastCommandReceivedAsBinary && !hasChecksum && fromSerial && !waitUntilAllCommandsAreParsed) {
 #else
@@ -1347,6 +1448,7 @@ void GCodeSource::registerSource(GCodeSource* newSource) {
 
 void GCodeSource::removeSource(GCodeSource* delSource) {
     fast8_t i;
+    flushOutput(); // might still go to delSource
     for (i = 0; i < numSources; i++) {
         if (sources[i] == delSource) {
             // printAllFLN(PSTR("DelSource:"),i);
@@ -1386,6 +1488,42 @@ void GCodeSource::rotateSource() { ///< Move active to next source
     GCode::commandsReceivingWritePosition = 0;
 }
 
+#if OUTPUT_BUFFER_SIZE
+uint8_t GCodeSource::outputBuffer[OUTPUT_BUFFER_SIZE];
+uint8_t GCodeSource::outputLength = 0;
+bool GCodeSource::outputToAll = true;
+GCodeSource* GCodeSource::outputSource = NULL;
+
+/** Output is collected until a line is complete or the buffer is full and then
+written as one block to each receiver. If the receivers change in between, the
+collected part is sent first, so every byte reaches the same receivers as
+without buffering. */
+void GCodeSource::writeToAll(uint8_t byte) {
+    if (outputLength > 0 && (outputToAll != Com::writeToAll || (!outputToAll && outputSource != activeSource)))
+        flushOutput();
+    if (outputLength == 0) {
+        outputToAll = Com::writeToAll;
+        outputSource = activeSource;
+    }
+    outputBuffer[outputLength++] = byte;
+    if (byte == '\n' || outputLength == OUTPUT_BUFFER_SIZE)
+        flushOutput();
+}
+
+void GCodeSource::flushOutput() {
+    if (outputLength == 0)
+        return;
+    uint8_t length = outputLength;
+    outputLength = 0;
+    if (outputToAll) {
+        for (fast8_t i = 0; i < numWriteSources; i++) {
+            writeableSources[i]->write(outputBuffer, length);
+        }
+    } else {
+        outputSource->write(outputBuffer, length);
+    }
+}
+#else
 void GCodeSource::writeToAll(uint8_t byte) { ///< Write to all listening sources
 #if NEW_COMMUNICATION
     if (Com::writeToAll) {
@@ -1400,6 +1538,7 @@ void GCodeSource::writeToAll(uint8_t byte) { ///< Write to all listening sources
     HAL::serialWriteByte(byte);
 #endif
 }
+#endif
 
 void GCodeSource::prefetchAll() {
     for (fast8_t i = 0; i < numSources; i++) {
@@ -1424,6 +1563,7 @@ GCodeSource::GCodeSource() {
     lastLineNumber = 0;
     wasLastCommandReceivedAsBinary = false;
     waitingForResend = -1;
+    sendFreeBuffers = false;
 }
 
 // ----- serial connection source -----
@@ -1445,6 +1585,17 @@ bool SerialGCodeSource::closeOnError() { // return true if the channel can not
                                          // interactively correct errors.
     return false;
 }
+uint8_t SerialGCodeSource::freeInputLines() {
+#ifdef SERIAL_BUFFER_SIZE
+    int16_t free = SERIAL_BUFFER_SIZE - 1 - stream->available();
+#else
+    int16_t free = 0;
+#endif
+#if EMERGENCY_PARSER
+    free += SERIAL_IN_BUFFER - bufLength;
+#endif
+    return free > 0 ? free / MAX_CMD_SIZE : 0;
+}
 bool SerialGCodeSource::dataAvailable() { // would read return a new byte?
 #if EMERGENCY_PARSER
     return bufLength > 0;
@@ -1469,6 +1620,7 @@ int SerialGCodeSource::readByte() {
 #endif
 }
 void SerialGCodeSource::writeByte(uint8_t byte) { stream->write(byte); }
+void SerialGCodeSource::write(const uint8_t* data, uint8_t length) { stream->write(data, length); }
 void SerialGCodeSource::close() { }
 void SerialGCodeSource::prefetchContent() {
 #if EMERGENCY_PARSER
@@ -1566,6 +1718,101 @@ bool SDCardGCodeSource::dataAvailable() { // would read return a new byte?
     }
     return false;
 }
+/** Stops the print after a read error that did not recover. The stop runs
+the normal SD stop handling, but the host must not see "Done printing" for
+a print that is incomplete. */
+void SDCardGCodeSource::abortOnReadError() {
+    Com::printErrorFLN(PSTR("SD error did not recover!"));
+    UI_ERROR("SD print aborted");
+    sd.sdmode = 0; // suppresses the "stopped by user" message
+    sd.stopPrint();
+}
+#if SD_READ_BUFFER_SIZE
+SDCardGCodeSource::SDCardGCodeSource()
+    : GCodeSource() {
+    resetBuffer();
+#ifdef DEBUG_SD_READ
+    resetStatistics();
+#endif
+}
+
+/** Discards buffered data after the file or position changed. */
+void SDCardGCodeSource::resetBuffer() {
+    bufferLength[0] = bufferLength[1] = 0;
+    readPos = 0;
+    activeBuffer = 0;
+    filePos = sd.sdpos;
+}
+
+#ifdef DEBUG_SD_READ
+/** Starts new read statistics, called when a file gets selected. Seeks within
+the file keep them, so they cover the complete print. */
+void SDCardGCodeSource::resetStatistics() {
+    bytesRead = readMicros = maxReadMicros = 0;
+}
+#endif
+
+/** Refills empty buffers in file order. The first read after a seek stops at
+the next block boundary, so all following reads cover complete blocks and
+SdFat copies them directly from the card without its block cache. */
+void SDCardGCodeSource::fillBuffer() {
+    for (uint8_t i = 0; i < 2; i++) {
+        uint8_t b = activeBuffer ^ i;
+        if (bufferLength[b] != 0)
+            continue;
+        if (filePos >= sd.filesize)
+            return;
+        uint16_t n = SD_READ_BUFFER_SIZE - (filePos & (SD_READ_BUFFER_SIZE - 1));
+#ifdef DEBUG_SD_READ
+        uint32_t start = HAL::timeInMicroseconds();
+#endif
+        int r = sd.file.read(buffer[b], n);
+        if (r < 0) {
+            Com::printFLN(Com::tSDReadError);
+            UI_ERROR("SD Read Error");
+            // Second try in case of recoverable errors
+            sd.file.seekSet(filePos);
+            r = sd.file.read(buffer[b], n);
+            if (r < 0) {
+                abortOnReadError();
+                return;
+            }
+            UI_ERROR("SD error fixed");
+        }
+#ifdef DEBUG_SD_READ
+        uint32_t duration = HAL::timeInMicroseconds() - start;
+        readMicros += duration;
+        if (duration > maxReadMicros)
+            maxReadMicros = duration;
+        bytesRead += r;
+#endif
+        filePos += r;
+        bufferLength[b] = r;
+        if (r == 0) // unexpected end of file
+            return;
+    }
+}
+
+int SDCardGCodeSource::readByte() {
+    if (readPos >= bufferLength[activeBuffer]) {
+        if (bufferLength[activeBuffer] != 0) { // switch to next block
+            bufferLength[activeBuffer] = 0;
+            activeBuffer ^= 1;
+            readPos = 0;
+        }
+        if (bufferLength[activeBuffer] == 0) {
+            fillBuffer();
+            if (bufferLength[activeBuffer] == 0) {
+                if (sd.sdmode == 1) // end of file, not aborted by a read error
+                    close();
+                return 0;
+            }
+        }
+    }
+    sd.sdpos++;
+    return buffer[activeBuffer][readPos++];
+}
+#else
 int SDCardGCodeSource::readByte() {
     int n = sd.file.read();
     if (n == -1) {
@@ -1576,8 +1823,7 @@ int SDCardGCodeSource::readByte() {
         sd.file.seekSet(sd.sdpos);
         n = sd.file.read();
         if (n == -1) {
-            Com::printErrorFLN(PSTR("SD error did not recover!"));
-            close();
+            abortOnReadError();
             return 0;
         }
         UI_ERROR("SD error fixed");
@@ -1585,6 +1831,7 @@ int SDCardGCodeSource::readByte() {
     sd.sdpos++; // = file.curPosition();
     return n;
 }
+#endif
 void SDCardGCodeSource::writeByte(uint8_t byte) {
     // dummy
 }
@@ -1595,6 +1842,12 @@ void SDCardGCodeSource::close() {
     Printer::setMenuMode(MENU_MODE_SD_PRINTING, false);
     Printer::setMenuMode(MENU_MODE_PAUSED, false);
     Com::printFLN(Com::tDonePrinting);
+#if SD_READ_BUFFER_SIZE && defined(DEBUG_SD_READ)
+    Com::printF(PSTR("SD read bytes:"), (int32_t)bytesRead);
+    if (readMicros > 0)
+        Com::printF(PSTR(" bytes/s:"), 1000000.0f * static_cast<float>(bytesRead) / static_cast<float>(readMicros), 0);
+    Com::printFLN(PSTR(" max read us:"), (int32_t)maxReadMicros);
+#endif
 }
 #endif
 
@@ -54,8 +54,10 @@ public:
     virtual bool dataAvailable(); // would read return a new byte?
     virtual int readByte();
     virtual void writeByte(uint8_t byte);
+    virtual void write(const uint8_t* data, uint8_t length);
     virtual void close();
     virtual void prefetchContent();
+    virtual uint8_t freeInputLines();
     void testEmergency(GCode& gcode);
 };
 //#pragma message "Sd support: " XSTR(SDSUPPORT)
@@ -70,6 +72,27 @@ public:
     virtual int readByte();
     virtual void writeByte(uint8_t byte);
     virtual void close();
+    void abortOnReadError();
+#if SD_READ_BUFFER_SIZE
+    SDCardGCodeSource();
+    void fillBuffer();
+    void resetBuffer();
+#ifdef DEBUG_SD_READ
+    void resetStatistics();
+#endif
+
+private:
+    uint8_t buffer[2][SD_READ_BUFFER_SIZE]; ///< Read ahead blocks, used alternating
+    uint16_t bufferLength[2];               ///< Valid bytes per block, 0 = needs refill
+    uint16_t readPos;                       ///< Next byte in buffer[activeBuffer]
+    uint8_t activeBuffer;
+    uint32_t filePos;      ///< File position after the last buffered byte
+#ifdef DEBUG_SD_READ
+    uint32_t bytesRead;    ///< Statistics for the selected file, kept over seeks
+    uint32_t readMicros;
+    uint32_t maxReadMicros;
+#endif
+#endif
 };
 #endif
 
@@ -187,6 +210,10 @@ public:
     static GCode* peekCurrentCommand();
     /** Frees the cache used by the last command fetched. */
     static void readFromSerial();
+#if GCODE_BUFFER_SIZE > 1
+    static GCodeSource* readSource; ///< Source to continue reading while a command executes
+    static void readAhead();
+#endif
     static void pushCommand();
     static void executeFString(FSTRINGPARAM(cmd));
     static uint8_t computeBinarySize(char* ptr);
@@ -205,26 +232,10 @@ protected:
     void debugCommandBuffer();
     void checkAndPushCommand();
     static void requestResend();
-    inline float parseFloatValue(char* s) {
-        char* endPtr;
-        while (*s == 32) {
-            s++; // skip spaces
-        }
-        float f = (strtod(s, &endPtr));
-        if (s == endPtr) {
-            f = 0.0; // treat empty string "x " as "x0"
-        }
-        return f;
-    }
-    inline long parseLongValue(char* s) {
-        char* endPtr;
-        while (*s == 32)
-            s++; // skip spaces
-        long l = (strtol(s, &endPtr, 10));
-        if (s == endPtr)
-            l = 0; // treat empty string argument "p " as "p0"
-        return l;
-    }
+    static void printOk();
+    static void printFreeBuffers();
+    static int32_t parseLongValue(char*& s, uint8_t& checksum);
+    static float parseFloatValue(char*& s, uint8_t& checksum);
 
     static GCode
         commandsBuffered[GCODE_BUFFER_SIZE];       ///< Buffer for received commands.
@@ -269,18 +280,47 @@ public:
 class GCodeFileInfo {
 public:
     void init(SdFile& file);
+    void startParse(SdFile& file);
+    bool parse(SdFile& file, uint16_t chunks);
 
     unsigned long fileSize;
     float objectHeight;
     float layerHeight;
     float filamentNeeded;
+    uint32_t printTime; ///< Print time estimated by the slicer in seconds, 0 = unknown
+    uint16_t layerCount; ///< Layers reported by the slicer, 0 = unknown
     char generatedBy[GENBY_SIZE];
+    uint8_t parsePhase;   ///< 0 = file start, 1 = file end, 2 = object height, 3 = done
+    uint8_t parseFound;   ///< Bit 0 = generated by, bit 1 = layer height, bit 2 = filament found
+    uint16_t parseOffset; ///< Bytes parsed in the current phase
 
     bool findGeneratedBy(char* buf, char* genBy);
     bool findLayerHeight(char* buf, float& layerHeight);
     bool findFilamentNeed(char* buf, float& filament);
     bool findTotalHeight(char* buf, float& objectHeight);
+    bool findLayerCount(char* buf, uint16_t& layers);
+    bool findPrintTime(char* buf, uint32_t& seconds);
+};
+
+#if SD_INFO_CACHE_SIZE
+#define SD_INFO_CACHE_VERSION 1
+/** Entry of the G-code information cache file. The first cluster, size and
+modification time identify the file, so renamed or moved files keep their
+entry. 64 byte, so 8 entries fill one card block. */
+struct GCodeFileInfoCacheEntry {
+    uint32_t cluster;
+    uint32_t fileSize;
+    uint32_t modified; ///< Modification date << 16 | modification time
+    uint16_t version;  ///< SD_INFO_CACHE_VERSION, 0 = unused entry
+    uint16_t layerCount;
+    uint32_t printTime;
+    float objectHeight;
+    float layerHeight;
+    float filamentNeeded;
+    char generatedBy[GENBY_SIZE];
+    uint8_t reserved[64 - 32 - GENBY_SIZE];
 };
 #endif
+#endif
 
 #endif
@@ -78,14 +78,375 @@ float maxadvspeed = 0;
 uint8_t pwm_pos[NUM_PWM];   // 0-NUM_EXTRUDER = Heater 0-NUM_EXTRUDER of extruder, NUM_EXTRUDER = Heated bed, NUM_EXTRUDER+1 Board fan, NUM_EXTRUDER+2 = Fan
 volatile int waitRelax = 0; // Delay filament relax at the end of print, could be a simple timeout
 
+#if PRINTLINE_DYNAMIC_CACHE
+PrintLine* PrintLine::lines = NULL; ///< Cache for print moves, allocated in allocateCache.
+ufast8_t PrintLine::linesCacheSize = 0;
+ufast8_t PrintLine::linesCacheMask = 0;
+#else
 PrintLine PrintLine::lines[PRINTLINE_CACHE_SIZE]; ///< Cache for print moves.
+#endif
 PrintLine* PrintLine::cur = NULL;                 ///< Current printing line
+#if S_CURVE_ACCELERATION
+bool PrintLine::sCurveEnabled = true;
+#endif
 #if CPU_ARCH == ARCH_ARM
 volatile bool PrintLine::nlFlag = false;
 #endif
 ufast8_t PrintLine::linesWritePos = 0;       ///< Position where we write the next cached line move.
 volatile ufast8_t PrintLine::linesCount = 0; ///< Number of lines cached 0 = nothing to do.
+uint16_t PrintLine::linesPushed = 0;
+uint16_t PrintLine::moveLinesStart = 0;
+uint16_t PrintLine::linesPerMove = 1;
 ufast8_t PrintLine::linesPos = 0;            ///< Position for executing line movement.
+#if ARC_SUPPORT
+uint8_t PrintLine::currentArcID = 0;
+float PrintLine::arcJunctionSpeed = 0;
+#endif
+#if ARC_IN_STEPPER
+float PrintLine::arcRadius = 0;
+float PrintLine::arcStartAngle;
+float PrintLine::arcTravel;
+int32_t PrintLine::arcVectorX, PrintLine::arcVectorY;
+int32_t PrintLine::arcCorrectionX, PrintLine::arcCorrectionY;
+int32_t PrintLine::arcPositionX, PrintLine::arcPositionY;
+#endif
+#if NONLINEAR_SEGMENT_POOL
+NonlinearSegment PrintLine::segmentPool[NONLINEAR_SEGMENT_POOL];
+uint16_t PrintLine::segmentPoolWritePos = 0;
+volatile uint16_t PrintLine::segmentPoolUsed = 0;
+uint8_t PrintLine::segmentsPending = 0;
+uint16_t PrintLine::segmentsPushed = 0;
+uint16_t PrintLine::moveSegmentsStart = 0;
+uint16_t PrintLine::segmentsPerMove = 0;
+#endif
+#if PRINTLINE_DYNAMIC_CACHE
+/** Allocates the move cache with the largest power of 2 size up to
+PRINTLINE_CACHE_SIZE_MAX that still leaves PRINTLINE_CACHE_RESERVE_RAM bytes
+free. Must be called before the first move gets queued. */
+void PrintLine::allocateCache() {
+    int32_t available = HAL::getFreeRam() - PRINTLINE_CACHE_RESERVE_RAM;
+    ufast8_t size = PRINTLINE_CACHE_SIZE_MAX;
+    while (size > 16 && static_cast<int32_t>(size * sizeof(PrintLine)) > available)
+        size >>= 1;
+    while ((lines = new PrintLine[size]()) == NULL && size > 16)
+        size >>= 1;
+    linesCacheSize = size;
+    linesCacheMask = size - 1;
+    linesPos = linesWritePos = 0;
+    linesCount = 0;
+}
+#endif
+
+#if STEP_TIMING_TABLE
+/** 131072 / sqrt(16 + i), used by PrintLine::rampInterval */
+const uint16_t rampRsqrtTable[49] PROGMEM = {
+    32768, 31790, 30894, 30070, 29309, 28602, 27945, 27330, 26755, 26214,
+    25705, 25225, 24770, 24339, 23930, 23541, 23170, 22817, 22479, 22155,
+    21845, 21548, 21263, 20988, 20724, 20470, 20225, 19988, 19760, 19539,
+    19326, 19119, 18919, 18725, 18536, 18354, 18176, 18004, 17837, 17674,
+    17515, 17361, 17211, 17064, 16921, 16782, 16646, 16514, 16384
+};
+ramp_t rampSpeed2; ///< Squared speed of the current ramp
+#endif
+
+#if S_CURVE_ACCELERATION
+/** Computes the ramp timing from v0 to v1. The duration equals that of a
+constant acceleration ramp, so it covers the same number of steps. */
+void SCurveRamp::init(float v0, float v1, uint32_t accelerationPrim) {
+    float dv = fabs(v1 - v0);
+    uint32_t ticks = static_cast<uint32_t>(dv * static_cast<float>(F_CPU) / static_cast<float>(accelerationPrim)) + 1;
+    delta = static_cast<speed_t>(dv);
+    shift = 0;
+    while (ticks >= 65536) {
+        ticks >>= 1;
+        shift++;
+    }
+    scaledTicks = ticks;
+    factor = 2147483648UL / ticks;
+#ifdef DEBUG_STEP_TIMELINE
+    float seconds = static_cast<float>(static_cast<uint32_t>(scaledTicks) << shift) / static_cast<float>(F_CPU);
+    float jerk = 6.0f * dv / (seconds * seconds);
+    if (jerk > StepTimeline::maxSCurveJerk)
+        StepTimeline::maxSCurveJerk = jerk;
+#endif
+}
+#endif
+
+#if INPUT_SHAPING
+InputShaper InputShaper::axis[2];
+InputShaper InputShaper::combined;
+
+/** Computes amplitudes and impulse times from type, frequency and damping. */
+void InputShaper::update() {
+    impulses = 0;
+    duration = centroid = planDuration = 0;
+    damping = RMath::min(RMath::max(damping, 0.0f), 0.3f);
+    if (type == INPUT_SHAPER_OFF || type > INPUT_SHAPER_MZV || frequency <= 0) {
+        updateCombined();
+        return;
+    }
+    float df = sqrt(1.0f - damping * damping);
+    float period = 1.0f / (frequency * df); // damped period
+    float a[3], t[3];
+    t[0] = 0;
+    if (type == INPUT_SHAPER_MZV) {
+        float k = exp(-0.75f * damping * M_PI / df);
+        a[0] = 1.0f - 0.70710678f;
+        a[1] = 0.41421356f * k;
+        a[2] = a[0] * k * k;
+        t[1] = 0.375f * period;
+        t[2] = 0.75f * period;
+        impulses = 3;
+    } else {
+        float k = exp(-damping * M_PI / df);
+        a[0] = 1.0f;
+        t[1] = 0.5f * period;
+        if (type == INPUT_SHAPER_ZV) {
+            a[1] = k;
+            impulses = 2;
+        } else {
+            a[1] = 2.0f * k;
+            a[2] = k * k;
+            t[2] = period;
+            impulses = 3;
+        }
+    }
+    float sum = 0;
+    for (uint8_t i = 0; i < impulses; i++)
+        sum += a[i];
+    uint16_t rest = 32768;
+    for (uint8_t i = 0; i < impulses; i++) {
+        amplitude[i] = (i == impulses - 1 ? rest : static_cast<uint16_t>(32768.0f * a[i] / sum + 0.5f));
+        rest -= amplitude[i];
+        delay[i] = static_cast<uint32_t>(t[i] * static_cast<float>(F_CPU));
+        centroid += a[i] / sum * t[i];
+    }
+    duration = t[impulses - 1];
+    // Damped shapers are not symmetric, so ramps may need up to |duration - 2 centroid| more time
+    planDuration = duration + fabs(duration - 2.0f * centroid);
+    updateCombined();
+}
+
+/** Convolves the X and Y shaper. A diagonal move shaped with it excites neither
+resonance. Impulses at the same time get merged, so equal shapers need less. */
+void InputShaper::updateCombined() {
+    InputShaper& x = axis[X_AXIS];
+    InputShaper& y = axis[Y_AXIS];
+    combined.impulses = 0;
+    combined.duration = combined.centroid = combined.planDuration = 0;
+    if (!x.impulses || !y.impulses)
+        return;
+    uint16_t rest = 32768;
+    for (uint8_t i = 0; i < x.impulses; i++) {
+        for (uint8_t j = 0; j < y.impulses; j++) {
+            uint32_t t = x.delay[i] + y.delay[j];
+            uint16_t a = (static_cast<uint32_t>(x.amplitude[i]) * y.amplitude[j]) >> 15;
+            rest -= a;
+            uint8_t k = combined.impulses;
+            while (k > 0 && combined.delay[k - 1] > t) // keep times ascending
+                k--;
+            if (k > 0 && combined.delay[k - 1] == t) {
+                combined.amplitude[k - 1] += a;
+                continue;
+            }
+            for (uint8_t m = combined.impulses; m > k; m--) {
+                combined.delay[m] = combined.delay[m - 1];
+                combined.amplitude[m] = combined.amplitude[m - 1];
+            }
+            combined.delay[k] = t;
+            combined.amplitude[k] = a;
+            combined.impulses++;
+        }
+    }
+    combined.amplitude[combined.impulses - 1] += rest; // rounding errors
+    combined.duration = x.duration + y.duration;
+    combined.centroid = x.centroid + y.centroid;
+    combined.planDuration = combined.duration + fabs(combined.duration - 2.0f * combined.centroid);
+}
+
+void InputShaper::setDefaults() {
+    axis[X_AXIS].type = INPUT_SHAPER_X_TYPE;
+    axis[X_AXIS].frequency = INPUT_SHAPER_X_FREQUENCY;
+    axis[X_AXIS].damping = INPUT_SHAPER_X_DAMPING;
+    axis[Y_AXIS].type = INPUT_SHAPER_Y_TYPE;
+    axis[Y_AXIS].frequency = INPUT_SHAPER_Y_FREQUENCY;
+    axis[Y_AXIS].damping = INPUT_SHAPER_Y_DAMPING;
+    axis[X_AXIS].update();
+    axis[Y_AXIS].update();
+}
+
+void InputShaper::report() {
+    for (fast8_t i = X_AXIS; i <= Y_AXIS; i++) {
+        Com::printF(i == X_AXIS ? PSTR("Input shaper X type:") : PSTR("Input shaper Y type:"), (int)axis[i].type);
+        Com::printF(PSTR(" frequency:"), axis[i].frequency, 1);
+        Com::printF(PSTR(" damping:"), axis[i].damping, 2);
+        Com::printFLN(PSTR(" duration ms:"), axis[i].duration * 1000.0f, 1);
+    }
+    if (combined.impulses)
+        Com::printFLN(PSTR("Input shaper XY impulses:"), (int)combined.impulses);
+}
+
+/** Computes the unshaped ramp timing from v0 to v1 with constant acceleration. */
+void ShapedRamp::init(float v0, float v1, uint32_t accelerationPrim) {
+    float dv = fabs(v1 - v0);
+    uint32_t ticks = static_cast<uint32_t>(dv * static_cast<float>(F_CPU) / static_cast<float>(accelerationPrim)) + 1;
+    delta = static_cast<speed_t>(dv);
+    shift = 0;
+    while (ticks >= 65536) {
+        ticks >>= 1;
+        shift++;
+    }
+    scaledTicks = ticks;
+    factor = 2147483648UL / ticks;
+}
+#endif
+
+#ifdef DEBUG_STEP_TIMELINE
+StepTimelineEntry StepTimeline::entries[STEP_TIMELINE_SIZE];
+volatile uint16_t StepTimeline::readPos = 0;
+volatile uint16_t StepTimeline::writePos = 0;
+volatile uint32_t StepTimeline::time = 0;
+uint32_t StepTimeline::lost = 0;
+volatile bool StepTimeline::recording = false;
+uint32_t StepTimeline::linesPlanned = 0;
+uint32_t StepTimeline::planningMicros = 0;
+uint32_t StepTimeline::maxPlanningMicros = 0;
+uint32_t StepTimeline::recomputedLines = 0;
+uint32_t StepTimeline::plannedJunctions = 0;
+#if S_CURVE_ACCELERATION
+float StepTimeline::maxSCurveJerk = 0;
+#endif
+uint16_t StepTimeline::maxRecomputedLines = 0;
+uint32_t StepTimeline::stepperCalls = 0;
+uint32_t StepTimeline::stepsDone = 0;
+#if USE_ADVANCE
+uint32_t StepTimeline::extruderInterrupts = 0;
+uint32_t StepTimeline::extruderReversals = 0;
+#endif
+
+void StepTimeline::start() {
+    InterruptProtectedBlock noInts;
+    readPos = writePos = 0;
+    time = 0;
+    lost = 0;
+    linesPlanned = planningMicros = maxPlanningMicros = 0;
+    recomputedLines = plannedJunctions = 0;
+    maxRecomputedLines = 0;
+#if S_CURVE_ACCELERATION
+    maxSCurveJerk = 0;
+#endif
+    stepperCalls = stepsDone = 0;
+#if USE_ADVANCE
+    extruderInterrupts = extruderReversals = 0;
+#endif
+    recording = true;
+}
+
+void StepTimeline::stop() {
+    recording = false;
+}
+
+void StepTimeline::reportStatistics() {
+    Com::printF(PSTR("Timeline recording:"), (int)recording);
+    Com::printF(PSTR(" ticks/s:"), (int32_t)F_CPU);
+    Com::printF(PSTR(" time:"), (int32_t)time);
+    Com::printFLN(PSTR(" lost:"), (int32_t)lost);
+    Com::printF(PSTR("Planned lines:"), (int32_t)linesPlanned);
+    Com::printF(PSTR(" planner us:"), (int32_t)planningMicros);
+    Com::printF(PSTR(" max us:"), (int32_t)maxPlanningMicros);
+    if (planningMicros > 0) {
+        Com::printF(PSTR(" lines/s:"), 1000000.0f * static_cast<float>(linesPlanned) / static_cast<float>(planningMicros), 1);
+    }
+    Com::println();
+    Com::printF(PSTR("Recomputed lines:"), (int32_t)recomputedLines);
+    Com::printF(PSTR(" max per line:"), (int)maxRecomputedLines);
+    Com::printFLN(PSTR(" junctions:"), (int32_t)plannedJunctions);
+#if S_CURVE_ACCELERATION
+    Com::printF(PSTR("S-curve:"), (int)PrintLine::sCurveEnabled);
+    Com::printFLN(PSTR(" max jerk steps/s^3:"), maxSCurveJerk, 0);
+#endif
+    Com::printF(PSTR("Stepper calls:"), (int32_t)stepperCalls);
+    Com::printFLN(PSTR(" steps:"), (int32_t)stepsDone);
+#if USE_ADVANCE
+    Com::printF(PSTR("Extruder timer calls:"), (int32_t)extruderInterrupts);
+    Com::printFLN(PSTR(" E reversals:"), (int32_t)extruderReversals);
+#endif
+}
+
+/** Sends all buffered entries to the host and frees them. Each line contains
+time,steps,dir,loops,phase as decimal values. */
+void StepTimeline::sendEntries() {
+    uint16_t n = 0;
+    while (readPos != writePos) {
+        StepTimelineEntry e = entries[readPos]; // copy as interrupt may not overwrite it until readPos moves
+        uint16_t next = readPos + 1;
+        if (next >= STEP_TIMELINE_SIZE)
+            next = 0;
+        readPos = next;
+        Com::printF(PSTR("TL:"));
+        Com::printNumber(e.time);
+        Com::print(',');
+        Com::printNumber(e.steps >> 4);
+        Com::print(',');
+        Com::printNumber(e.dir);
+        Com::print(',');
+        Com::printNumber(e.loops);
+        Com::print(',');
+        Com::printNumber(e.phase);
+        Com::println();
+        if ((++n & 15) == 0)
+            GCode::keepAlive(Processing);
+    }
+    Com::printFLN(PSTR("TL:end "), (int32_t)lost);
+}
+#endif
+
+#ifdef DEBUG_ISR_PROFILE
+IsrCycleStats IsrProfile::stepper[ISR_BRANCHES];
+IsrCycleStats IsrProfile::pwm;
+volatile uint8_t IsrProfile::branch = ISR_BRANCH_IDLE;
+
+/** Sends the statistics of one branch. The copy is taken with interrupts
+disabled, so counters and histogram belong together. */
+static void reportIsrStats(FSTRINGPARAM(name), IsrCycleStats& stats) {
+    IsrCycleStats s;
+    {
+        InterruptProtectedBlock noInts;
+        s = stats;
+    }
+    Com::printF(name);
+    Com::printF(PSTR(" calls:"), (int32_t)s.count);
+    if (s.count) {
+        Com::printF(PSTR(" min:"), (int32_t)s.minCycles);
+        Com::printF(PSTR(" avg:"), (int32_t)s.average());
+        Com::printF(PSTR(" max:"), (int32_t)s.maxCycles);
+        Com::printF(PSTR(" hist:"));
+        for (uint8_t i = 0; i < ISR_PROFILE_BUCKETS; i++) {
+            if (s.histogram[i] == 0)
+                continue;
+            Com::print(' ');
+            Com::printNumber(IsrCycleStats::bucketStart(i));
+            Com::print('=');
+            Com::printNumber(s.histogram[i]);
+        }
+    }
+    Com::println();
+}
+
+void IsrProfile::report() {
+#if CPU_ARCH == ARCH_ARM
+    Com::printFLN(PSTR("ISR profile cycles/s:"), (int32_t)F_CPU_TRUE);
+#else
+    Com::printFLN(PSTR("ISR profile cycles/s:"), (int32_t)F_CPU);
+#endif
+    reportIsrStats(PSTR("Stepper accelerate"), stepper[ISR_BRANCH_ACCELERATE]);
+    reportIsrStats(PSTR("Stepper nominal"), stepper[ISR_BRANCH_NOMINAL]);
+    reportIsrStats(PSTR("Stepper decelerate"), stepper[ISR_BRANCH_DECELERATE]);
+    reportIsrStats(PSTR("Stepper new line"), stepper[ISR_BRANCH_NEW_LINE]);
+    reportIsrStats(PSTR("Stepper idle"), stepper[ISR_BRANCH_IDLE]);
+    reportIsrStats(PSTR("PWM"), pwm);
+}
+#endif
 
 /**
 Move printer the given number of steps. Puts the move into the queue. Used by e.g. homing commands.
@@ -288,9 +649,8 @@ void PrintLine::queueCartesianSegmentTo(uint8_t check_endstops, uint8_t pathOpti
 #if ENABLE_BACKLASH_COMPENSATION
     if ((p->isXYZMove()) && ((p->dir & XYZ_DIRPOS) ^ (Printer::backlashDir & XYZ_DIRPOS)) & (Printer::backlashDir >> 3)) { // We need to compensate backlash, add a move
         PrintLine::waitForXFreeLines(2);
-        uint8_t wpos2 = PrintLine::linesWritePos + 1;
-        if (wpos2 >= PRINTLINE_CACHE_SIZE)
-            wpos2 = 0;
+        ufast8_t wpos2 = PrintLine::linesWritePos;
+        PrintLine::nextPlannerIndex(wpos2);
         PrintLine* p2 = &PrintLine::lines[wpos2];
         memcpy(p2, p, sizeof(PrintLine)); // Move current data to p2
         uint8_t changed = (p->dir & XYZ_DIRPOS) ^ (Printer::backlashDir & XYZ_DIRPOS);
@@ -461,7 +821,11 @@ void PrintLine::queueCartesianMove(uint8_t check_endstops, uint8_t pathOptimize)
         p->setMoveOfAxis(E_AXIS);
     }
 
-    if (p->isNoMove()) {
+    if (p->isNoMove()
+#if ARC_IN_STEPPER
+        && arcRadius == 0 // a full circle ends where it starts, setupArc adds its steps
+#endif
+    ) {
         if (newPath) { // need to delete dummy elements, otherwise commands can get locked.
             resetPathPlanner();
         }
@@ -471,9 +835,8 @@ void PrintLine::queueCartesianMove(uint8_t check_endstops, uint8_t pathOptimize)
 #if ENABLE_BACKLASH_COMPENSATION
     if ((p->isXYZMove()) && ((p->dir & XYZ_DIRPOS) ^ (Printer::backlashDir & XYZ_DIRPOS)) & (Printer::backlashDir >> 3)) { // We need to compensate backlash, add a move
         waitForXFreeLines(2);
-        uint8_t wpos2 = linesWritePos + 1;
-        if (wpos2 >= PRINTLINE_CACHE_SIZE)
-            wpos2 = 0;
+        ufast8_t wpos2 = linesWritePos;
+        nextPlannerIndex(wpos2);
         PrintLine* p2 = &lines[wpos2];
         memcpy(p2, p, sizeof(PrintLine)); // Move current data to p2
         uint8_t changed = (p->dir & XYZ_DIRPOS) ^ (Printer::backlashDir & XYZ_DIRPOS);
@@ -530,6 +893,10 @@ void PrintLine::queueCartesianMove(uint8_t check_endstops, uint8_t pathOptimize)
     } else {
         p->distance = fabs(axisDistanceMM[E_AXIS]);
     }
+#if ARC_IN_STEPPER
+    if (arcRadius > 0 && !p->isZMove())
+        p->setupArc(axisDistanceMM);
+#endif
     if (p->distance == 0) {
         if (newPath) { // need to delete dummy elements, otherwise commands can get locked.
             resetPathPlanner();
@@ -543,17 +910,80 @@ void PrintLine::queueCartesianMove(uint8_t check_endstops, uint8_t pathOptimize)
         Printer::currentPositionTransformed[axis] = Printer::destinationPositionTransformed[axis];
     }
 }
+
+#if ARC_IN_STEPPER
+/**
+  Replaces the straight XY part of the line with the arc in arcRadius, arcStartAngle
+  and arcTravel. The primary axis steps once per rotation of the unit vector, the
+  rotation is small enough that X and Y need at most one step for it.
+*/
+void PrintLine::setupArc(float axisDistanceMM[]) {
+    const double unit = 1073741824.0; // 2^30
+    int32_t endX = Printer::destinationSteps[X_AXIS] - Printer::currentPositionSteps[X_AXIS];
+    int32_t endY = Printer::destinationSteps[Y_AXIS] - Printer::currentPositionSteps[Y_AXIS];
+    float endAngle = arcStartAngle + arcTravel;
+    arcPath.radiusX = lroundf(arcRadius * Printer::axisStepsPerMM[X_AXIS]);
+    arcPath.radiusY = lroundf(arcRadius * Printer::axisStepsPerMM[Y_AXIS]);
+    arcPath.startX = lround(cos(arcStartAngle) * unit);
+    arcPath.startY = lround(sin(arcStartAngle) * unit);
+    // Target not on the circle and rounded radius, the correction needs extra steps
+    float offsetX = fabs(endX - arcPath.radiusX * (cos(endAngle) - cos(arcStartAngle)));
+    float offsetY = fabs(endY - arcPath.radiusY * (sin(endAngle) - sin(arcStartAngle)));
+    int32_t n = static_cast<int32_t>(ceil(fabs(arcTravel) * RMath::max(arcPath.radiusX, arcPath.radiusY) + RMath::max(offsetX, offsetY))) + 2;
+    if (n < delta[E_AXIS])
+        n = delta[E_AXIS];
+    double phi = static_cast<double>(arcTravel) / n;
+    arcPath.cosStep = lround(cos(phi) * unit);
+    arcPath.sinStep = lround(sin(phi) * unit);
+    // Without correction the rounded rotation ends at this unit vector
+    double scale = pow(hypot(arcPath.cosStep, arcPath.sinStep) / unit, n) * hypot(arcPath.startX, arcPath.startY) / unit;
+    double angle = atan2(arcPath.startY, arcPath.startX) + n * atan2(arcPath.sinStep, arcPath.cosStep);
+    arcPath.correctionX = lround((endX - arcPath.radiusX * (scale * cos(angle) - arcPath.startX / unit)) * 16777216.0 / n);
+    arcPath.correctionY = lround((endY - arcPath.radiusY * (scale * sin(angle) - arcPath.startY / unit)) * 16777216.0 / n);
+    arcPath.endX = endX;
+    arcPath.endY = endY;
+    float sign = (arcTravel > 0 ? 1.0f : -1.0f);
+    arcPath.exitX = -sign * sin(endAngle);
+    arcPath.exitY = sign * cos(endAngle);
+    // Directions at the start, the stepper interrupt changes them on the way
+    dir &= ~(X_DIRPOS | Y_DIRPOS);
+    if (arcPath.sinStep > 0 ? arcPath.startY <= 0 : arcPath.startY >= 0)
+        dir |= X_DIRPOS;
+    if (arcPath.sinStep > 0 ? arcPath.startX >= 0 : arcPath.startX <= 0)
+        dir |= Y_DIRPOS;
+    setMoveOfAxis(X_AXIS);
+    setMoveOfAxis(Y_AXIS);
+    delta[X_AXIS] = delta[Y_AXIS] = n;
+    primaryAxis = (arcPath.radiusY > arcPath.radiusX ? Y_AXIS : X_AXIS);
+    stepsRemaining = n;
+    // Limit speed and acceleration of the path by the slower axis
+    axisDistanceMM[X_AXIS] = axisDistanceMM[Y_AXIS] = fabs(arcTravel) * arcRadius;
+    distance = RMath::max(axisDistanceMM[X_AXIS], axisDistanceMM[E_AXIS]);
+    flags |= FLAG_ARC;
+}
+#endif
 #endif
 
 void PrintLine::calculateMove(float axisDistanceMM[], uint8_t pathOptimize, fast8_t drivingAxis) {
     if (stepsRemaining == 0) { // need at least one step for bresenham
         return;
     }
+#ifdef DEBUG_STEP_TIMELINE
+    uint32_t planStartMicros = STEP_TIMELINE_MICROS();
+#endif
 #if NONLINEAR_SYSTEM
     long axisInterval[VIRTUAL_AXIS_ARRAY]; // shortest interval possible for that axis
 #else
     long axisInterval[E_AXIS_ARRAY];
 #endif
+#if ARC_SUPPORT
+    arcID = currentArcID;
+#endif
+    // Rounding can leave steps on an axis without distance, e.g. Z directly after homing.
+    // Give them the distance of their steps, the axis limits below divide by it.
+    for (fast8_t i = 0; i < E_AXIS_ARRAY; i++)
+        if (axisDistanceMM[i] == 0 && isMoveOfAxis(i))
+            axisDistanceMM[i] = delta[i] * Printer::invAxisStepsPerMM[i];
     //float timeForMove = (float)(F_CPU)*distance / (isXOrYMove() ? RMath::max(Printer::minimumSpeed, Printer::feedrate) : Printer::feedrate); // time is in ticks
     float timeForMove = (float)(F_CPU)*distance / Printer::feedrate; // time is in ticks
     //bool critical = Printer::isZProbingActive();
@@ -644,6 +1074,13 @@ void PrintLine::calculateMove(float axisDistanceMM[], uint8_t pathOptimize, fast
     axisInterval[VIRTUAL_AXIS] = limitInterval; //timeForMove/stepsRemaining;
 #endif
     fullSpeed = distance * inverseTimeS;
+#if ARC_IN_STEPPER
+    if (flags & FLAG_ARC) { // axis speeds in the direction at the start of the arc
+        float xySpeed = axisDistanceMM[X_AXIS] * inverseTimeS / (arcPath.sinStep > 0 ? 1073741824.0f : -1073741824.0f);
+        speedX = -xySpeed * arcPath.startY;
+        speedY = xySpeed * arcPath.startX;
+    }
+#endif
     //long interval = axis_interval[primary_axis]; // time for every step in ticks with full speed
     //If acceleration is enabled, do some Bresenham calculations depending on which axis will lead it.
 #if RAMP_ACCELERATION
@@ -675,6 +1112,44 @@ void PrintLine::calculateMove(float axisDistanceMM[], uint8_t pathOptimize, fast
             slowestAxisPlateauTimeRepro = RMath::min(slowestAxisPlateauTimeRepro, (float)axisInterval[i] * (float)accel[i]); //  steps/s^2 * step/tick  Ticks/s^2
     }
 
+#if INPUT_SHAPING
+    // Shape the ramps with the shaper of the moving axis, diagonal moves with both shapers convolved.
+    // Ramps can not be longer than the line, so lines shorter than the shaper duration at full
+    // speed stay unshaped and use the reduced acceleration for unshaped ramps.
+    shaper = NULL;
+    shapeSpeed = 0;
+    if (isXOrYMove()) {
+        InputShaper* s;
+        bool bothAxes = speedX != 0 && speedY != 0;
+#if ARC_IN_STEPPER
+        bothAxes |= (flags & FLAG_ARC) != 0;
+#endif
+        if (bothAxes && InputShaper::combined.impulses)
+            s = &InputShaper::combined;
+        else
+            s = &InputShaper::axis[speedX != 0 && InputShaper::axis[X_AXIS].impulses ? X_AXIS : Y_AXIS];
+        if (s->impulses) {
+            if (distance >= fullSpeed * s->planDuration) {
+                shaper = s;
+                shapeSpeed = slowestAxisPlateauTimeRepro * fullSpeed / static_cast<float>(F_CPU) * s->planDuration; // acceleration * duration
+            } else
+                slowestAxisPlateauTimeRepro *= static_cast<float>(INPUT_SHAPING_UNSHAPED_ACCELERATION) * 0.01f;
+        }
+    }
+#endif
+#if S_CURVE_ACCELERATION
+    // S-curve ramps peak at 1.5 times their mean acceleration. Plan them with 2/3 of
+    // the allowed acceleration, so the peak does not exceed the configured limits.
+    if (sCurveEnabled
+#if INPUT_SHAPING
+        && shaper == NULL
+#endif
+    ) {
+        flags |= FLAG_S_CURVE;
+        slowestAxisPlateauTimeRepro *= 2.0f / 3.0f;
+    }
+#endif
+
     // Errors for delta move are initialized in timer (except extruder)
 #if !NONLINEAR_SYSTEM
     error[X_AXIS] = error[Y_AXIS] = error[Z_AXIS] = error[E_AXIS] = delta[primaryAxis] >> 1;
@@ -687,11 +1162,21 @@ void PrintLine::calculateMove(float axisDistanceMM[], uint8_t pathOptimize, fast
     //Now we can calculate the new primary axis acceleration, so that the slowest axis max acceleration is not violated
     fAcceleration = 262144.0 * (float)accelerationPrim / F_CPU;                                        // will overflow without float!
     accelerationDistance2 = 2.0 * distance * slowestAxisPlateauTimeRepro * fullSpeed / ((float)F_CPU); // mm^2/s^2
+#if JUNCTION_DEVIATION
+    // Direction and corner speed scale for computeMaxJunctionSpeed, so joining
+    // lines needs no square root.
+    if (isXOrYMove()) {
+        float xySpeed = sqrt(speedX * speedX + speedY * speedY);
+        unitX = speedX / xySpeed;
+        unitY = speedY / xySpeed;
+        junctionScale = sqrt(slowestAxisPlateauTimeRepro * fullSpeed / static_cast<float>(F_CPU) * JUNCTION_DEVIATION_MM);
+    }
+#endif
     startSpeed = endSpeed = minSpeed = safeSpeed(drivingAxis);
     if (startSpeed > Printer::feedrate)
         startSpeed = endSpeed = minSpeed = Printer::feedrate;
     // Can accelerate to full speed within the line
-    if (startSpeed * startSpeed + accelerationDistance2 >= fullSpeed * fullSpeed)
+    if (reachableSpeed(startSpeed) >= fullSpeed)
         setNominalMove();
 
     vMax = F_CPU / fullInterval; // maximum steps per second, we can reach
@@ -752,6 +1237,9 @@ void PrintLine::calculateMove(float axisDistanceMM[], uint8_t pathOptimize, fast
         Com::printFLN(Com::tDBGCommandedFeedrate, Printer::feedrate);
         Com::printFLN(Com::tDBGConstFullSpeedMoveTime, timeForMove);
     }
+#endif
+#ifdef DEBUG_STEP_TIMELINE
+    StepTimeline::linePlanned(planStartMicros);
 #endif
     // Make result permanent
     if (pathOptimize)
@@ -793,10 +1281,20 @@ void PrintLine::updateTrapezoids() {
         timeleft += lines[maxfirst].timeInTicks;
         nextPlannerIndex(maxfirst);
     }
-    // Search last fixed element
-    while (first != maxfirst && !lines[first].isEndSpeedFixed())
+    // Search last fixed element, but never go back more than PLANNER_MAX_WINDOW
+    // lines so planning time stays bounded with large move caches.
+    ufast8_t window = PLANNER_MAX_WINDOW;
+    while (first != maxfirst && !lines[first].isEndSpeedFixed() && --window)
         previousPlannerIndex(first);
-    if (first != linesWritePos && lines[first].isEndSpeedFixed())
+    if (window == 0) {
+        // Window exhausted: freeze the plan in front of first. Its start speed is
+        // reachable but later lines can not raise it any more, so long runs of very
+        // short lines may plan slower than a pass over the whole cache.
+        ufast8_t previousIndex = first;
+        previousPlannerIndex(previousIndex);
+        lines[previousIndex].setEndSpeedFixed(true);
+        lines[first].setStartSpeedFixed(true);
+    } else if (first != linesWritePos && lines[first].isEndSpeedFixed())
         nextPlannerIndex(first);
     // now first points to last segment before the end speed is fixed
     // so start speed is also fixed.
@@ -842,9 +1340,9 @@ void PrintLine::updateTrapezoids() {
         computeMaxJunctionSpeed(previous, act); // Set maximum junction speed if we have a real move before
     }
     // Increase speed if possible neglecting current speed
-    backwardPlanner(linesWritePos, first);
+    ufast8_t changedFrom = backwardPlanner(linesWritePos, first);
     // Reduce speed to reachable speeds
-    forwardPlanner(first);
+    forwardPlanner(changedFrom);
 
 #ifdef DEBUG_PLANNER
     if (Printer::debugEcho()) {
@@ -858,7 +1356,14 @@ void PrintLine::updateTrapezoids() {
     }
 #endif
     // Update precomputed data
+#ifdef DEBUG_STEP_TIMELINE
+    uint16_t recomputed = 1; // act is always new
+#endif
     do {
+#ifdef DEBUG_STEP_TIMELINE
+        if (!lines[first].areParameterUpToDate())
+            recomputed++;
+#endif
         lines[first].updateStepsParameter();
 #ifdef DEBUG_PLANNER
         if (Printer::debugEcho()) {
@@ -879,6 +1384,9 @@ void PrintLine::updateTrapezoids() {
     } while (first != linesWritePos);
     act->updateStepsParameter();
     act->unblock();
+#ifdef DEBUG_STEP_TIMELINE
+    StepTimeline::linesRecomputed(recomputed);
+#endif
 #ifdef DEBUG_PLANNER
     if (Printer::debugEcho()) {
         Com::printF(PSTR(" / "), lines[first].startSpeed, 1);
@@ -915,6 +1423,38 @@ Speed from 100 to 200
 180°:   300               200        400
 
 */
+#if JUNCTION_DEVIATION
+/* sqrt(q^2 + q*sqrt(1 + q^2)) for q = 0, 1/8 .. 1, the corner speed factor for
+   direction changes above 90 degree. */
+const float junctionReverseTable[9] PROGMEM = { 0, 0.37629, 0.56586, 0.73561, 0.89945, 1.06191, 1.22474, 1.38863, 1.55377 };
+
+/** Corner speed for a junction deviation of 1 mm and an acceleration of 1 mm/s^2.
+
+A circle that touches both lines at distance JUNCTION_DEVIATION_MM from the corner has radius
+r = d*h/(1-h) with h = cos(angle/2), so the speed is sqrt(a*r) = sqrt(a*d)*sqrt(h/(1-h)).
+With t = tan(angle/2) = sin/(1+cos) this is sqrt(1+sqrt(1+t^2))/t. The numerator is smooth, so
+a quadratic in t^2 that is exact for 0 and 90 degree approximates it within 0.1%. Above 90 degree
+q = 1/t is interpolated from junctionReverseTable, which errs to the slower side.
+\param cosAngle Cosine of the direction change.
+\param sinAngle Sine of the direction change, not negative.
+*/
+float PrintLine::junctionDeviationFactor(float cosAngle, float sinAngle) {
+    if (cosAngle >= 0) {
+        float t = sinAngle / (1.0f + cosAngle);
+        if (t < 0.0001f)
+            return 1e6; // straight line, no limit
+        float t2 = t * t;
+        return (1.41421f + t2 * (0.17678f - 0.03722f * t2)) / t;
+    }
+    float q = (sinAngle > 0.0001f ? 8.0f * (1.0f + cosAngle) / sinAngle : 0);
+    if (q >= 8.0f)
+        return pgm_read_float(&junctionReverseTable[8]);
+    uint8_t i = static_cast<uint8_t>(q);
+    float lower = pgm_read_float(&junctionReverseTable[i]);
+    return lower + (q - i) * (pgm_read_float(&junctionReverseTable[i + 1]) - lower);
+}
+#endif
+
 inline void PrintLine::computeMaxJunctionSpeed(PrintLine* previous, PrintLine* current) {
 #if NONLINEAR_SYSTEM
     /*  if (previous->moveID == current->moveID)   // Avoid computing junction speed for split nonlinear lines
@@ -940,6 +1480,14 @@ inline void PrintLine::computeMaxJunctionSpeed(PrintLine* previous, PrintLine* c
         }
     }
 #endif // USE_ADVANCE
+#if ARC_SUPPORT
+    // Chords of one arc meet at the same angle, arc() computed the speed that keeps
+    // this direction change within the jerk limit.
+    if (current->arcID != 0 && previous->arcID == current->arcID) {
+        previous->maxJunctionSpeed = RMath::min(arcJunctionSpeed, RMath::min(current->fullSpeed, previous->fullSpeed));
+        return;
+    }
+#endif
     // if we are here we have to identical move types
     // either pure extrusion -> pure extrusion or
     // move -> move (with or without extrusion)
@@ -951,21 +1499,47 @@ inline void PrintLine::computeMaxJunctionSpeed(PrintLine* previous, PrintLine* c
         lengthFactor = static_cast<float>(MAX_JERK_DISTANCE * MAX_JERK_DISTANCE) / (previous->distance * previous->distance);
 #endif
     float maxJoinSpeed = RMath::min(current->fullSpeed, previous->fullSpeed);
+    float previousSpeedX = previous->speedX;
+    float previousSpeedY = previous->speedY;
+#if JUNCTION_DEVIATION
+    float previousUnitX = previous->unitX;
+    float previousUnitY = previous->unitY;
+#endif
+#if ARC_IN_STEPPER
+    if (previous->flags & FLAG_ARC) { // speeds are in the direction at the start of the arc
+        float xySpeed = sqrt(previousSpeedX * previousSpeedX + previousSpeedY * previousSpeedY);
+        previousSpeedX = previous->arcPath.exitX * xySpeed;
+        previousSpeedY = previous->arcPath.exitY * xySpeed;
+#if JUNCTION_DEVIATION
+        previousUnitX = previous->arcPath.exitX;
+        previousUnitY = previous->arcPath.exitY;
+#endif
+    }
+#endif
+#if JUNCTION_DEVIATION
+    if (previous->isXOrYMove() && current->isXOrYMove()) {
+        float cosAngle = previousUnitX * current->unitX + previousUnitY * current->unitY;
+        float sinAngle = fabs(previousUnitX * current->unitY - previousUnitY * current->unitX);
+        float cornerSpeed = RMath::min(previous->junctionScale, current->junctionScale) * junctionDeviationFactor(cosAngle, sinAngle);
+        if (cornerSpeed < maxJoinSpeed)
+            factor = cornerSpeed / maxJoinSpeed;
+    } else {
+#endif
 #if (DRIVE_SYSTEM == DELTA) // No point computing Z Jerk separately for delta moves
 #ifdef ALTERNATIVE_JERK
-    float jerk = maxJoinSpeed * lengthFactor * (1.0 - (current->speedX * previous->speedX + current->speedY * previous->speedY + current->speedZ * previous->speedZ) / (current->fullSpeed * previous->fullSpeed));
+    float jerk = maxJoinSpeed * lengthFactor * (1.0 - (current->speedX * previousSpeedX + current->speedY * previousSpeedY + current->speedZ * previous->speedZ) / (current->fullSpeed * previous->fullSpeed));
 #else
-    float dx = current->speedX - previous->speedX;
-    float dy = current->speedY - previous->speedY;
+    float dx = current->speedX - previousSpeedX;
+    float dy = current->speedY - previousSpeedY;
     float dz = current->speedZ - previous->speedZ;
     float jerk = sqrt(dx * dx + dy * dy + dz * dz) * lengthFactor;
 #endif // ALTERNATIVE_JERK
 #else  // DELTA
 #ifdef ALTERNATIVE_JERK
-    float jerk = maxJoinSpeed * lengthFactor * (1.0 - (current->speedX * previous->speedX + current->speedY * previous->speedY + current->speedZ * previous->speedZ) / (current->fullSpeed * previous->fullSpeed));
+    float jerk = maxJoinSpeed * lengthFactor * (1.0 - (current->speedX * previousSpeedX + current->speedY * previousSpeedY + current->speedZ * previous->speedZ) / (current->fullSpeed * previous->fullSpeed));
 #else
-    float dx = current->speedX - previous->speedX;
-    float dy = current->speedY - previous->speedY;
+    float dx = current->speedX - previousSpeedX;
+    float dy = current->speedY - previousSpeedY;
     float jerk = sqrt(dx * dx + dy * dy) * lengthFactor;
 #endif // ALTERNATIVE_JERK
 #endif // DELTA
@@ -974,6 +1548,9 @@ inline void PrintLine::computeMaxJunctionSpeed(PrintLine* previous, PrintLine* c
         if (factor * maxJoinSpeed * 2.0 < Printer::maxJerk)
             factor = Printer::maxJerk / (2.0 * maxJoinSpeed);
     }
+#if JUNCTION_DEVIATION
+    }
+#endif
 #if DRIVE_SYSTEM != DELTA
     if ((previous->dir | current->dir) & ZSTEP) {
         float dz = fabs(current->speedZ - previous->speedZ);
@@ -1040,6 +1617,53 @@ void PrintLine::updateStepsParameter() {
         accelSteps = accelSteps - RMath::min(static_cast<int32_t>(accelSteps), static_cast<int32_t>(red));
         decelSteps = decelSteps - RMath::min(static_cast<int32_t>(decelSteps), static_cast<int32_t>(red));
     }
+#if INPUT_SHAPING
+    if (shaper != NULL) {
+        // A shaped ramp from v0 to v1 needs v0*centroid + v1*(duration-centroid) steps more
+        float a2 = 2.0f * static_cast<float>(accelerationPrim);
+        float c = shaper->centroid, cRest = shaper->duration - c;
+        float v0 = vStart, v1 = vEnd, top = vMax;
+        float up = (top * top - v0 * v0) / a2 + v0 * c + top * cRest;
+        float down = (top * top - v1 * v1) / a2 + top * c + v1 * cRest;
+        if (up + down > stepsRemaining) { // no plateau, solve up + down = stepsRemaining for top
+            float q = v0 * c + v1 * cRest - (v0 * v0 + v1 * v1) / a2 - stepsRemaining;
+            float halfA = 0.5f * a2;
+            top = 0.5f * halfA * (sqrt(shaper->duration * shaper->duration - 4.0f * q / halfA) - shaper->duration);
+            top = RMath::max(top, RMath::max(v0, v1));
+            up = (top * top - v0 * v0) / a2 + v0 * c + top * cRest;
+            down = (top * top - v1 * v1) / a2 + top * c + v1 * cRest;
+        }
+        accelSteps = (vStart >= top ? 0 : static_cast<uint32_t>(up) + 1);
+        decelSteps = (vEnd >= top ? 0 : RMath::min(static_cast<int32_t>(down) + 1, stepsRemaining));
+        shapedAccel.init(vStart, top, accelerationPrim);
+        shapedDecel.init(top, vEnd, accelerationPrim);
+    }
+#endif
+#if S_CURVE_ACCELERATION
+    if (flags & FLAG_S_CURVE) { // set by calculateMove
+        // Speed reached at the end of the ramps, lower then vMax if there is no plateau
+        float v2 = 2.0f * static_cast<float>(accelerationPrim);
+        float top = RMath::min(sqrt(static_cast<float>(vStart) * vStart + v2 * accelSteps), static_cast<float>(vMax));
+        sCurveAccel.init(vStart, top, accelerationPrim);
+        top = RMath::min(sqrt(static_cast<float>(vEnd) * vEnd + v2 * decelSteps), static_cast<float>(vMax));
+        sCurveDecel.init(top, vEnd, accelerationPrim);
+    }
+#endif
+#if STEP_TIMING_TABLE
+    flags &= ~FLAG_RAMP_TABLE;
+    if (!(flags & FLAG_S_CURVE) && vStart >= RAMP_TABLE_MIN_SPEED && vEnd >= RAMP_TABLE_MIN_SPEED
+#if INPUT_SHAPING
+        && shaper == NULL
+#endif
+#if USE_ADVANCE
+        && advanceL == 0
+#if ENABLE_QUADRATIC_ADVANCE
+        && advanceFull == 0
+#endif
+#endif
+    )
+        flags |= FLAG_RAMP_TABLE;
+#endif
     setParameterUpToDate();
 #ifdef DEBUG_QUEUE_MOVE
     if (false && Printer::debugEcho()) {
@@ -1065,7 +1689,12 @@ The backwards planner traverses the moves from last to first looking at decelera
 start = last line inserted
 last = last element until we check
 */
-inline void PrintLine::backwardPlanner(ufast8_t start, ufast8_t last) {
+/** Increases the speeds from the new line backwards as far as the stored deceleration allows.
+With PLANNER_EARLY_STOP it stops at the first junction where nothing changes and keeps the speeds
+of the last update for all lines before it. That gives the same profile only up to float rounding,
+make bench-planner in src/Simulator shows the step differences and the planned junctions.
+Returns the index of the first line whose start speed may have changed. */
+inline ufast8_t PrintLine::backwardPlanner(ufast8_t start, ufast8_t last) {
     PrintLine *act = &lines[start], *previous;
     float lastJunctionSpeed = act->endSpeed; // Start always with safe speed
 
@@ -1074,6 +1703,9 @@ inline void PrintLine::backwardPlanner(ufast8_t start, ufast8_t last) {
         previousPlannerIndex(start);
         previous = &lines[start];
         previous->block();
+#ifdef DEBUG_STEP_TIMELINE
+        StepTimeline::plannedJunctions++;
+#endif
         // Avoid speed calculation once cruising in split delta move
 #if NONLINEAR_SYSTEM
         /*if (previous->moveID == act->moveID && lastJunctionSpeed == previous->maxJunctionSpeed)
@@ -1091,29 +1723,43 @@ inline void PrintLine::backwardPlanner(ufast8_t start, ufast8_t last) {
          }*/
 
         // Avoid speed calculations if we know we can accelerate within the line
-        lastJunctionSpeed = (act->isNominalMove() ? act->fullSpeed : sqrt(lastJunctionSpeed * lastJunctionSpeed + act->accelerationDistance2)); // acceleration is acceleration*distance*2! What can be reached if we try?
+        lastJunctionSpeed = (act->isNominalMove() ? act->fullSpeed : act->reachableSpeed(lastJunctionSpeed)); // acceleration is acceleration*distance*2! What can be reached if we try?
         // If that speed is more that the maximum junction speed allowed then ...
         if (lastJunctionSpeed >= previous->maxJunctionSpeed) { // Limit is reached
+            bool changed = false;
             // If the previous line's end speed has not been updated to maximum speed then do it now
             if (previous->endSpeed != previous->maxJunctionSpeed) {
                 previous->invalidateParameter();                                                 // Needs recomputation
                 previous->endSpeed = RMath::max(previous->minSpeed, previous->maxJunctionSpeed); // possibly unneeded???
+                changed = true;
             }
             // If actual line start speed has not been updated to maximum speed then do it now
             if (act->startSpeed != previous->maxJunctionSpeed) {
                 act->startSpeed = RMath::max(act->minSpeed, previous->maxJunctionSpeed); // possibly unneeded???
                 act->invalidateParameter();
+                changed = true;
+            }
+            if (!changed && PLANNER_EARLY_STOP) { // Junction unchanged, so everything left from here is still optimal
+                nextPlannerIndex(start);
+                return start;
             }
             lastJunctionSpeed = previous->endSpeed;
         } else {
             // Block previous end and act start as calculated speed and recalculate plateau speeds (which could move the speed higher again)
-            act->startSpeed = RMath::max(act->minSpeed, lastJunctionSpeed);
-            lastJunctionSpeed = previous->endSpeed = RMath::max(lastJunctionSpeed, previous->minSpeed);
+            float newStartSpeed = RMath::max(act->minSpeed, lastJunctionSpeed);
+            float newEndSpeed = RMath::max(lastJunctionSpeed, previous->minSpeed);
+            if (PLANNER_EARLY_STOP && act->startSpeed == newStartSpeed && previous->endSpeed == newEndSpeed) { // Junction unchanged
+                nextPlannerIndex(start);
+                return start;
+            }
+            act->startSpeed = newStartSpeed;
+            lastJunctionSpeed = previous->endSpeed = newEndSpeed;
             previous->invalidateParameter();
             act->invalidateParameter();
         }
         act = previous;
     } // while loop
+    return last;
 }
 
 void PrintLine::forwardPlanner(ufast8_t first) {
@@ -1142,11 +1788,14 @@ void PrintLine::forwardPlanner(ufast8_t first) {
                 }*/
 #endif
         // Avoid speed calculates if we know we can accelerate within the line.
-        vmaxRight = (act->isNominalMove() ? act->fullSpeed : sqrt(leftSpeed * leftSpeed + act->accelerationDistance2));
+        vmaxRight = (act->isNominalMove() ? act->fullSpeed : act->reachableSpeed(leftSpeed));
+        float oldStartSpeed = act->startSpeed;
+        float oldEndSpeed = act->endSpeed;
+        float oldNextStartSpeed = next->startSpeed;
         if (vmaxRight > act->endSpeed) { // Could be higher next run?
             if (leftSpeed < act->minSpeed) {
                 leftSpeed = act->minSpeed;
-                act->endSpeed = sqrt(leftSpeed * leftSpeed + act->accelerationDistance2);
+                act->endSpeed = act->reachableSpeed(leftSpeed);
             }
             act->startSpeed = leftSpeed;
             next->startSpeed = leftSpeed = RMath::max(RMath::min(act->endSpeed, act->maxJunctionSpeed), next->minSpeed);
@@ -1154,19 +1803,22 @@ void PrintLine::forwardPlanner(ufast8_t first) {
                 act->setEndSpeedFixed(true);
                 next->setStartSpeedFixed(true);
             }
-            act->invalidateParameter();
         } else { // We can accelerate full speed without reaching limit, which is as fast as possible. Fix it!
             act->fixStartAndEndSpeed();
-            act->invalidateParameter();
             if (act->minSpeed > leftSpeed) {
                 leftSpeed = act->minSpeed;
-                vmaxRight = sqrt(leftSpeed * leftSpeed + act->accelerationDistance2);
+                vmaxRight = act->reachableSpeed(leftSpeed);
             }
             act->startSpeed = leftSpeed;
             act->endSpeed = RMath::max(act->minSpeed, vmaxRight);
             next->startSpeed = leftSpeed = RMath::max(RMath::min(act->endSpeed, act->maxJunctionSpeed), next->minSpeed);
             next->setStartSpeedFixed(true);
         }
+        // Only lines with changed speeds need new step parameter
+        if (act->startSpeed != oldStartSpeed || act->endSpeed != oldEndSpeed)
+            act->invalidateParameter();
+        if (next->startSpeed != oldNextStartSpeed)
+            next->invalidateParameter();
     }                                                         // While
     next->startSpeed = RMath::max(next->minSpeed, leftSpeed); // This is the new segment, which is updated anyway, no extra flag needed.
 }
@@ -1224,6 +1876,9 @@ uint8_t PrintLine::insertWaitMovesIfNeeded(uint8_t pathOptimize, uint8_t waitExt
             p->joinFlags = FLAG_JOIN_STEPPARAMS_COMPUTED | FLAG_JOIN_END_FIXED | FLAG_JOIN_START_FIXED;
             p->dir = 0;
             p->setWaitForXLinesFilled(w + waitExtraLines);
+#if ARC_SUPPORT
+            p->arcID = 0;
+#endif
 #if NONLINEAR_SYSTEM
             p->setWaitTicks(300000);
             p->moveID = lastMoveID++;
@@ -1271,12 +1926,29 @@ void PrintLine::logLine() {
 }
 
 void PrintLine::waitForXFreeLines(uint8_t b, bool allowMoves) {
-    while (getLinesCount() + b > PRINTLINE_CACHE_SIZE) { // wait for a free entry in movement cache
-        //GCode::readFromSerial();
+    while (getLinesCount() + b > PRINTLINE_CACHE_LINES) { // wait for a free entry in movement cache
+#if GCODE_BUFFER_SIZE > 1
+        GCode::readAhead(); // parse next commands while waiting, they execute after the current one
+#endif
         Commands::checkForPeriodicalActions(allowMoves);
     }
 }
 
+/** Number of moves like the last G0-G3 that still fit into the move cache
+without waiting. Delta moves and arcs need several lines each. */
+uint16_t PrintLine::freeMoves() {
+    uint16_t moves = (PRINTLINE_CACHE_LINES - getLinesCount()) / linesPerMove;
+#if NONLINEAR_SEGMENT_POOL
+    if (segmentsPerMove > 0) {
+        InterruptProtectedBlock noInts;
+        uint16_t freeSegments = NONLINEAR_SEGMENT_POOL - segmentPoolUsed;
+        noInts.unprotect();
+        moves = RMath::min(moves, static_cast<uint16_t>(freeSegments / segmentsPerMove));
+    }
+#endif
+    return moves;
+}
+
 #ifdef FAST_COREXYZ
 uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t corePosSteps[]) {
 #if DRIVE_SYSTEM == XY_GANTRY
@@ -1323,26 +1995,48 @@ uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t
    SHOWS(cartesianPosSteps[Y_AXIS]); \
    SHOW(Printer::deltaDiagonalStepsSquaredA.l);  return 0; }
    */
-/**
-  Calculate the delta tower position from a Cartesian position
-  @param cartesianPosSteps Array containing Cartesian coordinates.
-  @param deltaPosSteps Result array with tower coordinates.
-  @returns 1 if Cartesian coordinates have a valid delta tower position 0 if not.
-*/
-uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t deltaPosSteps[]) {
-    int32_t zSteps = cartesianPosSteps[Z_AXIS];
+
+/** Z position used for the tower heights, including distortion correction. */
+static inline int32_t deltaZSteps(int32_t cartesianPosSteps[]) {
 #if DISTORTION_CORRECTION
     static int cnt = 0;
     static int32_t lastZSteps = 9999999;
     static int32_t lastZCorrection = 0;
     cnt++;
-    if (cnt >= DISTORTION_UPDATE_FREQUENCY || lastZSteps != zSteps) {
+    if (cnt >= DISTORTION_UPDATE_FREQUENCY || lastZSteps != cartesianPosSteps[Z_AXIS]) {
         cnt = 0;
-        lastZSteps = zSteps;
+        lastZSteps = cartesianPosSteps[Z_AXIS];
         lastZCorrection = Printer::distortion.correct(cartesianPosSteps[X_AXIS], cartesianPosSteps[Y_AXIS], cartesianPosSteps[Z_AXIS]);
     }
-    zSteps += lastZCorrection;
+    return cartesianPosSteps[Z_AXIS] + lastZCorrection;
+#else
+    return cartesianPosSteps[Z_AXIS];
 #endif
+}
+
+/** Square root rounded to the nearest integer for the 32 bit tower math. */
+static inline uint32_t deltaSqrt(uint32_t x) {
+#if CPU_ARCH == ARCH_AVR
+    return HAL::integerSqrt(x);
+#else
+    // Float estimate is off by at most one, correct it with integer math
+    uint32_t r = static_cast<uint32_t>(sqrtf(static_cast<float>(x)) + 0.5f);
+    if (x > r * r + r)
+        r++;
+    else if (r > 0 && x <= r * r - r)
+        r--;
+    return r;
+#endif
+}
+
+/**
+  Calculate the delta tower position from a Cartesian position
+  @param cartesianPosSteps Array containing Cartesian coordinates.
+  @param deltaPosSteps Result array with tower coordinates.
+  @returns 1 if Cartesian coordinates have a valid delta tower position 0 if not.
+*/
+uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t deltaPosSteps[]) {
+    int32_t zSteps = deltaZSteps(cartesianPosSteps);
     if (Printer::isLargeMachine()) {
 #ifdef SUPPORT_64_BIT_MATH
         // 64 bit is better for precision, so we use that if available.
@@ -1458,7 +2152,7 @@ uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t
         if (opt < temp)
             RETURN_0("Apos x square ");
 
-        deltaPosSteps[A_TOWER] = SQRT(opt - temp) + zSteps;
+        deltaPosSteps[A_TOWER] = deltaSqrt(opt - temp) + zSteps;
         if (deltaPosSteps[A_TOWER] < Printer::deltaFloorSafetyMarginSteps && !Printer::isZProbingActive())
             RETURN_0("A hit floor");
 
@@ -1480,7 +2174,7 @@ uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t
         if (opt < temp)
             RETURN_0("Bpos x square ");
 
-        deltaPosSteps[B_TOWER] = SQRT(opt - temp) + zSteps;
+        deltaPosSteps[B_TOWER] = deltaSqrt(opt - temp) + zSteps;
         if (deltaPosSteps[B_TOWER] < Printer::deltaFloorSafetyMarginSteps && !Printer::isZProbingActive())
             RETURN_0("B hit floor");
 
@@ -1502,7 +2196,7 @@ uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t
         if (opt < temp)
             RETURN_0("Cpos x square ");
 
-        deltaPosSteps[C_TOWER] = SQRT(opt - temp) + zSteps;
+        deltaPosSteps[C_TOWER] = deltaSqrt(opt - temp) + zSteps;
         if (deltaPosSteps[C_TOWER] < Printer::deltaFloorSafetyMarginSteps && !Printer::isZProbingActive())
             RETURN_0("C hit floor");
         /*
@@ -1544,6 +2238,124 @@ uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t
     }
     return 1;
 }
+
+/** Tower positions for machines using 32 bit math, see
+transformCartesianStepsToDeltaStepsBatch. Tower constants are read once and
+squares use 16 bit multiplications. */
+static uint8_t transformSmallDeltaBatch(int32_t posSteps[][Z_AXIS_ARRAY], uint8_t count) {
+    uint8_t n;
+    const uint32_t LIMIT = 65534; // Largest squarable int without overflow;
+    const int32_t towerX[TOWER_ARRAY] = { Printer::deltaAPosXSteps, Printer::deltaBPosXSteps, Printer::deltaCPosXSteps };
+    const int32_t towerY[TOWER_ARRAY] = { Printer::deltaAPosYSteps, Printer::deltaBPosYSteps, Printer::deltaCPosYSteps };
+    const uint32_t diagonal2[TOWER_ARRAY] = { Printer::deltaDiagonalStepsSquaredA.l, Printer::deltaDiagonalStepsSquaredB.l, Printer::deltaDiagonalStepsSquaredC.l };
+    const bool checkFloor = !Printer::isZProbingActive();
+    int32_t towerSteps[TOWER_ARRAY];
+    for (n = 0; n < count; n++) {
+        int32_t* pos = posSteps[n];
+        int32_t zSteps = deltaZSteps(pos);
+        for (fast8_t t = 0; t < TOWER_ARRAY; t++) {
+            uint32_t dy = RMath::absLong(towerY[t] - pos[Y_AXIS]);
+            uint32_t dx = RMath::absLong(towerX[t] - pos[X_AXIS]);
+            if (dx > LIMIT || dy > LIMIT)
+                return n;
+            uint32_t opt = diagonal2[t];
+            uint32_t temp = HAL::U16SquaredToU32(dy);
+            if (opt < temp)
+                return n;
+            opt -= temp;
+            temp = HAL::U16SquaredToU32(dx);
+            if (opt < temp)
+                return n;
+            towerSteps[t] = deltaSqrt(opt - temp) + zSteps;
+            if (checkFloor && towerSteps[t] < Printer::deltaFloorSafetyMarginSteps)
+                return n;
+        }
+        pos[A_TOWER] = towerSteps[A_TOWER];
+        pos[B_TOWER] = towerSteps[B_TOWER];
+        pos[C_TOWER] = towerSteps[C_TOWER];
+    }
+    return count;
+}
+
+#if DELTA_SEGMENT_TOLERANCE > 0
+static float deltaDiagonalSquared(const floatLong& diagonal) {
+    if (!Printer::isLargeMachine())
+        return static_cast<float>(diagonal.l);
+#ifdef SUPPORT_64_BIT_MATH
+    return static_cast<float>(diagonal.L);
+#else
+    return diagonal.f;
+#endif
+}
+
+/**
+  Number of sub segments for the move from Printer::currentPositionSteps to
+  Printer::destinationSteps, so that moving the towers linear inside a segment
+  moves the effector less then DELTA_SEGMENT_TOLERANCE micrometer away from the
+  straight path.
+
+  A segment of length l bends the effector path by l^2/8 times its curvature,
+  which is the second derivative of the carriage heights along the move mapped
+  to the effector with the inverse Jacobian of the towers. The curvature grows
+  fast towards the reach limit, where the rods get flat, so it is taken at both
+  ends of the move, at the quarters and at the middle and the largest value
+  decides. The count never exceeds the segments per second limit for the move,
+  but towers never move more then about 32000 steps per segment to keep
+  deltaSteps in range.
+  @param maxSegments Segments from the segments per second setting.
+*/
+static int32_t deltaSegmentCount(int32_t maxSegments) {
+    const float towerX[TOWER_ARRAY] = { static_cast<float>(Printer::deltaAPosXSteps), static_cast<float>(Printer::deltaBPosXSteps), static_cast<float>(Printer::deltaCPosXSteps) };
+    const float towerY[TOWER_ARRAY] = { static_cast<float>(Printer::deltaAPosYSteps), static_cast<float>(Printer::deltaBPosYSteps), static_cast<float>(Printer::deltaCPosYSteps) };
+    const float diagonal2[TOWER_ARRAY] = { deltaDiagonalSquared(Printer::deltaDiagonalStepsSquaredA), deltaDiagonalSquared(Printer::deltaDiagonalStepsSquaredB), deltaDiagonalSquared(Printer::deltaDiagonalStepsSquaredC) };
+    float x0 = static_cast<float>(Printer::currentPositionSteps[X_AXIS]);
+    float y0 = static_cast<float>(Printer::currentPositionSteps[Y_AXIS]);
+    float ux = static_cast<float>(Printer::destinationSteps[X_AXIS] - Printer::currentPositionSteps[X_AXIS]);
+    float uy = static_cast<float>(Printer::destinationSteps[Y_AXIS] - Printer::currentPositionSteps[Y_AXIS]);
+    float uu = ux * ux + uy * uy;
+    float curvature = 0, travel = 0;
+    float lastH[TOWER_ARRAY], towerTravel[TOWER_ARRAY] = { 0, 0, 0 };
+    for (fast8_t i = 0; i <= 4; i++) {
+        float px[TOWER_ARRAY], py[TOWER_ARRAY], hpp[TOWER_ARRAY];
+        for (fast8_t t = 0; t < TOWER_ARRAY; t++) {
+            float ax = towerX[t] - (x0 + ux * 0.25f * i);
+            float ay = towerY[t] - (y0 + uy * 0.25f * i);
+            float r = diagonal2[t] - ax * ax - ay * ay;
+            if (r <= 0)
+                return 1; // unreachable, gets reported when computing the segments
+            float h = sqrt(r); // carriage height over effector
+            if (i > 0)
+                towerTravel[t] += fabs(h - lastH[t]);
+            lastH[t] = h;
+            float inv = 1.0f / h;
+            px[t] = ax * inv;
+            py[t] = ay * inv;
+            float au = (ax * ux + ay * uy) * inv;
+            hpp[t] = -(uu + au * au) * inv; // second derivative of h over the whole move
+        }
+        // Carriage heights change by dh = ax/h * ex + ay/h * ey + ez for an effector
+        // displacement e, solve for the displacement of the height curvature.
+        // Cramer's rule, the ez column is all ones
+        float det = px[0] * (py[1] - py[2]) - py[0] * (px[1] - px[2]) + (px[1] * py[2] - px[2] * py[1]);
+        if (det == 0)
+            return maxSegments; // singular tower geometry, keep the old behaviour
+        float ex = hpp[0] * (py[1] - py[2]) - py[0] * (hpp[1] - hpp[2]) + (hpp[1] * py[2] - hpp[2] * py[1]);
+        float ey = px[0] * (hpp[1] - hpp[2]) - hpp[0] * (px[1] - px[2]) + (px[1] * hpp[2] - px[2] * hpp[1]);
+        float ez = px[0] * (py[1] * hpp[2] - py[2] * hpp[1]) - py[0] * (px[1] * hpp[2] - px[2] * hpp[1]) + hpp[0] * (px[1] * py[2] - px[2] * py[1]);
+        curvature = RMath::max(curvature, static_cast<float>(sqrt(ex * ex + ey * ey + ez * ez)) / fabs(det));
+    }
+    for (fast8_t t = 0; t < TOWER_ARRAY; t++)
+        travel = RMath::max(travel, towerTravel[t]);
+    travel += RMath::absLong(Printer::destinationSteps[Z_AXIS] - Printer::currentPositionSteps[Z_AXIS]);
+    float tolerance = static_cast<float>(DELTA_SEGMENT_TOLERANCE) * 0.001f * Printer::axisStepsPerMM[Z_AXIS];
+    // n segments deviate curvature / (8 n^2)
+    int32_t count = RMath::min(static_cast<int32_t>(ceil(sqrt(curvature / (8.0f * tolerance)))), maxSegments);
+#ifdef DEBUG_SPLIT
+    Com::printFLN(PSTR("Delta deviation:"), curvature * 0.125f * Printer::invAxisStepsPerMM[Z_AXIS], 4);
+#endif
+    return RMath::max(count, static_cast<int32_t>(travel * (1.0f / 32000.0f)) + 1);
+}
+#endif
 #endif
 
 #if DRIVE_SYSTEM == TUGA
@@ -1590,6 +2402,57 @@ uint8_t transformCartesianStepsToDeltaSteps(int32_t cartesianPosSteps[], int32_t
 #endif
 
 #if NONLINEAR_SYSTEM
+/**
+  Calculate the tower positions for all sub segment ends of a line in one pass.
+  @param posSteps Cartesian positions, replaced by the tower positions.
+  @param count Number of positions.
+  @returns Number of converted positions. If less then count, the position with
+  that index has no valid tower position and is left unchanged.
+*/
+uint8_t transformCartesianStepsToDeltaStepsBatch(int32_t posSteps[][Z_AXIS_ARRAY], uint8_t count) {
+#if DRIVE_SYSTEM == DELTA
+    if (!Printer::isLargeMachine())
+        return transformSmallDeltaBatch(posSteps, count);
+#endif
+    int32_t towerSteps[Z_AXIS_ARRAY]; // the transformation may write some towers before it fails
+    for (uint8_t n = 0; n < count; n++) {
+        if (!transformCartesianStepsToDeltaSteps(posSteps[n], towerSteps))
+            return n;
+        for (fast8_t i = 0; i < Z_AXIS_ARRAY; i++)
+            posSteps[n][i] = towerSteps[i];
+    }
+    return count;
+}
+
+#if NONLINEAR_SEGMENT_POOL
+/**
+  Reserves numNonlinearSegments consecutive entries in segmentPool for this line,
+  waiting until finished lines have freed enough entries. Entries at the pool end
+  that are too few for the line get skipped and are freed with the line. The
+  reservation becomes final with pushLine, so a line that gets dropped before
+  needs no cleanup.
+*/
+void PrintLine::reserveNonlinearSegments() {
+    uint16_t needed = numNonlinearSegments;
+    segmentsStart = segmentPoolWritePos;
+    if (segmentsStart + needed > NONLINEAR_SEGMENT_POOL) {
+        needed += NONLINEAR_SEGMENT_POOL - segmentsStart;
+        segmentsStart = 0;
+    }
+    while (true) {
+        {
+            InterruptProtectedBlock noInts;
+            if (segmentPoolUsed + needed <= NONLINEAR_SEGMENT_POOL)
+                break;
+        }
+#if GCODE_BUFFER_SIZE > 1
+        GCode::readAhead();
+#endif
+        Commands::checkForPeriodicalActions(false);
+    }
+    segmentsPending = needed;
+}
+#endif
 
 bool NonlinearSegment::checkEndstops(PrintLine* cur, bool checkall) {
     fast8_t r = 0;
@@ -1815,15 +2678,24 @@ void PrintLine::calculateDirectionAndDelta(float fdifference[], int32_t differen
 }
 /**
   Calculate and cache the delta robot positions of the Cartesian move in a line.
+  Segment ends are converted to tower steps in small batches, so the stack holds
+  only DELTA_BATCH_SEGMENTS positions. The tower position of the printer is only
+  updated when all segments have a valid position.
   @return The largest delta axis move in a single segment
   @param p The line to examine.
 */
+#define DELTA_BATCH_SEGMENTS 4
 inline uint16_t PrintLine::calculateNonlinearSubSegments(uint8_t softEndstop) {
     fast8_t i;
+    uint8_t n;
     int32_t delta, diff;
-    int32_t destinationSteps[Z_AXIS_ARRAY], destinationDeltaSteps[TOWER_ARRAY];
-    // Save current position
+    int32_t positionSteps[DELTA_BATCH_SEGMENTS][Z_AXIS_ARRAY];
+    int32_t towerSteps[TOWER_ARRAY];
+    for (i = 0; i < TOWER_ARRAY; i++)
+        towerSteps[i] = Printer::currentNonlinearPositionSteps[i];
 #if (CPU_ARCH == ARCH_AVR) && !EXACT_DELTA_MOVES
+    int32_t destinationSteps[Z_AXIS_ARRAY];
+    // Save current position
     for (uint8_t i = 0; i < Z_AXIS_ARRAY; i++)
         destinationSteps[i] = Printer::currentPositionSteps[i];
 #else
@@ -1837,80 +2709,93 @@ inline uint16_t PrintLine::calculateNonlinearSubSegments(uint8_t softEndstop) {
 #endif
 
     uint16_t maxAxisSteps = 0;
-    for (int s = numNonlinearSegments; s > 0; s--) {
-        NonlinearSegment* d = &segments[s - 1];
-
+    for (uint8_t first = 0; first < numNonlinearSegments; first += DELTA_BATCH_SEGMENTS) {
+        uint8_t count = RMath::min(static_cast<uint8_t>(numNonlinearSegments - first), static_cast<uint8_t>(DELTA_BATCH_SEGMENTS));
+        for (uint8_t b = 0; b < count; b++) {
+            n = first + b;
 #if (CPU_ARCH == ARCH_AVR) && !EXACT_DELTA_MOVES
-        for (i = 0; i < Z_AXIS_ARRAY; i++) {
-            // End of segment in Cartesian steps
-
-            // This method generates small waves which get larger with increasing number of delta segments. smaller?
-            diff = Printer::destinationSteps[i] - destinationSteps[i];
-            if (s == 1)
-                destinationSteps[i] += diff;
-            else if (s == 2)
-                destinationSteps[i] += (diff >> 1);
-            else if (s == 4)
-                destinationSteps[i] += (diff >> 2);
-            else if (diff < 0)
-                destinationSteps[i] -= HAL::Div4U2U(-diff, s);
-            else
-                destinationSteps[i] += HAL::Div4U2U(diff, s);
-        }
+            int32_t s = numNonlinearSegments - n;
+            for (i = 0; i < Z_AXIS_ARRAY; i++) {
+                // End of segment in Cartesian steps
+
+                // This method generates small waves which get larger with increasing number of delta segments. smaller?
+                diff = Printer::destinationSteps[i] - destinationSteps[i];
+                if (s == 1)
+                    destinationSteps[i] += diff;
+                else if (s == 2)
+                    destinationSteps[i] += (diff >> 1);
+                else if (s == 4)
+                    destinationSteps[i] += (diff >> 2);
+                else if (diff < 0)
+                    destinationSteps[i] -= HAL::Div4U2U(-diff, s);
+                else
+                    destinationSteps[i] += HAL::Div4U2U(diff, s);
+                positionSteps[b][i] = destinationSteps[i];
+            }
 #else
-        float segment = static_cast<float>(numNonlinearSegments - s + 1);
-        for (i = 0; i < Z_AXIS_ARRAY; i++) // End of segment in Cartesian steps
-            // Perfect approximation, but slower, so we limit it to faster processors like arm
-            destinationSteps[i] = lroundf(dx[i] * segment) + Printer::currentPositionSteps[i];
+            float segment = static_cast<float>(n + 1);
+            for (i = 0; i < Z_AXIS_ARRAY; i++) // End of segment in Cartesian steps
+                // Perfect approximation, but slower, so we limit it to faster processors like arm
+                positionSteps[b][i] = lroundf(dx[i] * segment) + Printer::currentPositionSteps[i];
 #endif
+        }
         // Verify that delta calculation has a solution
-        if (transformCartesianStepsToDeltaSteps(destinationSteps, destinationDeltaSteps)) {
-            d->dir = 0;
+        uint8_t valid = transformCartesianStepsToDeltaStepsBatch(positionSteps, count);
+
+        for (uint8_t b = 0; b < count; b++) {
+            n = first + b;
+            NonlinearSegment* d = nonlinearSegment(numNonlinearSegments - 1 - n);
+            int32_t* destinationDeltaSteps = positionSteps[b];
+            if (b < valid) {
+                d->dir = 0;
 #if DRIVE_SYSTEM == DELTA
-            if (softEndstop) {
-                destinationDeltaSteps[A_TOWER] = RMath::min(destinationDeltaSteps[A_TOWER], Printer::maxDeltaPositionSteps);
-                destinationDeltaSteps[B_TOWER] = RMath::min(destinationDeltaSteps[B_TOWER], Printer::maxDeltaPositionSteps);
-                destinationDeltaSteps[C_TOWER] = RMath::min(destinationDeltaSteps[C_TOWER], Printer::maxDeltaPositionSteps);
-            }
+                if (softEndstop) {
+                    destinationDeltaSteps[A_TOWER] = RMath::min(destinationDeltaSteps[A_TOWER], Printer::maxDeltaPositionSteps);
+                    destinationDeltaSteps[B_TOWER] = RMath::min(destinationDeltaSteps[B_TOWER], Printer::maxDeltaPositionSteps);
+                    destinationDeltaSteps[C_TOWER] = RMath::min(destinationDeltaSteps[C_TOWER], Printer::maxDeltaPositionSteps);
+                }
 #endif
-            for (i = 0; i < TOWER_ARRAY; i++) {
-                delta = destinationDeltaSteps[i] - Printer::currentNonlinearPositionSteps[i];
-                if (delta > 0) {
-                    d->setPositiveMoveOfAxis(i);
+                for (i = 0; i < TOWER_ARRAY; i++) {
+                    delta = destinationDeltaSteps[i] - towerSteps[i];
+                    if (delta > 0) {
+                        d->setPositiveMoveOfAxis(i);
 #ifdef DEBUG_DELTA_OVERFLOW
-                    if (delta > 65535) {
-                        Com::printFLN(Com::tDBGDeltaOverflow, delta);
-                    }
+                        if (delta > 65535) {
+                            Com::printFLN(Com::tDBGDeltaOverflow, delta);
+                        }
 #endif
-                    d->deltaSteps[i] = static_cast<uint16_t>(delta);
-                } else {
-                    d->setMoveOfAxis(i);
+                        d->deltaSteps[i] = static_cast<uint16_t>(delta);
+                    } else {
+                        d->setMoveOfAxis(i);
 #ifdef DEBUG_DELTA_OVERFLOW
-                    if (-delta > 65535) {
-                        Com::printFLN(Com::tDBGDeltaOverflow, delta);
-                    }
+                        if (-delta > 65535) {
+                            Com::printFLN(Com::tDBGDeltaOverflow, delta);
+                        }
 #endif
-                    d->deltaSteps[i] = static_cast<uint16_t>(-delta);
-                }
+                        d->deltaSteps[i] = static_cast<uint16_t>(-delta);
+                    }
 #ifdef DEBUG_STEPCOUNT
-                totalStepsRemaining += d->deltaSteps[i];
+                    totalStepsRemaining += d->deltaSteps[i];
 #endif
-                if (d->deltaSteps[i] > maxAxisSteps) {
-                    maxAxisSteps = d->deltaSteps[i];
+                    if (d->deltaSteps[i] > maxAxisSteps) {
+                        maxAxisSteps = d->deltaSteps[i];
+                    }
+                    towerSteps[i] = destinationDeltaSteps[i];
                 }
-                Printer::currentNonlinearPositionSteps[i] = destinationDeltaSteps[i];
+            } else {
+                // Illegal position - ignore move, the failed entry still holds Cartesian steps
+                Com::printWarningF(Com::tInvalidDeltaCoordinate);
+                Com::printF(PSTR(" x:"), destinationDeltaSteps[X_AXIS]);
+                Com::printF(PSTR(" y:"), destinationDeltaSteps[Y_AXIS]);
+                Com::printFLN(PSTR(" z:"), destinationDeltaSteps[Z_AXIS]);
+                d->dir = 0;
+                d->deltaSteps[A_TOWER] = d->deltaSteps[B_TOWER] = d->deltaSteps[C_TOWER] = 0;
+                return 65535; // flag error, tower position stays unchanged
             }
-        } else {
-            // Illegal position - ignore move
-            Com::printWarningF(Com::tInvalidDeltaCoordinate);
-            Com::printF(PSTR(" x:"), destinationSteps[X_AXIS]);
-            Com::printF(PSTR(" y:"), destinationSteps[Y_AXIS]);
-            Com::printFLN(PSTR(" z:"), destinationSteps[Z_AXIS]);
-            d->dir = 0;
-            d->deltaSteps[A_TOWER] = d->deltaSteps[B_TOWER] = d->deltaSteps[C_TOWER] = 0;
-            return 65535; // flag error
         }
     }
+    for (i = 0; i < TOWER_ARRAY; i++)
+        Printer::currentNonlinearPositionSteps[i] = towerSteps[i];
 #ifdef DEBUG_STEPCOUNT
 //      out.println_long_P(PSTR("initial StepsRemaining:"), p->totalStepsRemaining);
 #endif
@@ -2068,6 +2953,9 @@ uint8_t PrintLine::queueNonlinearMove(uint8_t check_endstops, uint8_t pathOptimi
 #endif
         float sps = static_cast<float>((cartesianDir & ESTEP) == ESTEP ? Printer::printMovesPerSecond : Printer::travelMovesPerSecond);
         segmentCount = RMath::max(static_cast<int32_t>(1), static_cast<int32_t>(sps * seconds));
+#if DELTA_SEGMENT_TOLERANCE > 0
+        segmentCount = deltaSegmentCount(segmentCount);
+#endif
 #ifdef DEBUG_SEGMENT_LENGTH
         float segDist = cartesianDistance / (float)segmentCount;
         if (segDist > Printer::maxRealSegmentLength) {
@@ -2109,11 +2997,11 @@ uint8_t PrintLine::queueNonlinearMove(uint8_t check_endstops, uint8_t pathOptimi
 
     // Insert dummy moves if necessary
     // Need to leave at least one slot open for the first split move
-    insertWaitMovesIfNeeded(pathOptimize, RMath::min(PRINTLINE_CACHE_SIZE - 4, numLines));
+    insertWaitMovesIfNeeded(pathOptimize, RMath::min(static_cast<int>(PRINTLINE_CACHE_LINES) - 4, numLines));
     uint32_t oldEDestination = Printer::destinationSteps[E_AXIS]; // flow and volumetric extrusion changed virtual target
     Printer::currentPositionSteps[E_AXIS] = 0;
     if (numLines > 1) {
-        for (fast8_t i = 0; i < E_AXIS; i++) {
+        for (fast8_t i = 0; i < E_AXIS_ARRAY; i++) { // E too, each line extrudes its part only
             axisDistanceMM[i] /= numLines;
         }
     }
@@ -2152,8 +3040,16 @@ uint8_t PrintLine::queueNonlinearMove(uint8_t check_endstops, uint8_t pathOptimi
         }
 #endif
         p->numNonlinearSegments = segmentsPerLine;
+#if NONLINEAR_SEGMENT_POOL
+        p->reserveNonlinearSegments();
+#endif
 
         uint16_t maxStepsPerSegment = p->calculateNonlinearSubSegments(softEndstop);
+        int32_t virtualAxisSteps = static_cast<int32_t>(maxStepsPerSegment) * segmentsPerLine;
+#if NONLINEAR_SEGMENT_POOL
+        if (maxStepsPerSegment == 65535 || (virtualAxisSteps == 0 && p->delta[E_AXIS] == 0))
+            segmentsPending = 0; // line gets dropped
+#endif
         if (maxStepsPerSegment == 65535) {
             Com::printWarningFLN(PSTR("in queueDeltaMove to calculateDeltaSubSegments returns error."));
             return false;
@@ -2161,7 +3057,6 @@ uint8_t PrintLine::queueNonlinearMove(uint8_t check_endstops, uint8_t pathOptimi
 #ifdef DEBUG_SPLIT
         Com::printFLN(Com::tDBGDeltaMaxDS, (int32_t)maxStepsPerSegment);
 #endif
-        int32_t virtualAxisSteps = static_cast<int32_t>(maxStepsPerSegment) * segmentsPerLine;
         if (virtualAxisSteps == 0 && p->delta[E_AXIS] == 0) {
             if (numLines != 1) {
                 Com::printErrorFLN(Com::tDBGDeltaNoMoveinDSegment);
@@ -2207,10 +3102,39 @@ uint8_t PrintLine::queueNonlinearMove(uint8_t check_endstops, uint8_t pathOptimi
 
 #endif
 
+#if ARC_IN_STEPPER
+/** Tests the circle of an arc against the software endstops, the stepper can not
+clip it like chords get clipped. */
+static bool arcInsideSoftwareEndstops(float centerX, float centerY, float radius) {
+    if (Printer::isNoDestinationCheck() || Printer::isHoming())
+        return true;
+    centerX += Printer::offsetX;
+    centerY += Printer::offsetY;
+#if min_software_endstop_x
+    if ((centerX - radius) * Printer::axisStepsPerMM[X_AXIS] < Printer::xMinStepsAdj)
+        return false;
+#endif
+#if min_software_endstop_y
+    if ((centerY - radius) * Printer::axisStepsPerMM[Y_AXIS] < Printer::yMinStepsAdj)
+        return false;
+#endif
+#if max_software_endstop_x
+    if ((centerX + radius) * Printer::axisStepsPerMM[X_AXIS] > Printer::xMaxStepsAdj)
+        return false;
+#endif
+#if max_software_endstop_y
+    if ((centerY + radius) * Printer::axisStepsPerMM[Y_AXIS] > Printer::yMaxStepsAdj)
+        return false;
+#endif
+    return true;
+}
+#endif
+
 #if ARC_SUPPORT
 // Arc function taken from grbl
 // The arc is approximated by generating a huge number of tiny, linear segments. The length of each
-// segment is configured in settings.mm_per_arc_segment.
+// segment is configured in settings.mm_per_arc_segment. With ARC_IN_STEPPER the arc is queued as
+// one line instead, see setupArc.
 void PrintLine::arc(float* position, float* target, float* offset, float radius, uint8_t isclockwise) {
     //   int acceleration_manager_was_enabled = plan_is_acceleration_manager_enabled();
     //   plan_set_acceleration_manager_enabled(false); // disable acceleration management for the duration of the arc
@@ -2242,7 +3166,12 @@ void PrintLine::arc(float* position, float* target, float* offset, float radius,
     }
     //uint16_t segments = (radius>=BIG_ARC_RADIUS ? floor(millimeters_of_travel/MM_PER_ARC_SEGMENT_BIG) : floor(millimeters_of_travel/MM_PER_ARC_SEGMENT));
     // Increase segment size if printing faster then computation speed allows
-    uint16_t segments = (Printer::feedrate > 60.0f ? floor(millimeters_of_travel / RMath::min(static_cast<float>(MM_PER_ARC_SEGMENT_BIG), Printer::feedrate * 0.01666f * static_cast<float>(MM_PER_ARC_SEGMENT))) : floor(millimeters_of_travel / static_cast<float>(MM_PER_ARC_SEGMENT)));
+    float segmentLength = (Printer::feedrate > 60.0f ? RMath::min(static_cast<float>(MM_PER_ARC_SEGMENT_BIG), Printer::feedrate * 0.01666f * static_cast<float>(MM_PER_ARC_SEGMENT)) : static_cast<float>(MM_PER_ARC_SEGMENT));
+    // Longest chord that stays within ARC_CHORD_TOLERANCE of the arc. Large radii
+    // need much less lines that way.
+    if (ARC_CHORD_TOLERANCE > 0 && radius > ARC_CHORD_TOLERANCE)
+        segmentLength = RMath::max(segmentLength, 2.0f * static_cast<float>(sqrt((2.0f * radius - ARC_CHORD_TOLERANCE) * ARC_CHORD_TOLERANCE)));
+    uint16_t segments = floor(millimeters_of_travel / segmentLength);
     if (segments == 0)
         segments = 1;
     /*
@@ -2252,6 +3181,37 @@ void PrintLine::arc(float* position, float* target, float* offset, float radius,
       if (invert_feed_rate) { feed_rate *= segments; }
     */
     float theta_per_segment = angular_travel / segments;
+    // Limit speed by the centripetal acceleration v^2/r and the chord junctions by
+    // the direction change between chords, so the planner can join them directly.
+    float savedFeedrate = Printer::feedrate;
+    float arcAcceleration = (extruder_travel > 0 ? RMath::min(Printer::maxAccelerationMMPerSquareSecond[X_AXIS], Printer::maxAccelerationMMPerSquareSecond[Y_AXIS]) : RMath::min(Printer::maxTravelAccelerationMMPerSquareSecond[X_AXIS], Printer::maxTravelAccelerationMMPerSquareSecond[Y_AXIS]));
+    float arcSpeed = sqrt(arcAcceleration * radius);
+    if (Printer::feedrate > arcSpeed)
+        Printer::feedrate = arcSpeed;
+#if ARC_IN_STEPPER
+    // One line interpolated in the stepper interrupt. Leveling and distortion correction
+    // change Z along the arc and software endstops would cut it, so these get chords.
+    if (!Printer::isAutolevelActive() && !Printer::isZProbingActive()
+#if DISTORTION_CORRECTION
+        && !Printer::distortion.isEnabled()
+#endif
+        && fabs(sqrt(rt_axis0 * rt_axis0 + rt_axis1 * rt_axis1) - radius) < 1.0f && arcInsideSoftwareEndstops(center_axis0, center_axis1, radius)) {
+        arcRadius = radius;
+        arcStartAngle = atan2(r_axis1, r_axis0);
+        arcTravel = angular_travel;
+        Printer::moveToReal(target[X_AXIS], target[Y_AXIS], IGNORE_COORDINATE, target[E_AXIS], IGNORE_COORDINATE);
+        arcRadius = 0;
+        Printer::feedrate = savedFeedrate;
+        return;
+    }
+#endif
+#if JUNCTION_DEVIATION
+    arcJunctionSpeed = sqrt(arcAcceleration * JUNCTION_DEVIATION_MM) * junctionDeviationFactor(cos(theta_per_segment), fabs(sin(theta_per_segment)));
+#else
+    arcJunctionSpeed = Printer::maxJerk / fabs(theta_per_segment);
+#endif
+    if (++currentArcID == 0)
+        currentArcID = 1;
     //float linear_per_segment = linear_travel/segments;
     float extruder_per_segment = extruder_travel / segments;
 
@@ -2331,6 +3291,8 @@ void PrintLine::arc(float* position, float* target, float* offset, float radius,
     }
     // Ensure last segment arrives at target location.
     Printer::moveToReal(target[X_AXIS], target[Y_AXIS], IGNORE_COORDINATE, target[E_AXIS], IGNORE_COORDINATE);
+    currentArcID = 0;
+    Printer::feedrate = savedFeedrate;
 }
 #endif
 
@@ -2341,7 +3303,7 @@ void PrintLine::arc(float* position, float* target, float* offset, float radius,
   Cartesian axis steps may be less than the changing dominant delta axis.
 */
 #if NONLINEAR_SYSTEM
-int lastblk = -1;
+PrintLine* lastblk = NULL;
 int32_t cur_errupd;
 // Current nonlinear segment
 NonlinearSegment* curd;
@@ -2354,11 +3316,12 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
     if (cur == NULL)
 #endif
     {
+        ISR_PROFILE_BRANCH(ISR_BRANCH_NEW_LINE)
         setCurrentLine();
         if (cur->isBlocked()) { // This step is in computation - shouldn't happen
-            if (lastblk != (int)cur) {
+            if (lastblk != cur) {
                 HAL::allowInterrupts();
-                lastblk = (int)cur;
+                lastblk = cur;
                 Com::printFLN(Com::tBLK, (int32_t)linesCount);
             }
             cur = NULL;
@@ -2368,7 +3331,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
             return 2000;
         }
         HAL::allowInterrupts();
-        lastblk = -1;
+        lastblk = NULL;
 #if INCLUDE_DEBUG_NO_MOVE
         if (Printer::debugNoMoves()) { // simulate a move, but do nothing in reality
             removeCurrentLineForbidInterrupt();
@@ -2415,7 +3378,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
         if (cur->numNonlinearSegments) {
 
             // If there are delta segments point to them here
-            curd = &cur->segments[--cur->numNonlinearSegments];
+            curd = cur->nonlinearSegment(--cur->numNonlinearSegments);
             // Enable axis - All axis are enabled since they will most probably all be involved in a move
             // Since segments could involve different axis this reduces load when switching segments and
             // makes disabling easier.
@@ -2444,6 +3407,9 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
         Printer::vMaxReached = cur->vStart;
         Printer::stepNumber = 0;
         Printer::timer = 0;
+#if STEP_TIMING_TABLE
+        rampSpeed2 = static_cast<ramp_t>(cur->vStart) * cur->vStart;
+#endif
         HAL::forbidInterrupts();
 #if USE_ADVANCE
         if (!Printer::isAdvanceActivated()) // Set direction if no advance/OPS enabled
@@ -2510,6 +3476,10 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
         }
     }
     int maxLoops = (Printer::stepsPerTimerCall <= cur->stepsRemaining ? Printer::stepsPerTimerCall : cur->stepsRemaining);
+#ifdef DEBUG_STEP_TIMELINE
+    uint8_t timelineSteps = 0;
+    uint8_t timelineDir = (curd ? curd->dir & XYZ_DIRPOS : 0) | (cur->dir & E_DIRPOS);
+#endif
     HAL::forbidInterrupts();
     for (int loop = 0; loop < maxLoops; loop++) {
 #if STEPPER_HIGH_DELAY + DOUBLE_STEP_DELAY
@@ -2530,13 +3500,19 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
                 Extruder::step();
             }
             cur->error[E_AXIS] += cur_errupd;
+            STEP_TIMELINE_MARK(ESTEP)
         }
+#if ADVANCE_IN_STEPPER
+        if (Printer::isAdvanceActivated())
+            advanceExtruderStep();
+#endif
         if (curd) {
             // Take delta steps
             if (curd->isXMove())
                 if ((cur->error[X_AXIS] -= curd->deltaSteps[A_TOWER]) < 0) {
                     cur->startXStep();
                     cur->error[X_AXIS] += curd_errupd;
+                    STEP_TIMELINE_MARK(XSTEP)
 #ifdef DEBUG_REAL_POSITION
                     Printer::realDeltaPositionSteps[A_TOWER] += curd->isXPositiveMove() ? 1 : -1;
 #endif
@@ -2549,6 +3525,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
                 if ((cur->error[Y_AXIS] -= curd->deltaSteps[B_TOWER]) < 0) {
                     cur->startYStep();
                     cur->error[Y_AXIS] += curd_errupd;
+                    STEP_TIMELINE_MARK(YSTEP)
 #ifdef DEBUG_REAL_POSITION
                     Printer::realDeltaPositionSteps[B_TOWER] += curd->isYPositiveMove() ? 1 : -1;
 #endif
@@ -2561,6 +3538,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
                 if ((cur->error[Z_AXIS] -= curd->deltaSteps[C_TOWER]) < 0) {
                     cur->startZStep();
                     cur->error[Z_AXIS] += curd_errupd;
+                    STEP_TIMELINE_MARK(ZSTEP)
                     Printer::realDeltaPositionSteps[C_TOWER] += curd->isZPositiveMove() ? 1 : -1;
 #ifdef DEBUG_STEPCOUNT
                     cur->totalStepsRemaining--;
@@ -2573,7 +3551,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
 #endif
             Printer::insertStepperHighDelay();
             Printer::endXYZSteps();
-#if USE_ADVANCE
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
             if (!Printer::isAdvanceActivated()) // Use interrupt for movement
 #endif
                 Extruder::unstep();
@@ -2591,7 +3569,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
                 }
 #endif
                 // Get the next delta segment
-                curd = &cur->segments[--cur->numNonlinearSegments];
+                curd = cur->nonlinearSegment(--cur->numNonlinearSegments);
 
                 // Initialize Bresenham for this segment (numPrimaryStepPerSegment is already correct for the half step setting)
                 cur->error[X_AXIS] = cur->error[Y_AXIS] = cur->error[Z_AXIS] = cur->numPrimaryStepPerSegment >> 1;
@@ -2619,6 +3597,59 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
     HAL::allowInterrupts(); // Allow interrupts for other types, timer1 is still disabled
 #if RAMP_ACCELERATION
     //If acceleration is enabled on this move and we are in the acceleration segment, calculate the current interval
+#if INPUT_SHAPING
+    if (cur->isShaped() && cur->moveAccelerating()) { // input shaped acceleration
+        Printer::vMaxReached = cur->vStart + cur->shapedAccel.rise(Printer::timer, cur->shaper);
+        speed_t v = Printer::updateStepsPerTimerCall(Printer::vMaxReached);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+        cur->updateAdvanceSteps(Printer::vMaxReached, maxLoops, true);
+        Printer::stepNumber += maxLoops;
+    } else if (cur->isShaped() && cur->moveDecelerating()) {
+        speed_t v = cur->vEnd + cur->shapedDecel.fall(Printer::timer, cur->shaper);
+        cur->updateAdvanceSteps(v, maxLoops, false);
+        v = Printer::updateStepsPerTimerCall(v);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+    } else
+#endif
+#if S_CURVE_ACCELERATION
+    if (cur->hasSCurve() && cur->moveAccelerating()) { // jerk limited acceleration
+        Printer::vMaxReached = cur->vStart + cur->sCurveAccel.rise(Printer::timer);
+        speed_t v = Printer::updateStepsPerTimerCall(Printer::vMaxReached);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+        cur->updateAdvanceSteps(Printer::vMaxReached, maxLoops, true);
+        Printer::stepNumber += maxLoops;
+    } else if (cur->hasSCurve() && cur->moveDecelerating()) {
+        speed_t v = cur->vEnd + cur->sCurveDecel.fall(Printer::timer);
+        cur->updateAdvanceSteps(v, maxLoops, false);
+        v = Printer::updateStepsPerTimerCall(v);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+    } else
+#endif
+#if STEP_TIMING_TABLE
+    if (cur->hasRampTable() && cur->moveAccelerating()) { // squared speed grows linear with steps
+        for (fast8_t i = 0; i < maxLoops; i++)
+            rampSpeed2 += cur->accelerationPrim << 1;
+        Printer::stepNumber += maxLoops;
+        ticks_t interval = rampInterval(rampSpeed2);
+        if (interval < cur->fullInterval)
+            interval = cur->fullInterval;
+        Printer::interval = updateStepsPerTimerCallInterval(interval);
+    } else if (cur->hasRampTable() && cur->stepsRemaining <= static_cast<int32_t>(cur->decelSteps)) {
+        if (cur->flags & FLAG_DECELERATING) {
+            for (fast8_t i = 0; i < maxLoops; i++)
+                rampSpeed2 -= cur->accelerationPrim << 1;
+        } else { // start deceleration at the speed needed to reach vEnd
+            cur->flags |= FLAG_DECELERATING;
+            int32_t remaining = cur->stepsRemaining - maxLoops;
+            rampSpeed2 = static_cast<ramp_t>(cur->vEnd) * cur->vEnd + static_cast<ramp_t>(cur->accelerationPrim << 1) * (remaining > 0 ? remaining : 0);
+        }
+        Printer::interval = updateStepsPerTimerCallInterval(rampInterval(rampSpeed2));
+    } else
+#endif
     if (cur->moveAccelerating()) {
         Printer::vMaxReached = HAL::ComputeV(Printer::timer, cur->fAcceleration) + cur->vStart;
         if (Printer::vMaxReached > cur->vMax)
@@ -2672,6 +3703,10 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
 #else
     Printer::interval = cur->fullInterval; // without RAMPS always use full speed
 #endif
+#ifdef DEBUG_STEP_TIMELINE
+    StepTimeline::record(timelineSteps, timelineDir, maxLoops, (cur->flags & FLAG_DECELERATING ? 2 : (Printer::stepNumber <= cur->accelSteps ? 0 : 1)));
+#endif
+    ISR_PROFILE_BRANCH(cur->flags & FLAG_DECELERATING ? ISR_BRANCH_DECELERATE : (Printer::stepNumber <= cur->accelSteps ? ISR_BRANCH_ACCELERATE : ISR_BRANCH_NOMINAL))
     PrintLine::cur->stepsRemaining -= maxLoops;
 
     if (cur->stepsRemaining <= 0 || cur->isNoMove()) { // line finished
@@ -2704,7 +3739,7 @@ int32_t PrintLine::bresenhamStep() { // Version for delta printer
 #if CPU_ARCH != ARCH_AVR
     Printer::insertStepperHighDelay();
     Printer::endXYZSteps();
-#if USE_ADVANCE
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
     if (!Printer::isAdvanceActivated()) // Use interrupt for movement
 #endif
         Extruder::unstep();
@@ -2727,6 +3762,7 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
     if (cur == NULL)
 #endif
     {
+        ISR_PROFILE_BRANCH(ISR_BRANCH_NEW_LINE)
         setCurrentLine();
         if (cur->isBlocked()) { // This step is in computation - shouldn't happen
             /*if(lastblk!=(int)cur) // can cause output errors!
@@ -2799,12 +3835,19 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
         cur->fixStartAndEndSpeed();
         HAL::allowInterrupts();
         cur_errupd = cur->delta[cur->primaryAxis];
+#if ARC_IN_STEPPER
+        if (cur->flags & FLAG_ARC)
+            cur->startArc();
+#endif
         if (!cur->areParameterUpToDate()) { // should never happen, but with bad timings???
             cur->updateStepsParameter();
         }
         Printer::vMaxReached = cur->vStart;
         Printer::stepNumber = 0;
         Printer::timer = 0;
+#if STEP_TIMING_TABLE
+        rampSpeed2 = static_cast<ramp_t>(cur->vStart) * cur->vStart;
+#endif
         HAL::forbidInterrupts();
         //Determine direction of movement,check if endstop was hit
 #if !(GANTRY)
@@ -2869,6 +3912,9 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
     fast8_t max_loops = Printer::stepsPerTimerCall;
     if (cur->stepsRemaining < max_loops)
         max_loops = cur->stepsRemaining;
+#ifdef DEBUG_STEP_TIMELINE
+    uint8_t timelineSteps = 0;
+#endif
     for (fast8_t loop = 0; loop < max_loops; loop++) {
 #if STEPPER_HIGH_DELAY + DOUBLE_STEP_DELAY > 0
         if (loop)
@@ -2888,21 +3934,40 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
                 Extruder::step();
             }
             cur->error[E_AXIS] += cur_errupd;
+            STEP_TIMELINE_MARK(ESTEP)
+        }
+#if ADVANCE_IN_STEPPER
+        if (Printer::isAdvanceActivated())
+            advanceExtruderStep();
+#endif
+#if ARC_IN_STEPPER
+        if (cur->flags & FLAG_ARC) {
+#ifdef DEBUG_STEP_TIMELINE
+            timelineSteps |= cur->arcStep();
+#else
+            cur->arcStep();
+#endif
+        } else
+#endif
+        {
+            if (cur->isXMove())
+                if ((cur->error[X_AXIS] -= cur->delta[X_AXIS]) < 0) {
+                    cur->startXStep();
+                    cur->error[X_AXIS] += cur_errupd;
+                    STEP_TIMELINE_MARK(XSTEP)
+                }
+            if (cur->isYMove())
+                if ((cur->error[Y_AXIS] -= cur->delta[Y_AXIS]) < 0) {
+                    cur->startYStep();
+                    cur->error[Y_AXIS] += cur_errupd;
+                    STEP_TIMELINE_MARK(YSTEP)
+                }
         }
-        if (cur->isXMove())
-            if ((cur->error[X_AXIS] -= cur->delta[X_AXIS]) < 0) {
-                cur->startXStep();
-                cur->error[X_AXIS] += cur_errupd;
-            }
-        if (cur->isYMove())
-            if ((cur->error[Y_AXIS] -= cur->delta[Y_AXIS]) < 0) {
-                cur->startYStep();
-                cur->error[Y_AXIS] += cur_errupd;
-            }
         if (cur->isZMove())
             if ((cur->error[Z_AXIS] -= cur->delta[Z_AXIS]) < 0) {
                 cur->startZStep();
                 cur->error[Z_AXIS] += cur_errupd;
+                STEP_TIMELINE_MARK(ZSTEP)
 #ifdef DEBUG_STEPCOUNT
                 cur->totalStepsRemaining--;
 #endif
@@ -2915,7 +3980,7 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
 #endif
 #endif
         Printer::insertStepperHighDelay();
-#if USE_ADVANCE
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
         if (!Printer::isAdvanceActivated()) // Use interrupt for movement
 #endif
             Extruder::unstep();
@@ -2925,6 +3990,59 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
     HAL::allowInterrupts(); // Allow interrupts for other types, timer1 is still disabled
 #if RAMP_ACCELERATION
     //If acceleration is enabled on this move and we are in the acceleration segment, calculate the current interval
+#if INPUT_SHAPING
+    if (cur->isShaped() && cur->moveAccelerating()) { // input shaped acceleration
+        Printer::vMaxReached = cur->vStart + cur->shapedAccel.rise(Printer::timer, cur->shaper);
+        unsigned int v = Printer::updateStepsPerTimerCall(Printer::vMaxReached);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+        cur->updateAdvanceSteps(Printer::vMaxReached, max_loops, true);
+        Printer::stepNumber += max_loops;
+    } else if (cur->isShaped() && cur->moveDecelerating()) {
+        unsigned int v = cur->vEnd + cur->shapedDecel.fall(Printer::timer, cur->shaper);
+        cur->updateAdvanceSteps(v, max_loops, false);
+        v = Printer::updateStepsPerTimerCall(v);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+    } else
+#endif
+#if S_CURVE_ACCELERATION
+    if (cur->hasSCurve() && cur->moveAccelerating()) { // jerk limited acceleration
+        Printer::vMaxReached = cur->vStart + cur->sCurveAccel.rise(Printer::timer);
+        unsigned int v = Printer::updateStepsPerTimerCall(Printer::vMaxReached);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+        cur->updateAdvanceSteps(Printer::vMaxReached, max_loops, true);
+        Printer::stepNumber += max_loops;
+    } else if (cur->hasSCurve() && cur->moveDecelerating()) {
+        unsigned int v = cur->vEnd + cur->sCurveDecel.fall(Printer::timer);
+        cur->updateAdvanceSteps(v, max_loops, false);
+        v = Printer::updateStepsPerTimerCall(v);
+        Printer::interval = HAL::CPUDivU2(v);
+        Printer::timer += Printer::interval;
+    } else
+#endif
+#if STEP_TIMING_TABLE
+    if (cur->hasRampTable() && cur->moveAccelerating()) { // squared speed grows linear with steps
+        for (fast8_t i = 0; i < max_loops; i++)
+            rampSpeed2 += cur->accelerationPrim << 1;
+        Printer::stepNumber += max_loops;
+        ticks_t interval = rampInterval(rampSpeed2);
+        if (interval < cur->fullInterval)
+            interval = cur->fullInterval;
+        Printer::interval = updateStepsPerTimerCallInterval(interval);
+    } else if (cur->hasRampTable() && cur->stepsRemaining <= static_cast<int32_t>(cur->decelSteps)) {
+        if (cur->flags & FLAG_DECELERATING) {
+            for (fast8_t i = 0; i < max_loops; i++)
+                rampSpeed2 -= cur->accelerationPrim << 1;
+        } else { // start deceleration at the speed needed to reach vEnd
+            cur->flags |= FLAG_DECELERATING;
+            int32_t remaining = cur->stepsRemaining;
+            rampSpeed2 = static_cast<ramp_t>(cur->vEnd) * cur->vEnd + static_cast<ramp_t>(cur->accelerationPrim << 1) * (remaining > 0 ? remaining : 0);
+        }
+        Printer::interval = updateStepsPerTimerCallInterval(rampInterval(rampSpeed2));
+    } else
+#endif
     if (cur->moveAccelerating()) {                                                              // we are accelerating
         Printer::vMaxReached = HAL::ComputeV(Printer::timer, cur->fAcceleration) + cur->vStart; // v = v0 + a * t
         if (Printer::vMaxReached > cur->vMax) {
@@ -2977,6 +4095,10 @@ int32_t PrintLine::bresenhamStep() { // version for Cartesian printer
     Printer::stepsPerTimerCall = 1;
     Printer::interval = cur->fullInterval; // without RAMPS always use full speed
 #endif // RAMP_ACCELERATION
+#ifdef DEBUG_STEP_TIMELINE
+    StepTimeline::record(timelineSteps, cur->dir & (XYZ_DIRPOS | E_DIRPOS), max_loops, (cur->flags & FLAG_DECELERATING ? 2 : (Printer::stepNumber <= cur->accelSteps ? 0 : 1)));
+#endif
+    ISR_PROFILE_BRANCH(cur->flags & FLAG_DECELERATING ? ISR_BRANCH_DECELERATE : (Printer::stepNumber <= cur->accelSteps ? ISR_BRANCH_ACCELERATE : ISR_BRANCH_NOMINAL))
     long interval = Printer::interval;
     if (cur->stepsRemaining <= 0 || cur->isNoMove()) { // line finished
 #ifdef DEBUG_STEPCOUNT
@@ -30,12 +30,13 @@ protocol.
 #define FLAG_WARMUP 1
 #define FLAG_NOMINAL 2
 #define FLAG_DECELERATING 4
-#define FLAG_ACCELERATION_ENABLED 8 // unused
+#define FLAG_S_CURVE 8 // Ramps use sCurveAccel/sCurveDecel
 #define FLAG_CHECK_ENDSTOPS 16
 #define FLAG_ALL_E_MOTORS                                                      \
   32 // For mixed extruder move all motors instead of selected motor
-#define FLAG_SKIP_DEACCELERATING 64 // unused
+#define FLAG_RAMP_TABLE 64 // Ramps use rampInterval, see STEP_TIMING_TABLE
 #define FLAG_BLOCKED 128
+#define FLAG_ARC 256 // XY follow an arc, see ARC_IN_STEPPER. Only ARM has more than 8 flag bits
 
 /** Are the step parameter computed */
 #define FLAG_JOIN_STEPPARAMS_COMPUTED 1
@@ -57,10 +58,10 @@ protocol.
 // Printing related data
 #if NONLINEAR_SYSTEM || defined(DOXYGEN)
 // Allow the delta cache to store segments for every line in line cache. Beware
-// this gets big ... fast.
+// this gets big ... fast. NONLINEAR_SEGMENT_POOL shares one cache for all lines.
 
 class PrintLine;
-typedef struct {
+typedef struct __attribute__((packed)) { // 7 bytes also on ARM
   flag8_t dir;                      ///< Direction of delta movement.
   uint16_t deltaSteps[TOWER_ARRAY]; ///< Number of steps in move.
   inline bool checkEndstops(PrintLine *cur, bool checkall);
@@ -103,17 +104,165 @@ typedef struct {
 } NonlinearSegment;
 extern uint8_t lastMoveID;
 #endif
+#if STEP_TIMING_TABLE
+#if CPU_ARCH == ARCH_ARM
+typedef uint64_t ramp_t; ///< Squared speed in steps^2/s^2
+#else
+typedef uint32_t ramp_t; ///< Squared speed in steps^2/s^2
+#endif
+extern const uint16_t rampRsqrtTable[] PROGMEM;
+#endif
+#if S_CURVE_ACCELERATION
+/** Timing of one S-curve ramp. The ramp changes speed by delta within
+2^shift*scaledTicks timer ticks. */
+class SCurveRamp {
+public:
+  uint32_t factor;      ///< 2^31 / scaledTicks
+  uint16_t scaledTicks; ///< Ramp duration in ticks >> shift
+  uint8_t shift;
+  speed_t delta; ///< Speed change over the ramp in steps/s
+
+  void init(float v0, float v1, uint32_t accelerationPrim);
+  /** Returns the done fraction 3t^2-2t^3 scaled to 0..32768 after timer ticks
+  of the ramp. Only needs multiplications so it is cheap in the interrupt. */
+  INLINE uint32_t progress(uint32_t timer) {
+    timer >>= shift;
+    if (timer >= scaledTicks)
+      return 32768;
+    uint32_t t = (timer * factor) >> 16; // 0..32768
+    uint32_t t2 = (t * t) >> 15;
+    return (t2 * (98304 - (t << 1))) >> 15;
+  }
+  INLINE speed_t scaled(uint32_t fraction) {
+#if CPU_ARCH == ARCH_ARM
+    return (static_cast<uint64_t>(delta) * fraction) >> 15;
+#else
+    return (static_cast<uint32_t>(delta) * fraction) >> 15;
+#endif
+  }
+  /// Speed gained after timer ticks of an acceleration
+  INLINE speed_t rise(uint32_t timer) { return scaled(progress(timer)); }
+  /// Speed left above end speed after timer ticks of a deceleration
+  INLINE speed_t fall(uint32_t timer) {
+    return scaled(32768 - progress(timer));
+  }
+};
+#endif
+#if INPUT_SHAPING
+#define INPUT_SHAPER_OFF 0
+#define INPUT_SHAPER_ZV 1
+#define INPUT_SHAPER_ZVD 2
+#define INPUT_SHAPER_MZV 3
+#define INPUT_SHAPER_MAX_IMPULSES 9 // X and Y shaper convolved
+/** Impulse sequence of the ZV, ZVD or MZV shaper of one axis. Ramps convolved
+with it do not excite the resonance at frequency. */
+class InputShaper {
+public:
+  uint8_t type;          ///< INPUT_SHAPER_OFF .. INPUT_SHAPER_MZV
+  float frequency;       ///< Resonance frequency in Hz
+  float damping;         ///< Damping ratio of the resonance
+  uint8_t impulses;      ///< Number of impulses, 0 if the shaper is off
+  uint16_t amplitude[INPUT_SHAPER_MAX_IMPULSES]; ///< Impulse amplitudes, sum is 32768
+  uint32_t delay[INPUT_SHAPER_MAX_IMPULSES];     ///< Impulse times in timer ticks, ascending
+  float duration;        ///< Time of the last impulse in s
+  float centroid;        ///< Amplitude weighted mean impulse time in s
+  float planDuration; ///< Duration used by the planner, covers asymmetric shapers
+
+  void update();
+  static InputShaper axis[2]; ///< Shapers for X and Y
+  static InputShaper combined; ///< X and Y shaper convolved, for diagonal moves
+  static void updateCombined();
+  static void setDefaults();
+  static void report();
+};
+/** Ramp convolved with an input shaper. The unshaped ramp changes speed by
+delta within 2^shift*scaledTicks timer ticks, every impulse adds a copy of it
+weighted by its amplitude and delayed by its impulse time. */
+class ShapedRamp {
+public:
+  uint32_t factor;      ///< 2^31 / scaledTicks
+  uint16_t scaledTicks; ///< Unshaped ramp duration in ticks >> shift
+  uint8_t shift;
+  speed_t delta; ///< Speed change over the ramp in steps/s
+
+  void init(float v0, float v1, uint32_t accelerationPrim);
+  /** Returns the done fraction scaled to 0..32768 after timer ticks of the
+  ramp. At most 9 impulses for the combined shaper, 3 for a single axis. */
+  INLINE uint32_t progress(uint32_t timer, const InputShaper *shaper) {
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < shaper->impulses; i++) {
+      if (timer <= shaper->delay[i])
+        break;
+      uint32_t t = (timer - shaper->delay[i]) >> shift;
+      sum += (t >= scaledTicks ? 32768 : (t * factor) >> 16) *
+             shaper->amplitude[i];
+    }
+    return sum >> 15;
+  }
+  INLINE speed_t scaled(uint32_t fraction) {
+    return (static_cast<uint64_t>(delta) * fraction) >> 15;
+  }
+  /// Speed gained after timer ticks of an acceleration
+  INLINE speed_t rise(uint32_t timer, const InputShaper *shaper) {
+    return scaled(progress(timer, shaper));
+  }
+  /// Speed left above end speed after timer ticks of a deceleration
+  INLINE speed_t fall(uint32_t timer, const InputShaper *shaper) {
+    return scaled(32768 - progress(timer, shaper));
+  }
+};
+#endif
+#if ARC_IN_STEPPER
+/** Arc of a line interpolated in the stepper interrupt. Every primary step rotates
+the unit vector from the center by a fixed angle, X and Y go to that vector
+scaled by the radius in steps plus a linear correction, which moves the last
+step exactly to the target. Unit vectors and rotation are scaled by 2^30. */
+class StepperArc {
+public:
+  int32_t startX, startY;           ///< Unit vector from center to start
+  int32_t cosStep, sinStep;         ///< Rotation per primary step
+  int32_t radiusX, radiusY;         ///< Radius in X and Y steps
+  int32_t correctionX, correctionY; ///< Correction per primary step in steps * 2^24
+  int32_t endX, endY;               ///< Target relative to the start in steps
+  float exitX, exitY;               ///< Direction at the end for the next junction
+};
+#endif
 class UIDisplay;
 class PrintLine { // RAM usage: 24*4+15 = 113 Byte
   friend class UIDisplay;
+  friend class Simulator; // host simulation in src/Simulator
 #if CPU_ARCH == ARCH_ARM
   static volatile bool nlFlag;
 #endif
 public:
   static ufast8_t linesPos; // Position for executing line movement
+#if PRINTLINE_DYNAMIC_CACHE
+  static PrintLine *lines;
+  static ufast8_t linesCacheSize; ///< Entries in lines, always a power of 2
+  static ufast8_t linesCacheMask; ///< linesCacheSize - 1 for index wrapping
+#else
   static PrintLine lines[];
+#endif
   static ufast8_t
       linesWritePos; // Position where we write the next cached line move
+#if ARC_SUPPORT
+  static uint8_t currentArcID; ///< Arc the next queued lines belong to, 0 = none
+  static float arcJunctionSpeed; ///< Junction speed between chords of that arc
+#endif
+#if ARC_IN_STEPPER
+  static float arcRadius; ///< Arc of the next queued line in mm, 0 = straight
+  static float arcStartAngle; ///< Angle from the center to the start
+  static float arcTravel;     ///< Angle to move, positive is counter clockwise
+  static int32_t arcVectorX, arcVectorY; ///< Unit vector of the current step
+  static int32_t arcCorrectionX, arcCorrectionY; ///< Correction reached so far
+  static int32_t arcPositionX, arcPositionY; ///< Steps done since the start
+#endif
+#if NONLINEAR_SEGMENT_POOL
+  static NonlinearSegment segmentPool[NONLINEAR_SEGMENT_POOL];
+  static uint16_t segmentPoolWritePos; ///< Start of the next free pool entries
+  static volatile uint16_t segmentPoolUsed; ///< Entries reserved by queued lines
+  static uint8_t segmentsPending; ///< Reserved for the line until pushLine
+#endif
   ufast8_t joinFlags;
   volatile ufast8_t flags;
   secondspeed_t secondSpeed; // for laser intensity or fan control
@@ -127,6 +276,11 @@ private:
   float speedX;                ///< Speed in x direction at fullInterval in mm/s
   float speedY;                ///< Speed in y direction at fullInterval in mm/s
   float speedZ;                ///< Speed in z direction at fullInterval in mm/s
+#if JUNCTION_DEVIATION
+  float unitX;         ///< x part of the normalized xy direction
+  float unitY;         ///< y part of the normalized xy direction
+  float junctionScale; ///< sqrt(acceleration * JUNCTION_DEVIATION_MM) in mm/s
+#endif
   float speedE;                ///< Speed in E direction at fullInterval in mm/s
   float fullSpeed;             ///< Desired speed mm/s
   float invFullSpeed;          ///< 1.0/fullSpeed for faster computation
@@ -143,7 +297,12 @@ private:
       moveID; ///< ID used to identify moves which are all part of the same line
   int32_t numPrimaryStepPerSegment; ///< Number of primary Bresenham axis steps
                                     ///< in each delta segment
+#if NONLINEAR_SEGMENT_POOL
+  uint16_t segmentsStart;   ///< First segment of this line in segmentPool
+  uint8_t segmentsReserved; ///< Pool entries freed when the line is finished
+#else
   NonlinearSegment segments[DELTASEGMENTS_PER_PRINTLINE];
+#endif
 #endif
   ticks_t fullInterval; ///< interval at full speed in ticks/step.
   uint32_t accelSteps;  ///< How much steps does it take, to reach the plateau.
@@ -153,6 +312,22 @@ private:
   speed_t vMax;              ///< Maximum reached speed in steps/s.
   speed_t vStart;            ///< Starting speed in steps/s.
   speed_t vEnd;              ///< End speed in steps/s
+#if S_CURVE_ACCELERATION
+  SCurveRamp sCurveAccel;
+  SCurveRamp sCurveDecel;
+#endif
+#if INPUT_SHAPING
+  const InputShaper *shaper; ///< Shaper of the ramps, NULL for unshaped ramps
+  float shapeSpeed; ///< Speed change within the shaper duration in mm/s
+  ShapedRamp shapedAccel;
+  ShapedRamp shapedDecel;
+#endif
+#if ARC_SUPPORT
+  uint8_t arcID; ///< Arc this line is a chord of, 0 for straight moves
+#endif
+#if ARC_IN_STEPPER
+  StepperArc arcPath; ///< Path of X and Y if FLAG_ARC is set
+#endif
 #if USE_ADVANCE
 #if ENABLE_QUADRATIC_ADVANCE
   int32_t advanceRate; ///< Advance steps at full speed
@@ -168,8 +343,19 @@ private:
 public:
   int32_t stepsRemaining; ///< Remaining steps, until move is finished
   static PrintLine *cur;
+#if S_CURVE_ACCELERATION
+  static bool sCurveEnabled; ///< Use S-curve ramps for new lines, set by M537
+#endif
   static volatile ufast8_t
       linesCount; // Number of lines cached 0 = nothing to do
+  static uint16_t linesPushed;    ///< Counts pushLine calls, wraps around
+  static uint16_t moveLinesStart; ///< linesPushed at start of the current G0-G3
+  static uint16_t linesPerMove;   ///< Lines the last G0-G3 queued, at least 1
+#if NONLINEAR_SEGMENT_POOL
+  static uint16_t segmentsPushed;    ///< Counts reserved pool entries, wraps around
+  static uint16_t moveSegmentsStart; ///< segmentsPushed at start of the current G0-G3
+  static uint16_t segmentsPerMove;   ///< Pool entries the last G0-G3 reserved
+#endif
   inline bool areParameterUpToDate() {
     return joinFlags & FLAG_JOIN_STEPPARAMS_COMPUTED;
   }
@@ -402,9 +588,16 @@ public:
   }
   inline static void resetPathPlanner() {
     linesCount = 0;
+#if NONLINEAR_SEGMENT_POOL
+    segmentPoolUsed = 0;
+    segmentsPending = 0;
+#endif
     linesPos = linesWritePos;
     Printer::setMenuMode(MENU_MODE_PRINTING, Printer::isPrinting());
   }
+#if ADVANCE_IN_STEPPER
+  static INLINE void advanceExtruderStep();
+#endif
   // Only called from bresenham -> inside interrupt handle
   inline void updateAdvanceSteps(speed_t v, uint8_t max_loops,
                                  bool accelerate) {
@@ -435,6 +628,24 @@ public:
     Printer::advanceStepsSet = tred;
     HAL::allowInterrupts();
     Printer::advanceExecuted = advanceTarget;
+#elif ADVANCE_IN_STEPPER
+    // Low pass the advance over ADVANCE_SMOOTH_TIME, so the extruder follows
+    // speed changes without running back and forth
+    int32_t target = static_cast<int32_t>(v) * advanceL;
+    // Signed, so the product below stays signed where uint32_t is wider
+    int32_t weight = static_cast<int32_t>(
+        (static_cast<uint64_t>(Printer::interval) * ADVANCE_SMOOTH_FACTOR) >> 16);
+    if (weight > 65536)
+      weight = 65536;
+    Printer::advanceSmoothed +=
+        (static_cast<int64_t>(target - Printer::advanceSmoothed) * weight) >>
+        16;
+    int32_t tred = Printer::advanceSmoothed >> 16;
+    Printer::extruderStepsNeeded += tred - Printer::advanceStepsSet;
+    Printer::advanceStepsSet = tred;
+    Printer::extruderStepBudget += Printer::interval;
+    if (Printer::extruderStepBudget > (Printer::extruderStepTicks << 2))
+      Printer::extruderStepBudget = Printer::extruderStepTicks << 2;
 #else
     int32_t tred = (v * advanceL) >> 16; // HAL::mulu6xu16shift16(v, advanceL);
     HAL::forbidInterrupts();
@@ -460,6 +671,75 @@ public:
       return false;
   }
   INLINE bool moveAccelerating() { return Printer::stepNumber <= accelSteps; }
+#if S_CURVE_ACCELERATION
+  INLINE bool hasSCurve() { return flags & FLAG_S_CURVE; }
+#endif
+#if INPUT_SHAPING
+  INLINE bool isShaped() { return shaper != NULL; }
+#endif
+  /** Highest speed reachable from speed v within the line. Shaped ramps take
+  the shaper duration longer, so d = (v1^2-v^2)/(2a) + duration*(v+v1)/2 gets
+  solved for v1 instead of v1^2 = v^2 + 2ad. */
+  INLINE float reachableSpeed(float v) {
+#if INPUT_SHAPING
+    if (shapeSpeed > 0) {
+      float w = 2.0f * v - shapeSpeed;
+      return 0.5f * (sqrt(w * w + 4.0f * accelerationDistance2) - shapeSpeed);
+    }
+#endif
+    return sqrt(v * v + accelerationDistance2);
+  }
+#if STEP_TIMING_TABLE
+  INLINE bool hasRampTable() { return flags & FLAG_RAMP_TABLE; }
+  /** Returns the step interval F_CPU/sqrt(v2) for the squared speed v2. The
+  value gets normalized to 16 <= m < 64 with 8 fraction bits and 1/sqrt(m) is
+  interpolated from rampRsqrtTable, so no division is needed. v2 must be at
+  least RAMP_TABLE_MIN_SPEED^2. */
+  static INLINE ticks_t rampInterval(ramp_t v2) {
+    ufast8_t p = 0;
+#if CPU_ARCH == ARCH_ARM
+    if (v2 >= 16384) {
+      p = (51 - __builtin_clzll(v2)) >> 1; // leaves 13 or 14 significant bits
+      v2 >>= p << 1;
+    }
+#else
+    while (v2 >= (16384UL << 8)) {
+      v2 >>= 8;
+      p += 4;
+    }
+    while (v2 >= 16384) {
+      v2 >>= 2;
+      p++;
+    }
+#endif
+    uint16_t m = v2;
+    ufast8_t idx = (m >> 8) - 16;
+    int32_t a = pgm_read_word(&rampRsqrtTable[idx]);
+    int32_t r =
+        a + (((static_cast<int32_t>(pgm_read_word(&rampRsqrtTable[idx + 1])) -
+               a) *
+              static_cast<int32_t>(m & 255)) >>
+             8);
+    return (static_cast<uint32_t>(F_CPU >> 9) * static_cast<uint32_t>(r)) >>
+           (p + 12);
+  }
+  /** Converts a step interval into the timer interval and sets
+  stepsPerTimerCall like Printer::updateStepsPerTimerCall does for speeds. */
+  static INLINE ticks_t updateStepsPerTimerCallInterval(ticks_t interval) {
+    if (interval < STEP_DOUBLER_INTERVAL) {
+#if ALLOW_QUADSTEPPING
+      if (interval < (STEP_DOUBLER_INTERVAL >> 1)) {
+        Printer::stepsPerTimerCall = 4;
+        return interval << 2;
+      }
+#endif
+      Printer::stepsPerTimerCall = 2;
+      return interval << 1;
+    }
+    Printer::stepsPerTimerCall = 1;
+    return interval;
+  }
+#endif
   INLINE void startXStep() {
 #if !(GANTRY) || defined(FAST_COREXYZ)
     Printer::startXStep();
@@ -543,6 +823,71 @@ public:
     totalStepsRemaining--;
 #endif
   }
+#if ARC_IN_STEPPER
+  INLINE void startArc() {
+    arcVectorX = arcPath.startX;
+    arcVectorY = arcPath.startY;
+    arcCorrectionX = arcCorrectionY = 0;
+    arcPositionX = arcPositionY = 0;
+  }
+  /// Arc position relative to the start in steps, rounded
+  static INLINE int32_t arcOffset(int32_t vector, int32_t start, int32_t radius,
+                                  int32_t correction) {
+    return static_cast<int32_t>(
+        ((static_cast<int64_t>(vector) - start) * radius +
+         (static_cast<int64_t>(correction) << 6) + (1L << 29)) >>
+        30);
+  }
+  /** Moves X and Y to the arc position of the next primary step. The planner
+  keeps that at most one step per axis. Returns the stepped axes as XSTEP and
+  YSTEP bits. */
+  INLINE ufast8_t arcStep() {
+    int32_t x, y;
+    if (stepsRemaining == 1) { // end exactly at the target
+      x = arcPath.endX;
+      y = arcPath.endY;
+    } else {
+      int64_t u = arcVectorX, v = arcVectorY;
+      arcVectorX = static_cast<int32_t>(
+          (u * arcPath.cosStep - v * arcPath.sinStep + (1L << 29)) >> 30);
+      arcVectorY = static_cast<int32_t>(
+          (u * arcPath.sinStep + v * arcPath.cosStep + (1L << 29)) >> 30);
+      arcCorrectionX += arcPath.correctionX;
+      arcCorrectionY += arcPath.correctionY;
+      x = arcOffset(arcVectorX, arcPath.startX, arcPath.radiusX, arcCorrectionX);
+      y = arcOffset(arcVectorY, arcPath.startY, arcPath.radiusY, arcCorrectionY);
+    }
+    ufast8_t stepped = 0;
+    if (x != arcPositionX && isXMove()) { // an endstop may have stopped X
+      bool positive = x > arcPositionX;
+      if (positive != isXPositiveMove()) {
+        dir ^= X_DIRPOS;
+        Printer::setXDirection(positive);
+#if defined(DIRECTION_DELAY) && DIRECTION_DELAY > 0
+        HAL::delayMicroseconds(DIRECTION_DELAY);
+#endif
+      }
+      startXStep();
+      arcPositionX += (positive ? 1 : -1);
+      stepped |= XSTEP;
+    }
+    if (y != arcPositionY && isYMove()) {
+      bool positive = y > arcPositionY;
+      if (positive != isYPositiveMove()) {
+        dir ^= Y_DIRPOS;
+        Printer::setYDirection(positive);
+#if defined(DIRECTION_DELAY) && DIRECTION_DELAY > 0
+        HAL::delayMicroseconds(DIRECTION_DELAY);
+#endif
+      }
+      startYStep();
+      arcPositionY += (positive ? 1 : -1);
+      stepped |= YSTEP;
+    }
+    return stepped;
+  }
+  void setupArc(float axisDistanceMM[]);
+#endif
   void updateStepsParameter();
   float safeSpeed(fast8_t drivingAxis);
   void calculateMove(float axis_diff[], uint8_t pathOptimize,
@@ -560,33 +905,84 @@ public:
   }
   // Only called from within interrupts
   static INLINE void removeCurrentLineForbidInterrupt() {
+#if NONLINEAR_SEGMENT_POOL
+    uint8_t reserved = cur->segmentsReserved;
+#endif
     nextPlannerIndex(linesPos);
     cur = NULL;
 #if CPU_ARCH == ARCH_ARM
     nlFlag = false;
 #endif
     HAL::forbidInterrupts();
+#if NONLINEAR_SEGMENT_POOL
+    segmentPoolUsed -= reserved;
+#endif
     --linesCount;
     if (!linesCount)
       Printer::setMenuMode(MENU_MODE_PRINTING, Printer::isPrinting());
   }
   static INLINE void pushLine() {
+#if NONLINEAR_SEGMENT_POOL
+    PrintLine &p = lines[linesWritePos];
+    uint8_t reserved = p.segmentsReserved = segmentsPending;
+    if (reserved)
+      segmentPoolWritePos = p.segmentsStart + p.numNonlinearSegments;
+    segmentsPending = 0;
+#endif
     nextPlannerIndex(linesWritePos);
     Printer::setMenuMode(MENU_MODE_PRINTING, true);
     InterruptProtectedBlock noInts;
+#if NONLINEAR_SEGMENT_POOL
+    segmentPoolUsed += reserved;
+    segmentsPushed += reserved;
+#endif
     linesCount++;
+    linesPushed++;
+  }
+  /** Call before a G0-G3 queues its lines, see endMove. */
+  static INLINE void startMove() {
+    moveLinesStart = linesPushed;
+#if NONLINEAR_SEGMENT_POOL
+    moveSegmentsStart = segmentsPushed;
+#endif
+  }
+  /** Stores the cache usage of the move for freeMoves. */
+  static INLINE void endMove() {
+    uint16_t n = linesPushed - moveLinesStart;
+    if (n == 0) // nothing queued, keep the last value
+      return;
+    linesPerMove = n;
+#if NONLINEAR_SEGMENT_POOL
+    segmentsPerMove = segmentsPushed - moveSegmentsStart;
+#endif
   }
-  static uint8_t getLinesCount() {
+  static uint16_t freeMoves();
+#if NONLINEAR_SYSTEM
+  INLINE NonlinearSegment *nonlinearSegment(uint8_t i) {
+#if NONLINEAR_SEGMENT_POOL
+    return &segmentPool[segmentsStart + i];
+#else
+    return &segments[i];
+#endif
+  }
+#if NONLINEAR_SEGMENT_POOL
+  void reserveNonlinearSegments();
+#endif
+#endif
+  static ufast8_t getLinesCount() {
     InterruptProtectedBlock noInts;
     return linesCount;
   }
   static PrintLine *getNextWriteLine() { return &lines[linesWritePos]; }
+#if JUNCTION_DEVIATION
+  static float junctionDeviationFactor(float cosAngle, float sinAngle);
+#endif
   static inline void computeMaxJunctionSpeed(PrintLine *previous,
                                              PrintLine *current);
   static int32_t bresenhamStep();
   static void waitForXFreeLines(uint8_t b = 1, bool allowMoves = false);
   static inline void forwardPlanner(ufast8_t p);
-  static inline void backwardPlanner(ufast8_t p, ufast8_t last);
+  static inline ufast8_t backwardPlanner(ufast8_t p, ufast8_t last);
   static void updateTrapezoids();
   static uint8_t insertWaitMovesIfNeeded(uint8_t pathOptimize,
                                          uint8_t waitExtraLines);
@@ -610,12 +1006,24 @@ public:
   static void arc(float *position, float *target, float *offset, float radius,
                   uint8_t isclockwise);
 #endif
+#ifdef PRINTLINE_INDEX_MASK
+  static INLINE void previousPlannerIndex(ufast8_t &p) {
+    p = (p - 1) & PRINTLINE_INDEX_MASK;
+  }
+  static INLINE void nextPlannerIndex(ufast8_t &p) {
+    p = (p + 1) & PRINTLINE_INDEX_MASK;
+  }
+#else
   static INLINE void previousPlannerIndex(ufast8_t &p) {
     p = (p ? p - 1 : PRINTLINE_CACHE_SIZE - 1);
   }
   static INLINE void nextPlannerIndex(ufast8_t &p) {
     p = (p >= PRINTLINE_CACHE_SIZE - 1 ? 0 : p + 1);
   }
+#endif
+#if PRINTLINE_DYNAMIC_CACHE
+  static void allocateCache();
+#endif
 #if NONLINEAR_SYSTEM || defined(DOXYGEN)
   static uint8_t queueNonlinearMove(uint8_t check_endstops,
                                     uint8_t pathOptimize, uint8_t softEndstop);
@@ -635,4 +1043,123 @@ public:
 #endif
 };
 
+#if defined(DEBUG_STEP_TIMELINE) || defined(DOXYGEN)
+#ifndef STEP_TIMELINE_MICROS
+/** Clock for the planner statistics. The host simulation replaces it with the
+host clock. */
+#define STEP_TIMELINE_MICROS() HAL::timeInMicroseconds()
+#endif
+
+/** One entry of the step timeline. Written for every stepper interrupt call
+that executes steps. */
+typedef struct {
+  uint32_t time;  ///< Stepper timer ticks since recording was started
+  uint8_t steps;  ///< Stepped axes as XSTEP, YSTEP, ZSTEP, ESTEP bits
+  uint8_t dir;    ///< Directions as X_DIRPOS .. E_DIRPOS bits
+  uint8_t loops;  ///< Steps per stepped axis in this call (step doubling)
+  uint8_t phase;  ///< 0 = accelerating, 1 = constant speed, 2 = decelerating
+} StepTimelineEntry;
+
+/** \brief Recorder for the executed step sequence and planner statistics.
+
+The stepper interrupt appends one entry per call into a ring buffer. The host
+drains the buffer with M536 P1 while recording continues. If the host is too
+slow, entries get dropped and counted as lost, so the timeline is never
+silently corrupted. Times are in stepper timer ticks (F_CPU ticks per second).
+*/
+class StepTimeline {
+public:
+  static StepTimelineEntry entries[STEP_TIMELINE_SIZE];
+  static volatile uint16_t readPos;
+  static volatile uint16_t writePos;
+  static volatile uint32_t time;  ///< Ticks since start of recording
+  static uint32_t lost;           ///< Entries dropped because buffer was full
+  static volatile bool recording;
+  static uint32_t linesPlanned;   ///< Lines added to the path planner
+  static uint32_t planningMicros; ///< Time spent in calculateMove
+  static uint32_t maxPlanningMicros;
+  static uint32_t recomputedLines;    ///< Lines with new step parameter
+  static uint16_t maxRecomputedLines; ///< Most lines updated for one new line
+  static uint32_t plannedJunctions;   ///< Junctions visited by the backward planner
+#if S_CURVE_ACCELERATION
+  static float maxSCurveJerk; ///< Highest ramp jerk planned in steps/s^3
+#endif
+  static uint32_t stepperCalls; ///< Interrupt calls with steps
+  static uint32_t stepsDone;    ///< Primary axis steps executed
+#if USE_ADVANCE
+  static uint32_t extruderInterrupts; ///< Calls of the extruder timer
+  static uint32_t extruderReversals;  ///< Extruder direction changes
+#endif
+
+  static void start();
+  static void stop();
+  static INLINE void advance(uint32_t ticks) {
+    if (recording)
+      time += ticks;
+  }
+  // Only called from stepper interrupt
+  static INLINE void record(uint8_t steps, uint8_t dir, uint8_t loops,
+                            uint8_t phase) {
+    if (!recording)
+      return;
+    stepperCalls++;
+    stepsDone += loops;
+    uint16_t next = writePos + 1;
+    if (next >= STEP_TIMELINE_SIZE)
+      next = 0;
+    if (next == readPos) {
+      lost++;
+      return;
+    }
+    StepTimelineEntry &e = entries[writePos];
+    e.time = time;
+    e.steps = steps;
+    e.dir = dir;
+    e.loops = loops;
+    e.phase = phase;
+    writePos = next;
+  }
+  static INLINE void linePlanned(uint32_t startMicros) {
+    uint32_t t = STEP_TIMELINE_MICROS() - startMicros;
+    linesPlanned++;
+    planningMicros += t;
+    if (t > maxPlanningMicros)
+      maxPlanningMicros = t;
+  }
+  static INLINE void linesRecomputed(uint16_t n) {
+    recomputedLines += n;
+    if (n > maxRecomputedLines)
+      maxRecomputedLines = n;
+  }
+  static void reportStatistics();
+  static void sendEntries();
+};
+#endif
+
+#if ADVANCE_IN_STEPPER
+/** Executes one pending extruder step if the maximum extruder feedrate allows
+it. The direction only changes with ADVANCE_DIR_FILTER_STEPS steps pending and
+uses the call on its own, so the driver has the new direction before the next
+step. */
+inline void PrintLine::advanceExtruderStep() {
+  int8_t dir = (Printer::extruderStepsNeeded > 0
+                    ? 1
+                    : (Printer::extruderStepsNeeded < 0 ? -1 : 0));
+  if (dir == 0 || Printer::extruderStepBudget < Printer::extruderStepTicks)
+    return;
+  if (dir != Printer::extruderDirection) {
+    if (Printer::extruderDirection != 0 &&
+        dir * Printer::extruderStepsNeeded < ADVANCE_DIR_FILTER_STEPS)
+      return;
+    Extruder::setDirection(dir > 0);
+    Printer::extruderDirection = dir;
+    STEP_TIMELINE_REVERSAL
+    return;
+  }
+  Extruder::step();
+  Printer::extruderStepsNeeded -= dir;
+  Printer::extruderStepBudget -= Printer::extruderStepTicks;
+}
+#endif
+
 #endif // MOTION_H_INCLUDED
@@ -825,6 +825,44 @@ void initializeLCD() {
 u8g_t u8g;
 u8g_uint_t u8_tx = 0, u8_ty = 0;
 
+/* Pages of the display as sent at the last refreshPage. u8glib renders the
+   picture one page (8 or 16 pixel rows) at a time, so only the hash of each
+   page is kept instead of the picture. */
+#define U8G_MAX_PAGES 8
+static uint32_t u8gPageHash[U8G_MAX_PAGES];
+static uint8_t u8gFullRefresh = 0; ///< Refreshes until all pages get sent again, 0 = send all now
+
+static uint8_t u8gNullCom(u8g_t* u8g, uint8_t msg, uint8_t arg_val, void* arg_ptr) {
+    return 1;
+}
+
+/** Replaces u8g_NextPage in refreshPage. A page that looks like at the last
+refresh is not sent to the display, so changing a temperature only sends the
+pages with that row. Every 16th refresh sends all pages, so a display disturbed
+by noise recovers. */
+static uint8_t u8gNextPage() {
+    u8g_pb_t* pb = (u8g_pb_t*)u8g.dev->dev_mem;
+    uint8_t page = pb->p.page_y0 / pb->p.page_height;
+    uint8_t* ptr = (uint8_t*)pb->buf;
+    uint16_t size = (pb->width * pb->p.page_height) >> 3;
+    uint32_t hash = 2166136261UL; // FNV-1a
+    while (size--) {
+        hash ^= *ptr++;
+        hash *= 16777619UL;
+    }
+    if (page >= U8G_MAX_PAGES || u8gFullRefresh == 0 || u8gPageHash[page] != hash) {
+        if (page < U8G_MAX_PAGES)
+            u8gPageHash[page] = hash;
+        return u8g_NextPage(&u8g);
+    }
+    // Unchanged, run the page switch with all transfers to the display dropped
+    u8g_com_fnptr com = u8g.dev->com_fn;
+    u8g.dev->com_fn = u8gNullCom;
+    uint8_t more = u8g_NextPage(&u8g);
+    u8g.dev->com_fn = com;
+    return more;
+}
+
 void u8PrintChar(char c) {
     switch ((uint8_t)c) {
     case 0x7E: // right arrow
@@ -975,6 +1013,7 @@ void initializeLCD() {
     do {
         u8g_SetColorIndex(&u8g, 0);
     } while (u8g_NextPage(&u8g));
+    u8gFullRefresh = 0;
 
 #if LANGUAGE_RU_ACTIVE // Switch font
     if (Com::selectedLanguage != LANGUAGE_RU_ID) {
@@ -1331,633 +1370,706 @@ void UIDisplay::addGCode(GCode* code) {
     //if(code->hasSTRING())
 }
 
-void UIDisplay::parse(const char* txt, bool ram) {
-    static uint8_t beepdelay = 0;
-    int ivalue = 0;
-    float fvalue = 0;
-    while (col < MAX_COLS) {
-        char c = (ram ? *(txt++) : pgm_read_byte(txt++));
+/* Compiled templates of the last parsed rows. Rows get refreshed with the same
+   template most of the time, so they are scanned for variables only once.
+   Rows get parsed in the same order on each refresh, so the entry after the
+   last used one is tried first. */
+static UITemplate uiTemplates[UI_TEMPLATE_CACHE];
+static uint8_t uiTemplateNext = 0;
+
+/** Splits txt into text runs and variables. Stops with t.rest set if all
+segments are used. */
+static void compileTemplate(const char* txt, bool ram, UITemplate& t) {
+    uint8_t pos = 0;
+    t.text = txt;
+    t.count = 0;
+    t.rest = 0;
+    while (true) {
+        char c = (ram ? txt[pos] : pgm_read_byte(&txt[pos]));
         if (c == 0)
-            break; // finished
+            return; // finished
+        if (t.count == UI_TEMPLATE_SEGMENTS || pos > 200) {
+            t.rest = pos;
+            return;
+        }
+        t.offset[t.count] = pos;
         if (c != '%') {
-            uid.printCols[col++] = c;
+            do {
+                c = (ram ? txt[++pos] : pgm_read_byte(&txt[++pos]));
+            } while (c != 0 && c != '%' && pos < 250);
+            t.length[t.count] = pos - t.offset[t.count];
+            t.count++;
             continue;
         }
-        // dynamic parameter, parse meaning and replace
-        char c1 = (ram ? *(txt++) : pgm_read_byte(txt++));
-        char c2 = (ram ? *(txt++) : pgm_read_byte(txt++));
-        if (EVENT_CUSTOM_TEXT_PARSER(c1, c2)) {
-            continue;
+        // dynamic parameter, replaced on output
+        char c1 = (ram ? txt[pos + 1] : pgm_read_byte(&txt[pos + 1]));
+        if (c1 == 0)
+            return;
+        char c2 = (ram ? txt[pos + 2] : pgm_read_byte(&txt[pos + 2]));
+        t.length[t.count++] = 0;
+        if (c1 == '%' && c2 != '%')
+            pos += 2; // Be flexible and accept 2 or 3 chars for escaped percent
+        else if (c2 == 0)
+            return;
+        else if (c1 == 'e' && c2 == 'I' && (ram ? txt[pos + 3] : pgm_read_byte(&txt[pos + 3])) != 0)
+            pos += 4; // %eIc, skip c sign
+        else
+            pos += 3;
+    }
+}
+
+void UIDisplay::parse(const char* txt, bool ram) {
+    UITemplate tmp, *t = &tmp;
+    if (ram) // Content may change, so do not cache
+        compileTemplate(txt, true, tmp);
+    else {
+        uint8_t i = uiTemplateNext;
+        if (uiTemplates[i].text != txt) {
+            i = 0;
+            while (i < UI_TEMPLATE_CACHE && uiTemplates[i].text != txt)
+                i++;
         }
-        switch (c1) {
-        case '%': {
-            // print % for input '%%' or '%%%'
-            if (col < UI_COLS)
-                uid.printCols[col++] = '%'; // if data = '%%?' escaped percent, with left over ? char
-            if (c2 != '%')
-                txt--; // Be flexible and accept 2 or 3 chars
-            break;
-        } // case '%'
-
-        case '?': { // conditional spacer or other char
-            // If something has been printed, check if the last char is c2.
-            // if not, append c2.
-            // otherwise do nothing.
-            if (col > 0 && col < UI_COLS) {
-                if (uid.printCols[col - 1] != c2)
-                    uid.printCols[col++] = c2;
+        if (i == UI_TEMPLATE_CACHE) { // Not cached, replace the entry after the last used one
+            i = uiTemplateNext;
+            compileTemplate(txt, false, uiTemplates[i]);
+        }
+        t = &uiTemplates[i];
+        uiTemplateNext = (i + 1 == UI_TEMPLATE_CACHE ? 0 : i + 1);
+    }
+    while (true) {
+        for (uint8_t i = 0; i < t->count && col < MAX_COLS; i++) {
+            const char* p = t->text + t->offset[i];
+            uint8_t len = t->length[i];
+            if (len == 0) {
+                parseVariable(ram ? p[1] : pgm_read_byte(&p[1]), ram ? p[2] : pgm_read_byte(&p[2]));
+                continue;
             }
+            if (len > MAX_COLS - col)
+                len = MAX_COLS - col;
+            if (ram)
+                memcpy(uid.printCols + col, p, len);
+            else
+                memcpy_P(uid.printCols + col, p, len);
+            col += len;
+        }
+        if (t->rest == 0 || col >= MAX_COLS)
             break;
+        compileTemplate(t->text + t->rest, ram, tmp); // Template longer than the segments
+        t = &tmp;
+    }
+    uid.printCols[col] = 0;
+}
+
+/** Writes the value of template variable %c1c2 to printCols. */
+void UIDisplay::parseVariable(char c1, char c2) {
+    static uint8_t beepdelay = 0;
+    int ivalue = 0;
+    float fvalue = 0;
+    if (EVENT_CUSTOM_TEXT_PARSER(c1, c2))
+        return;
+    switch (c1) {
+    case '%': {
+        // print % for input '%%' or '%%%'
+        if (col < UI_COLS)
+            uid.printCols[col++] = '%'; // if data = '%%?' escaped percent, with left over ? char
+        break;
+    } // case '%'
+
+    case '?': { // conditional spacer or other char
+        // If something has been printed, check if the last char is c2.
+        // if not, append c2.
+        // otherwise do nothing.
+        if (col > 0 && col < UI_COLS) {
+            if (uid.printCols[col - 1] != c2)
+                uid.printCols[col++] = c2;
         }
-        case 'a': // Acceleration settings
-            if (c2 >= 'x' && c2 <= 'z')
-                addFloat(Printer::maxAccelerationMMPerSquareSecond[c2 - 'x'], 5, 0);
-            else if (c2 >= 'X' && c2 <= 'Z')
-                addFloat(Printer::maxTravelAccelerationMMPerSquareSecond[c2 - 'X'], 5, 0);
-            else if (c2 == 'j')
-                addFloat(Printer::maxJerk, 3, 1);
+        break;
+    }
+    case 'a': // Acceleration settings
+        if (c2 >= 'x' && c2 <= 'z')
+            addFloat(Printer::maxAccelerationMMPerSquareSecond[c2 - 'x'], 5, 0);
+        else if (c2 >= 'X' && c2 <= 'Z')
+            addFloat(Printer::maxTravelAccelerationMMPerSquareSecond[c2 - 'X'], 5, 0);
+        else if (c2 == 'j')
+            addFloat(Printer::maxJerk, 3, 1);
 #if DRIVE_SYSTEM != DELTA
-            else if (c2 == 'J')
-                addFloat(Printer::maxZJerk, 3, 1);
+        else if (c2 == 'J')
+            addFloat(Printer::maxZJerk, 3, 1);
 #endif
+        break;
+    case 'B':
+        if (c2 == 'C') { //Custom coating
+            addFloat(Printer::zBedOffset, 3, 2);
             break;
-        case 'B':
-            if (c2 == 'C') { //Custom coating
-                addFloat(Printer::zBedOffset, 3, 2);
-                break;
-            }
-            break;
-        case 'd': // debug boolean
-            if (c2 == 'o')
-                addStringOnOff(Printer::debugEcho());
-            if (c2 == 'i')
-                addStringOnOff(Printer::debugInfo());
-            if (c2 == 'e')
-                addStringOnOff(Printer::debugErrors());
-            if (c2 == 'd')
-                addStringOnOff(Printer::debugDryrun());
-            if (c2 == 'p')
-                addStringOnOff(Printer::debugEndStop());
-            if (c2 == 'x')
+        }
+        break;
+    case 'd': // debug boolean
+        if (c2 == 'o')
+            addStringOnOff(Printer::debugEcho());
+        if (c2 == 'i')
+            addStringOnOff(Printer::debugInfo());
+        if (c2 == 'e')
+            addStringOnOff(Printer::debugErrors());
+        if (c2 == 'd')
+            addStringOnOff(Printer::debugDryrun());
+        if (c2 == 'p')
+            addStringOnOff(Printer::debugEndStop());
+        if (c2 == 'x')
 #if MIN_HARDWARE_ENDSTOP_X
-                addStringP(Endstops::xMin() ? ui_selected : ui_unselected);
+            addStringP(Endstops::xMin() ? ui_selected : ui_unselected);
 #else
-                addStringP(Com::tSpace);
+            addStringP(Com::tSpace);
 #endif
-            if (c2 == 'X')
+        if (c2 == 'X')
 #if MAX_HARDWARE_ENDSTOP_X
-                addStringP(Endstops::xMax() ? ui_selected : ui_unselected);
+            addStringP(Endstops::xMax() ? ui_selected : ui_unselected);
 #else
-                addStringP(Com::tSpace);
+            addStringP(Com::tSpace);
 #endif
-            if (c2 == 'y')
+        if (c2 == 'y')
 #if MIN_HARDWARE_ENDSTOP_Y
-                addStringP(Endstops::yMin() ? ui_selected : ui_unselected);
+            addStringP(Endstops::yMin() ? ui_selected : ui_unselected);
 #else
-                addStringP(Com::tSpace);
+            addStringP(Com::tSpace);
 #endif
-            if (c2 == 'Y')
+        if (c2 == 'Y')
 #if MAX_HARDWARE_ENDSTOP_Y
-                addStringP(Endstops::yMax() ? ui_selected : ui_unselected);
+            addStringP(Endstops::yMax() ? ui_selected : ui_unselected);
 #else
-                addStringP(Com::tSpace);
+            addStringP(Com::tSpace);
 #endif
-            if (c2 == 'z')
+        if (c2 == 'z')
 #if MIN_HARDWARE_ENDSTOP_Z
 #if Z_PROBE_PIN == Z_MIN_PIN
-                // In this case z min is always false, return z probe signal instead
-                addStringP(Endstops::zProbe() ? ui_selected : ui_unselected);
+            // In this case z min is always false, return z probe signal instead
+            addStringP(Endstops::zProbe() ? ui_selected : ui_unselected);
 #else
-                addStringP(Endstops::zMin() ? ui_selected : ui_unselected);
+            addStringP(Endstops::zMin() ? ui_selected : ui_unselected);
 #endif
 #else
-                addStringP(Com::tSpace);
+            addStringP(Com::tSpace);
 #endif
-            if (c2 == 'Z')
+        if (c2 == 'Z')
 #if MAX_HARDWARE_ENDSTOP_Z
-                addStringP(Endstops::zMax() ? ui_selected : ui_unselected);
+            addStringP(Endstops::zMax() ? ui_selected : ui_unselected);
 #else
-                addStringP(Com::tSpace);
+            addStringP(Com::tSpace);
 #endif
-            break;
-        case 'D':
+        break;
+    case 'D':
 #if FEATURE_DITTO_PRINTING
-            if (c2 >= '0' && c2 <= '9') {
-                addStringP(Extruder::dittoMode == c2 - '0' ? ui_selected : ui_unselected);
-            }
+        if (c2 >= '0' && c2 <= '9') {
+            addStringP(Extruder::dittoMode == c2 - '0' ? ui_selected : ui_unselected);
+        }
 #endif
 #if DISTORTION_CORRECTION
-            if (c2 == 'e') {
-                addStringOnOff((Printer::distortion.isEnabled())); // Autolevel on/off
-            }
+        if (c2 == 'e') {
+            addStringOnOff((Printer::distortion.isEnabled())); // Autolevel on/off
+        }
 #endif
-            break;
-        case 'e': { // Extruder temperature
-            if (c2 == 'I') {
-                //give integer display
-                //char c2 = (ram ? *(txt++) : pgm_read_byte(txt++));
-                txt++; // just skip c sign
-                ivalue = 0;
-                c2 = 'c';
-            } else
-                ivalue = UI_TEMP_PRECISION;
+        break;
+    case 'e': { // Extruder temperature
+        if (c2 == 'I') {
+            //give integer display, c sign got skipped by compileTemplate
+            ivalue = 0;
+            c2 = 'c';
+        } else
+            ivalue = UI_TEMP_PRECISION;
 
-            if (c2 == 'r') { // Extruder relative mode
-                addStringP(Printer::relativeExtruderCoordinateMode ? Com::translatedF(UI_TEXT_YES_ID) : Com::translatedF(UI_TEXT_NO_ID));
-                break;
-            }
+        if (c2 == 'r') { // Extruder relative mode
+            addStringP(Printer::relativeExtruderCoordinateMode ? Com::translatedF(UI_TEXT_YES_ID) : Com::translatedF(UI_TEXT_NO_ID));
+            break;
+        }
 #if FEATURE_DITTO_PRINTING
-            if (c2 == 'd') { // ditto copy mode
-                addInt(Extruder::dittoMode, 1, ' ');
-                break;
-            }
+        if (c2 == 'd') { // ditto copy mode
+            addInt(Extruder::dittoMode, 1, ' ');
+            break;
+        }
 #endif
-            if (c2 == 'j') { // jam control enabled
-                addStringOnOff(!Printer::isJamcontrolDisabled());
-            }
+        if (c2 == 'j') { // jam control enabled
+            addStringOnOff(!Printer::isJamcontrolDisabled());
+        }
 #if NUM_TEMPERATURE_LOOPS > 0
-            uint8_t eid = NUM_EXTRUDER; // default = BED if c2 not specified extruder number
-            if (c2 == 'c')
-                eid = Extruder::current->id;
-            else if (c2 >= '0' && c2 <= '9')
-                eid = c2 - '0';
-            if (Printer::isAnyTempsensorDefect()) {
-                if (eid == 0 && ++beepdelay > 30)
-                    beepdelay = 0; // beep every 30 seconds
-                if (beepdelay == 1)
-                    BEEP_LONG;
-                if (tempController[eid]->isSensorDefect()) {
-                    addStringP(PSTR(" def "));
-                    break;
-                } else if (tempController[eid]->isSensorDecoupled()) {
-                    addStringP(PSTR(" dec "));
-                    break;
-                }
-            }
-#if EXTRUDER_JAM_CONTROL
-            if (tempController[eid]->isJammed()) {
-                if (++beepdelay > 10)
-                    beepdelay = 0; // beep every 10 seconds
-                if (beepdelay == 1)
-                    BEEP_LONG;
-                addStringP(PSTR(" jam "));
+        uint8_t eid = NUM_EXTRUDER; // default = BED if c2 not specified extruder number
+        if (c2 == 'c')
+            eid = Extruder::current->id;
+        else if (c2 >= '0' && c2 <= '9')
+            eid = c2 - '0';
+        if (Printer::isAnyTempsensorDefect()) {
+            if (eid == 0 && ++beepdelay > 30)
+                beepdelay = 0; // beep every 30 seconds
+            if (beepdelay == 1)
+                BEEP_LONG;
+            if (tempController[eid]->isSensorDefect()) {
+                addStringP(PSTR(" def "));
+                break;
+            } else if (tempController[eid]->isSensorDecoupled()) {
+                addStringP(PSTR(" dec "));
                 break;
             }
+        }
+#if EXTRUDER_JAM_CONTROL
+        if (tempController[eid]->isJammed()) {
+            if (++beepdelay > 10)
+                beepdelay = 0; // beep every 10 seconds
+            if (beepdelay == 1)
+                BEEP_LONG;
+            addStringP(PSTR(" jam "));
+            break;
+        }
 #endif
 #endif
-            if (c2 == 'c')
-                fvalue = Extruder::current->tempControl.currentTemperatureC;
-            else if (c2 >= '0' && c2 <= '9')
-                fvalue = extruder[c2 - '0'].tempControl.currentTemperatureC;
-            else if (c2 == 'b')
-                fvalue = Extruder::getHeatedBedTemperature();
-            else if (c2 == 'B') {
-                ivalue = 0;
-                fvalue = Extruder::getHeatedBedTemperature();
-            }
+        if (c2 == 'c')
+            fvalue = Extruder::current->tempControl.currentTemperatureC;
+        else if (c2 >= '0' && c2 <= '9')
+            fvalue = extruder[c2 - '0'].tempControl.currentTemperatureC;
+        else if (c2 == 'b')
+            fvalue = Extruder::getHeatedBedTemperature();
+        else if (c2 == 'B') {
+            ivalue = 0;
+            fvalue = Extruder::getHeatedBedTemperature();
+        }
 #if FAN_THERMO_PIN > -1
-            else if (c2 == 't') {
-                fvalue = thermoController.currentTemperatureC;
-                ivalue = 0;
-            }
-#endif
-            addFloat(fvalue, 3, ivalue);
-            break;
+        else if (c2 == 't') {
+            fvalue = thermoController.currentTemperatureC;
+            ivalue = 0;
         }
-        case 'E': // Target extruder temperature
-            if (c2 == 'c')
-                fvalue = Extruder::current->tempControl.targetTemperatureC;
-            else if (c2 >= '0' && c2 <= '9')
-                fvalue = extruder[c2 - '0'].tempControl.targetTemperatureC;
+#endif
+        addFloat(fvalue, 3, ivalue);
+        break;
+    }
+    case 'E': // Target extruder temperature
+        if (c2 == 'c')
+            fvalue = Extruder::current->tempControl.targetTemperatureC;
+        else if (c2 >= '0' && c2 <= '9')
+            fvalue = extruder[c2 - '0'].tempControl.targetTemperatureC;
 #if HAVE_HEATED_BED
-            else if (c2 == 'b')
-                fvalue = heatedBedController.targetTemperatureC;
+        else if (c2 == 'b')
+            fvalue = heatedBedController.targetTemperatureC;
 #endif
-            addFloat(fvalue, 3, 0 /*UI_TEMP_PRECISION*/);
-            break;
+        addFloat(fvalue, 3, 0 /*UI_TEMP_PRECISION*/);
+        break;
 #if FAN_PIN > -1 && FEATURE_FAN_CONTROL
-        case 'F': // FAN speed
-            if (c2 == 's')
-                addInt(floor(Printer::getFanSpeed() * 100 / 255 + 0.5f), 3);
-            else if (c2 == 'S')
-                addInt(floor(Printer::getFan2Speed() * 100 / 255 + 0.5f), 3);
-            else if (c2 == 'i')
-                addStringP((Printer::flag2 & PRINTER_FLAG2_IGNORE_M106_COMMAND) ? ui_selected : ui_unselected);
-            break;
+    case 'F': // FAN speed
+        if (c2 == 's')
+            addInt(floor(Printer::getFanSpeed() * 100 / 255 + 0.5f), 3);
+        else if (c2 == 'S')
+            addInt(floor(Printer::getFan2Speed() * 100 / 255 + 0.5f), 3);
+        else if (c2 == 'i')
+            addStringP((Printer::flag2 & PRINTER_FLAG2_IGNORE_M106_COMMAND) ? ui_selected : ui_unselected);
+        break;
 #endif
-        case 'f':
-            if (c2 >= 'x' && c2 <= 'z')
-                addFloat(Printer::maxFeedrate[c2 - 'x'], 5, 0);
-            else if (c2 >= 'X' && c2 <= 'Z')
-                addFloat(Printer::homingFeedrate[c2 - 'X'], 5, 0);
-            break;
-        case 'i':
-            if (c2 == 's')
-                addInt(stepperInactiveTime / 60000, 3);
-            else if (c2 == 'p')
-                addInt(maxInactiveTime / 60000, 3);
-            break;
-        case 'O': // ops related stuff
-            break;
-        case 'P':            // Print state related
-            if (c2 == 'n') { // print name
-                addString(Printer::printName);
-            } else if (c2 == 'l') {
-                addInt(Printer::currentLayer, 0);
-            } else if (c2 == 'L') {
-                addInt(Printer::maxLayer, 0);
-            } else if (c2 == 'p') {
-                addFloat(Printer::progress, 3, 1);
-            }
-            break;
-        case 'p': // preheat related
-            if (c2 >= '0' && c2 <= '6') {
-                addInt(extruder[c2 - '0'].tempControl.preheatTemperature, 3, ' ');
+    case 'f':
+        if (c2 >= 'x' && c2 <= 'z')
+            addFloat(Printer::maxFeedrate[c2 - 'x'], 5, 0);
+        else if (c2 >= 'X' && c2 <= 'Z')
+            addFloat(Printer::homingFeedrate[c2 - 'X'], 5, 0);
+        break;
+    case 'i':
+        if (c2 == 's')
+            addInt(stepperInactiveTime / 60000, 3);
+        else if (c2 == 'p')
+            addInt(maxInactiveTime / 60000, 3);
+        break;
+    case 'O': // ops related stuff
+        break;
+    case 'P':            // Print state related
+        if (c2 == 'n') { // print name
+            addString(Printer::printName);
+        } else if (c2 == 'l') {
+            addInt(Printer::currentLayer, 0);
+        } else if (c2 == 'L') {
+            addInt(Printer::maxLayer, 0);
+        } else if (c2 == 'p') {
+            addFloat(Printer::progress, 3, 1);
+        }
+        break;
+    case 'p': // preheat related
+        if (c2 >= '0' && c2 <= '6') {
+            addInt(extruder[c2 - '0'].tempControl.preheatTemperature, 3, ' ');
 #if HAVE_HEATED_BED
-            } else if (c2 == 'b') {
-                addInt(heatedBedController.preheatTemperature, 3, ' ');
+        } else if (c2 == 'b') {
+            addInt(heatedBedController.preheatTemperature, 3, ' ');
 #endif
-            } else if (c2 == 'c') {
-                addInt(Extruder::current->tempControl.preheatTemperature, 3, ' ');
-            }
-            break;
-        case 'l':
-            if (c2 == 'a')
-                addInt(lastAction, 4);
+        } else if (c2 == 'c') {
+            addInt(Extruder::current->tempControl.preheatTemperature, 3, ' ');
+        }
+        break;
+    case 'l':
+        if (c2 == 'a')
+            addInt(lastAction, 4);
 #if defined(CASE_LIGHTS_PIN) && CASE_LIGHTS_PIN >= 0
-            else if (c2 == 'o')
-                addStringOnOff(Printer::lightOn); // Lights on/off
+        else if (c2 == 'o')
+            addStringOnOff(Printer::lightOn); // Lights on/off
 #endif
 #if FEATURE_AUTOLEVEL
-            else if (c2 == 'l')
-                addStringOnOff((Printer::isAutolevelActive())); // Autolevel on/off
+        else if (c2 == 'l')
+            addStringOnOff((Printer::isAutolevelActive())); // Autolevel on/off
 #endif
-            break;
-        case 'o':
-            if (c2 == 's') {
+        break;
+    case 'o':
+        if (c2 == 's') {
 #if SDSUPPORT
-                if (sd.sdactive && sd.sdmode && !statusMsg[0]) {
-                    addStringP(Com::translatedF(UI_TEXT_PRINT_POS_ID));
-                    float percent;
-                    if (sd.filesize < 2000000)
-                        percent = sd.sdpos * 100.0 / sd.filesize;
-                    else
-                        percent = (sd.sdpos >> 8) * 100.0 / (sd.filesize >> 8);
-                    addFloat(percent, 3, 1);
-                    if (col < MAX_COLS)
-                        uid.printCols[col++] = '%';
-                } else
+            if (sd.sdactive && sd.sdmode && !statusMsg[0]) {
+                addStringP(Com::translatedF(UI_TEXT_PRINT_POS_ID));
+                float percent;
+                if (sd.filesize < 2000000)
+                    percent = sd.sdpos * 100.0 / sd.filesize;
+                else
+                    percent = (sd.sdpos >> 8) * 100.0 / (sd.filesize >> 8);
+                addFloat(percent, 3, 1);
+                if (col < MAX_COLS)
+                    uid.printCols[col++] = '%';
+            } else
 #endif
-                {
-                    parse(statusMsg, true);
-                }
-                break;
-            }
-            if (c2 == 'c') {
-                addLong(baudrate, 6);
-                break;
+            {
+                parse(statusMsg, true);
             }
-            if (c2 == 'e') {
-                if (errorMsg != 0)
-                    addStringP((char PROGMEM*)errorMsg);
-                break;
-            }
-            if (c2 == 'B') {
-                addInt((int)PrintLine::linesCount, 2);
-                break;
-            }
-            if (c2 == 'f') {
-                addInt(Printer::extrudeMultiply, 3);
-                break;
-            }
-            if (c2 == 'm') {
-                addInt(Printer::feedrateMultiply, 3);
-                break;
-            }
-            if (c2 == 'n') {
-                addInt(Extruder::current->id + 1, 1);
-                break;
-            }
-            if (c2 == 'p') {
-                // pwm position
+            break;
+        }
+        if (c2 == 'c') {
+            addLong(baudrate, 6);
+            break;
+        }
+        if (c2 == 'e') {
+            if (errorMsg != 0)
+                addStringP((char PROGMEM*)errorMsg);
+            break;
+        }
+        if (c2 == 'B') {
+            addInt((int)PrintLine::linesCount, 2);
+            break;
+        }
+        if (c2 == 'f') {
+            addInt(Printer::extrudeMultiply, 3);
+            break;
+        }
+        if (c2 == 'm') {
+            addInt(Printer::feedrateMultiply, 3);
+            break;
+        }
+        if (c2 == 'n') {
+            addInt(Extruder::current->id + 1, 1);
+            break;
+        }
+        if (c2 == 'p') {
+            // pwm position
 #if SUPPORT_LASER
-                if (Printer::mode == PRINTER_MODE_LASER) {
-                    if (LaserDriver::intens < LASER_PWM_MAX) {
-                        float power = LaserDriver::intens * LASER_WATT / LASER_PWM_MAX; // Output Power = DIODEPower / Resolution * Value)
-                        addFloat(power, 2, 1);
-                    } else
-                        addStringP(PSTR("Max."));
-                }
+            if (Printer::mode == PRINTER_MODE_LASER) {
+                if (LaserDriver::intens < LASER_PWM_MAX) {
+                    float power = LaserDriver::intens * LASER_WATT / LASER_PWM_MAX; // Output Power = DIODEPower / Resolution * Value)
+                    addFloat(power, 2, 1);
+                } else
+                    addStringP(PSTR("Max."));
+            }
 #endif
 
 #if SUPPORT_CNC
-                if (Printer::mode == PRINTER_MODE_CNC) {
-                    if (CNCDriver::spindleRpm < CNC_RPM_MAX)
-                        addInt(CNCDriver::spindleRpm, 5);
-                    else
-                        addStringP(PSTR("Max."));
-                }
-#endif
-                break;
+            if (Printer::mode == PRINTER_MODE_CNC) {
+                if (CNCDriver::spindleRpm < CNC_RPM_MAX)
+                    addInt(CNCDriver::spindleRpm, 5);
+                else
+                    addStringP(PSTR("Max."));
             }
-            //#########
+#endif
+            break;
+        }
+        //#########
 
 #if FEATURE_SERVO > 0 && UI_SERVO_CONTROL > 0
-            if (c2 == 'S') {
-                addInt(servoPosition, 4);
-                break;
-            }
+        if (c2 == 'S') {
+            addInt(servoPosition, 4);
+            break;
+        }
 #endif
 #if FEATURE_BABYSTEPPING
-            if (c2 == 'Y') {
-                //                addInt(zBabySteps,0);
-                addFloat(static_cast<float>(Printer::zBabysteps) * Printer::invAxisStepsPerMM[Z_AXIS], 2, 2);
-                break;
-            }
+        if (c2 == 'Y') {
+            //                addInt(zBabySteps,0);
+            addFloat(static_cast<float>(Printer::zBabysteps) * Printer::invAxisStepsPerMM[Z_AXIS], 2, 2);
+            break;
+        }
 #endif
-            // Extruder output level
-            if (c2 >= '0' && c2 <= '9')
-                ivalue = pwm_pos[c2 - '0'];
+        // Extruder output level
+        if (c2 >= '0' && c2 <= '9')
+            ivalue = pwm_pos[c2 - '0'];
 #if HAVE_HEATED_BED
-            else if (c2 == 'b')
-                ivalue = pwm_pos[heatedBedController.pwmIndex];
-#endif
-            else if (c2 == 'C')
-                ivalue = pwm_pos[Extruder::current->id];
-            ivalue = (ivalue * 100) / 255;
-            addInt(ivalue, 3);
-            if (col < MAX_COLS)
-                uid.printCols[col++] = '%';
-            break;
-        case 's': // Endstop positions
-            if (c2 == 'x') {
+        else if (c2 == 'b')
+            ivalue = pwm_pos[heatedBedController.pwmIndex];
+#endif
+        else if (c2 == 'C')
+            ivalue = pwm_pos[Extruder::current->id];
+        ivalue = (ivalue * 100) / 255;
+        addInt(ivalue, 3);
+        if (col < MAX_COLS)
+            uid.printCols[col++] = '%';
+        break;
+    case 's': // Endstop positions
+        if (c2 == 'x') {
 #if (X_MIN_PIN > -1) && MIN_HARDWARE_ENDSTOP_X
-                addStringOnOff(Endstops::xMin());
+            addStringOnOff(Endstops::xMin());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            }
-            if (c2 == 'X')
+        }
+        if (c2 == 'X')
 #if (X_MAX_PIN > -1) && MAX_HARDWARE_ENDSTOP_X
-                addStringOnOff(Endstops::xMax());
+            addStringOnOff(Endstops::xMax());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            if (c2 == 'y')
+        if (c2 == 'y')
 #if (Y_MIN_PIN > -1) && MIN_HARDWARE_ENDSTOP_Y
-                addStringOnOff(Endstops::yMin());
+            addStringOnOff(Endstops::yMin());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            if (c2 == 'Y')
+        if (c2 == 'Y')
 #if (Y_MAX_PIN > -1) && MAX_HARDWARE_ENDSTOP_Y
-                addStringOnOff(Endstops::yMax());
+            addStringOnOff(Endstops::yMax());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            if (c2 == 'z')
+        if (c2 == 'z')
 #if (Z_MIN_PIN > -1) && MIN_HARDWARE_ENDSTOP_Z
-                addStringOnOff(Endstops::zMin());
+            addStringOnOff(Endstops::zMin());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            if (c2 == 'Z')
+        if (c2 == 'Z')
 #if (Z_MAX_PIN > -1) && MAX_HARDWARE_ENDSTOP_Z
-                addStringOnOff(Endstops::zMax());
+            addStringOnOff(Endstops::zMax());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            if (c2 == 'P')
+        if (c2 == 'P')
 #if (Z_PROBE_PIN > -1)
-                addStringOnOff(Endstops::zProbe());
+            addStringOnOff(Endstops::zProbe());
 #else
-                addStringP(Com::translatedF(UI_TEXT_NA_ID));
+            addStringP(Com::translatedF(UI_TEXT_NA_ID));
 #endif
-            break;
-        case 'S':
-            if (c2 >= 'x' && c2 <= 'z')
-                addFloat(Printer::axisStepsPerMM[c2 - 'x'], 3, 1);
-            if (c2 == 'e')
-                addFloat(Extruder::current->stepsPerMM, 3, 1);
-            break;
-        case 'T': // Print offsets
-            if (c2 == '2')
-                addFloat(-Printer::coordinateOffset[Z_AXIS], 2, 2);
-            else
-                addFloat(-Printer::coordinateOffset[c2 - '0'], 4, 0);
-            break;
-        case 'U':
-            if (c2 == 't') { // Printing time
+        break;
+    case 'S':
+        if (c2 >= 'x' && c2 <= 'z')
+            addFloat(Printer::axisStepsPerMM[c2 - 'x'], 3, 1);
+        if (c2 == 'e')
+            addFloat(Extruder::current->stepsPerMM, 3, 1);
+        break;
+    case 'T': // Print offsets
+        if (c2 == '2')
+            addFloat(-Printer::coordinateOffset[Z_AXIS], 2, 2);
+        else
+            addFloat(-Printer::coordinateOffset[c2 - '0'], 4, 0);
+        break;
+    case 'U':
+        if (c2 == 't') { // Printing time
 #if EEPROM_MODE
-                bool alloff = true;
+            bool alloff = true;
 #if NUM_TEMPERATURE_LOOPS > 0
-                for (uint8_t i = 0; i < NUM_EXTRUDER; i++)
-                    if (tempController[i]->targetTemperatureC > 15)
-                        alloff = false;
-#endif
-                long seconds = (alloff ? 0 : (HAL::timeInMilliseconds() - Printer::msecondsPrinting) / 1000) + HAL::eprGetInt32(EPR_PRINTING_TIME);
-                long tmp = seconds / 86400;
-                seconds -= tmp * 86400;
-                addInt(tmp, 5);
-                addStringP(Com::translatedF(UI_TEXT_PRINTTIME_DAYS_ID));
-                tmp = seconds / 3600;
-                addInt(tmp, 2);
-                addStringP(Com::translatedF(UI_TEXT_PRINTTIME_HOURS_ID));
-                seconds -= tmp * 3600;
-                tmp = seconds / 60;
-                addInt(tmp, 2, '0');
-                addStringP(Com::translatedF(UI_TEXT_PRINTTIME_MINUTES_ID));
-#endif
-            } else if (c2 == 'f') { // Filament usage
+            for (uint8_t i = 0; i < NUM_EXTRUDER; i++)
+                if (tempController[i]->targetTemperatureC > 15)
+                    alloff = false;
+#endif
+            long seconds = (alloff ? 0 : (HAL::timeInMilliseconds() - Printer::msecondsPrinting) / 1000) + HAL::eprGetInt32(EPR_PRINTING_TIME);
+            long tmp = seconds / 86400;
+            seconds -= tmp * 86400;
+            addInt(tmp, 5);
+            addStringP(Com::translatedF(UI_TEXT_PRINTTIME_DAYS_ID));
+            tmp = seconds / 3600;
+            addInt(tmp, 2);
+            addStringP(Com::translatedF(UI_TEXT_PRINTTIME_HOURS_ID));
+            seconds -= tmp * 3600;
+            tmp = seconds / 60;
+            addInt(tmp, 2, '0');
+            addStringP(Com::translatedF(UI_TEXT_PRINTTIME_MINUTES_ID));
+#endif
+        } else if (c2 == 'f') { // Filament usage
 #if EEPROM_MODE
-                float dist = Printer::filamentPrinted * 0.001 + HAL::eprGetFloat(EPR_PRINTING_DISTANCE);
+            float dist = Printer::filamentPrinted * 0.001 + HAL::eprGetFloat(EPR_PRINTING_DISTANCE);
 #else
-                float dist = Printer::filamentPrinted * 0.001;
+            float dist = Printer::filamentPrinted * 0.001;
 #endif
-                addFloat(dist, (dist > 9999 ? 6 : 4), (dist > 9999 ? 0 : 1));
-            } else if (c2 == 'k') { // Filament usage in km
+            addFloat(dist, (dist > 9999 ? 6 : 4), (dist > 9999 ? 0 : 1));
+        } else if (c2 == 'k') { // Filament usage in km
 #if EEPROM_MODE
-                float dist = 0.001 * (Printer::filamentPrinted * 0.001 + HAL::eprGetFloat(EPR_PRINTING_DISTANCE));
+            float dist = 0.001 * (Printer::filamentPrinted * 0.001 + HAL::eprGetFloat(EPR_PRINTING_DISTANCE));
 #else
-                float dist = 0.001 * (Printer::filamentPrinted * 0.001);
+            float dist = 0.001 * (Printer::filamentPrinted * 0.001);
 #endif
-                addFloat(dist, (dist > 999 ? 5 : 3), (dist > 9999 ? 1 : 2));
-            } else if (c2 == 'h') { // Printing time in hours
+            addFloat(dist, (dist > 999 ? 5 : 3), (dist > 9999 ? 1 : 2));
+        } else if (c2 == 'h') { // Printing time in hours
 #if EEPROM_MODE
-                bool alloff = true;
+            bool alloff = true;
 #if NUM_TEMPERATURE_LOOPS > 0
-                for (uint8_t i = 0; i < NUM_EXTRUDER; i++)
-                    if (tempController[i]->targetTemperatureC > 15)
-                        alloff = false;
+            for (uint8_t i = 0; i < NUM_EXTRUDER; i++)
+                if (tempController[i]->targetTemperatureC > 15)
+                    alloff = false;
 #endif
-                long seconds = (alloff ? 0 : (HAL::timeInMilliseconds() - Printer::msecondsPrinting) / 1000) + HAL::eprGetInt32(EPR_PRINTING_TIME);
-                long tmp = seconds / 3600;
-                addLong(tmp, 5); // 11 years of printing!
+            long seconds = (alloff ? 0 : (HAL::timeInMilliseconds() - Printer::msecondsPrinting) / 1000) + HAL::eprGetInt32(EPR_PRINTING_TIME);
+            long tmp = seconds / 3600;
+            addLong(tmp, 5); // 11 years of printing!
 #endif
+        }
+        break;
+
+    case 'x':
+        if (c2 >= '0' && c2 <= '7') {
+            if (c2 == '4') { // this sequence save 14 bytes of flash
+                addFloat(Printer::filamentPrinted * 0.001, 3, 2);
+                break;
             }
-            break;
 
-        case 'x':
-            if (c2 >= '0' && c2 <= '7') {
-                if (c2 == '4') { // this sequence save 14 bytes of flash
-                    addFloat(Printer::filamentPrinted * 0.001, 3, 2);
+            if ((c2 >= '0' && c2 <= '2') || (c2 >= '5' && c2 <= '7')) {
+                if (Printer::isHoming()) {
+                    addStringP(PSTR(" Homing"));
                     break;
-                }
-
-                if ((c2 >= '0' && c2 <= '2') || (c2 >= '5' && c2 <= '7')) {
-                    if (Printer::isHoming()) {
-                        addStringP(PSTR(" Homing"));
+                } else {
+                    if (Printer::isAnimation() && ((c2 == '0' && !Printer::isXHomed()) || (c2 == '1' && !Printer::isYHomed()) || (c2 == '2' && !Printer::isZHomed()))) {
+                        addStringP(PSTR("   ?.??"));
                         break;
-                    } else {
-                        if (Printer::isAnimation() && ((c2 == '0' && !Printer::isXHomed()) || (c2 == '1' && !Printer::isYHomed()) || (c2 == '2' && !Printer::isZHomed()))) {
-                            addStringP(PSTR("   ?.??"));
-                            break;
-                        }
                     }
                 }
-                if (c2 == '0')
-                    fvalue = Printer::realXPosition();
-                else if (c2 == '1')
-                    fvalue = Printer::realYPosition();
-                else if (c2 == '2')
-                    fvalue = Printer::realZPosition();
+            }
+            if (c2 == '0')
+                fvalue = Printer::realXPosition();
+            else if (c2 == '1')
+                fvalue = Printer::realYPosition();
+            else if (c2 == '2')
+                fvalue = Printer::realZPosition();
 
-                //################ Workpiece Coordinates#########################################################
+            //################ Workpiece Coordinates#########################################################
 
-                else if (c2 == '5')
-                    fvalue = Printer::currentPosition[X_AXIS] + Printer::coordinateOffset[X_AXIS];
-                else if (c2 == '6')
-                    fvalue = Printer::currentPosition[Y_AXIS] + Printer::coordinateOffset[Y_AXIS];
-                else if (c2 == '7')
-                    fvalue = Printer::currentPosition[Z_AXIS] + Printer::coordinateOffset[Z_AXIS];
+            else if (c2 == '5')
+                fvalue = Printer::currentPosition[X_AXIS] + Printer::coordinateOffset[X_AXIS];
+            else if (c2 == '6')
+                fvalue = Printer::currentPosition[Y_AXIS] + Printer::coordinateOffset[Y_AXIS];
+            else if (c2 == '7')
+                fvalue = Printer::currentPosition[Z_AXIS] + Printer::coordinateOffset[Z_AXIS];
 
-                //############ End Workpiece Coordinates #########################################################
+            //############ End Workpiece Coordinates #########################################################
 
-                else
-                    fvalue = (float)Printer::currentPositionSteps[E_AXIS] * Printer::invAxisStepsPerMM[E_AXIS];
+            else
+                fvalue = (float)Printer::currentPositionSteps[E_AXIS] * Printer::invAxisStepsPerMM[E_AXIS];
 
-                addFloat(fvalue, 4, 2);
-            }
+            addFloat(fvalue, 4, 2);
+        }
 
-            else if (c2 >= 'a' && c2 <= 'f') {
-                //  %xa-%xf : Extruder state icon 0x08 or 0x09 or 0x0a (off) - works only with graphic displays!
-                fast8_t exid = c2 - 'a';
-                TemperatureController& t = extruder[exid].tempControl;
-                if (t.targetTemperatureC < 30)
-                    addChar(0x0a);
-                else
-                    addChar((t.currentTemperatureC + 4 < t.targetTemperatureC) && Printer::isAnimation() ? 0x08 : 0x09);
-                break;
-            }
+        else if (c2 >= 'a' && c2 <= 'f') {
+            //  %xa-%xf : Extruder state icon 0x08 or 0x09 or 0x0a (off) - works only with graphic displays!
+            fast8_t exid = c2 - 'a';
+            TemperatureController& t = extruder[exid].tempControl;
+            if (t.targetTemperatureC < 30)
+                addChar(0x0a);
+            else
+                addChar((t.currentTemperatureC + 4 < t.targetTemperatureC) && Printer::isAnimation() ? 0x08 : 0x09);
+            break;
+        }
 #if HAVE_HEATED_BED
-            else if (c2 == 'B') {
-                //  %xB : Bed icon state 0x0c or 0x0d or 0x0b (off) Bed state - works only with graphic displays!
-                if (heatedBedController.targetTemperatureC < 30)
-                    addChar(0x0b);
-                else
-                    addChar((heatedBedController.currentTemperatureC + 2 < heatedBedController.targetTemperatureC) && Printer::isAnimation() ? 0x0c : 0x0d);
-            }
+        else if (c2 == 'B') {
+            //  %xB : Bed icon state 0x0c or 0x0d or 0x0b (off) Bed state - works only with graphic displays!
+            if (heatedBedController.targetTemperatureC < 30)
+                addChar(0x0b);
+            else
+                addChar((heatedBedController.currentTemperatureC + 2 < heatedBedController.targetTemperatureC) && Printer::isAnimation() ? 0x0c : 0x0d);
+        }
 #endif
-            break;
+        break;
 
-        case 'X': // Extruder related
+    case 'X': // Extruder related
 #if NUM_EXTRUDER > 0
-            if (c2 >= '0' && c2 <= '9') {
-                addStringP(Extruder::current->id == c2 - '0' ? ui_selected : ui_unselected);
-            } else if (c2 == 'i') {
-                addFloat(currHeaterForSetup->pidIGain, 4, 2);
-            } else if (c2 == 'p') {
-                addFloat(currHeaterForSetup->pidPGain, 4, 2);
-            } else if (c2 == 'd') {
-                addFloat(currHeaterForSetup->pidDGain, 4, 2);
-            } else if (c2 == 'm') {
-                addInt(currHeaterForSetup->pidDriveMin, 3);
-            } else if (c2 == 'M') {
-                addInt(currHeaterForSetup->pidDriveMax, 3);
-            } else if (c2 == 'D') {
-                addInt(currHeaterForSetup->pidMax, 3);
-            } else if (c2 == 'w') {
-                addInt(Extruder::current->watchPeriod, 4);
-            }
+        if (c2 >= '0' && c2 <= '9') {
+            addStringP(Extruder::current->id == c2 - '0' ? ui_selected : ui_unselected);
+        } else if (c2 == 'i') {
+            addFloat(currHeaterForSetup->pidIGain, 4, 2);
+        } else if (c2 == 'p') {
+            addFloat(currHeaterForSetup->pidPGain, 4, 2);
+        } else if (c2 == 'd') {
+            addFloat(currHeaterForSetup->pidDGain, 4, 2);
+        } else if (c2 == 'm') {
+            addInt(currHeaterForSetup->pidDriveMin, 3);
+        } else if (c2 == 'M') {
+            addInt(currHeaterForSetup->pidDriveMax, 3);
+        } else if (c2 == 'D') {
+            addInt(currHeaterForSetup->pidMax, 3);
+        } else if (c2 == 'w') {
+            addInt(Extruder::current->watchPeriod, 4);
+        }
 #if RETRACT_DURING_HEATUP
-            else if (c2 == 'T') {
-                addInt(Extruder::current->waitRetractTemperature, 4);
-            } else if (c2 == 'U') {
-                addInt(Extruder::current->waitRetractUnits, 2);
-            }
+        else if (c2 == 'T') {
+            addInt(Extruder::current->waitRetractTemperature, 4);
+        } else if (c2 == 'U') {
+            addInt(Extruder::current->waitRetractUnits, 2);
+        }
 #endif
-            else if (c2 == 'h') {
-                uint8_t hm = currHeaterForSetup->heatManager;
-                if (hm == HTR_PID)
-                    addStringP(Com::translatedF(UI_TEXT_STRING_HM_PID_ID));
-                else if (hm == HTR_DEADTIME)
-                    addStringP(Com::translatedF(UI_TEXT_STRING_HM_DEADTIME_ID));
-                else if (hm == HTR_SLOWBANG)
-                    addStringP(Com::translatedF(UI_TEXT_STRING_HM_SLOWBANG_ID));
-                else
-                    addStringP(Com::translatedF(UI_TEXT_STRING_HM_BANGBANG_ID));
-            }
+        else if (c2 == 'h') {
+            uint8_t hm = currHeaterForSetup->heatManager;
+            if (hm == HTR_PID)
+                addStringP(Com::translatedF(UI_TEXT_STRING_HM_PID_ID));
+            else if (hm == HTR_DEADTIME)
+                addStringP(Com::translatedF(UI_TEXT_STRING_HM_DEADTIME_ID));
+            else if (hm == HTR_SLOWBANG)
+                addStringP(Com::translatedF(UI_TEXT_STRING_HM_SLOWBANG_ID));
+            else
+                addStringP(Com::translatedF(UI_TEXT_STRING_HM_BANGBANG_ID));
+        }
 #if USE_ADVANCE
 #if ENABLE_QUADRATIC_ADVANCE
-            else if (c2 == 'a') {
-                addFloat(Extruder::current->advanceK, 3, 0);
-            }
+        else if (c2 == 'a') {
+            addFloat(Extruder::current->advanceK, 3, 0);
+        }
 #endif
-            else if (c2 == 'l') {
-                addFloat(Extruder::current->advanceL, 3, 0);
-            }
+        else if (c2 == 'l') {
+            addFloat(Extruder::current->advanceL, 3, 0);
+        }
 #endif
-            else if (c2 == 'x') {
-                addFloat(Extruder::current->xOffset * Printer::invAxisStepsPerMM[X_AXIS], 3, 2);
-            } else if (c2 == 'y') {
-                addFloat(Extruder::current->yOffset * Printer::invAxisStepsPerMM[Y_AXIS], 3, 2);
-            } else if (c2 == 'z') {
-                addFloat(Extruder::current->zOffset * Printer::invAxisStepsPerMM[Z_AXIS], 3, 2);
-            } else if (c2 == 'f') {
-                addFloat(Extruder::current->maxStartFeedrate, 5, 0);
-            } else if (c2 == 'F') {
-                addFloat(Extruder::current->maxFeedrate, 5, 0);
-            } else if (c2 == 'A') {
-                addFloat(Extruder::current->maxAcceleration, 5, 0);
-            }
+        else if (c2 == 'x') {
+            addFloat(Extruder::current->xOffset * Printer::invAxisStepsPerMM[X_AXIS], 3, 2);
+        } else if (c2 == 'y') {
+            addFloat(Extruder::current->yOffset * Printer::invAxisStepsPerMM[Y_AXIS], 3, 2);
+        } else if (c2 == 'z') {
+            addFloat(Extruder::current->zOffset * Printer::invAxisStepsPerMM[Z_AXIS], 3, 2);
+        } else if (c2 == 'f') {
+            addFloat(Extruder::current->maxStartFeedrate, 5, 0);
+        } else if (c2 == 'F') {
+            addFloat(Extruder::current->maxFeedrate, 5, 0);
+        } else if (c2 == 'A') {
+            addFloat(Extruder::current->maxAcceleration, 5, 0);
+        }
 #endif
-            break;
-        case 'y':
+        break;
+    case 'y':
 #if DRIVE_SYSTEM == DELTA
-            if (c2 >= '0' && c2 <= '3')
-                fvalue = (float)Printer::currentNonlinearPositionSteps[c2 - '0'] * Printer::invAxisStepsPerMM[c2 - '0'];
-            addFloat(fvalue, 3, 2);
+        if (c2 >= '0' && c2 <= '3')
+            fvalue = (float)Printer::currentNonlinearPositionSteps[c2 - '0'] * Printer::invAxisStepsPerMM[c2 - '0'];
+        addFloat(fvalue, 3, 2);
 #endif
-            break;
-        case 'z':
+        break;
+    case 'z':
 #if EEPROM_MODE != 0 && FEATURE_Z_PROBE
-            if (c2 == 'h') { // write z probe height
-                addFloat(EEPROM::zProbeHeight(), 3, 2);
-                break;
-            }
-#endif
-            if (c2 == '2')
-                addFloat(-Printer::coordinateOffset[Z_AXIS], 2, 2);
-            else
-                addFloat(-Printer::coordinateOffset[c2 - '0'], 4, 0);
-            break;
-        case 'w':
-            if (c2 >= '0' && c2 <= '7') {
-                addLong(Printer::wizardStack[c2 - '0'].l);
-            }
-            break;
-        case 'W':
-            if (c2 >= '0' && c2 <= '7') {
-                addFloat(Printer::wizardStack[c2 - '0'].f, 0, 2);
-            } else if (c2 == 'A') {
-                addFloat(Printer::wizardStack[0].f, 0, 1);
-            } else if (c2 == 'B') {
-                addFloat(Printer::wizardStack[1].f, 0, 1);
-            }
+        if (c2 == 'h') { // write z probe height
+            addFloat(EEPROM::zProbeHeight(), 3, 2);
             break;
         }
+#endif
+        if (c2 == '2')
+            addFloat(-Printer::coordinateOffset[Z_AXIS], 2, 2);
+        else
+            addFloat(-Printer::coordinateOffset[c2 - '0'], 4, 0);
+        break;
+    case 'w':
+        if (c2 >= '0' && c2 <= '7') {
+            addLong(Printer::wizardStack[c2 - '0'].l);
+        }
+        break;
+    case 'W':
+        if (c2 >= '0' && c2 <= '7') {
+            addFloat(Printer::wizardStack[c2 - '0'].f, 0, 2);
+        } else if (c2 == 'A') {
+            addFloat(Printer::wizardStack[0].f, 0, 1);
+        } else if (c2 == 'B') {
+            addFloat(Printer::wizardStack[1].f, 0, 1);
+        }
+        break;
     }
-    uid.printCols[col] = 0;
 }
 
 void UIDisplay::showLanguageSelectionWizard() {
@@ -2035,64 +2147,164 @@ void UIDisplay::setProgress(int percent, int eta) {
 
 const UIMenu* const ui_pages[UI_NUM_PAGES] PROGMEM = UI_PAGES;
 uint16_t nFilesOnCard;
-void UIDisplay::updateSDFileCount() {
 #if SDSUPPORT
-    dir_t* p = NULL;
-    FatFile* root = sd.fat.vwd();
-    FatFile file;
-    root->rewind();
-    nFilesOnCard = 0;
+#if SD_DIR_INDEX_SIZE > 0
+/* Index of the file browser directory. Slot i stores the directory entry where
+   reading shown file i << sdIndexShift starts and a hash of its long name. Built
+   by updateSDFileCount, so a list position opens its file after reading at most
+   2^sdIndexShift - 1 other files instead of all files before it. Folders with
+   more files than slots double the spacing until all files fit. The change
+   count of the firmware, see SDCard::folderChanged, and the folder's
+   modification time, size and end of used entries are stored with it to
+   detect changes. */
+static uint16_t sdIndexEntry[SD_DIR_INDEX_SIZE];
+static uint16_t sdIndexHash[SD_DIR_INDEX_SIZE];
+static uint16_t sdIndexCount = 0;
+static uint8_t sdIndexShift = 0;
+static uint16_t sdIndexEnd = 0; // First entry after the last file, 0xffff if not counted to the end
+static uint32_t sdIndexDirSize = 0;
+static uint32_t sdIndexModified = 0;
+static uint16_t sdIndexChanges = 0;
+
+static uint16_t sdNameHash(const char* name) {
+    uint16_t hash = 0;
+    while (*name)
+        hash = hash * 31 + static_cast<uint8_t>(*name++);
+    return hash;
+}
+
+/** Last write date and time of dir, 0 for the root folder which has no entry. */
+static uint32_t sdDirModified(FatFile* dir) {
+    dir_t entry;
+    if (dir->isRoot() || !dir->dirEntry(&entry))
+        return 0;
+    return (static_cast<uint32_t>(entry.lastWriteDate) << 16) | entry.lastWriteTime;
+}
+
+/** Checks that no file was created or deleted since the index was built and
+that root still has its modification time, size and entry count. Leaves the
+position of root undefined. */
+static bool sdIndexValid(FatFile* root) {
+    if (sd.folderChanges != sdIndexChanges) // A deleted file moves all files behind it
+        return false;
+    if (root->dirSize() != sdIndexDirSize || sdDirModified(root) != sdIndexModified)
+        return false;
+    if (sdIndexEnd != 0xffff) { // Files added behind the last indexed one
+        FatFile file;
+        root->seekSet(static_cast<uint32_t>(sdIndexEnd) << 5);
+        if (file.openNext(root, O_READ)) {
+            file.close();
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+/** Opens the next file of root the file browser shows and reads its long name
+into tempLongFilename. start gets the directory entry where reading started. */
+static bool openNextShownFile(FatFile* root, FatFile& file, uint16_t& start) {
+    start = root->curPosition() >> 5;
     while (file.openNext(root, O_READ)) {
         HAL::pingWatchdog();
         file.getName(tempLongFilename, LONG_FILENAME_LENGTH);
-        //while ((p = root->getLongFilename(p, NULL, 0, NULL))) {
-        // if (! (file.isFile() || file.isDir())) continue;
-        if (folderLevel >= SD_MAX_FOLDER_DEPTH && strcmp(tempLongFilename, "..") == 0) {
+        if ((uid.folderLevel >= SD_MAX_FOLDER_DEPTH && strcmp(tempLongFilename, "..") == 0) || (tempLongFilename[0] == '.' && tempLongFilename[1] != '.')) { // MAC CRAP
             file.close();
+            start = root->curPosition() >> 5;
             continue;
         }
-        if (tempLongFilename[0] == '.' && tempLongFilename[1] != '.') {
+        return true;
+    }
+    return false;
+}
+
+/** Positions root so that the next openNextShownFile returns shown file pos. */
+static void seekShownFile(FatFile* root, uint16_t pos) {
+    FatFile file;
+    uint16_t start, skip = pos;
+#if SD_DIR_INDEX_SIZE > 0
+    bool valid = sdIndexValid(root);
+    if (valid && sdIndexCount > 0) {
+        uint16_t i = RMath::min(static_cast<uint16_t>(pos >> sdIndexShift), static_cast<uint16_t>(sdIndexCount - 1));
+        root->seekSet(static_cast<uint32_t>(sdIndexEntry[i]) << 5);
+        valid = openNextShownFile(root, file, start);
+        if (valid) {
             file.close();
-            continue; // MAC CRAP
+            valid = sdNameHash(tempLongFilename) == sdIndexHash[i];
         }
+    }
+    if (!valid) // Folder changed since the index was built
+        uid.updateSDFileCount();
+    if (sdIndexCount > 0) {
+        uint16_t i = RMath::min(static_cast<uint16_t>(pos >> sdIndexShift), static_cast<uint16_t>(sdIndexCount - 1));
+        root->seekSet(static_cast<uint32_t>(sdIndexEntry[i]) << 5);
+        skip = pos - (i << sdIndexShift);
+    } else
+#endif
+        root->rewind();
+    while (skip > 0 && openNextShownFile(root, file, start)) {
+        file.close();
+        skip--;
+    }
+}
+#endif
+
+void UIDisplay::updateSDFileCount() {
+#if SDSUPPORT
+    FatFile* root = sd.fat.vwd();
+    FatFile file;
+    uint16_t start;
+    root->rewind();
+    nFilesOnCard = 0;
+#if SD_DIR_INDEX_SIZE > 0
+    sdIndexCount = 0;
+    sdIndexShift = 0;
+#endif
+    while (openNextShownFile(root, file, start)) {
+#if SD_DIR_INDEX_SIZE > 0
+        if ((nFilesOnCard & ((1 << sdIndexShift) - 1)) == 0) {
+            if (sdIndexCount == SD_DIR_INDEX_SIZE) { // Full, keep every second slot
+                for (uint16_t i = 0; i < SD_DIR_INDEX_SIZE / 2; i++) {
+                    sdIndexEntry[i] = sdIndexEntry[i << 1];
+                    sdIndexHash[i] = sdIndexHash[i << 1];
+                }
+                sdIndexCount = SD_DIR_INDEX_SIZE / 2;
+                sdIndexShift++;
+            }
+            if ((nFilesOnCard & ((1 << sdIndexShift) - 1)) == 0) {
+                sdIndexEntry[sdIndexCount] = start;
+                sdIndexHash[sdIndexCount++] = sdNameHash(tempLongFilename);
+            }
+        }
+#endif
         nFilesOnCard++;
         file.close();
         if (nFilesOnCard > 5000) // Arbitrary maximum, limited only by how long someone would scroll
-            return;
+            break;
     }
+#if SD_DIR_INDEX_SIZE > 0
+    sdIndexEnd = nFilesOnCard > 5000 ? 0xffff : start;
+    sdIndexDirSize = root->dirSize();
+    sdIndexModified = sdDirModified(root);
+    sdIndexChanges = sd.folderChanges;
+#endif
     // Com::printFLN(PSTR("FCount:"), (int32_t)nFilesOnCard);
 #endif
 }
 
 void getSDFilenameAt(uint16_t filePos, char* filename) {
 #if SDSUPPORT
-    dir_t* p = NULL;
     FatFile* root = sd.fat.vwd();
     FatFile file;
-    root->rewind();
-    while (file.openNext(root, O_READ)) {
-        HAL::pingWatchdog();
-        file.getName(tempLongFilename, LONG_FILENAME_LENGTH);
-        //while ((p = root->getLongFilename(p, NULL, 0, NULL))) {
-        // if (! (file.isFile() || file.isDir())) continue;
-        if (uid.folderLevel >= SD_MAX_FOLDER_DEPTH && strcmp(tempLongFilename, "..") == 0) {
-            file.close();
-            continue;
-        }
-        if (tempLongFilename[0] == '.' && tempLongFilename[1] != '.') {
-            file.close();
-            continue; // MAC CRAP
-        }
-        if (filePos--) {
-            file.close();
-            continue;
-        }
-        strcpy(filename, tempLongFilename);
-        if (file.isDir())
-            strcat(filename, "/"); // Set marker for directory
-        file.close();
-        break;
-    }
+    uint16_t start;
+    filename[0] = 0;
+    seekShownFile(root, filePos);
+    if (!openNextShownFile(root, file, start))
+        return;
+    strcpy(filename, tempLongFilename);
+    if (file.isDir())
+        strcat(filename, "/"); // Set marker for directory
+    file.close();
 #endif
 }
 
@@ -2133,47 +2345,25 @@ void UIDisplay::goDir(char* name) {
 /** write file names at current position to lcd */
 void sdrefresh(uint16_t& r, char cache[UI_ROWS][MAX_COLS + 1]) {
 #if SDSUPPORT
-    dir_t* p = NULL;
     uint16_t offset = uid.menuTop[uid.menuLevel];
     FatFile* root;
     FatFile file;
-    uint16_t length, skip;
+    uint16_t length, start;
 
     sd.fat.chdir(uid.cwd);
     root = sd.fat.vwd();
-    root->rewind();
     // Com::printFLN(PSTR("sdresfresh"), (int32_t)r);
-    skip = (offset > 0 ? offset - 1 : 0);
+    seekShownFile(root, offset > 0 ? offset - 1 : 0);
 
-    while (r + offset < nFilesOnCard + 1 && r < UI_ROWS && file.openNext(root, O_READ)) {
-        HAL::pingWatchdog();
-        file.getName(tempLongFilename, LONG_FILENAME_LENGTH);
+    while (r + offset < nFilesOnCard + 1 && r < UI_ROWS && openNextShownFile(root, file, start)) {
         // Com::printFLN(PSTR("File:"), tempLongFilename);
-        //while ((p = root->getLongFilename(p, NULL, 0, NULL))) {
-        // if (! (file.isFile() || file.isDir())) continue;
-        if (uid.folderLevel >= SD_MAX_FOLDER_DEPTH && strcmp(tempLongFilename, "..") == 0) {
-            file.close();
-            continue;
-        }
-        if (tempLongFilename[0] == '.' && tempLongFilename[1] != '.') {
-            file.close();
-            continue; // MAC CRAP
-        }
-        // done if past last used entry
-        // skip deleted entry and entries for . and  ..
-        // only list subdirectories and files
-        if (skip > 0) {
-            skip--;
-            file.close();
-            continue;
-        }
         uid.col = 0;
         if (r + offset == uid.menuPos[uid.menuLevel])
             uid.printCols[uid.col++] = CHAR_SELECTOR;
         else
             uid.printCols[uid.col++] = ' ';
         // print file name with possible blank fill
-        if (DIR_IS_SUBDIR(p))
+        if (file.isDir())
             uid.printCols[uid.col++] = bFOLD; // Prepend folder symbol
         length = RMath::min((int)strlen(tempLongFilename), MAX_COLS - uid.col);
         memcpy(uid.printCols + uid.col, tempLongFilename, length);
@@ -2627,7 +2817,8 @@ void UIDisplay::refreshPage() {
 #endif
 #if UI_DISPLAY_TYPE == DISPLAY_U8G
         }
-    } while (u8g_NextPage(&u8g));                                                                //end picture loop
+    } while (u8gNextPage()); //end picture loop
+    u8gFullRefresh = (u8gFullRefresh == 0 ? 15 : u8gFullRefresh - 1);
 #endif
 #endif
     Printer::toggleAnimation();
@@ -2718,10 +2909,10 @@ int UIDisplay::okAction(bool allowMoves) {
     UIMenuEntry** entries;
     UIMenuEntry* ent;
     unsigned char entType;
-    unsigned int action;
+    uintptr_t action;
 #if SDSUPPORT
     if (mtype == UI_MENU_TYPE_FILE_SELECTOR) {
-        uint8_t filePos = menuPos[menuLevel] - 1;
+        uint16_t filePos = menuPos[menuLevel] - 1;
         char filename[LONG_FILENAME_LENGTH + 1];
         if (menuPos[menuLevel] == 0) { // Selected back instead of file
             if (folderLevel > 0) {
@@ -2958,6 +3149,8 @@ void UIDisplay::adjustMenuPos() {
 }
 
 bool UIDisplay::isWizardActive() {
+    if (menuLevel == 0) // info pages have no menu, menu[0] is null
+        return false;
     UIMenu* men = (UIMenu*)menu[menuLevel];
     return (HAL::readFlashByte((PGM_P) & (men->menuType)) & 127) == 5;
 }
@@ -321,7 +321,7 @@
 struct UIMenuEntry_s {
     const char* text;    // Menu text
     uint8_t entryType;   // 0 = Info, 1 = Headline, 2 = sub menu ref, 3 = direct action command, 4 = modify action command,
-    unsigned int action; // must be int so it gets 32 bit on arm!
+    uintptr_t action;    // Action id or menu pointer, so it gets 32 bit on arm!
     uint16_t filter;     // allows dynamic menu filtering based on Printer::menuMode bits set.
     uint16_t nofilter;   // Hide if one of these bits are set
     int translation;     // Translation id
@@ -683,16 +683,16 @@ extern const int8_t encoder_table[16] PROGMEM;
 #define UI_MENU_ACTIONCOMMAND_T(name, rowId, action) UIMenuEntry name PROGMEM = { 0, 3, action, 0, 0, rowId };
 #define UI_MENU_ACTIONSELECTOR(name, row, entries) \
     UI_STRING(name##_txt, row); \
-    UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, 0, 0, 0 };
-#define UI_MENU_ACTIONSELECTOR_T(name, row, entries) UIMenuEntry name PROGMEM = { 0, 2, (unsigned int)&entries, 0, 0, row };
+    UIMenuEntry name PROGMEM = { name##_txt, 2, (uintptr_t)&entries, 0, 0, 0 };
+#define UI_MENU_ACTIONSELECTOR_T(name, row, entries) UIMenuEntry name PROGMEM = { 0, 2, (uintptr_t)&entries, 0, 0, row };
 #define UI_MENU_SUBMENU(name, row, entries) \
     UI_STRING(name##_txt, row); \
-    UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, 0, 0, 0 };
-#define UI_MENU_SUBMENU_T(name, row, entries) UIMenuEntry name PROGMEM = { 0, 2, (unsigned int)&entries, 0, 0, row };
+    UIMenuEntry name PROGMEM = { name##_txt, 2, (uintptr_t)&entries, 0, 0, 0 };
+#define UI_MENU_SUBMENU_T(name, row, entries) UIMenuEntry name PROGMEM = { 0, 2, (uintptr_t)&entries, 0, 0, row };
 #define UI_MENU_WIZARD(name, row, entries) \
     UI_STRING(name##_txt, row); \
-    UIMenuEntry name PROGMEM = { name##_txt, 5, (unsigned int)&entries, 0, 0, 0 };
-#define UI_MENU_WIZARD_T(name, row, entries) UIMenuEntry name PROGMEM = { 0, 5, (unsigned int)&entries, 0, 0, row };
+    UIMenuEntry name PROGMEM = { name##_txt, 5, (uintptr_t)&entries, 0, 0, 0 };
+#define UI_MENU_WIZARD_T(name, row, entries) UIMenuEntry name PROGMEM = { 0, 5, (uintptr_t)&entries, 0, 0, row };
 #define UI_MENU_CHANGEACTION_FILTER(name, row, action, filter, nofilter) \
     UI_STRING(name##_txt, row); \
     UIMenuEntry name PROGMEM = { name##_txt, 4, action, filter, nofilter, 0 };
@@ -703,12 +703,12 @@ extern const int8_t encoder_table[16] PROGMEM;
 #define UI_MENU_ACTIONCOMMAND_FILTER_T(name, row, action, filter, nofilter) UIMenuEntry name PROGMEM = { 0, 3, action, filter, nofilter, row };
 #define UI_MENU_ACTIONSELECTOR_FILTER(name, row, entries, filter, nofilter) \
     UI_STRING(name##_txt, row); \
-    UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, filter, nofilter, 0 };
-#define UI_MENU_ACTIONSELECTOR_FILTER_T(name, row, entries, filter, nofilter) UIMenuEntry name PROGMEM = { 0, 2, (unsigned int)&entries, filter, nofilter, row };
+    UIMenuEntry name PROGMEM = { name##_txt, 2, (uintptr_t)&entries, filter, nofilter, 0 };
+#define UI_MENU_ACTIONSELECTOR_FILTER_T(name, row, entries, filter, nofilter) UIMenuEntry name PROGMEM = { 0, 2, (uintptr_t)&entries, filter, nofilter, row };
 #define UI_MENU_SUBMENU_FILTER(name, row, entries, filter, nofilter) \
     UI_STRING(name##_txt, row); \
-    UIMenuEntry name PROGMEM = { name##_txt, 2, (unsigned int)&entries, filter, nofilter, 0 };
-#define UI_MENU_SUBMENU_FILTER_T(name, row, entries, filter, nofilter) UIMenuEntry name PROGMEM = { 0, 2, (unsigned int)&entries, filter, nofilter, row };
+    UIMenuEntry name PROGMEM = { name##_txt, 2, (uintptr_t)&entries, filter, nofilter, 0 };
+#define UI_MENU_SUBMENU_FILTER_T(name, row, entries, filter, nofilter) UIMenuEntry name PROGMEM = { 0, 2, (uintptr_t)&entries, filter, nofilter, row };
 #define UI_MENU(name, items, itemsCnt) \
     const UIMenuEntry* const name##_entries[] PROGMEM = items; \
     const UIMenu name PROGMEM = { 2, 0, itemsCnt, name##_entries };
@@ -807,6 +807,25 @@ extern const int8_t encoder_table[16] PROGMEM;
 #define MAX_COLS 28
 #endif
 #define UI_MENU_MAXLEVEL 7
+/** Number of compiled row templates UIDisplay::parse keeps. Should be at least
+the number of rows refreshed together, each entry needs 2 * UI_TEMPLATE_SEGMENTS + 4 byte. */
+#ifndef UI_TEMPLATE_CACHE
+#if CPU_ARCH == ARCH_ARM
+#define UI_TEMPLATE_CACHE 16
+#else
+#define UI_TEMPLATE_CACHE 6
+#endif
+#endif
+#define UI_TEMPLATE_SEGMENTS 12
+
+/** Template split into text runs and %xx variables, see UIDisplay::parse. */
+struct UITemplate {
+    const char* text;                     ///< Template, NULL if unused
+    uint8_t count;                        ///< Number of segments
+    uint8_t rest;                         ///< Offset of not compiled rest if segments were full, 0 = complete
+    uint8_t offset[UI_TEMPLATE_SEGMENTS]; ///< Start of segment in text
+    uint8_t length[UI_TEMPLATE_SEGMENTS]; ///< Length of text run, 0 = variable
+};
 
 #define UI_FLAG_FAST_KEY_ACTION 1
 #define UI_FLAG_SLOW_KEY_ACTION 2
@@ -866,6 +885,7 @@ public:
     void printRow(uint8_t r, char* txt, char* txt2, uint8_t changeAtCol); // Print row on display
     void printRowP(uint8_t r, PGM_P txt);
     void parse(const char* txt, bool ram); /// Parse output and write to printCols;
+    void parseVariable(char c1, char c2);
     void refreshPage();
     int executeAction(unsigned int action, bool allowMoves);
     void finishAction(unsigned int action);
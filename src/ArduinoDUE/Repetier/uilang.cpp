@@ -8427,7 +8427,7 @@ const uint8_t availableLanguages[] PROGMEM = {
 };
 
 void Com::selectLanguage(fast8_t lang) {
-    unsigned int pos = (unsigned int)&availableLanguages;
+    uintptr_t pos = (uintptr_t)&availableLanguages;
     uint8_t best = 255, cur;
     while ((cur = HAL::readFlashByte((PGM_P)pos)) != 255) {
         if (best == 255 || cur == lang)
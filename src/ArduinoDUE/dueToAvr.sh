@@ -19,6 +19,7 @@ cp Repetier/uimenu.h  ../ArduinoAVR/Repetier
 cp Repetier/u8*.h  ../ArduinoAVR/Repetier
 cp Repetier/logo.h  ../ArduinoAVR/Repetier
 cp Repetier/Events.h  ../ArduinoAVR/Repetier
+cp Repetier/IsrProfile.h  ../ArduinoAVR/Repetier
 cp Repetier/BedLeveling.*  ../ArduinoAVR/Repetier
 cp Repetier/DisplayList.*  ../ArduinoAVR/Repetier
 cp Repetier/Endstops.*  ../ArduinoAVR/Repetier
@@ -0,0 +1,956 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Host side of the simulation. Replays a G-code file like a host in ping-pong
+mode: the next line is sent after the firmware answered the last one with ok.
+-l delays every line like the latency of a real connection, -b adds the time
+the bytes need at a baud rate. With -k the host
+streams instead: it switches on the free buffer counts with M538 S1 and keeps
+as many lines in flight as the B value of the last ok allows.
+Every executed step can be written to a binary timeline file or compared with
+the timeline of an earlier run (-c), at the end the
+simulated print time and the host time spent in planner and stepper interrupt
+are reported. The average speed of the extruding moves shows how well the
+planner keeps up with short segments, -d sets the free RAM so that the
+dynamic move cache gets the given number of lines. -v gives the X and Y axis
+a resonance at the given frequency with 5% damping and reports the largest
+oscillation after the moves stopped and while lines run at full speed.
+
+With -t the thermistor conversion is checked instead: for every table based
+sensor type and raw value TemperatureController::tableTemperature is compared
+with the float interpolation of a walk through the table from the start.
+-a compares GCode::parseAscii with the parser of version 1.0.x, see
+SimulatorParse.cpp. -w measures the host time and the number of serial
+write calls of the temperature report and the ok.
+
+The sdcard variant emulates a card, see SimulatorSd.cpp. -s copies host
+files onto it before the G-code runs, which can then list, compile and print
+them. -p compiles a file to the binary sidecar and compares the host time
+GCode::parseAscii and GCode::parseBinary need per command.
+
+Timeline file format, all values little endian:
+  header: "RSTL", uint16 version (1), uint16 record size (10),
+          uint32 cpu cycles per second, uint8 motors, 3 bytes padding
+  record: uint64 cpu cycles since start, uint8 motor (0 = X, 1 = Y, 2 = Z,
+          3 + n = extruder n), int8 direction (1 or -1)
+*/
+
+#include "Repetier.h"
+#include <time.h>
+#include <vector>
+
+#define SIM_TIMELINE_VERSION 1
+
+HardwareSerial Serial;
+
+static FILE* gcodeFile = NULL;
+static bool quiet = false;
+static bool expectErrors = false; ///< Do not copy error lines to stderr when quiet
+/** Line on the way to the firmware. */
+struct HostLine {
+    char text[MAX_CMD_SIZE + 2];
+    int length;
+    uint64_t arrival; ///< Cycle time the line is in the receive buffer
+};
+#define HOST_QUEUE_SIZE 64
+static HostLine hostQueue[HOST_QUEUE_SIZE]; ///< Sent lines not completely read by the firmware
+static int hostQueueStart = 0;
+static int hostQueueLength = 0;
+static int hostLinePos = 0;        ///< Bytes of the first queued line the firmware read
+static int linesInFlight = 0;      ///< Sent lines without ok
+static int sendWindow = 1;         ///< Lines the host may have in flight
+static bool streaming = false;     ///< Send M538 S1 first and use B of each ok as window, -k
+static int maxLinesInFlight = 0;
+static std::vector<uint64_t> lineSendTimes; ///< Cycle time each line of the file was sent
+static int maxReceived = 0;        ///< Most bytes waiting in the receive buffer
+static bool inputFinished = false; ///< Final M400 and M114 were sent
+static bool finished = false;      ///< M114 was answered, all moves are done
+static uint32_t linesSent = 0;
+static uint64_t hostLatency = 0;   ///< Cycles from sending a line until it arrives, -l
+static uint64_t byteCycles = 0;    ///< Cycles per byte on the wire, -b, 0 = no limit
+static uint64_t lastArrival = 0;
+static uint32_t errors = 0;
+static char outLine[256];
+static int outLength = 0;
+
+static void hostQueueLine(const char* text, int n) {
+    HostLine& l = hostQueue[(hostQueueStart + hostQueueLength++) % HOST_QUEUE_SIZE];
+    memcpy(l.text, text, n);
+    l.text[n] = '\n';
+    l.length = n + 1;
+    l.arrival = Simulator::cycles + hostLatency;
+    if (l.arrival < lastArrival)
+        l.arrival = lastArrival; // the line before is still on the wire
+    l.arrival += l.length * byteCycles;
+    lastArrival = l.arrival;
+    linesInFlight++;
+    if (linesInFlight > maxLinesInFlight)
+        maxLinesInFlight = linesInFlight;
+}
+
+/** Reads the next line with a command from the G-code file and queues it for
+sending. Comments and empty lines are skipped like a host would do. At the end
+M400 and M114 are sent. The firmware answers ok when a command is buffered, so
+the simulation ends with the position report of M114, which runs after all
+moves are executed. Returns false if nothing can be sent now. */
+static bool hostSendNext() {
+    char buf[512];
+    if (gcodeFile == NULL)
+        return false; // -p runs firmware functions directly
+    static bool streamingRequested = false;
+    if (streaming && !streamingRequested) {
+        streamingRequested = true;
+        hostQueueLine("M538 S1", 7);
+        return true;
+    }
+    while (fgets(buf, sizeof(buf), gcodeFile) != NULL) {
+        char* comment = strchr(buf, ';');
+        if (comment != NULL)
+            *comment = 0;
+        int n = strlen(buf);
+        while (n > 0 && isspace(buf[n - 1]))
+            n--;
+        buf[n] = 0;
+        char* start = buf;
+        while (isspace(*start))
+            start++;
+        n = strlen(start);
+        if (n == 0)
+            continue;
+        if (n > MAX_CMD_SIZE)
+            n = MAX_CMD_SIZE;
+        hostQueueLine(start, n);
+        linesSent++;
+        lineSendTimes.push_back(Simulator::cycles);
+        return true;
+    }
+#if SDSUPPORT
+    if (sd.sdmode)
+        return false; // the print from sd card is still running, like a host polling M27
+#endif
+    static bool m400Sent = false;
+    hostQueueLine(m400Sent ? "M114" : "M400", 4);
+    inputFinished = m400Sent;
+    m400Sent = true;
+    return true;
+}
+
+/** Collects the firmware output into lines and handles the answers. */
+static void hostReceive(uint8_t c) {
+    if (c == '\r')
+        return;
+    if (c != '\n') {
+        if (outLength < (int)sizeof(outLine) - 1)
+            outLine[outLength++] = c;
+        return;
+    }
+    outLine[outLength] = 0;
+    outLength = 0;
+    if (strncmp(outLine, "ok", 2) == 0) {
+        linesInFlight--;
+        const char* b = strstr(outLine, " B");
+        if (streaming && b != NULL) {
+            sendWindow = atoi(b + 2);
+            if (sendWindow < 1)
+                sendWindow = 1; // always one line to get the next ok
+        }
+    } else if (inputFinished && strncmp(outLine, "X:", 2) == 0) {
+        finished = true;
+    } else if (strncmp(outLine, "Error", 5) == 0 || strncmp(outLine, "fatal", 5) == 0) {
+        errors++;
+        if (quiet && !expectErrors)
+            fprintf(stderr, "%s\n", outLine);
+    }
+    if (!quiet)
+        printf("%s\n", outLine);
+}
+
+void HardwareSerial::begin(unsigned long baud) { }
+void HardwareSerial::end() { }
+/** Polling costs time like on the board, the emergency parser polls the
+stream directly in every wait loop. Returns the bytes of all lines that
+arrived. */
+int HardwareSerial::available() {
+    Simulator::idle();
+    while (!inputFinished && linesInFlight < sendWindow && hostQueueLength < HOST_QUEUE_SIZE && hostSendNext()) { }
+    int received = -hostLinePos;
+    for (int i = 0; i < hostQueueLength; i++) {
+        const HostLine& l = hostQueue[(hostQueueStart + i) % HOST_QUEUE_SIZE];
+        if (l.arrival > Simulator::cycles)
+            break;
+        received += l.length;
+    }
+    if (received > maxReceived)
+        maxReceived = received;
+    return received;
+}
+int HardwareSerial::read() {
+    if (available() <= 0)
+        return -1;
+    HostLine& l = hostQueue[hostQueueStart];
+    uint8_t c = l.text[hostLinePos++];
+    if (hostLinePos == l.length) {
+        hostLinePos = 0;
+        hostQueueStart = (hostQueueStart + 1) % HOST_QUEUE_SIZE;
+        hostQueueLength--;
+    }
+    return c;
+}
+int HardwareSerial::peek() {
+    if (available() <= 0)
+        return -1;
+    return (uint8_t)hostQueue[hostQueueStart].text[hostLinePos];
+}
+void HardwareSerial::flush() { fflush(stdout); }
+uint32_t HardwareSerial::writeCalls = 0;
+size_t HardwareSerial::write(uint8_t c) {
+    writeCalls++;
+    hostReceive(c);
+    return 1;
+}
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    writeCalls++;
+    for (size_t i = 0; i < size; i++)
+        hostReceive(buffer[i]);
+    return size;
+}
+
+static void writeTimelineHeader(FILE* f) {
+    uint8_t header[16];
+    uint16_t version = SIM_TIMELINE_VERSION;
+    uint16_t recordSize = sizeof(SimTimelineRecord);
+    uint32_t ticks = F_CPU_TRUE;
+    memcpy(header, "RSTL", 4);
+    memcpy(header + 4, &version, 2);
+    memcpy(header + 6, &recordSize, 2);
+    memcpy(header + 8, &ticks, 4);
+    header[12] = SIM_MOTORS;
+    header[13] = header[14] = header[15] = 0;
+    fwrite(header, sizeof(header), 1, f);
+}
+
+static double hostSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void usage() {
+    fprintf(stderr,
+            "Usage: repetier-sim [-q] [-d lines] [-l us] [-b baud] [-k] [-v Hz] [-o timeline.bin] [-c reference.bin] file.gcode\n"
+            "       repetier-sim -t\n"
+            "       repetier-sim -a file.gcode\n"
+            "       repetier-sim -w\n"
+#if DRIVE_SYSTEM == DELTA
+            "       repetier-sim -x\n"
+#endif
+#ifdef SIM_SDCARD
+            "       repetier-sim [-q] [-s file]... file.gcode\n"
+            "       repetier-sim -p file.gcode\n"
+#if JSON_OUTPUT
+            "       repetier-sim -i files file.gcode\n"
+#endif
+#ifdef SIM_DISPLAY
+            "       repetier-sim -f files\n"
+#endif
+#endif
+#if EEPROM_RAM_CACHE
+            "       repetier-sim -e stores\n"
+#endif
+#ifdef SIM_DISPLAY
+            "       repetier-sim -r refreshes\n"
+            "       repetier-sim -u\n"
+#endif
+            "  -a file  compare parseAscii with the old parser on every line of file and exit\n"
+            "  -b baud  transfer time of the sent lines, 10 bits per byte\n"
+            "  -c file  compare the steps with a timeline written by -o\n"
+            "  -d n     move cache of n lines, needs PRINTLINE_DYNAMIC_CACHE\n"
+            "  -k       stream with M538 instead of waiting for each ok\n"
+            "  -l us    host latency, time from sending a line until it arrives\n"
+            "  -o file  write every step as binary timeline\n"
+            "  -q       do not print the firmware output\n"
+            "  -t       check the thermistor tables and exit\n"
+            "  -v Hz    resonance of the X and Y axis, reports the vibration after stops and while cruising\n"
+            "  -w       time the temperature report and the ok and exit\n"
+#if DRIVE_SYSTEM == DELTA
+            "  -x       check the delta tower positions against double math and exit\n"
+#endif
+#ifdef SIM_SDCARD
+            "  -s file  copy file onto the sd card, may be repeated\n"
+            "  -p file  compare ASCII and binary parse time of file and exit\n"
+#if JSON_OUTPUT
+            "  -i n     time M36 for n copies of file before and after M20 S2 and exit\n"
+#endif
+#ifdef SIM_DISPLAY
+            "  -f n     time the file browser in a folder of n files, check it after changes and exit\n"
+#endif
+#endif
+#if EEPROM_RAM_CACHE
+            "  -e n     replay n settings stores against the eeprom cache and exit\n"
+#endif
+#ifdef SIM_DISPLAY
+            "  -r n     time n display refreshes and exit\n"
+            "  -u       compare the ui texts with the old template parser and exit\n"
+#endif
+            );
+    exit(1);
+}
+
+/** Temperature like the old conversion: walk from the start of the table and
+interpolate with floats. */
+static float tableWalkTemperature(const int16_t* table, uint8_t num, int16_t raw) {
+    int16_t oldraw = table[0];
+    int16_t oldtemp = table[1];
+    int16_t newtemp = 0;
+    for (uint8_t i = 1; i < num; i++) {
+        int16_t newraw = table[i << 1];
+        newtemp = table[(i << 1) + 1];
+        if (newraw > raw)
+            return TEMP_INT_TO_FLOAT(oldtemp + (float)(raw - oldraw) * (float)(newtemp - oldtemp) / (newraw - oldraw));
+        oldtemp = newtemp;
+        oldraw = newraw;
+    }
+    return TEMP_INT_TO_FLOAT(newtemp);
+}
+
+/** Returns the number of sensor types where the conversion differs by more
+than the 1/128 degree integer interpolation may cause. */
+static int checkThermistorTables() {
+    static const uint8_t types[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 50, 51, 52, 97, 98, 99 };
+    TemperatureController& tc = extruder[0].tempControl;
+    int failed = 0;
+    for (uint8_t t = 0; t < sizeof(types); t++) {
+        tc.sensorType = types[t];
+        uint8_t num;
+        bool inRam;
+        const int16_t* table = tc.conversionTable(num, inRam);
+        if (num == 0)
+            continue;
+        float maxError = 0;
+        int16_t maxErrorRaw = 0;
+        int16_t undefined = 0;
+        for (int16_t raw = 0; raw <= (4095 >> ANALOG_REDUCE_BITS); raw++) {
+            float expected = tableWalkTemperature(table, num, raw);
+            if (!isfinite(expected)) { // walk divided by zero at equal raw values
+                undefined++;
+                continue;
+            }
+            float error = fabs(tc.tableTemperature(raw) - expected);
+            if (error > maxError) {
+                maxError = error;
+                maxErrorRaw = raw;
+            }
+        }
+        bool ok = maxError <= 1.0f / 128.0f + 1e-4f;
+        printf("Sensor type %3d: %2d entries, max difference %.5f at raw %4d %s", types[t], num, maxError, maxErrorRaw, ok ? "ok" : "FAILED");
+        if (undefined > 0)
+            printf(", %d raw values with division by zero in the walk", undefined);
+        printf("\n");
+        if (!ok)
+            failed++;
+    }
+    return failed;
+}
+
+/** Host time and serial write calls of the temperature report and of an
+acknowledge with line number, the two lines a host gets most often. */
+static void outputBenchmark() {
+    static const int repeats = 100000;
+    quiet = true;
+    Simulator::setupMachine();
+    Printer::setup();
+    GCodeSource::flushOutput();
+    uint32_t calls = HardwareSerial::writeCalls;
+    double start = hostSeconds();
+    for (int i = 0; i < repeats; i++)
+        Commands::printTemperatures();
+    GCodeSource::flushOutput();
+    double nanos = (hostSeconds() - start) * 1e9;
+    printf("Output buffer: %d bytes\n", (int)OUTPUT_BUFFER_SIZE);
+    printf("printTemperatures: %.1f ns, %.1f write calls per report\n", nanos / repeats,
+           static_cast<double>(HardwareSerial::writeCalls - calls) / repeats);
+    calls = HardwareSerial::writeCalls;
+    start = hostSeconds();
+    for (int i = 0; i < repeats; i++) {
+        Com::printF(Com::tOkSpace, static_cast<int32_t>(i));
+        Com::println();
+    }
+    GCodeSource::flushOutput();
+    nanos = (hostSeconds() - start) * 1e9;
+    printf("ok with line number: %.1f ns, %.1f write calls per ok\n", nanos / repeats,
+           static_cast<double>(HardwareSerial::writeCalls - calls) / repeats);
+}
+
+#if DRIVE_SYSTEM == DELTA
+/** Tower height in steps with double math from the same tower constants, or
+-1 if the position is unreachable or below the floor margin. */
+static double deltaReferenceHeight(const int32_t* pos, int32_t towerX, int32_t towerY, double diagonal2) {
+    double dx = static_cast<double>(towerX) - pos[X_AXIS];
+    double dy = static_cast<double>(towerY) - pos[Y_AXIS];
+    double r = diagonal2 - dx * dx - dy * dy;
+    if (r < 0)
+        return -1;
+    double h = sqrt(r) + pos[Z_AXIS];
+    return h < Printer::deltaFloorSafetyMarginSteps ? -1 : h;
+}
+
+/** Converts a grid reaching past the towers with transformCartesianStepsToDeltaStepsBatch
+in batches of 16 and compares each tower with deltaReferenceHeight. Positions the
+batch rejects must be unreachable in the reference and stay unchanged. Returns
+the number of failures. */
+static int checkDeltaBatch() {
+    const int32_t towerX[TOWER_ARRAY] = { Printer::deltaAPosXSteps, Printer::deltaBPosXSteps, Printer::deltaCPosXSteps };
+    const int32_t towerY[TOWER_ARRAY] = { Printer::deltaAPosYSteps, Printer::deltaBPosYSteps, Printer::deltaCPosYSteps };
+    double diagonal2[TOWER_ARRAY];
+    const floatLong* diagonal[TOWER_ARRAY] = { &Printer::deltaDiagonalStepsSquaredA, &Printer::deltaDiagonalStepsSquaredB, &Printer::deltaDiagonalStepsSquaredC };
+    for (fast8_t t = 0; t < TOWER_ARRAY; t++)
+        diagonal2[t] = Printer::isLargeMachine() ? static_cast<double>(diagonal[t]->L) : static_cast<double>(diagonal[t]->l);
+    const float stepsPerMM = Printer::axisStepsPerMM[Z_AXIS];
+    const float radius = Printer::radius0 + 10;
+    double maxError = 0, sumError = 0;
+    uint32_t converted = 0, rejected = 0;
+    int failed = 0;
+    for (float z = 0; z <= 200; z += 50) {
+        for (float y = -radius; y <= radius; y += 0.73f) {
+            int32_t pos[16][Z_AXIS_ARRAY], original[16][Z_AXIS_ARRAY];
+            uint8_t count = 0;
+            for (float x = -radius; x <= radius || count > 0; x += 0.73f) {
+                if (x <= radius) {
+                    original[count][X_AXIS] = static_cast<int32_t>(x * stepsPerMM);
+                    original[count][Y_AXIS] = static_cast<int32_t>(y * stepsPerMM);
+                    original[count][Z_AXIS] = static_cast<int32_t>(z * stepsPerMM);
+                    memcpy(pos[count], original[count], sizeof(pos[count]));
+                    if (++count < 16)
+                        continue;
+                }
+                uint8_t start = 0;
+                while (start < count) {
+                    uint8_t valid = start + transformCartesianStepsToDeltaStepsBatch(pos + start, count - start);
+                    for (uint8_t n = start; n < valid; n++, converted++) {
+                        for (fast8_t t = 0; t < TOWER_ARRAY; t++) {
+                            double h = deltaReferenceHeight(original[n], towerX[t], towerY[t], diagonal2[t]);
+                            double error = fabs(pos[n][t] - h);
+                            if (h < 0 || error > 1) {
+                                if (failed++ < 10)
+                                    printf("Converted %ld %ld %ld: tower %d %ld, reference %.2f\n", (long)original[n][X_AXIS],
+                                           (long)original[n][Y_AXIS], (long)original[n][Z_AXIS], (int)t, (long)pos[n][t], h);
+                                continue;
+                            }
+                            if (error > maxError)
+                                maxError = error;
+                            sumError += error;
+                        }
+                    }
+                    if (valid < count) {
+                        bool reachable = true;
+                        for (fast8_t t = 0; t < TOWER_ARRAY; t++) {
+                            double h = deltaReferenceHeight(original[valid], towerX[t], towerY[t], diagonal2[t]);
+                            // rounding may decide either way at the floor margin
+                            reachable &= h >= Printer::deltaFloorSafetyMarginSteps + 1;
+                        }
+                        if (reachable || memcmp(pos[valid], original[valid], sizeof(pos[valid])) != 0) {
+                            if (failed++ < 10)
+                                printf("Rejected %ld %ld %ld: %s\n", (long)original[valid][X_AXIS], (long)original[valid][Y_AXIS],
+                                       (long)original[valid][Z_AXIS], reachable ? "reachable" : "changed");
+                        }
+                        rejected++;
+                        valid++;
+                    }
+                    start = valid;
+                }
+                count = 0;
+            }
+        }
+    }
+    printf("%s delta, %.0f steps per mm: %u positions converted, %u rejected, tower error max %.3f mean %.3f steps, %d failed\n",
+           Printer::isLargeMachine() ? "Large" : "Small", static_cast<double>(stepsPerMM), (unsigned)converted, (unsigned)rejected,
+           maxError, converted ? sumError / (3.0 * converted) : 0.0, failed);
+    return failed;
+}
+
+/** Runs checkDeltaBatch with the configured resolution, which uses the 32 bit
+path, and with 200 steps per mm, which needs the 64 bit path. */
+static int checkDeltaTransformation() {
+    quiet = true;
+    expectErrors = true; // every rejected position reports why
+    Simulator::setupMachine();
+    Printer::setup();
+    int failed = checkDeltaBatch();
+    Printer::axisStepsPerMM[Z_AXIS] = 200;
+    Printer::updateDerivedParameter();
+    if (!Printer::isLargeMachine()) {
+        printf("200 steps per mm do not select the 64 bit path\n");
+        return failed + 1;
+    }
+    return failed + checkDeltaBatch();
+}
+#endif
+
+#ifdef SIM_SDCARD
+/** Loads a whole file from the sd card. */
+static uint8_t* readFromCard(const char* name, uint32_t& size) {
+    SdFile f;
+    if (!f.open(sd.fat.vwd(), name, O_READ))
+        return NULL;
+    size = f.fileSize();
+    uint8_t* data = static_cast<uint8_t*>(malloc(size + 1));
+    bool ok = f.read(data, size) == static_cast<int>(size);
+    f.close();
+    if (!ok) {
+        free(data);
+        return NULL;
+    }
+    data[size] = 0;
+    return data;
+}
+
+/** Compiles name into the sidecar with SDCard::compileBinary on the emulated
+card and parses all commands of both files repeatedly. The ASCII lines are
+prepared like the sd card reader passes them to parseAscii: comments are
+removed and empty lines skipped. Returns the number of failed steps. */
+static int parseBenchmark(const char* name) {
+    static const int passes = 20;
+    Simulator::setupMachine();
+    Printer::setup();
+    sd.fat.chdir();
+    if (!Simulator::copyToCard(name, "bench.gcode") || !sd.compileBinary("bench.gcode")) {
+        fprintf(stderr, "%s: compiling on the sd card failed\n", name);
+        return 1;
+    }
+    uint32_t asciiSize, binarySize;
+    uint8_t* ascii = readFromCard("bench.gcode", asciiSize);
+    uint8_t* binary = readFromCard("bench.bgc", binarySize);
+    if (ascii == NULL || binary == NULL || binarySize < SD_BINARY_HEADER_SIZE) {
+        fprintf(stderr, "%s: reading back from the sd card failed\n", name);
+        return 1;
+    }
+    // Split into zero terminated lines in place
+    char** lines = static_cast<char**>(malloc(sizeof(char*) * (asciiSize + 1)));
+    uint32_t numLines = 0;
+    char* line = reinterpret_cast<char*>(ascii);
+    for (uint32_t i = 0; i <= asciiSize; i++) {
+        char c = static_cast<char>(ascii[i]);
+        if (c == ';') // comment up to the line end
+            ascii[i] = 0;
+        if (c == '\n' || c == '\r' || c == 0) {
+            ascii[i] = 0;
+            if (*line)
+                lines[numLines++] = line;
+            line = reinterpret_cast<char*>(ascii + i + 1);
+        }
+    }
+    GCode code;
+    uint32_t asciiCommands = 0, binaryCommands = 0;
+    double start = hostSeconds();
+    for (int pass = 0; pass < passes; pass++)
+        for (uint32_t i = 0; i < numLines; i++)
+            if (code.parseAscii(lines[i], false))
+                asciiCommands++;
+    double asciiNanos = (hostSeconds() - start) * 1e9;
+    start = hostSeconds();
+    for (int pass = 0; pass < passes; pass++) {
+        uint8_t* p = binary + SD_BINARY_HEADER_SIZE;
+        uint8_t* end = binary + binarySize;
+        while (p + 4 <= end) {
+            uint8_t size = GCode::computeBinarySize(reinterpret_cast<char*>(p));
+            if (p + size > end)
+                break;
+            if (code.parseBinary(p, size, false))
+                binaryCommands++;
+            p += size;
+        }
+    }
+    double binaryNanos = (hostSeconds() - start) * 1e9;
+    asciiCommands /= passes;
+    binaryCommands /= passes;
+    printf("ASCII: %u commands, %u bytes, %.1f ns per command\n", (unsigned)asciiCommands, (unsigned)asciiSize,
+           asciiCommands ? asciiNanos / passes / asciiCommands : 0.0);
+    printf("Binary: %u commands, %u bytes, %.1f ns per command\n", (unsigned)binaryCommands, (unsigned)binarySize,
+           binaryCommands ? binaryNanos / passes / binaryCommands : 0.0);
+    free(lines);
+    free(ascii);
+    free(binary);
+    return asciiCommands == binaryCommands ? 0 : 3;
+}
+
+#if JSON_OUTPUT
+/** Card time of one M36: opening the file and loading its information. */
+static uint64_t timeFileInfo(const char* name, GCodeFileInfo& info) {
+    uint64_t start = Simulator::cycles;
+    SdFile f;
+    if (!f.open(sd.fat.vwd(), name, O_READ))
+        return 0;
+    sd.loadFileInfo(f, info);
+    f.close();
+    return Simulator::cycles - start;
+}
+
+static void printInfoTimes(const char* what, int files, uint64_t total, uint64_t max, uint32_t written) {
+    printf("%s: %d files, %.2f ms mean, %.2f ms max, %u blocks written\n", what, files,
+           static_cast<double>(total) * 1000 / F_CPU_TRUE / files, static_cast<double>(max) * 1000 / F_CPU_TRUE,
+           (unsigned)written);
+}
+
+/** Copies name into the folder parts of the card files times, then times M36
+for each file like a host after connecting: before the folder was listed,
+M20 S2 of the folder, the idle calls of SDCard::updateInfoCache until they
+stop using the card, and M36 for each file again. Returns the number of
+files whose information changed and of cache files shown in the root. */
+static int infoBenchmark(int files, const char* name) {
+    char cardName[32];
+    Simulator::setupMachine();
+    Printer::setup();
+    sd.fat.chdir();
+    sd.fat.mkdir("parts");
+    for (int i = 0; i < files; i++) {
+        sprintf(cardName, "parts/part%03d.gcode", i % 1000);
+        if (!Simulator::copyToCard(name, cardName)) {
+            fprintf(stderr, "%s: copying to the sd card failed\n", name);
+            return 1;
+        }
+    }
+    std::vector<GCodeFileInfo> before(files), after(files);
+    uint64_t total = 0, max = 0;
+    uint32_t written = Simulator::sdBlocksWritten;
+    for (int i = 0; i < files; i++) {
+        sprintf(cardName, "parts/part%03d.gcode", i % 1000);
+        uint64_t c = timeFileInfo(cardName, before[i]);
+        total += c;
+        if (c > max)
+            max = c;
+    }
+    printInfoTimes("M36 before M20 S2", files, total, max, Simulator::sdBlocksWritten - written);
+
+    uint64_t start = Simulator::cycles;
+    sd.lsJSON("parts");
+    printf("M20 S2: %.2f ms\n", static_cast<double>(Simulator::cycles - start) * 1000 / F_CPU_TRUE);
+
+#if SD_INFO_CACHE_SIZE
+    uint32_t calls = 0;
+    total = max = 0;
+    written = Simulator::sdBlocksWritten;
+    for (;;) {
+        uint32_t blocks = Simulator::sdBlocksRead + Simulator::sdBlocksWritten;
+        start = Simulator::cycles;
+        sd.updateInfoCache();
+        if (Simulator::sdBlocksRead + Simulator::sdBlocksWritten == blocks)
+            break; // Nothing left to cache
+        uint64_t c = Simulator::cycles - start;
+        calls++;
+        total += c;
+        if (c > max)
+            max = c;
+    }
+    printf("Idle: %u calls, %.2f ms max per call, %.0f ms total, %u blocks written\n", (unsigned)calls,
+           static_cast<double>(max) * 1000 / F_CPU_TRUE, static_cast<double>(total) * 1000 / F_CPU_TRUE,
+           (unsigned)(Simulator::sdBlocksWritten - written));
+#endif
+
+    total = max = 0;
+    written = Simulator::sdBlocksWritten;
+    for (int i = 0; i < files; i++) {
+        sprintf(cardName, "parts/part%03d.gcode", i % 1000);
+        uint64_t c = timeFileInfo(cardName, after[i]);
+        total += c;
+        if (c > max)
+            max = c;
+    }
+    printInfoTimes("M36 after idle", files, total, max, Simulator::sdBlocksWritten - written);
+
+    int wrong = 0;
+    for (int i = 0; i < files; i++) {
+        GCodeFileInfo &a = before[i], &b = after[i];
+        if (a.fileSize != b.fileSize || a.objectHeight != b.objectHeight || a.layerHeight != b.layerHeight
+            || a.filamentNeeded != b.filamentNeeded || a.printTime != b.printTime || a.layerCount != b.layerCount
+            || strcmp(a.generatedBy, b.generatedBy) != 0)
+            wrong++;
+    }
+    if (wrong)
+        printf("Information of %d files changed\n", wrong);
+    // M20 and the LCD do not show names starting with a dot
+    SdBaseFile root, f;
+    root.openRoot(sd.fat.vol());
+    while (f.openNext(&root, O_READ)) {
+        f.getName(tempLongFilename, LONG_FILENAME_LENGTH);
+        if (tempLongFilename[0] != '.' && strcmp(tempLongFilename, "parts") != 0) {
+            printf("Root folder shows %s\n", tempLongFilename);
+            wrong++;
+        }
+        f.close();
+    }
+    return wrong;
+}
+#endif
+#endif
+
+static void printStatistics(double hostTime, bool compared) {
+    static const char* motorNames[] = { "X", "Y", "Z", "E0", "E1", "E2", "E3", "E4", "E5" };
+    double simTime = static_cast<double>(Simulator::cycles) / F_CPU_TRUE;
+    uint64_t totalSteps = 0;
+    printf("Simulation: %u lines, %u errors\n", (unsigned)linesSent, (unsigned)errors);
+    printf("Simulated time: %.3f s, host time: %.3f s\n", simTime, hostTime);
+    printf("Steps:");
+    for (uint8_t i = 0; i < SIM_MOTORS; i++) {
+        printf(" %s:%llu", motorNames[i], Simulator::motors[i].steps);
+        totalSteps += Simulator::motors[i].steps;
+    }
+    printf("\n");
+    if (compared)
+        printf("Timeline: %u steps differ from the reference, max %.2f us\n", (unsigned)Simulator::timelineDifferences,
+               Simulator::maxTimelineDifference * 1e6 / F_CPU_TRUE);
+    printf("Printing moves: %.1f mm in %.3f s, %.1f mm/s\n", Simulator::printDistance, Simulator::printSeconds,
+           Simulator::printSeconds > 0 ? Simulator::printDistance / Simulator::printSeconds : 0.0);
+    // Host sizes, the firmware lines are smaller without 64 bit pointers
+    unsigned cacheBytes = PRINTLINE_CACHE_LINES * sizeof(PrintLine);
+#if NONLINEAR_SEGMENT_POOL
+    cacheBytes += sizeof(PrintLine::segmentPool);
+    printf("Move cache: %d lines, %d pool segments, %u bytes\n", (int)PRINTLINE_CACHE_LINES, NONLINEAR_SEGMENT_POOL,
+           cacheBytes);
+#else
+    printf("Move cache: %d lines, %u bytes\n", (int)PRINTLINE_CACHE_LINES, cacheBytes);
+#endif
+    double queueSamples = Simulator::printSeconds * 1000;
+    if (queueSamples > 0)
+        printf("Queue while printing: %.1f lines, %.1f ms of moves at full speed, min %d lines\n",
+               Simulator::queuedLines / queueSamples, Simulator::queuedSeconds * 1000 / queueSamples,
+               (int)Simulator::minQueuedLines);
+    // The middle 80% of the lines, without homing and heating at the start
+    double linesPerSecond = 0;
+    size_t first = lineSendTimes.size() / 10, last = lineSendTimes.size() * 9 / 10;
+    if (last > first && lineSendTimes[last] > lineSendTimes[first])
+        linesPerSecond = (last - first) * static_cast<double>(F_CPU_TRUE) / (lineSendTimes[last] - lineSendTimes[first]);
+    printf("Host: %.0f lines/s, max %d lines in flight, max %d bytes in the receive buffer\n", linesPerSecond,
+           maxLinesInFlight, maxReceived);
+    printf("Motion: max acceleration %.0f mm/s^2, max jerk %.0f mm/s^3\n", Simulator::maxAcceleration, Simulator::maxJerk);
+    if (Simulator::resonanceFrequency > 0)
+        printf("Vibration at %.0f Hz: X %.1f um after stops, %.1f um while cruising, Y %.1f um, %.1f um\n",
+               Simulator::resonanceFrequency, Simulator::restVibration[X_AXIS] * 1000,
+               Simulator::cruiseVibration[X_AXIS] * 1000, Simulator::restVibration[Y_AXIS] * 1000,
+               Simulator::cruiseVibration[Y_AXIS] * 1000);
+#if DRIVE_SYSTEM == DELTA
+    printf("Delta: %u segments, max deviation from the chords %.2f um\n", (unsigned)Simulator::deltaSegments,
+           Simulator::maxDeltaDeviation * 1000);
+#endif
+    // The planner times are host nanoseconds, see STEP_TIMELINE_MICROS
+    printf("Planner: %lu lines in %.0f us, max %.1f us per line", StepTimeline::linesPlanned,
+           StepTimeline::planningMicros * 1e-3, StepTimeline::maxPlanningMicros * 1e-3);
+    if (StepTimeline::planningMicros > 0)
+        printf(", %.0f lines/s", 1e9 * StepTimeline::linesPlanned / StepTimeline::planningMicros);
+    printf("\n");
+    printf("Recomputed lines: %lu, max %u per line, %lu junctions planned\n", StepTimeline::recomputedLines,
+           StepTimeline::maxRecomputedLines, StepTimeline::plannedJunctions);
+#ifdef SIM_SDCARD
+    printf("Sd card: %u blocks read, %u blocks written, busy %.3f s\n", (unsigned)Simulator::sdBlocksRead,
+           (unsigned)Simulator::sdBlocksWritten, static_cast<double>(Simulator::sdCycles) / F_CPU_TRUE);
+#endif
+    printf("Stepper interrupt: %lu calls, %.1f ns per call", Simulator::stepperCalls,
+           Simulator::stepperCalls ? static_cast<double>(Simulator::stepperHostNanos) / Simulator::stepperCalls : 0.0);
+    if (totalSteps > 0)
+        printf(", %.1f ns per step", static_cast<double>(Simulator::stepperHostNanos) / totalSteps);
+    printf("\n");
+    printf("Interrupts: %.0f stepper and %.0f extruder timer calls per second\n",
+           simTime > 0 ? Simulator::stepperCalls / simTime : 0.0, simTime > 0 ? Simulator::extruderCalls / simTime : 0.0);
+    printf("Extruder direction: %u reversals, %.1f per printing second\n", (unsigned)Simulator::motors[E_AXIS].reversals,
+           Simulator::printSeconds > 0 ? Simulator::motors[E_AXIS].reversals / Simulator::printSeconds : 0.0);
+}
+
+int main(int argc, char** argv) {
+    const char* timelineName = NULL;
+    const char* referenceName = NULL;
+    const char* gcodeName = NULL;
+    bool checkTables = false;
+    bool timeOutput = false;
+    bool checkDelta = false;
+    const char* compareName = NULL;
+#ifdef SIM_SDCARD
+    const char* cardFiles[16];
+    int numCardFiles = 0;
+    const char* parseName = NULL;
+    int browseFiles = 0;
+    int infoFiles = 0;
+#endif
+#if EEPROM_RAM_CACHE
+    int eepromStores = 0;
+#endif
+#ifdef SIM_DISPLAY
+    int refreshes = 0;
+    bool compareUi = false;
+#endif
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-q") == 0)
+            quiet = true;
+        else if (strcmp(argv[i], "-t") == 0)
+            checkTables = true;
+        else if (strcmp(argv[i], "-w") == 0)
+            timeOutput = true;
+#if DRIVE_SYSTEM == DELTA
+        else if (strcmp(argv[i], "-x") == 0)
+            checkDelta = true;
+#endif
+        else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc)
+            compareName = argv[++i];
+        else if (strcmp(argv[i], "-v") == 0 && i + 1 < argc)
+            Simulator::resonanceFrequency = atof(argv[++i]);
+        else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+            byteCycles = 10ULL * F_CPU_TRUE / atoi(argv[++i]);
+        else if (strcmp(argv[i], "-k") == 0)
+            streaming = true;
+        else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+            hostLatency = static_cast<uint64_t>(atoi(argv[++i])) * (F_CPU_TRUE / 1000000);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            timelineName = argv[++i];
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            referenceName = argv[++i];
+        else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+#if PRINTLINE_DYNAMIC_CACHE
+            Simulator::freeRam = atoi(argv[++i]) * sizeof(PrintLine) + PRINTLINE_CACHE_RESERVE_RAM;
+#else
+            fprintf(stderr, "-d needs PRINTLINE_DYNAMIC_CACHE, build with make repetier-sim-dyncache\n");
+            return 1;
+#endif
+        }
+#ifdef SIM_SDCARD
+        else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc && numCardFiles < 16)
+            cardFiles[numCardFiles++] = argv[++i];
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            parseName = argv[++i];
+#if JSON_OUTPUT
+        else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+            infoFiles = atoi(argv[++i]);
+#endif
+#ifdef SIM_DISPLAY
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+            browseFiles = atoi(argv[++i]);
+#endif
+#endif
+#if EEPROM_RAM_CACHE
+        else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+            eepromStores = atoi(argv[++i]);
+#endif
+#ifdef SIM_DISPLAY
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+            refreshes = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-u") == 0)
+            compareUi = true;
+#endif
+        else if (argv[i][0] == '-' || gcodeName != NULL)
+            usage();
+        else
+            gcodeName = argv[i];
+    }
+    if (checkTables) {
+        Simulator::setupMachine();
+        Printer::setup();
+        return checkThermistorTables() > 0 ? 3 : 0;
+    }
+    if (timeOutput) {
+        outputBenchmark();
+        return 0;
+    }
+#if DRIVE_SYSTEM == DELTA
+    if (checkDelta)
+        return checkDeltaTransformation() > 0 ? 3 : 0;
+#endif
+    if (compareName != NULL) {
+        quiet = true;
+        Simulator::setupMachine();
+        Printer::setup();
+        return Simulator::compareParser(compareName) != 0 ? 3 : 0;
+    }
+#ifdef SIM_SDCARD
+    if (parseName != NULL)
+        return parseBenchmark(parseName);
+#if JSON_OUTPUT
+    if (infoFiles > 0 && gcodeName != NULL) {
+        quiet = true;
+        return infoBenchmark(infoFiles, gcodeName) != 0 ? 3 : 0;
+    }
+#endif
+#ifdef SIM_DISPLAY
+    if (browseFiles > 0) {
+        quiet = true;
+        return Simulator::browseBenchmark(browseFiles) != 0 ? 3 : 0;
+    }
+#endif
+#endif
+#if EEPROM_RAM_CACHE
+    if (eepromStores > 0) {
+        quiet = true;
+        return Simulator::eepromReplay(eepromStores) != 0 ? 3 : 0;
+    }
+#endif
+#ifdef SIM_DISPLAY
+    if (refreshes > 0) {
+        quiet = true;
+        Simulator::refreshBenchmark(refreshes);
+        return 0;
+    }
+    if (compareUi) {
+        quiet = true;
+        return Simulator::compareUiTemplates() != 0 ? 3 : 0;
+    }
+#endif
+    if (gcodeName == NULL)
+        usage();
+    gcodeFile = fopen(gcodeName, "r");
+    if (gcodeFile == NULL) {
+        perror(gcodeName);
+        return 1;
+    }
+    Simulator::setupMachine();
+    Printer::setup();
+#ifdef SIM_SDCARD
+    for (int i = 0; i < numCardFiles; i++) {
+        const char* cardName = strrchr(cardFiles[i], '/');
+        sd.fat.chdir();
+        if (!Simulator::copyToCard(cardFiles[i], cardName != NULL ? cardName + 1 : cardFiles[i])) {
+            fprintf(stderr, "%s: copying to the sd card failed\n", cardFiles[i]);
+            return 1;
+        }
+    }
+#endif
+    if (timelineName != NULL) {
+        Simulator::timeline = fopen(timelineName, "wb");
+        if (Simulator::timeline == NULL) {
+            perror(timelineName);
+            return 1;
+        }
+        setvbuf(Simulator::timeline, NULL, _IOFBF, 1 << 20);
+        writeTimelineHeader(Simulator::timeline);
+    }
+    if (referenceName != NULL && !Simulator::loadReferenceTimeline(referenceName)) {
+        fprintf(stderr, "%s: no timeline of this machine\n", referenceName);
+        return 1;
+    }
+    StepTimeline::start();
+    double hostStart = hostSeconds();
+    while (!finished) {
+        Commands::commandLoop();
+#if DRIVE_SYSTEM == DELTA
+        Simulator::alignDeltaTowers();
+#endif
+    }
+    double hostTime = hostSeconds() - hostStart;
+    if (Simulator::timeline != NULL)
+        fclose(Simulator::timeline);
+    fclose(gcodeFile);
+    if (referenceName != NULL)
+        Simulator::finishReferenceTimeline();
+    printStatistics(hostTime, referenceName != NULL);
+    return errors > 0 ? 3 : 0;
+}
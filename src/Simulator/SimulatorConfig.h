@@ -0,0 +1,213 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Overrides for the host simulation. Included by Repetier.h directly after
+Configuration.h, so the simulation uses the motion settings of the DUE
+configuration but drops all hardware the fake HAL does not emulate.
+*/
+
+#ifndef SIMULATOR_CONFIG_H
+#define SIMULATOR_CONFIG_H
+
+// No display, no servos and no second serial port. The sd card only exists
+// in the sdcard variants, see SimulatorSd.cpp, the display in the glcd
+// variants, see SimulatorDisplay.cpp.
+#undef FEATURE_CONTROLLER
+#ifdef SIM_DISPLAY
+#define FEATURE_CONTROLLER SIM_DISPLAY
+// u8glib only picks its Arduino software SPI for AVR, PIC32 and the Due,
+// without these it talks to the null device on the host
+#define U8G_COM_SW_SPI u8g_com_arduino_sw_spi_fn
+#define U8G_COM_ST7920_SW_SPI u8g_com_arduino_st7920_spi_fn
+#else
+#define FEATURE_CONTROLLER NO_CONTROLLER
+#endif
+#undef SDSUPPORT
+#ifdef SIM_SDCARD
+#define SDSUPPORT 1
+#else
+#define SDSUPPORT 0
+#endif
+#undef FEATURE_SERVO
+#define FEATURE_SERVO 0
+#undef BLUETOOTH_SERIAL
+#define BLUETOOTH_SERIAL -1
+#undef FEATURE_WATCHDOG
+#define FEATURE_WATCHDOG 0
+
+// Always start with the values from Configuration.h. Host rescue needs the eeprom.
+#undef EEPROM_AVAILABLE
+#define EEPROM_AVAILABLE EEPROM_NONE
+#undef EEPROM_MODE
+#define EEPROM_MODE 0
+#undef HOST_RESCUE
+#define HOST_RESCUE 0
+
+// Heaters are not simulated. Sensor type 0 reads as room temperature and
+// makes M109/M190 return at once, so prints start without heating up.
+#undef EXT0_TEMPSENSOR_TYPE
+#define EXT0_TEMPSENSOR_TYPE 0
+#undef EXT1_TEMPSENSOR_TYPE
+#define EXT1_TEMPSENSOR_TYPE 0
+#undef EXT2_TEMPSENSOR_TYPE
+#define EXT2_TEMPSENSOR_TYPE 0
+#undef EXT3_TEMPSENSOR_TYPE
+#define EXT3_TEMPSENSOR_TYPE 0
+#undef EXT4_TEMPSENSOR_TYPE
+#define EXT4_TEMPSENSOR_TYPE 0
+#undef EXT5_TEMPSENSOR_TYPE
+#define EXT5_TEMPSENSOR_TYPE 0
+#undef HAVE_HEATED_BED
+#define HAVE_HEATED_BED false
+// Generate all generic tables, so -t checks them too.
+#ifndef USE_GENERIC_THERMISTORTABLE_1
+#define USE_GENERIC_THERMISTORTABLE_1
+#endif
+#ifndef USE_GENERIC_THERMISTORTABLE_2
+#define USE_GENERIC_THERMISTORTABLE_2
+#endif
+#ifndef USE_GENERIC_THERMISTORTABLE_3
+#define USE_GENERIC_THERMISTORTABLE_3
+#endif
+
+// Planner statistics come from the step timeline. The simulator drains the
+// entries itself, timing uses the host clock.
+#ifndef DEBUG_STEP_TIMELINE
+#define DEBUG_STEP_TIMELINE
+#endif
+#undef STEP_TIMELINE_SIZE
+#define STEP_TIMELINE_SIZE 64
+
+// Build variants, see VARIANT_* in the Makefile.
+#ifdef SIM_DYNAMIC_CACHE
+#undef PRINTLINE_DYNAMIC_CACHE
+#define PRINTLINE_DYNAMIC_CACHE 1
+#endif
+#ifdef SIM_S_CURVE
+#undef S_CURVE_ACCELERATION
+#define S_CURVE_ACCELERATION 1
+#endif
+#ifdef SIM_SDCARD
+#undef SD_BINARY_SIDECAR
+#define SD_BINARY_SIDECAR 1
+#endif
+#ifdef SIM_DIR_INDEX
+#undef SD_DIR_INDEX_SIZE
+#define SD_DIR_INDEX_SIZE SIM_DIR_INDEX
+#endif
+#ifdef SIM_EEPROM_CACHE
+#undef EEPROM_MODE
+#define EEPROM_MODE 2
+#define EEPROM_RAM_CACHE 1
+#endif
+#ifdef SIM_INFO_CACHE
+#undef JSON_OUTPUT
+#define JSON_OUTPUT 1
+#undef SD_INFO_CACHE_SIZE
+#define SD_INFO_CACHE_SIZE SIM_INFO_CACHE
+#endif
+#ifdef SIM_OUTPUT_BUFFER
+#undef OUTPUT_BUFFER_SIZE
+#define OUTPUT_BUFFER_SIZE 96
+#endif
+#ifdef SIM_GCODE_BUFFER
+#undef GCODE_BUFFER_SIZE
+#define GCODE_BUFFER_SIZE 8
+#endif
+#ifdef SIM_INPUT_SHAPING
+#undef INPUT_SHAPING
+#define INPUT_SHAPING 1
+#endif
+#ifdef SIM_ACCELERATION
+#undef MAX_ACCELERATION_UNITS_PER_SQ_SECOND_X
+#undef MAX_ACCELERATION_UNITS_PER_SQ_SECOND_Y
+#undef MAX_TRAVEL_ACCELERATION_UNITS_PER_SQ_SECOND_X
+#undef MAX_TRAVEL_ACCELERATION_UNITS_PER_SQ_SECOND_Y
+#define MAX_ACCELERATION_UNITS_PER_SQ_SECOND_X SIM_ACCELERATION
+#define MAX_ACCELERATION_UNITS_PER_SQ_SECOND_Y SIM_ACCELERATION
+#define MAX_TRAVEL_ACCELERATION_UNITS_PER_SQ_SECOND_X SIM_ACCELERATION
+#define MAX_TRAVEL_ACCELERATION_UNITS_PER_SQ_SECOND_Y SIM_ACCELERATION
+#endif
+#ifdef SIM_ADVANCE_IN_STEPPER
+#undef ADVANCE_IN_STEPPER
+#define ADVANCE_IN_STEPPER 1
+#endif
+#ifdef SIM_ADVANCE_SMOOTH_TIME
+#undef ADVANCE_SMOOTH_TIME
+#define ADVANCE_SMOOTH_TIME SIM_ADVANCE_SMOOTH_TIME
+#endif
+#ifdef SIM_JUNCTION_DEVIATION
+#undef JUNCTION_DEVIATION
+#define JUNCTION_DEVIATION 1
+#undef JUNCTION_DEVIATION_MM
+#define JUNCTION_DEVIATION_MM SIM_JUNCTION_DEVIATION
+#endif
+#ifdef SIM_CARTESIAN
+#undef DRIVE_SYSTEM
+#define DRIVE_SYSTEM 0
+#endif
+#ifdef SIM_ARC_IN_STEPPER
+#undef ARC_IN_STEPPER
+#define ARC_IN_STEPPER 1
+#endif
+#ifdef SIM_PLANNER_EARLY_STOP
+#define PLANNER_EARLY_STOP 1
+#endif
+#ifdef SIM_DELTA
+// Delta block of Configuration.h, it is skipped for the configured drive system
+#undef DRIVE_SYSTEM
+#define DRIVE_SYSTEM DELTA
+#undef XAXIS_STEPS_PER_MM
+#undef YAXIS_STEPS_PER_MM
+#undef ZAXIS_STEPS_PER_MM
+#define XAXIS_STEPS_PER_MM 80
+#define YAXIS_STEPS_PER_MM 80
+#define ZAXIS_STEPS_PER_MM 80
+#define DELTA_DIAGONAL_ROD 345
+#define DELTA_ALPHA_A 210
+#define DELTA_ALPHA_B 330
+#define DELTA_ALPHA_C 90
+#define DELTA_RADIUS_CORRECTION_A 0
+#define DELTA_RADIUS_CORRECTION_B 0
+#define DELTA_RADIUS_CORRECTION_C 0
+#define DELTA_DIAGONAL_CORRECTION_A 0
+#define DELTA_DIAGONAL_CORRECTION_B 0
+#define DELTA_DIAGONAL_CORRECTION_C 0
+#define DELTA_MAX_RADIUS 200
+#define DELTA_FLOOR_SAFETY_MARGIN_MM 15
+#define END_EFFECTOR_HORIZONTAL_OFFSET 0
+#define CARRIAGE_HORIZONTAL_OFFSET 0
+#define PRINTER_RADIUS 265.25
+#define DELTA_HOME_ON_POWER 0
+#define DELTA_X_ENDSTOP_OFFSET_STEPS 0
+#define DELTA_Y_ENDSTOP_OFFSET_STEPS 0
+#define DELTA_Z_ENDSTOP_OFFSET_STEPS 0
+#endif
+#ifdef SIM_SEGMENT_POOL
+// Same host RAM as the 32 lines with DELTASEGMENTS_PER_PRINTLINE segments each
+#undef NONLINEAR_SEGMENT_POOL
+#define NONLINEAR_SEGMENT_POOL 512
+#undef PRINTLINE_CACHE_SIZE
+#define PRINTLINE_CACHE_SIZE 38
+#endif
+#ifdef SIM_DELTA_TOLERANCE
+#undef DELTA_SEGMENT_TOLERANCE
+#define DELTA_SEGMENT_TOLERANCE SIM_DELTA_TOLERANCE
+#endif
+
+#endif
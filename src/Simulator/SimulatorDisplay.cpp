@@ -0,0 +1,307 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Display of the glcd variants, a RepRapDiscount full graphic controller. The
+ST7920 gets its bytes from u8glib by software SPI through digitalWrite, so
+refreshing it costs the simulated time it takes on the Due.
+
+Also hosts the file browser benchmark, see Simulator::browseBenchmark, the
+display refresh benchmark, see Simulator::refreshBenchmark, and the check of
+the ui texts against the old template parser, see
+Simulator::compareUiTemplates.
+*/
+
+#include "Repetier.h"
+#include <string>
+#include <time.h>
+#include <vector>
+
+#if UI_DISPLAY_TYPE == DISPLAY_U8G
+#include "sam.h"
+
+// Registers of the Due interfaces of u8glib, never used by the software SPI
+Pio simPio;
+Spi simSpi = { 0, 0, 0, 0, SPI_SR_TDRE, { 0, 0, 0, 0 } };
+const PinDescription g_APinDescription[256] = { };
+#endif
+
+#ifdef SIM_DISPLAY
+uint64_t Simulator::displayClocks = 0;
+
+static double hostSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** Calls refreshPage refreshes times. With changing the extruder temperature
+changes every 4th and the X position every 10th refresh, about what a print
+changes at one refresh per second. */
+static void timeRefreshes(const char* what, int refreshes, bool changing) {
+    uint64_t bytes = 0, cycles = 0, maxBytes = 0, maxCycles = 0;
+    for (int i = 0; i < refreshes; i++) {
+        if (changing) {
+            Extruder::current->tempControl.currentTemperatureC = 200 + (i / 4) % 3;
+            Printer::currentPosition[X_AXIS] = 10 + i / 10;
+        }
+        uint64_t clocks = Simulator::displayClocks, start = Simulator::cycles;
+        uid.refreshPage();
+        uint64_t b = (Simulator::displayClocks - clocks) / 8, c = Simulator::cycles - start;
+        bytes += b;
+        cycles += c;
+        if (b > maxBytes)
+            maxBytes = b;
+        if (c > maxCycles)
+            maxCycles = c;
+    }
+    printf("%s: %d refreshes, %.0f bytes and %.2f ms per refresh, full picture %u bytes and %.2f ms\n", what,
+           refreshes, static_cast<double>(bytes) / refreshes, static_cast<double>(cycles) * 1000 / F_CPU_TRUE / refreshes,
+           (unsigned)maxBytes, static_cast<double>(maxCycles) * 1000 / F_CPU_TRUE);
+}
+
+void Simulator::refreshBenchmark(int refreshes) {
+    Simulator::setupMachine();
+    Printer::setup();
+    // Positions of axes that are not homed blink
+    Printer::setXHomed(true);
+    Printer::setYHomed(true);
+    Printer::setZHomed(true);
+    timeRefreshes("Unchanged", refreshes, false);
+    timeRefreshes("Printing", refreshes, true);
+}
+
+/** UIDisplay::parse as it was before the templates got compiled, scanning
+the template for '%' on every call. The switch it had is parseVariable now. */
+static void oldParse(const char* txt, bool ram) {
+    while (uid.col < MAX_COLS) {
+        char c = (ram ? *(txt++) : pgm_read_byte(txt++));
+        if (c == 0)
+            break;
+        if (c != '%') {
+            uid.printCols[uid.col++] = c;
+            continue;
+        }
+        char c1 = (ram ? *(txt++) : pgm_read_byte(txt++));
+        char c2 = (ram ? *(txt++) : pgm_read_byte(txt++));
+        if (c1 == '%' && c2 != '%')
+            txt--; // Be flexible and accept 2 or 3 chars
+        else if (c1 == 'e' && c2 == 'I')
+            txt++; // just skip c sign
+        uid.parseVariable(c1, c2);
+    }
+    uid.printCols[uid.col] = 0;
+}
+
+/** Renders text with oldParse and UIDisplay::parse and compares the rows. */
+static int compareRow(int lang, int id, const char* text, bool ram) {
+    char expected[MAX_COLS + 1];
+    uid.col = 0;
+    oldParse(text, ram);
+    strcpy(expected, uid.printCols);
+    uid.col = 0;
+    uid.parse(text, ram);
+    if (strcmp(expected, uid.printCols) == 0)
+        return 0;
+    printf("Language %d text %d%s: \"%s\" instead of \"%s\"\n", lang, id, ram ? " from ram" : "", uid.printCols,
+           expected);
+    return 1;
+}
+
+/** Host time per row of oldParse or UIDisplay::parse for the rows
+[first, first + rows), rendered like refreshPage does. */
+static double timeRows(bool old, int first, int rows) {
+    const int repeat = 20000;
+    double start = hostSeconds();
+    for (int r = 0; r < repeat; r++)
+        for (int id = first; id < first + rows; id++) {
+            uid.col = 0;
+            if (old)
+                oldParse(Com::translatedF(id), false);
+            else
+                uid.parse(Com::translatedF(id), false);
+        }
+    return (hostSeconds() - start) * 1e9 / repeat / rows;
+}
+
+int Simulator::compareUiTemplates() {
+    Simulator::setupMachine();
+    Printer::setup();
+    Printer::setXHomed(true);
+    Printer::setYHomed(true);
+    Printer::setZHomed(true);
+    uid.executeAction(UI_ACTION_SELECT_EXTRUDER0, true); // Heater for the %h variables
+    int wrong = 0, languages = 0, texts = 0;
+    char copy[256];
+    for (int lang = 0; lang < NUM_LANGUAGES_KNOWN; lang++) {
+        Com::selectLanguage(lang);
+        if (Com::selectedLanguage != lang)
+            continue; // Not compiled in
+        languages++;
+        // refreshPage renders up to UI_ROWS rows per page, each page twice,
+        // so the second time finds all of them in the cache
+        for (int first = 0; first < NUM_TRANSLATED_WORDS; first += UI_ROWS)
+            for (int pass = 0; pass < 2; pass++)
+                for (int id = first; id < first + UI_ROWS && id < NUM_TRANSLATED_WORDS; id++) {
+                    const char* text = Com::translatedF(id);
+                    wrong += compareRow(lang, id, text, false);
+                    if (pass == 0) {
+                        strncpy(copy, text, sizeof(copy) - 1);
+                        copy[sizeof(copy) - 1] = 0;
+                        wrong += compareRow(lang, id, copy, true);
+                        texts++;
+                    }
+                }
+    }
+    printf("UI texts: %d languages, %d texts, %d differ\n", languages, texts, wrong);
+    Com::selectLanguage(LANGUAGE_EN_ID);
+    printf("Info page: %.0f ns per refresh before, %.0f ns per refresh compiled\n",
+           6 * timeRows(true, UI_TEXT_MAINPAGE6_1_ID, 6), 6 * timeRows(false, UI_TEXT_MAINPAGE6_1_ID, 6));
+    printf("All texts: %.0f ns per row before, %.0f ns per row compiled\n",
+           timeRows(true, 0, NUM_TRANSLATED_WORDS), timeRows(false, 0, NUM_TRANSLATED_WORDS));
+    return wrong;
+}
+#endif
+
+#if UI_DISPLAY_TYPE != NO_DISPLAY && SDSUPPORT
+// File browser of ui.cpp
+extern uint16_t nFilesOnCard;
+void getSDFilenameAt(uint16_t filePos, char* filename);
+void sdrefresh(uint16_t& r, char cache[UI_ROWS][MAX_COLS + 1]);
+
+/** Names the browser should show in the current folder, read with a plain
+walk over all entries. */
+static std::vector<std::string> browserTruth() {
+    std::vector<std::string> names;
+    FatFile* root = sd.fat.vwd();
+    FatFile file;
+    char name[LONG_FILENAME_LENGTH + 2];
+    root->rewind();
+    while (file.openNext(root, O_READ)) {
+        file.getName(name, LONG_FILENAME_LENGTH);
+        bool hidden = (name[0] == '.' && name[1] != '.') || (uid.folderLevel >= SD_MAX_FOLDER_DEPTH && strcmp(name, "..") == 0);
+        if (!hidden)
+            names.push_back(std::string(name) + (file.isDir() ? "/" : ""));
+        file.close();
+    }
+    return names;
+}
+
+/** Compares every position of the browser with browserTruth. With the
+index the file count has to follow the folder, too. Returns the number of
+wrong positions. */
+static int checkBrowser(const char* what) {
+    sd.fat.chdir(uid.cwd); // Like sdrefresh, M28 and M30 leave the root selected
+    std::vector<std::string> truth = browserTruth();
+    char name[LONG_FILENAME_LENGTH + 2];
+    int wrong = 0;
+    // Backwards, a change in front of the position is the hard case
+    for (size_t i = truth.size() + 1; i-- > 0;) {
+        getSDFilenameAt(i, name);
+        const char* expected = i < truth.size() ? truth[i].c_str() : "";
+        if (strcmp(name, expected) != 0) {
+            if (wrong++ < 5)
+                printf("%s: file %u is \"%s\" instead of \"%s\"\n", what, (unsigned)i, name, expected);
+        }
+    }
+#if SD_DIR_INDEX_SIZE > 0
+    if (nFilesOnCard != truth.size()) {
+        printf("%s: %u files counted instead of %u\n", what, (unsigned)nFilesOnCard, (unsigned)truth.size());
+        wrong++;
+    }
+#endif
+    printf("%s: %s\n", what, wrong ? "wrong" : "ok");
+    return wrong;
+}
+
+/** Creates an empty file path on the card the way M28/M29 do. */
+static void createFile(const char* path) {
+    char name[64];
+    strcpy(name, path);
+    sd.startWrite(name);
+    sd.finishWrite();
+}
+
+static void deleteFile(const char* path) {
+    char name[64];
+    strcpy(name, path);
+    sd.fat.chdir();
+    sd.deleteFile(name);
+}
+
+int Simulator::browseBenchmark(int files) {
+    char name[64];
+    Simulator::setupMachine();
+    Printer::setup();
+    sd.fat.chdir();
+    sd.fat.mkdir("bench");
+    for (int i = 0; i < files; i++) {
+        sprintf(name, "bench/part %04d of the browser test.gcode", i);
+        createFile(name);
+    }
+    strcpy(name, "bench/");
+    uid.goDir(name);
+    int wrong = checkBrowser("Unchanged folder");
+
+    // Selecting every file
+    std::vector<std::string> truth = browserTruth();
+    uint32_t blocks = Simulator::sdBlocksRead;
+    uint64_t cycles = Simulator::sdCycles;
+    double start = hostSeconds();
+    for (int i = 0; i < files; i++)
+        getSDFilenameAt(i, name);
+    double host = hostSeconds() - start;
+    printf("Select: %d files, %.1f blocks and %.2f ms card time per file, %.1f us host time per file\n", files,
+           static_cast<double>(Simulator::sdBlocksRead - blocks) / files,
+           static_cast<double>(Simulator::sdCycles - cycles) * 1000 / F_CPU_TRUE / files, host * 1e6 / files);
+
+    // Scrolling from the top to the bottom one line per refresh
+    char cache[UI_ROWS][MAX_COLS + 1];
+    uint8_t level = uid.menuLevel;
+    uid.menuLevel = 1;
+    blocks = Simulator::sdBlocksRead;
+    cycles = Simulator::sdCycles;
+    start = hostSeconds();
+    for (int i = 0; i < files; i++) {
+        uint16_t r = 0;
+        uid.menuPos[1] = i;
+        uid.menuTop[1] = i >= UI_ROWS ? i - UI_ROWS + 1 : 0;
+        sdrefresh(r, cache);
+    }
+    host = hostSeconds() - start;
+    uid.menuLevel = level;
+    printf("Scroll: %d refreshes, %.1f blocks and %.2f ms card time per refresh, %.1f us host time per refresh\n",
+           files, static_cast<double>(Simulator::sdBlocksRead - blocks) / files,
+           static_cast<double>(Simulator::sdCycles - cycles) * 1000 / F_CPU_TRUE / files, host * 1e6 / files);
+
+    // Changes behind the back of the index
+    createFile("bench/zz added at the end.gcode");
+    wrong += checkBrowser("Added file");
+    sprintf(name, "bench/part %04d of the browser test.gcode", files / 2);
+    deleteFile(name);
+    wrong += checkBrowser("Deleted file");
+    sprintf(name, "bench/part %04d of the browser test.gcode", files / 4);
+    deleteFile(name);
+    sprintf(name, "bench/part %04d replaced in the test.gcode", files / 4);
+    createFile(name); // As many long name entries, reuses the free ones
+    wrong += checkBrowser("Replaced file");
+    strcpy(name, "../");
+    uid.goDir(name);
+    wrong += checkBrowser("Parent folder");
+    return wrong;
+}
+#endif
@@ -0,0 +1,179 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Eeprom of the eepromcache variant. HAL::virtualEeprom becomes the 4 KB
+eeprom of an ATmega2560 behind the avr-libc functions EepromCache.h of the
+AVR version uses, so the RAM cache runs unchanged on the host. A burn takes
+SIM_EEPROM_BURN_US, reads and burns wait for a running burn like avr-libc
+does.
+
+Also hosts the replay of settings changes, see Simulator::eepromReplay.
+*/
+
+#include "Repetier.h"
+
+#if EEPROM_RAM_CACHE
+#include "../ArduinoAVR/Repetier/EepromCache.h"
+
+#define SIM_EEPROM_BURN_US 3400
+
+uint8_t Simulator::eepromReference[EEPROM_BYTES];
+uint32_t Simulator::eepromWrites = 0;
+uint32_t Simulator::eepromWaits = 0;
+uint64_t Simulator::eepromWaitCycles = 0;
+uint32_t Simulator::eepromEarlyChecksums = 0;
+static uint64_t eepromReadyAt = 0; ///< End of the running burn
+
+void Simulator::eepromWriteThrough(unsigned int pos, const void* src, uint8_t size) {
+    memcpy(&eepromReference[pos], src, size);
+    eepromWrites += size;
+}
+
+void eeprom_busy_wait() {
+    if (Simulator::cycles >= eepromReadyAt)
+        return;
+    Simulator::eepromWaits++;
+    Simulator::eepromWaitCycles += eepromReadyAt - Simulator::cycles;
+    Simulator::advance(eepromReadyAt - Simulator::cycles);
+}
+
+bool eeprom_is_ready() {
+    return Simulator::cycles >= eepromReadyAt;
+}
+
+uint8_t eeprom_read_byte(const uint8_t* pos) {
+    eeprom_busy_wait();
+    return HAL::virtualEeprom[reinterpret_cast<uintptr_t>(pos)];
+}
+
+void eeprom_read_block(void* dst, const void* pos, size_t size) {
+    eeprom_busy_wait();
+    memcpy(dst, &HAL::virtualEeprom[reinterpret_cast<uintptr_t>(pos)], size);
+}
+
+void eeprom_write_byte(uint8_t* pos, uint8_t value) {
+    eeprom_busy_wait();
+    uintptr_t idx = reinterpret_cast<uintptr_t>(pos);
+    if (idx == EPR_INTEGRITY_BYTE && HAL::eprPending() > 1) // The integrity byte counts itself
+        Simulator::eepromEarlyChecksums++;
+    HAL::virtualEeprom[idx] = value;
+    eepromReadyAt = Simulator::cycles + static_cast<uint64_t>(SIM_EEPROM_BURN_US) * (F_CPU_TRUE / 1000000);
+}
+
+/** Same sequence on every run and host. */
+static uint32_t replayRandom(uint32_t range) {
+    static uint32_t seed = 1;
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % range;
+}
+
+/** Float settings M206 writes directly, inside the cached range. */
+static const unsigned int cachedSettings[] = {
+    EPR_Z_PROBE_X_OFFSET, EPR_Z_PROBE_Y_OFFSET, EPR_Z_PROBE_HEIGHT, EPR_Z_PROBE_SPEED,
+    EPR_Z_PROBE_X1, EPR_Z_PROBE_Y1, EPR_Z_PROBE_X2, EPR_Z_PROBE_Y2,
+    EPR_Z_PROBE_X3, EPR_Z_PROBE_Y3, EPR_Z_PROBE_XY_SPEED, EPR_Z_PROBE_BED_DISTANCE,
+    EPR_RETRACTION_LENGTH, EPR_RETRACTION_SPEED, EPR_Z_PROBE_Z_OFFSET, EPR_PARK_Z
+};
+
+static void replayCommand(const char* line) {
+    GCode code;
+    code.source = &serial0Source; // executeGCode answers there
+    if (code.parseAscii(const_cast<char*>(line), false))
+        Commands::executeGCode(&code);
+}
+
+/** Returns the number of bytes HAL::eprGetByte reads differently from the
+reference. */
+static int checkReads(const char* after) {
+    int wrong = 0;
+    for (unsigned int pos = 0; pos < EEPROM_BYTES; pos++)
+        if (HAL::eprGetByte(pos) != Simulator::eepromReference[pos]) {
+            if (wrong++ == 0)
+                printf("After %s: byte %u reads %u instead of %u\n", after, pos, HAL::eprGetByte(pos),
+                       Simulator::eepromReference[pos]);
+        }
+    return wrong;
+}
+
+int Simulator::eepromReplay(int stores) {
+    Simulator::setupMachine();
+    Printer::setup();
+    HAL::eprFlush();
+    int wrong = checkReads("setup");
+    memset(HAL::eprWear, 0, sizeof(HAL::eprWear));
+    HAL::eprWritesSaved = 0;
+    eepromWrites = 0;
+    eepromWaits = 0;
+    eepromWaitCycles = 0;
+    eepromEarlyChecksums = 0;
+    uint64_t maxStoreWait = 0, start = cycles;
+    int commands = 0;
+    char line[64];
+    for (int s = 0; s < stores; s++) {
+        uint64_t waited = eepromWaitCycles;
+        int changes = 1 + replayRandom(5);
+        for (int c = 0; c < changes; c++) {
+            float value = 1 + replayRandom(10000) * 0.01f;
+            switch (replayRandom(4)) {
+            case 0:
+                sprintf(line, "M92 %c%.2f", "XYZ"[replayRandom(3)], 40 + value);
+                break;
+            case 1:
+                sprintf(line, "M201 %c%d", "XYZ"[replayRandom(3)], 500 + static_cast<int>(value) * 10);
+                break;
+            case 2:
+                sprintf(line, "M203 %c%d", "XYZ"[replayRandom(3)], 3000 + static_cast<int>(value) * 60);
+                break;
+            default:
+                sprintf(line, "M206 T3 P%u X%.2f", cachedSettings[replayRandom(sizeof(cachedSettings) / sizeof(cachedSettings[0]))], value);
+            }
+            replayCommand(line);
+            wrong += checkReads(line);
+            commands++;
+        }
+        replayCommand("M500");
+        wrong += checkReads("M500");
+        if (eepromWaitCycles - waited > maxStoreWait)
+            maxStoreWait = eepromWaitCycles - waited;
+        // Until the next store the periodical actions run about every ms
+        for (int ms = replayRandom(100); ms > 0; ms--) {
+            HAL::delayMicroseconds(1000);
+            HAL::eprBurnStep();
+        }
+        wrong += checkReads("burning");
+    }
+    uint32_t pending = HAL::eprPending(), waits = eepromWaits;
+    HAL::eprFlush();
+    int wrongBytes = 0;
+    for (unsigned int pos = 0; pos < EEPROM_BYTES; pos++)
+        if (static_cast<uint8_t>(HAL::virtualEeprom[pos]) != eepromReference[pos])
+            wrongBytes++;
+    uint32_t burns = 0;
+    for (unsigned int i = 0; i < sizeof(HAL::eprWear) / sizeof(HAL::eprWear[0]); i++)
+        burns += HAL::eprWear[i];
+    printf("Stores: %d with %d settings commands in %.1f s, %u bytes pending at the end\n", stores, commands,
+           static_cast<double>(cycles - start) / F_CPU_TRUE, (unsigned)pending);
+    printf("Burns: %u written through, %u with the cache, %u writes saved\n", (unsigned)eepromWrites,
+           (unsigned)burns, (unsigned)HAL::eprWritesSaved);
+    printf("Waits: %u for a running burn, at most %.1f ms in one store\n", (unsigned)waits,
+           static_cast<double>(maxStoreWait) * 1000 / F_CPU_TRUE);
+    printf("Checks: %d wrong reads, %d wrong bytes at the end, integrity byte burned early %u times\n", wrong,
+           wrongBytes, (unsigned)eepromEarlyChecksums);
+    return wrong + wrongBytes + eepromEarlyChecksums;
+}
+#endif
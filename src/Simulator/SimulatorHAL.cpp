@@ -0,0 +1,793 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Repetier.h"
+#include <time.h>
+
+char HAL::virtualEeprom[EEPROM_BYTES];
+bool HAL::wdPinged = true;
+volatile uint8_t HAL::insideTimer1 = 0;
+
+uint64_t Simulator::cycles = 0;
+volatile bool Simulator::interruptsBlocked = false;
+bool Simulator::insideInterrupt = false;
+uint8_t Simulator::pins[256];
+uint32_t Simulator::extruderTimerTicks = (F_CPU_TRUE / 32) / EXTRUDER_CLOCK_FREQ;
+SimMotor Simulator::motors[SIM_MOTORS];
+FILE* Simulator::timeline = NULL;
+uint32_t Simulator::stepperCalls = 0;
+uint32_t Simulator::extruderCalls = 0;
+uint64_t Simulator::stepperHostNanos = 0;
+int Simulator::freeRam = MAX_RAM;
+double Simulator::printDistance = 0;
+double Simulator::printSeconds = 0;
+double Simulator::queuedLines = 0;
+double Simulator::queuedSeconds = 0;
+uint8_t Simulator::minQueuedLines = 255;
+float Simulator::maxAcceleration = 0;
+float Simulator::maxJerk = 0;
+float Simulator::resonanceFrequency = 0;
+double Simulator::restVibration[2] = { 0, 0 };
+double Simulator::cruiseVibration[2] = { 0, 0 };
+uint32_t Simulator::timelineDifferences = 0;
+uint64_t Simulator::maxTimelineDifference = 0;
+#if DRIVE_SYSTEM == DELTA
+uint32_t Simulator::deltaSegments = 0;
+double Simulator::maxDeltaDeviation = 0;
+#endif
+
+#ifndef STEPPERTIMER_EXIT_TICKS
+#define STEPPERTIMER_EXIT_TICKS 105 // same minimum pause as on the Due
+#endif
+#define PWM_PERIOD_CYCLES (F_CPU_TRUE / PWM_CLOCK_FREQ)
+
+static uint64_t nextStepper = 0;
+static uint64_t nextPwm = 0;
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
+static uint64_t nextExtruder = 0;
+#endif
+static int8_t stepPinMotor[256];
+
+/** Hardware endstop or z probe, triggered when the axis reaches the end. */
+struct SimEndstop {
+    int pin;
+    uint8_t axis;
+    bool max;
+    uint8_t triggeredLevel;
+};
+static SimEndstop endstops[8];
+static uint8_t numEndstops = 0;
+/** Motor position of the axis origin (min endstop) and axis length in steps. */
+static int32_t axisOrigin[Z_AXIS_ARRAY];
+static int32_t axisSteps[Z_AXIS_ARRAY];
+
+HAL::HAL() {
+}
+
+HAL::~HAL() {
+}
+
+static uint64_t hostClock() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t Simulator::hostNanos() {
+    return (uint32_t)hostClock();
+}
+
+static void addMotor(uint8_t id, int stepPin, int dirPin, bool invertDir) {
+    SimMotor& m = Simulator::motors[id];
+    m.position = 0;
+    m.steps = 0;
+    m.dirPin = dirPin;
+    m.invertDir = invertDir;
+    if (stepPin >= 0 && stepPin < 256)
+        stepPinMotor[stepPin] = id;
+}
+
+static void addEndstop(int pin, uint8_t axis, bool max, uint8_t triggeredLevel) {
+    if (pin < 0 || numEndstops >= 8)
+        return;
+    SimEndstop& e = endstops[numEndstops++];
+    e.pin = pin;
+    e.axis = axis;
+    e.max = max;
+    e.triggeredLevel = triggeredLevel;
+}
+
+void Simulator::setupMachine() {
+    memset(stepPinMotor, -1, sizeof(stepPinMotor));
+    addMotor(X_AXIS, X_STEP_PIN, X_DIR_PIN, INVERT_X_DIR);
+    addMotor(Y_AXIS, Y_STEP_PIN, Y_DIR_PIN, INVERT_Y_DIR);
+    addMotor(Z_AXIS, Z_STEP_PIN, Z_DIR_PIN, INVERT_Z_DIR);
+#if NUM_EXTRUDER > 0
+    addMotor(E_AXIS, EXT0_STEP_PIN, EXT0_DIR_PIN, EXT0_INVERSE);
+#endif
+#if NUM_EXTRUDER > 1 && !MIXING_EXTRUDER
+    addMotor(E_AXIS + 1, EXT1_STEP_PIN, EXT1_DIR_PIN, EXT1_INVERSE);
+#endif
+#if NUM_EXTRUDER > 2 && !MIXING_EXTRUDER
+    addMotor(E_AXIS + 2, EXT2_STEP_PIN, EXT2_DIR_PIN, EXT2_INVERSE);
+#endif
+#if NUM_EXTRUDER > 3 && !MIXING_EXTRUDER
+    addMotor(E_AXIS + 3, EXT3_STEP_PIN, EXT3_DIR_PIN, EXT3_INVERSE);
+#endif
+#if NUM_EXTRUDER > 4 && !MIXING_EXTRUDER
+    addMotor(E_AXIS + 4, EXT4_STEP_PIN, EXT4_DIR_PIN, EXT4_INVERSE);
+#endif
+#if NUM_EXTRUDER > 5 && !MIXING_EXTRUDER
+    addMotor(E_AXIS + 5, EXT5_STEP_PIN, EXT5_DIR_PIN, EXT5_INVERSE);
+#endif
+#if MIN_HARDWARE_ENDSTOP_X
+    addEndstop(X_MIN_PIN, X_AXIS, false, !ENDSTOP_X_MIN_INVERTING);
+#endif
+#if MAX_HARDWARE_ENDSTOP_X
+    addEndstop(X_MAX_PIN, X_AXIS, true, !ENDSTOP_X_MAX_INVERTING);
+#endif
+#if MIN_HARDWARE_ENDSTOP_Y
+    addEndstop(Y_MIN_PIN, Y_AXIS, false, !ENDSTOP_Y_MIN_INVERTING);
+#endif
+#if MAX_HARDWARE_ENDSTOP_Y
+    addEndstop(Y_MAX_PIN, Y_AXIS, true, !ENDSTOP_Y_MAX_INVERTING);
+#endif
+#if MIN_HARDWARE_ENDSTOP_Z
+    addEndstop(Z_MIN_PIN, Z_AXIS, false, !ENDSTOP_Z_MIN_INVERTING);
+#endif
+#if MAX_HARDWARE_ENDSTOP_Z
+    addEndstop(Z_MAX_PIN, Z_AXIS, true, !ENDSTOP_Z_MAX_INVERTING);
+#endif
+#if FEATURE_Z_PROBE
+    addEndstop(Z_PROBE_PIN, Z_AXIS, false, Z_PROBE_ON_HIGH ? 1 : 0);
+#endif
+    // The machine starts in the middle of the build volume. Deltas use the
+    // carriage positions and start 10 mm below the tower endstops.
+    float lengths[Z_AXIS_ARRAY] = { X_MAX_LENGTH, Y_MAX_LENGTH, Z_MAX_LENGTH };
+    float resolution[Z_AXIS_ARRAY] = { XAXIS_STEPS_PER_MM, YAXIS_STEPS_PER_MM, ZAXIS_STEPS_PER_MM };
+    for (uint8_t i = 0; i < Z_AXIS_ARRAY; i++) {
+#if DRIVE_SYSTEM == DELTA
+        axisSteps[i] = static_cast<int32_t>(10 * resolution[i]);
+        axisOrigin[i] = -axisSteps[i];
+#else
+        axisSteps[i] = static_cast<int32_t>(lengths[i] * resolution[i]);
+        axisOrigin[i] = -axisSteps[i] / 2;
+#endif
+    }
+}
+
+#if DRIVE_SYSTEM == DELTA
+static int32_t towerOffset[TOWER_ARRAY]; ///< Carriage height minus motor position in steps
+static bool towersAligned = false;
+static bool deltaLineMeasured = false;   ///< Segments of the next line were measured
+
+void Simulator::alignDeltaTowers() {
+    if (PrintLine::nlFlag || PrintLine::linesCount > 0)
+        return;
+    for (fast8_t t = 0; t < TOWER_ARRAY; t++)
+        towerOffset[t] = Printer::currentNonlinearPositionSteps[t] - motors[t].position;
+    towersAligned = !Printer::isLargeMachine(); // deltaEffector uses the 32 bit rod lengths
+}
+
+/** Effector position in steps for the carriage heights h, lower solution of
+the three rod spheres. */
+static void deltaEffector(const double* h, double* p) {
+    const double x[TOWER_ARRAY] = { static_cast<double>(Printer::deltaAPosXSteps), static_cast<double>(Printer::deltaBPosXSteps), static_cast<double>(Printer::deltaCPosXSteps) };
+    const double y[TOWER_ARRAY] = { static_cast<double>(Printer::deltaAPosYSteps), static_cast<double>(Printer::deltaBPosYSteps), static_cast<double>(Printer::deltaCPosYSteps) };
+    const double d[TOWER_ARRAY] = { static_cast<double>(Printer::deltaDiagonalStepsSquaredA.l), static_cast<double>(Printer::deltaDiagonalStepsSquaredB.l), static_cast<double>(Printer::deltaDiagonalStepsSquaredC.l) };
+    // Differences of the sphere equations are planes a x + b y + c z = e
+    double a[2], b[2], c[2], e[2];
+    for (fast8_t i = 0; i < 2; i++) {
+        a[i] = 2 * (x[i + 1] - x[0]);
+        b[i] = 2 * (y[i + 1] - y[0]);
+        c[i] = 2 * (h[i + 1] - h[0]);
+        e[i] = d[0] - d[i + 1] + x[i + 1] * x[i + 1] - x[0] * x[0] + y[i + 1] * y[i + 1] - y[0] * y[0] + h[i + 1] * h[i + 1] - h[0] * h[0];
+    }
+    // x = x0 + xz z, y = y0 + yz z
+    double det = a[0] * b[1] - a[1] * b[0];
+    double x0 = (e[0] * b[1] - e[1] * b[0]) / det, xz = (c[1] * b[0] - c[0] * b[1]) / det;
+    double y0 = (a[0] * e[1] - a[1] * e[0]) / det, yz = (a[1] * c[0] - a[0] * c[1]) / det;
+    // Sphere of tower A as quadratic in z
+    double px = x0 - x[0], py = y0 - y[0];
+    double qa = xz * xz + yz * yz + 1;
+    double qb = 2 * (px * xz + py * yz - h[0]);
+    double qc = px * px + py * py + h[0] * h[0] - d[0];
+    double z = (-qb - sqrt(qb * qb - 4 * qa * qc)) / (2 * qa);
+    p[X_AXIS] = x0 + xz * z;
+    p[Y_AXIS] = y0 + yz * z;
+    p[Z_AXIS] = z;
+}
+
+/** Effector position in steps from the motor positions, false before the
+towers were aligned. */
+static bool effectorPosition(double* p) {
+    if (!towersAligned)
+        return false;
+    double h[TOWER_ARRAY];
+    for (fast8_t t = 0; t < TOWER_ARRAY; t++)
+        h[t] = Simulator::motors[t].position + towerOffset[t];
+    deltaEffector(h, p);
+    return true;
+}
+#endif
+
+/** Axis position in steps from the motor positions. Gantry motors count two
+units per step, see PrintLine::startXStep. */
+static int32_t axisPosition(uint8_t axis) {
+    SimMotor* m = Simulator::motors;
+#if DRIVE_SYSTEM == XY_GANTRY
+    if (axis == X_AXIS)
+        return m[X_AXIS].position + m[Y_AXIS].position;
+    if (axis == Y_AXIS)
+        return m[X_AXIS].position - m[Y_AXIS].position;
+#elif DRIVE_SYSTEM == YX_GANTRY
+    if (axis == X_AXIS)
+        return m[X_AXIS].position - m[Y_AXIS].position;
+    if (axis == Y_AXIS)
+        return m[X_AXIS].position + m[Y_AXIS].position;
+#elif DRIVE_SYSTEM == XZ_GANTRY
+    if (axis == X_AXIS)
+        return m[X_AXIS].position + m[Z_AXIS].position;
+    if (axis == Z_AXIS)
+        return m[X_AXIS].position - m[Z_AXIS].position;
+#elif DRIVE_SYSTEM == ZX_GANTRY
+    if (axis == X_AXIS)
+        return m[X_AXIS].position - m[Z_AXIS].position;
+    if (axis == Z_AXIS)
+        return m[X_AXIS].position + m[Z_AXIS].position;
+#endif
+    return m[axis].position;
+}
+
+#define SIM_PATH_SAMPLE_PERIODS (PWM_CLOCK_FREQ / 1000)
+
+static bool extrudingMoveRan = false; ///< An extruding XY move executed since the last path sample
+
+static inline void noteExtrudingMove() {
+    PrintLine* cur = PrintLine::cur;
+    if (cur != NULL && cur->isEPositiveMove() && cur->isXOrYMove())
+        extrudingMoveRan = true;
+}
+
+/** Adds the XY path of the last millisecond to the printing statistics if an
+extruding move executed in that time. */
+static void samplePrintPath() {
+    static double lastX = 0, lastY = 0;
+#if DRIVE_SYSTEM == DELTA
+    double p[Z_AXIS_ARRAY];
+    if (!effectorPosition(p)) {
+        extrudingMoveRan = false;
+        return;
+    }
+    double x = p[X_AXIS], y = p[Y_AXIS];
+#else
+    double x = axisPosition(X_AXIS), y = axisPosition(Y_AXIS);
+#endif
+    if (extrudingMoveRan) {
+        double dx = (x - lastX) * Printer::invAxisStepsPerMM[X_AXIS];
+        double dy = (y - lastY) * Printer::invAxisStepsPerMM[Y_AXIS];
+        Simulator::printDistance += sqrt(dx * dx + dy * dy);
+        Simulator::printSeconds += 0.001;
+        Simulator::sampleQueue();
+    }
+    lastX = x;
+    lastY = y;
+    extrudingMoveRan = false;
+    noteExtrudingMove(); // a move still running counts for the next sample too
+}
+
+void Simulator::sampleQueue() {
+    InterruptProtectedBlock noInts;
+    uint8_t count = PrintLine::linesCount;
+    uint64_t ticks = 0;
+    ufast8_t pos = PrintLine::linesPos;
+    for (uint8_t i = 0; i < count; i++) {
+        ticks += PrintLine::lines[pos].timeInTicks;
+        PrintLine::nextPlannerIndex(pos);
+    }
+    queuedLines += count;
+    queuedSeconds += static_cast<double>(ticks) / F_CPU;
+    if (count < minQueuedLines)
+        minQueuedLines = count;
+}
+
+#define SIM_RESONANCE_DAMPING 0.05
+
+/** X or Y axis as a mass on a spring that the motors move. */
+struct SimResonance {
+    double position;   ///< Mass position in mm
+    double speed;      ///< Mass speed in mm/s
+    double lastBase;   ///< Motor position in mm at the last sample
+    double minSpeed;   ///< Slowest mass speed of the running cruise phase
+    double maxSpeed;
+};
+
+static SimResonance resonance[2];
+
+/** The motor position is linear between two samples, so the oscillation of
+the mass relative to it has an exact solution over one sample period. At rest
+the amplitude follows from position and speed of the mass. While cruising the
+motor speed jitters with every step, so the amplitude is taken from the range
+of the mass speed instead, which the spring smooths. Homing moves stop on the
+endstops and are left out. */
+void Simulator::sampleResonance() {
+    static bool initialized = false;
+    static double c[4];
+    static PrintLine* phaseLine = NULL;
+    const double dt = 1.0 / PWM_CLOCK_FREQ;
+    const double zeta = SIM_RESONANCE_DAMPING;
+    const double w = 2 * M_PI * resonanceFrequency;
+    const double wd = w * sqrt(1 - zeta * zeta);
+    if (!initialized) {
+        double decay = exp(-zeta * w * dt), cw = cos(wd * dt), sw = sin(wd * dt);
+        c[0] = decay * (cw + zeta * w / wd * sw);
+        c[1] = decay * sw / wd;
+        c[2] = -decay * w * w / wd * sw;
+        c[3] = decay * (cw - zeta * w / wd * sw);
+        for (uint8_t axis = 0; axis < 2; axis++) {
+            SimResonance& r = resonance[axis];
+            r.position = r.lastBase = axisPosition(axis) * Printer::invAxisStepsPerMM[axis];
+            r.speed = 0;
+        }
+        initialized = true;
+    }
+    PrintLine* cur = PrintLine::cur;
+    bool resting = PrintLine::linesCount == 0;
+    bool cruising = cur != NULL && Printer::stepNumber > cur->accelSteps
+                    && cur->stepsRemaining > static_cast<int32_t>(cur->decelSteps);
+    bool phaseEnds = phaseLine != NULL && (!cruising || cur != phaseLine);
+    for (uint8_t axis = 0; axis < 2; axis++) {
+        SimResonance& r = resonance[axis];
+        double base = axisPosition(axis) * Printer::invAxisStepsPerMM[axis];
+        double v = (base - r.lastBase) / dt;
+        double e = r.position - r.lastBase, de = r.speed - v;
+        r.lastBase = base;
+        if (Printer::isHoming()) {
+            r.position = base;
+            r.speed = v;
+            continue;
+        }
+        double e1 = c[0] * e + c[1] * de;
+        double de1 = c[2] * e + c[3] * de;
+        r.position = base + e1;
+        r.speed = v + de1;
+        if (resting) { // the motor stands from now on, its last steps may still fall into this sample
+            double s = (r.speed + zeta * w * e1) / wd;
+            double amplitude = sqrt(e1 * e1 + s * s);
+            if (amplitude > restVibration[axis])
+                restVibration[axis] = amplitude;
+        }
+        if (phaseEnds) {
+            double amplitude = (r.maxSpeed - r.minSpeed) * 0.5 / w;
+            if (amplitude > cruiseVibration[axis])
+                cruiseVibration[axis] = amplitude;
+        }
+        if (cruising && cur != phaseLine)
+            r.minSpeed = r.maxSpeed = r.speed;
+        else if (cruising) {
+            if (r.speed < r.minSpeed)
+                r.minSpeed = r.speed;
+            if (r.speed > r.maxSpeed)
+                r.maxSpeed = r.speed;
+        }
+    }
+    phaseLine = cruising ? cur : NULL;
+}
+
+#define SIM_MOTION_WINDOW 5 // ms between the speeds of a difference
+
+/** Path speed of the executing line from the last step interval. Acceleration and
+jerk are the differences over SIM_MOTION_WINDOW ms and only taken while the same
+line runs, so speed jumps at junctions are not counted. */
+void Simulator::sampleMotion() {
+    static float speeds[2 * SIM_MOTION_WINDOW + 1];
+    static uint8_t pos = 0;
+    static PrintLine* lastLine = NULL;
+    static uint8_t samplesInLine = 0; // the first sample may still have the interval of the last line
+    const uint8_t n = 2 * SIM_MOTION_WINDOW + 1;
+    PrintLine* cur = PrintLine::cur;
+    if (cur == NULL || cur != lastLine)
+        samplesInLine = 0;
+    else if (samplesInLine < n)
+        samplesInLine++;
+    lastLine = cur;
+    if (cur == NULL || cur->vMax == 0 || Printer::interval == 0)
+        return;
+    float speed = static_cast<float>(F_CPU) * Printer::stepsPerTimerCall / Printer::interval * cur->fullSpeed / cur->vMax;
+    pos = (pos + 1) % n;
+    speeds[pos] = speed;
+    const float window = SIM_MOTION_WINDOW * 0.001f;
+    if (samplesInLine <= SIM_MOTION_WINDOW)
+        return;
+    float acceleration = (speed - speeds[(pos + n - SIM_MOTION_WINDOW) % n]) / window;
+    if (fabs(acceleration) > maxAcceleration)
+        maxAcceleration = fabs(acceleration);
+    if (samplesInLine <= 2 * SIM_MOTION_WINDOW)
+        return;
+    float lastAcceleration = (speeds[(pos + n - SIM_MOTION_WINDOW) % n] - speeds[(pos + 1) % n]) / window;
+    float jerk = (acceleration - lastAcceleration) / window;
+    if (fabs(jerk) > maxJerk)
+        maxJerk = fabs(jerk);
+}
+
+#if DRIVE_SYSTEM == DELTA
+void Simulator::measureDeltaLine() {
+    if (PrintLine::nlFlag || PrintLine::linesCount == 0) {
+        deltaLineMeasured = false;
+        return;
+    }
+    if (deltaLineMeasured)
+        return;
+    deltaLineMeasured = true;
+    if (Printer::isHoming())
+        towersAligned = false; // endstops stop single towers
+    if (!towersAligned)
+        return;
+    PrintLine& line = PrintLine::lines[PrintLine::linesPos];
+    double h[TOWER_ARRAY], start[Z_AXIS_ARRAY], end[Z_AXIS_ARRAY], mid[Z_AXIS_ARRAY];
+    for (fast8_t t = 0; t < TOWER_ARRAY; t++)
+        h[t] = motors[t].position + towerOffset[t];
+    deltaEffector(h, start);
+    for (int n = line.numNonlinearSegments - 1; n >= 0; n--) { // stored last segment first
+        NonlinearSegment* s = line.nonlinearSegment(n);
+        double hMid[TOWER_ARRAY];
+        for (fast8_t t = 0; t < TOWER_ARRAY; t++) {
+            double steps = (s->dir & (X_DIRPOS << t)) ? s->deltaSteps[t] : -static_cast<double>(s->deltaSteps[t]);
+            hMid[t] = h[t] + 0.5 * steps;
+            h[t] += steps;
+        }
+        deltaEffector(h, end);
+        deltaEffector(hMid, mid);
+        double chord[Z_AXIS_ARRAY], off[Z_AXIS_ARRAY], length2 = 0, off2 = 0, dot = 0;
+        for (fast8_t i = 0; i < Z_AXIS_ARRAY; i++) {
+            chord[i] = end[i] - start[i];
+            off[i] = mid[i] - start[i];
+            length2 += chord[i] * chord[i];
+            off2 += off[i] * off[i];
+            dot += chord[i] * off[i];
+        }
+        double distance2 = length2 > 0 ? off2 - dot * dot / length2 : off2;
+        double deviation = (distance2 > 0 ? sqrt(distance2) : 0) * Printer::invAxisStepsPerMM[Z_AXIS];
+        if (deviation > maxDeltaDeviation)
+            maxDeltaDeviation = deviation;
+        deltaSegments++;
+        memcpy(start, end, sizeof(start));
+    }
+}
+#endif
+
+/** Steps of one motor in the reference timeline. */
+struct SimReferenceSteps {
+    SimTimelineRecord* records;
+    uint32_t count;
+    uint32_t next;
+};
+static SimReferenceSteps referenceSteps[SIM_MOTORS];
+
+bool Simulator::loadReferenceTimeline(const char* filename) {
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+    uint8_t header[16];
+    if (fread(header, sizeof(header), 1, f) != 1 || memcmp(header, "RSTL", 4) != 0 || header[12] != SIM_MOTORS) {
+        fclose(f);
+        return false;
+    }
+    SimTimelineRecord r;
+    long start = ftell(f);
+    while (fread(&r, sizeof(r), 1, f) == 1)
+        if (r.motor < SIM_MOTORS)
+            referenceSteps[r.motor].count++;
+    for (uint8_t i = 0; i < SIM_MOTORS; i++)
+        referenceSteps[i].records = static_cast<SimTimelineRecord*>(malloc((referenceSteps[i].count + 1) * sizeof(r)));
+    fseek(f, start, SEEK_SET);
+    while (fread(&r, sizeof(r), 1, f) == 1)
+        if (r.motor < SIM_MOTORS)
+            referenceSteps[r.motor].records[referenceSteps[r.motor].next++] = r;
+    fclose(f);
+    for (uint8_t i = 0; i < SIM_MOTORS; i++)
+        referenceSteps[i].next = 0;
+    return true;
+}
+
+void Simulator::finishReferenceTimeline() {
+    for (uint8_t i = 0; i < SIM_MOTORS; i++) {
+        SimReferenceSteps& ref = referenceSteps[i];
+        if (ref.records != NULL && ref.next < ref.count)
+            timelineDifferences += ref.count - ref.next;
+    }
+}
+
+static void compareWithReference(const SimTimelineRecord& r) {
+    SimReferenceSteps& ref = referenceSteps[r.motor];
+    if (ref.records == NULL)
+        return;
+    if (ref.next >= ref.count) {
+        Simulator::timelineDifferences++;
+        return;
+    }
+    const SimTimelineRecord& expected = ref.records[ref.next++];
+    uint64_t difference = r.time > expected.time ? r.time - expected.time : expected.time - r.time;
+    if (difference != 0 || r.dir != expected.dir)
+        Simulator::timelineDifferences++;
+    if (difference > Simulator::maxTimelineDifference)
+        Simulator::maxTimelineDifference = difference;
+}
+
+void Simulator::writePin(int pin, uint8_t value) {
+    if (pin < 0 || pin > 255)
+        return;
+    uint8_t old = pins[pin];
+    pins[pin] = value;
+#ifdef SIM_DISPLAY
+    // ST7920 software SPI: clock on D4, active high chip select on RS
+    if (pin == UI_DISPLAY_D4_PIN && value && !old && pins[UI_DISPLAY_RS_PIN])
+        displayClocks++;
+#endif
+    int8_t id = stepPinMotor[pin];
+    if (id < 0 || old == value || value != START_STEP_WITH_HIGH)
+        return;
+    SimMotor& m = motors[id];
+    int8_t dir = ((m.dirPin >= 0 ? pins[m.dirPin] : 1) != 0) != m.invertDir ? 1 : -1;
+    m.position += dir;
+    m.steps++;
+    if (m.lastDir != 0 && dir != m.lastDir)
+        m.reversals++;
+    m.lastDir = dir;
+    SimTimelineRecord r;
+    r.time = cycles;
+    r.motor = id;
+    r.dir = dir;
+    if (timeline != NULL)
+        fwrite(&r, sizeof(r), 1, timeline);
+    compareWithReference(r);
+}
+
+uint8_t Simulator::readPin(int pin) {
+    if (pin < 0 || pin > 255)
+        return 0;
+    for (uint8_t i = 0; i < numEndstops; i++) {
+        SimEndstop& e = endstops[i];
+        if (e.pin != pin)
+            continue;
+        int32_t pos = axisPosition(e.axis) - axisOrigin[e.axis];
+        bool hit = e.max ? pos >= axisSteps[e.axis] : pos <= 0;
+        return hit ? e.triggeredLevel : !e.triggeredLevel;
+    }
+    return pins[pin];
+}
+
+/** Same as TIMER1_COMPA_VECTOR of the Due HAL. Returns the delay to the next
+call in CPU cycles. */
+static uint32_t stepperInterrupt() {
+    uint32_t delay;
+    if (PrintLine::hasLines()) {
+        noteExtrudingMove();
+        delay = PrintLine::bresenhamStep();
+        noteExtrudingMove();
+#ifdef DEBUG_STEP_TIMELINE
+        StepTimeline::advance(delay);
+        StepTimeline::readPos = StepTimeline::writePos; // nobody reads them
+#endif
+    }
+#if FEATURE_BABYSTEPPING
+    else if (Printer::zBabystepsMissing != 0) {
+        Printer::zBabystep();
+        delay = Printer::interval;
+    }
+#endif
+    else {
+        delay = 10000;
+        if (waitRelax == 0) {
+#if USE_ADVANCE
+            if (Printer::advanceStepsSet) {
+                Printer::extruderStepsNeeded -= Printer::advanceStepsSet;
+#if ENABLE_QUADRATIC_ADVANCE
+                Printer::advanceExecuted = 0;
+#endif
+                Printer::advanceStepsSet = 0;
+            }
+#if ADVANCE_IN_STEPPER
+            Printer::advanceSmoothed = 0;
+            if (Printer::extruderStepsNeeded && Printer::isAdvanceActivated()) {
+                Printer::extruderStepBudget = Printer::extruderStepTicks;
+                PrintLine::advanceExtruderStep();
+                Printer::insertStepperHighDelay();
+                Extruder::unstep();
+                delay = Printer::extruderStepTicks;
+            }
+#endif
+            if ((!Printer::extruderStepsNeeded) && (DISABLE_E))
+                Extruder::disableCurrentExtruderMotor();
+#else
+            if (DISABLE_E)
+                Extruder::disableCurrentExtruderMotor();
+#endif
+        } else
+            waitRelax--;
+    }
+    uint32_t timerCount = delay * TIMER1_PRESCALE;
+    if (timerCount < STEPPERTIMER_EXIT_TICKS)
+        timerCount = STEPPERTIMER_EXIT_TICKS;
+    return timerCount * (F_CPU_TRUE / (F_CPU * TIMER1_PRESCALE));
+}
+
+/** Periodical part of PWM_TIMER_VECTOR. Heaters are not simulated. */
+static void pwmInterrupt() {
+    static uint8_t samplePeriods = 0;
+    if (++samplePeriods >= SIM_PATH_SAMPLE_PERIODS) {
+        samplePeriods = 0;
+        samplePrintPath();
+        Simulator::sampleMotion();
+    }
+    if (Simulator::resonanceFrequency > 0)
+        Simulator::sampleResonance();
+    counterPeriodical++;
+    if (counterPeriodical >= PWM_COUNTER_100MS) {
+        counterPeriodical = 0;
+        executePeriodical = 1;
+#if FEATURE_FAN_CONTROL
+        if (fanKickstart)
+            fanKickstart--;
+#endif
+#if FEATURE_FAN2_CONTROL
+        if (fan2Kickstart)
+            fan2Kickstart--;
+#endif
+    }
+}
+
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
+#ifndef ADVANCE_DIR_FILTER_STEPS
+#define ADVANCE_DIR_FILTER_STEPS 2
+#endif
+
+static int extruderLastDirection = 0;
+void HAL::resetExtruderDirection() { extruderLastDirection = 0; }
+
+/** Same as EXTRUDER_TIMER_VECTOR of the Due HAL. */
+static void extruderInterrupt() {
+    if (!Printer::isAdvanceActivated()) {
+        return;
+    }
+#ifdef DEBUG_STEP_TIMELINE
+    if (StepTimeline::recording)
+        StepTimeline::extruderInterrupts++;
+#endif
+    if (Printer::extruderStepsNeeded > 0 && extruderLastDirection != 1) {
+        if (Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS) {
+            Extruder::setDirection(true);
+            STEP_TIMELINE_REVERSAL
+            extruderLastDirection = 1;
+        }
+        Simulator::extruderTimerTicks = Printer::maxExtruderSpeed;
+    } else if (Printer::extruderStepsNeeded < 0 && extruderLastDirection != -1) {
+        if (-Printer::extruderStepsNeeded >= ADVANCE_DIR_FILTER_STEPS) {
+            Extruder::setDirection(false);
+            STEP_TIMELINE_REVERSAL
+            extruderLastDirection = -1;
+        }
+        Simulator::extruderTimerTicks = Printer::maxExtruderSpeed;
+    } else if (Printer::extruderStepsNeeded != 0) {
+        Extruder::step();
+        Printer::extruderStepsNeeded -= extruderLastDirection;
+        Simulator::extruderTimerTicks = Printer::maxExtruderSpeed;
+        Printer::insertStepperHighDelay();
+        Extruder::unstep();
+    }
+}
+#elif ADVANCE_IN_STEPPER
+void HAL::resetExtruderDirection() { Printer::extruderDirection = 0; }
+#endif
+
+void Simulator::advance(uint32_t cpuCycles) {
+    uint64_t target = cycles + cpuCycles;
+    if (interruptsBlocked || insideInterrupt) {
+        cycles = target; // interrupts run late like on the real cpu
+        return;
+    }
+    insideInterrupt = true;
+    while (true) {
+        // Run the interrupt that is due first
+        uint64_t next = nextStepper < nextPwm ? nextStepper : nextPwm;
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
+        if (nextExtruder < next)
+            next = nextExtruder;
+#endif
+        if (next > target)
+            break;
+        if (next > cycles)
+            cycles = next;
+        if (next == nextStepper) {
+#if DRIVE_SYSTEM == DELTA
+            measureDeltaLine();
+#endif
+            uint64_t start = hostClock();
+            nextStepper = cycles + stepperInterrupt();
+            stepperHostNanos += hostClock() - start;
+            stepperCalls++;
+        } else if (next == nextPwm) {
+            pwmInterrupt();
+            nextPwm = cycles + PWM_PERIOD_CYCLES;
+        }
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
+        else {
+            extruderInterrupt();
+            extruderCalls++;
+            nextExtruder = cycles + static_cast<uint64_t>(extruderTimerTicks) * 32;
+        }
+#endif
+    }
+    cycles = target;
+    insideInterrupt = false;
+}
+
+void HAL::setupTimer() {
+    nextStepper = Simulator::cycles + 10000 * 4;
+    nextPwm = Simulator::cycles + PWM_PERIOD_CYCLES;
+#if USE_ADVANCE && !ADVANCE_IN_STEPPER
+    nextExtruder = Simulator::cycles + static_cast<uint64_t>(Simulator::extruderTimerTicks) * 32;
+#endif
+}
+
+void HAL::showStartReason() {
+    Com::printInfoFLN(Com::tPowerUp);
+}
+
+int HAL::getFreeRam() {
+    return Simulator::freeRam;
+}
+
+void HAL::resetHardware() {
+    fprintf(stderr, "Firmware requested a reset, simulation stopped.\n");
+    exit(2);
+}
+
+// from http://medialab.freaknet.org/martin/src/sqrt/sqrt.c
+uint32_t HAL::integer64Sqrt(uint64_t a_nInput) {
+    uint64_t op = a_nInput;
+    uint64_t res = 0;
+    uint64_t one = 1uLL << 62;
+
+    while (one > op)
+        one >>= 2;
+    while (one != 0) {
+        if (op >= res + one) {
+            op = op - (res + one);
+            res = res + 2 * one;
+        }
+        res >>= 1;
+        one >>= 2;
+    }
+    if (op > res) {
+        res++;
+    }
+    return res;
+}
+
+// Arduino core functions used outside of the HAL
+
+unsigned long millis() { return HAL::timeInMilliseconds(); }
+unsigned long micros() { return HAL::timeInMicroseconds(); }
+void delay(unsigned long ms) { HAL::delayMilliseconds(ms); }
+void delayMicroseconds(uint32_t us) { HAL::delayMicroseconds(us); }
+void yield() { Simulator::idle(); }
+void pinMode(uint32_t pin, uint32_t mode) { }
+void digitalWrite(uint32_t pin, uint32_t value) { Simulator::writePin(pin, value ? 1 : 0); }
+int digitalRead(uint32_t pin) { return Simulator::readPin(pin); }
+int analogRead(uint32_t pin) { return 0; }
+void analogWrite(uint32_t pin, uint32_t value) { }
@@ -0,0 +1,538 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+  Fake hardware abstraction layer for running the firmware on a Linux host.
+
+  It has the same interface as the Arduino Due HAL, so the shared sources
+  compile unchanged. Time is simulated in CPU cycles of an 84 MHz Due. The
+  stepper, pwm and extruder interrupts are called by the Simulator class
+  whenever the firmware waits for time or input, pin writes are recorded to
+  get the executed steps.
+*/
+
+#ifndef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_RX_BUFFER_SIZE 128
+#endif
+
+#ifndef HAL_H
+#define HAL_H
+
+#include "Arduino.h"
+#include "pins.h"
+#include <inttypes.h>
+
+#undef F_CPU
+#define F_CPU 21000000      // should be factor of F_CPU_TRUE
+#define F_CPU_TRUE 84000000 // simulated cpu clock frequency
+#define EEPROM_BYTES 4096   // bytes of eeprom we simulate
+#define SUPPORT_64_BIT_MATH
+
+#define SPR0 0
+#define SPR1 1
+#define TIMER0_PRESCALE 128
+
+#define PACK __attribute__((packed))
+
+#define INLINE __attribute__((always_inline))
+
+#define PROGMEM
+#ifndef PGM_P
+#define PGM_P const char*
+#endif
+typedef char prog_char;
+#undef PSTR
+#define PSTR(s) s
+#undef pgm_read_byte_near
+#define pgm_read_byte_near(x) (*(int8_t*)(x))
+#undef pgm_read_byte
+#define pgm_read_byte(x) (*(int8_t*)(x))
+#undef pgm_read_float
+#define pgm_read_float(addr) (*(const float*)(addr))
+#undef pgm_read_word
+#define pgm_read_word(addr) (*(addr))
+#undef pgm_read_word_near
+#define pgm_read_word_near(addr) pgm_read_word(addr)
+#undef pgm_read_dword
+#define pgm_read_dword(addr) (*(addr))
+#undef pgm_read_dword_near
+#define pgm_read_dword_near(addr) pgm_read_dword(addr)
+#define _BV(x) (1 << (x))
+
+#define FSTRINGVALUE(var, value) const char var[] PROGMEM = value;
+#define FSTRINGVAR(var) static const char var[] PROGMEM;
+#define FSTRINGPARAM(var) PGM_P var
+
+#define EXTRUDER_CLOCK_FREQ 60000 // extruder stepper interrupt frequency
+#define PWM_CLOCK_FREQ 10000
+#define PWM_COUNTER_100MS 1000
+#define TIMER1_CLOCK_FREQ 244
+#define TIMER1_PRESCALE 2
+
+#define SERVO_CLOCK_FREQ 1000
+#define SERVO_PRESCALE 2
+#define SERVO2500US (((F_CPU_TRUE / SERVO_PRESCALE) / 1000000) * 2500)
+#define SERVO5000US (((F_CPU_TRUE / SERVO_PRESCALE) / 1000000) * 5000)
+
+#define PULLUP(IO, v) \
+    { ::pinMode(IO, (v != LOW ? INPUT_PULLUP : INPUT)); }
+
+#define WATCHDOG_INTERVAL 1024u
+
+/** Motors are numbered like the axes, extruder n is motor E_AXIS + n. */
+#define SIM_MOTORS (3 + NUM_EXTRUDER)
+
+struct SimMotor {
+    int32_t position; ///< Steps from start, positive in positive direction
+    uint64_t steps;   ///< Executed steps in both directions
+    int dirPin;
+    bool invertDir;
+    int8_t lastDir;     ///< Direction of the last step, 0 before the first
+    uint32_t reversals; ///< Steps in the other direction than the step before
+};
+
+/** One step in the timeline file written by the simulator. */
+struct SimTimelineRecord {
+    uint64_t time; ///< CPU cycles since start
+    uint8_t motor;
+    int8_t dir;    ///< 1 or -1
+} __attribute__((packed));
+
+/** Simulated machine. Keeps the clock, calls the interrupt routines when
+they are due and records the step pins. */
+class Simulator {
+public:
+    static uint64_t cycles;          ///< Simulated time in F_CPU_TRUE cycles
+    static volatile bool interruptsBlocked;
+    static bool insideInterrupt;
+    static uint8_t pins[256];        ///< Last written or simulated pin level
+    static uint32_t extruderTimerTicks; ///< Period of the extruder timer in MCK/32 ticks
+    static SimMotor motors[SIM_MOTORS];
+    static FILE* timeline;           ///< Receives a SimTimelineRecord per step if set
+    static uint32_t stepperCalls;
+    static uint32_t extruderCalls;   ///< Calls of the extruder timer interrupt
+    static uint64_t stepperHostNanos; ///< Host time spent in the stepper interrupt
+    static int freeRam;              ///< Returned by HAL::getFreeRam, sizes the dynamic move cache
+    static double printDistance;     ///< XY path of extruding moves in mm, sampled every ms
+    static double printSeconds;      ///< Time of the sampled extruding moves
+    static double queuedLines;       ///< Lines in the move cache summed over the path samples
+    static double queuedSeconds;     ///< Full speed time of the queued lines summed over the path samples
+    static uint8_t minQueuedLines;   ///< Fewest lines in the move cache at a path sample
+    static float maxAcceleration;    ///< Largest path acceleration inside a line in mm/s^2
+    static float maxJerk;            ///< Largest path jerk inside a line in mm/s^3
+    static float resonanceFrequency; ///< Resonance of the X and Y axis in Hz, 0 = not simulated
+    static double restVibration[2];  ///< Largest X and Y oscillation in mm while no line is queued
+    static double cruiseVibration[2]; ///< Largest X and Y oscillation in mm while a line moves at full speed
+    static uint32_t timelineDifferences; ///< Steps not matching the reference timeline
+    static uint64_t maxTimelineDifference; ///< Largest time difference to the reference in CPU cycles
+
+    /** Assigns step and direction pins to motors and places the endstops.
+    Call before the firmware starts. */
+    static void setupMachine();
+
+    /** Loads a timeline file to compare the steps with. The n-th step of each
+    motor is compared with the n-th step of the same motor in the file. */
+    static bool loadReferenceTimeline(const char* filename);
+    /** Counts the steps of the reference the simulation did not make. */
+    static void finishReferenceTimeline();
+    /** Updates maxAcceleration and maxJerk, called every ms. */
+    static void sampleMotion();
+    /** Adds the move cache fill to the queue statistics, called with every
+    sample of an extruding move. */
+    static void sampleQueue();
+    /** Moves the X and Y resonance models by one PWM period and updates
+    the vibration statistics. */
+    static void sampleResonance();
+    /** Lets the simulated time pass and runs all interrupts that became due. */
+    static void advance(uint32_t cpuCycles);
+    /** Called for every busy wait and time query of the firmware. */
+    static inline void idle() { advance(F_CPU_TRUE / 1000000); }
+    static void writePin(int pin, uint8_t value);
+    static uint8_t readPin(int pin);
+    /** Host clock in ns, used to measure how fast firmware code runs on the host. */
+    static uint32_t hostNanos();
+    /** Parses every line of a file with GCode::parseAscii and the parser of
+    version 1.0.x, prints the differences and the time per line of both.
+    Returns the number of differing lines, -1 if the file is missing. */
+    static int compareParser(const char* name);
+#if DRIVE_SYSTEM == DELTA
+    static uint32_t deltaSegments;     ///< Delta segments of the measured lines
+    static double maxDeltaDeviation;   ///< Largest effector distance from a segment chord in mm
+    /** Takes the tower positions of the firmware as carriage heights of the
+    motors if no line is queued or running. Call between commands, the
+    firmware updates the positions before it queues the line. */
+    static void alignDeltaTowers();
+    /** Counts the segments of the line the stepper interrupt starts next and
+    measures how far the effector leaves the straight chord between the
+    segment ends when the towers move linear, at the middle of each segment. */
+    static void measureDeltaLine();
+#endif
+#ifdef SIM_SDCARD
+    static uint32_t sdBlocksRead;    ///< Blocks read from the emulated sd card
+    static uint32_t sdBlocksWritten;
+    static uint64_t sdCycles;        ///< Time spent waiting for the card
+    /** Copies a host file into the current folder of the mounted card. */
+    static bool copyToCard(const char* hostName, const char* cardName);
+#ifdef SIM_DISPLAY
+    /** Fills a folder with files, times selecting each file and scrolling
+    through the file browser and checks its names after files were added,
+    deleted and replaced. Returns the number of wrong names. */
+    static int browseBenchmark(int files);
+#endif
+#endif
+#ifdef SIM_DISPLAY
+    static uint64_t displayClocks;   ///< Software SPI clocks to the display while selected
+    /** Times refreshPage on the info page unchanged and with changing
+    temperature and position and prints the bytes sent to the display. */
+    static void refreshBenchmark(int refreshes);
+    /** Renders every UI text of every language with UIDisplay::parse and
+    with the parser it replaced, from flash and from ram, and times both.
+    Returns the number of texts that differ. */
+    static int compareUiTemplates();
+#endif
+#if EEPROM_RAM_CACHE
+    static uint8_t eepromReference[EEPROM_BYTES]; ///< Eeprom as written without the cache
+    static uint32_t eepromWrites;    ///< Bytes written, each one a burn without the cache
+    static uint32_t eepromWaits;     ///< Eeprom accesses that waited for a running burn
+    static uint64_t eepromWaitCycles;
+    static uint32_t eepromEarlyChecksums; ///< Integrity byte burned while other bytes were pending
+    static void eepromWriteThrough(unsigned int pos, const void* src, uint8_t size);
+    /** Replays random settings changes, each store ending with M500, and
+    burns pending bytes in between. Checks all eeprom reads after every
+    command and the eeprom at the end against eepromReference. Returns the
+    number of wrong bytes. */
+    static int eepromReplay(int stores);
+#endif
+};
+
+#define READ_VAR(pin) Simulator::readPin(pin)
+#define READ(pin) Simulator::readPin(pin)
+#define WRITE_VAR(pin, v) Simulator::writePin(pin, (v) ? 1 : 0)
+#define WRITE(pin, v) Simulator::writePin(pin, (v) ? 1 : 0)
+
+#define SET_INPUT(pin) ::pinMode(pin, INPUT);
+#define SET_OUTPUT(pin) ::pinMode(pin, OUTPUT);
+#define TOGGLE(pin) WRITE(pin, !READ(pin))
+#define TOGGLE_VAR(pin) HAL::digitalWrite(pin, !HAL::digitalRead(pin))
+#undef LOW
+#define LOW 0
+#undef HIGH
+#define HIGH 1
+
+// Same semantic as the Due version: leaving the block always allows
+// interrupts again.
+class InterruptProtectedBlock {
+public:
+    INLINE void protect() { Simulator::interruptsBlocked = true; }
+
+    INLINE void unprotect() { Simulator::interruptsBlocked = false; }
+
+    INLINE InterruptProtectedBlock(bool later = false) {
+        if (!later)
+            Simulator::interruptsBlocked = true;
+    }
+
+    INLINE ~InterruptProtectedBlock() { Simulator::interruptsBlocked = false; }
+};
+
+#define EEPROM_OFFSET 0
+#define SECONDS_TO_TICKS(s) (unsigned long)(s * (float)F_CPU)
+#define ANALOG_INPUT_SAMPLE 6
+#define ANALOG_INPUT_MEDIAN 10
+
+#define ANALOG_INPUT_BITS 12
+#define ANALOG_REDUCE_BITS 0
+#define ANALOG_REDUCE_FACTOR 1
+
+#define MAX_RAM 98303
+
+#define bit_clear(x, y) x &= ~(1 << y)
+#define bit_set(x, y) x |= (1 << y)
+
+#define I2C_READ 1
+#define I2C_WRITE 0
+
+#define LIMIT_INTERVAL (F_CPU / 500000)
+
+typedef unsigned int speed_t;
+typedef unsigned long ticks_t;
+typedef unsigned long millis_t;
+typedef unsigned int flag8_t;
+typedef int fast8_t;
+typedef unsigned int ufast8_t;
+
+#ifndef RFSERIAL
+#define RFSERIAL Serial
+#endif
+
+union eeval_t {
+    uint8_t b[4];
+    float f;
+    uint32_t i;
+    uint16_t s;
+    long l;
+} PACK;
+
+#if EEPROM_RAM_CACHE
+// avr-libc eeprom functions of the simulated AVR eeprom, see SimulatorEeprom.cpp
+#define E2END (EEPROM_BYTES - 1)
+uint8_t eeprom_read_byte(const uint8_t* pos);
+void eeprom_write_byte(uint8_t* pos, uint8_t value);
+void eeprom_read_block(void* dst, const void* pos, size_t size);
+bool eeprom_is_ready();
+void eeprom_busy_wait();
+#endif
+
+class HAL {
+public:
+    static char virtualEeprom[EEPROM_BYTES];
+    static bool wdPinged;
+
+    HAL();
+    virtual ~HAL();
+
+    static int initHardwarePWM(int pinNumber, uint32_t frequency) { return -1; }
+    static void setHardwarePWM(int id, int value) { }
+    static void setHardwareFrequency(int id, uint32_t frequency) { }
+
+    static inline void hwSetup(void) {
+        memset(virtualEeprom, 0, sizeof(virtualEeprom));
+#if EEPROM_RAM_CACHE
+        eprInitCache();
+#endif
+    }
+
+    static uint32_t integer64Sqrt(uint64_t a);
+    static inline unsigned long U16SquaredToU32(unsigned int val) {
+        return (unsigned long)val * (unsigned long)val;
+    }
+    static inline unsigned int ComputeV(long timer, long accel) {
+        return static_cast<unsigned int>(
+            (static_cast<int64_t>(timer) * static_cast<int64_t>(accel)) >> 18);
+    }
+    static inline unsigned long mulu16xu16to32(unsigned int a, unsigned int b) {
+        return (unsigned long)a * (unsigned long)b;
+    }
+    static inline unsigned int mulu6xu16shift16(unsigned int a, unsigned int b) {
+        return ((unsigned long)a * (unsigned long)b) >> 16;
+    }
+    static inline unsigned int Div4U2U(unsigned long a, unsigned int b) {
+        return ((unsigned long)a / (unsigned long)b);
+    }
+    static inline void digitalWrite(uint8_t pin, uint8_t value) {
+        WRITE_VAR(pin, value);
+    }
+    static inline uint8_t digitalRead(uint8_t pin) { return READ_VAR(pin); }
+    static inline void pinMode(uint8_t pin, uint8_t mode) { }
+    static long CPUDivU2(speed_t divisor) { return F_CPU / divisor; }
+    static inline void delayMicroseconds(uint32_t usec) {
+        Simulator::advance(usec * (F_CPU_TRUE / 1000000));
+    }
+    static inline void delayMilliseconds(unsigned int delayMs) {
+        while (delayMs > 0) {
+            delayMicroseconds(1000);
+            delayMs--;
+        }
+    }
+
+    static inline void tone(uint8_t pin, int frequency) { }
+    static inline void noTone(uint8_t pin) { }
+
+#if EEPROM_RAM_CACHE
+    // EepromCache.h of the AVR version on the eeprom of SimulatorEeprom.cpp,
+    // every write also goes to Simulator::eepromReference
+    static uint16_t eprWear[(E2END + 256) >> 8];
+    static uint32_t eprWritesSaved;
+    static void eprInitCache();
+    static void eprRead(unsigned int pos, void* dst, uint8_t size);
+    static void eprWrite(unsigned int pos, const void* src, uint8_t size);
+    static void eprBurnStep();
+    static void eprFlush();
+    static uint16_t eprPending();
+    static void eprReport();
+    static inline void eprSetByte(unsigned int pos, uint8_t value) {
+        Simulator::eepromWriteThrough(pos, &value, 1);
+        eprWrite(pos, &value, 1);
+    }
+    static inline void eprSetInt16(unsigned int pos, int16_t value) {
+        Simulator::eepromWriteThrough(pos, &value, 2);
+        eprWrite(pos, &value, 2);
+    }
+    static inline void eprSetInt32(unsigned int pos, int32_t value) {
+        Simulator::eepromWriteThrough(pos, &value, 4);
+        eprWrite(pos, &value, 4);
+    }
+    static inline void eprSetLong(unsigned int pos, long value) {
+        Simulator::eepromWriteThrough(pos, &value, 4);
+        eprWrite(pos, &value, 4);
+    }
+    static inline void eprSetFloat(unsigned int pos, float value) {
+        Simulator::eepromWriteThrough(pos, &value, 4);
+        eprWrite(pos, &value, 4);
+    }
+    static inline uint8_t eprGetByte(unsigned int pos) {
+        uint8_t v;
+        eprRead(pos, &v, 1);
+        return v;
+    }
+    static inline int16_t eprGetInt16(unsigned int pos) {
+        int16_t v;
+        eprRead(pos, &v, 2);
+        return v;
+    }
+    static inline int32_t eprGetInt32(unsigned int pos) {
+        int32_t v = 0;
+        eprRead(pos, &v, 4);
+        return v;
+    }
+    static inline long eprGetLong(unsigned int pos) {
+        int32_t v = 0;
+        eprRead(pos, &v, 4);
+        return v;
+    }
+    static inline float eprGetFloat(unsigned int pos) {
+        float v;
+        eprRead(pos, &v, 4);
+        return v;
+    }
+#else
+    static inline void eprSetByte(unsigned int pos, uint8_t value) {
+        *(uint8_t*)&virtualEeprom[pos] = value;
+    }
+    static inline void eprSetInt16(unsigned int pos, int16_t value) {
+        memcopy2(&virtualEeprom[pos], &value);
+    }
+    static inline void eprSetInt32(unsigned int pos, int32_t value) {
+        memcopy4(&virtualEeprom[pos], &value);
+    }
+    static inline void eprSetLong(unsigned int pos, long value) {
+        memcopy4(&virtualEeprom[pos], &value);
+    }
+    static inline void eprSetFloat(unsigned int pos, float value) {
+        memcopy4(&virtualEeprom[pos], &value);
+    }
+    static inline uint8_t eprGetByte(unsigned int pos) {
+        return *(uint8_t*)&virtualEeprom[pos];
+    }
+    static inline int16_t eprGetInt16(unsigned int pos) {
+        int16_t v;
+        memcopy2(&v, &virtualEeprom[pos]);
+        return v;
+    }
+    static inline int32_t eprGetInt32(unsigned int pos) {
+        int32_t v = 0;
+        memcopy4(&v, &virtualEeprom[pos]);
+        return v;
+    }
+    static inline long eprGetLong(unsigned int pos) {
+        int32_t v = 0;
+        memcopy4(&v, &virtualEeprom[pos]);
+        return v;
+    }
+    static inline float eprGetFloat(unsigned int pos) {
+        float v;
+        memcopy4(&v, &virtualEeprom[pos]);
+        return v;
+    }
+#endif
+
+    static inline void allowInterrupts() { }
+    static inline void forbidInterrupts() { }
+    static inline unsigned long timeInMilliseconds() {
+        Simulator::idle();
+        return (unsigned long)(Simulator::cycles / (F_CPU_TRUE / 1000));
+    }
+    static inline unsigned long timeInMicroseconds() {
+        Simulator::idle();
+        return (unsigned long)(Simulator::cycles / (F_CPU_TRUE / 1000000));
+    }
+#ifdef DEBUG_ISR_PROFILE
+    static inline uint32_t cycleCounter() { return (uint32_t)Simulator::cycles; }
+    static inline uint32_t cyclesSince(uint32_t start) { return (uint32_t)Simulator::cycles - start; }
+#endif
+    static inline char readFlashByte(PGM_P ptr) { return pgm_read_byte(ptr); }
+    static inline int16_t readFlashWord(const uint16_t* ptr) { return pgm_read_word(ptr); }
+
+    static inline void serialSetBaudrate(long baud) { RFSERIAL.begin(baud); }
+    static inline bool serialByteAvailable() { return RFSERIAL.available(); }
+    static inline uint8_t serialReadByte() { return RFSERIAL.read(); }
+    static inline void serialWriteByte(char b) { RFSERIAL.write(b); }
+    static inline void serialFlush() { RFSERIAL.flush(); }
+    static void setupTimer();
+    static void showStartReason();
+    static int getFreeRam();
+    static void resetHardware();
+
+    static inline void spiBegin(uint8_t ssPin = 0) { }
+    static inline void spiInit(uint8_t spiClock) { }
+    static inline void spiSend(uint8_t b) { }
+    static inline void spiSend(const uint8_t* buf, size_t n) { }
+    static inline uint8_t spiReceive(uint8_t send = 0xff) { return 0xff; }
+    static inline void spiReadBlock(uint8_t* buf, uint16_t nbyte) {
+        memset(buf, 0xff, nbyte);
+    }
+    static inline void spiSendBlock(uint8_t token, const uint8_t* buf) { }
+
+    static inline void i2cSetClockspeed(uint32_t clockSpeedHz) { }
+    static inline void i2cInit(unsigned long clockSpeedHz) { }
+    static inline void i2cStartWait(unsigned char address) { }
+    static inline uint8_t i2cStart(unsigned char address) { return 1; }
+    static inline void i2cStartAddr(unsigned char address, unsigned int pos) { }
+    static inline void i2cStop(void) { }
+    static inline void i2cWrite(uint8_t data) { }
+    static inline uint8_t i2cReadAck(void) { return 0; }
+    static inline uint8_t i2cReadNak(void) { return 0; }
+
+    inline static void startWatchdog() { }
+    inline static void stopWatchdog() { }
+    inline static void pingWatchdog() { }
+
+    inline static float maxExtruderTimerFrequency() {
+        return (float)F_CPU_TRUE / 32;
+    }
+
+    static inline void analogStart(void) { }
+#if USE_ADVANCE
+    static void resetExtruderDirection();
+#endif
+    static volatile uint8_t insideTimer1;
+};
+
+/** Planner timing of the step timeline uses the host clock, so it measures
+how fast the planner runs on the host instead of the simulated time. A planner
+call takes less than a microsecond on the host, so the simulation counts
+nanoseconds in StepTimeline::planningMicros and maxPlanningMicros. */
+#define STEP_TIMELINE_MICROS() Simulator::hostNanos()
+
+#ifdef SIM_SDCARD
+/* SdFat lays its structures over the blocks of the card and needs the 32 bit
+long of the Due for that. Only SdFat gets 32 bit types, see also
+SimulatorSdFat.cpp. */
+#include "Communication.h"
+// The iostreams of SdFat cast pointers to uint32_t, skip them
+#define ArduinoStream_h
+#define sdios_h
+typedef int sdfat_int32_t;
+typedef unsigned int sdfat_uint32_t;
+#define int32_t sdfat_int32_t
+#define uint32_t sdfat_uint32_t
+#include "src/SdFat/SdFat.h"
+#undef int32_t
+#undef uint32_t
+#endif
+
+#endif // HAL_H
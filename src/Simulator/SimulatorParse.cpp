@@ -0,0 +1,384 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Differential test of GCode::parseAscii. The switch and strtod based parser
+of version 1.0.x is kept here as reference, -a runs both over every line of
+a file and compares the parameters they found.
+
+The lines are passed like the serial, sd card and flash readers pass them:
+everything from ';' on is removed before parseAscii sees the line. The raw
+lines with comment are compared as well, there the old parser also read the
+letters inside the comment, parseAscii stops at ';'.
+
+strtod also read hexadecimal numbers, inf and nan. parseAscii reads X0 for
+Xinf and continues with the letters, so these lines are not in
+tests/parser.
+*/
+
+#include "Repetier.h"
+#include <time.h>
+
+/** Parameters found by the reference parser. The bits of params and params2
+are those of GCode. */
+struct ReferenceCommand {
+    uint16_t params;
+    uint16_t params2;
+    uint16_t N, M, G;
+    uint8_t T;
+    int32_t S, P;
+    float X, Y, Z, E, F, I, J, R, D, C, H, A, B, K, L, O;
+    char* text;
+};
+
+static float referenceFloat(char* s) {
+    char* endPtr;
+    while (*s == 32)
+        s++; // skip spaces
+    float f = (strtod(s, &endPtr));
+    if (s == endPtr)
+        f = 0.0; // treat empty string "x " as "x0"
+    return f;
+}
+
+static long referenceLong(char* s) {
+    char* endPtr;
+    while (*s == 32)
+        s++; // skip spaces
+    long l = (strtol(s, &endPtr, 10));
+    if (s == endPtr)
+        l = 0; // treat empty string argument "p " as "p0"
+    return l;
+}
+
+/** GCode::parseAscii of version 1.0.x without the protocol checks. Returns
+false for a wrong checksum. */
+static bool referenceParse(ReferenceCommand& g, char* line) {
+    char* pos = line;
+    g.params = 0;
+    g.params2 = 0;
+    char c;
+    while ((c = *(pos++))) {
+        if (c == '(' || c == '%')
+            break; // alternative comment or program block
+        switch (c) {
+        case 'N':
+        case 'n':
+            g.N = referenceLong(pos);
+            g.params |= 1;
+            break;
+        case 'G':
+        case 'g':
+            g.G = referenceLong(pos) & 0xffff;
+            g.params |= 4;
+            if (g.G > 255)
+                g.params |= 4096;
+            break;
+        case 'M':
+        case 'm':
+            g.M = referenceLong(pos) & 0xffff;
+            g.params |= 2;
+            if (g.M > 255)
+                g.params |= 4096;
+            // M34 came with the binary sidecar, it is in the text list of the new parser
+            if (g.M == 20 || g.M == 23 || g.M == 28 || g.M == 29 || g.M == 30 || g.M == 32 || g.M == 34 || g.M == 36 || g.M == 117 || g.M == 118 || g.M == 531) {
+                char digit;
+                while ((digit = *pos)) {
+                    if (digit < '0' || digit > '9')
+                        break;
+                    pos++;
+                }
+                while ((digit = *pos)) {
+                    if (digit != ' ')
+                        break;
+                    pos++;
+                }
+                g.text = pos;
+                while (*pos) {
+                    if ((g.M != 117 && g.M != 20 && g.M != 531 && *pos == ' ') || *pos == '*')
+                        break;
+                    pos++;
+                }
+                *pos = 0;
+                g.params |= 32768;
+            }
+            break;
+        case 'X':
+        case 'x':
+            g.X = referenceFloat(pos);
+            g.params |= 8;
+            break;
+        case 'Y':
+        case 'y':
+            g.Y = referenceFloat(pos);
+            g.params |= 16;
+            break;
+        case 'Z':
+        case 'z':
+            g.Z = referenceFloat(pos);
+            g.params |= 32;
+            break;
+        case 'E':
+        case 'e':
+            g.E = referenceFloat(pos);
+            g.params |= 64;
+            break;
+        case 'F':
+        case 'f':
+            g.F = referenceFloat(pos);
+            g.params |= 256;
+            break;
+        case 'T':
+        case 't':
+            g.T = referenceLong(pos) & 0xff;
+            g.params |= 512;
+            break;
+        case 'S':
+        case 's':
+            g.S = referenceLong(pos);
+            g.params |= 1024;
+            break;
+        case 'P':
+        case 'p':
+            g.P = referenceLong(pos);
+            g.params |= 2048;
+            break;
+#define REFERENCE_V2(upper, lower, value, bit) \
+    case upper: \
+    case lower: \
+        g.value = referenceFloat(pos); \
+        g.params2 |= bit; \
+        g.params |= 4096; \
+        break;
+            REFERENCE_V2('I', 'i', I, 1)
+            REFERENCE_V2('J', 'j', J, 2)
+            REFERENCE_V2('R', 'r', R, 4)
+            REFERENCE_V2('D', 'd', D, 8)
+            REFERENCE_V2('C', 'c', C, 16)
+            REFERENCE_V2('H', 'h', H, 32)
+            REFERENCE_V2('A', 'a', A, 64)
+            REFERENCE_V2('B', 'b', B, 128)
+            REFERENCE_V2('K', 'k', K, 256)
+            REFERENCE_V2('L', 'l', L, 512)
+            REFERENCE_V2('O', 'o', O, 1024)
+#undef REFERENCE_V2
+        case '*': {
+            uint8_t checksumGiven = referenceLong(pos);
+            uint8_t checksum = 0;
+            while (line != (pos - 1))
+                checksum ^= *line++;
+            if (checksum != checksumGiven)
+                return false;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+/** Distance of two floats in units in the last place. */
+static uint32_t ulpDistance(float a, float b) {
+    int32_t ia, ib;
+    memcpy(&ia, &a, 4);
+    memcpy(&ib, &b, 4);
+    if (ia < 0)
+        ia = static_cast<int32_t>(0x80000000UL) - ia;
+    if (ib < 0)
+        ib = static_cast<int32_t>(0x80000000UL) - ib;
+    return ia > ib ? ia - ib : ib - ia;
+}
+
+struct ParseDifference {
+    int fields;  ///< Parameters missing, extra or with other value
+    int ulps;    ///< Float parameters one unit in the last place apart
+    char what[160];
+};
+
+static void compareFloat(ParseDifference& d, const char* name, bool has, float got, float expected) {
+    if (!has)
+        return;
+    uint32_t u = ulpDistance(got, expected);
+    if (u == 0)
+        return;
+    if (u == 1) {
+        d.ulps++;
+        return;
+    }
+    d.fields++;
+    size_t n = strlen(d.what);
+    snprintf(d.what + n, sizeof(d.what) - n, " %s:%.9g/%.9g", name, got, expected);
+}
+
+static void compareInt(ParseDifference& d, const char* name, bool has, long got, long expected) {
+    if (!has || got == expected)
+        return;
+    d.fields++;
+    size_t n = strlen(d.what);
+    snprintf(d.what + n, sizeof(d.what) - n, " %s:%ld/%ld", name, got, expected);
+}
+
+/** Parameter bits of code in the layout of GCode::params and params2. */
+static uint32_t parsedParams(GCode& code) {
+    uint32_t p = 0;
+    bool has[] = { code.hasN(), code.hasM(), code.hasG(), code.hasX(), code.hasY(), code.hasZ(), code.hasE(), false,
+                   code.hasF(), code.hasT(), code.hasS(), code.hasP(), code.isV2(), false, false, code.hasString(),
+                   code.hasI(), code.hasJ(), code.hasR(), code.hasD(), code.hasC(), code.hasH(), code.hasA(), code.hasB(),
+                   code.hasK(), code.hasL(), code.hasO() };
+    for (uint8_t i = 0; i < sizeof(has); i++)
+        if (has[i])
+            p |= 1UL << i;
+    return p;
+}
+
+static ParseDifference compareParse(const char* line) {
+    char a[MAX_CMD_SIZE * 2 + 2], b[MAX_CMD_SIZE * 2 + 2];
+    strncpy(a, line, sizeof(a) - 1);
+    a[sizeof(a) - 1] = 0;
+    strcpy(b, a);
+    GCode code;
+    ReferenceCommand ref;
+    ParseDifference d;
+    d.fields = d.ulps = 0;
+    d.what[0] = 0;
+    bool ok = code.parseAscii(a, false);
+    bool refOk = referenceParse(ref, b);
+    if (ok != refOk) {
+        d.fields++;
+        snprintf(d.what, sizeof(d.what), " accepted:%d/%d", ok, refOk);
+        return d;
+    }
+    if (!ok)
+        return d;
+    uint32_t refParams = ref.params | (static_cast<uint32_t>(ref.params2) << 16);
+    uint32_t params = parsedParams(code);
+    if (params != refParams) {
+        d.fields++;
+        snprintf(d.what, sizeof(d.what), " params:%x/%x", (unsigned)params, (unsigned)refParams);
+        return d;
+    }
+    compareInt(d, "N", code.hasN(), code.N, ref.N);
+    compareInt(d, "M", code.hasM(), code.M, ref.M);
+    compareInt(d, "G", code.hasG(), code.G, ref.G);
+    compareInt(d, "T", code.hasT(), code.T, ref.T);
+    compareInt(d, "S", code.hasS(), code.S, ref.S);
+    compareInt(d, "P", code.hasP(), code.P, ref.P);
+    compareFloat(d, "X", code.hasX(), code.X, ref.X);
+    compareFloat(d, "Y", code.hasY(), code.Y, ref.Y);
+    compareFloat(d, "Z", code.hasZ(), code.Z, ref.Z);
+    compareFloat(d, "E", code.hasE(), code.E, ref.E);
+    compareFloat(d, "F", code.hasF(), code.F, ref.F);
+    compareFloat(d, "I", code.hasI(), code.I, ref.I);
+    compareFloat(d, "J", code.hasJ(), code.J, ref.J);
+    compareFloat(d, "R", code.hasR(), code.R, ref.R);
+    compareFloat(d, "D", code.hasD(), code.D, ref.D);
+    compareFloat(d, "C", code.hasC(), code.C, ref.C);
+    compareFloat(d, "H", code.hasH(), code.H, ref.H);
+    compareFloat(d, "A", code.hasA(), code.A, ref.A);
+    compareFloat(d, "B", code.hasB(), code.B, ref.B);
+    compareFloat(d, "K", code.hasK(), code.K, ref.K);
+    compareFloat(d, "L", code.hasL(), code.L, ref.L);
+    compareFloat(d, "O", code.hasO(), code.O, ref.O);
+    if (code.hasString() && strcmp(code.text, ref.text) != 0) {
+        d.fields++;
+        size_t n = strlen(d.what);
+        snprintf(d.what + n, sizeof(d.what) - n, " text:\"%s\"/\"%s\"", code.text, ref.text);
+    }
+    return d;
+}
+
+static double parseSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int Simulator::compareParser(const char* name) {
+    static const int passes = 20;
+    FILE* f = fopen(name, "r");
+    if (f == NULL) {
+        perror(name);
+        return -1;
+    }
+    char raw[512];
+    // All lines zero terminated one after the other, offsets in starts
+    char* block = NULL;
+    uint32_t blockSize = 0, blockCapacity = 0;
+    uint32_t* starts = NULL;
+    int numLines = 0, capacity = 0;
+    int differentLines = 0, ulpLines = 0, commentLines = 0, differentComments = 0;
+    while (fgets(raw, sizeof(raw), f) != NULL) {
+        raw[strcspn(raw, "\r\n")] = 0;
+        char* comment = strchr(raw, ';');
+        if (comment != NULL) {
+            commentLines++;
+            if (compareParse(raw).fields > 0)
+                differentComments++;
+            *comment = 0; // like the readers
+        }
+        if (raw[0] == 0)
+            continue;
+        ParseDifference d = compareParse(raw);
+        if (d.fields > 0) {
+            if (differentLines < 20)
+                printf("%s: %s: parseAscii/reference%s\n", name, raw, d.what);
+            differentLines++;
+        } else if (d.ulps > 0)
+            ulpLines++;
+        uint32_t length = strlen(raw) + 1;
+        if (numLines == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            starts = static_cast<uint32_t*>(realloc(starts, sizeof(uint32_t) * capacity));
+        }
+        if (blockSize + length > blockCapacity) {
+            blockCapacity = blockCapacity ? blockCapacity * 2 : 65536;
+            block = static_cast<char*>(realloc(block, blockCapacity));
+        }
+        starts[numLines++] = blockSize;
+        memcpy(block + blockSize, raw, length);
+        blockSize += length;
+    }
+    fclose(f);
+    // Both parsers write into the line, so each pass parses a fresh copy
+    char* work = static_cast<char*>(malloc(blockSize + 1));
+    GCode code;
+    ReferenceCommand ref;
+    double parseTime = 0, referenceTime = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        memcpy(work, block, blockSize);
+        double start = parseSeconds();
+        for (int i = 0; i < numLines; i++)
+            code.parseAscii(work + starts[i], false);
+        parseTime += parseSeconds() - start;
+        memcpy(work, block, blockSize);
+        start = parseSeconds();
+        for (int i = 0; i < numLines; i++)
+            referenceParse(ref, work + starts[i]);
+        referenceTime += parseSeconds() - start;
+    }
+    printf("%s: %d lines, %d differ, %d with floats 1 ulp apart\n", name, numLines, differentLines, ulpLines);
+    printf("%s: %d lines with comment, %d parse differently when the comment is not removed\n", name, commentLines,
+           differentComments);
+    if (numLines > 0)
+        printf("%s: parseAscii %.1f ns per line, reference %.1f ns per line\n", name,
+               parseTime * 1e9 / passes / numLines, referenceTime * 1e9 / passes / numLines);
+    free(work);
+    free(block);
+    free(starts);
+    return differentLines;
+}
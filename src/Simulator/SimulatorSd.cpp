@@ -0,0 +1,196 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+Sd card of the sdcard variant. Replaces SdSpiCard.cpp of SdFat with a card
+that keeps its blocks in host memory, so the unchanged FatLib and SDCard.cpp
+run on top of it. The card gets a FAT32 file system on the first begin.
+
+Instead of the bytes on the SPI bus the block transfers cost simulated time:
+every byte takes 8 clocks of the SPI speed the firmware selected, a block
+read waits SIM_SD_READ_LATENCY_US for the data token and a block write
+SIM_SD_WRITE_BUSY_US for the programming. Interrupts keep running during
+that time like on the Due, where the SPI transfer is a busy wait.
+*/
+
+#include "Repetier.h"
+
+#ifdef SIM_SDCARD
+#include <map>
+
+#define SIM_SD_BLOCKS (4UL << 21)         // 4 GB card
+#define SIM_SD_BLOCKS_PER_CLUSTER 64      // 32 KB clusters like a card formatted by the SD formatter
+#define SIM_SD_RESERVED_BLOCKS 32
+#define SIM_SD_READ_LATENCY_US 100
+#define SIM_SD_WRITE_BUSY_US 500
+#define SIM_SD_COMMAND_BYTES 8            // command, crc and response
+
+uint32_t Simulator::sdBlocksRead = 0;
+uint32_t Simulator::sdBlocksWritten = 0;
+uint64_t Simulator::sdCycles = 0;
+
+struct SimSdBlock {
+    uint8_t data[512];
+};
+/** Blocks written so far, all other blocks read as zero. */
+static std::map<uint32_t, SimSdBlock> sdBlocks;
+static bool sdFormatted = false;
+static uint32_t sdClock = 4000000;
+
+static void sdTransfer(uint32_t bytes, uint32_t waitMicros) {
+    uint64_t c = static_cast<uint64_t>(bytes) * 8 * F_CPU_TRUE / sdClock + static_cast<uint64_t>(waitMicros) * (F_CPU_TRUE / 1000000);
+    Simulator::sdCycles += c;
+    Simulator::advance(c);
+}
+
+static uint8_t* sdBlock(uint32_t lba) {
+    return sdBlocks[lba].data;
+}
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+/** Writes an empty FAT32 file system without partition table. */
+static void sdFormat() {
+    uint32_t clusters = (SIM_SD_BLOCKS - SIM_SD_RESERVED_BLOCKS) / SIM_SD_BLOCKS_PER_CLUSTER;
+    uint32_t fatBlocks = (clusters + 2 + 127) / 128;
+    uint8_t* b = sdBlock(0);
+    b[0] = 0xEB;
+    b[1] = 0x58;
+    b[2] = 0x90;
+    memcpy(b + 3, "REPSIM  ", 8);
+    put16(b + 11, 512);
+    b[13] = SIM_SD_BLOCKS_PER_CLUSTER;
+    put16(b + 14, SIM_SD_RESERVED_BLOCKS);
+    b[16] = 2;     // FAT count
+    b[21] = 0xF8;  // fixed disk
+    put16(b + 24, 63);
+    put16(b + 26, 255);
+    put32(b + 32, SIM_SD_BLOCKS);
+    put32(b + 36, fatBlocks);
+    put32(b + 44, 2); // root folder cluster
+    put16(b + 48, 1); // FSInfo block
+    put16(b + 50, 6); // backup boot block
+    b[64] = 0x80;
+    b[66] = 0x29;
+    put32(b + 67, 0x12345678);
+    memcpy(b + 71, "NO NAME    FAT32   ", 19);
+    b[510] = 0x55;
+    b[511] = 0xAA;
+    memcpy(sdBlock(6), b, 512);
+    b = sdBlock(1);
+    put32(b, 0x41615252);
+    put32(b + 484, 0x61417272);
+    put32(b + 488, 0xFFFFFFFF); // free count unknown
+    put32(b + 492, 0xFFFFFFFF);
+    put32(b + 508, 0xAA550000);
+    for (uint8_t fat = 0; fat < 2; fat++) {
+        b = sdBlock(SIM_SD_RESERVED_BLOCKS + fat * fatBlocks);
+        put32(b, 0x0FFFFFF8);
+        put32(b + 4, 0x0FFFFFFF);
+        put32(b + 8, 0x0FFFFFFF); // root folder has one cluster
+    }
+    sdFormatted = true;
+}
+
+bool SdSpiCard::begin(SdSpiDriver* spi, uint8_t csPin, SPISettings settings) {
+    m_spiDriver = spi;
+    m_spiActive = false;
+    m_errorCode = SD_CARD_ERROR_NONE;
+    m_status = 0;
+    type(SD_CARD_TYPE_SDHC);
+    sdClock = settings.clock;
+    if (!sdFormatted)
+        sdFormat();
+    return true;
+}
+
+sdfat_uint32_t SdSpiCard::cardSize() {
+    return SIM_SD_BLOCKS;
+}
+
+bool SdSpiCard::erase(sdfat_uint32_t firstBlock, sdfat_uint32_t lastBlock) {
+    for (uint32_t lba = firstBlock; lba <= lastBlock; lba++)
+        sdBlocks.erase(lba);
+    return true;
+}
+
+bool SdSpiCard::isBusy() {
+    return false;
+}
+
+bool SdSpiCard::readBlock(sdfat_uint32_t lba, uint8_t* dst) {
+    return readBlocks(lba, dst, 1);
+}
+
+bool SdSpiCard::readBlocks(sdfat_uint32_t lba, uint8_t* dst, size_t nb) {
+    if (lba + nb > SIM_SD_BLOCKS) {
+        error(SD_CARD_ERROR_CMD18);
+        return false;
+    }
+    sdTransfer(SIM_SD_COMMAND_BYTES, 0);
+    for (size_t i = 0; i < nb; i++, dst += 512) {
+        std::map<uint32_t, SimSdBlock>::const_iterator it = sdBlocks.find(lba + i);
+        if (it == sdBlocks.end())
+            memset(dst, 0, 512);
+        else
+            memcpy(dst, it->second.data, 512);
+        sdTransfer(515, SIM_SD_READ_LATENCY_US); // token, data and crc
+    }
+    Simulator::sdBlocksRead += nb;
+    return true;
+}
+
+bool SdSpiCard::writeBlock(sdfat_uint32_t lba, const uint8_t* src) {
+    return writeBlocks(lba, src, 1);
+}
+
+bool SdSpiCard::writeBlocks(sdfat_uint32_t lba, const uint8_t* src, size_t nb) {
+    if (lba + nb > SIM_SD_BLOCKS) {
+        error(SD_CARD_ERROR_CMD25);
+        return false;
+    }
+    sdTransfer(SIM_SD_COMMAND_BYTES, 0);
+    for (size_t i = 0; i < nb; i++, src += 512) {
+        memcpy(sdBlock(lba + i), src, 512);
+        sdTransfer(516, SIM_SD_WRITE_BUSY_US); // token, data, crc and response
+    }
+    Simulator::sdBlocksWritten += nb;
+    return true;
+}
+
+bool Simulator::copyToCard(const char* hostName, const char* cardName) {
+    FILE* in = fopen(hostName, "rb");
+    if (in == NULL)
+        return false;
+    SdFile out;
+    bool ok = out.open(sd.fat.vwd(), cardName, O_CREAT | O_WRITE | O_TRUNC);
+    uint8_t buf[4096];
+    size_t n;
+    while (ok && (n = fread(buf, 1, sizeof(buf), in)) > 0)
+        ok = out.write(buf, n) == n;
+    fclose(in);
+    return out.close() && ok;
+}
+#endif
@@ -0,0 +1,40 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+FatLib of SdFat for the sdcard variant. Compiled with the same 32 bit types
+SimulatorHAL.h gives the SdFat headers, so the structures match the blocks on
+the card. SdSpiCard.cpp is replaced by the emulated card in SimulatorSd.cpp.
+*/
+
+#include "Repetier.h"
+
+#ifdef SIM_SDCARD
+// Warnings of the unchanged library code
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+#pragma GCC diagnostic ignored "-Waddress-of-packed-member"
+#define int32_t sdfat_int32_t
+#define uint32_t sdfat_uint32_t
+#include "src/SdFat/FatLib/FatFile.cpp"
+#include "src/SdFat/FatLib/FatFileLFN.cpp"
+#include "src/SdFat/FatLib/FatFilePrint.cpp"
+#include "src/SdFat/FatLib/FatFileSFN.cpp"
+#include "src/SdFat/FatLib/FatVolume.cpp"
+#include "src/SdFat/FatLib/FmtNumber.cpp"
+#undef int32_t
+#undef uint32_t
+#endif
@@ -0,0 +1,96 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/* The part of the Arduino core the firmware uses outside of the HAL.
+Implemented in SimulatorHAL.cpp. */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <ctype.h>
+#include "Print.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Only named in the Arduino interface of SdFat, which the firmware does not use.
+class __FlashStringHelper;
+class String {
+public:
+    String(const char* s = "") : s(s) { }
+    const char* c_str() const { return s; }
+private:
+    const char* s;
+};
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define memcpy_P memcpy
+#define strstr_P strstr
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define isDigit isdigit
+#define F(x) x
+#define SERIAL_BUFFER_SIZE 128
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+void pinMode(uint32_t pin, uint32_t mode);
+void digitalWrite(uint32_t pin, uint32_t value);
+int digitalRead(uint32_t pin);
+int analogRead(uint32_t pin);
+void analogWrite(uint32_t pin, uint32_t value);
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+};
+
+/** Serial port connected to the emulated host, see Simulator.cpp. */
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud);
+    void end();
+    int available();
+    int read();
+    int peek();
+    void flush();
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+    static uint32_t writeCalls; ///< Calls of both write functions, each is a transfer on the board
+};
+
+extern HardwareSerial Serial;
+
+#endif
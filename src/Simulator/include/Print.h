@@ -0,0 +1,27 @@
+/* Minimal Arduino Print class for the host simulation. */
+#ifndef Print_h
+#define Print_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print {
+public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+    size_t print(const char* str) { return write(str); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t println() { return write((uint8_t)'\n'); }
+    size_t println(const char* str) { return print(str) + println(); }
+    virtual void flush() { }
+};
+
+#endif
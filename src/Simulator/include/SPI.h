@@ -0,0 +1,30 @@
+/* The SPI bus is not simulated. The sd card of the sdcard variant is emulated
+one level higher by SdSpiCard in SimulatorSd.cpp, this only has what the
+SdFat headers need. */
+#ifndef _SPI_H_INCLUDED
+#define _SPI_H_INCLUDED
+
+#include "Arduino.h"
+
+#ifndef SS
+#define SS 10
+#endif
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clock(clock) { }
+    uint32_t clock;
+};
+
+class SPIClass {
+public:
+    void begin() { }
+    void beginTransaction(SPISettings settings) { }
+    void endTransaction() { }
+    uint8_t transfer(uint8_t data) { return 0xff; }
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1 @@
+/* No I2C devices are simulated, HAL::i2c* are empty. */
@@ -0,0 +1,2 @@
+/* Keeps the C library headers from defining their own integer types, see stdint.h. */
+#include <stdint.h>
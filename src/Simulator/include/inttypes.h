@@ -0,0 +1,2 @@
+/* Only the integer types are needed, see stdint.h. */
+#include <stdint.h>
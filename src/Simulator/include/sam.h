@@ -0,0 +1,80 @@
+/*
+    This file is part of Repetier-Firmware.
+
+    Repetier-Firmware is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Repetier-Firmware is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Repetier-Firmware.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/* The SAM3X8E registers and the Arduino Due pin table u8glib_ex.h uses for
+its Due interfaces. Only needed to compile it in the display variants, the
+simulated display gets its bytes through digitalWrite, see SimulatorHAL.cpp. */
+#ifndef _SAM_
+#define _SAM_
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t PIO_PER, PIO_PDR, PIO_OER, PIO_ODR, PIO_SODR, PIO_CODR, PIO_ODSR, PIO_PDSR;
+    volatile uint32_t PIO_MDER, PIO_MDDR, PIO_PUER, PIO_PUDR;
+} Pio;
+
+typedef struct {
+    volatile uint32_t SPI_CR, SPI_MR, SPI_RDR, SPI_TDR, SPI_SR;
+    volatile uint32_t SPI_CSR[4];
+} Spi;
+
+typedef struct {
+    Pio* pPort;
+    uint32_t ulPin;
+} PinDescription;
+
+typedef enum { PIO_OUTPUT_0,
+               PIO_OUTPUT_1,
+               PIO_INPUT } EPioType;
+
+#define PIO_DEFAULT 0
+#define PIO_OPENDRAIN 4
+
+extern Pio simPio;
+extern Spi simSpi;
+extern const PinDescription g_APinDescription[];
+
+#define PIOA (&simPio)
+#define SPI0 (&simSpi)
+#define REG_PIOA_PDR (simPio.PIO_PDR)
+#define REG_PMC_PCER0 (simPio.PIO_PUER)
+#define ID_PIOA 11
+#define ID_SPI0 24
+#define SPI_CR_SPIEN 1
+#define SPI_CR_SPIDIS 2
+#define SPI_CR_SWRST 128
+#define SPI_MR_MSTR 1
+#define SPI_MR_PCSDEC 4
+#define SPI_MR_MODFDIS 16
+#define SPI_SR_TDRE 2
+#define SPI_CSR_SCBR(value) ((uint32_t)(value) << 8)
+#define PIN_WIRE_SDA 20
+#define PIN_WIRE_SCL 21
+#define PIN_WIRE1_SDA 70
+#define PIN_WIRE1_SCL 71
+
+#define __NOP()
+#define digitalPinToPort(pin) (pin)
+#define digitalPinToBitMask(pin) (1 << ((pin) & 7))
+#define portOutputRegister(port) (&simPio.PIO_ODSR)
+
+inline void PIO_Set(Pio* pio, uint32_t mask) { pio->PIO_SODR = mask; }
+inline void PIO_Clear(Pio* pio, uint32_t mask) { pio->PIO_CODR = mask; }
+inline uint32_t PIO_Configure(Pio* pio, EPioType type, uint32_t mask, uint32_t attribute) { return 1; }
+
+#endif
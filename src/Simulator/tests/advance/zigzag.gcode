@@ -0,0 +1,813 @@
+; Zigzag for make bench-advance: 800 extruding moves of 5 and 0.6 mm at
+; 100 mm/s, so the speed changes at every corner, with linear advance.
+M104 S205
+G28
+G1 Z0.3 F5000
+M109 S205
+G21
+G90
+M82
+M233 Y50
+G92 E0
+G1 X50 Y50 F9000
+G1 X55.0 Y50.0 E0.1665 F6000
+G1 X55.0 Y50.6 E0.1865
+G1 X50.0 Y50.6 E0.3530
+G1 X50.0 Y51.2 E0.3730
+G1 X55.0 Y51.2 E0.5395
+G1 X55.0 Y51.8 E0.5594
+G1 X50.0 Y51.8 E0.7259
+G1 X50.0 Y52.4 E0.7459
+G1 X55.0 Y52.4 E0.9124
+G1 X55.0 Y53.0 E0.9324
+G1 X50.0 Y53.0 E1.0989
+G1 X50.0 Y53.6 E1.1189
+G1 X55.0 Y53.6 E1.2854
+G1 X55.0 Y54.2 E1.3054
+G1 X50.0 Y54.2 E1.4719
+G1 X50.0 Y54.8 E1.4918
+G1 X55.0 Y54.8 E1.6583
+G1 X55.0 Y55.4 E1.6783
+G1 X50.0 Y55.4 E1.8448
+G1 X50.0 Y56.0 E1.8648
+G1 X55.0 Y56.0 E2.0313
+G1 X55.0 Y56.6 E2.0513
+G1 X50.0 Y56.6 E2.2178
+G1 X50.0 Y57.2 E2.2378
+G1 X55.0 Y57.2 E2.4043
+G1 X55.0 Y57.8 E2.4242
+G1 X50.0 Y57.8 E2.5907
+G1 X50.0 Y58.4 E2.6107
+G1 X55.0 Y58.4 E2.7772
+G1 X55.0 Y59.0 E2.7972
+G1 X50.0 Y59.0 E2.9637
+G1 X50.0 Y59.6 E2.9837
+G1 X55.0 Y59.6 E3.1502
+G1 X55.0 Y60.2 E3.1702
+G1 X50.0 Y60.2 E3.3367
+G1 X50.0 Y60.8 E3.3566
+G1 X55.0 Y60.8 E3.5231
+G1 X55.0 Y61.4 E3.5431
+G1 X50.0 Y61.4 E3.7096
+G1 X50.0 Y62.0 E3.7296
+G1 X55.0 Y62.0 E3.8961
+G1 X55.0 Y62.6 E3.9161
+G1 X50.0 Y62.6 E4.0826
+G1 X50.0 Y63.2 E4.1026
+G1 X55.0 Y63.2 E4.2691
+G1 X55.0 Y63.8 E4.2890
+G1 X50.0 Y63.8 E4.4555
+G1 X50.0 Y64.4 E4.4755
+G1 X55.0 Y64.4 E4.6420
+G1 X55.0 Y65.0 E4.6620
+G1 X50.0 Y65.0 E4.8285
+G1 X50.0 Y65.6 E4.8485
+G1 X55.0 Y65.6 E5.0150
+G1 X55.0 Y66.2 E5.0350
+G1 X50.0 Y66.2 E5.2015
+G1 X50.0 Y66.8 E5.2214
+G1 X55.0 Y66.8 E5.3879
+G1 X55.0 Y67.4 E5.4079
+G1 X50.0 Y67.4 E5.5744
+G1 X50.0 Y68.0 E5.5944
+G1 X55.0 Y68.0 E5.7609
+G1 X55.0 Y68.6 E5.7809
+G1 X50.0 Y68.6 E5.9474
+G1 X50.0 Y69.2 E5.9674
+G1 X55.0 Y69.2 E6.1339
+G1 X55.0 Y69.8 E6.1538
+G1 X50.0 Y69.8 E6.3203
+G1 X50.0 Y70.4 E6.3403
+G1 X55.0 Y70.4 E6.5068
+G1 X55.0 Y71.0 E6.5268
+G1 X50.0 Y71.0 E6.6933
+G1 X50.0 Y71.6 E6.7133
+G1 X55.0 Y71.6 E6.8798
+G1 X55.0 Y72.2 E6.8998
+G1 X50.0 Y72.2 E7.0663
+G1 X50.0 Y72.8 E7.0862
+G1 X55.0 Y72.8 E7.2527
+G1 X55.0 Y73.4 E7.2727
+G1 X50.0 Y73.4 E7.4392
+G1 X50.0 Y74.0 E7.4592
+G1 X55.0 Y74.0 E7.6257
+G1 X55.0 Y74.6 E7.6457
+G1 X50.0 Y74.6 E7.8122
+G1 X50.0 Y75.2 E7.8322
+G1 X55.0 Y75.2 E7.9987
+G1 X55.0 Y75.8 E8.0186
+G1 X50.0 Y75.8 E8.1851
+G1 X50.0 Y76.4 E8.2051
+G1 X55.0 Y76.4 E8.3716
+G1 X55.0 Y77.0 E8.3916
+G1 X50.0 Y77.0 E8.5581
+G1 X50.0 Y77.6 E8.5781
+G1 X55.0 Y77.6 E8.7446
+G1 X55.0 Y78.2 E8.7646
+G1 X50.0 Y78.2 E8.9311
+G1 X50.0 Y78.8 E8.9510
+G1 X55.0 Y78.8 E9.1175
+G1 X55.0 Y79.4 E9.1375
+G1 X50.0 Y79.4 E9.3040
+G1 X50.0 Y80.0 E9.3240
+G1 X55.0 Y80.0 E9.4905
+G1 X55.0 Y80.6 E9.5105
+G1 X50.0 Y80.6 E9.6770
+G1 X50.0 Y81.2 E9.6970
+G1 X55.0 Y81.2 E9.8635
+G1 X55.0 Y81.8 E9.8834
+G1 X50.0 Y81.8 E10.0499
+G1 X50.0 Y82.4 E10.0699
+G1 X55.0 Y82.4 E10.2364
+G1 X55.0 Y83.0 E10.2564
+G1 X50.0 Y83.0 E10.4229
+G1 X50.0 Y83.6 E10.4429
+G1 X55.0 Y83.6 E10.6094
+G1 X55.0 Y84.2 E10.6294
+G1 X50.0 Y84.2 E10.7959
+G1 X50.0 Y84.8 E10.8158
+G1 X55.0 Y84.8 E10.9823
+G1 X55.0 Y85.4 E11.0023
+G1 X50.0 Y85.4 E11.1688
+G1 X50.0 Y86.0 E11.1888
+G1 X55.0 Y86.0 E11.3553
+G1 X55.0 Y86.6 E11.3753
+G1 X50.0 Y86.6 E11.5418
+G1 X50.0 Y87.2 E11.5618
+G1 X55.0 Y87.2 E11.7283
+G1 X55.0 Y87.8 E11.7482
+G1 X50.0 Y87.8 E11.9147
+G1 X50.0 Y88.4 E11.9347
+G1 X55.0 Y88.4 E12.1012
+G1 X55.0 Y89.0 E12.1212
+G1 X50.0 Y89.0 E12.2877
+G1 X50.0 Y89.6 E12.3077
+G1 X55.0 Y89.6 E12.4742
+G1 X55.0 Y90.2 E12.4942
+G1 X50.0 Y90.2 E12.6607
+G1 X50.0 Y90.8 E12.6806
+G1 X55.0 Y90.8 E12.8471
+G1 X55.0 Y91.4 E12.8671
+G1 X50.0 Y91.4 E13.0336
+G1 X50.0 Y92.0 E13.0536
+G1 X55.0 Y92.0 E13.2201
+G1 X55.0 Y92.6 E13.2401
+G1 X50.0 Y92.6 E13.4066
+G1 X50.0 Y93.2 E13.4266
+G1 X55.0 Y93.2 E13.5931
+G1 X55.0 Y93.8 E13.6130
+G1 X50.0 Y93.8 E13.7795
+G1 X50.0 Y94.4 E13.7995
+G1 X55.0 Y94.4 E13.9660
+G1 X55.0 Y95.0 E13.9860
+G1 X50.0 Y95.0 E14.1525
+G1 X50.0 Y95.6 E14.1725
+G1 X55.0 Y95.6 E14.3390
+G1 X55.0 Y96.2 E14.3590
+G1 X50.0 Y96.2 E14.5255
+G1 X50.0 Y96.8 E14.5454
+G1 X55.0 Y96.8 E14.7119
+G1 X55.0 Y97.4 E14.7319
+G1 X50.0 Y97.4 E14.8984
+G1 X50.0 Y98.0 E14.9184
+G1 X55.0 Y98.0 E15.0849
+G1 X55.0 Y98.6 E15.1049
+G1 X50.0 Y98.6 E15.2714
+G1 X50.0 Y99.2 E15.2914
+G1 X55.0 Y99.2 E15.4579
+G1 X55.0 Y99.8 E15.4778
+G1 X50.0 Y99.8 E15.6443
+G1 X50.0 Y100.4 E15.6643
+G1 X55.0 Y100.4 E15.8308
+G1 X55.0 Y101.0 E15.8508
+G1 X50.0 Y101.0 E16.0173
+G1 X50.0 Y101.6 E16.0373
+G1 X55.0 Y101.6 E16.2038
+G1 X55.0 Y102.2 E16.2238
+G1 X50.0 Y102.2 E16.3903
+G1 X50.0 Y102.8 E16.4102
+G1 X55.0 Y102.8 E16.5767
+G1 X55.0 Y103.4 E16.5967
+G1 X50.0 Y103.4 E16.7632
+G1 X50.0 Y104.0 E16.7832
+G1 X55.0 Y104.0 E16.9497
+G1 X55.0 Y104.6 E16.9697
+G1 X50.0 Y104.6 E17.1362
+G1 X50.0 Y105.2 E17.1562
+G1 X55.0 Y105.2 E17.3227
+G1 X55.0 Y105.8 E17.3426
+G1 X50.0 Y105.8 E17.5091
+G1 X50.0 Y106.4 E17.5291
+G1 X55.0 Y106.4 E17.6956
+G1 X55.0 Y107.0 E17.7156
+G1 X50.0 Y107.0 E17.8821
+G1 X50.0 Y107.6 E17.9021
+G1 X55.0 Y107.6 E18.0686
+G1 X55.0 Y108.2 E18.0886
+G1 X50.0 Y108.2 E18.2551
+G1 X50.0 Y108.8 E18.2750
+G1 X55.0 Y108.8 E18.4415
+G1 X55.0 Y109.4 E18.4615
+G1 X50.0 Y109.4 E18.6280
+G1 X50.0 Y110.0 E18.6480
+G1 X55.0 Y110.0 E18.8145
+G1 X55.0 Y110.6 E18.8345
+G1 X50.0 Y110.6 E19.0010
+G1 X50.0 Y111.2 E19.0210
+G1 X55.0 Y111.2 E19.1875
+G1 X55.0 Y111.8 E19.2074
+G1 X50.0 Y111.8 E19.3739
+G1 X50.0 Y112.4 E19.3939
+G1 X55.0 Y112.4 E19.5604
+G1 X55.0 Y113.0 E19.5804
+G1 X50.0 Y113.0 E19.7469
+G1 X50.0 Y113.6 E19.7669
+G1 X55.0 Y113.6 E19.9334
+G1 X55.0 Y114.2 E19.9534
+G1 X50.0 Y114.2 E20.1199
+G1 X50.0 Y114.8 E20.1398
+G1 X55.0 Y114.8 E20.3063
+G1 X55.0 Y115.4 E20.3263
+G1 X50.0 Y115.4 E20.4928
+G1 X50.0 Y116.0 E20.5128
+G1 X55.0 Y116.0 E20.6793
+G1 X55.0 Y116.6 E20.6993
+G1 X50.0 Y116.6 E20.8658
+G1 X50.0 Y117.2 E20.8858
+G1 X55.0 Y117.2 E21.0523
+G1 X55.0 Y117.8 E21.0722
+G1 X50.0 Y117.8 E21.2387
+G1 X50.0 Y118.4 E21.2587
+G1 X55.0 Y118.4 E21.4252
+G1 X55.0 Y119.0 E21.4452
+G1 X50.0 Y119.0 E21.6117
+G1 X50.0 Y119.6 E21.6317
+G1 X55.0 Y119.6 E21.7982
+G1 X55.0 Y120.2 E21.8182
+G1 X50.0 Y120.2 E21.9847
+G1 X50.0 Y120.8 E22.0046
+G1 X55.0 Y120.8 E22.1711
+G1 X55.0 Y121.4 E22.1911
+G1 X50.0 Y121.4 E22.3576
+G1 X50.0 Y122.0 E22.3776
+G1 X55.0 Y122.0 E22.5441
+G1 X55.0 Y122.6 E22.5641
+G1 X50.0 Y122.6 E22.7306
+G1 X50.0 Y123.2 E22.7506
+G1 X55.0 Y123.2 E22.9171
+G1 X55.0 Y123.8 E22.9370
+G1 X50.0 Y123.8 E23.1035
+G1 X50.0 Y124.4 E23.1235
+G1 X55.0 Y124.4 E23.2900
+G1 X55.0 Y125.0 E23.3100
+G1 X50.0 Y125.0 E23.4765
+G1 X50.0 Y125.6 E23.4965
+G1 X55.0 Y125.6 E23.6630
+G1 X55.0 Y126.2 E23.6830
+G1 X50.0 Y126.2 E23.8495
+G1 X50.0 Y126.8 E23.8694
+G1 X55.0 Y126.8 E24.0359
+G1 X55.0 Y127.4 E24.0559
+G1 X50.0 Y127.4 E24.2224
+G1 X50.0 Y128.0 E24.2424
+G1 X55.0 Y128.0 E24.4089
+G1 X55.0 Y128.6 E24.4289
+G1 X50.0 Y128.6 E24.5954
+G1 X50.0 Y129.2 E24.6154
+G1 X55.0 Y129.2 E24.7819
+G1 X55.0 Y129.8 E24.8018
+G1 X50.0 Y129.8 E24.9683
+G1 X50.0 Y130.4 E24.9883
+G1 X55.0 Y130.4 E25.1548
+G1 X55.0 Y131.0 E25.1748
+G1 X50.0 Y131.0 E25.3413
+G1 X50.0 Y131.6 E25.3613
+G1 X55.0 Y131.6 E25.5278
+G1 X55.0 Y132.2 E25.5478
+G1 X50.0 Y132.2 E25.7143
+G1 X50.0 Y132.8 E25.7342
+G1 X55.0 Y132.8 E25.9007
+G1 X55.0 Y133.4 E25.9207
+G1 X50.0 Y133.4 E26.0872
+G1 X50.0 Y134.0 E26.1072
+G1 X55.0 Y134.0 E26.2737
+G1 X55.0 Y134.6 E26.2937
+G1 X50.0 Y134.6 E26.4602
+G1 X50.0 Y135.2 E26.4802
+G1 X55.0 Y135.2 E26.6467
+G1 X55.0 Y135.8 E26.6666
+G1 X50.0 Y135.8 E26.8331
+G1 X50.0 Y136.4 E26.8531
+G1 X55.0 Y136.4 E27.0196
+G1 X55.0 Y137.0 E27.0396
+G1 X50.0 Y137.0 E27.2061
+G1 X50.0 Y137.6 E27.2261
+G1 X55.0 Y137.6 E27.3926
+G1 X55.0 Y138.2 E27.4126
+G1 X50.0 Y138.2 E27.5791
+G1 X50.0 Y138.8 E27.5990
+G1 X55.0 Y138.8 E27.7655
+G1 X55.0 Y139.4 E27.7855
+G1 X50.0 Y139.4 E27.9520
+G1 X50.0 Y140.0 E27.9720
+G1 X55.0 Y140.0 E28.1385
+G1 X55.0 Y140.6 E28.1585
+G1 X50.0 Y140.6 E28.3250
+G1 X50.0 Y141.2 E28.3450
+G1 X55.0 Y141.2 E28.5115
+G1 X55.0 Y141.8 E28.5314
+G1 X50.0 Y141.8 E28.6979
+G1 X50.0 Y142.4 E28.7179
+G1 X55.0 Y142.4 E28.8844
+G1 X55.0 Y143.0 E28.9044
+G1 X50.0 Y143.0 E29.0709
+G1 X50.0 Y143.6 E29.0909
+G1 X55.0 Y143.6 E29.2574
+G1 X55.0 Y144.2 E29.2774
+G1 X50.0 Y144.2 E29.4439
+G1 X50.0 Y144.8 E29.4638
+G1 X55.0 Y144.8 E29.6303
+G1 X55.0 Y145.4 E29.6503
+G1 X50.0 Y145.4 E29.8168
+G1 X50.0 Y146.0 E29.8368
+G1 X55.0 Y146.0 E30.0033
+G1 X55.0 Y146.6 E30.0233
+G1 X50.0 Y146.6 E30.1898
+G1 X50.0 Y147.2 E30.2098
+G1 X55.0 Y147.2 E30.3763
+G1 X55.0 Y147.8 E30.3962
+G1 X50.0 Y147.8 E30.5627
+G1 X50.0 Y148.4 E30.5827
+G1 X55.0 Y148.4 E30.7492
+G1 X55.0 Y149.0 E30.7692
+G1 X50.0 Y149.0 E30.9357
+G1 X50.0 Y149.6 E30.9557
+G1 X55.0 Y149.6 E31.1222
+G1 X55.0 Y150.2 E31.1422
+G1 X50.0 Y150.2 E31.3087
+G1 X50.0 Y150.8 E31.3286
+G1 X55.0 Y150.8 E31.4951
+G1 X55.0 Y151.4 E31.5151
+G1 X50.0 Y151.4 E31.6816
+G1 X50.0 Y152.0 E31.7016
+G1 X55.0 Y152.0 E31.8681
+G1 X55.0 Y152.6 E31.8881
+G1 X50.0 Y152.6 E32.0546
+G1 X50.0 Y153.2 E32.0746
+G1 X55.0 Y153.2 E32.2411
+G1 X55.0 Y153.8 E32.2610
+G1 X50.0 Y153.8 E32.4275
+G1 X50.0 Y154.4 E32.4475
+G1 X55.0 Y154.4 E32.6140
+G1 X55.0 Y155.0 E32.6340
+G1 X50.0 Y155.0 E32.8005
+G1 X50.0 Y155.6 E32.8205
+G1 X55.0 Y155.6 E32.9870
+G1 X55.0 Y156.2 E33.0070
+G1 X50.0 Y156.2 E33.1735
+G1 X50.0 Y156.8 E33.1934
+G1 X55.0 Y156.8 E33.3599
+G1 X55.0 Y157.4 E33.3799
+G1 X50.0 Y157.4 E33.5464
+G1 X50.0 Y158.0 E33.5664
+G1 X55.0 Y158.0 E33.7329
+G1 X55.0 Y158.6 E33.7529
+G1 X50.0 Y158.6 E33.9194
+G1 X50.0 Y159.2 E33.9394
+G1 X55.0 Y159.2 E34.1059
+G1 X55.0 Y159.8 E34.1258
+G1 X50.0 Y159.8 E34.2923
+G1 X50.0 Y160.4 E34.3123
+G1 X55.0 Y160.4 E34.4788
+G1 X55.0 Y161.0 E34.4988
+G1 X50.0 Y161.0 E34.6653
+G1 X50.0 Y161.6 E34.6853
+G1 X55.0 Y161.6 E34.8518
+G1 X55.0 Y162.2 E34.8718
+G1 X50.0 Y162.2 E35.0383
+G1 X50.0 Y162.8 E35.0582
+G1 X55.0 Y162.8 E35.2247
+G1 X55.0 Y163.4 E35.2447
+G1 X50.0 Y163.4 E35.4112
+G1 X50.0 Y164.0 E35.4312
+G1 X55.0 Y164.0 E35.5977
+G1 X55.0 Y164.6 E35.6177
+G1 X50.0 Y164.6 E35.7842
+G1 X50.0 Y165.2 E35.8042
+G1 X55.0 Y165.2 E35.9707
+G1 X55.0 Y165.8 E35.9906
+G1 X50.0 Y165.8 E36.1571
+G1 X50.0 Y166.4 E36.1771
+G1 X55.0 Y166.4 E36.3436
+G1 X55.0 Y167.0 E36.3636
+G1 X50.0 Y167.0 E36.5301
+G1 X50.0 Y167.6 E36.5501
+G1 X55.0 Y167.6 E36.7166
+G1 X55.0 Y168.2 E36.7366
+G1 X50.0 Y168.2 E36.9031
+G1 X50.0 Y168.8 E36.9230
+G1 X55.0 Y168.8 E37.0895
+G1 X55.0 Y169.4 E37.1095
+G1 X50.0 Y169.4 E37.2760
+G1 X50.0 Y170.0 E37.2960
+G1 X55.0 Y170.0 E37.4625
+G1 X55.0 Y170.6 E37.4825
+G1 X50.0 Y170.6 E37.6490
+G1 X50.0 Y171.2 E37.6690
+G1 X55.0 Y171.2 E37.8355
+G1 X55.0 Y171.8 E37.8554
+G1 X50.0 Y171.8 E38.0219
+G1 X50.0 Y172.4 E38.0419
+G1 X55.0 Y172.4 E38.2084
+G1 X55.0 Y173.0 E38.2284
+G1 X50.0 Y173.0 E38.3949
+G1 X50.0 Y173.6 E38.4149
+G1 X55.0 Y173.6 E38.5814
+G1 X55.0 Y174.2 E38.6014
+G1 X50.0 Y174.2 E38.7679
+G1 X50.0 Y174.8 E38.7878
+G1 X55.0 Y174.8 E38.9543
+G1 X55.0 Y175.4 E38.9743
+G1 X50.0 Y175.4 E39.1408
+G1 X50.0 Y176.0 E39.1608
+G1 X55.0 Y176.0 E39.3273
+G1 X55.0 Y176.6 E39.3473
+G1 X50.0 Y176.6 E39.5138
+G1 X50.0 Y177.2 E39.5338
+G1 X55.0 Y177.2 E39.7003
+G1 X55.0 Y177.8 E39.7202
+G1 X50.0 Y177.8 E39.8867
+G1 X50.0 Y178.4 E39.9067
+G1 X55.0 Y178.4 E40.0732
+G1 X55.0 Y179.0 E40.0932
+G1 X50.0 Y179.0 E40.2597
+G1 X50.0 Y179.6 E40.2797
+G1 X55.0 Y179.6 E40.4462
+G1 X55.0 Y180.2 E40.4662
+G1 X50.0 Y180.2 E40.6327
+G1 X50.0 Y180.8 E40.6526
+G1 X55.0 Y180.8 E40.8191
+G1 X55.0 Y181.4 E40.8391
+G1 X50.0 Y181.4 E41.0056
+G1 X50.0 Y182.0 E41.0256
+G1 X55.0 Y182.0 E41.1921
+G1 X55.0 Y182.6 E41.2121
+G1 X50.0 Y182.6 E41.3786
+G1 X50.0 Y183.2 E41.3986
+G1 X55.0 Y183.2 E41.5651
+G1 X55.0 Y183.8 E41.5850
+G1 X50.0 Y183.8 E41.7515
+G1 X50.0 Y184.4 E41.7715
+G1 X55.0 Y184.4 E41.9380
+G1 X55.0 Y185.0 E41.9580
+G1 X50.0 Y185.0 E42.1245
+G1 X50.0 Y185.6 E42.1445
+G1 X55.0 Y185.6 E42.3110
+G1 X55.0 Y186.2 E42.3310
+G1 X50.0 Y186.2 E42.4975
+G1 X50.0 Y186.8 E42.5174
+G1 X55.0 Y186.8 E42.6839
+G1 X55.0 Y187.4 E42.7039
+G1 X50.0 Y187.4 E42.8704
+G1 X50.0 Y188.0 E42.8904
+G1 X55.0 Y188.0 E43.0569
+G1 X55.0 Y188.6 E43.0769
+G1 X50.0 Y188.6 E43.2434
+G1 X50.0 Y189.2 E43.2634
+G1 X55.0 Y189.2 E43.4299
+G1 X55.0 Y189.8 E43.4498
+G1 X50.0 Y189.8 E43.6163
+G1 X50.0 Y190.4 E43.6363
+G1 X55.0 Y190.4 E43.8028
+G1 X55.0 Y191.0 E43.8228
+G1 X50.0 Y191.0 E43.9893
+G1 X50.0 Y191.6 E44.0093
+G1 X55.0 Y191.6 E44.1758
+G1 X55.0 Y192.2 E44.1958
+G1 X50.0 Y192.2 E44.3623
+G1 X50.0 Y192.8 E44.3822
+G1 X55.0 Y192.8 E44.5487
+G1 X55.0 Y193.4 E44.5687
+G1 X50.0 Y193.4 E44.7352
+G1 X50.0 Y194.0 E44.7552
+G1 X55.0 Y194.0 E44.9217
+G1 X55.0 Y194.6 E44.9417
+G1 X50.0 Y194.6 E45.1082
+G1 X50.0 Y195.2 E45.1282
+G1 X55.0 Y195.2 E45.2947
+G1 X55.0 Y195.8 E45.3146
+G1 X50.0 Y195.8 E45.4811
+G1 X50.0 Y196.4 E45.5011
+G1 X55.0 Y196.4 E45.6676
+G1 X55.0 Y197.0 E45.6876
+G1 X50.0 Y197.0 E45.8541
+G1 X50.0 Y197.6 E45.8741
+G1 X55.0 Y197.6 E46.0406
+G1 X55.0 Y198.2 E46.0606
+G1 X50.0 Y198.2 E46.2271
+G1 X50.0 Y198.8 E46.2470
+G1 X55.0 Y198.8 E46.4135
+G1 X55.0 Y199.4 E46.4335
+G1 X50.0 Y199.4 E46.6000
+G1 X50.0 Y200.0 E46.6200
+G1 X55.0 Y200.0 E46.7865
+G1 X55.0 Y200.6 E46.8065
+G1 X50.0 Y200.6 E46.9730
+G1 X50.0 Y201.2 E46.9930
+G1 X55.0 Y201.2 E47.1595
+G1 X55.0 Y201.8 E47.1794
+G1 X50.0 Y201.8 E47.3459
+G1 X50.0 Y202.4 E47.3659
+G1 X55.0 Y202.4 E47.5324
+G1 X55.0 Y203.0 E47.5524
+G1 X50.0 Y203.0 E47.7189
+G1 X50.0 Y203.6 E47.7389
+G1 X55.0 Y203.6 E47.9054
+G1 X55.0 Y204.2 E47.9254
+G1 X50.0 Y204.2 E48.0919
+G1 X50.0 Y204.8 E48.1118
+G1 X55.0 Y204.8 E48.2783
+G1 X55.0 Y205.4 E48.2983
+G1 X50.0 Y205.4 E48.4648
+G1 X50.0 Y206.0 E48.4848
+G1 X55.0 Y206.0 E48.6513
+G1 X55.0 Y206.6 E48.6713
+G1 X50.0 Y206.6 E48.8378
+G1 X50.0 Y207.2 E48.8578
+G1 X55.0 Y207.2 E49.0243
+G1 X55.0 Y207.8 E49.0442
+G1 X50.0 Y207.8 E49.2107
+G1 X50.0 Y208.4 E49.2307
+G1 X55.0 Y208.4 E49.3972
+G1 X55.0 Y209.0 E49.4172
+G1 X50.0 Y209.0 E49.5837
+G1 X50.0 Y209.6 E49.6037
+G1 X55.0 Y209.6 E49.7702
+G1 X55.0 Y210.2 E49.7902
+G1 X50.0 Y210.2 E49.9567
+G1 X50.0 Y210.8 E49.9766
+G1 X55.0 Y210.8 E50.1431
+G1 X55.0 Y211.4 E50.1631
+G1 X50.0 Y211.4 E50.3296
+G1 X50.0 Y212.0 E50.3496
+G1 X55.0 Y212.0 E50.5161
+G1 X55.0 Y212.6 E50.5361
+G1 X50.0 Y212.6 E50.7026
+G1 X50.0 Y213.2 E50.7226
+G1 X55.0 Y213.2 E50.8891
+G1 X55.0 Y213.8 E50.9090
+G1 X50.0 Y213.8 E51.0755
+G1 X50.0 Y214.4 E51.0955
+G1 X55.0 Y214.4 E51.2620
+G1 X55.0 Y215.0 E51.2820
+G1 X50.0 Y215.0 E51.4485
+G1 X50.0 Y215.6 E51.4685
+G1 X55.0 Y215.6 E51.6350
+G1 X55.0 Y216.2 E51.6550
+G1 X50.0 Y216.2 E51.8215
+G1 X50.0 Y216.8 E51.8414
+G1 X55.0 Y216.8 E52.0079
+G1 X55.0 Y217.4 E52.0279
+G1 X50.0 Y217.4 E52.1944
+G1 X50.0 Y218.0 E52.2144
+G1 X55.0 Y218.0 E52.3809
+G1 X55.0 Y218.6 E52.4009
+G1 X50.0 Y218.6 E52.5674
+G1 X50.0 Y219.2 E52.5874
+G1 X55.0 Y219.2 E52.7539
+G1 X55.0 Y219.8 E52.7738
+G1 X50.0 Y219.8 E52.9403
+G1 X50.0 Y220.4 E52.9603
+G1 X55.0 Y220.4 E53.1268
+G1 X55.0 Y221.0 E53.1468
+G1 X50.0 Y221.0 E53.3133
+G1 X50.0 Y221.6 E53.3333
+G1 X55.0 Y221.6 E53.4998
+G1 X55.0 Y222.2 E53.5198
+G1 X50.0 Y222.2 E53.6863
+G1 X50.0 Y222.8 E53.7062
+G1 X55.0 Y222.8 E53.8727
+G1 X55.0 Y223.4 E53.8927
+G1 X50.0 Y223.4 E54.0592
+G1 X50.0 Y224.0 E54.0792
+G1 X55.0 Y224.0 E54.2457
+G1 X55.0 Y224.6 E54.2657
+G1 X50.0 Y224.6 E54.4322
+G1 X50.0 Y225.2 E54.4522
+G1 X55.0 Y225.2 E54.6187
+G1 X55.0 Y225.8 E54.6386
+G1 X50.0 Y225.8 E54.8051
+G1 X50.0 Y226.4 E54.8251
+G1 X55.0 Y226.4 E54.9916
+G1 X55.0 Y227.0 E55.0116
+G1 X50.0 Y227.0 E55.1781
+G1 X50.0 Y227.6 E55.1981
+G1 X55.0 Y227.6 E55.3646
+G1 X55.0 Y228.2 E55.3846
+G1 X50.0 Y228.2 E55.5511
+G1 X50.0 Y228.8 E55.5710
+G1 X55.0 Y228.8 E55.7375
+G1 X55.0 Y229.4 E55.7575
+G1 X50.0 Y229.4 E55.9240
+G1 X50.0 Y230.0 E55.9440
+G1 X55.0 Y230.0 E56.1105
+G1 X55.0 Y230.6 E56.1305
+G1 X50.0 Y230.6 E56.2970
+G1 X50.0 Y231.2 E56.3170
+G1 X55.0 Y231.2 E56.4835
+G1 X55.0 Y231.8 E56.5034
+G1 X50.0 Y231.8 E56.6699
+G1 X50.0 Y232.4 E56.6899
+G1 X55.0 Y232.4 E56.8564
+G1 X55.0 Y233.0 E56.8764
+G1 X50.0 Y233.0 E57.0429
+G1 X50.0 Y233.6 E57.0629
+G1 X55.0 Y233.6 E57.2294
+G1 X55.0 Y234.2 E57.2494
+G1 X50.0 Y234.2 E57.4159
+G1 X50.0 Y234.8 E57.4358
+G1 X55.0 Y234.8 E57.6023
+G1 X55.0 Y235.4 E57.6223
+G1 X50.0 Y235.4 E57.7888
+G1 X50.0 Y236.0 E57.8088
+G1 X55.0 Y236.0 E57.9753
+G1 X55.0 Y236.6 E57.9953
+G1 X50.0 Y236.6 E58.1618
+G1 X50.0 Y237.2 E58.1818
+G1 X55.0 Y237.2 E58.3483
+G1 X55.0 Y237.8 E58.3682
+G1 X50.0 Y237.8 E58.5347
+G1 X50.0 Y238.4 E58.5547
+G1 X55.0 Y238.4 E58.7212
+G1 X55.0 Y239.0 E58.7412
+G1 X50.0 Y239.0 E58.9077
+G1 X50.0 Y239.6 E58.9277
+G1 X55.0 Y239.6 E59.0942
+G1 X55.0 Y240.2 E59.1142
+G1 X50.0 Y240.2 E59.2807
+G1 X50.0 Y240.8 E59.3006
+G1 X55.0 Y240.8 E59.4671
+G1 X55.0 Y241.4 E59.4871
+G1 X50.0 Y241.4 E59.6536
+G1 X50.0 Y242.0 E59.6736
+G1 X55.0 Y242.0 E59.8401
+G1 X55.0 Y242.6 E59.8601
+G1 X50.0 Y242.6 E60.0266
+G1 X50.0 Y243.2 E60.0466
+G1 X55.0 Y243.2 E60.2131
+G1 X55.0 Y243.8 E60.2330
+G1 X50.0 Y243.8 E60.3995
+G1 X50.0 Y244.4 E60.4195
+G1 X55.0 Y244.4 E60.5860
+G1 X55.0 Y245.0 E60.6060
+G1 X50.0 Y245.0 E60.7725
+G1 X50.0 Y245.6 E60.7925
+G1 X55.0 Y245.6 E60.9590
+G1 X55.0 Y246.2 E60.9790
+G1 X50.0 Y246.2 E61.1455
+G1 X50.0 Y246.8 E61.1654
+G1 X55.0 Y246.8 E61.3319
+G1 X55.0 Y247.4 E61.3519
+G1 X50.0 Y247.4 E61.5184
+G1 X50.0 Y248.0 E61.5384
+G1 X55.0 Y248.0 E61.7049
+G1 X55.0 Y248.6 E61.7249
+G1 X50.0 Y248.6 E61.8914
+G1 X50.0 Y249.2 E61.9114
+G1 X55.0 Y249.2 E62.0779
+G1 X55.0 Y249.8 E62.0978
+G1 X50.0 Y249.8 E62.2643
+G1 X50.0 Y250.4 E62.2843
+G1 X55.0 Y250.4 E62.4508
+G1 X55.0 Y251.0 E62.4708
+G1 X50.0 Y251.0 E62.6373
+G1 X50.0 Y251.6 E62.6573
+G1 X55.0 Y251.6 E62.8238
+G1 X55.0 Y252.2 E62.8438
+G1 X50.0 Y252.2 E63.0103
+G1 X50.0 Y252.8 E63.0302
+G1 X55.0 Y252.8 E63.1967
+G1 X55.0 Y253.4 E63.2167
+G1 X50.0 Y253.4 E63.3832
+G1 X50.0 Y254.0 E63.4032
+G1 X55.0 Y254.0 E63.5697
+G1 X55.0 Y254.6 E63.5897
+G1 X50.0 Y254.6 E63.7562
+G1 X50.0 Y255.2 E63.7762
+G1 X55.0 Y255.2 E63.9427
+G1 X55.0 Y255.8 E63.9626
+G1 X50.0 Y255.8 E64.1291
+G1 X50.0 Y256.4 E64.1491
+G1 X55.0 Y256.4 E64.3156
+G1 X55.0 Y257.0 E64.3356
+G1 X50.0 Y257.0 E64.5021
+G1 X50.0 Y257.6 E64.5221
+G1 X55.0 Y257.6 E64.6886
+G1 X55.0 Y258.2 E64.7086
+G1 X50.0 Y258.2 E64.8751
+G1 X50.0 Y258.8 E64.8950
+G1 X55.0 Y258.8 E65.0615
+G1 X55.0 Y259.4 E65.0815
+G1 X50.0 Y259.4 E65.2480
+G1 X50.0 Y260.0 E65.2680
+G1 X55.0 Y260.0 E65.4345
+G1 X55.0 Y260.6 E65.4545
+G1 X50.0 Y260.6 E65.6210
+G1 X50.0 Y261.2 E65.6410
+G1 X55.0 Y261.2 E65.8075
+G1 X55.0 Y261.8 E65.8274
+G1 X50.0 Y261.8 E65.9939
+G1 X50.0 Y262.4 E66.0139
+G1 X55.0 Y262.4 E66.1804
+G1 X55.0 Y263.0 E66.2004
+G1 X50.0 Y263.0 E66.3669
+G1 X50.0 Y263.6 E66.3869
+G1 X55.0 Y263.6 E66.5534
+G1 X55.0 Y264.2 E66.5734
+G1 X50.0 Y264.2 E66.7399
+G1 X50.0 Y264.8 E66.7598
+G1 X55.0 Y264.8 E66.9263
+G1 X55.0 Y265.4 E66.9463
+G1 X50.0 Y265.4 E67.1128
+G1 X50.0 Y266.0 E67.1328
+G1 X55.0 Y266.0 E67.2993
+G1 X55.0 Y266.6 E67.3193
+G1 X50.0 Y266.6 E67.4858
+G1 X50.0 Y267.2 E67.5058
+G1 X55.0 Y267.2 E67.6723
+G1 X55.0 Y267.8 E67.6922
+G1 X50.0 Y267.8 E67.8587
+G1 X50.0 Y268.4 E67.8787
+G1 X55.0 Y268.4 E68.0452
+G1 X55.0 Y269.0 E68.0652
+G1 X50.0 Y269.0 E68.2317
+G1 X50.0 Y269.6 E68.2517
+G1 X55.0 Y269.6 E68.4182
+G1 X55.0 Y270.2 E68.4382
+G1 X50.0 Y270.2 E68.6047
+G1 X50.0 Y270.8 E68.6246
+G1 X55.0 Y270.8 E68.7911
+G1 X55.0 Y271.4 E68.8111
+G1 X50.0 Y271.4 E68.9776
+G1 X50.0 Y272.0 E68.9976
+G1 X55.0 Y272.0 E69.1641
+G1 X55.0 Y272.6 E69.1841
+G1 X50.0 Y272.6 E69.3506
+G1 X50.0 Y273.2 E69.3706
+G1 X55.0 Y273.2 E69.5371
+G1 X55.0 Y273.8 E69.5570
+G1 X50.0 Y273.8 E69.7235
+G1 X50.0 Y274.4 E69.7435
+G1 X55.0 Y274.4 E69.9100
+G1 X55.0 Y275.0 E69.9300
+G1 X50.0 Y275.0 E70.0965
+G1 X50.0 Y275.6 E70.1165
+G1 X55.0 Y275.6 E70.2830
+G1 X55.0 Y276.2 E70.3030
+G1 X50.0 Y276.2 E70.4695
+G1 X50.0 Y276.8 E70.4894
+G1 X55.0 Y276.8 E70.6559
+G1 X55.0 Y277.4 E70.6759
+G1 X50.0 Y277.4 E70.8424
+G1 X50.0 Y278.0 E70.8624
+G1 X55.0 Y278.0 E71.0289
+G1 X55.0 Y278.6 E71.0489
+G1 X50.0 Y278.6 E71.2154
+G1 X50.0 Y279.2 E71.2354
+G1 X55.0 Y279.2 E71.4019
+G1 X55.0 Y279.8 E71.4218
+G1 X50.0 Y279.8 E71.5883
+G1 X50.0 Y280.4 E71.6083
+G1 X55.0 Y280.4 E71.7748
+G1 X55.0 Y281.0 E71.7948
+G1 X50.0 Y281.0 E71.9613
+G1 X50.0 Y281.6 E71.9813
+G1 X55.0 Y281.6 E72.1478
+G1 X55.0 Y282.2 E72.1678
+G1 X50.0 Y282.2 E72.3343
+G1 X50.0 Y282.8 E72.3542
+G1 X55.0 Y282.8 E72.5207
+G1 X55.0 Y283.4 E72.5407
+G1 X50.0 Y283.4 E72.7072
+G1 X50.0 Y284.0 E72.7272
+G1 X55.0 Y284.0 E72.8937
+G1 X55.0 Y284.6 E72.9137
+G1 X50.0 Y284.6 E73.0802
+G1 X50.0 Y285.2 E73.1002
+G1 X55.0 Y285.2 E73.2667
+G1 X55.0 Y285.8 E73.2866
+G1 X50.0 Y285.8 E73.4531
+G1 X50.0 Y286.4 E73.4731
+G1 X55.0 Y286.4 E73.6396
+G1 X55.0 Y287.0 E73.6596
+G1 X50.0 Y287.0 E73.8261
+G1 X50.0 Y287.6 E73.8461
+G1 X55.0 Y287.6 E74.0126
+G1 X55.0 Y288.2 E74.0326
+G1 X50.0 Y288.2 E74.1991
+G1 X50.0 Y288.8 E74.2190
+G1 X55.0 Y288.8 E74.3855
+G1 X55.0 Y289.4 E74.4055
+G1 X50.0 Y289.4 E74.5720
+G1 X50.0 Y290.0 E74.5920
+G1 Z10 F5000
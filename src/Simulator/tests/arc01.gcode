@@ -0,0 +1,3149 @@
+; 0.1 mm segments on 5 circles of 10 mm radius at 100 mm/s, like the curved
+; perimeters of a finely sliced model. make bench-queue replays it with
+; different move cache sizes.
+; expect Steps: X:34582 Y:25715 Z:2284649 E0:1109
+; expect Printing moves: 314.6 mm in 3.216 s, 97.8 mm/s
+G28
+G1 Z0.3 F3000
+G1 X110 Y100 F9000
+G92 E0
+G1 X109.999 Y100.100 E0.00333 F6000
+G1 X109.998 Y100.200 E0.00666
+G1 X109.995 Y100.300 E0.01000
+G1 X109.992 Y100.400 E0.01333
+G1 X109.987 Y100.500 E0.01666
+G1 X109.982 Y100.600 E0.01999
+G1 X109.975 Y100.700 E0.02332
+G1 X109.968 Y100.800 E0.02665
+G1 X109.959 Y100.899 E0.02999
+G1 X109.950 Y100.999 E0.03332
+G1 X109.939 Y101.098 E0.03665
+G1 X109.928 Y101.198 E0.03998
+G1 X109.916 Y101.297 E0.04331
+G1 X109.902 Y101.396 E0.04664
+G1 X109.888 Y101.495 E0.04998
+G1 X109.872 Y101.594 E0.05331
+G1 X109.856 Y101.693 E0.05664
+G1 X109.838 Y101.791 E0.05997
+G1 X109.820 Y101.890 E0.06330
+G1 X109.800 Y101.988 E0.06663
+G1 X109.780 Y102.086 E0.06997
+G1 X109.759 Y102.183 E0.07330
+G1 X109.736 Y102.281 E0.07663
+G1 X109.713 Y102.378 E0.07996
+G1 X109.689 Y102.475 E0.08329
+G1 X109.664 Y102.572 E0.08662
+G1 X109.637 Y102.669 E0.08996
+G1 X109.610 Y102.765 E0.09329
+G1 X109.582 Y102.861 E0.09662
+G1 X109.553 Y102.957 E0.09995
+G1 X109.523 Y103.052 E0.10328
+G1 X109.492 Y103.147 E0.10661
+G1 X109.460 Y103.242 E0.10995
+G1 X109.427 Y103.336 E0.11328
+G1 X109.393 Y103.431 E0.11661
+G1 X109.358 Y103.524 E0.11994
+G1 X109.323 Y103.618 E0.12327
+G1 X109.286 Y103.711 E0.12660
+G1 X109.248 Y103.804 E0.12994
+G1 X109.210 Y103.896 E0.13327
+G1 X109.170 Y103.988 E0.13660
+G1 X109.130 Y104.080 E0.13993
+G1 X109.089 Y104.171 E0.14326
+G1 X109.047 Y104.261 E0.14659
+G1 X109.003 Y104.352 E0.14993
+G1 X108.959 Y104.442 E0.15326
+G1 X108.915 Y104.531 E0.15659
+G1 X108.869 Y104.620 E0.15992
+G1 X108.822 Y104.708 E0.16325
+G1 X108.775 Y104.796 E0.16658
+G1 X108.726 Y104.884 E0.16992
+G1 X108.677 Y104.971 E0.17325
+G1 X108.627 Y105.058 E0.17658
+G1 X108.576 Y105.144 E0.17991
+G1 X108.524 Y105.229 E0.18324
+G1 X108.471 Y105.314 E0.18657
+G1 X108.417 Y105.399 E0.18991
+G1 X108.363 Y105.483 E0.19324
+G1 X108.308 Y105.566 E0.19657
+G1 X108.252 Y105.649 E0.19990
+G1 X108.195 Y105.731 E0.20323
+G1 X108.137 Y105.813 E0.20656
+G1 X108.078 Y105.894 E0.20990
+G1 X108.019 Y105.975 E0.21323
+G1 X107.959 Y106.054 E0.21656
+G1 X107.898 Y106.134 E0.21989
+G1 X107.836 Y106.213 E0.22322
+G1 X107.774 Y106.291 E0.22655
+G1 X107.710 Y106.368 E0.22989
+G1 X107.646 Y106.445 E0.23322
+G1 X107.581 Y106.521 E0.23655
+G1 X107.516 Y106.597 E0.23988
+G1 X107.449 Y106.671 E0.24321
+G1 X107.382 Y106.746 E0.24654
+G1 X107.314 Y106.819 E0.24988
+G1 X107.246 Y106.892 E0.25321
+G1 X107.176 Y106.964 E0.25654
+G1 X107.106 Y107.036 E0.25987
+G1 X107.036 Y107.106 E0.26320
+G1 X106.964 Y107.176 E0.26653
+G1 X106.892 Y107.246 E0.26987
+G1 X106.819 Y107.314 E0.27320
+G1 X106.746 Y107.382 E0.27653
+G1 X106.671 Y107.449 E0.27986
+G1 X106.597 Y107.516 E0.28319
+G1 X106.521 Y107.581 E0.28652
+G1 X106.445 Y107.646 E0.28986
+G1 X106.368 Y107.710 E0.29319
+G1 X106.291 Y107.774 E0.29652
+G1 X106.213 Y107.836 E0.29985
+G1 X106.134 Y107.898 E0.30318
+G1 X106.054 Y107.959 E0.30651
+G1 X105.975 Y108.019 E0.30985
+G1 X105.894 Y108.078 E0.31318
+G1 X105.813 Y108.137 E0.31651
+G1 X105.731 Y108.195 E0.31984
+G1 X105.649 Y108.252 E0.32317
+G1 X105.566 Y108.308 E0.32650
+G1 X105.483 Y108.363 E0.32984
+G1 X105.399 Y108.417 E0.33317
+G1 X105.314 Y108.471 E0.33650
+G1 X105.229 Y108.524 E0.33983
+G1 X105.144 Y108.576 E0.34316
+G1 X105.058 Y108.627 E0.34649
+G1 X104.971 Y108.677 E0.34983
+G1 X104.884 Y108.726 E0.35316
+G1 X104.796 Y108.775 E0.35649
+G1 X104.708 Y108.822 E0.35982
+G1 X104.620 Y108.869 E0.36315
+G1 X104.531 Y108.915 E0.36648
+G1 X104.442 Y108.959 E0.36982
+G1 X104.352 Y109.003 E0.37315
+G1 X104.261 Y109.047 E0.37648
+G1 X104.171 Y109.089 E0.37981
+G1 X104.080 Y109.130 E0.38314
+G1 X103.988 Y109.170 E0.38647
+G1 X103.896 Y109.210 E0.38981
+G1 X103.804 Y109.248 E0.39314
+G1 X103.711 Y109.286 E0.39647
+G1 X103.618 Y109.323 E0.39980
+G1 X103.524 Y109.358 E0.40313
+G1 X103.431 Y109.393 E0.40646
+G1 X103.336 Y109.427 E0.40980
+G1 X103.242 Y109.460 E0.41313
+G1 X103.147 Y109.492 E0.41646
+G1 X103.052 Y109.523 E0.41979
+G1 X102.957 Y109.553 E0.42312
+G1 X102.861 Y109.582 E0.42645
+G1 X102.765 Y109.610 E0.42979
+G1 X102.669 Y109.637 E0.43312
+G1 X102.572 Y109.664 E0.43645
+G1 X102.475 Y109.689 E0.43978
+G1 X102.378 Y109.713 E0.44311
+G1 X102.281 Y109.736 E0.44644
+G1 X102.183 Y109.759 E0.44978
+G1 X102.086 Y109.780 E0.45311
+G1 X101.988 Y109.800 E0.45644
+G1 X101.890 Y109.820 E0.45977
+G1 X101.791 Y109.838 E0.46310
+G1 X101.693 Y109.856 E0.46643
+G1 X101.594 Y109.872 E0.46977
+G1 X101.495 Y109.888 E0.47310
+G1 X101.396 Y109.902 E0.47643
+G1 X101.297 Y109.916 E0.47976
+G1 X101.198 Y109.928 E0.48309
+G1 X101.098 Y109.939 E0.48642
+G1 X100.999 Y109.950 E0.48976
+G1 X100.899 Y109.959 E0.49309
+G1 X100.800 Y109.968 E0.49642
+G1 X100.700 Y109.975 E0.49975
+G1 X100.600 Y109.982 E0.50308
+G1 X100.500 Y109.987 E0.50641
+G1 X100.400 Y109.992 E0.50975
+G1 X100.300 Y109.995 E0.51308
+G1 X100.200 Y109.998 E0.51641
+G1 X100.100 Y109.999 E0.51974
+G1 X100.000 Y110.000 E0.52307
+G1 X99.900 Y109.999 E0.52640
+G1 X99.800 Y109.998 E0.52974
+G1 X99.700 Y109.995 E0.53307
+G1 X99.600 Y109.992 E0.53640
+G1 X99.500 Y109.987 E0.53973
+G1 X99.400 Y109.982 E0.54306
+G1 X99.300 Y109.975 E0.54639
+G1 X99.200 Y109.968 E0.54973
+G1 X99.101 Y109.959 E0.55306
+G1 X99.001 Y109.950 E0.55639
+G1 X98.902 Y109.939 E0.55972
+G1 X98.802 Y109.928 E0.56305
+G1 X98.703 Y109.916 E0.56638
+G1 X98.604 Y109.902 E0.56972
+G1 X98.505 Y109.888 E0.57305
+G1 X98.406 Y109.872 E0.57638
+G1 X98.307 Y109.856 E0.57971
+G1 X98.209 Y109.838 E0.58304
+G1 X98.110 Y109.820 E0.58637
+G1 X98.012 Y109.800 E0.58971
+G1 X97.914 Y109.780 E0.59304
+G1 X97.817 Y109.759 E0.59637
+G1 X97.719 Y109.736 E0.59970
+G1 X97.622 Y109.713 E0.60303
+G1 X97.525 Y109.689 E0.60636
+G1 X97.428 Y109.664 E0.60970
+G1 X97.331 Y109.637 E0.61303
+G1 X97.235 Y109.610 E0.61636
+G1 X97.139 Y109.582 E0.61969
+G1 X97.043 Y109.553 E0.62302
+G1 X96.948 Y109.523 E0.62635
+G1 X96.853 Y109.492 E0.62969
+G1 X96.758 Y109.460 E0.63302
+G1 X96.664 Y109.427 E0.63635
+G1 X96.569 Y109.393 E0.63968
+G1 X96.476 Y109.358 E0.64301
+G1 X96.382 Y109.323 E0.64634
+G1 X96.289 Y109.286 E0.64968
+G1 X96.196 Y109.248 E0.65301
+G1 X96.104 Y109.210 E0.65634
+G1 X96.012 Y109.170 E0.65967
+G1 X95.920 Y109.130 E0.66300
+G1 X95.829 Y109.089 E0.66634
+G1 X95.739 Y109.047 E0.66967
+G1 X95.648 Y109.003 E0.67300
+G1 X95.558 Y108.959 E0.67633
+G1 X95.469 Y108.915 E0.67966
+G1 X95.380 Y108.869 E0.68299
+G1 X95.292 Y108.822 E0.68633
+G1 X95.204 Y108.775 E0.68966
+G1 X95.116 Y108.726 E0.69299
+G1 X95.029 Y108.677 E0.69632
+G1 X94.942 Y108.627 E0.69965
+G1 X94.856 Y108.576 E0.70298
+G1 X94.771 Y108.524 E0.70632
+G1 X94.686 Y108.471 E0.70965
+G1 X94.601 Y108.417 E0.71298
+G1 X94.517 Y108.363 E0.71631
+G1 X94.434 Y108.308 E0.71964
+G1 X94.351 Y108.252 E0.72297
+G1 X94.269 Y108.195 E0.72631
+G1 X94.187 Y108.137 E0.72964
+G1 X94.106 Y108.078 E0.73297
+G1 X94.025 Y108.019 E0.73630
+G1 X93.946 Y107.959 E0.73963
+G1 X93.866 Y107.898 E0.74296
+G1 X93.787 Y107.836 E0.74630
+G1 X93.709 Y107.774 E0.74963
+G1 X93.632 Y107.710 E0.75296
+G1 X93.555 Y107.646 E0.75629
+G1 X93.479 Y107.581 E0.75962
+G1 X93.403 Y107.516 E0.76295
+G1 X93.329 Y107.449 E0.76629
+G1 X93.254 Y107.382 E0.76962
+G1 X93.181 Y107.314 E0.77295
+G1 X93.108 Y107.246 E0.77628
+G1 X93.036 Y107.176 E0.77961
+G1 X92.964 Y107.106 E0.78294
+G1 X92.894 Y107.036 E0.78628
+G1 X92.824 Y106.964 E0.78961
+G1 X92.754 Y106.892 E0.79294
+G1 X92.686 Y106.819 E0.79627
+G1 X92.618 Y106.746 E0.79960
+G1 X92.551 Y106.671 E0.80293
+G1 X92.484 Y106.597 E0.80627
+G1 X92.419 Y106.521 E0.80960
+G1 X92.354 Y106.445 E0.81293
+G1 X92.290 Y106.368 E0.81626
+G1 X92.226 Y106.291 E0.81959
+G1 X92.164 Y106.213 E0.82292
+G1 X92.102 Y106.134 E0.82626
+G1 X92.041 Y106.054 E0.82959
+G1 X91.981 Y105.975 E0.83292
+G1 X91.922 Y105.894 E0.83625
+G1 X91.863 Y105.813 E0.83958
+G1 X91.805 Y105.731 E0.84291
+G1 X91.748 Y105.649 E0.84625
+G1 X91.692 Y105.566 E0.84958
+G1 X91.637 Y105.483 E0.85291
+G1 X91.583 Y105.399 E0.85624
+G1 X91.529 Y105.314 E0.85957
+G1 X91.476 Y105.229 E0.86290
+G1 X91.424 Y105.144 E0.86624
+G1 X91.373 Y105.058 E0.86957
+G1 X91.323 Y104.971 E0.87290
+G1 X91.274 Y104.884 E0.87623
+G1 X91.225 Y104.796 E0.87956
+G1 X91.178 Y104.708 E0.88289
+G1 X91.131 Y104.620 E0.88623
+G1 X91.085 Y104.531 E0.88956
+G1 X91.041 Y104.442 E0.89289
+G1 X90.997 Y104.352 E0.89622
+G1 X90.953 Y104.261 E0.89955
+G1 X90.911 Y104.171 E0.90288
+G1 X90.870 Y104.080 E0.90622
+G1 X90.830 Y103.988 E0.90955
+G1 X90.790 Y103.896 E0.91288
+G1 X90.752 Y103.804 E0.91621
+G1 X90.714 Y103.711 E0.91954
+G1 X90.677 Y103.618 E0.92287
+G1 X90.642 Y103.524 E0.92621
+G1 X90.607 Y103.431 E0.92954
+G1 X90.573 Y103.336 E0.93287
+G1 X90.540 Y103.242 E0.93620
+G1 X90.508 Y103.147 E0.93953
+G1 X90.477 Y103.052 E0.94286
+G1 X90.447 Y102.957 E0.94620
+G1 X90.418 Y102.861 E0.94953
+G1 X90.390 Y102.765 E0.95286
+G1 X90.363 Y102.669 E0.95619
+G1 X90.336 Y102.572 E0.95952
+G1 X90.311 Y102.475 E0.96285
+G1 X90.287 Y102.378 E0.96619
+G1 X90.264 Y102.281 E0.96952
+G1 X90.241 Y102.183 E0.97285
+G1 X90.220 Y102.086 E0.97618
+G1 X90.200 Y101.988 E0.97951
+G1 X90.180 Y101.890 E0.98284
+G1 X90.162 Y101.791 E0.98618
+G1 X90.144 Y101.693 E0.98951
+G1 X90.128 Y101.594 E0.99284
+G1 X90.112 Y101.495 E0.99617
+G1 X90.098 Y101.396 E0.99950
+G1 X90.084 Y101.297 E1.00283
+G1 X90.072 Y101.198 E1.00617
+G1 X90.061 Y101.098 E1.00950
+G1 X90.050 Y100.999 E1.01283
+G1 X90.041 Y100.899 E1.01616
+G1 X90.032 Y100.800 E1.01949
+G1 X90.025 Y100.700 E1.02282
+G1 X90.018 Y100.600 E1.02616
+G1 X90.013 Y100.500 E1.02949
+G1 X90.008 Y100.400 E1.03282
+G1 X90.005 Y100.300 E1.03615
+G1 X90.002 Y100.200 E1.03948
+G1 X90.001 Y100.100 E1.04281
+G1 X90.000 Y100.000 E1.04615
+G1 X90.001 Y99.900 E1.04948
+G1 X90.002 Y99.800 E1.05281
+G1 X90.005 Y99.700 E1.05614
+G1 X90.008 Y99.600 E1.05947
+G1 X90.013 Y99.500 E1.06280
+G1 X90.018 Y99.400 E1.06614
+G1 X90.025 Y99.300 E1.06947
+G1 X90.032 Y99.200 E1.07280
+G1 X90.041 Y99.101 E1.07613
+G1 X90.050 Y99.001 E1.07946
+G1 X90.061 Y98.902 E1.08279
+G1 X90.072 Y98.802 E1.08613
+G1 X90.084 Y98.703 E1.08946
+G1 X90.098 Y98.604 E1.09279
+G1 X90.112 Y98.505 E1.09612
+G1 X90.128 Y98.406 E1.09945
+G1 X90.144 Y98.307 E1.10278
+G1 X90.162 Y98.209 E1.10612
+G1 X90.180 Y98.110 E1.10945
+G1 X90.200 Y98.012 E1.11278
+G1 X90.220 Y97.914 E1.11611
+G1 X90.241 Y97.817 E1.11944
+G1 X90.264 Y97.719 E1.12277
+G1 X90.287 Y97.622 E1.12611
+G1 X90.311 Y97.525 E1.12944
+G1 X90.336 Y97.428 E1.13277
+G1 X90.363 Y97.331 E1.13610
+G1 X90.390 Y97.235 E1.13943
+G1 X90.418 Y97.139 E1.14276
+G1 X90.447 Y97.043 E1.14610
+G1 X90.477 Y96.948 E1.14943
+G1 X90.508 Y96.853 E1.15276
+G1 X90.540 Y96.758 E1.15609
+G1 X90.573 Y96.664 E1.15942
+G1 X90.607 Y96.569 E1.16275
+G1 X90.642 Y96.476 E1.16609
+G1 X90.677 Y96.382 E1.16942
+G1 X90.714 Y96.289 E1.17275
+G1 X90.752 Y96.196 E1.17608
+G1 X90.790 Y96.104 E1.17941
+G1 X90.830 Y96.012 E1.18274
+G1 X90.870 Y95.920 E1.18608
+G1 X90.911 Y95.829 E1.18941
+G1 X90.953 Y95.739 E1.19274
+G1 X90.997 Y95.648 E1.19607
+G1 X91.041 Y95.558 E1.19940
+G1 X91.085 Y95.469 E1.20273
+G1 X91.131 Y95.380 E1.20607
+G1 X91.178 Y95.292 E1.20940
+G1 X91.225 Y95.204 E1.21273
+G1 X91.274 Y95.116 E1.21606
+G1 X91.323 Y95.029 E1.21939
+G1 X91.373 Y94.942 E1.22272
+G1 X91.424 Y94.856 E1.22606
+G1 X91.476 Y94.771 E1.22939
+G1 X91.529 Y94.686 E1.23272
+G1 X91.583 Y94.601 E1.23605
+G1 X91.637 Y94.517 E1.23938
+G1 X91.692 Y94.434 E1.24271
+G1 X91.748 Y94.351 E1.24605
+G1 X91.805 Y94.269 E1.24938
+G1 X91.863 Y94.187 E1.25271
+G1 X91.922 Y94.106 E1.25604
+G1 X91.981 Y94.025 E1.25937
+G1 X92.041 Y93.946 E1.26270
+G1 X92.102 Y93.866 E1.26604
+G1 X92.164 Y93.787 E1.26937
+G1 X92.226 Y93.709 E1.27270
+G1 X92.290 Y93.632 E1.27603
+G1 X92.354 Y93.555 E1.27936
+G1 X92.419 Y93.479 E1.28269
+G1 X92.484 Y93.403 E1.28603
+G1 X92.551 Y93.329 E1.28936
+G1 X92.618 Y93.254 E1.29269
+G1 X92.686 Y93.181 E1.29602
+G1 X92.754 Y93.108 E1.29935
+G1 X92.824 Y93.036 E1.30268
+G1 X92.894 Y92.964 E1.30602
+G1 X92.964 Y92.894 E1.30935
+G1 X93.036 Y92.824 E1.31268
+G1 X93.108 Y92.754 E1.31601
+G1 X93.181 Y92.686 E1.31934
+G1 X93.254 Y92.618 E1.32268
+G1 X93.329 Y92.551 E1.32601
+G1 X93.403 Y92.484 E1.32934
+G1 X93.479 Y92.419 E1.33267
+G1 X93.555 Y92.354 E1.33600
+G1 X93.632 Y92.290 E1.33933
+G1 X93.709 Y92.226 E1.34267
+G1 X93.787 Y92.164 E1.34600
+G1 X93.866 Y92.102 E1.34933
+G1 X93.946 Y92.041 E1.35266
+G1 X94.025 Y91.981 E1.35599
+G1 X94.106 Y91.922 E1.35932
+G1 X94.187 Y91.863 E1.36266
+G1 X94.269 Y91.805 E1.36599
+G1 X94.351 Y91.748 E1.36932
+G1 X94.434 Y91.692 E1.37265
+G1 X94.517 Y91.637 E1.37598
+G1 X94.601 Y91.583 E1.37931
+G1 X94.686 Y91.529 E1.38265
+G1 X94.771 Y91.476 E1.38598
+G1 X94.856 Y91.424 E1.38931
+G1 X94.942 Y91.373 E1.39264
+G1 X95.029 Y91.323 E1.39597
+G1 X95.116 Y91.274 E1.39930
+G1 X95.204 Y91.225 E1.40264
+G1 X95.292 Y91.178 E1.40597
+G1 X95.380 Y91.131 E1.40930
+G1 X95.469 Y91.085 E1.41263
+G1 X95.558 Y91.041 E1.41596
+G1 X95.648 Y90.997 E1.41929
+G1 X95.739 Y90.953 E1.42263
+G1 X95.829 Y90.911 E1.42596
+G1 X95.920 Y90.870 E1.42929
+G1 X96.012 Y90.830 E1.43262
+G1 X96.104 Y90.790 E1.43595
+G1 X96.196 Y90.752 E1.43928
+G1 X96.289 Y90.714 E1.44262
+G1 X96.382 Y90.677 E1.44595
+G1 X96.476 Y90.642 E1.44928
+G1 X96.569 Y90.607 E1.45261
+G1 X96.664 Y90.573 E1.45594
+G1 X96.758 Y90.540 E1.45927
+G1 X96.853 Y90.508 E1.46261
+G1 X96.948 Y90.477 E1.46594
+G1 X97.043 Y90.447 E1.46927
+G1 X97.139 Y90.418 E1.47260
+G1 X97.235 Y90.390 E1.47593
+G1 X97.331 Y90.363 E1.47926
+G1 X97.428 Y90.336 E1.48260
+G1 X97.525 Y90.311 E1.48593
+G1 X97.622 Y90.287 E1.48926
+G1 X97.719 Y90.264 E1.49259
+G1 X97.817 Y90.241 E1.49592
+G1 X97.914 Y90.220 E1.49925
+G1 X98.012 Y90.200 E1.50259
+G1 X98.110 Y90.180 E1.50592
+G1 X98.209 Y90.162 E1.50925
+G1 X98.307 Y90.144 E1.51258
+G1 X98.406 Y90.128 E1.51591
+G1 X98.505 Y90.112 E1.51924
+G1 X98.604 Y90.098 E1.52258
+G1 X98.703 Y90.084 E1.52591
+G1 X98.802 Y90.072 E1.52924
+G1 X98.902 Y90.061 E1.53257
+G1 X99.001 Y90.050 E1.53590
+G1 X99.101 Y90.041 E1.53923
+G1 X99.200 Y90.032 E1.54257
+G1 X99.300 Y90.025 E1.54590
+G1 X99.400 Y90.018 E1.54923
+G1 X99.500 Y90.013 E1.55256
+G1 X99.600 Y90.008 E1.55589
+G1 X99.700 Y90.005 E1.55922
+G1 X99.800 Y90.002 E1.56256
+G1 X99.900 Y90.001 E1.56589
+G1 X100.000 Y90.000 E1.56922
+G1 X100.100 Y90.001 E1.57255
+G1 X100.200 Y90.002 E1.57588
+G1 X100.300 Y90.005 E1.57921
+G1 X100.400 Y90.008 E1.58255
+G1 X100.500 Y90.013 E1.58588
+G1 X100.600 Y90.018 E1.58921
+G1 X100.700 Y90.025 E1.59254
+G1 X100.800 Y90.032 E1.59587
+G1 X100.899 Y90.041 E1.59920
+G1 X100.999 Y90.050 E1.60254
+G1 X101.098 Y90.061 E1.60587
+G1 X101.198 Y90.072 E1.60920
+G1 X101.297 Y90.084 E1.61253
+G1 X101.396 Y90.098 E1.61586
+G1 X101.495 Y90.112 E1.61919
+G1 X101.594 Y90.128 E1.62253
+G1 X101.693 Y90.144 E1.62586
+G1 X101.791 Y90.162 E1.62919
+G1 X101.890 Y90.180 E1.63252
+G1 X101.988 Y90.200 E1.63585
+G1 X102.086 Y90.220 E1.63918
+G1 X102.183 Y90.241 E1.64252
+G1 X102.281 Y90.264 E1.64585
+G1 X102.378 Y90.287 E1.64918
+G1 X102.475 Y90.311 E1.65251
+G1 X102.572 Y90.336 E1.65584
+G1 X102.669 Y90.363 E1.65917
+G1 X102.765 Y90.390 E1.66251
+G1 X102.861 Y90.418 E1.66584
+G1 X102.957 Y90.447 E1.66917
+G1 X103.052 Y90.477 E1.67250
+G1 X103.147 Y90.508 E1.67583
+G1 X103.242 Y90.540 E1.67916
+G1 X103.336 Y90.573 E1.68250
+G1 X103.431 Y90.607 E1.68583
+G1 X103.524 Y90.642 E1.68916
+G1 X103.618 Y90.677 E1.69249
+G1 X103.711 Y90.714 E1.69582
+G1 X103.804 Y90.752 E1.69915
+G1 X103.896 Y90.790 E1.70249
+G1 X103.988 Y90.830 E1.70582
+G1 X104.080 Y90.870 E1.70915
+G1 X104.171 Y90.911 E1.71248
+G1 X104.261 Y90.953 E1.71581
+G1 X104.352 Y90.997 E1.71914
+G1 X104.442 Y91.041 E1.72248
+G1 X104.531 Y91.085 E1.72581
+G1 X104.620 Y91.131 E1.72914
+G1 X104.708 Y91.178 E1.73247
+G1 X104.796 Y91.225 E1.73580
+G1 X104.884 Y91.274 E1.73913
+G1 X104.971 Y91.323 E1.74247
+G1 X105.058 Y91.373 E1.74580
+G1 X105.144 Y91.424 E1.74913
+G1 X105.229 Y91.476 E1.75246
+G1 X105.314 Y91.529 E1.75579
+G1 X105.399 Y91.583 E1.75912
+G1 X105.483 Y91.637 E1.76246
+G1 X105.566 Y91.692 E1.76579
+G1 X105.649 Y91.748 E1.76912
+G1 X105.731 Y91.805 E1.77245
+G1 X105.813 Y91.863 E1.77578
+G1 X105.894 Y91.922 E1.77911
+G1 X105.975 Y91.981 E1.78245
+G1 X106.054 Y92.041 E1.78578
+G1 X106.134 Y92.102 E1.78911
+G1 X106.213 Y92.164 E1.79244
+G1 X106.291 Y92.226 E1.79577
+G1 X106.368 Y92.290 E1.79910
+G1 X106.445 Y92.354 E1.80244
+G1 X106.521 Y92.419 E1.80577
+G1 X106.597 Y92.484 E1.80910
+G1 X106.671 Y92.551 E1.81243
+G1 X106.746 Y92.618 E1.81576
+G1 X106.819 Y92.686 E1.81909
+G1 X106.892 Y92.754 E1.82243
+G1 X106.964 Y92.824 E1.82576
+G1 X107.036 Y92.894 E1.82909
+G1 X107.106 Y92.964 E1.83242
+G1 X107.176 Y93.036 E1.83575
+G1 X107.246 Y93.108 E1.83908
+G1 X107.314 Y93.181 E1.84242
+G1 X107.382 Y93.254 E1.84575
+G1 X107.449 Y93.329 E1.84908
+G1 X107.516 Y93.403 E1.85241
+G1 X107.581 Y93.479 E1.85574
+G1 X107.646 Y93.555 E1.85907
+G1 X107.710 Y93.632 E1.86241
+G1 X107.774 Y93.709 E1.86574
+G1 X107.836 Y93.787 E1.86907
+G1 X107.898 Y93.866 E1.87240
+G1 X107.959 Y93.946 E1.87573
+G1 X108.019 Y94.025 E1.87906
+G1 X108.078 Y94.106 E1.88240
+G1 X108.137 Y94.187 E1.88573
+G1 X108.195 Y94.269 E1.88906
+G1 X108.252 Y94.351 E1.89239
+G1 X108.308 Y94.434 E1.89572
+G1 X108.363 Y94.517 E1.89905
+G1 X108.417 Y94.601 E1.90239
+G1 X108.471 Y94.686 E1.90572
+G1 X108.524 Y94.771 E1.90905
+G1 X108.576 Y94.856 E1.91238
+G1 X108.627 Y94.942 E1.91571
+G1 X108.677 Y95.029 E1.91904
+G1 X108.726 Y95.116 E1.92238
+G1 X108.775 Y95.204 E1.92571
+G1 X108.822 Y95.292 E1.92904
+G1 X108.869 Y95.380 E1.93237
+G1 X108.915 Y95.469 E1.93570
+G1 X108.959 Y95.558 E1.93903
+G1 X109.003 Y95.648 E1.94237
+G1 X109.047 Y95.739 E1.94570
+G1 X109.089 Y95.829 E1.94903
+G1 X109.130 Y95.920 E1.95236
+G1 X109.170 Y96.012 E1.95569
+G1 X109.210 Y96.104 E1.95902
+G1 X109.248 Y96.196 E1.96236
+G1 X109.286 Y96.289 E1.96569
+G1 X109.323 Y96.382 E1.96902
+G1 X109.358 Y96.476 E1.97235
+G1 X109.393 Y96.569 E1.97568
+G1 X109.427 Y96.664 E1.97902
+G1 X109.460 Y96.758 E1.98235
+G1 X109.492 Y96.853 E1.98568
+G1 X109.523 Y96.948 E1.98901
+G1 X109.553 Y97.043 E1.99234
+G1 X109.582 Y97.139 E1.99567
+G1 X109.610 Y97.235 E1.99901
+G1 X109.637 Y97.331 E2.00234
+G1 X109.664 Y97.428 E2.00567
+G1 X109.689 Y97.525 E2.00900
+G1 X109.713 Y97.622 E2.01233
+G1 X109.736 Y97.719 E2.01566
+G1 X109.759 Y97.817 E2.01900
+G1 X109.780 Y97.914 E2.02233
+G1 X109.800 Y98.012 E2.02566
+G1 X109.820 Y98.110 E2.02899
+G1 X109.838 Y98.209 E2.03232
+G1 X109.856 Y98.307 E2.03565
+G1 X109.872 Y98.406 E2.03899
+G1 X109.888 Y98.505 E2.04232
+G1 X109.902 Y98.604 E2.04565
+G1 X109.916 Y98.703 E2.04898
+G1 X109.928 Y98.802 E2.05231
+G1 X109.939 Y98.902 E2.05564
+G1 X109.950 Y99.001 E2.05898
+G1 X109.959 Y99.101 E2.06231
+G1 X109.968 Y99.200 E2.06564
+G1 X109.975 Y99.300 E2.06897
+G1 X109.982 Y99.400 E2.07230
+G1 X109.987 Y99.500 E2.07563
+G1 X109.992 Y99.600 E2.07897
+G1 X109.995 Y99.700 E2.08230
+G1 X109.998 Y99.800 E2.08563
+G1 X109.999 Y99.900 E2.08896
+G1 X110.000 Y100.000 E2.09229
+G1 X109.999 Y100.100 E2.09562
+G1 X109.998 Y100.200 E2.09896
+G1 X109.995 Y100.300 E2.10229
+G1 X109.992 Y100.400 E2.10562
+G1 X109.987 Y100.500 E2.10895
+G1 X109.982 Y100.600 E2.11228
+G1 X109.975 Y100.700 E2.11561
+G1 X109.968 Y100.800 E2.11895
+G1 X109.959 Y100.899 E2.12228
+G1 X109.950 Y100.999 E2.12561
+G1 X109.939 Y101.098 E2.12894
+G1 X109.928 Y101.198 E2.13227
+G1 X109.916 Y101.297 E2.13560
+G1 X109.902 Y101.396 E2.13894
+G1 X109.888 Y101.495 E2.14227
+G1 X109.872 Y101.594 E2.14560
+G1 X109.856 Y101.693 E2.14893
+G1 X109.838 Y101.791 E2.15226
+G1 X109.820 Y101.890 E2.15559
+G1 X109.800 Y101.988 E2.15893
+G1 X109.780 Y102.086 E2.16226
+G1 X109.759 Y102.183 E2.16559
+G1 X109.736 Y102.281 E2.16892
+G1 X109.713 Y102.378 E2.17225
+G1 X109.689 Y102.475 E2.17558
+G1 X109.664 Y102.572 E2.17892
+G1 X109.637 Y102.669 E2.18225
+G1 X109.610 Y102.765 E2.18558
+G1 X109.582 Y102.861 E2.18891
+G1 X109.553 Y102.957 E2.19224
+G1 X109.523 Y103.052 E2.19557
+G1 X109.492 Y103.147 E2.19891
+G1 X109.460 Y103.242 E2.20224
+G1 X109.427 Y103.336 E2.20557
+G1 X109.393 Y103.431 E2.20890
+G1 X109.358 Y103.524 E2.21223
+G1 X109.323 Y103.618 E2.21556
+G1 X109.286 Y103.711 E2.21890
+G1 X109.248 Y103.804 E2.22223
+G1 X109.210 Y103.896 E2.22556
+G1 X109.170 Y103.988 E2.22889
+G1 X109.130 Y104.080 E2.23222
+G1 X109.089 Y104.171 E2.23555
+G1 X109.047 Y104.261 E2.23889
+G1 X109.003 Y104.352 E2.24222
+G1 X108.959 Y104.442 E2.24555
+G1 X108.915 Y104.531 E2.24888
+G1 X108.869 Y104.620 E2.25221
+G1 X108.822 Y104.708 E2.25554
+G1 X108.775 Y104.796 E2.25888
+G1 X108.726 Y104.884 E2.26221
+G1 X108.677 Y104.971 E2.26554
+G1 X108.627 Y105.058 E2.26887
+G1 X108.576 Y105.144 E2.27220
+G1 X108.524 Y105.229 E2.27553
+G1 X108.471 Y105.314 E2.27887
+G1 X108.417 Y105.399 E2.28220
+G1 X108.363 Y105.483 E2.28553
+G1 X108.308 Y105.566 E2.28886
+G1 X108.252 Y105.649 E2.29219
+G1 X108.195 Y105.731 E2.29552
+G1 X108.137 Y105.813 E2.29886
+G1 X108.078 Y105.894 E2.30219
+G1 X108.019 Y105.975 E2.30552
+G1 X107.959 Y106.054 E2.30885
+G1 X107.898 Y106.134 E2.31218
+G1 X107.836 Y106.213 E2.31551
+G1 X107.774 Y106.291 E2.31885
+G1 X107.710 Y106.368 E2.32218
+G1 X107.646 Y106.445 E2.32551
+G1 X107.581 Y106.521 E2.32884
+G1 X107.516 Y106.597 E2.33217
+G1 X107.449 Y106.671 E2.33550
+G1 X107.382 Y106.746 E2.33884
+G1 X107.314 Y106.819 E2.34217
+G1 X107.246 Y106.892 E2.34550
+G1 X107.176 Y106.964 E2.34883
+G1 X107.106 Y107.036 E2.35216
+G1 X107.036 Y107.106 E2.35549
+G1 X106.964 Y107.176 E2.35883
+G1 X106.892 Y107.246 E2.36216
+G1 X106.819 Y107.314 E2.36549
+G1 X106.746 Y107.382 E2.36882
+G1 X106.671 Y107.449 E2.37215
+G1 X106.597 Y107.516 E2.37548
+G1 X106.521 Y107.581 E2.37882
+G1 X106.445 Y107.646 E2.38215
+G1 X106.368 Y107.710 E2.38548
+G1 X106.291 Y107.774 E2.38881
+G1 X106.213 Y107.836 E2.39214
+G1 X106.134 Y107.898 E2.39547
+G1 X106.054 Y107.959 E2.39881
+G1 X105.975 Y108.019 E2.40214
+G1 X105.894 Y108.078 E2.40547
+G1 X105.813 Y108.137 E2.40880
+G1 X105.731 Y108.195 E2.41213
+G1 X105.649 Y108.252 E2.41546
+G1 X105.566 Y108.308 E2.41880
+G1 X105.483 Y108.363 E2.42213
+G1 X105.399 Y108.417 E2.42546
+G1 X105.314 Y108.471 E2.42879
+G1 X105.229 Y108.524 E2.43212
+G1 X105.144 Y108.576 E2.43545
+G1 X105.058 Y108.627 E2.43879
+G1 X104.971 Y108.677 E2.44212
+G1 X104.884 Y108.726 E2.44545
+G1 X104.796 Y108.775 E2.44878
+G1 X104.708 Y108.822 E2.45211
+G1 X104.620 Y108.869 E2.45544
+G1 X104.531 Y108.915 E2.45878
+G1 X104.442 Y108.959 E2.46211
+G1 X104.352 Y109.003 E2.46544
+G1 X104.261 Y109.047 E2.46877
+G1 X104.171 Y109.089 E2.47210
+G1 X104.080 Y109.130 E2.47543
+G1 X103.988 Y109.170 E2.47877
+G1 X103.896 Y109.210 E2.48210
+G1 X103.804 Y109.248 E2.48543
+G1 X103.711 Y109.286 E2.48876
+G1 X103.618 Y109.323 E2.49209
+G1 X103.524 Y109.358 E2.49542
+G1 X103.431 Y109.393 E2.49876
+G1 X103.336 Y109.427 E2.50209
+G1 X103.242 Y109.460 E2.50542
+G1 X103.147 Y109.492 E2.50875
+G1 X103.052 Y109.523 E2.51208
+G1 X102.957 Y109.553 E2.51541
+G1 X102.861 Y109.582 E2.51875
+G1 X102.765 Y109.610 E2.52208
+G1 X102.669 Y109.637 E2.52541
+G1 X102.572 Y109.664 E2.52874
+G1 X102.475 Y109.689 E2.53207
+G1 X102.378 Y109.713 E2.53540
+G1 X102.281 Y109.736 E2.53874
+G1 X102.183 Y109.759 E2.54207
+G1 X102.086 Y109.780 E2.54540
+G1 X101.988 Y109.800 E2.54873
+G1 X101.890 Y109.820 E2.55206
+G1 X101.791 Y109.838 E2.55539
+G1 X101.693 Y109.856 E2.55873
+G1 X101.594 Y109.872 E2.56206
+G1 X101.495 Y109.888 E2.56539
+G1 X101.396 Y109.902 E2.56872
+G1 X101.297 Y109.916 E2.57205
+G1 X101.198 Y109.928 E2.57538
+G1 X101.098 Y109.939 E2.57872
+G1 X100.999 Y109.950 E2.58205
+G1 X100.899 Y109.959 E2.58538
+G1 X100.800 Y109.968 E2.58871
+G1 X100.700 Y109.975 E2.59204
+G1 X100.600 Y109.982 E2.59537
+G1 X100.500 Y109.987 E2.59871
+G1 X100.400 Y109.992 E2.60204
+G1 X100.300 Y109.995 E2.60537
+G1 X100.200 Y109.998 E2.60870
+G1 X100.100 Y109.999 E2.61203
+G1 X100.000 Y110.000 E2.61536
+G1 X99.900 Y109.999 E2.61870
+G1 X99.800 Y109.998 E2.62203
+G1 X99.700 Y109.995 E2.62536
+G1 X99.600 Y109.992 E2.62869
+G1 X99.500 Y109.987 E2.63202
+G1 X99.400 Y109.982 E2.63536
+G1 X99.300 Y109.975 E2.63869
+G1 X99.200 Y109.968 E2.64202
+G1 X99.101 Y109.959 E2.64535
+G1 X99.001 Y109.950 E2.64868
+G1 X98.902 Y109.939 E2.65201
+G1 X98.802 Y109.928 E2.65535
+G1 X98.703 Y109.916 E2.65868
+G1 X98.604 Y109.902 E2.66201
+G1 X98.505 Y109.888 E2.66534
+G1 X98.406 Y109.872 E2.66867
+G1 X98.307 Y109.856 E2.67200
+G1 X98.209 Y109.838 E2.67534
+G1 X98.110 Y109.820 E2.67867
+G1 X98.012 Y109.800 E2.68200
+G1 X97.914 Y109.780 E2.68533
+G1 X97.817 Y109.759 E2.68866
+G1 X97.719 Y109.736 E2.69199
+G1 X97.622 Y109.713 E2.69533
+G1 X97.525 Y109.689 E2.69866
+G1 X97.428 Y109.664 E2.70199
+G1 X97.331 Y109.637 E2.70532
+G1 X97.235 Y109.610 E2.70865
+G1 X97.139 Y109.582 E2.71198
+G1 X97.043 Y109.553 E2.71532
+G1 X96.948 Y109.523 E2.71865
+G1 X96.853 Y109.492 E2.72198
+G1 X96.758 Y109.460 E2.72531
+G1 X96.664 Y109.427 E2.72864
+G1 X96.569 Y109.393 E2.73197
+G1 X96.476 Y109.358 E2.73531
+G1 X96.382 Y109.323 E2.73864
+G1 X96.289 Y109.286 E2.74197
+G1 X96.196 Y109.248 E2.74530
+G1 X96.104 Y109.210 E2.74863
+G1 X96.012 Y109.170 E2.75196
+G1 X95.920 Y109.130 E2.75530
+G1 X95.829 Y109.089 E2.75863
+G1 X95.739 Y109.047 E2.76196
+G1 X95.648 Y109.003 E2.76529
+G1 X95.558 Y108.959 E2.76862
+G1 X95.469 Y108.915 E2.77195
+G1 X95.380 Y108.869 E2.77529
+G1 X95.292 Y108.822 E2.77862
+G1 X95.204 Y108.775 E2.78195
+G1 X95.116 Y108.726 E2.78528
+G1 X95.029 Y108.677 E2.78861
+G1 X94.942 Y108.627 E2.79194
+G1 X94.856 Y108.576 E2.79528
+G1 X94.771 Y108.524 E2.79861
+G1 X94.686 Y108.471 E2.80194
+G1 X94.601 Y108.417 E2.80527
+G1 X94.517 Y108.363 E2.80860
+G1 X94.434 Y108.308 E2.81193
+G1 X94.351 Y108.252 E2.81527
+G1 X94.269 Y108.195 E2.81860
+G1 X94.187 Y108.137 E2.82193
+G1 X94.106 Y108.078 E2.82526
+G1 X94.025 Y108.019 E2.82859
+G1 X93.946 Y107.959 E2.83192
+G1 X93.866 Y107.898 E2.83526
+G1 X93.787 Y107.836 E2.83859
+G1 X93.709 Y107.774 E2.84192
+G1 X93.632 Y107.710 E2.84525
+G1 X93.555 Y107.646 E2.84858
+G1 X93.479 Y107.581 E2.85191
+G1 X93.403 Y107.516 E2.85525
+G1 X93.329 Y107.449 E2.85858
+G1 X93.254 Y107.382 E2.86191
+G1 X93.181 Y107.314 E2.86524
+G1 X93.108 Y107.246 E2.86857
+G1 X93.036 Y107.176 E2.87190
+G1 X92.964 Y107.106 E2.87524
+G1 X92.894 Y107.036 E2.87857
+G1 X92.824 Y106.964 E2.88190
+G1 X92.754 Y106.892 E2.88523
+G1 X92.686 Y106.819 E2.88856
+G1 X92.618 Y106.746 E2.89189
+G1 X92.551 Y106.671 E2.89523
+G1 X92.484 Y106.597 E2.89856
+G1 X92.419 Y106.521 E2.90189
+G1 X92.354 Y106.445 E2.90522
+G1 X92.290 Y106.368 E2.90855
+G1 X92.226 Y106.291 E2.91188
+G1 X92.164 Y106.213 E2.91522
+G1 X92.102 Y106.134 E2.91855
+G1 X92.041 Y106.054 E2.92188
+G1 X91.981 Y105.975 E2.92521
+G1 X91.922 Y105.894 E2.92854
+G1 X91.863 Y105.813 E2.93187
+G1 X91.805 Y105.731 E2.93521
+G1 X91.748 Y105.649 E2.93854
+G1 X91.692 Y105.566 E2.94187
+G1 X91.637 Y105.483 E2.94520
+G1 X91.583 Y105.399 E2.94853
+G1 X91.529 Y105.314 E2.95186
+G1 X91.476 Y105.229 E2.95520
+G1 X91.424 Y105.144 E2.95853
+G1 X91.373 Y105.058 E2.96186
+G1 X91.323 Y104.971 E2.96519
+G1 X91.274 Y104.884 E2.96852
+G1 X91.225 Y104.796 E2.97185
+G1 X91.178 Y104.708 E2.97519
+G1 X91.131 Y104.620 E2.97852
+G1 X91.085 Y104.531 E2.98185
+G1 X91.041 Y104.442 E2.98518
+G1 X90.997 Y104.352 E2.98851
+G1 X90.953 Y104.261 E2.99184
+G1 X90.911 Y104.171 E2.99518
+G1 X90.870 Y104.080 E2.99851
+G1 X90.830 Y103.988 E3.00184
+G1 X90.790 Y103.896 E3.00517
+G1 X90.752 Y103.804 E3.00850
+G1 X90.714 Y103.711 E3.01183
+G1 X90.677 Y103.618 E3.01517
+G1 X90.642 Y103.524 E3.01850
+G1 X90.607 Y103.431 E3.02183
+G1 X90.573 Y103.336 E3.02516
+G1 X90.540 Y103.242 E3.02849
+G1 X90.508 Y103.147 E3.03182
+G1 X90.477 Y103.052 E3.03516
+G1 X90.447 Y102.957 E3.03849
+G1 X90.418 Y102.861 E3.04182
+G1 X90.390 Y102.765 E3.04515
+G1 X90.363 Y102.669 E3.04848
+G1 X90.336 Y102.572 E3.05181
+G1 X90.311 Y102.475 E3.05515
+G1 X90.287 Y102.378 E3.05848
+G1 X90.264 Y102.281 E3.06181
+G1 X90.241 Y102.183 E3.06514
+G1 X90.220 Y102.086 E3.06847
+G1 X90.200 Y101.988 E3.07180
+G1 X90.180 Y101.890 E3.07514
+G1 X90.162 Y101.791 E3.07847
+G1 X90.144 Y101.693 E3.08180
+G1 X90.128 Y101.594 E3.08513
+G1 X90.112 Y101.495 E3.08846
+G1 X90.098 Y101.396 E3.09179
+G1 X90.084 Y101.297 E3.09513
+G1 X90.072 Y101.198 E3.09846
+G1 X90.061 Y101.098 E3.10179
+G1 X90.050 Y100.999 E3.10512
+G1 X90.041 Y100.899 E3.10845
+G1 X90.032 Y100.800 E3.11178
+G1 X90.025 Y100.700 E3.11512
+G1 X90.018 Y100.600 E3.11845
+G1 X90.013 Y100.500 E3.12178
+G1 X90.008 Y100.400 E3.12511
+G1 X90.005 Y100.300 E3.12844
+G1 X90.002 Y100.200 E3.13177
+G1 X90.001 Y100.100 E3.13511
+G1 X90.000 Y100.000 E3.13844
+G1 X90.001 Y99.900 E3.14177
+G1 X90.002 Y99.800 E3.14510
+G1 X90.005 Y99.700 E3.14843
+G1 X90.008 Y99.600 E3.15176
+G1 X90.013 Y99.500 E3.15510
+G1 X90.018 Y99.400 E3.15843
+G1 X90.025 Y99.300 E3.16176
+G1 X90.032 Y99.200 E3.16509
+G1 X90.041 Y99.101 E3.16842
+G1 X90.050 Y99.001 E3.17175
+G1 X90.061 Y98.902 E3.17509
+G1 X90.072 Y98.802 E3.17842
+G1 X90.084 Y98.703 E3.18175
+G1 X90.098 Y98.604 E3.18508
+G1 X90.112 Y98.505 E3.18841
+G1 X90.128 Y98.406 E3.19174
+G1 X90.144 Y98.307 E3.19508
+G1 X90.162 Y98.209 E3.19841
+G1 X90.180 Y98.110 E3.20174
+G1 X90.200 Y98.012 E3.20507
+G1 X90.220 Y97.914 E3.20840
+G1 X90.241 Y97.817 E3.21173
+G1 X90.264 Y97.719 E3.21507
+G1 X90.287 Y97.622 E3.21840
+G1 X90.311 Y97.525 E3.22173
+G1 X90.336 Y97.428 E3.22506
+G1 X90.363 Y97.331 E3.22839
+G1 X90.390 Y97.235 E3.23172
+G1 X90.418 Y97.139 E3.23506
+G1 X90.447 Y97.043 E3.23839
+G1 X90.477 Y96.948 E3.24172
+G1 X90.508 Y96.853 E3.24505
+G1 X90.540 Y96.758 E3.24838
+G1 X90.573 Y96.664 E3.25171
+G1 X90.607 Y96.569 E3.25505
+G1 X90.642 Y96.476 E3.25838
+G1 X90.677 Y96.382 E3.26171
+G1 X90.714 Y96.289 E3.26504
+G1 X90.752 Y96.196 E3.26837
+G1 X90.790 Y96.104 E3.27170
+G1 X90.830 Y96.012 E3.27504
+G1 X90.870 Y95.920 E3.27837
+G1 X90.911 Y95.829 E3.28170
+G1 X90.953 Y95.739 E3.28503
+G1 X90.997 Y95.648 E3.28836
+G1 X91.041 Y95.558 E3.29170
+G1 X91.085 Y95.469 E3.29503
+G1 X91.131 Y95.380 E3.29836
+G1 X91.178 Y95.292 E3.30169
+G1 X91.225 Y95.204 E3.30502
+G1 X91.274 Y95.116 E3.30835
+G1 X91.323 Y95.029 E3.31169
+G1 X91.373 Y94.942 E3.31502
+G1 X91.424 Y94.856 E3.31835
+G1 X91.476 Y94.771 E3.32168
+G1 X91.529 Y94.686 E3.32501
+G1 X91.583 Y94.601 E3.32834
+G1 X91.637 Y94.517 E3.33168
+G1 X91.692 Y94.434 E3.33501
+G1 X91.748 Y94.351 E3.33834
+G1 X91.805 Y94.269 E3.34167
+G1 X91.863 Y94.187 E3.34500
+G1 X91.922 Y94.106 E3.34833
+G1 X91.981 Y94.025 E3.35167
+G1 X92.041 Y93.946 E3.35500
+G1 X92.102 Y93.866 E3.35833
+G1 X92.164 Y93.787 E3.36166
+G1 X92.226 Y93.709 E3.36499
+G1 X92.290 Y93.632 E3.36832
+G1 X92.354 Y93.555 E3.37166
+G1 X92.419 Y93.479 E3.37499
+G1 X92.484 Y93.403 E3.37832
+G1 X92.551 Y93.329 E3.38165
+G1 X92.618 Y93.254 E3.38498
+G1 X92.686 Y93.181 E3.38831
+G1 X92.754 Y93.108 E3.39165
+G1 X92.824 Y93.036 E3.39498
+G1 X92.894 Y92.964 E3.39831
+G1 X92.964 Y92.894 E3.40164
+G1 X93.036 Y92.824 E3.40497
+G1 X93.108 Y92.754 E3.40830
+G1 X93.181 Y92.686 E3.41164
+G1 X93.254 Y92.618 E3.41497
+G1 X93.329 Y92.551 E3.41830
+G1 X93.403 Y92.484 E3.42163
+G1 X93.479 Y92.419 E3.42496
+G1 X93.555 Y92.354 E3.42829
+G1 X93.632 Y92.290 E3.43163
+G1 X93.709 Y92.226 E3.43496
+G1 X93.787 Y92.164 E3.43829
+G1 X93.866 Y92.102 E3.44162
+G1 X93.946 Y92.041 E3.44495
+G1 X94.025 Y91.981 E3.44828
+G1 X94.106 Y91.922 E3.45162
+G1 X94.187 Y91.863 E3.45495
+G1 X94.269 Y91.805 E3.45828
+G1 X94.351 Y91.748 E3.46161
+G1 X94.434 Y91.692 E3.46494
+G1 X94.517 Y91.637 E3.46827
+G1 X94.601 Y91.583 E3.47161
+G1 X94.686 Y91.529 E3.47494
+G1 X94.771 Y91.476 E3.47827
+G1 X94.856 Y91.424 E3.48160
+G1 X94.942 Y91.373 E3.48493
+G1 X95.029 Y91.323 E3.48826
+G1 X95.116 Y91.274 E3.49160
+G1 X95.204 Y91.225 E3.49493
+G1 X95.292 Y91.178 E3.49826
+G1 X95.380 Y91.131 E3.50159
+G1 X95.469 Y91.085 E3.50492
+G1 X95.558 Y91.041 E3.50825
+G1 X95.648 Y90.997 E3.51159
+G1 X95.739 Y90.953 E3.51492
+G1 X95.829 Y90.911 E3.51825
+G1 X95.920 Y90.870 E3.52158
+G1 X96.012 Y90.830 E3.52491
+G1 X96.104 Y90.790 E3.52824
+G1 X96.196 Y90.752 E3.53158
+G1 X96.289 Y90.714 E3.53491
+G1 X96.382 Y90.677 E3.53824
+G1 X96.476 Y90.642 E3.54157
+G1 X96.569 Y90.607 E3.54490
+G1 X96.664 Y90.573 E3.54823
+G1 X96.758 Y90.540 E3.55157
+G1 X96.853 Y90.508 E3.55490
+G1 X96.948 Y90.477 E3.55823
+G1 X97.043 Y90.447 E3.56156
+G1 X97.139 Y90.418 E3.56489
+G1 X97.235 Y90.390 E3.56822
+G1 X97.331 Y90.363 E3.57156
+G1 X97.428 Y90.336 E3.57489
+G1 X97.525 Y90.311 E3.57822
+G1 X97.622 Y90.287 E3.58155
+G1 X97.719 Y90.264 E3.58488
+G1 X97.817 Y90.241 E3.58821
+G1 X97.914 Y90.220 E3.59155
+G1 X98.012 Y90.200 E3.59488
+G1 X98.110 Y90.180 E3.59821
+G1 X98.209 Y90.162 E3.60154
+G1 X98.307 Y90.144 E3.60487
+G1 X98.406 Y90.128 E3.60820
+G1 X98.505 Y90.112 E3.61154
+G1 X98.604 Y90.098 E3.61487
+G1 X98.703 Y90.084 E3.61820
+G1 X98.802 Y90.072 E3.62153
+G1 X98.902 Y90.061 E3.62486
+G1 X99.001 Y90.050 E3.62819
+G1 X99.101 Y90.041 E3.63153
+G1 X99.200 Y90.032 E3.63486
+G1 X99.300 Y90.025 E3.63819
+G1 X99.400 Y90.018 E3.64152
+G1 X99.500 Y90.013 E3.64485
+G1 X99.600 Y90.008 E3.64818
+G1 X99.700 Y90.005 E3.65152
+G1 X99.800 Y90.002 E3.65485
+G1 X99.900 Y90.001 E3.65818
+G1 X100.000 Y90.000 E3.66151
+G1 X100.100 Y90.001 E3.66484
+G1 X100.200 Y90.002 E3.66817
+G1 X100.300 Y90.005 E3.67151
+G1 X100.400 Y90.008 E3.67484
+G1 X100.500 Y90.013 E3.67817
+G1 X100.600 Y90.018 E3.68150
+G1 X100.700 Y90.025 E3.68483
+G1 X100.800 Y90.032 E3.68816
+G1 X100.899 Y90.041 E3.69150
+G1 X100.999 Y90.050 E3.69483
+G1 X101.098 Y90.061 E3.69816
+G1 X101.198 Y90.072 E3.70149
+G1 X101.297 Y90.084 E3.70482
+G1 X101.396 Y90.098 E3.70815
+G1 X101.495 Y90.112 E3.71149
+G1 X101.594 Y90.128 E3.71482
+G1 X101.693 Y90.144 E3.71815
+G1 X101.791 Y90.162 E3.72148
+G1 X101.890 Y90.180 E3.72481
+G1 X101.988 Y90.200 E3.72814
+G1 X102.086 Y90.220 E3.73148
+G1 X102.183 Y90.241 E3.73481
+G1 X102.281 Y90.264 E3.73814
+G1 X102.378 Y90.287 E3.74147
+G1 X102.475 Y90.311 E3.74480
+G1 X102.572 Y90.336 E3.74813
+G1 X102.669 Y90.363 E3.75147
+G1 X102.765 Y90.390 E3.75480
+G1 X102.861 Y90.418 E3.75813
+G1 X102.957 Y90.447 E3.76146
+G1 X103.052 Y90.477 E3.76479
+G1 X103.147 Y90.508 E3.76812
+G1 X103.242 Y90.540 E3.77146
+G1 X103.336 Y90.573 E3.77479
+G1 X103.431 Y90.607 E3.77812
+G1 X103.524 Y90.642 E3.78145
+G1 X103.618 Y90.677 E3.78478
+G1 X103.711 Y90.714 E3.78811
+G1 X103.804 Y90.752 E3.79145
+G1 X103.896 Y90.790 E3.79478
+G1 X103.988 Y90.830 E3.79811
+G1 X104.080 Y90.870 E3.80144
+G1 X104.171 Y90.911 E3.80477
+G1 X104.261 Y90.953 E3.80810
+G1 X104.352 Y90.997 E3.81144
+G1 X104.442 Y91.041 E3.81477
+G1 X104.531 Y91.085 E3.81810
+G1 X104.620 Y91.131 E3.82143
+G1 X104.708 Y91.178 E3.82476
+G1 X104.796 Y91.225 E3.82809
+G1 X104.884 Y91.274 E3.83143
+G1 X104.971 Y91.323 E3.83476
+G1 X105.058 Y91.373 E3.83809
+G1 X105.144 Y91.424 E3.84142
+G1 X105.229 Y91.476 E3.84475
+G1 X105.314 Y91.529 E3.84808
+G1 X105.399 Y91.583 E3.85142
+G1 X105.483 Y91.637 E3.85475
+G1 X105.566 Y91.692 E3.85808
+G1 X105.649 Y91.748 E3.86141
+G1 X105.731 Y91.805 E3.86474
+G1 X105.813 Y91.863 E3.86807
+G1 X105.894 Y91.922 E3.87141
+G1 X105.975 Y91.981 E3.87474
+G1 X106.054 Y92.041 E3.87807
+G1 X106.134 Y92.102 E3.88140
+G1 X106.213 Y92.164 E3.88473
+G1 X106.291 Y92.226 E3.88806
+G1 X106.368 Y92.290 E3.89140
+G1 X106.445 Y92.354 E3.89473
+G1 X106.521 Y92.419 E3.89806
+G1 X106.597 Y92.484 E3.90139
+G1 X106.671 Y92.551 E3.90472
+G1 X106.746 Y92.618 E3.90805
+G1 X106.819 Y92.686 E3.91139
+G1 X106.892 Y92.754 E3.91472
+G1 X106.964 Y92.824 E3.91805
+G1 X107.036 Y92.894 E3.92138
+G1 X107.106 Y92.964 E3.92471
+G1 X107.176 Y93.036 E3.92804
+G1 X107.246 Y93.108 E3.93138
+G1 X107.314 Y93.181 E3.93471
+G1 X107.382 Y93.254 E3.93804
+G1 X107.449 Y93.329 E3.94137
+G1 X107.516 Y93.403 E3.94470
+G1 X107.581 Y93.479 E3.94804
+G1 X107.646 Y93.555 E3.95137
+G1 X107.710 Y93.632 E3.95470
+G1 X107.774 Y93.709 E3.95803
+G1 X107.836 Y93.787 E3.96136
+G1 X107.898 Y93.866 E3.96469
+G1 X107.959 Y93.946 E3.96803
+G1 X108.019 Y94.025 E3.97136
+G1 X108.078 Y94.106 E3.97469
+G1 X108.137 Y94.187 E3.97802
+G1 X108.195 Y94.269 E3.98135
+G1 X108.252 Y94.351 E3.98468
+G1 X108.308 Y94.434 E3.98802
+G1 X108.363 Y94.517 E3.99135
+G1 X108.417 Y94.601 E3.99468
+G1 X108.471 Y94.686 E3.99801
+G1 X108.524 Y94.771 E4.00134
+G1 X108.576 Y94.856 E4.00467
+G1 X108.627 Y94.942 E4.00801
+G1 X108.677 Y95.029 E4.01134
+G1 X108.726 Y95.116 E4.01467
+G1 X108.775 Y95.204 E4.01800
+G1 X108.822 Y95.292 E4.02133
+G1 X108.869 Y95.380 E4.02466
+G1 X108.915 Y95.469 E4.02800
+G1 X108.959 Y95.558 E4.03133
+G1 X109.003 Y95.648 E4.03466
+G1 X109.047 Y95.739 E4.03799
+G1 X109.089 Y95.829 E4.04132
+G1 X109.130 Y95.920 E4.04465
+G1 X109.170 Y96.012 E4.04799
+G1 X109.210 Y96.104 E4.05132
+G1 X109.248 Y96.196 E4.05465
+G1 X109.286 Y96.289 E4.05798
+G1 X109.323 Y96.382 E4.06131
+G1 X109.358 Y96.476 E4.06464
+G1 X109.393 Y96.569 E4.06798
+G1 X109.427 Y96.664 E4.07131
+G1 X109.460 Y96.758 E4.07464
+G1 X109.492 Y96.853 E4.07797
+G1 X109.523 Y96.948 E4.08130
+G1 X109.553 Y97.043 E4.08463
+G1 X109.582 Y97.139 E4.08797
+G1 X109.610 Y97.235 E4.09130
+G1 X109.637 Y97.331 E4.09463
+G1 X109.664 Y97.428 E4.09796
+G1 X109.689 Y97.525 E4.10129
+G1 X109.713 Y97.622 E4.10462
+G1 X109.736 Y97.719 E4.10796
+G1 X109.759 Y97.817 E4.11129
+G1 X109.780 Y97.914 E4.11462
+G1 X109.800 Y98.012 E4.11795
+G1 X109.820 Y98.110 E4.12128
+G1 X109.838 Y98.209 E4.12461
+G1 X109.856 Y98.307 E4.12795
+G1 X109.872 Y98.406 E4.13128
+G1 X109.888 Y98.505 E4.13461
+G1 X109.902 Y98.604 E4.13794
+G1 X109.916 Y98.703 E4.14127
+G1 X109.928 Y98.802 E4.14460
+G1 X109.939 Y98.902 E4.14794
+G1 X109.950 Y99.001 E4.15127
+G1 X109.959 Y99.101 E4.15460
+G1 X109.968 Y99.200 E4.15793
+G1 X109.975 Y99.300 E4.16126
+G1 X109.982 Y99.400 E4.16459
+G1 X109.987 Y99.500 E4.16793
+G1 X109.992 Y99.600 E4.17126
+G1 X109.995 Y99.700 E4.17459
+G1 X109.998 Y99.800 E4.17792
+G1 X109.999 Y99.900 E4.18125
+G1 X110.000 Y100.000 E4.18458
+G1 X109.999 Y100.100 E4.18792
+G1 X109.998 Y100.200 E4.19125
+G1 X109.995 Y100.300 E4.19458
+G1 X109.992 Y100.400 E4.19791
+G1 X109.987 Y100.500 E4.20124
+G1 X109.982 Y100.600 E4.20457
+G1 X109.975 Y100.700 E4.20791
+G1 X109.968 Y100.800 E4.21124
+G1 X109.959 Y100.899 E4.21457
+G1 X109.950 Y100.999 E4.21790
+G1 X109.939 Y101.098 E4.22123
+G1 X109.928 Y101.198 E4.22456
+G1 X109.916 Y101.297 E4.22790
+G1 X109.902 Y101.396 E4.23123
+G1 X109.888 Y101.495 E4.23456
+G1 X109.872 Y101.594 E4.23789
+G1 X109.856 Y101.693 E4.24122
+G1 X109.838 Y101.791 E4.24455
+G1 X109.820 Y101.890 E4.24789
+G1 X109.800 Y101.988 E4.25122
+G1 X109.780 Y102.086 E4.25455
+G1 X109.759 Y102.183 E4.25788
+G1 X109.736 Y102.281 E4.26121
+G1 X109.713 Y102.378 E4.26454
+G1 X109.689 Y102.475 E4.26788
+G1 X109.664 Y102.572 E4.27121
+G1 X109.637 Y102.669 E4.27454
+G1 X109.610 Y102.765 E4.27787
+G1 X109.582 Y102.861 E4.28120
+G1 X109.553 Y102.957 E4.28453
+G1 X109.523 Y103.052 E4.28787
+G1 X109.492 Y103.147 E4.29120
+G1 X109.460 Y103.242 E4.29453
+G1 X109.427 Y103.336 E4.29786
+G1 X109.393 Y103.431 E4.30119
+G1 X109.358 Y103.524 E4.30452
+G1 X109.323 Y103.618 E4.30786
+G1 X109.286 Y103.711 E4.31119
+G1 X109.248 Y103.804 E4.31452
+G1 X109.210 Y103.896 E4.31785
+G1 X109.170 Y103.988 E4.32118
+G1 X109.130 Y104.080 E4.32451
+G1 X109.089 Y104.171 E4.32785
+G1 X109.047 Y104.261 E4.33118
+G1 X109.003 Y104.352 E4.33451
+G1 X108.959 Y104.442 E4.33784
+G1 X108.915 Y104.531 E4.34117
+G1 X108.869 Y104.620 E4.34450
+G1 X108.822 Y104.708 E4.34784
+G1 X108.775 Y104.796 E4.35117
+G1 X108.726 Y104.884 E4.35450
+G1 X108.677 Y104.971 E4.35783
+G1 X108.627 Y105.058 E4.36116
+G1 X108.576 Y105.144 E4.36449
+G1 X108.524 Y105.229 E4.36783
+G1 X108.471 Y105.314 E4.37116
+G1 X108.417 Y105.399 E4.37449
+G1 X108.363 Y105.483 E4.37782
+G1 X108.308 Y105.566 E4.38115
+G1 X108.252 Y105.649 E4.38448
+G1 X108.195 Y105.731 E4.38782
+G1 X108.137 Y105.813 E4.39115
+G1 X108.078 Y105.894 E4.39448
+G1 X108.019 Y105.975 E4.39781
+G1 X107.959 Y106.054 E4.40114
+G1 X107.898 Y106.134 E4.40447
+G1 X107.836 Y106.213 E4.40781
+G1 X107.774 Y106.291 E4.41114
+G1 X107.710 Y106.368 E4.41447
+G1 X107.646 Y106.445 E4.41780
+G1 X107.581 Y106.521 E4.42113
+G1 X107.516 Y106.597 E4.42446
+G1 X107.449 Y106.671 E4.42780
+G1 X107.382 Y106.746 E4.43113
+G1 X107.314 Y106.819 E4.43446
+G1 X107.246 Y106.892 E4.43779
+G1 X107.176 Y106.964 E4.44112
+G1 X107.106 Y107.036 E4.44445
+G1 X107.036 Y107.106 E4.44779
+G1 X106.964 Y107.176 E4.45112
+G1 X106.892 Y107.246 E4.45445
+G1 X106.819 Y107.314 E4.45778
+G1 X106.746 Y107.382 E4.46111
+G1 X106.671 Y107.449 E4.46444
+G1 X106.597 Y107.516 E4.46778
+G1 X106.521 Y107.581 E4.47111
+G1 X106.445 Y107.646 E4.47444
+G1 X106.368 Y107.710 E4.47777
+G1 X106.291 Y107.774 E4.48110
+G1 X106.213 Y107.836 E4.48443
+G1 X106.134 Y107.898 E4.48777
+G1 X106.054 Y107.959 E4.49110
+G1 X105.975 Y108.019 E4.49443
+G1 X105.894 Y108.078 E4.49776
+G1 X105.813 Y108.137 E4.50109
+G1 X105.731 Y108.195 E4.50442
+G1 X105.649 Y108.252 E4.50776
+G1 X105.566 Y108.308 E4.51109
+G1 X105.483 Y108.363 E4.51442
+G1 X105.399 Y108.417 E4.51775
+G1 X105.314 Y108.471 E4.52108
+G1 X105.229 Y108.524 E4.52441
+G1 X105.144 Y108.576 E4.52775
+G1 X105.058 Y108.627 E4.53108
+G1 X104.971 Y108.677 E4.53441
+G1 X104.884 Y108.726 E4.53774
+G1 X104.796 Y108.775 E4.54107
+G1 X104.708 Y108.822 E4.54440
+G1 X104.620 Y108.869 E4.54774
+G1 X104.531 Y108.915 E4.55107
+G1 X104.442 Y108.959 E4.55440
+G1 X104.352 Y109.003 E4.55773
+G1 X104.261 Y109.047 E4.56106
+G1 X104.171 Y109.089 E4.56439
+G1 X104.080 Y109.130 E4.56773
+G1 X103.988 Y109.170 E4.57106
+G1 X103.896 Y109.210 E4.57439
+G1 X103.804 Y109.248 E4.57772
+G1 X103.711 Y109.286 E4.58105
+G1 X103.618 Y109.323 E4.58438
+G1 X103.524 Y109.358 E4.58772
+G1 X103.431 Y109.393 E4.59105
+G1 X103.336 Y109.427 E4.59438
+G1 X103.242 Y109.460 E4.59771
+G1 X103.147 Y109.492 E4.60104
+G1 X103.052 Y109.523 E4.60438
+G1 X102.957 Y109.553 E4.60771
+G1 X102.861 Y109.582 E4.61104
+G1 X102.765 Y109.610 E4.61437
+G1 X102.669 Y109.637 E4.61770
+G1 X102.572 Y109.664 E4.62103
+G1 X102.475 Y109.689 E4.62437
+G1 X102.378 Y109.713 E4.62770
+G1 X102.281 Y109.736 E4.63103
+G1 X102.183 Y109.759 E4.63436
+G1 X102.086 Y109.780 E4.63769
+G1 X101.988 Y109.800 E4.64102
+G1 X101.890 Y109.820 E4.64436
+G1 X101.791 Y109.838 E4.64769
+G1 X101.693 Y109.856 E4.65102
+G1 X101.594 Y109.872 E4.65435
+G1 X101.495 Y109.888 E4.65768
+G1 X101.396 Y109.902 E4.66101
+G1 X101.297 Y109.916 E4.66435
+G1 X101.198 Y109.928 E4.66768
+G1 X101.098 Y109.939 E4.67101
+G1 X100.999 Y109.950 E4.67434
+G1 X100.899 Y109.959 E4.67767
+G1 X100.800 Y109.968 E4.68100
+G1 X100.700 Y109.975 E4.68434
+G1 X100.600 Y109.982 E4.68767
+G1 X100.500 Y109.987 E4.69100
+G1 X100.400 Y109.992 E4.69433
+G1 X100.300 Y109.995 E4.69766
+G1 X100.200 Y109.998 E4.70099
+G1 X100.100 Y109.999 E4.70433
+G1 X100.000 Y110.000 E4.70766
+G1 X99.900 Y109.999 E4.71099
+G1 X99.800 Y109.998 E4.71432
+G1 X99.700 Y109.995 E4.71765
+G1 X99.600 Y109.992 E4.72098
+G1 X99.500 Y109.987 E4.72432
+G1 X99.400 Y109.982 E4.72765
+G1 X99.300 Y109.975 E4.73098
+G1 X99.200 Y109.968 E4.73431
+G1 X99.101 Y109.959 E4.73764
+G1 X99.001 Y109.950 E4.74097
+G1 X98.902 Y109.939 E4.74431
+G1 X98.802 Y109.928 E4.74764
+G1 X98.703 Y109.916 E4.75097
+G1 X98.604 Y109.902 E4.75430
+G1 X98.505 Y109.888 E4.75763
+G1 X98.406 Y109.872 E4.76096
+G1 X98.307 Y109.856 E4.76430
+G1 X98.209 Y109.838 E4.76763
+G1 X98.110 Y109.820 E4.77096
+G1 X98.012 Y109.800 E4.77429
+G1 X97.914 Y109.780 E4.77762
+G1 X97.817 Y109.759 E4.78095
+G1 X97.719 Y109.736 E4.78429
+G1 X97.622 Y109.713 E4.78762
+G1 X97.525 Y109.689 E4.79095
+G1 X97.428 Y109.664 E4.79428
+G1 X97.331 Y109.637 E4.79761
+G1 X97.235 Y109.610 E4.80094
+G1 X97.139 Y109.582 E4.80428
+G1 X97.043 Y109.553 E4.80761
+G1 X96.948 Y109.523 E4.81094
+G1 X96.853 Y109.492 E4.81427
+G1 X96.758 Y109.460 E4.81760
+G1 X96.664 Y109.427 E4.82093
+G1 X96.569 Y109.393 E4.82427
+G1 X96.476 Y109.358 E4.82760
+G1 X96.382 Y109.323 E4.83093
+G1 X96.289 Y109.286 E4.83426
+G1 X96.196 Y109.248 E4.83759
+G1 X96.104 Y109.210 E4.84092
+G1 X96.012 Y109.170 E4.84426
+G1 X95.920 Y109.130 E4.84759
+G1 X95.829 Y109.089 E4.85092
+G1 X95.739 Y109.047 E4.85425
+G1 X95.648 Y109.003 E4.85758
+G1 X95.558 Y108.959 E4.86091
+G1 X95.469 Y108.915 E4.86425
+G1 X95.380 Y108.869 E4.86758
+G1 X95.292 Y108.822 E4.87091
+G1 X95.204 Y108.775 E4.87424
+G1 X95.116 Y108.726 E4.87757
+G1 X95.029 Y108.677 E4.88090
+G1 X94.942 Y108.627 E4.88424
+G1 X94.856 Y108.576 E4.88757
+G1 X94.771 Y108.524 E4.89090
+G1 X94.686 Y108.471 E4.89423
+G1 X94.601 Y108.417 E4.89756
+G1 X94.517 Y108.363 E4.90089
+G1 X94.434 Y108.308 E4.90423
+G1 X94.351 Y108.252 E4.90756
+G1 X94.269 Y108.195 E4.91089
+G1 X94.187 Y108.137 E4.91422
+G1 X94.106 Y108.078 E4.91755
+G1 X94.025 Y108.019 E4.92088
+G1 X93.946 Y107.959 E4.92422
+G1 X93.866 Y107.898 E4.92755
+G1 X93.787 Y107.836 E4.93088
+G1 X93.709 Y107.774 E4.93421
+G1 X93.632 Y107.710 E4.93754
+G1 X93.555 Y107.646 E4.94087
+G1 X93.479 Y107.581 E4.94421
+G1 X93.403 Y107.516 E4.94754
+G1 X93.329 Y107.449 E4.95087
+G1 X93.254 Y107.382 E4.95420
+G1 X93.181 Y107.314 E4.95753
+G1 X93.108 Y107.246 E4.96086
+G1 X93.036 Y107.176 E4.96420
+G1 X92.964 Y107.106 E4.96753
+G1 X92.894 Y107.036 E4.97086
+G1 X92.824 Y106.964 E4.97419
+G1 X92.754 Y106.892 E4.97752
+G1 X92.686 Y106.819 E4.98085
+G1 X92.618 Y106.746 E4.98419
+G1 X92.551 Y106.671 E4.98752
+G1 X92.484 Y106.597 E4.99085
+G1 X92.419 Y106.521 E4.99418
+G1 X92.354 Y106.445 E4.99751
+G1 X92.290 Y106.368 E5.00084
+G1 X92.226 Y106.291 E5.00418
+G1 X92.164 Y106.213 E5.00751
+G1 X92.102 Y106.134 E5.01084
+G1 X92.041 Y106.054 E5.01417
+G1 X91.981 Y105.975 E5.01750
+G1 X91.922 Y105.894 E5.02083
+G1 X91.863 Y105.813 E5.02417
+G1 X91.805 Y105.731 E5.02750
+G1 X91.748 Y105.649 E5.03083
+G1 X91.692 Y105.566 E5.03416
+G1 X91.637 Y105.483 E5.03749
+G1 X91.583 Y105.399 E5.04082
+G1 X91.529 Y105.314 E5.04416
+G1 X91.476 Y105.229 E5.04749
+G1 X91.424 Y105.144 E5.05082
+G1 X91.373 Y105.058 E5.05415
+G1 X91.323 Y104.971 E5.05748
+G1 X91.274 Y104.884 E5.06081
+G1 X91.225 Y104.796 E5.06415
+G1 X91.178 Y104.708 E5.06748
+G1 X91.131 Y104.620 E5.07081
+G1 X91.085 Y104.531 E5.07414
+G1 X91.041 Y104.442 E5.07747
+G1 X90.997 Y104.352 E5.08080
+G1 X90.953 Y104.261 E5.08414
+G1 X90.911 Y104.171 E5.08747
+G1 X90.870 Y104.080 E5.09080
+G1 X90.830 Y103.988 E5.09413
+G1 X90.790 Y103.896 E5.09746
+G1 X90.752 Y103.804 E5.10079
+G1 X90.714 Y103.711 E5.10413
+G1 X90.677 Y103.618 E5.10746
+G1 X90.642 Y103.524 E5.11079
+G1 X90.607 Y103.431 E5.11412
+G1 X90.573 Y103.336 E5.11745
+G1 X90.540 Y103.242 E5.12078
+G1 X90.508 Y103.147 E5.12412
+G1 X90.477 Y103.052 E5.12745
+G1 X90.447 Y102.957 E5.13078
+G1 X90.418 Y102.861 E5.13411
+G1 X90.390 Y102.765 E5.13744
+G1 X90.363 Y102.669 E5.14077
+G1 X90.336 Y102.572 E5.14411
+G1 X90.311 Y102.475 E5.14744
+G1 X90.287 Y102.378 E5.15077
+G1 X90.264 Y102.281 E5.15410
+G1 X90.241 Y102.183 E5.15743
+G1 X90.220 Y102.086 E5.16076
+G1 X90.200 Y101.988 E5.16410
+G1 X90.180 Y101.890 E5.16743
+G1 X90.162 Y101.791 E5.17076
+G1 X90.144 Y101.693 E5.17409
+G1 X90.128 Y101.594 E5.17742
+G1 X90.112 Y101.495 E5.18075
+G1 X90.098 Y101.396 E5.18409
+G1 X90.084 Y101.297 E5.18742
+G1 X90.072 Y101.198 E5.19075
+G1 X90.061 Y101.098 E5.19408
+G1 X90.050 Y100.999 E5.19741
+G1 X90.041 Y100.899 E5.20074
+G1 X90.032 Y100.800 E5.20408
+G1 X90.025 Y100.700 E5.20741
+G1 X90.018 Y100.600 E5.21074
+G1 X90.013 Y100.500 E5.21407
+G1 X90.008 Y100.400 E5.21740
+G1 X90.005 Y100.300 E5.22073
+G1 X90.002 Y100.200 E5.22407
+G1 X90.001 Y100.100 E5.22740
+G1 X90.000 Y100.000 E5.23073
+G1 X90.001 Y99.900 E5.23406
+G1 X90.002 Y99.800 E5.23739
+G1 X90.005 Y99.700 E5.24072
+G1 X90.008 Y99.600 E5.24406
+G1 X90.013 Y99.500 E5.24739
+G1 X90.018 Y99.400 E5.25072
+G1 X90.025 Y99.300 E5.25405
+G1 X90.032 Y99.200 E5.25738
+G1 X90.041 Y99.101 E5.26072
+G1 X90.050 Y99.001 E5.26405
+G1 X90.061 Y98.902 E5.26738
+G1 X90.072 Y98.802 E5.27071
+G1 X90.084 Y98.703 E5.27404
+G1 X90.098 Y98.604 E5.27737
+G1 X90.112 Y98.505 E5.28071
+G1 X90.128 Y98.406 E5.28404
+G1 X90.144 Y98.307 E5.28737
+G1 X90.162 Y98.209 E5.29070
+G1 X90.180 Y98.110 E5.29403
+G1 X90.200 Y98.012 E5.29736
+G1 X90.220 Y97.914 E5.30070
+G1 X90.241 Y97.817 E5.30403
+G1 X90.264 Y97.719 E5.30736
+G1 X90.287 Y97.622 E5.31069
+G1 X90.311 Y97.525 E5.31402
+G1 X90.336 Y97.428 E5.31735
+G1 X90.363 Y97.331 E5.32069
+G1 X90.390 Y97.235 E5.32402
+G1 X90.418 Y97.139 E5.32735
+G1 X90.447 Y97.043 E5.33068
+G1 X90.477 Y96.948 E5.33401
+G1 X90.508 Y96.853 E5.33734
+G1 X90.540 Y96.758 E5.34068
+G1 X90.573 Y96.664 E5.34401
+G1 X90.607 Y96.569 E5.34734
+G1 X90.642 Y96.476 E5.35067
+G1 X90.677 Y96.382 E5.35400
+G1 X90.714 Y96.289 E5.35733
+G1 X90.752 Y96.196 E5.36067
+G1 X90.790 Y96.104 E5.36400
+G1 X90.830 Y96.012 E5.36733
+G1 X90.870 Y95.920 E5.37066
+G1 X90.911 Y95.829 E5.37399
+G1 X90.953 Y95.739 E5.37732
+G1 X90.997 Y95.648 E5.38066
+G1 X91.041 Y95.558 E5.38399
+G1 X91.085 Y95.469 E5.38732
+G1 X91.131 Y95.380 E5.39065
+G1 X91.178 Y95.292 E5.39398
+G1 X91.225 Y95.204 E5.39731
+G1 X91.274 Y95.116 E5.40065
+G1 X91.323 Y95.029 E5.40398
+G1 X91.373 Y94.942 E5.40731
+G1 X91.424 Y94.856 E5.41064
+G1 X91.476 Y94.771 E5.41397
+G1 X91.529 Y94.686 E5.41730
+G1 X91.583 Y94.601 E5.42064
+G1 X91.637 Y94.517 E5.42397
+G1 X91.692 Y94.434 E5.42730
+G1 X91.748 Y94.351 E5.43063
+G1 X91.805 Y94.269 E5.43396
+G1 X91.863 Y94.187 E5.43729
+G1 X91.922 Y94.106 E5.44063
+G1 X91.981 Y94.025 E5.44396
+G1 X92.041 Y93.946 E5.44729
+G1 X92.102 Y93.866 E5.45062
+G1 X92.164 Y93.787 E5.45395
+G1 X92.226 Y93.709 E5.45728
+G1 X92.290 Y93.632 E5.46062
+G1 X92.354 Y93.555 E5.46395
+G1 X92.419 Y93.479 E5.46728
+G1 X92.484 Y93.403 E5.47061
+G1 X92.551 Y93.329 E5.47394
+G1 X92.618 Y93.254 E5.47727
+G1 X92.686 Y93.181 E5.48061
+G1 X92.754 Y93.108 E5.48394
+G1 X92.824 Y93.036 E5.48727
+G1 X92.894 Y92.964 E5.49060
+G1 X92.964 Y92.894 E5.49393
+G1 X93.036 Y92.824 E5.49726
+G1 X93.108 Y92.754 E5.50060
+G1 X93.181 Y92.686 E5.50393
+G1 X93.254 Y92.618 E5.50726
+G1 X93.329 Y92.551 E5.51059
+G1 X93.403 Y92.484 E5.51392
+G1 X93.479 Y92.419 E5.51725
+G1 X93.555 Y92.354 E5.52059
+G1 X93.632 Y92.290 E5.52392
+G1 X93.709 Y92.226 E5.52725
+G1 X93.787 Y92.164 E5.53058
+G1 X93.866 Y92.102 E5.53391
+G1 X93.946 Y92.041 E5.53724
+G1 X94.025 Y91.981 E5.54058
+G1 X94.106 Y91.922 E5.54391
+G1 X94.187 Y91.863 E5.54724
+G1 X94.269 Y91.805 E5.55057
+G1 X94.351 Y91.748 E5.55390
+G1 X94.434 Y91.692 E5.55723
+G1 X94.517 Y91.637 E5.56057
+G1 X94.601 Y91.583 E5.56390
+G1 X94.686 Y91.529 E5.56723
+G1 X94.771 Y91.476 E5.57056
+G1 X94.856 Y91.424 E5.57389
+G1 X94.942 Y91.373 E5.57722
+G1 X95.029 Y91.323 E5.58056
+G1 X95.116 Y91.274 E5.58389
+G1 X95.204 Y91.225 E5.58722
+G1 X95.292 Y91.178 E5.59055
+G1 X95.380 Y91.131 E5.59388
+G1 X95.469 Y91.085 E5.59721
+G1 X95.558 Y91.041 E5.60055
+G1 X95.648 Y90.997 E5.60388
+G1 X95.739 Y90.953 E5.60721
+G1 X95.829 Y90.911 E5.61054
+G1 X95.920 Y90.870 E5.61387
+G1 X96.012 Y90.830 E5.61720
+G1 X96.104 Y90.790 E5.62054
+G1 X96.196 Y90.752 E5.62387
+G1 X96.289 Y90.714 E5.62720
+G1 X96.382 Y90.677 E5.63053
+G1 X96.476 Y90.642 E5.63386
+G1 X96.569 Y90.607 E5.63719
+G1 X96.664 Y90.573 E5.64053
+G1 X96.758 Y90.540 E5.64386
+G1 X96.853 Y90.508 E5.64719
+G1 X96.948 Y90.477 E5.65052
+G1 X97.043 Y90.447 E5.65385
+G1 X97.139 Y90.418 E5.65718
+G1 X97.235 Y90.390 E5.66052
+G1 X97.331 Y90.363 E5.66385
+G1 X97.428 Y90.336 E5.66718
+G1 X97.525 Y90.311 E5.67051
+G1 X97.622 Y90.287 E5.67384
+G1 X97.719 Y90.264 E5.67717
+G1 X97.817 Y90.241 E5.68051
+G1 X97.914 Y90.220 E5.68384
+G1 X98.012 Y90.200 E5.68717
+G1 X98.110 Y90.180 E5.69050
+G1 X98.209 Y90.162 E5.69383
+G1 X98.307 Y90.144 E5.69716
+G1 X98.406 Y90.128 E5.70050
+G1 X98.505 Y90.112 E5.70383
+G1 X98.604 Y90.098 E5.70716
+G1 X98.703 Y90.084 E5.71049
+G1 X98.802 Y90.072 E5.71382
+G1 X98.902 Y90.061 E5.71715
+G1 X99.001 Y90.050 E5.72049
+G1 X99.101 Y90.041 E5.72382
+G1 X99.200 Y90.032 E5.72715
+G1 X99.300 Y90.025 E5.73048
+G1 X99.400 Y90.018 E5.73381
+G1 X99.500 Y90.013 E5.73714
+G1 X99.600 Y90.008 E5.74048
+G1 X99.700 Y90.005 E5.74381
+G1 X99.800 Y90.002 E5.74714
+G1 X99.900 Y90.001 E5.75047
+G1 X100.000 Y90.000 E5.75380
+G1 X100.100 Y90.001 E5.75713
+G1 X100.200 Y90.002 E5.76047
+G1 X100.300 Y90.005 E5.76380
+G1 X100.400 Y90.008 E5.76713
+G1 X100.500 Y90.013 E5.77046
+G1 X100.600 Y90.018 E5.77379
+G1 X100.700 Y90.025 E5.77712
+G1 X100.800 Y90.032 E5.78046
+G1 X100.899 Y90.041 E5.78379
+G1 X100.999 Y90.050 E5.78712
+G1 X101.098 Y90.061 E5.79045
+G1 X101.198 Y90.072 E5.79378
+G1 X101.297 Y90.084 E5.79711
+G1 X101.396 Y90.098 E5.80045
+G1 X101.495 Y90.112 E5.80378
+G1 X101.594 Y90.128 E5.80711
+G1 X101.693 Y90.144 E5.81044
+G1 X101.791 Y90.162 E5.81377
+G1 X101.890 Y90.180 E5.81710
+G1 X101.988 Y90.200 E5.82044
+G1 X102.086 Y90.220 E5.82377
+G1 X102.183 Y90.241 E5.82710
+G1 X102.281 Y90.264 E5.83043
+G1 X102.378 Y90.287 E5.83376
+G1 X102.475 Y90.311 E5.83709
+G1 X102.572 Y90.336 E5.84043
+G1 X102.669 Y90.363 E5.84376
+G1 X102.765 Y90.390 E5.84709
+G1 X102.861 Y90.418 E5.85042
+G1 X102.957 Y90.447 E5.85375
+G1 X103.052 Y90.477 E5.85708
+G1 X103.147 Y90.508 E5.86042
+G1 X103.242 Y90.540 E5.86375
+G1 X103.336 Y90.573 E5.86708
+G1 X103.431 Y90.607 E5.87041
+G1 X103.524 Y90.642 E5.87374
+G1 X103.618 Y90.677 E5.87707
+G1 X103.711 Y90.714 E5.88041
+G1 X103.804 Y90.752 E5.88374
+G1 X103.896 Y90.790 E5.88707
+G1 X103.988 Y90.830 E5.89040
+G1 X104.080 Y90.870 E5.89373
+G1 X104.171 Y90.911 E5.89706
+G1 X104.261 Y90.953 E5.90040
+G1 X104.352 Y90.997 E5.90373
+G1 X104.442 Y91.041 E5.90706
+G1 X104.531 Y91.085 E5.91039
+G1 X104.620 Y91.131 E5.91372
+G1 X104.708 Y91.178 E5.91706
+G1 X104.796 Y91.225 E5.92039
+G1 X104.884 Y91.274 E5.92372
+G1 X104.971 Y91.323 E5.92705
+G1 X105.058 Y91.373 E5.93038
+G1 X105.144 Y91.424 E5.93371
+G1 X105.229 Y91.476 E5.93705
+G1 X105.314 Y91.529 E5.94038
+G1 X105.399 Y91.583 E5.94371
+G1 X105.483 Y91.637 E5.94704
+G1 X105.566 Y91.692 E5.95037
+G1 X105.649 Y91.748 E5.95370
+G1 X105.731 Y91.805 E5.95704
+G1 X105.813 Y91.863 E5.96037
+G1 X105.894 Y91.922 E5.96370
+G1 X105.975 Y91.981 E5.96703
+G1 X106.054 Y92.041 E5.97036
+G1 X106.134 Y92.102 E5.97369
+G1 X106.213 Y92.164 E5.97703
+G1 X106.291 Y92.226 E5.98036
+G1 X106.368 Y92.290 E5.98369
+G1 X106.445 Y92.354 E5.98702
+G1 X106.521 Y92.419 E5.99035
+G1 X106.597 Y92.484 E5.99368
+G1 X106.671 Y92.551 E5.99702
+G1 X106.746 Y92.618 E6.00035
+G1 X106.819 Y92.686 E6.00368
+G1 X106.892 Y92.754 E6.00701
+G1 X106.964 Y92.824 E6.01034
+G1 X107.036 Y92.894 E6.01367
+G1 X107.106 Y92.964 E6.01701
+G1 X107.176 Y93.036 E6.02034
+G1 X107.246 Y93.108 E6.02367
+G1 X107.314 Y93.181 E6.02700
+G1 X107.382 Y93.254 E6.03033
+G1 X107.449 Y93.329 E6.03366
+G1 X107.516 Y93.403 E6.03700
+G1 X107.581 Y93.479 E6.04033
+G1 X107.646 Y93.555 E6.04366
+G1 X107.710 Y93.632 E6.04699
+G1 X107.774 Y93.709 E6.05032
+G1 X107.836 Y93.787 E6.05365
+G1 X107.898 Y93.866 E6.05699
+G1 X107.959 Y93.946 E6.06032
+G1 X108.019 Y94.025 E6.06365
+G1 X108.078 Y94.106 E6.06698
+G1 X108.137 Y94.187 E6.07031
+G1 X108.195 Y94.269 E6.07364
+G1 X108.252 Y94.351 E6.07698
+G1 X108.308 Y94.434 E6.08031
+G1 X108.363 Y94.517 E6.08364
+G1 X108.417 Y94.601 E6.08697
+G1 X108.471 Y94.686 E6.09030
+G1 X108.524 Y94.771 E6.09363
+G1 X108.576 Y94.856 E6.09697
+G1 X108.627 Y94.942 E6.10030
+G1 X108.677 Y95.029 E6.10363
+G1 X108.726 Y95.116 E6.10696
+G1 X108.775 Y95.204 E6.11029
+G1 X108.822 Y95.292 E6.11362
+G1 X108.869 Y95.380 E6.11696
+G1 X108.915 Y95.469 E6.12029
+G1 X108.959 Y95.558 E6.12362
+G1 X109.003 Y95.648 E6.12695
+G1 X109.047 Y95.739 E6.13028
+G1 X109.089 Y95.829 E6.13361
+G1 X109.130 Y95.920 E6.13695
+G1 X109.170 Y96.012 E6.14028
+G1 X109.210 Y96.104 E6.14361
+G1 X109.248 Y96.196 E6.14694
+G1 X109.286 Y96.289 E6.15027
+G1 X109.323 Y96.382 E6.15360
+G1 X109.358 Y96.476 E6.15694
+G1 X109.393 Y96.569 E6.16027
+G1 X109.427 Y96.664 E6.16360
+G1 X109.460 Y96.758 E6.16693
+G1 X109.492 Y96.853 E6.17026
+G1 X109.523 Y96.948 E6.17359
+G1 X109.553 Y97.043 E6.17693
+G1 X109.582 Y97.139 E6.18026
+G1 X109.610 Y97.235 E6.18359
+G1 X109.637 Y97.331 E6.18692
+G1 X109.664 Y97.428 E6.19025
+G1 X109.689 Y97.525 E6.19358
+G1 X109.713 Y97.622 E6.19692
+G1 X109.736 Y97.719 E6.20025
+G1 X109.759 Y97.817 E6.20358
+G1 X109.780 Y97.914 E6.20691
+G1 X109.800 Y98.012 E6.21024
+G1 X109.820 Y98.110 E6.21357
+G1 X109.838 Y98.209 E6.21691
+G1 X109.856 Y98.307 E6.22024
+G1 X109.872 Y98.406 E6.22357
+G1 X109.888 Y98.505 E6.22690
+G1 X109.902 Y98.604 E6.23023
+G1 X109.916 Y98.703 E6.23356
+G1 X109.928 Y98.802 E6.23690
+G1 X109.939 Y98.902 E6.24023
+G1 X109.950 Y99.001 E6.24356
+G1 X109.959 Y99.101 E6.24689
+G1 X109.968 Y99.200 E6.25022
+G1 X109.975 Y99.300 E6.25355
+G1 X109.982 Y99.400 E6.25689
+G1 X109.987 Y99.500 E6.26022
+G1 X109.992 Y99.600 E6.26355
+G1 X109.995 Y99.700 E6.26688
+G1 X109.998 Y99.800 E6.27021
+G1 X109.999 Y99.900 E6.27354
+G1 X110.000 Y100.000 E6.27688
+G1 X109.999 Y100.100 E6.28021
+G1 X109.998 Y100.200 E6.28354
+G1 X109.995 Y100.300 E6.28687
+G1 X109.992 Y100.400 E6.29020
+G1 X109.987 Y100.500 E6.29353
+G1 X109.982 Y100.600 E6.29687
+G1 X109.975 Y100.700 E6.30020
+G1 X109.968 Y100.800 E6.30353
+G1 X109.959 Y100.899 E6.30686
+G1 X109.950 Y100.999 E6.31019
+G1 X109.939 Y101.098 E6.31352
+G1 X109.928 Y101.198 E6.31686
+G1 X109.916 Y101.297 E6.32019
+G1 X109.902 Y101.396 E6.32352
+G1 X109.888 Y101.495 E6.32685
+G1 X109.872 Y101.594 E6.33018
+G1 X109.856 Y101.693 E6.33351
+G1 X109.838 Y101.791 E6.33685
+G1 X109.820 Y101.890 E6.34018
+G1 X109.800 Y101.988 E6.34351
+G1 X109.780 Y102.086 E6.34684
+G1 X109.759 Y102.183 E6.35017
+G1 X109.736 Y102.281 E6.35350
+G1 X109.713 Y102.378 E6.35684
+G1 X109.689 Y102.475 E6.36017
+G1 X109.664 Y102.572 E6.36350
+G1 X109.637 Y102.669 E6.36683
+G1 X109.610 Y102.765 E6.37016
+G1 X109.582 Y102.861 E6.37349
+G1 X109.553 Y102.957 E6.37683
+G1 X109.523 Y103.052 E6.38016
+G1 X109.492 Y103.147 E6.38349
+G1 X109.460 Y103.242 E6.38682
+G1 X109.427 Y103.336 E6.39015
+G1 X109.393 Y103.431 E6.39348
+G1 X109.358 Y103.524 E6.39682
+G1 X109.323 Y103.618 E6.40015
+G1 X109.286 Y103.711 E6.40348
+G1 X109.248 Y103.804 E6.40681
+G1 X109.210 Y103.896 E6.41014
+G1 X109.170 Y103.988 E6.41347
+G1 X109.130 Y104.080 E6.41681
+G1 X109.089 Y104.171 E6.42014
+G1 X109.047 Y104.261 E6.42347
+G1 X109.003 Y104.352 E6.42680
+G1 X108.959 Y104.442 E6.43013
+G1 X108.915 Y104.531 E6.43346
+G1 X108.869 Y104.620 E6.43680
+G1 X108.822 Y104.708 E6.44013
+G1 X108.775 Y104.796 E6.44346
+G1 X108.726 Y104.884 E6.44679
+G1 X108.677 Y104.971 E6.45012
+G1 X108.627 Y105.058 E6.45345
+G1 X108.576 Y105.144 E6.45679
+G1 X108.524 Y105.229 E6.46012
+G1 X108.471 Y105.314 E6.46345
+G1 X108.417 Y105.399 E6.46678
+G1 X108.363 Y105.483 E6.47011
+G1 X108.308 Y105.566 E6.47344
+G1 X108.252 Y105.649 E6.47678
+G1 X108.195 Y105.731 E6.48011
+G1 X108.137 Y105.813 E6.48344
+G1 X108.078 Y105.894 E6.48677
+G1 X108.019 Y105.975 E6.49010
+G1 X107.959 Y106.054 E6.49343
+G1 X107.898 Y106.134 E6.49677
+G1 X107.836 Y106.213 E6.50010
+G1 X107.774 Y106.291 E6.50343
+G1 X107.710 Y106.368 E6.50676
+G1 X107.646 Y106.445 E6.51009
+G1 X107.581 Y106.521 E6.51342
+G1 X107.516 Y106.597 E6.51676
+G1 X107.449 Y106.671 E6.52009
+G1 X107.382 Y106.746 E6.52342
+G1 X107.314 Y106.819 E6.52675
+G1 X107.246 Y106.892 E6.53008
+G1 X107.176 Y106.964 E6.53341
+G1 X107.106 Y107.036 E6.53675
+G1 X107.036 Y107.106 E6.54008
+G1 X106.964 Y107.176 E6.54341
+G1 X106.892 Y107.246 E6.54674
+G1 X106.819 Y107.314 E6.55007
+G1 X106.746 Y107.382 E6.55340
+G1 X106.671 Y107.449 E6.55674
+G1 X106.597 Y107.516 E6.56007
+G1 X106.521 Y107.581 E6.56340
+G1 X106.445 Y107.646 E6.56673
+G1 X106.368 Y107.710 E6.57006
+G1 X106.291 Y107.774 E6.57340
+G1 X106.213 Y107.836 E6.57673
+G1 X106.134 Y107.898 E6.58006
+G1 X106.054 Y107.959 E6.58339
+G1 X105.975 Y108.019 E6.58672
+G1 X105.894 Y108.078 E6.59005
+G1 X105.813 Y108.137 E6.59339
+G1 X105.731 Y108.195 E6.59672
+G1 X105.649 Y108.252 E6.60005
+G1 X105.566 Y108.308 E6.60338
+G1 X105.483 Y108.363 E6.60671
+G1 X105.399 Y108.417 E6.61004
+G1 X105.314 Y108.471 E6.61338
+G1 X105.229 Y108.524 E6.61671
+G1 X105.144 Y108.576 E6.62004
+G1 X105.058 Y108.627 E6.62337
+G1 X104.971 Y108.677 E6.62670
+G1 X104.884 Y108.726 E6.63003
+G1 X104.796 Y108.775 E6.63337
+G1 X104.708 Y108.822 E6.63670
+G1 X104.620 Y108.869 E6.64003
+G1 X104.531 Y108.915 E6.64336
+G1 X104.442 Y108.959 E6.64669
+G1 X104.352 Y109.003 E6.65002
+G1 X104.261 Y109.047 E6.65336
+G1 X104.171 Y109.089 E6.65669
+G1 X104.080 Y109.130 E6.66002
+G1 X103.988 Y109.170 E6.66335
+G1 X103.896 Y109.210 E6.66668
+G1 X103.804 Y109.248 E6.67001
+G1 X103.711 Y109.286 E6.67335
+G1 X103.618 Y109.323 E6.67668
+G1 X103.524 Y109.358 E6.68001
+G1 X103.431 Y109.393 E6.68334
+G1 X103.336 Y109.427 E6.68667
+G1 X103.242 Y109.460 E6.69000
+G1 X103.147 Y109.492 E6.69334
+G1 X103.052 Y109.523 E6.69667
+G1 X102.957 Y109.553 E6.70000
+G1 X102.861 Y109.582 E6.70333
+G1 X102.765 Y109.610 E6.70666
+G1 X102.669 Y109.637 E6.70999
+G1 X102.572 Y109.664 E6.71333
+G1 X102.475 Y109.689 E6.71666
+G1 X102.378 Y109.713 E6.71999
+G1 X102.281 Y109.736 E6.72332
+G1 X102.183 Y109.759 E6.72665
+G1 X102.086 Y109.780 E6.72998
+G1 X101.988 Y109.800 E6.73332
+G1 X101.890 Y109.820 E6.73665
+G1 X101.791 Y109.838 E6.73998
+G1 X101.693 Y109.856 E6.74331
+G1 X101.594 Y109.872 E6.74664
+G1 X101.495 Y109.888 E6.74997
+G1 X101.396 Y109.902 E6.75331
+G1 X101.297 Y109.916 E6.75664
+G1 X101.198 Y109.928 E6.75997
+G1 X101.098 Y109.939 E6.76330
+G1 X100.999 Y109.950 E6.76663
+G1 X100.899 Y109.959 E6.76996
+G1 X100.800 Y109.968 E6.77330
+G1 X100.700 Y109.975 E6.77663
+G1 X100.600 Y109.982 E6.77996
+G1 X100.500 Y109.987 E6.78329
+G1 X100.400 Y109.992 E6.78662
+G1 X100.300 Y109.995 E6.78995
+G1 X100.200 Y109.998 E6.79329
+G1 X100.100 Y109.999 E6.79662
+G1 X100.000 Y110.000 E6.79995
+G1 X99.900 Y109.999 E6.80328
+G1 X99.800 Y109.998 E6.80661
+G1 X99.700 Y109.995 E6.80994
+G1 X99.600 Y109.992 E6.81328
+G1 X99.500 Y109.987 E6.81661
+G1 X99.400 Y109.982 E6.81994
+G1 X99.300 Y109.975 E6.82327
+G1 X99.200 Y109.968 E6.82660
+G1 X99.101 Y109.959 E6.82993
+G1 X99.001 Y109.950 E6.83327
+G1 X98.902 Y109.939 E6.83660
+G1 X98.802 Y109.928 E6.83993
+G1 X98.703 Y109.916 E6.84326
+G1 X98.604 Y109.902 E6.84659
+G1 X98.505 Y109.888 E6.84992
+G1 X98.406 Y109.872 E6.85326
+G1 X98.307 Y109.856 E6.85659
+G1 X98.209 Y109.838 E6.85992
+G1 X98.110 Y109.820 E6.86325
+G1 X98.012 Y109.800 E6.86658
+G1 X97.914 Y109.780 E6.86991
+G1 X97.817 Y109.759 E6.87325
+G1 X97.719 Y109.736 E6.87658
+G1 X97.622 Y109.713 E6.87991
+G1 X97.525 Y109.689 E6.88324
+G1 X97.428 Y109.664 E6.88657
+G1 X97.331 Y109.637 E6.88990
+G1 X97.235 Y109.610 E6.89324
+G1 X97.139 Y109.582 E6.89657
+G1 X97.043 Y109.553 E6.89990
+G1 X96.948 Y109.523 E6.90323
+G1 X96.853 Y109.492 E6.90656
+G1 X96.758 Y109.460 E6.90989
+G1 X96.664 Y109.427 E6.91323
+G1 X96.569 Y109.393 E6.91656
+G1 X96.476 Y109.358 E6.91989
+G1 X96.382 Y109.323 E6.92322
+G1 X96.289 Y109.286 E6.92655
+G1 X96.196 Y109.248 E6.92988
+G1 X96.104 Y109.210 E6.93322
+G1 X96.012 Y109.170 E6.93655
+G1 X95.920 Y109.130 E6.93988
+G1 X95.829 Y109.089 E6.94321
+G1 X95.739 Y109.047 E6.94654
+G1 X95.648 Y109.003 E6.94987
+G1 X95.558 Y108.959 E6.95321
+G1 X95.469 Y108.915 E6.95654
+G1 X95.380 Y108.869 E6.95987
+G1 X95.292 Y108.822 E6.96320
+G1 X95.204 Y108.775 E6.96653
+G1 X95.116 Y108.726 E6.96986
+G1 X95.029 Y108.677 E6.97320
+G1 X94.942 Y108.627 E6.97653
+G1 X94.856 Y108.576 E6.97986
+G1 X94.771 Y108.524 E6.98319
+G1 X94.686 Y108.471 E6.98652
+G1 X94.601 Y108.417 E6.98985
+G1 X94.517 Y108.363 E6.99319
+G1 X94.434 Y108.308 E6.99652
+G1 X94.351 Y108.252 E6.99985
+G1 X94.269 Y108.195 E7.00318
+G1 X94.187 Y108.137 E7.00651
+G1 X94.106 Y108.078 E7.00984
+G1 X94.025 Y108.019 E7.01318
+G1 X93.946 Y107.959 E7.01651
+G1 X93.866 Y107.898 E7.01984
+G1 X93.787 Y107.836 E7.02317
+G1 X93.709 Y107.774 E7.02650
+G1 X93.632 Y107.710 E7.02983
+G1 X93.555 Y107.646 E7.03317
+G1 X93.479 Y107.581 E7.03650
+G1 X93.403 Y107.516 E7.03983
+G1 X93.329 Y107.449 E7.04316
+G1 X93.254 Y107.382 E7.04649
+G1 X93.181 Y107.314 E7.04982
+G1 X93.108 Y107.246 E7.05316
+G1 X93.036 Y107.176 E7.05649
+G1 X92.964 Y107.106 E7.05982
+G1 X92.894 Y107.036 E7.06315
+G1 X92.824 Y106.964 E7.06648
+G1 X92.754 Y106.892 E7.06981
+G1 X92.686 Y106.819 E7.07315
+G1 X92.618 Y106.746 E7.07648
+G1 X92.551 Y106.671 E7.07981
+G1 X92.484 Y106.597 E7.08314
+G1 X92.419 Y106.521 E7.08647
+G1 X92.354 Y106.445 E7.08980
+G1 X92.290 Y106.368 E7.09314
+G1 X92.226 Y106.291 E7.09647
+G1 X92.164 Y106.213 E7.09980
+G1 X92.102 Y106.134 E7.10313
+G1 X92.041 Y106.054 E7.10646
+G1 X91.981 Y105.975 E7.10979
+G1 X91.922 Y105.894 E7.11313
+G1 X91.863 Y105.813 E7.11646
+G1 X91.805 Y105.731 E7.11979
+G1 X91.748 Y105.649 E7.12312
+G1 X91.692 Y105.566 E7.12645
+G1 X91.637 Y105.483 E7.12978
+G1 X91.583 Y105.399 E7.13312
+G1 X91.529 Y105.314 E7.13645
+G1 X91.476 Y105.229 E7.13978
+G1 X91.424 Y105.144 E7.14311
+G1 X91.373 Y105.058 E7.14644
+G1 X91.323 Y104.971 E7.14977
+G1 X91.274 Y104.884 E7.15311
+G1 X91.225 Y104.796 E7.15644
+G1 X91.178 Y104.708 E7.15977
+G1 X91.131 Y104.620 E7.16310
+G1 X91.085 Y104.531 E7.16643
+G1 X91.041 Y104.442 E7.16976
+G1 X90.997 Y104.352 E7.17310
+G1 X90.953 Y104.261 E7.17643
+G1 X90.911 Y104.171 E7.17976
+G1 X90.870 Y104.080 E7.18309
+G1 X90.830 Y103.988 E7.18642
+G1 X90.790 Y103.896 E7.18975
+G1 X90.752 Y103.804 E7.19309
+G1 X90.714 Y103.711 E7.19642
+G1 X90.677 Y103.618 E7.19975
+G1 X90.642 Y103.524 E7.20308
+G1 X90.607 Y103.431 E7.20641
+G1 X90.573 Y103.336 E7.20974
+G1 X90.540 Y103.242 E7.21308
+G1 X90.508 Y103.147 E7.21641
+G1 X90.477 Y103.052 E7.21974
+G1 X90.447 Y102.957 E7.22307
+G1 X90.418 Y102.861 E7.22640
+G1 X90.390 Y102.765 E7.22974
+G1 X90.363 Y102.669 E7.23307
+G1 X90.336 Y102.572 E7.23640
+G1 X90.311 Y102.475 E7.23973
+G1 X90.287 Y102.378 E7.24306
+G1 X90.264 Y102.281 E7.24639
+G1 X90.241 Y102.183 E7.24973
+G1 X90.220 Y102.086 E7.25306
+G1 X90.200 Y101.988 E7.25639
+G1 X90.180 Y101.890 E7.25972
+G1 X90.162 Y101.791 E7.26305
+G1 X90.144 Y101.693 E7.26638
+G1 X90.128 Y101.594 E7.26972
+G1 X90.112 Y101.495 E7.27305
+G1 X90.098 Y101.396 E7.27638
+G1 X90.084 Y101.297 E7.27971
+G1 X90.072 Y101.198 E7.28304
+G1 X90.061 Y101.098 E7.28637
+G1 X90.050 Y100.999 E7.28971
+G1 X90.041 Y100.899 E7.29304
+G1 X90.032 Y100.800 E7.29637
+G1 X90.025 Y100.700 E7.29970
+G1 X90.018 Y100.600 E7.30303
+G1 X90.013 Y100.500 E7.30636
+G1 X90.008 Y100.400 E7.30970
+G1 X90.005 Y100.300 E7.31303
+G1 X90.002 Y100.200 E7.31636
+G1 X90.001 Y100.100 E7.31969
+G1 X90.000 Y100.000 E7.32302
+G1 X90.001 Y99.900 E7.32635
+G1 X90.002 Y99.800 E7.32969
+G1 X90.005 Y99.700 E7.33302
+G1 X90.008 Y99.600 E7.33635
+G1 X90.013 Y99.500 E7.33968
+G1 X90.018 Y99.400 E7.34301
+G1 X90.025 Y99.300 E7.34634
+G1 X90.032 Y99.200 E7.34968
+G1 X90.041 Y99.101 E7.35301
+G1 X90.050 Y99.001 E7.35634
+G1 X90.061 Y98.902 E7.35967
+G1 X90.072 Y98.802 E7.36300
+G1 X90.084 Y98.703 E7.36633
+G1 X90.098 Y98.604 E7.36967
+G1 X90.112 Y98.505 E7.37300
+G1 X90.128 Y98.406 E7.37633
+G1 X90.144 Y98.307 E7.37966
+G1 X90.162 Y98.209 E7.38299
+G1 X90.180 Y98.110 E7.38632
+G1 X90.200 Y98.012 E7.38966
+G1 X90.220 Y97.914 E7.39299
+G1 X90.241 Y97.817 E7.39632
+G1 X90.264 Y97.719 E7.39965
+G1 X90.287 Y97.622 E7.40298
+G1 X90.311 Y97.525 E7.40631
+G1 X90.336 Y97.428 E7.40965
+G1 X90.363 Y97.331 E7.41298
+G1 X90.390 Y97.235 E7.41631
+G1 X90.418 Y97.139 E7.41964
+G1 X90.447 Y97.043 E7.42297
+G1 X90.477 Y96.948 E7.42630
+G1 X90.508 Y96.853 E7.42964
+G1 X90.540 Y96.758 E7.43297
+G1 X90.573 Y96.664 E7.43630
+G1 X90.607 Y96.569 E7.43963
+G1 X90.642 Y96.476 E7.44296
+G1 X90.677 Y96.382 E7.44629
+G1 X90.714 Y96.289 E7.44963
+G1 X90.752 Y96.196 E7.45296
+G1 X90.790 Y96.104 E7.45629
+G1 X90.830 Y96.012 E7.45962
+G1 X90.870 Y95.920 E7.46295
+G1 X90.911 Y95.829 E7.46628
+G1 X90.953 Y95.739 E7.46962
+G1 X90.997 Y95.648 E7.47295
+G1 X91.041 Y95.558 E7.47628
+G1 X91.085 Y95.469 E7.47961
+G1 X91.131 Y95.380 E7.48294
+G1 X91.178 Y95.292 E7.48627
+G1 X91.225 Y95.204 E7.48961
+G1 X91.274 Y95.116 E7.49294
+G1 X91.323 Y95.029 E7.49627
+G1 X91.373 Y94.942 E7.49960
+G1 X91.424 Y94.856 E7.50293
+G1 X91.476 Y94.771 E7.50626
+G1 X91.529 Y94.686 E7.50960
+G1 X91.583 Y94.601 E7.51293
+G1 X91.637 Y94.517 E7.51626
+G1 X91.692 Y94.434 E7.51959
+G1 X91.748 Y94.351 E7.52292
+G1 X91.805 Y94.269 E7.52625
+G1 X91.863 Y94.187 E7.52959
+G1 X91.922 Y94.106 E7.53292
+G1 X91.981 Y94.025 E7.53625
+G1 X92.041 Y93.946 E7.53958
+G1 X92.102 Y93.866 E7.54291
+G1 X92.164 Y93.787 E7.54624
+G1 X92.226 Y93.709 E7.54958
+G1 X92.290 Y93.632 E7.55291
+G1 X92.354 Y93.555 E7.55624
+G1 X92.419 Y93.479 E7.55957
+G1 X92.484 Y93.403 E7.56290
+G1 X92.551 Y93.329 E7.56623
+G1 X92.618 Y93.254 E7.56957
+G1 X92.686 Y93.181 E7.57290
+G1 X92.754 Y93.108 E7.57623
+G1 X92.824 Y93.036 E7.57956
+G1 X92.894 Y92.964 E7.58289
+G1 X92.964 Y92.894 E7.58622
+G1 X93.036 Y92.824 E7.58956
+G1 X93.108 Y92.754 E7.59289
+G1 X93.181 Y92.686 E7.59622
+G1 X93.254 Y92.618 E7.59955
+G1 X93.329 Y92.551 E7.60288
+G1 X93.403 Y92.484 E7.60621
+G1 X93.479 Y92.419 E7.60955
+G1 X93.555 Y92.354 E7.61288
+G1 X93.632 Y92.290 E7.61621
+G1 X93.709 Y92.226 E7.61954
+G1 X93.787 Y92.164 E7.62287
+G1 X93.866 Y92.102 E7.62620
+G1 X93.946 Y92.041 E7.62954
+G1 X94.025 Y91.981 E7.63287
+G1 X94.106 Y91.922 E7.63620
+G1 X94.187 Y91.863 E7.63953
+G1 X94.269 Y91.805 E7.64286
+G1 X94.351 Y91.748 E7.64619
+G1 X94.434 Y91.692 E7.64953
+G1 X94.517 Y91.637 E7.65286
+G1 X94.601 Y91.583 E7.65619
+G1 X94.686 Y91.529 E7.65952
+G1 X94.771 Y91.476 E7.66285
+G1 X94.856 Y91.424 E7.66618
+G1 X94.942 Y91.373 E7.66952
+G1 X95.029 Y91.323 E7.67285
+G1 X95.116 Y91.274 E7.67618
+G1 X95.204 Y91.225 E7.67951
+G1 X95.292 Y91.178 E7.68284
+G1 X95.380 Y91.131 E7.68617
+G1 X95.469 Y91.085 E7.68951
+G1 X95.558 Y91.041 E7.69284
+G1 X95.648 Y90.997 E7.69617
+G1 X95.739 Y90.953 E7.69950
+G1 X95.829 Y90.911 E7.70283
+G1 X95.920 Y90.870 E7.70616
+G1 X96.012 Y90.830 E7.70950
+G1 X96.104 Y90.790 E7.71283
+G1 X96.196 Y90.752 E7.71616
+G1 X96.289 Y90.714 E7.71949
+G1 X96.382 Y90.677 E7.72282
+G1 X96.476 Y90.642 E7.72615
+G1 X96.569 Y90.607 E7.72949
+G1 X96.664 Y90.573 E7.73282
+G1 X96.758 Y90.540 E7.73615
+G1 X96.853 Y90.508 E7.73948
+G1 X96.948 Y90.477 E7.74281
+G1 X97.043 Y90.447 E7.74614
+G1 X97.139 Y90.418 E7.74948
+G1 X97.235 Y90.390 E7.75281
+G1 X97.331 Y90.363 E7.75614
+G1 X97.428 Y90.336 E7.75947
+G1 X97.525 Y90.311 E7.76280
+G1 X97.622 Y90.287 E7.76613
+G1 X97.719 Y90.264 E7.76947
+G1 X97.817 Y90.241 E7.77280
+G1 X97.914 Y90.220 E7.77613
+G1 X98.012 Y90.200 E7.77946
+G1 X98.110 Y90.180 E7.78279
+G1 X98.209 Y90.162 E7.78612
+G1 X98.307 Y90.144 E7.78946
+G1 X98.406 Y90.128 E7.79279
+G1 X98.505 Y90.112 E7.79612
+G1 X98.604 Y90.098 E7.79945
+G1 X98.703 Y90.084 E7.80278
+G1 X98.802 Y90.072 E7.80611
+G1 X98.902 Y90.061 E7.80945
+G1 X99.001 Y90.050 E7.81278
+G1 X99.101 Y90.041 E7.81611
+G1 X99.200 Y90.032 E7.81944
+G1 X99.300 Y90.025 E7.82277
+G1 X99.400 Y90.018 E7.82610
+G1 X99.500 Y90.013 E7.82944
+G1 X99.600 Y90.008 E7.83277
+G1 X99.700 Y90.005 E7.83610
+G1 X99.800 Y90.002 E7.83943
+G1 X99.900 Y90.001 E7.84276
+G1 X100.000 Y90.000 E7.84609
+G1 X100.100 Y90.001 E7.84943
+G1 X100.200 Y90.002 E7.85276
+G1 X100.300 Y90.005 E7.85609
+G1 X100.400 Y90.008 E7.85942
+G1 X100.500 Y90.013 E7.86275
+G1 X100.600 Y90.018 E7.86608
+G1 X100.700 Y90.025 E7.86942
+G1 X100.800 Y90.032 E7.87275
+G1 X100.899 Y90.041 E7.87608
+G1 X100.999 Y90.050 E7.87941
+G1 X101.098 Y90.061 E7.88274
+G1 X101.198 Y90.072 E7.88608
+G1 X101.297 Y90.084 E7.88941
+G1 X101.396 Y90.098 E7.89274
+G1 X101.495 Y90.112 E7.89607
+G1 X101.594 Y90.128 E7.89940
+G1 X101.693 Y90.144 E7.90273
+G1 X101.791 Y90.162 E7.90607
+G1 X101.890 Y90.180 E7.90940
+G1 X101.988 Y90.200 E7.91273
+G1 X102.086 Y90.220 E7.91606
+G1 X102.183 Y90.241 E7.91939
+G1 X102.281 Y90.264 E7.92272
+G1 X102.378 Y90.287 E7.92606
+G1 X102.475 Y90.311 E7.92939
+G1 X102.572 Y90.336 E7.93272
+G1 X102.669 Y90.363 E7.93605
+G1 X102.765 Y90.390 E7.93938
+G1 X102.861 Y90.418 E7.94271
+G1 X102.957 Y90.447 E7.94605
+G1 X103.052 Y90.477 E7.94938
+G1 X103.147 Y90.508 E7.95271
+G1 X103.242 Y90.540 E7.95604
+G1 X103.336 Y90.573 E7.95937
+G1 X103.431 Y90.607 E7.96270
+G1 X103.524 Y90.642 E7.96604
+G1 X103.618 Y90.677 E7.96937
+G1 X103.711 Y90.714 E7.97270
+G1 X103.804 Y90.752 E7.97603
+G1 X103.896 Y90.790 E7.97936
+G1 X103.988 Y90.830 E7.98269
+G1 X104.080 Y90.870 E7.98603
+G1 X104.171 Y90.911 E7.98936
+G1 X104.261 Y90.953 E7.99269
+G1 X104.352 Y90.997 E7.99602
+G1 X104.442 Y91.041 E7.99935
+G1 X104.531 Y91.085 E8.00268
+G1 X104.620 Y91.131 E8.00602
+G1 X104.708 Y91.178 E8.00935
+G1 X104.796 Y91.225 E8.01268
+G1 X104.884 Y91.274 E8.01601
+G1 X104.971 Y91.323 E8.01934
+G1 X105.058 Y91.373 E8.02267
+G1 X105.144 Y91.424 E8.02601
+G1 X105.229 Y91.476 E8.02934
+G1 X105.314 Y91.529 E8.03267
+G1 X105.399 Y91.583 E8.03600
+G1 X105.483 Y91.637 E8.03933
+G1 X105.566 Y91.692 E8.04266
+G1 X105.649 Y91.748 E8.04600
+G1 X105.731 Y91.805 E8.04933
+G1 X105.813 Y91.863 E8.05266
+G1 X105.894 Y91.922 E8.05599
+G1 X105.975 Y91.981 E8.05932
+G1 X106.054 Y92.041 E8.06265
+G1 X106.134 Y92.102 E8.06599
+G1 X106.213 Y92.164 E8.06932
+G1 X106.291 Y92.226 E8.07265
+G1 X106.368 Y92.290 E8.07598
+G1 X106.445 Y92.354 E8.07931
+G1 X106.521 Y92.419 E8.08264
+G1 X106.597 Y92.484 E8.08598
+G1 X106.671 Y92.551 E8.08931
+G1 X106.746 Y92.618 E8.09264
+G1 X106.819 Y92.686 E8.09597
+G1 X106.892 Y92.754 E8.09930
+G1 X106.964 Y92.824 E8.10263
+G1 X107.036 Y92.894 E8.10597
+G1 X107.106 Y92.964 E8.10930
+G1 X107.176 Y93.036 E8.11263
+G1 X107.246 Y93.108 E8.11596
+G1 X107.314 Y93.181 E8.11929
+G1 X107.382 Y93.254 E8.12262
+G1 X107.449 Y93.329 E8.12596
+G1 X107.516 Y93.403 E8.12929
+G1 X107.581 Y93.479 E8.13262
+G1 X107.646 Y93.555 E8.13595
+G1 X107.710 Y93.632 E8.13928
+G1 X107.774 Y93.709 E8.14261
+G1 X107.836 Y93.787 E8.14595
+G1 X107.898 Y93.866 E8.14928
+G1 X107.959 Y93.946 E8.15261
+G1 X108.019 Y94.025 E8.15594
+G1 X108.078 Y94.106 E8.15927
+G1 X108.137 Y94.187 E8.16260
+G1 X108.195 Y94.269 E8.16594
+G1 X108.252 Y94.351 E8.16927
+G1 X108.308 Y94.434 E8.17260
+G1 X108.363 Y94.517 E8.17593
+G1 X108.417 Y94.601 E8.17926
+G1 X108.471 Y94.686 E8.18259
+G1 X108.524 Y94.771 E8.18593
+G1 X108.576 Y94.856 E8.18926
+G1 X108.627 Y94.942 E8.19259
+G1 X108.677 Y95.029 E8.19592
+G1 X108.726 Y95.116 E8.19925
+G1 X108.775 Y95.204 E8.20258
+G1 X108.822 Y95.292 E8.20592
+G1 X108.869 Y95.380 E8.20925
+G1 X108.915 Y95.469 E8.21258
+G1 X108.959 Y95.558 E8.21591
+G1 X109.003 Y95.648 E8.21924
+G1 X109.047 Y95.739 E8.22257
+G1 X109.089 Y95.829 E8.22591
+G1 X109.130 Y95.920 E8.22924
+G1 X109.170 Y96.012 E8.23257
+G1 X109.210 Y96.104 E8.23590
+G1 X109.248 Y96.196 E8.23923
+G1 X109.286 Y96.289 E8.24256
+G1 X109.323 Y96.382 E8.24590
+G1 X109.358 Y96.476 E8.24923
+G1 X109.393 Y96.569 E8.25256
+G1 X109.427 Y96.664 E8.25589
+G1 X109.460 Y96.758 E8.25922
+G1 X109.492 Y96.853 E8.26255
+G1 X109.523 Y96.948 E8.26589
+G1 X109.553 Y97.043 E8.26922
+G1 X109.582 Y97.139 E8.27255
+G1 X109.610 Y97.235 E8.27588
+G1 X109.637 Y97.331 E8.27921
+G1 X109.664 Y97.428 E8.28254
+G1 X109.689 Y97.525 E8.28588
+G1 X109.713 Y97.622 E8.28921
+G1 X109.736 Y97.719 E8.29254
+G1 X109.759 Y97.817 E8.29587
+G1 X109.780 Y97.914 E8.29920
+G1 X109.800 Y98.012 E8.30253
+G1 X109.820 Y98.110 E8.30587
+G1 X109.838 Y98.209 E8.30920
+G1 X109.856 Y98.307 E8.31253
+G1 X109.872 Y98.406 E8.31586
+G1 X109.888 Y98.505 E8.31919
+G1 X109.902 Y98.604 E8.32252
+G1 X109.916 Y98.703 E8.32586
+G1 X109.928 Y98.802 E8.32919
+G1 X109.939 Y98.902 E8.33252
+G1 X109.950 Y99.001 E8.33585
+G1 X109.959 Y99.101 E8.33918
+G1 X109.968 Y99.200 E8.34251
+G1 X109.975 Y99.300 E8.34585
+G1 X109.982 Y99.400 E8.34918
+G1 X109.987 Y99.500 E8.35251
+G1 X109.992 Y99.600 E8.35584
+G1 X109.995 Y99.700 E8.35917
+G1 X109.998 Y99.800 E8.36250
+G1 X109.999 Y99.900 E8.36584
+G1 X110.000 Y100.000 E8.36917
+G1 X109.999 Y100.100 E8.37250
+G1 X109.998 Y100.200 E8.37583
+G1 X109.995 Y100.300 E8.37916
+G1 X109.992 Y100.400 E8.38249
+G1 X109.987 Y100.500 E8.38583
+G1 X109.982 Y100.600 E8.38916
+G1 X109.975 Y100.700 E8.39249
+G1 X109.968 Y100.800 E8.39582
+G1 X109.959 Y100.899 E8.39915
+G1 X109.950 Y100.999 E8.40248
+G1 X109.939 Y101.098 E8.40582
+G1 X109.928 Y101.198 E8.40915
+G1 X109.916 Y101.297 E8.41248
+G1 X109.902 Y101.396 E8.41581
+G1 X109.888 Y101.495 E8.41914
+G1 X109.872 Y101.594 E8.42247
+G1 X109.856 Y101.693 E8.42581
+G1 X109.838 Y101.791 E8.42914
+G1 X109.820 Y101.890 E8.43247
+G1 X109.800 Y101.988 E8.43580
+G1 X109.780 Y102.086 E8.43913
+G1 X109.759 Y102.183 E8.44246
+G1 X109.736 Y102.281 E8.44580
+G1 X109.713 Y102.378 E8.44913
+G1 X109.689 Y102.475 E8.45246
+G1 X109.664 Y102.572 E8.45579
+G1 X109.637 Y102.669 E8.45912
+G1 X109.610 Y102.765 E8.46245
+G1 X109.582 Y102.861 E8.46579
+G1 X109.553 Y102.957 E8.46912
+G1 X109.523 Y103.052 E8.47245
+G1 X109.492 Y103.147 E8.47578
+G1 X109.460 Y103.242 E8.47911
+G1 X109.427 Y103.336 E8.48244
+G1 X109.393 Y103.431 E8.48578
+G1 X109.358 Y103.524 E8.48911
+G1 X109.323 Y103.618 E8.49244
+G1 X109.286 Y103.711 E8.49577
+G1 X109.248 Y103.804 E8.49910
+G1 X109.210 Y103.896 E8.50243
+G1 X109.170 Y103.988 E8.50577
+G1 X109.130 Y104.080 E8.50910
+G1 X109.089 Y104.171 E8.51243
+G1 X109.047 Y104.261 E8.51576
+G1 X109.003 Y104.352 E8.51909
+G1 X108.959 Y104.442 E8.52242
+G1 X108.915 Y104.531 E8.52576
+G1 X108.869 Y104.620 E8.52909
+G1 X108.822 Y104.708 E8.53242
+G1 X108.775 Y104.796 E8.53575
+G1 X108.726 Y104.884 E8.53908
+G1 X108.677 Y104.971 E8.54242
+G1 X108.627 Y105.058 E8.54575
+G1 X108.576 Y105.144 E8.54908
+G1 X108.524 Y105.229 E8.55241
+G1 X108.471 Y105.314 E8.55574
+G1 X108.417 Y105.399 E8.55907
+G1 X108.363 Y105.483 E8.56241
+G1 X108.308 Y105.566 E8.56574
+G1 X108.252 Y105.649 E8.56907
+G1 X108.195 Y105.731 E8.57240
+G1 X108.137 Y105.813 E8.57573
+G1 X108.078 Y105.894 E8.57906
+G1 X108.019 Y105.975 E8.58240
+G1 X107.959 Y106.054 E8.58573
+G1 X107.898 Y106.134 E8.58906
+G1 X107.836 Y106.213 E8.59239
+G1 X107.774 Y106.291 E8.59572
+G1 X107.710 Y106.368 E8.59905
+G1 X107.646 Y106.445 E8.60239
+G1 X107.581 Y106.521 E8.60572
+G1 X107.516 Y106.597 E8.60905
+G1 X107.449 Y106.671 E8.61238
+G1 X107.382 Y106.746 E8.61571
+G1 X107.314 Y106.819 E8.61904
+G1 X107.246 Y106.892 E8.62238
+G1 X107.176 Y106.964 E8.62571
+G1 X107.106 Y107.036 E8.62904
+G1 X107.036 Y107.106 E8.63237
+G1 X106.964 Y107.176 E8.63570
+G1 X106.892 Y107.246 E8.63903
+G1 X106.819 Y107.314 E8.64237
+G1 X106.746 Y107.382 E8.64570
+G1 X106.671 Y107.449 E8.64903
+G1 X106.597 Y107.516 E8.65236
+G1 X106.521 Y107.581 E8.65569
+G1 X106.445 Y107.646 E8.65902
+G1 X106.368 Y107.710 E8.66236
+G1 X106.291 Y107.774 E8.66569
+G1 X106.213 Y107.836 E8.66902
+G1 X106.134 Y107.898 E8.67235
+G1 X106.054 Y107.959 E8.67568
+G1 X105.975 Y108.019 E8.67901
+G1 X105.894 Y108.078 E8.68235
+G1 X105.813 Y108.137 E8.68568
+G1 X105.731 Y108.195 E8.68901
+G1 X105.649 Y108.252 E8.69234
+G1 X105.566 Y108.308 E8.69567
+G1 X105.483 Y108.363 E8.69900
+G1 X105.399 Y108.417 E8.70234
+G1 X105.314 Y108.471 E8.70567
+G1 X105.229 Y108.524 E8.70900
+G1 X105.144 Y108.576 E8.71233
+G1 X105.058 Y108.627 E8.71566
+G1 X104.971 Y108.677 E8.71899
+G1 X104.884 Y108.726 E8.72233
+G1 X104.796 Y108.775 E8.72566
+G1 X104.708 Y108.822 E8.72899
+G1 X104.620 Y108.869 E8.73232
+G1 X104.531 Y108.915 E8.73565
+G1 X104.442 Y108.959 E8.73898
+G1 X104.352 Y109.003 E8.74232
+G1 X104.261 Y109.047 E8.74565
+G1 X104.171 Y109.089 E8.74898
+G1 X104.080 Y109.130 E8.75231
+G1 X103.988 Y109.170 E8.75564
+G1 X103.896 Y109.210 E8.75897
+G1 X103.804 Y109.248 E8.76231
+G1 X103.711 Y109.286 E8.76564
+G1 X103.618 Y109.323 E8.76897
+G1 X103.524 Y109.358 E8.77230
+G1 X103.431 Y109.393 E8.77563
+G1 X103.336 Y109.427 E8.77896
+G1 X103.242 Y109.460 E8.78230
+G1 X103.147 Y109.492 E8.78563
+G1 X103.052 Y109.523 E8.78896
+G1 X102.957 Y109.553 E8.79229
+G1 X102.861 Y109.582 E8.79562
+G1 X102.765 Y109.610 E8.79895
+G1 X102.669 Y109.637 E8.80229
+G1 X102.572 Y109.664 E8.80562
+G1 X102.475 Y109.689 E8.80895
+G1 X102.378 Y109.713 E8.81228
+G1 X102.281 Y109.736 E8.81561
+G1 X102.183 Y109.759 E8.81894
+G1 X102.086 Y109.780 E8.82228
+G1 X101.988 Y109.800 E8.82561
+G1 X101.890 Y109.820 E8.82894
+G1 X101.791 Y109.838 E8.83227
+G1 X101.693 Y109.856 E8.83560
+G1 X101.594 Y109.872 E8.83893
+G1 X101.495 Y109.888 E8.84227
+G1 X101.396 Y109.902 E8.84560
+G1 X101.297 Y109.916 E8.84893
+G1 X101.198 Y109.928 E8.85226
+G1 X101.098 Y109.939 E8.85559
+G1 X100.999 Y109.950 E8.85892
+G1 X100.899 Y109.959 E8.86226
+G1 X100.800 Y109.968 E8.86559
+G1 X100.700 Y109.975 E8.86892
+G1 X100.600 Y109.982 E8.87225
+G1 X100.500 Y109.987 E8.87558
+G1 X100.400 Y109.992 E8.87891
+G1 X100.300 Y109.995 E8.88225
+G1 X100.200 Y109.998 E8.88558
+G1 X100.100 Y109.999 E8.88891
+G1 X100.000 Y110.000 E8.89224
+G1 X99.900 Y109.999 E8.89557
+G1 X99.800 Y109.998 E8.89890
+G1 X99.700 Y109.995 E8.90224
+G1 X99.600 Y109.992 E8.90557
+G1 X99.500 Y109.987 E8.90890
+G1 X99.400 Y109.982 E8.91223
+G1 X99.300 Y109.975 E8.91556
+G1 X99.200 Y109.968 E8.91889
+G1 X99.101 Y109.959 E8.92223
+G1 X99.001 Y109.950 E8.92556
+G1 X98.902 Y109.939 E8.92889
+G1 X98.802 Y109.928 E8.93222
+G1 X98.703 Y109.916 E8.93555
+G1 X98.604 Y109.902 E8.93888
+G1 X98.505 Y109.888 E8.94222
+G1 X98.406 Y109.872 E8.94555
+G1 X98.307 Y109.856 E8.94888
+G1 X98.209 Y109.838 E8.95221
+G1 X98.110 Y109.820 E8.95554
+G1 X98.012 Y109.800 E8.95887
+G1 X97.914 Y109.780 E8.96221
+G1 X97.817 Y109.759 E8.96554
+G1 X97.719 Y109.736 E8.96887
+G1 X97.622 Y109.713 E8.97220
+G1 X97.525 Y109.689 E8.97553
+G1 X97.428 Y109.664 E8.97886
+G1 X97.331 Y109.637 E8.98220
+G1 X97.235 Y109.610 E8.98553
+G1 X97.139 Y109.582 E8.98886
+G1 X97.043 Y109.553 E8.99219
+G1 X96.948 Y109.523 E8.99552
+G1 X96.853 Y109.492 E8.99885
+G1 X96.758 Y109.460 E9.00219
+G1 X96.664 Y109.427 E9.00552
+G1 X96.569 Y109.393 E9.00885
+G1 X96.476 Y109.358 E9.01218
+G1 X96.382 Y109.323 E9.01551
+G1 X96.289 Y109.286 E9.01884
+G1 X96.196 Y109.248 E9.02218
+G1 X96.104 Y109.210 E9.02551
+G1 X96.012 Y109.170 E9.02884
+G1 X95.920 Y109.130 E9.03217
+G1 X95.829 Y109.089 E9.03550
+G1 X95.739 Y109.047 E9.03883
+G1 X95.648 Y109.003 E9.04217
+G1 X95.558 Y108.959 E9.04550
+G1 X95.469 Y108.915 E9.04883
+G1 X95.380 Y108.869 E9.05216
+G1 X95.292 Y108.822 E9.05549
+G1 X95.204 Y108.775 E9.05882
+G1 X95.116 Y108.726 E9.06216
+G1 X95.029 Y108.677 E9.06549
+G1 X94.942 Y108.627 E9.06882
+G1 X94.856 Y108.576 E9.07215
+G1 X94.771 Y108.524 E9.07548
+G1 X94.686 Y108.471 E9.07881
+G1 X94.601 Y108.417 E9.08215
+G1 X94.517 Y108.363 E9.08548
+G1 X94.434 Y108.308 E9.08881
+G1 X94.351 Y108.252 E9.09214
+G1 X94.269 Y108.195 E9.09547
+G1 X94.187 Y108.137 E9.09880
+G1 X94.106 Y108.078 E9.10214
+G1 X94.025 Y108.019 E9.10547
+G1 X93.946 Y107.959 E9.10880
+G1 X93.866 Y107.898 E9.11213
+G1 X93.787 Y107.836 E9.11546
+G1 X93.709 Y107.774 E9.11879
+G1 X93.632 Y107.710 E9.12213
+G1 X93.555 Y107.646 E9.12546
+G1 X93.479 Y107.581 E9.12879
+G1 X93.403 Y107.516 E9.13212
+G1 X93.329 Y107.449 E9.13545
+G1 X93.254 Y107.382 E9.13878
+G1 X93.181 Y107.314 E9.14212
+G1 X93.108 Y107.246 E9.14545
+G1 X93.036 Y107.176 E9.14878
+G1 X92.964 Y107.106 E9.15211
+G1 X92.894 Y107.036 E9.15544
+G1 X92.824 Y106.964 E9.15877
+G1 X92.754 Y106.892 E9.16211
+G1 X92.686 Y106.819 E9.16544
+G1 X92.618 Y106.746 E9.16877
+G1 X92.551 Y106.671 E9.17210
+G1 X92.484 Y106.597 E9.17543
+G1 X92.419 Y106.521 E9.17876
+G1 X92.354 Y106.445 E9.18210
+G1 X92.290 Y106.368 E9.18543
+G1 X92.226 Y106.291 E9.18876
+G1 X92.164 Y106.213 E9.19209
+G1 X92.102 Y106.134 E9.19542
+G1 X92.041 Y106.054 E9.19876
+G1 X91.981 Y105.975 E9.20209
+G1 X91.922 Y105.894 E9.20542
+G1 X91.863 Y105.813 E9.20875
+G1 X91.805 Y105.731 E9.21208
+G1 X91.748 Y105.649 E9.21541
+G1 X91.692 Y105.566 E9.21875
+G1 X91.637 Y105.483 E9.22208
+G1 X91.583 Y105.399 E9.22541
+G1 X91.529 Y105.314 E9.22874
+G1 X91.476 Y105.229 E9.23207
+G1 X91.424 Y105.144 E9.23540
+G1 X91.373 Y105.058 E9.23874
+G1 X91.323 Y104.971 E9.24207
+G1 X91.274 Y104.884 E9.24540
+G1 X91.225 Y104.796 E9.24873
+G1 X91.178 Y104.708 E9.25206
+G1 X91.131 Y104.620 E9.25539
+G1 X91.085 Y104.531 E9.25873
+G1 X91.041 Y104.442 E9.26206
+G1 X90.997 Y104.352 E9.26539
+G1 X90.953 Y104.261 E9.26872
+G1 X90.911 Y104.171 E9.27205
+G1 X90.870 Y104.080 E9.27538
+G1 X90.830 Y103.988 E9.27872
+G1 X90.790 Y103.896 E9.28205
+G1 X90.752 Y103.804 E9.28538
+G1 X90.714 Y103.711 E9.28871
+G1 X90.677 Y103.618 E9.29204
+G1 X90.642 Y103.524 E9.29537
+G1 X90.607 Y103.431 E9.29871
+G1 X90.573 Y103.336 E9.30204
+G1 X90.540 Y103.242 E9.30537
+G1 X90.508 Y103.147 E9.30870
+G1 X90.477 Y103.052 E9.31203
+G1 X90.447 Y102.957 E9.31536
+G1 X90.418 Y102.861 E9.31870
+G1 X90.390 Y102.765 E9.32203
+G1 X90.363 Y102.669 E9.32536
+G1 X90.336 Y102.572 E9.32869
+G1 X90.311 Y102.475 E9.33202
+G1 X90.287 Y102.378 E9.33535
+G1 X90.264 Y102.281 E9.33869
+G1 X90.241 Y102.183 E9.34202
+G1 X90.220 Y102.086 E9.34535
+G1 X90.200 Y101.988 E9.34868
+G1 X90.180 Y101.890 E9.35201
+G1 X90.162 Y101.791 E9.35534
+G1 X90.144 Y101.693 E9.35868
+G1 X90.128 Y101.594 E9.36201
+G1 X90.112 Y101.495 E9.36534
+G1 X90.098 Y101.396 E9.36867
+G1 X90.084 Y101.297 E9.37200
+G1 X90.072 Y101.198 E9.37533
+G1 X90.061 Y101.098 E9.37867
+G1 X90.050 Y100.999 E9.38200
+G1 X90.041 Y100.899 E9.38533
+G1 X90.032 Y100.800 E9.38866
+G1 X90.025 Y100.700 E9.39199
+G1 X90.018 Y100.600 E9.39532
+G1 X90.013 Y100.500 E9.39866
+G1 X90.008 Y100.400 E9.40199
+G1 X90.005 Y100.300 E9.40532
+G1 X90.002 Y100.200 E9.40865
+G1 X90.001 Y100.100 E9.41198
+G1 X90.000 Y100.000 E9.41531
+G1 X90.001 Y99.900 E9.41865
+G1 X90.002 Y99.800 E9.42198
+G1 X90.005 Y99.700 E9.42531
+G1 X90.008 Y99.600 E9.42864
+G1 X90.013 Y99.500 E9.43197
+G1 X90.018 Y99.400 E9.43530
+G1 X90.025 Y99.300 E9.43864
+G1 X90.032 Y99.200 E9.44197
+G1 X90.041 Y99.101 E9.44530
+G1 X90.050 Y99.001 E9.44863
+G1 X90.061 Y98.902 E9.45196
+G1 X90.072 Y98.802 E9.45529
+G1 X90.084 Y98.703 E9.45863
+G1 X90.098 Y98.604 E9.46196
+G1 X90.112 Y98.505 E9.46529
+G1 X90.128 Y98.406 E9.46862
+G1 X90.144 Y98.307 E9.47195
+G1 X90.162 Y98.209 E9.47528
+G1 X90.180 Y98.110 E9.47862
+G1 X90.200 Y98.012 E9.48195
+G1 X90.220 Y97.914 E9.48528
+G1 X90.241 Y97.817 E9.48861
+G1 X90.264 Y97.719 E9.49194
+G1 X90.287 Y97.622 E9.49527
+G1 X90.311 Y97.525 E9.49861
+G1 X90.336 Y97.428 E9.50194
+G1 X90.363 Y97.331 E9.50527
+G1 X90.390 Y97.235 E9.50860
+G1 X90.418 Y97.139 E9.51193
+G1 X90.447 Y97.043 E9.51526
+G1 X90.477 Y96.948 E9.51860
+G1 X90.508 Y96.853 E9.52193
+G1 X90.540 Y96.758 E9.52526
+G1 X90.573 Y96.664 E9.52859
+G1 X90.607 Y96.569 E9.53192
+G1 X90.642 Y96.476 E9.53525
+G1 X90.677 Y96.382 E9.53859
+G1 X90.714 Y96.289 E9.54192
+G1 X90.752 Y96.196 E9.54525
+G1 X90.790 Y96.104 E9.54858
+G1 X90.830 Y96.012 E9.55191
+G1 X90.870 Y95.920 E9.55524
+G1 X90.911 Y95.829 E9.55858
+G1 X90.953 Y95.739 E9.56191
+G1 X90.997 Y95.648 E9.56524
+G1 X91.041 Y95.558 E9.56857
+G1 X91.085 Y95.469 E9.57190
+G1 X91.131 Y95.380 E9.57523
+G1 X91.178 Y95.292 E9.57857
+G1 X91.225 Y95.204 E9.58190
+G1 X91.274 Y95.116 E9.58523
+G1 X91.323 Y95.029 E9.58856
+G1 X91.373 Y94.942 E9.59189
+G1 X91.424 Y94.856 E9.59522
+G1 X91.476 Y94.771 E9.59856
+G1 X91.529 Y94.686 E9.60189
+G1 X91.583 Y94.601 E9.60522
+G1 X91.637 Y94.517 E9.60855
+G1 X91.692 Y94.434 E9.61188
+G1 X91.748 Y94.351 E9.61521
+G1 X91.805 Y94.269 E9.61855
+G1 X91.863 Y94.187 E9.62188
+G1 X91.922 Y94.106 E9.62521
+G1 X91.981 Y94.025 E9.62854
+G1 X92.041 Y93.946 E9.63187
+G1 X92.102 Y93.866 E9.63520
+G1 X92.164 Y93.787 E9.63854
+G1 X92.226 Y93.709 E9.64187
+G1 X92.290 Y93.632 E9.64520
+G1 X92.354 Y93.555 E9.64853
+G1 X92.419 Y93.479 E9.65186
+G1 X92.484 Y93.403 E9.65519
+G1 X92.551 Y93.329 E9.65853
+G1 X92.618 Y93.254 E9.66186
+G1 X92.686 Y93.181 E9.66519
+G1 X92.754 Y93.108 E9.66852
+G1 X92.824 Y93.036 E9.67185
+G1 X92.894 Y92.964 E9.67518
+G1 X92.964 Y92.894 E9.67852
+G1 X93.036 Y92.824 E9.68185
+G1 X93.108 Y92.754 E9.68518
+G1 X93.181 Y92.686 E9.68851
+G1 X93.254 Y92.618 E9.69184
+G1 X93.329 Y92.551 E9.69517
+G1 X93.403 Y92.484 E9.69851
+G1 X93.479 Y92.419 E9.70184
+G1 X93.555 Y92.354 E9.70517
+G1 X93.632 Y92.290 E9.70850
+G1 X93.709 Y92.226 E9.71183
+G1 X93.787 Y92.164 E9.71516
+G1 X93.866 Y92.102 E9.71850
+G1 X93.946 Y92.041 E9.72183
+G1 X94.025 Y91.981 E9.72516
+G1 X94.106 Y91.922 E9.72849
+G1 X94.187 Y91.863 E9.73182
+G1 X94.269 Y91.805 E9.73515
+G1 X94.351 Y91.748 E9.73849
+G1 X94.434 Y91.692 E9.74182
+G1 X94.517 Y91.637 E9.74515
+G1 X94.601 Y91.583 E9.74848
+G1 X94.686 Y91.529 E9.75181
+G1 X94.771 Y91.476 E9.75514
+G1 X94.856 Y91.424 E9.75848
+G1 X94.942 Y91.373 E9.76181
+G1 X95.029 Y91.323 E9.76514
+G1 X95.116 Y91.274 E9.76847
+G1 X95.204 Y91.225 E9.77180
+G1 X95.292 Y91.178 E9.77513
+G1 X95.380 Y91.131 E9.77847
+G1 X95.469 Y91.085 E9.78180
+G1 X95.558 Y91.041 E9.78513
+G1 X95.648 Y90.997 E9.78846
+G1 X95.739 Y90.953 E9.79179
+G1 X95.829 Y90.911 E9.79512
+G1 X95.920 Y90.870 E9.79846
+G1 X96.012 Y90.830 E9.80179
+G1 X96.104 Y90.790 E9.80512
+G1 X96.196 Y90.752 E9.80845
+G1 X96.289 Y90.714 E9.81178
+G1 X96.382 Y90.677 E9.81511
+G1 X96.476 Y90.642 E9.81845
+G1 X96.569 Y90.607 E9.82178
+G1 X96.664 Y90.573 E9.82511
+G1 X96.758 Y90.540 E9.82844
+G1 X96.853 Y90.508 E9.83177
+G1 X96.948 Y90.477 E9.83510
+G1 X97.043 Y90.447 E9.83844
+G1 X97.139 Y90.418 E9.84177
+G1 X97.235 Y90.390 E9.84510
+G1 X97.331 Y90.363 E9.84843
+G1 X97.428 Y90.336 E9.85176
+G1 X97.525 Y90.311 E9.85510
+G1 X97.622 Y90.287 E9.85843
+G1 X97.719 Y90.264 E9.86176
+G1 X97.817 Y90.241 E9.86509
+G1 X97.914 Y90.220 E9.86842
+G1 X98.012 Y90.200 E9.87175
+G1 X98.110 Y90.180 E9.87509
+G1 X98.209 Y90.162 E9.87842
+G1 X98.307 Y90.144 E9.88175
+G1 X98.406 Y90.128 E9.88508
+G1 X98.505 Y90.112 E9.88841
+G1 X98.604 Y90.098 E9.89174
+G1 X98.703 Y90.084 E9.89508
+G1 X98.802 Y90.072 E9.89841
+G1 X98.902 Y90.061 E9.90174
+G1 X99.001 Y90.050 E9.90507
+G1 X99.101 Y90.041 E9.90840
+G1 X99.200 Y90.032 E9.91173
+G1 X99.300 Y90.025 E9.91507
+G1 X99.400 Y90.018 E9.91840
+G1 X99.500 Y90.013 E9.92173
+G1 X99.600 Y90.008 E9.92506
+G1 X99.700 Y90.005 E9.92839
+G1 X99.800 Y90.002 E9.93172
+G1 X99.900 Y90.001 E9.93506
+G1 X100.000 Y90.000 E9.93839
+G1 X100.100 Y90.001 E9.94172
+G1 X100.200 Y90.002 E9.94505
+G1 X100.300 Y90.005 E9.94838
+G1 X100.400 Y90.008 E9.95171
+G1 X100.500 Y90.013 E9.95505
+G1 X100.600 Y90.018 E9.95838
+G1 X100.700 Y90.025 E9.96171
+G1 X100.800 Y90.032 E9.96504
+G1 X100.899 Y90.041 E9.96837
+G1 X100.999 Y90.050 E9.97170
+G1 X101.098 Y90.061 E9.97504
+G1 X101.198 Y90.072 E9.97837
+G1 X101.297 Y90.084 E9.98170
+G1 X101.396 Y90.098 E9.98503
+G1 X101.495 Y90.112 E9.98836
+G1 X101.594 Y90.128 E9.99169
+G1 X101.693 Y90.144 E9.99503
+G1 X101.791 Y90.162 E9.99836
+G1 X101.890 Y90.180 E10.00169
+G1 X101.988 Y90.200 E10.00502
+G1 X102.086 Y90.220 E10.00835
+G1 X102.183 Y90.241 E10.01168
+G1 X102.281 Y90.264 E10.01502
+G1 X102.378 Y90.287 E10.01835
+G1 X102.475 Y90.311 E10.02168
+G1 X102.572 Y90.336 E10.02501
+G1 X102.669 Y90.363 E10.02834
+G1 X102.765 Y90.390 E10.03167
+G1 X102.861 Y90.418 E10.03501
+G1 X102.957 Y90.447 E10.03834
+G1 X103.052 Y90.477 E10.04167
+G1 X103.147 Y90.508 E10.04500
+G1 X103.242 Y90.540 E10.04833
+G1 X103.336 Y90.573 E10.05166
+G1 X103.431 Y90.607 E10.05500
+G1 X103.524 Y90.642 E10.05833
+G1 X103.618 Y90.677 E10.06166
+G1 X103.711 Y90.714 E10.06499
+G1 X103.804 Y90.752 E10.06832
+G1 X103.896 Y90.790 E10.07165
+G1 X103.988 Y90.830 E10.07499
+G1 X104.080 Y90.870 E10.07832
+G1 X104.171 Y90.911 E10.08165
+G1 X104.261 Y90.953 E10.08498
+G1 X104.352 Y90.997 E10.08831
+G1 X104.442 Y91.041 E10.09164
+G1 X104.531 Y91.085 E10.09498
+G1 X104.620 Y91.131 E10.09831
+G1 X104.708 Y91.178 E10.10164
+G1 X104.796 Y91.225 E10.10497
+G1 X104.884 Y91.274 E10.10830
+G1 X104.971 Y91.323 E10.11163
+G1 X105.058 Y91.373 E10.11497
+G1 X105.144 Y91.424 E10.11830
+G1 X105.229 Y91.476 E10.12163
+G1 X105.314 Y91.529 E10.12496
+G1 X105.399 Y91.583 E10.12829
+G1 X105.483 Y91.637 E10.13162
+G1 X105.566 Y91.692 E10.13496
+G1 X105.649 Y91.748 E10.13829
+G1 X105.731 Y91.805 E10.14162
+G1 X105.813 Y91.863 E10.14495
+G1 X105.894 Y91.922 E10.14828
+G1 X105.975 Y91.981 E10.15161
+G1 X106.054 Y92.041 E10.15495
+G1 X106.134 Y92.102 E10.15828
+G1 X106.213 Y92.164 E10.16161
+G1 X106.291 Y92.226 E10.16494
+G1 X106.368 Y92.290 E10.16827
+G1 X106.445 Y92.354 E10.17160
+G1 X106.521 Y92.419 E10.17494
+G1 X106.597 Y92.484 E10.17827
+G1 X106.671 Y92.551 E10.18160
+G1 X106.746 Y92.618 E10.18493
+G1 X106.819 Y92.686 E10.18826
+G1 X106.892 Y92.754 E10.19159
+G1 X106.964 Y92.824 E10.19493
+G1 X107.036 Y92.894 E10.19826
+G1 X107.106 Y92.964 E10.20159
+G1 X107.176 Y93.036 E10.20492
+G1 X107.246 Y93.108 E10.20825
+G1 X107.314 Y93.181 E10.21158
+G1 X107.382 Y93.254 E10.21492
+G1 X107.449 Y93.329 E10.21825
+G1 X107.516 Y93.403 E10.22158
+G1 X107.581 Y93.479 E10.22491
+G1 X107.646 Y93.555 E10.22824
+G1 X107.710 Y93.632 E10.23157
+G1 X107.774 Y93.709 E10.23491
+G1 X107.836 Y93.787 E10.23824
+G1 X107.898 Y93.866 E10.24157
+G1 X107.959 Y93.946 E10.24490
+G1 X108.019 Y94.025 E10.24823
+G1 X108.078 Y94.106 E10.25156
+G1 X108.137 Y94.187 E10.25490
+G1 X108.195 Y94.269 E10.25823
+G1 X108.252 Y94.351 E10.26156
+G1 X108.308 Y94.434 E10.26489
+G1 X108.363 Y94.517 E10.26822
+G1 X108.417 Y94.601 E10.27155
+G1 X108.471 Y94.686 E10.27489
+G1 X108.524 Y94.771 E10.27822
+G1 X108.576 Y94.856 E10.28155
+G1 X108.627 Y94.942 E10.28488
+G1 X108.677 Y95.029 E10.28821
+G1 X108.726 Y95.116 E10.29154
+G1 X108.775 Y95.204 E10.29488
+G1 X108.822 Y95.292 E10.29821
+G1 X108.869 Y95.380 E10.30154
+G1 X108.915 Y95.469 E10.30487
+G1 X108.959 Y95.558 E10.30820
+G1 X109.003 Y95.648 E10.31153
+G1 X109.047 Y95.739 E10.31487
+G1 X109.089 Y95.829 E10.31820
+G1 X109.130 Y95.920 E10.32153
+G1 X109.170 Y96.012 E10.32486
+G1 X109.210 Y96.104 E10.32819
+G1 X109.248 Y96.196 E10.33152
+G1 X109.286 Y96.289 E10.33486
+G1 X109.323 Y96.382 E10.33819
+G1 X109.358 Y96.476 E10.34152
+G1 X109.393 Y96.569 E10.34485
+G1 X109.427 Y96.664 E10.34818
+G1 X109.460 Y96.758 E10.35151
+G1 X109.492 Y96.853 E10.35485
+G1 X109.523 Y96.948 E10.35818
+G1 X109.553 Y97.043 E10.36151
+G1 X109.582 Y97.139 E10.36484
+G1 X109.610 Y97.235 E10.36817
+G1 X109.637 Y97.331 E10.37150
+G1 X109.664 Y97.428 E10.37484
+G1 X109.689 Y97.525 E10.37817
+G1 X109.713 Y97.622 E10.38150
+G1 X109.736 Y97.719 E10.38483
+G1 X109.759 Y97.817 E10.38816
+G1 X109.780 Y97.914 E10.39149
+G1 X109.800 Y98.012 E10.39483
+G1 X109.820 Y98.110 E10.39816
+G1 X109.838 Y98.209 E10.40149
+G1 X109.856 Y98.307 E10.40482
+G1 X109.872 Y98.406 E10.40815
+G1 X109.888 Y98.505 E10.41148
+G1 X109.902 Y98.604 E10.41482
+G1 X109.916 Y98.703 E10.41815
+G1 X109.928 Y98.802 E10.42148
+G1 X109.939 Y98.902 E10.42481
+G1 X109.950 Y99.001 E10.42814
+G1 X109.959 Y99.101 E10.43147
+G1 X109.968 Y99.200 E10.43481
+G1 X109.975 Y99.300 E10.43814
+G1 X109.982 Y99.400 E10.44147
+G1 X109.987 Y99.500 E10.44480
+G1 X109.992 Y99.600 E10.44813
+G1 X109.995 Y99.700 E10.45146
+G1 X109.998 Y99.800 E10.45480
+G1 X109.999 Y99.900 E10.45813
+G1 X110.000 Y100.000 E10.46146
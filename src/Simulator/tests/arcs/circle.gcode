@@ -0,0 +1,9 @@
+; Full circles end where they start. With ARC_IN_STEPPER the line to the
+; unchanged XY target has no steps and was dropped before setupArc. Each
+; circle of 10 mm radius moves X and Y by 40 mm, 3936 steps.
+; expect Steps: X:34941 Y:34940 Z:0 E0:0
+G28 X0 Y0
+G1 X50 Y50 F6000
+G2 X50 Y50 I10 J0 F3000
+G3 X50 Y50 I0 J-10
+G1 X60 Y40
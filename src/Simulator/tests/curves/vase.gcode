@@ -0,0 +1,2181 @@
+; generated by a script: 8 layers of a flower shaped vase wall, r = 25 + 5 cos(5 a)
+; mm around X100 Y100 from 240 lines, and a rounded square of 40 mm with 3 mm
+; corners from 6 lines each, at 150 mm/s. make bench-junction compares the print
+; time with MAX_JERK and with JUNCTION_DEVIATION.
+M104 S205
+G28
+G1 Z0.3 F3000
+M109 S205
+G21
+G90
+M82
+G92 E0
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E0.02617 F9000
+G1 X129.789 Y101.561 E0.05258
+G1 X129.528 Y102.324 E0.07942
+G1 X129.169 Y103.066 E0.10686
+G1 X128.719 Y103.781 E0.13500
+G1 X128.184 Y104.464 E0.16389
+G1 X127.574 Y105.111 E0.19349
+G1 X126.899 Y105.718 E0.22373
+G1 X126.170 Y106.283 E0.25445
+G1 X125.398 Y106.805 E0.28548
+G1 X124.596 Y107.286 E0.31661
+G1 X123.776 Y107.725 E0.34759
+G1 X122.951 Y108.127 E0.37817
+G1 X122.131 Y108.495 E0.40808
+G1 X121.329 Y108.835 E0.43709
+G1 X120.555 Y109.152 E0.46495
+G1 X119.817 Y109.452 E0.49147
+G1 X119.125 Y109.745 E0.51650
+G1 X118.484 Y110.036 E0.53993
+G1 X117.901 Y110.335 E0.56177
+G1 X117.377 Y110.649 E0.58209
+G1 X116.916 Y110.986 E0.60110
+G1 X116.518 Y111.352 E0.61914
+G1 X116.180 Y111.756 E0.63665
+G1 X115.901 Y112.201 E0.65416
+G1 X115.675 Y112.694 E0.67220
+G1 X115.498 Y113.236 E0.69121
+G1 X115.361 Y113.831 E0.71153
+G1 X115.257 Y114.478 E0.73336
+G1 X115.178 Y115.178 E0.75680
+G1 X115.114 Y115.926 E0.78183
+G1 X115.055 Y116.721 E0.80835
+G1 X114.994 Y117.555 E0.83621
+G1 X114.919 Y118.423 E0.86522
+G1 X114.822 Y119.316 E0.89513
+G1 X114.695 Y120.225 E0.92571
+G1 X114.530 Y121.141 E0.95669
+G1 X114.321 Y122.052 E0.98781
+G1 X114.062 Y122.947 E1.01885
+G1 X113.750 Y123.816 E1.04957
+G1 X113.381 Y124.645 E1.07981
+G1 X112.955 Y125.425 E1.10941
+G1 X112.471 Y126.145 E1.13829
+G1 X111.930 Y126.794 E1.16644
+G1 X111.335 Y127.365 E1.19388
+G1 X110.690 Y127.848 E1.22072
+G1 X110.000 Y128.239 E1.24712
+G1 X109.271 Y128.532 E1.27330
+G1 X108.508 Y128.724 E1.29947
+G1 X107.720 Y128.813 E1.32587
+G1 X106.915 Y128.801 E1.35272
+G1 X106.098 Y128.689 E1.38016
+G1 X105.279 Y128.482 E1.40830
+G1 X104.464 Y128.184 E1.43719
+G1 X103.660 Y127.804 E1.46679
+G1 X102.875 Y127.349 E1.49702
+G1 X102.112 Y126.830 E1.52775
+G1 X101.376 Y126.258 E1.55878
+G1 X100.672 Y125.644 E1.58991
+G1 X100.000 Y125.000 E1.62089
+G1 X99.363 Y124.339 E1.65146
+G1 X98.759 Y123.673 E1.68138
+G1 X98.189 Y123.015 E1.71038
+G1 X97.648 Y122.377 E1.73825
+G1 X97.134 Y121.768 E1.76477
+G1 X96.642 Y121.200 E1.78979
+G1 X96.167 Y120.681 E1.81323
+G1 X95.702 Y120.218 E1.83507
+G1 X95.242 Y119.817 E1.85539
+G1 X94.780 Y119.483 E1.87440
+G1 X94.308 Y119.217 E1.89243
+G1 X93.820 Y119.021 E1.90995
+G1 X93.310 Y118.893 E1.92746
+G1 X92.772 Y118.831 E1.94549
+G1 X92.201 Y118.829 E1.96450
+G1 X91.593 Y118.883 E1.98483
+G1 X90.945 Y118.984 E2.00666
+G1 X90.255 Y119.125 E2.03010
+G1 X89.523 Y119.295 E2.05513
+G1 X88.750 Y119.486 E2.08165
+G1 X87.937 Y119.685 E2.10951
+G1 X87.089 Y119.881 E2.13851
+G1 X86.209 Y120.065 E2.16843
+G1 X85.305 Y120.225 E2.19900
+G1 X84.384 Y120.352 E2.22998
+G1 X83.453 Y120.434 E2.26111
+G1 X82.521 Y120.465 E2.29214
+G1 X81.599 Y120.436 E2.32287
+G1 X80.696 Y120.342 E2.35310
+G1 X79.822 Y120.178 E2.38270
+G1 X78.988 Y119.939 E2.41159
+G1 X78.203 Y119.626 E2.43973
+G1 X77.477 Y119.236 E2.46718
+G1 X76.818 Y118.772 E2.49402
+G1 X76.233 Y118.237 E2.52042
+G1 X75.729 Y117.634 E2.54659
+G1 X75.311 Y116.968 E2.57277
+G1 X74.983 Y116.246 E2.59917
+G1 X74.745 Y115.476 E2.62601
+G1 X74.599 Y114.665 E2.65345
+G1 X74.544 Y113.822 E2.68160
+G1 X74.575 Y112.955 E2.71048
+G1 X74.688 Y112.073 E2.74009
+G1 X74.877 Y111.185 E2.77032
+G1 X75.135 Y110.299 E2.80104
+G1 X75.452 Y109.423 E2.83208
+G1 X75.819 Y108.563 E2.86321
+G1 X76.224 Y107.725 E2.89419
+G1 X76.655 Y106.915 E2.92476
+G1 X77.102 Y106.136 E2.95468
+G1 X77.551 Y105.389 E2.98368
+G1 X77.992 Y104.678 E3.01154
+G1 X78.411 Y104.001 E3.03806
+G1 X78.800 Y103.358 E3.06309
+G1 X79.147 Y102.745 E3.08653
+G1 X79.443 Y102.161 E3.10836
+G1 X79.682 Y101.599 E3.12868
+G1 X79.857 Y101.056 E3.14770
+G1 X79.964 Y100.525 E3.16573
+G1 X80.000 Y100.000 E3.18324
+G1 X79.964 Y99.475 E3.20076
+G1 X79.857 Y98.944 E3.21879
+G1 X79.682 Y98.401 E3.23780
+G1 X79.443 Y97.839 E3.25812
+G1 X79.147 Y97.255 E3.27996
+G1 X78.800 Y96.642 E3.30340
+G1 X78.411 Y95.999 E3.32842
+G1 X77.992 Y95.322 E3.35494
+G1 X77.551 Y94.611 E3.38281
+G1 X77.102 Y93.864 E3.41181
+G1 X76.655 Y93.085 E3.44173
+G1 X76.224 Y92.275 E3.47230
+G1 X75.819 Y91.437 E3.50328
+G1 X75.452 Y90.577 E3.53441
+G1 X75.135 Y89.701 E3.56544
+G1 X74.877 Y88.815 E3.59617
+G1 X74.688 Y87.927 E3.62640
+G1 X74.575 Y87.045 E3.65600
+G1 X74.544 Y86.178 E3.68489
+G1 X74.599 Y85.335 E3.71303
+G1 X74.745 Y84.524 E3.74047
+G1 X74.983 Y83.754 E3.76731
+G1 X75.311 Y83.032 E3.79372
+G1 X75.729 Y82.366 E3.81989
+G1 X76.233 Y81.763 E3.84607
+G1 X76.818 Y81.228 E3.87247
+G1 X77.477 Y80.764 E3.89931
+G1 X78.203 Y80.374 E3.92675
+G1 X78.988 Y80.061 E3.95490
+G1 X79.822 Y79.822 E3.98378
+G1 X80.696 Y79.658 E4.01338
+G1 X81.599 Y79.564 E4.04362
+G1 X82.521 Y79.535 E4.07434
+G1 X83.453 Y79.566 E4.10538
+G1 X84.384 Y79.648 E4.13650
+G1 X85.305 Y79.775 E4.16748
+G1 X86.209 Y79.935 E4.19806
+G1 X87.089 Y80.119 E4.22797
+G1 X87.937 Y80.315 E4.25698
+G1 X88.750 Y80.514 E4.28484
+G1 X89.523 Y80.705 E4.31136
+G1 X90.255 Y80.875 E4.33639
+G1 X90.945 Y81.016 E4.35982
+G1 X91.593 Y81.117 E4.38166
+G1 X92.201 Y81.171 E4.40198
+G1 X92.772 Y81.169 E4.42099
+G1 X93.310 Y81.107 E4.43903
+G1 X93.820 Y80.979 E4.45654
+G1 X94.308 Y80.783 E4.47405
+G1 X94.780 Y80.517 E4.49209
+G1 X95.242 Y80.183 E4.51110
+G1 X95.702 Y79.782 E4.53142
+G1 X96.167 Y79.319 E4.55326
+G1 X96.642 Y78.800 E4.57669
+G1 X97.134 Y78.232 E4.60172
+G1 X97.648 Y77.623 E4.62824
+G1 X98.189 Y76.985 E4.65610
+G1 X98.759 Y76.327 E4.68511
+G1 X99.363 Y75.661 E4.71502
+G1 X100.000 Y75.000 E4.74560
+G1 X100.672 Y74.356 E4.77658
+G1 X101.376 Y73.742 E4.80770
+G1 X102.112 Y73.170 E4.83874
+G1 X102.875 Y72.651 E4.86946
+G1 X103.660 Y72.196 E4.89970
+G1 X104.464 Y71.816 E4.92930
+G1 X105.279 Y71.518 E4.95819
+G1 X106.098 Y71.311 E4.98633
+G1 X106.915 Y71.199 E5.01377
+G1 X107.720 Y71.187 E5.04061
+G1 X108.508 Y71.276 E5.06702
+G1 X109.271 Y71.468 E5.09319
+G1 X110.000 Y71.761 E5.11936
+G1 X110.690 Y72.152 E5.14577
+G1 X111.335 Y72.635 E5.17261
+G1 X111.930 Y73.206 E5.20005
+G1 X112.471 Y73.855 E5.22819
+G1 X112.955 Y74.575 E5.25708
+G1 X113.381 Y75.355 E5.28668
+G1 X113.750 Y76.184 E5.31691
+G1 X114.062 Y77.053 E5.34764
+G1 X114.321 Y77.948 E5.37867
+G1 X114.530 Y78.859 E5.40980
+G1 X114.695 Y79.775 E5.44078
+G1 X114.822 Y80.684 E5.47136
+G1 X114.919 Y81.577 E5.50127
+G1 X114.994 Y82.445 E5.53028
+G1 X115.055 Y83.279 E5.55814
+G1 X115.114 Y84.074 E5.58466
+G1 X115.178 Y84.822 E5.60968
+G1 X115.257 Y85.522 E5.63312
+G1 X115.361 Y86.169 E5.65496
+G1 X115.498 Y86.764 E5.67528
+G1 X115.675 Y87.306 E5.69429
+G1 X115.901 Y87.799 E5.71233
+G1 X116.180 Y88.244 E5.72984
+G1 X116.518 Y88.648 E5.74735
+G1 X116.916 Y89.014 E5.76539
+G1 X117.377 Y89.351 E5.78440
+G1 X117.901 Y89.665 E5.80472
+G1 X118.484 Y89.964 E5.82655
+G1 X119.125 Y90.255 E5.84999
+G1 X119.817 Y90.548 E5.87502
+G1 X120.555 Y90.848 E5.90154
+G1 X121.329 Y91.165 E5.92940
+G1 X122.131 Y91.505 E5.95841
+G1 X122.951 Y91.873 E5.98832
+G1 X123.776 Y92.275 E6.01890
+G1 X124.596 Y92.714 E6.04988
+G1 X125.398 Y93.195 E6.08100
+G1 X126.170 Y93.717 E6.11204
+G1 X126.899 Y94.282 E6.14276
+G1 X127.574 Y94.889 E6.17299
+G1 X128.184 Y95.536 E6.20260
+G1 X128.719 Y96.219 E6.23148
+G1 X129.169 Y96.934 E6.25963
+G1 X129.528 Y97.676 E6.28707
+G1 X129.789 Y98.439 E6.31391
+G1 X129.947 Y99.216 E6.34031
+G1 X130.000 Y100.000 E6.36649
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E6.39257 F9000
+G1 X119.598 Y118.500 E6.41864
+G1 X119.121 Y119.121 E6.44472
+G1 X118.500 Y119.598 E6.47080
+G1 X117.776 Y119.898 E6.49688
+G1 X117.000 Y120.000 E6.52296
+G1 X83.000 Y120.000 E7.65516
+G1 X82.224 Y119.898 E7.68124
+G1 X81.500 Y119.598 E7.70732
+G1 X80.879 Y119.121 E7.73340
+G1 X80.402 Y118.500 E7.75948
+G1 X80.102 Y117.776 E7.78556
+G1 X80.000 Y117.000 E7.81164
+G1 X80.000 Y83.000 E8.94384
+G1 X80.102 Y82.224 E8.96992
+G1 X80.402 Y81.500 E8.99599
+G1 X80.879 Y80.879 E9.02207
+G1 X81.500 Y80.402 E9.04815
+G1 X82.224 Y80.102 E9.07423
+G1 X83.000 Y80.000 E9.10031
+G1 X117.000 Y80.000 E10.23251
+G1 X117.776 Y80.102 E10.25859
+G1 X118.500 Y80.402 E10.28467
+G1 X119.121 Y80.879 E10.31075
+G1 X119.598 Y81.500 E10.33683
+G1 X119.898 Y82.224 E10.36291
+G1 X120.000 Y83.000 E10.38899
+G1 X120.000 Y117.000 E11.52119
+G1 Z0.50 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E11.54736 F9000
+G1 X129.789 Y101.561 E11.57376
+G1 X129.528 Y102.324 E11.60060
+G1 X129.169 Y103.066 E11.62805
+G1 X128.719 Y103.781 E11.65619
+G1 X128.184 Y104.464 E11.68508
+G1 X127.574 Y105.111 E11.71468
+G1 X126.899 Y105.718 E11.74491
+G1 X126.170 Y106.283 E11.77564
+G1 X125.398 Y106.805 E11.80667
+G1 X124.596 Y107.286 E11.83780
+G1 X123.776 Y107.725 E11.86878
+G1 X122.951 Y108.127 E11.89935
+G1 X122.131 Y108.495 E11.92927
+G1 X121.329 Y108.835 E11.95827
+G1 X120.555 Y109.152 E11.98613
+G1 X119.817 Y109.452 E12.01266
+G1 X119.125 Y109.745 E12.03768
+G1 X118.484 Y110.036 E12.06112
+G1 X117.901 Y110.335 E12.08295
+G1 X117.377 Y110.649 E12.10328
+G1 X116.916 Y110.986 E12.12229
+G1 X116.518 Y111.352 E12.14032
+G1 X116.180 Y111.756 E12.15783
+G1 X115.901 Y112.201 E12.17535
+G1 X115.675 Y112.694 E12.19338
+G1 X115.498 Y113.236 E12.21239
+G1 X115.361 Y113.831 E12.23271
+G1 X115.257 Y114.478 E12.25455
+G1 X115.178 Y115.178 E12.27799
+G1 X115.114 Y115.926 E12.30301
+G1 X115.055 Y116.721 E12.32953
+G1 X114.994 Y117.555 E12.35740
+G1 X114.919 Y118.423 E12.38640
+G1 X114.822 Y119.316 E12.41632
+G1 X114.695 Y120.225 E12.44689
+G1 X114.530 Y121.141 E12.47787
+G1 X114.321 Y122.052 E12.50900
+G1 X114.062 Y122.947 E12.54003
+G1 X113.750 Y123.816 E12.57076
+G1 X113.381 Y124.645 E12.60099
+G1 X112.955 Y125.425 E12.63059
+G1 X112.471 Y126.145 E12.65948
+G1 X111.930 Y126.794 E12.68762
+G1 X111.335 Y127.365 E12.71506
+G1 X110.690 Y127.848 E12.74191
+G1 X110.000 Y128.239 E12.76831
+G1 X109.271 Y128.532 E12.79448
+G1 X108.508 Y128.724 E12.82066
+G1 X107.720 Y128.813 E12.84706
+G1 X106.915 Y128.801 E12.87390
+G1 X106.098 Y128.689 E12.90134
+G1 X105.279 Y128.482 E12.92949
+G1 X104.464 Y128.184 E12.95837
+G1 X103.660 Y127.804 E12.98798
+G1 X102.875 Y127.349 E13.01821
+G1 X102.112 Y126.830 E13.04893
+G1 X101.376 Y126.258 E13.07997
+G1 X100.672 Y125.644 E13.11109
+G1 X100.000 Y125.000 E13.14207
+G1 X99.363 Y124.339 E13.17265
+G1 X98.759 Y123.673 E13.20256
+G1 X98.189 Y123.015 E13.23157
+G1 X97.648 Y122.377 E13.25943
+G1 X97.134 Y121.768 E13.28595
+G1 X96.642 Y121.200 E13.31098
+G1 X96.167 Y120.681 E13.33442
+G1 X95.702 Y120.218 E13.35625
+G1 X95.242 Y119.817 E13.37657
+G1 X94.780 Y119.483 E13.39558
+G1 X94.308 Y119.217 E13.41362
+G1 X93.820 Y119.021 E13.43113
+G1 X93.310 Y118.893 E13.44864
+G1 X92.772 Y118.831 E13.46668
+G1 X92.201 Y118.829 E13.48569
+G1 X91.593 Y118.883 E13.50601
+G1 X90.945 Y118.984 E13.52785
+G1 X90.255 Y119.125 E13.55129
+G1 X89.523 Y119.295 E13.57631
+G1 X88.750 Y119.486 E13.60283
+G1 X87.937 Y119.685 E13.63069
+G1 X87.089 Y119.881 E13.65970
+G1 X86.209 Y120.065 E13.68961
+G1 X85.305 Y120.225 E13.72019
+G1 X84.384 Y120.352 E13.75117
+G1 X83.453 Y120.434 E13.78230
+G1 X82.521 Y120.465 E13.81333
+G1 X81.599 Y120.436 E13.84406
+G1 X80.696 Y120.342 E13.87429
+G1 X79.822 Y120.178 E13.90389
+G1 X78.988 Y119.939 E13.93278
+G1 X78.203 Y119.626 E13.96092
+G1 X77.477 Y119.236 E13.98836
+G1 X76.818 Y118.772 E14.01520
+G1 X76.233 Y118.237 E14.04161
+G1 X75.729 Y117.634 E14.06778
+G1 X75.311 Y116.968 E14.09395
+G1 X74.983 Y116.246 E14.12036
+G1 X74.745 Y115.476 E14.14720
+G1 X74.599 Y114.665 E14.17464
+G1 X74.544 Y113.822 E14.20278
+G1 X74.575 Y112.955 E14.23167
+G1 X74.688 Y112.073 E14.26127
+G1 X74.877 Y111.185 E14.29151
+G1 X75.135 Y110.299 E14.32223
+G1 X75.452 Y109.423 E14.35326
+G1 X75.819 Y108.563 E14.38439
+G1 X76.224 Y107.725 E14.41537
+G1 X76.655 Y106.915 E14.44595
+G1 X77.102 Y106.136 E14.47586
+G1 X77.551 Y105.389 E14.50487
+G1 X77.992 Y104.678 E14.53273
+G1 X78.411 Y104.001 E14.55925
+G1 X78.800 Y103.358 E14.58428
+G1 X79.147 Y102.745 E14.60771
+G1 X79.443 Y102.161 E14.62955
+G1 X79.682 Y101.599 E14.64987
+G1 X79.857 Y101.056 E14.66888
+G1 X79.964 Y100.525 E14.68692
+G1 X80.000 Y100.000 E14.70443
+G1 X79.964 Y99.475 E14.72194
+G1 X79.857 Y98.944 E14.73998
+G1 X79.682 Y98.401 E14.75899
+G1 X79.443 Y97.839 E14.77931
+G1 X79.147 Y97.255 E14.80115
+G1 X78.800 Y96.642 E14.82458
+G1 X78.411 Y95.999 E14.84961
+G1 X77.992 Y95.322 E14.87613
+G1 X77.551 Y94.611 E14.90399
+G1 X77.102 Y93.864 E14.93300
+G1 X76.655 Y93.085 E14.96291
+G1 X76.224 Y92.275 E14.99349
+G1 X75.819 Y91.437 E15.02447
+G1 X75.452 Y90.577 E15.05559
+G1 X75.135 Y89.701 E15.08663
+G1 X74.877 Y88.815 E15.11735
+G1 X74.688 Y87.927 E15.14759
+G1 X74.575 Y87.045 E15.17719
+G1 X74.544 Y86.178 E15.20607
+G1 X74.599 Y85.335 E15.23422
+G1 X74.745 Y84.524 E15.26166
+G1 X74.983 Y83.754 E15.28850
+G1 X75.311 Y83.032 E15.31490
+G1 X75.729 Y82.366 E15.34108
+G1 X76.233 Y81.763 E15.36725
+G1 X76.818 Y81.228 E15.39366
+G1 X77.477 Y80.764 E15.42050
+G1 X78.203 Y80.374 E15.44794
+G1 X78.988 Y80.061 E15.47608
+G1 X79.822 Y79.822 E15.50497
+G1 X80.696 Y79.658 E15.53457
+G1 X81.599 Y79.564 E15.56480
+G1 X82.521 Y79.535 E15.59553
+G1 X83.453 Y79.566 E15.62656
+G1 X84.384 Y79.648 E15.65769
+G1 X85.305 Y79.775 E15.68867
+G1 X86.209 Y79.935 E15.71924
+G1 X87.089 Y80.119 E15.74916
+G1 X87.937 Y80.315 E15.77816
+G1 X88.750 Y80.514 E15.80603
+G1 X89.523 Y80.705 E15.83255
+G1 X90.255 Y80.875 E15.85757
+G1 X90.945 Y81.016 E15.88101
+G1 X91.593 Y81.117 E15.90285
+G1 X92.201 Y81.171 E15.92317
+G1 X92.772 Y81.169 E15.94218
+G1 X93.310 Y81.107 E15.96021
+G1 X93.820 Y80.979 E15.97773
+G1 X94.308 Y80.783 E15.99524
+G1 X94.780 Y80.517 E16.01327
+G1 X95.242 Y80.183 E16.03229
+G1 X95.702 Y79.782 E16.05261
+G1 X96.167 Y79.319 E16.07444
+G1 X96.642 Y78.800 E16.09788
+G1 X97.134 Y78.232 E16.12291
+G1 X97.648 Y77.623 E16.14943
+G1 X98.189 Y76.985 E16.17729
+G1 X98.759 Y76.327 E16.20629
+G1 X99.363 Y75.661 E16.23621
+G1 X100.000 Y75.000 E16.26678
+G1 X100.672 Y74.356 E16.29776
+G1 X101.376 Y73.742 E16.32889
+G1 X102.112 Y73.170 E16.35993
+G1 X102.875 Y72.651 E16.39065
+G1 X103.660 Y72.196 E16.42088
+G1 X104.464 Y71.816 E16.45049
+G1 X105.279 Y71.518 E16.47937
+G1 X106.098 Y71.311 E16.50752
+G1 X106.915 Y71.199 E16.53496
+G1 X107.720 Y71.187 E16.56180
+G1 X108.508 Y71.276 E16.58820
+G1 X109.271 Y71.468 E16.61438
+G1 X110.000 Y71.761 E16.64055
+G1 X110.690 Y72.152 E16.66695
+G1 X111.335 Y72.635 E16.69379
+G1 X111.930 Y73.206 E16.72124
+G1 X112.471 Y73.855 E16.74938
+G1 X112.955 Y74.575 E16.77827
+G1 X113.381 Y75.355 E16.80787
+G1 X113.750 Y76.184 E16.83810
+G1 X114.062 Y77.053 E16.86883
+G1 X114.321 Y77.948 E16.89986
+G1 X114.530 Y78.859 E16.93099
+G1 X114.695 Y79.775 E16.96197
+G1 X114.822 Y80.684 E16.99254
+G1 X114.919 Y81.577 E17.02246
+G1 X114.994 Y82.445 E17.05146
+G1 X115.055 Y83.279 E17.07932
+G1 X115.114 Y84.074 E17.10584
+G1 X115.178 Y84.822 E17.13087
+G1 X115.257 Y85.522 E17.15431
+G1 X115.361 Y86.169 E17.17614
+G1 X115.498 Y86.764 E17.19646
+G1 X115.675 Y87.306 E17.21548
+G1 X115.901 Y87.799 E17.23351
+G1 X116.180 Y88.244 E17.25102
+G1 X116.518 Y88.648 E17.26854
+G1 X116.916 Y89.014 E17.28657
+G1 X117.377 Y89.351 E17.30558
+G1 X117.901 Y89.665 E17.32590
+G1 X118.484 Y89.964 E17.34774
+G1 X119.125 Y90.255 E17.37118
+G1 X119.817 Y90.548 E17.39620
+G1 X120.555 Y90.848 E17.42272
+G1 X121.329 Y91.165 E17.45059
+G1 X122.131 Y91.505 E17.47959
+G1 X122.951 Y91.873 E17.50951
+G1 X123.776 Y92.275 E17.54008
+G1 X124.596 Y92.714 E17.57106
+G1 X125.398 Y93.195 E17.60219
+G1 X126.170 Y93.717 E17.63322
+G1 X126.899 Y94.282 E17.66395
+G1 X127.574 Y94.889 E17.69418
+G1 X128.184 Y95.536 E17.72378
+G1 X128.719 Y96.219 E17.75267
+G1 X129.169 Y96.934 E17.78081
+G1 X129.528 Y97.676 E17.80825
+G1 X129.789 Y98.439 E17.83510
+G1 X129.947 Y99.216 E17.86150
+G1 X130.000 Y100.000 E17.88767
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E17.91375 F9000
+G1 X119.598 Y118.500 E17.93983
+G1 X119.121 Y119.121 E17.96591
+G1 X118.500 Y119.598 E17.99199
+G1 X117.776 Y119.898 E18.01807
+G1 X117.000 Y120.000 E18.04415
+G1 X83.000 Y120.000 E19.17635
+G1 X82.224 Y119.898 E19.20243
+G1 X81.500 Y119.598 E19.22851
+G1 X80.879 Y119.121 E19.25458
+G1 X80.402 Y118.500 E19.28066
+G1 X80.102 Y117.776 E19.30674
+G1 X80.000 Y117.000 E19.33282
+G1 X80.000 Y83.000 E20.46502
+G1 X80.102 Y82.224 E20.49110
+G1 X80.402 Y81.500 E20.51718
+G1 X80.879 Y80.879 E20.54326
+G1 X81.500 Y80.402 E20.56934
+G1 X82.224 Y80.102 E20.59542
+G1 X83.000 Y80.000 E20.62150
+G1 X117.000 Y80.000 E21.75370
+G1 X117.776 Y80.102 E21.77978
+G1 X118.500 Y80.402 E21.80586
+G1 X119.121 Y80.879 E21.83193
+G1 X119.598 Y81.500 E21.85801
+G1 X119.898 Y82.224 E21.88409
+G1 X120.000 Y83.000 E21.91017
+G1 X120.000 Y117.000 E23.04237
+G1 Z0.70 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E23.06854 F9000
+G1 X129.789 Y101.561 E23.09495
+G1 X129.528 Y102.324 E23.12179
+G1 X129.169 Y103.066 E23.14923
+G1 X128.719 Y103.781 E23.17738
+G1 X128.184 Y104.464 E23.20626
+G1 X127.574 Y105.111 E23.23586
+G1 X126.899 Y105.718 E23.26610
+G1 X126.170 Y106.283 E23.29682
+G1 X125.398 Y106.805 E23.32786
+G1 X124.596 Y107.286 E23.35898
+G1 X123.776 Y107.725 E23.38996
+G1 X122.951 Y108.127 E23.42054
+G1 X122.131 Y108.495 E23.45045
+G1 X121.329 Y108.835 E23.47946
+G1 X120.555 Y109.152 E23.50732
+G1 X119.817 Y109.452 E23.53384
+G1 X119.125 Y109.745 E23.55887
+G1 X118.484 Y110.036 E23.58230
+G1 X117.901 Y110.335 E23.60414
+G1 X117.377 Y110.649 E23.62446
+G1 X116.916 Y110.986 E23.64347
+G1 X116.518 Y111.352 E23.66151
+G1 X116.180 Y111.756 E23.67902
+G1 X115.901 Y112.201 E23.69653
+G1 X115.675 Y112.694 E23.71457
+G1 X115.498 Y113.236 E23.73358
+G1 X115.361 Y113.831 E23.75390
+G1 X115.257 Y114.478 E23.77574
+G1 X115.178 Y115.178 E23.79917
+G1 X115.114 Y115.926 E23.82420
+G1 X115.055 Y116.721 E23.85072
+G1 X114.994 Y117.555 E23.87858
+G1 X114.919 Y118.423 E23.90759
+G1 X114.822 Y119.316 E23.93750
+G1 X114.695 Y120.225 E23.96808
+G1 X114.530 Y121.141 E23.99906
+G1 X114.321 Y122.052 E24.03018
+G1 X114.062 Y122.947 E24.06122
+G1 X113.750 Y123.816 E24.09194
+G1 X113.381 Y124.645 E24.12218
+G1 X112.955 Y125.425 E24.15178
+G1 X112.471 Y126.145 E24.18067
+G1 X111.930 Y126.794 E24.20881
+G1 X111.335 Y127.365 E24.23625
+G1 X110.690 Y127.848 E24.26309
+G1 X110.000 Y128.239 E24.28950
+G1 X109.271 Y128.532 E24.31567
+G1 X108.508 Y128.724 E24.34184
+G1 X107.720 Y128.813 E24.36825
+G1 X106.915 Y128.801 E24.39509
+G1 X106.098 Y128.689 E24.42253
+G1 X105.279 Y128.482 E24.45067
+G1 X104.464 Y128.184 E24.47956
+G1 X103.660 Y127.804 E24.50916
+G1 X102.875 Y127.349 E24.53939
+G1 X102.112 Y126.830 E24.57012
+G1 X101.376 Y126.258 E24.60115
+G1 X100.672 Y125.644 E24.63228
+G1 X100.000 Y125.000 E24.66326
+G1 X99.363 Y124.339 E24.69384
+G1 X98.759 Y123.673 E24.72375
+G1 X98.189 Y123.015 E24.75276
+G1 X97.648 Y122.377 E24.78062
+G1 X97.134 Y121.768 E24.80714
+G1 X96.642 Y121.200 E24.83216
+G1 X96.167 Y120.681 E24.85560
+G1 X95.702 Y120.218 E24.87744
+G1 X95.242 Y119.817 E24.89776
+G1 X94.780 Y119.483 E24.91677
+G1 X94.308 Y119.217 E24.93481
+G1 X93.820 Y119.021 E24.95232
+G1 X93.310 Y118.893 E24.96983
+G1 X92.772 Y118.831 E24.98787
+G1 X92.201 Y118.829 E25.00688
+G1 X91.593 Y118.883 E25.02720
+G1 X90.945 Y118.984 E25.04903
+G1 X90.255 Y119.125 E25.07247
+G1 X89.523 Y119.295 E25.09750
+G1 X88.750 Y119.486 E25.12402
+G1 X87.937 Y119.685 E25.15188
+G1 X87.089 Y119.881 E25.18088
+G1 X86.209 Y120.065 E25.21080
+G1 X85.305 Y120.225 E25.24138
+G1 X84.384 Y120.352 E25.27235
+G1 X83.453 Y120.434 E25.30348
+G1 X82.521 Y120.465 E25.33452
+G1 X81.599 Y120.436 E25.36524
+G1 X80.696 Y120.342 E25.39547
+G1 X79.822 Y120.178 E25.42508
+G1 X78.988 Y119.939 E25.45396
+G1 X78.203 Y119.626 E25.48211
+G1 X77.477 Y119.236 E25.50955
+G1 X76.818 Y118.772 E25.53639
+G1 X76.233 Y118.237 E25.56279
+G1 X75.729 Y117.634 E25.58897
+G1 X75.311 Y116.968 E25.61514
+G1 X74.983 Y116.246 E25.64154
+G1 X74.745 Y115.476 E25.66839
+G1 X74.599 Y114.665 E25.69583
+G1 X74.544 Y113.822 E25.72397
+G1 X74.575 Y112.955 E25.75286
+G1 X74.688 Y112.073 E25.78246
+G1 X74.877 Y111.185 E25.81269
+G1 X75.135 Y110.299 E25.84342
+G1 X75.452 Y109.423 E25.87445
+G1 X75.819 Y108.563 E25.90558
+G1 X76.224 Y107.725 E25.93656
+G1 X76.655 Y106.915 E25.96713
+G1 X77.102 Y106.136 E25.99705
+G1 X77.551 Y105.389 E26.02605
+G1 X77.992 Y104.678 E26.05391
+G1 X78.411 Y104.001 E26.08044
+G1 X78.800 Y103.358 E26.10546
+G1 X79.147 Y102.745 E26.12890
+G1 X79.443 Y102.161 E26.15074
+G1 X79.682 Y101.599 E26.17106
+G1 X79.857 Y101.056 E26.19007
+G1 X79.964 Y100.525 E26.20810
+G1 X80.000 Y100.000 E26.22562
+G1 X79.964 Y99.475 E26.24313
+G1 X79.857 Y98.944 E26.26116
+G1 X79.682 Y98.401 E26.28017
+G1 X79.443 Y97.839 E26.30050
+G1 X79.147 Y97.255 E26.32233
+G1 X78.800 Y96.642 E26.34577
+G1 X78.411 Y95.999 E26.37079
+G1 X77.992 Y95.322 E26.39732
+G1 X77.551 Y94.611 E26.42518
+G1 X77.102 Y93.864 E26.45418
+G1 X76.655 Y93.085 E26.48410
+G1 X76.224 Y92.275 E26.51467
+G1 X75.819 Y91.437 E26.54565
+G1 X75.452 Y90.577 E26.57678
+G1 X75.135 Y89.701 E26.60781
+G1 X74.877 Y88.815 E26.63854
+G1 X74.688 Y87.927 E26.66877
+G1 X74.575 Y87.045 E26.69837
+G1 X74.544 Y86.178 E26.72726
+G1 X74.599 Y85.335 E26.75540
+G1 X74.745 Y84.524 E26.78284
+G1 X74.983 Y83.754 E26.80969
+G1 X75.311 Y83.032 E26.83609
+G1 X75.729 Y82.366 E26.86226
+G1 X76.233 Y81.763 E26.88844
+G1 X76.818 Y81.228 E26.91484
+G1 X77.477 Y80.764 E26.94168
+G1 X78.203 Y80.374 E26.96912
+G1 X78.988 Y80.061 E26.99727
+G1 X79.822 Y79.822 E27.02615
+G1 X80.696 Y79.658 E27.05576
+G1 X81.599 Y79.564 E27.08599
+G1 X82.521 Y79.535 E27.11671
+G1 X83.453 Y79.566 E27.14775
+G1 X84.384 Y79.648 E27.17888
+G1 X85.305 Y79.775 E27.20985
+G1 X86.209 Y79.935 E27.24043
+G1 X87.089 Y80.119 E27.27035
+G1 X87.937 Y80.315 E27.29935
+G1 X88.750 Y80.514 E27.32721
+G1 X89.523 Y80.705 E27.35373
+G1 X90.255 Y80.875 E27.37876
+G1 X90.945 Y81.016 E27.40220
+G1 X91.593 Y81.117 E27.42403
+G1 X92.201 Y81.171 E27.44435
+G1 X92.772 Y81.169 E27.46336
+G1 X93.310 Y81.107 E27.48140
+G1 X93.820 Y80.979 E27.49891
+G1 X94.308 Y80.783 E27.51642
+G1 X94.780 Y80.517 E27.53446
+G1 X95.242 Y80.183 E27.55347
+G1 X95.702 Y79.782 E27.57379
+G1 X96.167 Y79.319 E27.59563
+G1 X96.642 Y78.800 E27.61907
+G1 X97.134 Y78.232 E27.64409
+G1 X97.648 Y77.623 E27.67061
+G1 X98.189 Y76.985 E27.69848
+G1 X98.759 Y76.327 E27.72748
+G1 X99.363 Y75.661 E27.75739
+G1 X100.000 Y75.000 E27.78797
+G1 X100.672 Y74.356 E27.81895
+G1 X101.376 Y73.742 E27.85008
+G1 X102.112 Y73.170 E27.88111
+G1 X102.875 Y72.651 E27.91184
+G1 X103.660 Y72.196 E27.94207
+G1 X104.464 Y71.816 E27.97167
+G1 X105.279 Y71.518 E28.00056
+G1 X106.098 Y71.311 E28.02870
+G1 X106.915 Y71.199 E28.05614
+G1 X107.720 Y71.187 E28.08298
+G1 X108.508 Y71.276 E28.10939
+G1 X109.271 Y71.468 E28.13556
+G1 X110.000 Y71.761 E28.16173
+G1 X110.690 Y72.152 E28.18814
+G1 X111.335 Y72.635 E28.21498
+G1 X111.930 Y73.206 E28.24242
+G1 X112.471 Y73.855 E28.27057
+G1 X112.955 Y74.575 E28.29945
+G1 X113.381 Y75.355 E28.32905
+G1 X113.750 Y76.184 E28.35929
+G1 X114.062 Y77.053 E28.39001
+G1 X114.321 Y77.948 E28.42105
+G1 X114.530 Y78.859 E28.45217
+G1 X114.695 Y79.775 E28.48315
+G1 X114.822 Y80.684 E28.51373
+G1 X114.919 Y81.577 E28.54364
+G1 X114.994 Y82.445 E28.57265
+G1 X115.055 Y83.279 E28.60051
+G1 X115.114 Y84.074 E28.62703
+G1 X115.178 Y84.822 E28.65206
+G1 X115.257 Y85.522 E28.67549
+G1 X115.361 Y86.169 E28.69733
+G1 X115.498 Y86.764 E28.71765
+G1 X115.675 Y87.306 E28.73666
+G1 X115.901 Y87.799 E28.75470
+G1 X116.180 Y88.244 E28.77221
+G1 X116.518 Y88.648 E28.78972
+G1 X116.916 Y89.014 E28.80776
+G1 X117.377 Y89.351 E28.82677
+G1 X117.901 Y89.665 E28.84709
+G1 X118.484 Y89.964 E28.86893
+G1 X119.125 Y90.255 E28.89236
+G1 X119.817 Y90.548 E28.91739
+G1 X120.555 Y90.848 E28.94391
+G1 X121.329 Y91.165 E28.97177
+G1 X122.131 Y91.505 E29.00078
+G1 X122.951 Y91.873 E29.03069
+G1 X123.776 Y92.275 E29.06127
+G1 X124.596 Y92.714 E29.09225
+G1 X125.398 Y93.195 E29.12337
+G1 X126.170 Y93.717 E29.15441
+G1 X126.899 Y94.282 E29.18513
+G1 X127.574 Y94.889 E29.21537
+G1 X128.184 Y95.536 E29.24497
+G1 X128.719 Y96.219 E29.27385
+G1 X129.169 Y96.934 E29.30200
+G1 X129.528 Y97.676 E29.32944
+G1 X129.789 Y98.439 E29.35628
+G1 X129.947 Y99.216 E29.38269
+G1 X130.000 Y100.000 E29.40886
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E29.43494 F9000
+G1 X119.598 Y118.500 E29.46102
+G1 X119.121 Y119.121 E29.48710
+G1 X118.500 Y119.598 E29.51318
+G1 X117.776 Y119.898 E29.53925
+G1 X117.000 Y120.000 E29.56533
+G1 X83.000 Y120.000 E30.69753
+G1 X82.224 Y119.898 E30.72361
+G1 X81.500 Y119.598 E30.74969
+G1 X80.879 Y119.121 E30.77577
+G1 X80.402 Y118.500 E30.80185
+G1 X80.102 Y117.776 E30.82793
+G1 X80.000 Y117.000 E30.85401
+G1 X80.000 Y83.000 E31.98621
+G1 X80.102 Y82.224 E32.01229
+G1 X80.402 Y81.500 E32.03837
+G1 X80.879 Y80.879 E32.06445
+G1 X81.500 Y80.402 E32.09052
+G1 X82.224 Y80.102 E32.11660
+G1 X83.000 Y80.000 E32.14268
+G1 X117.000 Y80.000 E33.27488
+G1 X117.776 Y80.102 E33.30096
+G1 X118.500 Y80.402 E33.32704
+G1 X119.121 Y80.879 E33.35312
+G1 X119.598 Y81.500 E33.37920
+G1 X119.898 Y82.224 E33.40528
+G1 X120.000 Y83.000 E33.43136
+G1 X120.000 Y117.000 E34.56356
+G1 Z0.90 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E34.58973 F9000
+G1 X129.789 Y101.561 E34.61614
+G1 X129.528 Y102.324 E34.64298
+G1 X129.169 Y103.066 E34.67042
+G1 X128.719 Y103.781 E34.69856
+G1 X128.184 Y104.464 E34.72745
+G1 X127.574 Y105.111 E34.75705
+G1 X126.899 Y105.718 E34.78728
+G1 X126.170 Y106.283 E34.81801
+G1 X125.398 Y106.805 E34.84904
+G1 X124.596 Y107.286 E34.88017
+G1 X123.776 Y107.725 E34.91115
+G1 X122.951 Y108.127 E34.94172
+G1 X122.131 Y108.495 E34.97164
+G1 X121.329 Y108.835 E35.00064
+G1 X120.555 Y109.152 E35.02851
+G1 X119.817 Y109.452 E35.05503
+G1 X119.125 Y109.745 E35.08005
+G1 X118.484 Y110.036 E35.10349
+G1 X117.901 Y110.335 E35.12533
+G1 X117.377 Y110.649 E35.14565
+G1 X116.916 Y110.986 E35.16466
+G1 X116.518 Y111.352 E35.18269
+G1 X116.180 Y111.756 E35.20021
+G1 X115.901 Y112.201 E35.21772
+G1 X115.675 Y112.694 E35.23575
+G1 X115.498 Y113.236 E35.25477
+G1 X115.361 Y113.831 E35.27509
+G1 X115.257 Y114.478 E35.29692
+G1 X115.178 Y115.178 E35.32036
+G1 X115.114 Y115.926 E35.34539
+G1 X115.055 Y116.721 E35.37191
+G1 X114.994 Y117.555 E35.39977
+G1 X114.919 Y118.423 E35.42877
+G1 X114.822 Y119.316 E35.45869
+G1 X114.695 Y120.225 E35.48926
+G1 X114.530 Y121.141 E35.52024
+G1 X114.321 Y122.052 E35.55137
+G1 X114.062 Y122.947 E35.58241
+G1 X113.750 Y123.816 E35.61313
+G1 X113.381 Y124.645 E35.64336
+G1 X112.955 Y125.425 E35.67297
+G1 X112.471 Y126.145 E35.70185
+G1 X111.930 Y126.794 E35.72999
+G1 X111.335 Y127.365 E35.75744
+G1 X110.690 Y127.848 E35.78428
+G1 X110.000 Y128.239 E35.81068
+G1 X109.271 Y128.532 E35.83686
+G1 X108.508 Y128.724 E35.86303
+G1 X107.720 Y128.813 E35.88943
+G1 X106.915 Y128.801 E35.91627
+G1 X106.098 Y128.689 E35.94372
+G1 X105.279 Y128.482 E35.97186
+G1 X104.464 Y128.184 E36.00075
+G1 X103.660 Y127.804 E36.03035
+G1 X102.875 Y127.349 E36.06058
+G1 X102.112 Y126.830 E36.09131
+G1 X101.376 Y126.258 E36.12234
+G1 X100.672 Y125.644 E36.15347
+G1 X100.000 Y125.000 E36.18445
+G1 X99.363 Y124.339 E36.21502
+G1 X98.759 Y123.673 E36.24494
+G1 X98.189 Y123.015 E36.27394
+G1 X97.648 Y122.377 E36.30180
+G1 X97.134 Y121.768 E36.32832
+G1 X96.642 Y121.200 E36.35335
+G1 X96.167 Y120.681 E36.37679
+G1 X95.702 Y120.218 E36.39862
+G1 X95.242 Y119.817 E36.41894
+G1 X94.780 Y119.483 E36.43796
+G1 X94.308 Y119.217 E36.45599
+G1 X93.820 Y119.021 E36.47350
+G1 X93.310 Y118.893 E36.49102
+G1 X92.772 Y118.831 E36.50905
+G1 X92.201 Y118.829 E36.52806
+G1 X91.593 Y118.883 E36.54838
+G1 X90.945 Y118.984 E36.57022
+G1 X90.255 Y119.125 E36.59366
+G1 X89.523 Y119.295 E36.61868
+G1 X88.750 Y119.486 E36.64520
+G1 X87.937 Y119.685 E36.67307
+G1 X87.089 Y119.881 E36.70207
+G1 X86.209 Y120.065 E36.73199
+G1 X85.305 Y120.225 E36.76256
+G1 X84.384 Y120.352 E36.79354
+G1 X83.453 Y120.434 E36.82467
+G1 X82.521 Y120.465 E36.85570
+G1 X81.599 Y120.436 E36.88643
+G1 X80.696 Y120.342 E36.91666
+G1 X79.822 Y120.178 E36.94626
+G1 X78.988 Y119.939 E36.97515
+G1 X78.203 Y119.626 E37.00329
+G1 X77.477 Y119.236 E37.03073
+G1 X76.818 Y118.772 E37.05758
+G1 X76.233 Y118.237 E37.08398
+G1 X75.729 Y117.634 E37.11015
+G1 X75.311 Y116.968 E37.13633
+G1 X74.983 Y116.246 E37.16273
+G1 X74.745 Y115.476 E37.18957
+G1 X74.599 Y114.665 E37.21701
+G1 X74.544 Y113.822 E37.24516
+G1 X74.575 Y112.955 E37.27404
+G1 X74.688 Y112.073 E37.30364
+G1 X74.877 Y111.185 E37.33388
+G1 X75.135 Y110.299 E37.36460
+G1 X75.452 Y109.423 E37.39564
+G1 X75.819 Y108.563 E37.42676
+G1 X76.224 Y107.725 E37.45774
+G1 X76.655 Y106.915 E37.48832
+G1 X77.102 Y106.136 E37.51823
+G1 X77.551 Y105.389 E37.54724
+G1 X77.992 Y104.678 E37.57510
+G1 X78.411 Y104.001 E37.60162
+G1 X78.800 Y103.358 E37.62665
+G1 X79.147 Y102.745 E37.65009
+G1 X79.443 Y102.161 E37.67192
+G1 X79.682 Y101.599 E37.69224
+G1 X79.857 Y101.056 E37.71125
+G1 X79.964 Y100.525 E37.72929
+G1 X80.000 Y100.000 E37.74680
+G1 X79.964 Y99.475 E37.76431
+G1 X79.857 Y98.944 E37.78235
+G1 X79.682 Y98.401 E37.80136
+G1 X79.443 Y97.839 E37.82168
+G1 X79.147 Y97.255 E37.84352
+G1 X78.800 Y96.642 E37.86695
+G1 X78.411 Y95.999 E37.89198
+G1 X77.992 Y95.322 E37.91850
+G1 X77.551 Y94.611 E37.94636
+G1 X77.102 Y93.864 E37.97537
+G1 X76.655 Y93.085 E38.00528
+G1 X76.224 Y92.275 E38.03586
+G1 X75.819 Y91.437 E38.06684
+G1 X75.452 Y90.577 E38.09797
+G1 X75.135 Y89.701 E38.12900
+G1 X74.877 Y88.815 E38.15972
+G1 X74.688 Y87.927 E38.18996
+G1 X74.575 Y87.045 E38.21956
+G1 X74.544 Y86.178 E38.24845
+G1 X74.599 Y85.335 E38.27659
+G1 X74.745 Y84.524 E38.30403
+G1 X74.983 Y83.754 E38.33087
+G1 X75.311 Y83.032 E38.35728
+G1 X75.729 Y82.366 E38.38345
+G1 X76.233 Y81.763 E38.40962
+G1 X76.818 Y81.228 E38.43603
+G1 X77.477 Y80.764 E38.46287
+G1 X78.203 Y80.374 E38.49031
+G1 X78.988 Y80.061 E38.51845
+G1 X79.822 Y79.822 E38.54734
+G1 X80.696 Y79.658 E38.57694
+G1 X81.599 Y79.564 E38.60717
+G1 X82.521 Y79.535 E38.63790
+G1 X83.453 Y79.566 E38.66893
+G1 X84.384 Y79.648 E38.70006
+G1 X85.305 Y79.775 E38.73104
+G1 X86.209 Y79.935 E38.76162
+G1 X87.089 Y80.119 E38.79153
+G1 X87.937 Y80.315 E38.82054
+G1 X88.750 Y80.514 E38.84840
+G1 X89.523 Y80.705 E38.87492
+G1 X90.255 Y80.875 E38.89994
+G1 X90.945 Y81.016 E38.92338
+G1 X91.593 Y81.117 E38.94522
+G1 X92.201 Y81.171 E38.96554
+G1 X92.772 Y81.169 E38.98455
+G1 X93.310 Y81.107 E39.00259
+G1 X93.820 Y80.979 E39.02010
+G1 X94.308 Y80.783 E39.03761
+G1 X94.780 Y80.517 E39.05565
+G1 X95.242 Y80.183 E39.07466
+G1 X95.702 Y79.782 E39.09498
+G1 X96.167 Y79.319 E39.11681
+G1 X96.642 Y78.800 E39.14025
+G1 X97.134 Y78.232 E39.16528
+G1 X97.648 Y77.623 E39.19180
+G1 X98.189 Y76.985 E39.21966
+G1 X98.759 Y76.327 E39.24867
+G1 X99.363 Y75.661 E39.27858
+G1 X100.000 Y75.000 E39.30916
+G1 X100.672 Y74.356 E39.34014
+G1 X101.376 Y73.742 E39.37126
+G1 X102.112 Y73.170 E39.40230
+G1 X102.875 Y72.651 E39.43302
+G1 X103.660 Y72.196 E39.46325
+G1 X104.464 Y71.816 E39.49286
+G1 X105.279 Y71.518 E39.52174
+G1 X106.098 Y71.311 E39.54989
+G1 X106.915 Y71.199 E39.57733
+G1 X107.720 Y71.187 E39.60417
+G1 X108.508 Y71.276 E39.63057
+G1 X109.271 Y71.468 E39.65675
+G1 X110.000 Y71.761 E39.68292
+G1 X110.690 Y72.152 E39.70932
+G1 X111.335 Y72.635 E39.73617
+G1 X111.930 Y73.206 E39.76361
+G1 X112.471 Y73.855 E39.79175
+G1 X112.955 Y74.575 E39.82064
+G1 X113.381 Y75.355 E39.85024
+G1 X113.750 Y76.184 E39.88047
+G1 X114.062 Y77.053 E39.91120
+G1 X114.321 Y77.948 E39.94223
+G1 X114.530 Y78.859 E39.97336
+G1 X114.695 Y79.775 E40.00434
+G1 X114.822 Y80.684 E40.03491
+G1 X114.919 Y81.577 E40.06483
+G1 X114.994 Y82.445 E40.09383
+G1 X115.055 Y83.279 E40.12170
+G1 X115.114 Y84.074 E40.14822
+G1 X115.178 Y84.822 E40.17324
+G1 X115.257 Y85.522 E40.19668
+G1 X115.361 Y86.169 E40.21852
+G1 X115.498 Y86.764 E40.23884
+G1 X115.675 Y87.306 E40.25785
+G1 X115.901 Y87.799 E40.27588
+G1 X116.180 Y88.244 E40.29340
+G1 X116.518 Y88.648 E40.31091
+G1 X116.916 Y89.014 E40.32894
+G1 X117.377 Y89.351 E40.34795
+G1 X117.901 Y89.665 E40.36828
+G1 X118.484 Y89.964 E40.39011
+G1 X119.125 Y90.255 E40.41355
+G1 X119.817 Y90.548 E40.43857
+G1 X120.555 Y90.848 E40.46510
+G1 X121.329 Y91.165 E40.49296
+G1 X122.131 Y91.505 E40.52196
+G1 X122.951 Y91.873 E40.55188
+G1 X123.776 Y92.275 E40.58245
+G1 X124.596 Y92.714 E40.61343
+G1 X125.398 Y93.195 E40.64456
+G1 X126.170 Y93.717 E40.67559
+G1 X126.899 Y94.282 E40.70632
+G1 X127.574 Y94.889 E40.73655
+G1 X128.184 Y95.536 E40.76615
+G1 X128.719 Y96.219 E40.79504
+G1 X129.169 Y96.934 E40.82318
+G1 X129.528 Y97.676 E40.85063
+G1 X129.789 Y98.439 E40.87747
+G1 X129.947 Y99.216 E40.90387
+G1 X130.000 Y100.000 E40.93004
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E40.95612 F9000
+G1 X119.598 Y118.500 E40.98220
+G1 X119.121 Y119.121 E41.00828
+G1 X118.500 Y119.598 E41.03436
+G1 X117.776 Y119.898 E41.06044
+G1 X117.000 Y120.000 E41.08652
+G1 X83.000 Y120.000 E42.21872
+G1 X82.224 Y119.898 E42.24480
+G1 X81.500 Y119.598 E42.27088
+G1 X80.879 Y119.121 E42.29696
+G1 X80.402 Y118.500 E42.32304
+G1 X80.102 Y117.776 E42.34911
+G1 X80.000 Y117.000 E42.37519
+G1 X80.000 Y83.000 E43.50739
+G1 X80.102 Y82.224 E43.53347
+G1 X80.402 Y81.500 E43.55955
+G1 X80.879 Y80.879 E43.58563
+G1 X81.500 Y80.402 E43.61171
+G1 X82.224 Y80.102 E43.63779
+G1 X83.000 Y80.000 E43.66387
+G1 X117.000 Y80.000 E44.79607
+G1 X117.776 Y80.102 E44.82215
+G1 X118.500 Y80.402 E44.84823
+G1 X119.121 Y80.879 E44.87431
+G1 X119.598 Y81.500 E44.90039
+G1 X119.898 Y82.224 E44.92646
+G1 X120.000 Y83.000 E44.95254
+G1 X120.000 Y117.000 E46.08474
+G1 Z1.10 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E46.11092 F9000
+G1 X129.789 Y101.561 E46.13732
+G1 X129.528 Y102.324 E46.16416
+G1 X129.169 Y103.066 E46.19160
+G1 X128.719 Y103.781 E46.21975
+G1 X128.184 Y104.464 E46.24863
+G1 X127.574 Y105.111 E46.27824
+G1 X126.899 Y105.718 E46.30847
+G1 X126.170 Y106.283 E46.33919
+G1 X125.398 Y106.805 E46.37023
+G1 X124.596 Y107.286 E46.40136
+G1 X123.776 Y107.725 E46.43233
+G1 X122.951 Y108.127 E46.46291
+G1 X122.131 Y108.495 E46.49283
+G1 X121.329 Y108.835 E46.52183
+G1 X120.555 Y109.152 E46.54969
+G1 X119.817 Y109.452 E46.57621
+G1 X119.125 Y109.745 E46.60124
+G1 X118.484 Y110.036 E46.62468
+G1 X117.901 Y110.335 E46.64651
+G1 X117.377 Y110.649 E46.66683
+G1 X116.916 Y110.986 E46.68584
+G1 X116.518 Y111.352 E46.70388
+G1 X116.180 Y111.756 E46.72139
+G1 X115.901 Y112.201 E46.73890
+G1 X115.675 Y112.694 E46.75694
+G1 X115.498 Y113.236 E46.77595
+G1 X115.361 Y113.831 E46.79627
+G1 X115.257 Y114.478 E46.81811
+G1 X115.178 Y115.178 E46.84155
+G1 X115.114 Y115.926 E46.86657
+G1 X115.055 Y116.721 E46.89309
+G1 X114.994 Y117.555 E46.92095
+G1 X114.919 Y118.423 E46.94996
+G1 X114.822 Y119.316 E46.97987
+G1 X114.695 Y120.225 E47.01045
+G1 X114.530 Y121.141 E47.04143
+G1 X114.321 Y122.052 E47.07256
+G1 X114.062 Y122.947 E47.10359
+G1 X113.750 Y123.816 E47.13432
+G1 X113.381 Y124.645 E47.16455
+G1 X112.955 Y125.425 E47.19415
+G1 X112.471 Y126.145 E47.22304
+G1 X111.930 Y126.794 E47.25118
+G1 X111.335 Y127.365 E47.27862
+G1 X110.690 Y127.848 E47.30546
+G1 X110.000 Y128.239 E47.33187
+G1 X109.271 Y128.532 E47.35804
+G1 X108.508 Y128.724 E47.38421
+G1 X107.720 Y128.813 E47.41062
+G1 X106.915 Y128.801 E47.43746
+G1 X106.098 Y128.689 E47.46490
+G1 X105.279 Y128.482 E47.49305
+G1 X104.464 Y128.184 E47.52193
+G1 X103.660 Y127.804 E47.55153
+G1 X102.875 Y127.349 E47.58177
+G1 X102.112 Y126.830 E47.61249
+G1 X101.376 Y126.258 E47.64353
+G1 X100.672 Y125.644 E47.67465
+G1 X100.000 Y125.000 E47.70563
+G1 X99.363 Y124.339 E47.73621
+G1 X98.759 Y123.673 E47.76612
+G1 X98.189 Y123.015 E47.79513
+G1 X97.648 Y122.377 E47.82299
+G1 X97.134 Y121.768 E47.84951
+G1 X96.642 Y121.200 E47.87454
+G1 X96.167 Y120.681 E47.89797
+G1 X95.702 Y120.218 E47.91981
+G1 X95.242 Y119.817 E47.94013
+G1 X94.780 Y119.483 E47.95914
+G1 X94.308 Y119.217 E47.97718
+G1 X93.820 Y119.021 E47.99469
+G1 X93.310 Y118.893 E48.01220
+G1 X92.772 Y118.831 E48.03024
+G1 X92.201 Y118.829 E48.04925
+G1 X91.593 Y118.883 E48.06957
+G1 X90.945 Y118.984 E48.09141
+G1 X90.255 Y119.125 E48.11484
+G1 X89.523 Y119.295 E48.13987
+G1 X88.750 Y119.486 E48.16639
+G1 X87.937 Y119.685 E48.19425
+G1 X87.089 Y119.881 E48.22326
+G1 X86.209 Y120.065 E48.25317
+G1 X85.305 Y120.225 E48.28375
+G1 X84.384 Y120.352 E48.31473
+G1 X83.453 Y120.434 E48.34585
+G1 X82.521 Y120.465 E48.37689
+G1 X81.599 Y120.436 E48.40761
+G1 X80.696 Y120.342 E48.43785
+G1 X79.822 Y120.178 E48.46745
+G1 X78.988 Y119.939 E48.49633
+G1 X78.203 Y119.626 E48.52448
+G1 X77.477 Y119.236 E48.55192
+G1 X76.818 Y118.772 E48.57876
+G1 X76.233 Y118.237 E48.60517
+G1 X75.729 Y117.634 E48.63134
+G1 X75.311 Y116.968 E48.65751
+G1 X74.983 Y116.246 E48.68392
+G1 X74.745 Y115.476 E48.71076
+G1 X74.599 Y114.665 E48.73820
+G1 X74.544 Y113.822 E48.76634
+G1 X74.575 Y112.955 E48.79523
+G1 X74.688 Y112.073 E48.82483
+G1 X74.877 Y111.185 E48.85506
+G1 X75.135 Y110.299 E48.88579
+G1 X75.452 Y109.423 E48.91682
+G1 X75.819 Y108.563 E48.94795
+G1 X76.224 Y107.725 E48.97893
+G1 X76.655 Y106.915 E49.00950
+G1 X77.102 Y106.136 E49.03942
+G1 X77.551 Y105.389 E49.06842
+G1 X77.992 Y104.678 E49.09629
+G1 X78.411 Y104.001 E49.12281
+G1 X78.800 Y103.358 E49.14783
+G1 X79.147 Y102.745 E49.17127
+G1 X79.443 Y102.161 E49.19311
+G1 X79.682 Y101.599 E49.21343
+G1 X79.857 Y101.056 E49.23244
+G1 X79.964 Y100.525 E49.25047
+G1 X80.000 Y100.000 E49.26799
+G1 X79.964 Y99.475 E49.28550
+G1 X79.857 Y98.944 E49.30353
+G1 X79.682 Y98.401 E49.32255
+G1 X79.443 Y97.839 E49.34287
+G1 X79.147 Y97.255 E49.36470
+G1 X78.800 Y96.642 E49.38814
+G1 X78.411 Y95.999 E49.41317
+G1 X77.992 Y95.322 E49.43969
+G1 X77.551 Y94.611 E49.46755
+G1 X77.102 Y93.864 E49.49655
+G1 X76.655 Y93.085 E49.52647
+G1 X76.224 Y92.275 E49.55705
+G1 X75.819 Y91.437 E49.58802
+G1 X75.452 Y90.577 E49.61915
+G1 X75.135 Y89.701 E49.65019
+G1 X74.877 Y88.815 E49.68091
+G1 X74.688 Y87.927 E49.71114
+G1 X74.575 Y87.045 E49.74075
+G1 X74.544 Y86.178 E49.76963
+G1 X74.599 Y85.335 E49.79778
+G1 X74.745 Y84.524 E49.82522
+G1 X74.983 Y83.754 E49.85206
+G1 X75.311 Y83.032 E49.87846
+G1 X75.729 Y82.366 E49.90464
+G1 X76.233 Y81.763 E49.93081
+G1 X76.818 Y81.228 E49.95721
+G1 X77.477 Y80.764 E49.98405
+G1 X78.203 Y80.374 E50.01150
+G1 X78.988 Y80.061 E50.03964
+G1 X79.822 Y79.822 E50.06853
+G1 X80.696 Y79.658 E50.09813
+G1 X81.599 Y79.564 E50.12836
+G1 X82.521 Y79.535 E50.15909
+G1 X83.453 Y79.566 E50.19012
+G1 X84.384 Y79.648 E50.22125
+G1 X85.305 Y79.775 E50.25223
+G1 X86.209 Y79.935 E50.28280
+G1 X87.089 Y80.119 E50.31272
+G1 X87.937 Y80.315 E50.34172
+G1 X88.750 Y80.514 E50.36958
+G1 X89.523 Y80.705 E50.39611
+G1 X90.255 Y80.875 E50.42113
+G1 X90.945 Y81.016 E50.44457
+G1 X91.593 Y81.117 E50.46640
+G1 X92.201 Y81.171 E50.48673
+G1 X92.772 Y81.169 E50.50574
+G1 X93.310 Y81.107 E50.52377
+G1 X93.820 Y80.979 E50.54128
+G1 X94.308 Y80.783 E50.55880
+G1 X94.780 Y80.517 E50.57683
+G1 X95.242 Y80.183 E50.59584
+G1 X95.702 Y79.782 E50.61616
+G1 X96.167 Y79.319 E50.63800
+G1 X96.642 Y78.800 E50.66144
+G1 X97.134 Y78.232 E50.68646
+G1 X97.648 Y77.623 E50.71298
+G1 X98.189 Y76.985 E50.74085
+G1 X98.759 Y76.327 E50.76985
+G1 X99.363 Y75.661 E50.79977
+G1 X100.000 Y75.000 E50.83034
+G1 X100.672 Y74.356 E50.86132
+G1 X101.376 Y73.742 E50.89245
+G1 X102.112 Y73.170 E50.92348
+G1 X102.875 Y72.651 E50.95421
+G1 X103.660 Y72.196 E50.98444
+G1 X104.464 Y71.816 E51.01404
+G1 X105.279 Y71.518 E51.04293
+G1 X106.098 Y71.311 E51.07107
+G1 X106.915 Y71.199 E51.09851
+G1 X107.720 Y71.187 E51.12536
+G1 X108.508 Y71.276 E51.15176
+G1 X109.271 Y71.468 E51.17793
+G1 X110.000 Y71.761 E51.20411
+G1 X110.690 Y72.152 E51.23051
+G1 X111.335 Y72.635 E51.25735
+G1 X111.930 Y73.206 E51.28479
+G1 X112.471 Y73.855 E51.31294
+G1 X112.955 Y74.575 E51.34182
+G1 X113.381 Y75.355 E51.37143
+G1 X113.750 Y76.184 E51.40166
+G1 X114.062 Y77.053 E51.43238
+G1 X114.321 Y77.948 E51.46342
+G1 X114.530 Y78.859 E51.49454
+G1 X114.695 Y79.775 E51.52552
+G1 X114.822 Y80.684 E51.55610
+G1 X114.919 Y81.577 E51.58601
+G1 X114.994 Y82.445 E51.61502
+G1 X115.055 Y83.279 E51.64288
+G1 X115.114 Y84.074 E51.66940
+G1 X115.178 Y84.822 E51.69443
+G1 X115.257 Y85.522 E51.71787
+G1 X115.361 Y86.169 E51.73970
+G1 X115.498 Y86.764 E51.76002
+G1 X115.675 Y87.306 E51.77903
+G1 X115.901 Y87.799 E51.79707
+G1 X116.180 Y88.244 E51.81458
+G1 X116.518 Y88.648 E51.83209
+G1 X116.916 Y89.014 E51.85013
+G1 X117.377 Y89.351 E51.86914
+G1 X117.901 Y89.665 E51.88946
+G1 X118.484 Y89.964 E51.91130
+G1 X119.125 Y90.255 E51.93474
+G1 X119.817 Y90.548 E51.95976
+G1 X120.555 Y90.848 E51.98628
+G1 X121.329 Y91.165 E52.01414
+G1 X122.131 Y91.505 E52.04315
+G1 X122.951 Y91.873 E52.07306
+G1 X123.776 Y92.275 E52.10364
+G1 X124.596 Y92.714 E52.13462
+G1 X125.398 Y93.195 E52.16575
+G1 X126.170 Y93.717 E52.19678
+G1 X126.899 Y94.282 E52.22751
+G1 X127.574 Y94.889 E52.25774
+G1 X128.184 Y95.536 E52.28734
+G1 X128.719 Y96.219 E52.31623
+G1 X129.169 Y96.934 E52.34437
+G1 X129.528 Y97.676 E52.37181
+G1 X129.789 Y98.439 E52.39865
+G1 X129.947 Y99.216 E52.42506
+G1 X130.000 Y100.000 E52.45123
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E52.47731 F9000
+G1 X119.598 Y118.500 E52.50339
+G1 X119.121 Y119.121 E52.52947
+G1 X118.500 Y119.598 E52.55555
+G1 X117.776 Y119.898 E52.58163
+G1 X117.000 Y120.000 E52.60771
+G1 X83.000 Y120.000 E53.73991
+G1 X82.224 Y119.898 E53.76598
+G1 X81.500 Y119.598 E53.79206
+G1 X80.879 Y119.121 E53.81814
+G1 X80.402 Y118.500 E53.84422
+G1 X80.102 Y117.776 E53.87030
+G1 X80.000 Y117.000 E53.89638
+G1 X80.000 Y83.000 E55.02858
+G1 X80.102 Y82.224 E55.05466
+G1 X80.402 Y81.500 E55.08074
+G1 X80.879 Y80.879 E55.10682
+G1 X81.500 Y80.402 E55.13290
+G1 X82.224 Y80.102 E55.15898
+G1 X83.000 Y80.000 E55.18505
+G1 X117.000 Y80.000 E56.31725
+G1 X117.776 Y80.102 E56.34333
+G1 X118.500 Y80.402 E56.36941
+G1 X119.121 Y80.879 E56.39549
+G1 X119.598 Y81.500 E56.42157
+G1 X119.898 Y82.224 E56.44765
+G1 X120.000 Y83.000 E56.47373
+G1 X120.000 Y117.000 E57.60593
+G1 Z1.30 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E57.63210 F9000
+G1 X129.789 Y101.561 E57.65851
+G1 X129.528 Y102.324 E57.68535
+G1 X129.169 Y103.066 E57.71279
+G1 X128.719 Y103.781 E57.74093
+G1 X128.184 Y104.464 E57.76982
+G1 X127.574 Y105.111 E57.79942
+G1 X126.899 Y105.718 E57.82965
+G1 X126.170 Y106.283 E57.86038
+G1 X125.398 Y106.805 E57.89141
+G1 X124.596 Y107.286 E57.92254
+G1 X123.776 Y107.725 E57.95352
+G1 X122.951 Y108.127 E57.98410
+G1 X122.131 Y108.495 E58.01401
+G1 X121.329 Y108.835 E58.04302
+G1 X120.555 Y109.152 E58.07088
+G1 X119.817 Y109.452 E58.09740
+G1 X119.125 Y109.745 E58.12242
+G1 X118.484 Y110.036 E58.14586
+G1 X117.901 Y110.335 E58.16770
+G1 X117.377 Y110.649 E58.18802
+G1 X116.916 Y110.986 E58.20703
+G1 X116.518 Y111.352 E58.22507
+G1 X116.180 Y111.756 E58.24258
+G1 X115.901 Y112.201 E58.26009
+G1 X115.675 Y112.694 E58.27813
+G1 X115.498 Y113.236 E58.29714
+G1 X115.361 Y113.831 E58.31746
+G1 X115.257 Y114.478 E58.33929
+G1 X115.178 Y115.178 E58.36273
+G1 X115.114 Y115.926 E58.38776
+G1 X115.055 Y116.721 E58.41428
+G1 X114.994 Y117.555 E58.44214
+G1 X114.919 Y118.423 E58.47115
+G1 X114.822 Y119.316 E58.50106
+G1 X114.695 Y120.225 E58.53164
+G1 X114.530 Y121.141 E58.56262
+G1 X114.321 Y122.052 E58.59374
+G1 X114.062 Y122.947 E58.62478
+G1 X113.750 Y123.816 E58.65550
+G1 X113.381 Y124.645 E58.68573
+G1 X112.955 Y125.425 E58.71534
+G1 X112.471 Y126.145 E58.74422
+G1 X111.930 Y126.794 E58.77237
+G1 X111.335 Y127.365 E58.79981
+G1 X110.690 Y127.848 E58.82665
+G1 X110.000 Y128.239 E58.85305
+G1 X109.271 Y128.532 E58.87923
+G1 X108.508 Y128.724 E58.90540
+G1 X107.720 Y128.813 E58.93180
+G1 X106.915 Y128.801 E58.95865
+G1 X106.098 Y128.689 E58.98609
+G1 X105.279 Y128.482 E59.01423
+G1 X104.464 Y128.184 E59.04312
+G1 X103.660 Y127.804 E59.07272
+G1 X102.875 Y127.349 E59.10295
+G1 X102.112 Y126.830 E59.13368
+G1 X101.376 Y126.258 E59.16471
+G1 X100.672 Y125.644 E59.19584
+G1 X100.000 Y125.000 E59.22682
+G1 X99.363 Y124.339 E59.25739
+G1 X98.759 Y123.673 E59.28731
+G1 X98.189 Y123.015 E59.31631
+G1 X97.648 Y122.377 E59.34418
+G1 X97.134 Y121.768 E59.37070
+G1 X96.642 Y121.200 E59.39572
+G1 X96.167 Y120.681 E59.41916
+G1 X95.702 Y120.218 E59.44100
+G1 X95.242 Y119.817 E59.46132
+G1 X94.780 Y119.483 E59.48033
+G1 X94.308 Y119.217 E59.49836
+G1 X93.820 Y119.021 E59.51588
+G1 X93.310 Y118.893 E59.53339
+G1 X92.772 Y118.831 E59.55142
+G1 X92.201 Y118.829 E59.57043
+G1 X91.593 Y118.883 E59.59076
+G1 X90.945 Y118.984 E59.61259
+G1 X90.255 Y119.125 E59.63603
+G1 X89.523 Y119.295 E59.66105
+G1 X88.750 Y119.486 E59.68758
+G1 X87.937 Y119.685 E59.71544
+G1 X87.089 Y119.881 E59.74444
+G1 X86.209 Y120.065 E59.77436
+G1 X85.305 Y120.225 E59.80493
+G1 X84.384 Y120.352 E59.83591
+G1 X83.453 Y120.434 E59.86704
+G1 X82.521 Y120.465 E59.89807
+G1 X81.599 Y120.436 E59.92880
+G1 X80.696 Y120.342 E59.95903
+G1 X79.822 Y120.178 E59.98863
+G1 X78.988 Y119.939 E60.01752
+G1 X78.203 Y119.626 E60.04566
+G1 X77.477 Y119.236 E60.07311
+G1 X76.818 Y118.772 E60.09995
+G1 X76.233 Y118.237 E60.12635
+G1 X75.729 Y117.634 E60.15252
+G1 X75.311 Y116.968 E60.17870
+G1 X74.983 Y116.246 E60.20510
+G1 X74.745 Y115.476 E60.23194
+G1 X74.599 Y114.665 E60.25938
+G1 X74.544 Y113.822 E60.28753
+G1 X74.575 Y112.955 E60.31641
+G1 X74.688 Y112.073 E60.34602
+G1 X74.877 Y111.185 E60.37625
+G1 X75.135 Y110.299 E60.40697
+G1 X75.452 Y109.423 E60.43801
+G1 X75.819 Y108.563 E60.46914
+G1 X76.224 Y107.725 E60.50011
+G1 X76.655 Y106.915 E60.53069
+G1 X77.102 Y106.136 E60.56061
+G1 X77.551 Y105.389 E60.58961
+G1 X77.992 Y104.678 E60.61747
+G1 X78.411 Y104.001 E60.64399
+G1 X78.800 Y103.358 E60.66902
+G1 X79.147 Y102.745 E60.69246
+G1 X79.443 Y102.161 E60.71429
+G1 X79.682 Y101.599 E60.73461
+G1 X79.857 Y101.056 E60.75363
+G1 X79.964 Y100.525 E60.77166
+G1 X80.000 Y100.000 E60.78917
+G1 X79.964 Y99.475 E60.80668
+G1 X79.857 Y98.944 E60.82472
+G1 X79.682 Y98.401 E60.84373
+G1 X79.443 Y97.839 E60.86405
+G1 X79.147 Y97.255 E60.88589
+G1 X78.800 Y96.642 E60.90933
+G1 X78.411 Y95.999 E60.93435
+G1 X77.992 Y95.322 E60.96087
+G1 X77.551 Y94.611 E60.98874
+G1 X77.102 Y93.864 E61.01774
+G1 X76.655 Y93.085 E61.04766
+G1 X76.224 Y92.275 E61.07823
+G1 X75.819 Y91.437 E61.10921
+G1 X75.452 Y90.577 E61.14034
+G1 X75.135 Y89.701 E61.17137
+G1 X74.877 Y88.815 E61.20210
+G1 X74.688 Y87.927 E61.23233
+G1 X74.575 Y87.045 E61.26193
+G1 X74.544 Y86.178 E61.29082
+G1 X74.599 Y85.335 E61.31896
+G1 X74.745 Y84.524 E61.34640
+G1 X74.983 Y83.754 E61.37324
+G1 X75.311 Y83.032 E61.39965
+G1 X75.729 Y82.366 E61.42582
+G1 X76.233 Y81.763 E61.45199
+G1 X76.818 Y81.228 E61.47840
+G1 X77.477 Y80.764 E61.50524
+G1 X78.203 Y80.374 E61.53268
+G1 X78.988 Y80.061 E61.56083
+G1 X79.822 Y79.822 E61.58971
+G1 X80.696 Y79.658 E61.61931
+G1 X81.599 Y79.564 E61.64955
+G1 X82.521 Y79.535 E61.68027
+G1 X83.453 Y79.566 E61.71131
+G1 X84.384 Y79.648 E61.74243
+G1 X85.305 Y79.775 E61.77341
+G1 X86.209 Y79.935 E61.80399
+G1 X87.089 Y80.119 E61.83390
+G1 X87.937 Y80.315 E61.86291
+G1 X88.750 Y80.514 E61.89077
+G1 X89.523 Y80.705 E61.91729
+G1 X90.255 Y80.875 E61.94232
+G1 X90.945 Y81.016 E61.96575
+G1 X91.593 Y81.117 E61.98759
+G1 X92.201 Y81.171 E62.00791
+G1 X92.772 Y81.169 E62.02692
+G1 X93.310 Y81.107 E62.04496
+G1 X93.820 Y80.979 E62.06247
+G1 X94.308 Y80.783 E62.07998
+G1 X94.780 Y80.517 E62.09802
+G1 X95.242 Y80.183 E62.11703
+G1 X95.702 Y79.782 E62.13735
+G1 X96.167 Y79.319 E62.15919
+G1 X96.642 Y78.800 E62.18262
+G1 X97.134 Y78.232 E62.20765
+G1 X97.648 Y77.623 E62.23417
+G1 X98.189 Y76.985 E62.26203
+G1 X98.759 Y76.327 E62.29104
+G1 X99.363 Y75.661 E62.32095
+G1 X100.000 Y75.000 E62.35153
+G1 X100.672 Y74.356 E62.38251
+G1 X101.376 Y73.742 E62.41363
+G1 X102.112 Y73.170 E62.44467
+G1 X102.875 Y72.651 E62.47539
+G1 X103.660 Y72.196 E62.50563
+G1 X104.464 Y71.816 E62.53523
+G1 X105.279 Y71.518 E62.56411
+G1 X106.098 Y71.311 E62.59226
+G1 X106.915 Y71.199 E62.61970
+G1 X107.720 Y71.187 E62.64654
+G1 X108.508 Y71.276 E62.67295
+G1 X109.271 Y71.468 E62.69912
+G1 X110.000 Y71.761 E62.72529
+G1 X110.690 Y72.152 E62.75170
+G1 X111.335 Y72.635 E62.77854
+G1 X111.930 Y73.206 E62.80598
+G1 X112.471 Y73.855 E62.83412
+G1 X112.955 Y74.575 E62.86301
+G1 X113.381 Y75.355 E62.89261
+G1 X113.750 Y76.184 E62.92284
+G1 X114.062 Y77.053 E62.95357
+G1 X114.321 Y77.948 E62.98460
+G1 X114.530 Y78.859 E63.01573
+G1 X114.695 Y79.775 E63.04671
+G1 X114.822 Y80.684 E63.07729
+G1 X114.919 Y81.577 E63.10720
+G1 X114.994 Y82.445 E63.13620
+G1 X115.055 Y83.279 E63.16407
+G1 X115.114 Y84.074 E63.19059
+G1 X115.178 Y84.822 E63.21561
+G1 X115.257 Y85.522 E63.23905
+G1 X115.361 Y86.169 E63.26089
+G1 X115.498 Y86.764 E63.28121
+G1 X115.675 Y87.306 E63.30022
+G1 X115.901 Y87.799 E63.31826
+G1 X116.180 Y88.244 E63.33577
+G1 X116.518 Y88.648 E63.35328
+G1 X116.916 Y89.014 E63.37132
+G1 X117.377 Y89.351 E63.39033
+G1 X117.901 Y89.665 E63.41065
+G1 X118.484 Y89.964 E63.43248
+G1 X119.125 Y90.255 E63.45592
+G1 X119.817 Y90.548 E63.48095
+G1 X120.555 Y90.848 E63.50747
+G1 X121.329 Y91.165 E63.53533
+G1 X122.131 Y91.505 E63.56433
+G1 X122.951 Y91.873 E63.59425
+G1 X123.776 Y92.275 E63.62483
+G1 X124.596 Y92.714 E63.65580
+G1 X125.398 Y93.195 E63.68693
+G1 X126.170 Y93.717 E63.71797
+G1 X126.899 Y94.282 E63.74869
+G1 X127.574 Y94.889 E63.77892
+G1 X128.184 Y95.536 E63.80853
+G1 X128.719 Y96.219 E63.83741
+G1 X129.169 Y96.934 E63.86556
+G1 X129.528 Y97.676 E63.89300
+G1 X129.789 Y98.439 E63.91984
+G1 X129.947 Y99.216 E63.94624
+G1 X130.000 Y100.000 E63.97242
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E63.99850 F9000
+G1 X119.598 Y118.500 E64.02457
+G1 X119.121 Y119.121 E64.05065
+G1 X118.500 Y119.598 E64.07673
+G1 X117.776 Y119.898 E64.10281
+G1 X117.000 Y120.000 E64.12889
+G1 X83.000 Y120.000 E65.26109
+G1 X82.224 Y119.898 E65.28717
+G1 X81.500 Y119.598 E65.31325
+G1 X80.879 Y119.121 E65.33933
+G1 X80.402 Y118.500 E65.36541
+G1 X80.102 Y117.776 E65.39149
+G1 X80.000 Y117.000 E65.41757
+G1 X80.000 Y83.000 E66.54977
+G1 X80.102 Y82.224 E66.57584
+G1 X80.402 Y81.500 E66.60192
+G1 X80.879 Y80.879 E66.62800
+G1 X81.500 Y80.402 E66.65408
+G1 X82.224 Y80.102 E66.68016
+G1 X83.000 Y80.000 E66.70624
+G1 X117.000 Y80.000 E67.83844
+G1 X117.776 Y80.102 E67.86452
+G1 X118.500 Y80.402 E67.89060
+G1 X119.121 Y80.879 E67.91668
+G1 X119.598 Y81.500 E67.94276
+G1 X119.898 Y82.224 E67.96884
+G1 X120.000 Y83.000 E67.99492
+G1 X120.000 Y117.000 E69.12712
+G1 Z1.50 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E69.15329 F9000
+G1 X129.789 Y101.561 E69.17969
+G1 X129.528 Y102.324 E69.20653
+G1 X129.169 Y103.066 E69.23398
+G1 X128.719 Y103.781 E69.26212
+G1 X128.184 Y104.464 E69.29101
+G1 X127.574 Y105.111 E69.32061
+G1 X126.899 Y105.718 E69.35084
+G1 X126.170 Y106.283 E69.38157
+G1 X125.398 Y106.805 E69.41260
+G1 X124.596 Y107.286 E69.44373
+G1 X123.776 Y107.725 E69.47471
+G1 X122.951 Y108.127 E69.50528
+G1 X122.131 Y108.495 E69.53520
+G1 X121.329 Y108.835 E69.56420
+G1 X120.555 Y109.152 E69.59206
+G1 X119.817 Y109.452 E69.61858
+G1 X119.125 Y109.745 E69.64361
+G1 X118.484 Y110.036 E69.66705
+G1 X117.901 Y110.335 E69.68888
+G1 X117.377 Y110.649 E69.70921
+G1 X116.916 Y110.986 E69.72822
+G1 X116.518 Y111.352 E69.74625
+G1 X116.180 Y111.756 E69.76376
+G1 X115.901 Y112.201 E69.78128
+G1 X115.675 Y112.694 E69.79931
+G1 X115.498 Y113.236 E69.81832
+G1 X115.361 Y113.831 E69.83864
+G1 X115.257 Y114.478 E69.86048
+G1 X115.178 Y115.178 E69.88392
+G1 X115.114 Y115.926 E69.90894
+G1 X115.055 Y116.721 E69.93546
+G1 X114.994 Y117.555 E69.96333
+G1 X114.919 Y118.423 E69.99233
+G1 X114.822 Y119.316 E70.02225
+G1 X114.695 Y120.225 E70.05282
+G1 X114.530 Y121.141 E70.08380
+G1 X114.321 Y122.052 E70.11493
+G1 X114.062 Y122.947 E70.14596
+G1 X113.750 Y123.816 E70.17669
+G1 X113.381 Y124.645 E70.20692
+G1 X112.955 Y125.425 E70.23652
+G1 X112.471 Y126.145 E70.26541
+G1 X111.930 Y126.794 E70.29355
+G1 X111.335 Y127.365 E70.32099
+G1 X110.690 Y127.848 E70.34784
+G1 X110.000 Y128.239 E70.37424
+G1 X109.271 Y128.532 E70.40041
+G1 X108.508 Y128.724 E70.42659
+G1 X107.720 Y128.813 E70.45299
+G1 X106.915 Y128.801 E70.47983
+G1 X106.098 Y128.689 E70.50727
+G1 X105.279 Y128.482 E70.53542
+G1 X104.464 Y128.184 E70.56430
+G1 X103.660 Y127.804 E70.59390
+G1 X102.875 Y127.349 E70.62414
+G1 X102.112 Y126.830 E70.65486
+G1 X101.376 Y126.258 E70.68590
+G1 X100.672 Y125.644 E70.71702
+G1 X100.000 Y125.000 E70.74800
+G1 X99.363 Y124.339 E70.77858
+G1 X98.759 Y123.673 E70.80849
+G1 X98.189 Y123.015 E70.83750
+G1 X97.648 Y122.377 E70.86536
+G1 X97.134 Y121.768 E70.89188
+G1 X96.642 Y121.200 E70.91691
+G1 X96.167 Y120.681 E70.94035
+G1 X95.702 Y120.218 E70.96218
+G1 X95.242 Y119.817 E70.98250
+G1 X94.780 Y119.483 E71.00151
+G1 X94.308 Y119.217 E71.01955
+G1 X93.820 Y119.021 E71.03706
+G1 X93.310 Y118.893 E71.05457
+G1 X92.772 Y118.831 E71.07261
+G1 X92.201 Y118.829 E71.09162
+G1 X91.593 Y118.883 E71.11194
+G1 X90.945 Y118.984 E71.13378
+G1 X90.255 Y119.125 E71.15721
+G1 X89.523 Y119.295 E71.18224
+G1 X88.750 Y119.486 E71.20876
+G1 X87.937 Y119.685 E71.23662
+G1 X87.089 Y119.881 E71.26563
+G1 X86.209 Y120.065 E71.29554
+G1 X85.305 Y120.225 E71.32612
+G1 X84.384 Y120.352 E71.35710
+G1 X83.453 Y120.434 E71.38823
+G1 X82.521 Y120.465 E71.41926
+G1 X81.599 Y120.436 E71.44999
+G1 X80.696 Y120.342 E71.48022
+G1 X79.822 Y120.178 E71.50982
+G1 X78.988 Y119.939 E71.53871
+G1 X78.203 Y119.626 E71.56685
+G1 X77.477 Y119.236 E71.59429
+G1 X76.818 Y118.772 E71.62113
+G1 X76.233 Y118.237 E71.64754
+G1 X75.729 Y117.634 E71.67371
+G1 X75.311 Y116.968 E71.69988
+G1 X74.983 Y116.246 E71.72629
+G1 X74.745 Y115.476 E71.75313
+G1 X74.599 Y114.665 E71.78057
+G1 X74.544 Y113.822 E71.80871
+G1 X74.575 Y112.955 E71.83760
+G1 X74.688 Y112.073 E71.86720
+G1 X74.877 Y111.185 E71.89744
+G1 X75.135 Y110.299 E71.92816
+G1 X75.452 Y109.423 E71.95919
+G1 X75.819 Y108.563 E71.99032
+G1 X76.224 Y107.725 E72.02130
+G1 X76.655 Y106.915 E72.05188
+G1 X77.102 Y106.136 E72.08179
+G1 X77.551 Y105.389 E72.11080
+G1 X77.992 Y104.678 E72.13866
+G1 X78.411 Y104.001 E72.16518
+G1 X78.800 Y103.358 E72.19021
+G1 X79.147 Y102.745 E72.21364
+G1 X79.443 Y102.161 E72.23548
+G1 X79.682 Y101.599 E72.25580
+G1 X79.857 Y101.056 E72.27481
+G1 X79.964 Y100.525 E72.29285
+G1 X80.000 Y100.000 E72.31036
+G1 X79.964 Y99.475 E72.32787
+G1 X79.857 Y98.944 E72.34591
+G1 X79.682 Y98.401 E72.36492
+G1 X79.443 Y97.839 E72.38524
+G1 X79.147 Y97.255 E72.40707
+G1 X78.800 Y96.642 E72.43051
+G1 X78.411 Y95.999 E72.45554
+G1 X77.992 Y95.322 E72.48206
+G1 X77.551 Y94.611 E72.50992
+G1 X77.102 Y93.864 E72.53893
+G1 X76.655 Y93.085 E72.56884
+G1 X76.224 Y92.275 E72.59942
+G1 X75.819 Y91.437 E72.63040
+G1 X75.452 Y90.577 E72.66152
+G1 X75.135 Y89.701 E72.69256
+G1 X74.877 Y88.815 E72.72328
+G1 X74.688 Y87.927 E72.75352
+G1 X74.575 Y87.045 E72.78312
+G1 X74.544 Y86.178 E72.81200
+G1 X74.599 Y85.335 E72.84015
+G1 X74.745 Y84.524 E72.86759
+G1 X74.983 Y83.754 E72.89443
+G1 X75.311 Y83.032 E72.92083
+G1 X75.729 Y82.366 E72.94701
+G1 X76.233 Y81.763 E72.97318
+G1 X76.818 Y81.228 E72.99958
+G1 X77.477 Y80.764 E73.02643
+G1 X78.203 Y80.374 E73.05387
+G1 X78.988 Y80.061 E73.08201
+G1 X79.822 Y79.822 E73.11090
+G1 X80.696 Y79.658 E73.14050
+G1 X81.599 Y79.564 E73.17073
+G1 X82.521 Y79.535 E73.20146
+G1 X83.453 Y79.566 E73.23249
+G1 X84.384 Y79.648 E73.26362
+G1 X85.305 Y79.775 E73.29460
+G1 X86.209 Y79.935 E73.32517
+G1 X87.089 Y80.119 E73.35509
+G1 X87.937 Y80.315 E73.38409
+G1 X88.750 Y80.514 E73.41196
+G1 X89.523 Y80.705 E73.43848
+G1 X90.255 Y80.875 E73.46350
+G1 X90.945 Y81.016 E73.48694
+G1 X91.593 Y81.117 E73.50878
+G1 X92.201 Y81.171 E73.52910
+G1 X92.772 Y81.169 E73.54811
+G1 X93.310 Y81.107 E73.56614
+G1 X93.820 Y80.979 E73.58366
+G1 X94.308 Y80.783 E73.60117
+G1 X94.780 Y80.517 E73.61920
+G1 X95.242 Y80.183 E73.63822
+G1 X95.702 Y79.782 E73.65854
+G1 X96.167 Y79.319 E73.68037
+G1 X96.642 Y78.800 E73.70381
+G1 X97.134 Y78.232 E73.72884
+G1 X97.648 Y77.623 E73.75536
+G1 X98.189 Y76.985 E73.78322
+G1 X98.759 Y76.327 E73.81222
+G1 X99.363 Y75.661 E73.84214
+G1 X100.000 Y75.000 E73.87271
+G1 X100.672 Y74.356 E73.90369
+G1 X101.376 Y73.742 E73.93482
+G1 X102.112 Y73.170 E73.96585
+G1 X102.875 Y72.651 E73.99658
+G1 X103.660 Y72.196 E74.02681
+G1 X104.464 Y71.816 E74.05641
+G1 X105.279 Y71.518 E74.08530
+G1 X106.098 Y71.311 E74.11344
+G1 X106.915 Y71.199 E74.14089
+G1 X107.720 Y71.187 E74.16773
+G1 X108.508 Y71.276 E74.19413
+G1 X109.271 Y71.468 E74.22030
+G1 X110.000 Y71.761 E74.24648
+G1 X110.690 Y72.152 E74.27288
+G1 X111.335 Y72.635 E74.29972
+G1 X111.930 Y73.206 E74.32716
+G1 X112.471 Y73.855 E74.35531
+G1 X112.955 Y74.575 E74.38419
+G1 X113.381 Y75.355 E74.41380
+G1 X113.750 Y76.184 E74.44403
+G1 X114.062 Y77.053 E74.47475
+G1 X114.321 Y77.948 E74.50579
+G1 X114.530 Y78.859 E74.53692
+G1 X114.695 Y79.775 E74.56790
+G1 X114.822 Y80.684 E74.59847
+G1 X114.919 Y81.577 E74.62839
+G1 X114.994 Y82.445 E74.65739
+G1 X115.055 Y83.279 E74.68525
+G1 X115.114 Y84.074 E74.71177
+G1 X115.178 Y84.822 E74.73680
+G1 X115.257 Y85.522 E74.76024
+G1 X115.361 Y86.169 E74.78207
+G1 X115.498 Y86.764 E74.80239
+G1 X115.675 Y87.306 E74.82141
+G1 X115.901 Y87.799 E74.83944
+G1 X116.180 Y88.244 E74.85695
+G1 X116.518 Y88.648 E74.87447
+G1 X116.916 Y89.014 E74.89250
+G1 X117.377 Y89.351 E74.91151
+G1 X117.901 Y89.665 E74.93183
+G1 X118.484 Y89.964 E74.95367
+G1 X119.125 Y90.255 E74.97711
+G1 X119.817 Y90.548 E75.00213
+G1 X120.555 Y90.848 E75.02865
+G1 X121.329 Y91.165 E75.05652
+G1 X122.131 Y91.505 E75.08552
+G1 X122.951 Y91.873 E75.11544
+G1 X123.776 Y92.275 E75.14601
+G1 X124.596 Y92.714 E75.17699
+G1 X125.398 Y93.195 E75.20812
+G1 X126.170 Y93.717 E75.23915
+G1 X126.899 Y94.282 E75.26988
+G1 X127.574 Y94.889 E75.30011
+G1 X128.184 Y95.536 E75.32971
+G1 X128.719 Y96.219 E75.35860
+G1 X129.169 Y96.934 E75.38674
+G1 X129.528 Y97.676 E75.41418
+G1 X129.789 Y98.439 E75.44102
+G1 X129.947 Y99.216 E75.46743
+G1 X130.000 Y100.000 E75.49360
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E75.51968 F9000
+G1 X119.598 Y118.500 E75.54576
+G1 X119.121 Y119.121 E75.57184
+G1 X118.500 Y119.598 E75.59792
+G1 X117.776 Y119.898 E75.62400
+G1 X117.000 Y120.000 E75.65008
+G1 X83.000 Y120.000 E76.78228
+G1 X82.224 Y119.898 E76.80836
+G1 X81.500 Y119.598 E76.83444
+G1 X80.879 Y119.121 E76.86051
+G1 X80.402 Y118.500 E76.88659
+G1 X80.102 Y117.776 E76.91267
+G1 X80.000 Y117.000 E76.93875
+G1 X80.000 Y83.000 E78.07095
+G1 X80.102 Y82.224 E78.09703
+G1 X80.402 Y81.500 E78.12311
+G1 X80.879 Y80.879 E78.14919
+G1 X81.500 Y80.402 E78.17527
+G1 X82.224 Y80.102 E78.20135
+G1 X83.000 Y80.000 E78.22743
+G1 X117.000 Y80.000 E79.35963
+G1 X117.776 Y80.102 E79.38571
+G1 X118.500 Y80.402 E79.41178
+G1 X119.121 Y80.879 E79.43786
+G1 X119.598 Y81.500 E79.46394
+G1 X119.898 Y82.224 E79.49002
+G1 X120.000 Y83.000 E79.51610
+G1 X120.000 Y117.000 E80.64830
+G1 Z1.70 F3000
+G1 X130.000 Y100.000 F9000
+G1 X129.947 Y100.784 E80.67447 F9000
+G1 X129.789 Y101.561 E80.70088
+G1 X129.528 Y102.324 E80.72772
+G1 X129.169 Y103.066 E80.75516
+G1 X128.719 Y103.781 E80.78331
+G1 X128.184 Y104.464 E80.81219
+G1 X127.574 Y105.111 E80.84179
+G1 X126.899 Y105.718 E80.87203
+G1 X126.170 Y106.283 E80.90275
+G1 X125.398 Y106.805 E80.93379
+G1 X124.596 Y107.286 E80.96491
+G1 X123.776 Y107.725 E80.99589
+G1 X122.951 Y108.127 E81.02647
+G1 X122.131 Y108.495 E81.05638
+G1 X121.329 Y108.835 E81.08539
+G1 X120.555 Y109.152 E81.11325
+G1 X119.817 Y109.452 E81.13977
+G1 X119.125 Y109.745 E81.16480
+G1 X118.484 Y110.036 E81.18823
+G1 X117.901 Y110.335 E81.21007
+G1 X117.377 Y110.649 E81.23039
+G1 X116.916 Y110.986 E81.24940
+G1 X116.518 Y111.352 E81.26744
+G1 X116.180 Y111.756 E81.28495
+G1 X115.901 Y112.201 E81.30246
+G1 X115.675 Y112.694 E81.32050
+G1 X115.498 Y113.236 E81.33951
+G1 X115.361 Y113.831 E81.35983
+G1 X115.257 Y114.478 E81.38167
+G1 X115.178 Y115.178 E81.40510
+G1 X115.114 Y115.926 E81.43013
+G1 X115.055 Y116.721 E81.45665
+G1 X114.994 Y117.555 E81.48451
+G1 X114.919 Y118.423 E81.51352
+G1 X114.822 Y119.316 E81.54343
+G1 X114.695 Y120.225 E81.57401
+G1 X114.530 Y121.141 E81.60499
+G1 X114.321 Y122.052 E81.63611
+G1 X114.062 Y122.947 E81.66715
+G1 X113.750 Y123.816 E81.69787
+G1 X113.381 Y124.645 E81.72811
+G1 X112.955 Y125.425 E81.75771
+G1 X112.471 Y126.145 E81.78659
+G1 X111.930 Y126.794 E81.81474
+G1 X111.335 Y127.365 E81.84218
+G1 X110.690 Y127.848 E81.86902
+G1 X110.000 Y128.239 E81.89543
+G1 X109.271 Y128.532 E81.92160
+G1 X108.508 Y128.724 E81.94777
+G1 X107.720 Y128.813 E81.97418
+G1 X106.915 Y128.801 E82.00102
+G1 X106.098 Y128.689 E82.02846
+G1 X105.279 Y128.482 E82.05660
+G1 X104.464 Y128.184 E82.08549
+G1 X103.660 Y127.804 E82.11509
+G1 X102.875 Y127.349 E82.14532
+G1 X102.112 Y126.830 E82.17605
+G1 X101.376 Y126.258 E82.20708
+G1 X100.672 Y125.644 E82.23821
+G1 X100.000 Y125.000 E82.26919
+G1 X99.363 Y124.339 E82.29977
+G1 X98.759 Y123.673 E82.32968
+G1 X98.189 Y123.015 E82.35868
+G1 X97.648 Y122.377 E82.38655
+G1 X97.134 Y121.768 E82.41307
+G1 X96.642 Y121.200 E82.43809
+G1 X96.167 Y120.681 E82.46153
+G1 X95.702 Y120.218 E82.48337
+G1 X95.242 Y119.817 E82.50369
+G1 X94.780 Y119.483 E82.52270
+G1 X94.308 Y119.217 E82.54074
+G1 X93.820 Y119.021 E82.55825
+G1 X93.310 Y118.893 E82.57576
+G1 X92.772 Y118.831 E82.59380
+G1 X92.201 Y118.829 E82.61281
+G1 X91.593 Y118.883 E82.63313
+G1 X90.945 Y118.984 E82.65496
+G1 X90.255 Y119.125 E82.67840
+G1 X89.523 Y119.295 E82.70343
+G1 X88.750 Y119.486 E82.72995
+G1 X87.937 Y119.685 E82.75781
+G1 X87.089 Y119.881 E82.78681
+G1 X86.209 Y120.065 E82.81673
+G1 X85.305 Y120.225 E82.84731
+G1 X84.384 Y120.352 E82.87828
+G1 X83.453 Y120.434 E82.90941
+G1 X82.521 Y120.465 E82.94045
+G1 X81.599 Y120.436 E82.97117
+G1 X80.696 Y120.342 E83.00140
+G1 X79.822 Y120.178 E83.03101
+G1 X78.988 Y119.939 E83.05989
+G1 X78.203 Y119.626 E83.08804
+G1 X77.477 Y119.236 E83.11548
+G1 X76.818 Y118.772 E83.14232
+G1 X76.233 Y118.237 E83.16872
+G1 X75.729 Y117.634 E83.19490
+G1 X75.311 Y116.968 E83.22107
+G1 X74.983 Y116.246 E83.24747
+G1 X74.745 Y115.476 E83.27432
+G1 X74.599 Y114.665 E83.30176
+G1 X74.544 Y113.822 E83.32990
+G1 X74.575 Y112.955 E83.35879
+G1 X74.688 Y112.073 E83.38839
+G1 X74.877 Y111.185 E83.41862
+G1 X75.135 Y110.299 E83.44935
+G1 X75.452 Y109.423 E83.48038
+G1 X75.819 Y108.563 E83.51151
+G1 X76.224 Y107.725 E83.54249
+G1 X76.655 Y106.915 E83.57306
+G1 X77.102 Y106.136 E83.60298
+G1 X77.551 Y105.389 E83.63198
+G1 X77.992 Y104.678 E83.65984
+G1 X78.411 Y104.001 E83.68637
+G1 X78.800 Y103.358 E83.71139
+G1 X79.147 Y102.745 E83.73483
+G1 X79.443 Y102.161 E83.75666
+G1 X79.682 Y101.599 E83.77699
+G1 X79.857 Y101.056 E83.79600
+G1 X79.964 Y100.525 E83.81403
+G1 X80.000 Y100.000 E83.83154
+G1 X79.964 Y99.475 E83.84906
+G1 X79.857 Y98.944 E83.86709
+G1 X79.682 Y98.401 E83.88610
+G1 X79.443 Y97.839 E83.90642
+G1 X79.147 Y97.255 E83.92826
+G1 X78.800 Y96.642 E83.95170
+G1 X78.411 Y95.999 E83.97672
+G1 X77.992 Y95.322 E84.00324
+G1 X77.551 Y94.611 E84.03111
+G1 X77.102 Y93.864 E84.06011
+G1 X76.655 Y93.085 E84.09003
+G1 X76.224 Y92.275 E84.12060
+G1 X75.819 Y91.437 E84.15158
+G1 X75.452 Y90.577 E84.18271
+G1 X75.135 Y89.701 E84.21374
+G1 X74.877 Y88.815 E84.24447
+G1 X74.688 Y87.927 E84.27470
+G1 X74.575 Y87.045 E84.30430
+G1 X74.544 Y86.178 E84.33319
+G1 X74.599 Y85.335 E84.36133
+G1 X74.745 Y84.524 E84.38877
+G1 X74.983 Y83.754 E84.41562
+G1 X75.311 Y83.032 E84.44202
+G1 X75.729 Y82.366 E84.46819
+G1 X76.233 Y81.763 E84.49437
+G1 X76.818 Y81.228 E84.52077
+G1 X77.477 Y80.764 E84.54761
+G1 X78.203 Y80.374 E84.57505
+G1 X78.988 Y80.061 E84.60320
+G1 X79.822 Y79.822 E84.63208
+G1 X80.696 Y79.658 E84.66169
+G1 X81.599 Y79.564 E84.69192
+G1 X82.521 Y79.535 E84.72264
+G1 X83.453 Y79.566 E84.75368
+G1 X84.384 Y79.648 E84.78480
+G1 X85.305 Y79.775 E84.81578
+G1 X86.209 Y79.935 E84.84636
+G1 X87.089 Y80.119 E84.87628
+G1 X87.937 Y80.315 E84.90528
+G1 X88.750 Y80.514 E84.93314
+G1 X89.523 Y80.705 E84.95966
+G1 X90.255 Y80.875 E84.98469
+G1 X90.945 Y81.016 E85.00813
+G1 X91.593 Y81.117 E85.02996
+G1 X92.201 Y81.171 E85.05028
+G1 X92.772 Y81.169 E85.06929
+G1 X93.310 Y81.107 E85.08733
+G1 X93.820 Y80.979 E85.10484
+G1 X94.308 Y80.783 E85.12235
+G1 X94.780 Y80.517 E85.14039
+G1 X95.242 Y80.183 E85.15940
+G1 X95.702 Y79.782 E85.17972
+G1 X96.167 Y79.319 E85.20156
+G1 X96.642 Y78.800 E85.22500
+G1 X97.134 Y78.232 E85.25002
+G1 X97.648 Y77.623 E85.27654
+G1 X98.189 Y76.985 E85.30440
+G1 X98.759 Y76.327 E85.33341
+G1 X99.363 Y75.661 E85.36332
+G1 X100.000 Y75.000 E85.39390
+G1 X100.672 Y74.356 E85.42488
+G1 X101.376 Y73.742 E85.45601
+G1 X102.112 Y73.170 E85.48704
+G1 X102.875 Y72.651 E85.51777
+G1 X103.660 Y72.196 E85.54800
+G1 X104.464 Y71.816 E85.57760
+G1 X105.279 Y71.518 E85.60649
+G1 X106.098 Y71.311 E85.63463
+G1 X106.915 Y71.199 E85.66207
+G1 X107.720 Y71.187 E85.68891
+G1 X108.508 Y71.276 E85.71532
+G1 X109.271 Y71.468 E85.74149
+G1 X110.000 Y71.761 E85.76766
+G1 X110.690 Y72.152 E85.79407
+G1 X111.335 Y72.635 E85.82091
+G1 X111.930 Y73.206 E85.84835
+G1 X112.471 Y73.855 E85.87649
+G1 X112.955 Y74.575 E85.90538
+G1 X113.381 Y75.355 E85.93498
+G1 X113.750 Y76.184 E85.96522
+G1 X114.062 Y77.053 E85.99594
+G1 X114.321 Y77.948 E86.02698
+G1 X114.530 Y78.859 E86.05810
+G1 X114.695 Y79.775 E86.08908
+G1 X114.822 Y80.684 E86.11966
+G1 X114.919 Y81.577 E86.14957
+G1 X114.994 Y82.445 E86.17858
+G1 X115.055 Y83.279 E86.20644
+G1 X115.114 Y84.074 E86.23296
+G1 X115.178 Y84.822 E86.25799
+G1 X115.257 Y85.522 E86.28142
+G1 X115.361 Y86.169 E86.30326
+G1 X115.498 Y86.764 E86.32358
+G1 X115.675 Y87.306 E86.34259
+G1 X115.901 Y87.799 E86.36063
+G1 X116.180 Y88.244 E86.37814
+G1 X116.518 Y88.648 E86.39565
+G1 X116.916 Y89.014 E86.41369
+G1 X117.377 Y89.351 E86.43270
+G1 X117.901 Y89.665 E86.45302
+G1 X118.484 Y89.964 E86.47486
+G1 X119.125 Y90.255 E86.49829
+G1 X119.817 Y90.548 E86.52332
+G1 X120.555 Y90.848 E86.54984
+G1 X121.329 Y91.165 E86.57770
+G1 X122.131 Y91.505 E86.60671
+G1 X122.951 Y91.873 E86.63662
+G1 X123.776 Y92.275 E86.66720
+G1 X124.596 Y92.714 E86.69818
+G1 X125.398 Y93.195 E86.72930
+G1 X126.170 Y93.717 E86.76034
+G1 X126.899 Y94.282 E86.79106
+G1 X127.574 Y94.889 E86.82130
+G1 X128.184 Y95.536 E86.85090
+G1 X128.719 Y96.219 E86.87978
+G1 X129.169 Y96.934 E86.90793
+G1 X129.528 Y97.676 E86.93537
+G1 X129.789 Y98.439 E86.96221
+G1 X129.947 Y99.216 E86.98861
+G1 X130.000 Y100.000 E87.01479
+G1 X120.000 Y117.000 F9000
+G1 X119.898 Y117.776 E87.04087 F9000
+G1 X119.598 Y118.500 E87.06695
+G1 X119.121 Y119.121 E87.09303
+G1 X118.500 Y119.598 E87.11910
+G1 X117.776 Y119.898 E87.14518
+G1 X117.000 Y120.000 E87.17126
+G1 X83.000 Y120.000 E88.30346
+G1 X82.224 Y119.898 E88.32954
+G1 X81.500 Y119.598 E88.35562
+G1 X80.879 Y119.121 E88.38170
+G1 X80.402 Y118.500 E88.40778
+G1 X80.102 Y117.776 E88.43386
+G1 X80.000 Y117.000 E88.45994
+G1 X80.000 Y83.000 E89.59214
+G1 X80.102 Y82.224 E89.61822
+G1 X80.402 Y81.500 E89.64430
+G1 X80.879 Y80.879 E89.67038
+G1 X81.500 Y80.402 E89.69645
+G1 X82.224 Y80.102 E89.72253
+G1 X83.000 Y80.000 E89.74861
+G1 X117.000 Y80.000 E90.88081
+G1 X117.776 Y80.102 E90.90689
+G1 X118.500 Y80.402 E90.93297
+G1 X119.121 Y80.879 E90.95905
+G1 X119.598 Y81.500 E90.98513
+G1 X119.898 Y82.224 E91.01121
+G1 X120.000 Y83.000 E91.03729
+G1 X120.000 Y117.000 E92.16949
+G1 Z1.90 F3000
+M104 S0
@@ -0,0 +1,3153 @@
+; Delta arcs for make bench-delta: 0.1 mm segments on 5 circles of 10 mm
+; radius at 100 mm/s, like tests/arc01.gcode in the middle of the delta bed.
+; M400 lets the queue run empty after homing, so the simulator knows the
+; tower heights.
+G28
+G21
+G90
+M82
+G1 Z0.3 F3000
+G1 X10 Y0 F9000
+M400
+G92 E0
+G1 X9.999 Y0.100 E0.00333 F6000
+G1 X9.998 Y0.200 E0.00666
+G1 X9.995 Y0.300 E0.00999
+G1 X9.992 Y0.400 E0.01332
+G1 X9.987 Y0.500 E0.01665
+G1 X9.982 Y0.600 E0.01998
+G1 X9.975 Y0.700 E0.02331
+G1 X9.968 Y0.800 E0.02664
+G1 X9.959 Y0.899 E0.02997
+G1 X9.950 Y0.999 E0.03330
+G1 X9.939 Y1.098 E0.03663
+G1 X9.928 Y1.198 E0.03996
+G1 X9.916 Y1.297 E0.04329
+G1 X9.902 Y1.396 E0.04662
+G1 X9.888 Y1.495 E0.04995
+G1 X9.872 Y1.594 E0.05328
+G1 X9.856 Y1.693 E0.05661
+G1 X9.838 Y1.791 E0.05994
+G1 X9.820 Y1.890 E0.06327
+G1 X9.800 Y1.988 E0.06660
+G1 X9.780 Y2.086 E0.06993
+G1 X9.759 Y2.183 E0.07326
+G1 X9.736 Y2.281 E0.07659
+G1 X9.713 Y2.378 E0.07992
+G1 X9.689 Y2.475 E0.08325
+G1 X9.664 Y2.572 E0.08658
+G1 X9.637 Y2.669 E0.08991
+G1 X9.610 Y2.765 E0.09324
+G1 X9.582 Y2.861 E0.09657
+G1 X9.553 Y2.957 E0.09990
+G1 X9.523 Y3.052 E0.10323
+G1 X9.492 Y3.147 E0.10656
+G1 X9.460 Y3.242 E0.10989
+G1 X9.427 Y3.336 E0.11322
+G1 X9.393 Y3.431 E0.11655
+G1 X9.358 Y3.524 E0.11988
+G1 X9.323 Y3.618 E0.12321
+G1 X9.286 Y3.711 E0.12654
+G1 X9.248 Y3.804 E0.12987
+G1 X9.210 Y3.896 E0.13320
+G1 X9.170 Y3.988 E0.13653
+G1 X9.130 Y4.080 E0.13986
+G1 X9.089 Y4.171 E0.14319
+G1 X9.047 Y4.261 E0.14652
+G1 X9.003 Y4.352 E0.14985
+G1 X8.959 Y4.442 E0.15318
+G1 X8.915 Y4.531 E0.15651
+G1 X8.869 Y4.620 E0.15984
+G1 X8.822 Y4.708 E0.16317
+G1 X8.775 Y4.796 E0.16650
+G1 X8.726 Y4.884 E0.16983
+G1 X8.677 Y4.971 E0.17316
+G1 X8.627 Y5.058 E0.17649
+G1 X8.576 Y5.144 E0.17982
+G1 X8.524 Y5.229 E0.18315
+G1 X8.471 Y5.314 E0.18648
+G1 X8.417 Y5.399 E0.18981
+G1 X8.363 Y5.483 E0.19314
+G1 X8.308 Y5.566 E0.19647
+G1 X8.252 Y5.649 E0.19980
+G1 X8.195 Y5.731 E0.20313
+G1 X8.137 Y5.813 E0.20646
+G1 X8.078 Y5.894 E0.20979
+G1 X8.019 Y5.975 E0.21312
+G1 X7.959 Y6.054 E0.21645
+G1 X7.898 Y6.134 E0.21978
+G1 X7.836 Y6.213 E0.22311
+G1 X7.774 Y6.291 E0.22644
+G1 X7.710 Y6.368 E0.22977
+G1 X7.646 Y6.445 E0.23310
+G1 X7.581 Y6.521 E0.23643
+G1 X7.516 Y6.597 E0.23976
+G1 X7.449 Y6.671 E0.24309
+G1 X7.382 Y6.746 E0.24642
+G1 X7.314 Y6.819 E0.24975
+G1 X7.246 Y6.892 E0.25308
+G1 X7.176 Y6.964 E0.25641
+G1 X7.106 Y7.036 E0.25974
+G1 X7.036 Y7.106 E0.26307
+G1 X6.964 Y7.176 E0.26640
+G1 X6.892 Y7.246 E0.26973
+G1 X6.819 Y7.314 E0.27306
+G1 X6.746 Y7.382 E0.27639
+G1 X6.671 Y7.449 E0.27972
+G1 X6.597 Y7.516 E0.28305
+G1 X6.521 Y7.581 E0.28638
+G1 X6.445 Y7.646 E0.28971
+G1 X6.368 Y7.710 E0.29304
+G1 X6.291 Y7.774 E0.29637
+G1 X6.213 Y7.836 E0.29970
+G1 X6.134 Y7.898 E0.30303
+G1 X6.054 Y7.959 E0.30636
+G1 X5.975 Y8.019 E0.30969
+G1 X5.894 Y8.078 E0.31302
+G1 X5.813 Y8.137 E0.31635
+G1 X5.731 Y8.195 E0.31968
+G1 X5.649 Y8.252 E0.32301
+G1 X5.566 Y8.308 E0.32634
+G1 X5.483 Y8.363 E0.32967
+G1 X5.399 Y8.417 E0.33300
+G1 X5.314 Y8.471 E0.33633
+G1 X5.229 Y8.524 E0.33966
+G1 X5.144 Y8.576 E0.34299
+G1 X5.058 Y8.627 E0.34632
+G1 X4.971 Y8.677 E0.34965
+G1 X4.884 Y8.726 E0.35298
+G1 X4.796 Y8.775 E0.35631
+G1 X4.708 Y8.822 E0.35964
+G1 X4.620 Y8.869 E0.36297
+G1 X4.531 Y8.915 E0.36630
+G1 X4.442 Y8.959 E0.36963
+G1 X4.352 Y9.003 E0.37296
+G1 X4.261 Y9.047 E0.37629
+G1 X4.171 Y9.089 E0.37962
+G1 X4.080 Y9.130 E0.38295
+G1 X3.988 Y9.170 E0.38628
+G1 X3.896 Y9.210 E0.38961
+G1 X3.804 Y9.248 E0.39294
+G1 X3.711 Y9.286 E0.39627
+G1 X3.618 Y9.323 E0.39960
+G1 X3.524 Y9.358 E0.40293
+G1 X3.431 Y9.393 E0.40626
+G1 X3.336 Y9.427 E0.40959
+G1 X3.242 Y9.460 E0.41292
+G1 X3.147 Y9.492 E0.41625
+G1 X3.052 Y9.523 E0.41958
+G1 X2.957 Y9.553 E0.42291
+G1 X2.861 Y9.582 E0.42624
+G1 X2.765 Y9.610 E0.42957
+G1 X2.669 Y9.637 E0.43290
+G1 X2.572 Y9.664 E0.43623
+G1 X2.475 Y9.689 E0.43956
+G1 X2.378 Y9.713 E0.44289
+G1 X2.281 Y9.736 E0.44622
+G1 X2.183 Y9.759 E0.44955
+G1 X2.086 Y9.780 E0.45288
+G1 X1.988 Y9.800 E0.45621
+G1 X1.890 Y9.820 E0.45954
+G1 X1.791 Y9.838 E0.46287
+G1 X1.693 Y9.856 E0.46620
+G1 X1.594 Y9.872 E0.46953
+G1 X1.495 Y9.888 E0.47286
+G1 X1.396 Y9.902 E0.47619
+G1 X1.297 Y9.916 E0.47952
+G1 X1.198 Y9.928 E0.48285
+G1 X1.098 Y9.939 E0.48618
+G1 X0.999 Y9.950 E0.48951
+G1 X0.899 Y9.959 E0.49284
+G1 X0.800 Y9.968 E0.49617
+G1 X0.700 Y9.975 E0.49950
+G1 X0.600 Y9.982 E0.50283
+G1 X0.500 Y9.987 E0.50616
+G1 X0.400 Y9.992 E0.50949
+G1 X0.300 Y9.995 E0.51282
+G1 X0.200 Y9.998 E0.51615
+G1 X0.100 Y9.999 E0.51948
+G1 X0.000 Y10.000 E0.52281
+G1 X-0.100 Y9.999 E0.52614
+G1 X-0.200 Y9.998 E0.52947
+G1 X-0.300 Y9.995 E0.53280
+G1 X-0.400 Y9.992 E0.53613
+G1 X-0.500 Y9.987 E0.53946
+G1 X-0.600 Y9.982 E0.54279
+G1 X-0.700 Y9.975 E0.54612
+G1 X-0.800 Y9.968 E0.54945
+G1 X-0.899 Y9.959 E0.55278
+G1 X-0.999 Y9.950 E0.55611
+G1 X-1.098 Y9.939 E0.55944
+G1 X-1.198 Y9.928 E0.56277
+G1 X-1.297 Y9.916 E0.56610
+G1 X-1.396 Y9.902 E0.56943
+G1 X-1.495 Y9.888 E0.57276
+G1 X-1.594 Y9.872 E0.57609
+G1 X-1.693 Y9.856 E0.57942
+G1 X-1.791 Y9.838 E0.58275
+G1 X-1.890 Y9.820 E0.58608
+G1 X-1.988 Y9.800 E0.58941
+G1 X-2.086 Y9.780 E0.59274
+G1 X-2.183 Y9.759 E0.59607
+G1 X-2.281 Y9.736 E0.59940
+G1 X-2.378 Y9.713 E0.60273
+G1 X-2.475 Y9.689 E0.60606
+G1 X-2.572 Y9.664 E0.60939
+G1 X-2.669 Y9.637 E0.61272
+G1 X-2.765 Y9.610 E0.61605
+G1 X-2.861 Y9.582 E0.61938
+G1 X-2.957 Y9.553 E0.62271
+G1 X-3.052 Y9.523 E0.62604
+G1 X-3.147 Y9.492 E0.62937
+G1 X-3.242 Y9.460 E0.63270
+G1 X-3.336 Y9.427 E0.63603
+G1 X-3.431 Y9.393 E0.63936
+G1 X-3.524 Y9.358 E0.64269
+G1 X-3.618 Y9.323 E0.64602
+G1 X-3.711 Y9.286 E0.64935
+G1 X-3.804 Y9.248 E0.65268
+G1 X-3.896 Y9.210 E0.65601
+G1 X-3.988 Y9.170 E0.65934
+G1 X-4.080 Y9.130 E0.66267
+G1 X-4.171 Y9.089 E0.66600
+G1 X-4.261 Y9.047 E0.66933
+G1 X-4.352 Y9.003 E0.67266
+G1 X-4.442 Y8.959 E0.67599
+G1 X-4.531 Y8.915 E0.67932
+G1 X-4.620 Y8.869 E0.68265
+G1 X-4.708 Y8.822 E0.68598
+G1 X-4.796 Y8.775 E0.68931
+G1 X-4.884 Y8.726 E0.69264
+G1 X-4.971 Y8.677 E0.69597
+G1 X-5.058 Y8.627 E0.69930
+G1 X-5.144 Y8.576 E0.70263
+G1 X-5.229 Y8.524 E0.70596
+G1 X-5.314 Y8.471 E0.70929
+G1 X-5.399 Y8.417 E0.71262
+G1 X-5.483 Y8.363 E0.71595
+G1 X-5.566 Y8.308 E0.71928
+G1 X-5.649 Y8.252 E0.72261
+G1 X-5.731 Y8.195 E0.72594
+G1 X-5.813 Y8.137 E0.72927
+G1 X-5.894 Y8.078 E0.73260
+G1 X-5.975 Y8.019 E0.73593
+G1 X-6.054 Y7.959 E0.73926
+G1 X-6.134 Y7.898 E0.74259
+G1 X-6.213 Y7.836 E0.74592
+G1 X-6.291 Y7.774 E0.74925
+G1 X-6.368 Y7.710 E0.75258
+G1 X-6.445 Y7.646 E0.75591
+G1 X-6.521 Y7.581 E0.75924
+G1 X-6.597 Y7.516 E0.76257
+G1 X-6.671 Y7.449 E0.76590
+G1 X-6.746 Y7.382 E0.76923
+G1 X-6.819 Y7.314 E0.77256
+G1 X-6.892 Y7.246 E0.77589
+G1 X-6.964 Y7.176 E0.77922
+G1 X-7.036 Y7.106 E0.78255
+G1 X-7.106 Y7.036 E0.78588
+G1 X-7.176 Y6.964 E0.78921
+G1 X-7.246 Y6.892 E0.79254
+G1 X-7.314 Y6.819 E0.79587
+G1 X-7.382 Y6.746 E0.79920
+G1 X-7.449 Y6.671 E0.80253
+G1 X-7.516 Y6.597 E0.80586
+G1 X-7.581 Y6.521 E0.80919
+G1 X-7.646 Y6.445 E0.81252
+G1 X-7.710 Y6.368 E0.81585
+G1 X-7.774 Y6.291 E0.81918
+G1 X-7.836 Y6.213 E0.82251
+G1 X-7.898 Y6.134 E0.82584
+G1 X-7.959 Y6.054 E0.82917
+G1 X-8.019 Y5.975 E0.83250
+G1 X-8.078 Y5.894 E0.83583
+G1 X-8.137 Y5.813 E0.83916
+G1 X-8.195 Y5.731 E0.84249
+G1 X-8.252 Y5.649 E0.84582
+G1 X-8.308 Y5.566 E0.84915
+G1 X-8.363 Y5.483 E0.85248
+G1 X-8.417 Y5.399 E0.85581
+G1 X-8.471 Y5.314 E0.85914
+G1 X-8.524 Y5.229 E0.86247
+G1 X-8.576 Y5.144 E0.86580
+G1 X-8.627 Y5.058 E0.86913
+G1 X-8.677 Y4.971 E0.87246
+G1 X-8.726 Y4.884 E0.87579
+G1 X-8.775 Y4.796 E0.87912
+G1 X-8.822 Y4.708 E0.88245
+G1 X-8.869 Y4.620 E0.88578
+G1 X-8.915 Y4.531 E0.88911
+G1 X-8.959 Y4.442 E0.89244
+G1 X-9.003 Y4.352 E0.89577
+G1 X-9.047 Y4.261 E0.89910
+G1 X-9.089 Y4.171 E0.90243
+G1 X-9.130 Y4.080 E0.90576
+G1 X-9.170 Y3.988 E0.90909
+G1 X-9.210 Y3.896 E0.91242
+G1 X-9.248 Y3.804 E0.91575
+G1 X-9.286 Y3.711 E0.91908
+G1 X-9.323 Y3.618 E0.92241
+G1 X-9.358 Y3.524 E0.92574
+G1 X-9.393 Y3.431 E0.92907
+G1 X-9.427 Y3.336 E0.93240
+G1 X-9.460 Y3.242 E0.93573
+G1 X-9.492 Y3.147 E0.93906
+G1 X-9.523 Y3.052 E0.94239
+G1 X-9.553 Y2.957 E0.94572
+G1 X-9.582 Y2.861 E0.94905
+G1 X-9.610 Y2.765 E0.95238
+G1 X-9.637 Y2.669 E0.95571
+G1 X-9.664 Y2.572 E0.95904
+G1 X-9.689 Y2.475 E0.96237
+G1 X-9.713 Y2.378 E0.96570
+G1 X-9.736 Y2.281 E0.96903
+G1 X-9.759 Y2.183 E0.97236
+G1 X-9.780 Y2.086 E0.97569
+G1 X-9.800 Y1.988 E0.97902
+G1 X-9.820 Y1.890 E0.98235
+G1 X-9.838 Y1.791 E0.98568
+G1 X-9.856 Y1.693 E0.98901
+G1 X-9.872 Y1.594 E0.99234
+G1 X-9.888 Y1.495 E0.99567
+G1 X-9.902 Y1.396 E0.99900
+G1 X-9.916 Y1.297 E1.00233
+G1 X-9.928 Y1.198 E1.00566
+G1 X-9.939 Y1.098 E1.00899
+G1 X-9.950 Y0.999 E1.01232
+G1 X-9.959 Y0.899 E1.01565
+G1 X-9.968 Y0.800 E1.01898
+G1 X-9.975 Y0.700 E1.02231
+G1 X-9.982 Y0.600 E1.02564
+G1 X-9.987 Y0.500 E1.02897
+G1 X-9.992 Y0.400 E1.03230
+G1 X-9.995 Y0.300 E1.03563
+G1 X-9.998 Y0.200 E1.03896
+G1 X-9.999 Y0.100 E1.04229
+G1 X-10.000 Y0.000 E1.04562
+G1 X-9.999 Y-0.100 E1.04895
+G1 X-9.998 Y-0.200 E1.05228
+G1 X-9.995 Y-0.300 E1.05561
+G1 X-9.992 Y-0.400 E1.05894
+G1 X-9.987 Y-0.500 E1.06227
+G1 X-9.982 Y-0.600 E1.06560
+G1 X-9.975 Y-0.700 E1.06893
+G1 X-9.968 Y-0.800 E1.07226
+G1 X-9.959 Y-0.899 E1.07559
+G1 X-9.950 Y-0.999 E1.07892
+G1 X-9.939 Y-1.098 E1.08225
+G1 X-9.928 Y-1.198 E1.08558
+G1 X-9.916 Y-1.297 E1.08891
+G1 X-9.902 Y-1.396 E1.09224
+G1 X-9.888 Y-1.495 E1.09557
+G1 X-9.872 Y-1.594 E1.09890
+G1 X-9.856 Y-1.693 E1.10223
+G1 X-9.838 Y-1.791 E1.10556
+G1 X-9.820 Y-1.890 E1.10889
+G1 X-9.800 Y-1.988 E1.11222
+G1 X-9.780 Y-2.086 E1.11555
+G1 X-9.759 Y-2.183 E1.11888
+G1 X-9.736 Y-2.281 E1.12221
+G1 X-9.713 Y-2.378 E1.12554
+G1 X-9.689 Y-2.475 E1.12887
+G1 X-9.664 Y-2.572 E1.13220
+G1 X-9.637 Y-2.669 E1.13553
+G1 X-9.610 Y-2.765 E1.13886
+G1 X-9.582 Y-2.861 E1.14219
+G1 X-9.553 Y-2.957 E1.14552
+G1 X-9.523 Y-3.052 E1.14885
+G1 X-9.492 Y-3.147 E1.15218
+G1 X-9.460 Y-3.242 E1.15551
+G1 X-9.427 Y-3.336 E1.15884
+G1 X-9.393 Y-3.431 E1.16217
+G1 X-9.358 Y-3.524 E1.16550
+G1 X-9.323 Y-3.618 E1.16883
+G1 X-9.286 Y-3.711 E1.17216
+G1 X-9.248 Y-3.804 E1.17549
+G1 X-9.210 Y-3.896 E1.17882
+G1 X-9.170 Y-3.988 E1.18215
+G1 X-9.130 Y-4.080 E1.18548
+G1 X-9.089 Y-4.171 E1.18881
+G1 X-9.047 Y-4.261 E1.19214
+G1 X-9.003 Y-4.352 E1.19547
+G1 X-8.959 Y-4.442 E1.19880
+G1 X-8.915 Y-4.531 E1.20213
+G1 X-8.869 Y-4.620 E1.20546
+G1 X-8.822 Y-4.708 E1.20879
+G1 X-8.775 Y-4.796 E1.21212
+G1 X-8.726 Y-4.884 E1.21545
+G1 X-8.677 Y-4.971 E1.21878
+G1 X-8.627 Y-5.058 E1.22211
+G1 X-8.576 Y-5.144 E1.22544
+G1 X-8.524 Y-5.229 E1.22877
+G1 X-8.471 Y-5.314 E1.23210
+G1 X-8.417 Y-5.399 E1.23543
+G1 X-8.363 Y-5.483 E1.23876
+G1 X-8.308 Y-5.566 E1.24209
+G1 X-8.252 Y-5.649 E1.24542
+G1 X-8.195 Y-5.731 E1.24875
+G1 X-8.137 Y-5.813 E1.25208
+G1 X-8.078 Y-5.894 E1.25541
+G1 X-8.019 Y-5.975 E1.25874
+G1 X-7.959 Y-6.054 E1.26207
+G1 X-7.898 Y-6.134 E1.26540
+G1 X-7.836 Y-6.213 E1.26873
+G1 X-7.774 Y-6.291 E1.27206
+G1 X-7.710 Y-6.368 E1.27539
+G1 X-7.646 Y-6.445 E1.27872
+G1 X-7.581 Y-6.521 E1.28205
+G1 X-7.516 Y-6.597 E1.28538
+G1 X-7.449 Y-6.671 E1.28871
+G1 X-7.382 Y-6.746 E1.29204
+G1 X-7.314 Y-6.819 E1.29537
+G1 X-7.246 Y-6.892 E1.29870
+G1 X-7.176 Y-6.964 E1.30203
+G1 X-7.106 Y-7.036 E1.30536
+G1 X-7.036 Y-7.106 E1.30869
+G1 X-6.964 Y-7.176 E1.31202
+G1 X-6.892 Y-7.246 E1.31535
+G1 X-6.819 Y-7.314 E1.31868
+G1 X-6.746 Y-7.382 E1.32201
+G1 X-6.671 Y-7.449 E1.32534
+G1 X-6.597 Y-7.516 E1.32867
+G1 X-6.521 Y-7.581 E1.33200
+G1 X-6.445 Y-7.646 E1.33533
+G1 X-6.368 Y-7.710 E1.33866
+G1 X-6.291 Y-7.774 E1.34199
+G1 X-6.213 Y-7.836 E1.34532
+G1 X-6.134 Y-7.898 E1.34865
+G1 X-6.054 Y-7.959 E1.35198
+G1 X-5.975 Y-8.019 E1.35531
+G1 X-5.894 Y-8.078 E1.35864
+G1 X-5.813 Y-8.137 E1.36197
+G1 X-5.731 Y-8.195 E1.36530
+G1 X-5.649 Y-8.252 E1.36863
+G1 X-5.566 Y-8.308 E1.37196
+G1 X-5.483 Y-8.363 E1.37529
+G1 X-5.399 Y-8.417 E1.37862
+G1 X-5.314 Y-8.471 E1.38195
+G1 X-5.229 Y-8.524 E1.38528
+G1 X-5.144 Y-8.576 E1.38861
+G1 X-5.058 Y-8.627 E1.39194
+G1 X-4.971 Y-8.677 E1.39527
+G1 X-4.884 Y-8.726 E1.39860
+G1 X-4.796 Y-8.775 E1.40193
+G1 X-4.708 Y-8.822 E1.40526
+G1 X-4.620 Y-8.869 E1.40859
+G1 X-4.531 Y-8.915 E1.41192
+G1 X-4.442 Y-8.959 E1.41525
+G1 X-4.352 Y-9.003 E1.41858
+G1 X-4.261 Y-9.047 E1.42191
+G1 X-4.171 Y-9.089 E1.42524
+G1 X-4.080 Y-9.130 E1.42857
+G1 X-3.988 Y-9.170 E1.43190
+G1 X-3.896 Y-9.210 E1.43523
+G1 X-3.804 Y-9.248 E1.43856
+G1 X-3.711 Y-9.286 E1.44189
+G1 X-3.618 Y-9.323 E1.44522
+G1 X-3.524 Y-9.358 E1.44855
+G1 X-3.431 Y-9.393 E1.45188
+G1 X-3.336 Y-9.427 E1.45521
+G1 X-3.242 Y-9.460 E1.45854
+G1 X-3.147 Y-9.492 E1.46187
+G1 X-3.052 Y-9.523 E1.46520
+G1 X-2.957 Y-9.553 E1.46853
+G1 X-2.861 Y-9.582 E1.47186
+G1 X-2.765 Y-9.610 E1.47519
+G1 X-2.669 Y-9.637 E1.47852
+G1 X-2.572 Y-9.664 E1.48185
+G1 X-2.475 Y-9.689 E1.48518
+G1 X-2.378 Y-9.713 E1.48851
+G1 X-2.281 Y-9.736 E1.49184
+G1 X-2.183 Y-9.759 E1.49517
+G1 X-2.086 Y-9.780 E1.49850
+G1 X-1.988 Y-9.800 E1.50183
+G1 X-1.890 Y-9.820 E1.50516
+G1 X-1.791 Y-9.838 E1.50849
+G1 X-1.693 Y-9.856 E1.51182
+G1 X-1.594 Y-9.872 E1.51515
+G1 X-1.495 Y-9.888 E1.51848
+G1 X-1.396 Y-9.902 E1.52181
+G1 X-1.297 Y-9.916 E1.52514
+G1 X-1.198 Y-9.928 E1.52847
+G1 X-1.098 Y-9.939 E1.53180
+G1 X-0.999 Y-9.950 E1.53513
+G1 X-0.899 Y-9.959 E1.53846
+G1 X-0.800 Y-9.968 E1.54179
+G1 X-0.700 Y-9.975 E1.54512
+G1 X-0.600 Y-9.982 E1.54845
+G1 X-0.500 Y-9.987 E1.55178
+G1 X-0.400 Y-9.992 E1.55511
+G1 X-0.300 Y-9.995 E1.55844
+G1 X-0.200 Y-9.998 E1.56177
+G1 X-0.100 Y-9.999 E1.56510
+G1 X-0.000 Y-10.000 E1.56843
+G1 X0.100 Y-9.999 E1.57176
+G1 X0.200 Y-9.998 E1.57509
+G1 X0.300 Y-9.995 E1.57842
+G1 X0.400 Y-9.992 E1.58175
+G1 X0.500 Y-9.987 E1.58508
+G1 X0.600 Y-9.982 E1.58841
+G1 X0.700 Y-9.975 E1.59174
+G1 X0.800 Y-9.968 E1.59507
+G1 X0.899 Y-9.959 E1.59840
+G1 X0.999 Y-9.950 E1.60173
+G1 X1.098 Y-9.939 E1.60506
+G1 X1.198 Y-9.928 E1.60839
+G1 X1.297 Y-9.916 E1.61172
+G1 X1.396 Y-9.902 E1.61505
+G1 X1.495 Y-9.888 E1.61838
+G1 X1.594 Y-9.872 E1.62171
+G1 X1.693 Y-9.856 E1.62504
+G1 X1.791 Y-9.838 E1.62837
+G1 X1.890 Y-9.820 E1.63170
+G1 X1.988 Y-9.800 E1.63503
+G1 X2.086 Y-9.780 E1.63836
+G1 X2.183 Y-9.759 E1.64169
+G1 X2.281 Y-9.736 E1.64502
+G1 X2.378 Y-9.713 E1.64835
+G1 X2.475 Y-9.689 E1.65168
+G1 X2.572 Y-9.664 E1.65501
+G1 X2.669 Y-9.637 E1.65834
+G1 X2.765 Y-9.610 E1.66167
+G1 X2.861 Y-9.582 E1.66500
+G1 X2.957 Y-9.553 E1.66833
+G1 X3.052 Y-9.523 E1.67166
+G1 X3.147 Y-9.492 E1.67499
+G1 X3.242 Y-9.460 E1.67832
+G1 X3.336 Y-9.427 E1.68165
+G1 X3.431 Y-9.393 E1.68498
+G1 X3.524 Y-9.358 E1.68831
+G1 X3.618 Y-9.323 E1.69164
+G1 X3.711 Y-9.286 E1.69497
+G1 X3.804 Y-9.248 E1.69830
+G1 X3.896 Y-9.210 E1.70163
+G1 X3.988 Y-9.170 E1.70496
+G1 X4.080 Y-9.130 E1.70829
+G1 X4.171 Y-9.089 E1.71162
+G1 X4.261 Y-9.047 E1.71495
+G1 X4.352 Y-9.003 E1.71828
+G1 X4.442 Y-8.959 E1.72161
+G1 X4.531 Y-8.915 E1.72494
+G1 X4.620 Y-8.869 E1.72827
+G1 X4.708 Y-8.822 E1.73160
+G1 X4.796 Y-8.775 E1.73493
+G1 X4.884 Y-8.726 E1.73826
+G1 X4.971 Y-8.677 E1.74159
+G1 X5.058 Y-8.627 E1.74492
+G1 X5.144 Y-8.576 E1.74825
+G1 X5.229 Y-8.524 E1.75158
+G1 X5.314 Y-8.471 E1.75491
+G1 X5.399 Y-8.417 E1.75824
+G1 X5.483 Y-8.363 E1.76157
+G1 X5.566 Y-8.308 E1.76490
+G1 X5.649 Y-8.252 E1.76823
+G1 X5.731 Y-8.195 E1.77156
+G1 X5.813 Y-8.137 E1.77489
+G1 X5.894 Y-8.078 E1.77822
+G1 X5.975 Y-8.019 E1.78155
+G1 X6.054 Y-7.959 E1.78488
+G1 X6.134 Y-7.898 E1.78821
+G1 X6.213 Y-7.836 E1.79154
+G1 X6.291 Y-7.774 E1.79487
+G1 X6.368 Y-7.710 E1.79820
+G1 X6.445 Y-7.646 E1.80153
+G1 X6.521 Y-7.581 E1.80486
+G1 X6.597 Y-7.516 E1.80819
+G1 X6.671 Y-7.449 E1.81152
+G1 X6.746 Y-7.382 E1.81485
+G1 X6.819 Y-7.314 E1.81818
+G1 X6.892 Y-7.246 E1.82151
+G1 X6.964 Y-7.176 E1.82484
+G1 X7.036 Y-7.106 E1.82817
+G1 X7.106 Y-7.036 E1.83150
+G1 X7.176 Y-6.964 E1.83483
+G1 X7.246 Y-6.892 E1.83816
+G1 X7.314 Y-6.819 E1.84149
+G1 X7.382 Y-6.746 E1.84482
+G1 X7.449 Y-6.671 E1.84815
+G1 X7.516 Y-6.597 E1.85148
+G1 X7.581 Y-6.521 E1.85481
+G1 X7.646 Y-6.445 E1.85814
+G1 X7.710 Y-6.368 E1.86147
+G1 X7.774 Y-6.291 E1.86480
+G1 X7.836 Y-6.213 E1.86813
+G1 X7.898 Y-6.134 E1.87146
+G1 X7.959 Y-6.054 E1.87479
+G1 X8.019 Y-5.975 E1.87812
+G1 X8.078 Y-5.894 E1.88145
+G1 X8.137 Y-5.813 E1.88478
+G1 X8.195 Y-5.731 E1.88811
+G1 X8.252 Y-5.649 E1.89144
+G1 X8.308 Y-5.566 E1.89477
+G1 X8.363 Y-5.483 E1.89810
+G1 X8.417 Y-5.399 E1.90143
+G1 X8.471 Y-5.314 E1.90476
+G1 X8.524 Y-5.229 E1.90809
+G1 X8.576 Y-5.144 E1.91142
+G1 X8.627 Y-5.058 E1.91475
+G1 X8.677 Y-4.971 E1.91808
+G1 X8.726 Y-4.884 E1.92141
+G1 X8.775 Y-4.796 E1.92474
+G1 X8.822 Y-4.708 E1.92807
+G1 X8.869 Y-4.620 E1.93140
+G1 X8.915 Y-4.531 E1.93473
+G1 X8.959 Y-4.442 E1.93806
+G1 X9.003 Y-4.352 E1.94139
+G1 X9.047 Y-4.261 E1.94472
+G1 X9.089 Y-4.171 E1.94805
+G1 X9.130 Y-4.080 E1.95138
+G1 X9.170 Y-3.988 E1.95471
+G1 X9.210 Y-3.896 E1.95804
+G1 X9.248 Y-3.804 E1.96137
+G1 X9.286 Y-3.711 E1.96470
+G1 X9.323 Y-3.618 E1.96803
+G1 X9.358 Y-3.524 E1.97136
+G1 X9.393 Y-3.431 E1.97469
+G1 X9.427 Y-3.336 E1.97802
+G1 X9.460 Y-3.242 E1.98135
+G1 X9.492 Y-3.147 E1.98468
+G1 X9.523 Y-3.052 E1.98801
+G1 X9.553 Y-2.957 E1.99134
+G1 X9.582 Y-2.861 E1.99467
+G1 X9.610 Y-2.765 E1.99800
+G1 X9.637 Y-2.669 E2.00133
+G1 X9.664 Y-2.572 E2.00466
+G1 X9.689 Y-2.475 E2.00799
+G1 X9.713 Y-2.378 E2.01132
+G1 X9.736 Y-2.281 E2.01465
+G1 X9.759 Y-2.183 E2.01798
+G1 X9.780 Y-2.086 E2.02131
+G1 X9.800 Y-1.988 E2.02464
+G1 X9.820 Y-1.890 E2.02797
+G1 X9.838 Y-1.791 E2.03130
+G1 X9.856 Y-1.693 E2.03463
+G1 X9.872 Y-1.594 E2.03796
+G1 X9.888 Y-1.495 E2.04129
+G1 X9.902 Y-1.396 E2.04462
+G1 X9.916 Y-1.297 E2.04795
+G1 X9.928 Y-1.198 E2.05128
+G1 X9.939 Y-1.098 E2.05461
+G1 X9.950 Y-0.999 E2.05794
+G1 X9.959 Y-0.899 E2.06127
+G1 X9.968 Y-0.800 E2.06460
+G1 X9.975 Y-0.700 E2.06793
+G1 X9.982 Y-0.600 E2.07126
+G1 X9.987 Y-0.500 E2.07459
+G1 X9.992 Y-0.400 E2.07792
+G1 X9.995 Y-0.300 E2.08125
+G1 X9.998 Y-0.200 E2.08458
+G1 X9.999 Y-0.100 E2.08791
+G1 X10.000 Y-0.000 E2.09124
+G1 X9.999 Y0.100 E2.09457
+G1 X9.998 Y0.200 E2.09790
+G1 X9.995 Y0.300 E2.10123
+G1 X9.992 Y0.400 E2.10456
+G1 X9.987 Y0.500 E2.10789
+G1 X9.982 Y0.600 E2.11122
+G1 X9.975 Y0.700 E2.11455
+G1 X9.968 Y0.800 E2.11788
+G1 X9.959 Y0.899 E2.12121
+G1 X9.950 Y0.999 E2.12454
+G1 X9.939 Y1.098 E2.12787
+G1 X9.928 Y1.198 E2.13120
+G1 X9.916 Y1.297 E2.13453
+G1 X9.902 Y1.396 E2.13786
+G1 X9.888 Y1.495 E2.14119
+G1 X9.872 Y1.594 E2.14452
+G1 X9.856 Y1.693 E2.14785
+G1 X9.838 Y1.791 E2.15118
+G1 X9.820 Y1.890 E2.15451
+G1 X9.800 Y1.988 E2.15784
+G1 X9.780 Y2.086 E2.16117
+G1 X9.759 Y2.183 E2.16450
+G1 X9.736 Y2.281 E2.16783
+G1 X9.713 Y2.378 E2.17116
+G1 X9.689 Y2.475 E2.17449
+G1 X9.664 Y2.572 E2.17782
+G1 X9.637 Y2.669 E2.18115
+G1 X9.610 Y2.765 E2.18448
+G1 X9.582 Y2.861 E2.18781
+G1 X9.553 Y2.957 E2.19114
+G1 X9.523 Y3.052 E2.19447
+G1 X9.492 Y3.147 E2.19780
+G1 X9.460 Y3.242 E2.20113
+G1 X9.427 Y3.336 E2.20446
+G1 X9.393 Y3.431 E2.20779
+G1 X9.358 Y3.524 E2.21112
+G1 X9.323 Y3.618 E2.21445
+G1 X9.286 Y3.711 E2.21778
+G1 X9.248 Y3.804 E2.22111
+G1 X9.210 Y3.896 E2.22444
+G1 X9.170 Y3.988 E2.22777
+G1 X9.130 Y4.080 E2.23110
+G1 X9.089 Y4.171 E2.23443
+G1 X9.047 Y4.261 E2.23776
+G1 X9.003 Y4.352 E2.24109
+G1 X8.959 Y4.442 E2.24442
+G1 X8.915 Y4.531 E2.24775
+G1 X8.869 Y4.620 E2.25108
+G1 X8.822 Y4.708 E2.25441
+G1 X8.775 Y4.796 E2.25774
+G1 X8.726 Y4.884 E2.26107
+G1 X8.677 Y4.971 E2.26440
+G1 X8.627 Y5.058 E2.26773
+G1 X8.576 Y5.144 E2.27106
+G1 X8.524 Y5.229 E2.27439
+G1 X8.471 Y5.314 E2.27772
+G1 X8.417 Y5.399 E2.28105
+G1 X8.363 Y5.483 E2.28438
+G1 X8.308 Y5.566 E2.28771
+G1 X8.252 Y5.649 E2.29104
+G1 X8.195 Y5.731 E2.29437
+G1 X8.137 Y5.813 E2.29770
+G1 X8.078 Y5.894 E2.30103
+G1 X8.019 Y5.975 E2.30436
+G1 X7.959 Y6.054 E2.30769
+G1 X7.898 Y6.134 E2.31102
+G1 X7.836 Y6.213 E2.31435
+G1 X7.774 Y6.291 E2.31768
+G1 X7.710 Y6.368 E2.32101
+G1 X7.646 Y6.445 E2.32434
+G1 X7.581 Y6.521 E2.32767
+G1 X7.516 Y6.597 E2.33100
+G1 X7.449 Y6.671 E2.33433
+G1 X7.382 Y6.746 E2.33766
+G1 X7.314 Y6.819 E2.34099
+G1 X7.246 Y6.892 E2.34432
+G1 X7.176 Y6.964 E2.34765
+G1 X7.106 Y7.036 E2.35098
+G1 X7.036 Y7.106 E2.35431
+G1 X6.964 Y7.176 E2.35764
+G1 X6.892 Y7.246 E2.36097
+G1 X6.819 Y7.314 E2.36430
+G1 X6.746 Y7.382 E2.36763
+G1 X6.671 Y7.449 E2.37096
+G1 X6.597 Y7.516 E2.37429
+G1 X6.521 Y7.581 E2.37762
+G1 X6.445 Y7.646 E2.38095
+G1 X6.368 Y7.710 E2.38428
+G1 X6.291 Y7.774 E2.38761
+G1 X6.213 Y7.836 E2.39094
+G1 X6.134 Y7.898 E2.39427
+G1 X6.054 Y7.959 E2.39760
+G1 X5.975 Y8.019 E2.40093
+G1 X5.894 Y8.078 E2.40426
+G1 X5.813 Y8.137 E2.40759
+G1 X5.731 Y8.195 E2.41092
+G1 X5.649 Y8.252 E2.41425
+G1 X5.566 Y8.308 E2.41758
+G1 X5.483 Y8.363 E2.42091
+G1 X5.399 Y8.417 E2.42424
+G1 X5.314 Y8.471 E2.42757
+G1 X5.229 Y8.524 E2.43090
+G1 X5.144 Y8.576 E2.43423
+G1 X5.058 Y8.627 E2.43756
+G1 X4.971 Y8.677 E2.44089
+G1 X4.884 Y8.726 E2.44422
+G1 X4.796 Y8.775 E2.44755
+G1 X4.708 Y8.822 E2.45088
+G1 X4.620 Y8.869 E2.45421
+G1 X4.531 Y8.915 E2.45754
+G1 X4.442 Y8.959 E2.46087
+G1 X4.352 Y9.003 E2.46420
+G1 X4.261 Y9.047 E2.46753
+G1 X4.171 Y9.089 E2.47086
+G1 X4.080 Y9.130 E2.47419
+G1 X3.988 Y9.170 E2.47752
+G1 X3.896 Y9.210 E2.48085
+G1 X3.804 Y9.248 E2.48418
+G1 X3.711 Y9.286 E2.48751
+G1 X3.618 Y9.323 E2.49084
+G1 X3.524 Y9.358 E2.49417
+G1 X3.431 Y9.393 E2.49750
+G1 X3.336 Y9.427 E2.50083
+G1 X3.242 Y9.460 E2.50416
+G1 X3.147 Y9.492 E2.50749
+G1 X3.052 Y9.523 E2.51082
+G1 X2.957 Y9.553 E2.51415
+G1 X2.861 Y9.582 E2.51748
+G1 X2.765 Y9.610 E2.52081
+G1 X2.669 Y9.637 E2.52414
+G1 X2.572 Y9.664 E2.52747
+G1 X2.475 Y9.689 E2.53080
+G1 X2.378 Y9.713 E2.53413
+G1 X2.281 Y9.736 E2.53746
+G1 X2.183 Y9.759 E2.54079
+G1 X2.086 Y9.780 E2.54412
+G1 X1.988 Y9.800 E2.54745
+G1 X1.890 Y9.820 E2.55078
+G1 X1.791 Y9.838 E2.55411
+G1 X1.693 Y9.856 E2.55744
+G1 X1.594 Y9.872 E2.56077
+G1 X1.495 Y9.888 E2.56410
+G1 X1.396 Y9.902 E2.56743
+G1 X1.297 Y9.916 E2.57076
+G1 X1.198 Y9.928 E2.57409
+G1 X1.098 Y9.939 E2.57742
+G1 X0.999 Y9.950 E2.58075
+G1 X0.899 Y9.959 E2.58408
+G1 X0.800 Y9.968 E2.58741
+G1 X0.700 Y9.975 E2.59074
+G1 X0.600 Y9.982 E2.59407
+G1 X0.500 Y9.987 E2.59740
+G1 X0.400 Y9.992 E2.60073
+G1 X0.300 Y9.995 E2.60406
+G1 X0.200 Y9.998 E2.60739
+G1 X0.100 Y9.999 E2.61072
+G1 X0.000 Y10.000 E2.61405
+G1 X-0.100 Y9.999 E2.61738
+G1 X-0.200 Y9.998 E2.62071
+G1 X-0.300 Y9.995 E2.62404
+G1 X-0.400 Y9.992 E2.62737
+G1 X-0.500 Y9.987 E2.63070
+G1 X-0.600 Y9.982 E2.63403
+G1 X-0.700 Y9.975 E2.63736
+G1 X-0.800 Y9.968 E2.64069
+G1 X-0.899 Y9.959 E2.64402
+G1 X-0.999 Y9.950 E2.64735
+G1 X-1.098 Y9.939 E2.65068
+G1 X-1.198 Y9.928 E2.65401
+G1 X-1.297 Y9.916 E2.65734
+G1 X-1.396 Y9.902 E2.66067
+G1 X-1.495 Y9.888 E2.66400
+G1 X-1.594 Y9.872 E2.66733
+G1 X-1.693 Y9.856 E2.67066
+G1 X-1.791 Y9.838 E2.67399
+G1 X-1.890 Y9.820 E2.67732
+G1 X-1.988 Y9.800 E2.68065
+G1 X-2.086 Y9.780 E2.68398
+G1 X-2.183 Y9.759 E2.68731
+G1 X-2.281 Y9.736 E2.69064
+G1 X-2.378 Y9.713 E2.69397
+G1 X-2.475 Y9.689 E2.69730
+G1 X-2.572 Y9.664 E2.70063
+G1 X-2.669 Y9.637 E2.70396
+G1 X-2.765 Y9.610 E2.70729
+G1 X-2.861 Y9.582 E2.71062
+G1 X-2.957 Y9.553 E2.71395
+G1 X-3.052 Y9.523 E2.71728
+G1 X-3.147 Y9.492 E2.72061
+G1 X-3.242 Y9.460 E2.72394
+G1 X-3.336 Y9.427 E2.72727
+G1 X-3.431 Y9.393 E2.73060
+G1 X-3.524 Y9.358 E2.73393
+G1 X-3.618 Y9.323 E2.73726
+G1 X-3.711 Y9.286 E2.74059
+G1 X-3.804 Y9.248 E2.74392
+G1 X-3.896 Y9.210 E2.74725
+G1 X-3.988 Y9.170 E2.75058
+G1 X-4.080 Y9.130 E2.75391
+G1 X-4.171 Y9.089 E2.75724
+G1 X-4.261 Y9.047 E2.76057
+G1 X-4.352 Y9.003 E2.76390
+G1 X-4.442 Y8.959 E2.76723
+G1 X-4.531 Y8.915 E2.77056
+G1 X-4.620 Y8.869 E2.77389
+G1 X-4.708 Y8.822 E2.77722
+G1 X-4.796 Y8.775 E2.78055
+G1 X-4.884 Y8.726 E2.78388
+G1 X-4.971 Y8.677 E2.78721
+G1 X-5.058 Y8.627 E2.79054
+G1 X-5.144 Y8.576 E2.79387
+G1 X-5.229 Y8.524 E2.79720
+G1 X-5.314 Y8.471 E2.80053
+G1 X-5.399 Y8.417 E2.80386
+G1 X-5.483 Y8.363 E2.80719
+G1 X-5.566 Y8.308 E2.81052
+G1 X-5.649 Y8.252 E2.81385
+G1 X-5.731 Y8.195 E2.81718
+G1 X-5.813 Y8.137 E2.82051
+G1 X-5.894 Y8.078 E2.82384
+G1 X-5.975 Y8.019 E2.82717
+G1 X-6.054 Y7.959 E2.83050
+G1 X-6.134 Y7.898 E2.83383
+G1 X-6.213 Y7.836 E2.83716
+G1 X-6.291 Y7.774 E2.84049
+G1 X-6.368 Y7.710 E2.84382
+G1 X-6.445 Y7.646 E2.84715
+G1 X-6.521 Y7.581 E2.85048
+G1 X-6.597 Y7.516 E2.85381
+G1 X-6.671 Y7.449 E2.85714
+G1 X-6.746 Y7.382 E2.86047
+G1 X-6.819 Y7.314 E2.86380
+G1 X-6.892 Y7.246 E2.86713
+G1 X-6.964 Y7.176 E2.87046
+G1 X-7.036 Y7.106 E2.87379
+G1 X-7.106 Y7.036 E2.87712
+G1 X-7.176 Y6.964 E2.88045
+G1 X-7.246 Y6.892 E2.88378
+G1 X-7.314 Y6.819 E2.88711
+G1 X-7.382 Y6.746 E2.89044
+G1 X-7.449 Y6.671 E2.89377
+G1 X-7.516 Y6.597 E2.89710
+G1 X-7.581 Y6.521 E2.90043
+G1 X-7.646 Y6.445 E2.90376
+G1 X-7.710 Y6.368 E2.90709
+G1 X-7.774 Y6.291 E2.91042
+G1 X-7.836 Y6.213 E2.91375
+G1 X-7.898 Y6.134 E2.91708
+G1 X-7.959 Y6.054 E2.92041
+G1 X-8.019 Y5.975 E2.92374
+G1 X-8.078 Y5.894 E2.92707
+G1 X-8.137 Y5.813 E2.93040
+G1 X-8.195 Y5.731 E2.93373
+G1 X-8.252 Y5.649 E2.93706
+G1 X-8.308 Y5.566 E2.94039
+G1 X-8.363 Y5.483 E2.94372
+G1 X-8.417 Y5.399 E2.94705
+G1 X-8.471 Y5.314 E2.95038
+G1 X-8.524 Y5.229 E2.95371
+G1 X-8.576 Y5.144 E2.95704
+G1 X-8.627 Y5.058 E2.96037
+G1 X-8.677 Y4.971 E2.96370
+G1 X-8.726 Y4.884 E2.96703
+G1 X-8.775 Y4.796 E2.97036
+G1 X-8.822 Y4.708 E2.97369
+G1 X-8.869 Y4.620 E2.97702
+G1 X-8.915 Y4.531 E2.98035
+G1 X-8.959 Y4.442 E2.98368
+G1 X-9.003 Y4.352 E2.98701
+G1 X-9.047 Y4.261 E2.99034
+G1 X-9.089 Y4.171 E2.99367
+G1 X-9.130 Y4.080 E2.99700
+G1 X-9.170 Y3.988 E3.00033
+G1 X-9.210 Y3.896 E3.00366
+G1 X-9.248 Y3.804 E3.00699
+G1 X-9.286 Y3.711 E3.01032
+G1 X-9.323 Y3.618 E3.01365
+G1 X-9.358 Y3.524 E3.01698
+G1 X-9.393 Y3.431 E3.02031
+G1 X-9.427 Y3.336 E3.02364
+G1 X-9.460 Y3.242 E3.02697
+G1 X-9.492 Y3.147 E3.03030
+G1 X-9.523 Y3.052 E3.03363
+G1 X-9.553 Y2.957 E3.03696
+G1 X-9.582 Y2.861 E3.04029
+G1 X-9.610 Y2.765 E3.04362
+G1 X-9.637 Y2.669 E3.04695
+G1 X-9.664 Y2.572 E3.05028
+G1 X-9.689 Y2.475 E3.05361
+G1 X-9.713 Y2.378 E3.05694
+G1 X-9.736 Y2.281 E3.06027
+G1 X-9.759 Y2.183 E3.06360
+G1 X-9.780 Y2.086 E3.06693
+G1 X-9.800 Y1.988 E3.07026
+G1 X-9.820 Y1.890 E3.07359
+G1 X-9.838 Y1.791 E3.07692
+G1 X-9.856 Y1.693 E3.08025
+G1 X-9.872 Y1.594 E3.08358
+G1 X-9.888 Y1.495 E3.08691
+G1 X-9.902 Y1.396 E3.09024
+G1 X-9.916 Y1.297 E3.09357
+G1 X-9.928 Y1.198 E3.09690
+G1 X-9.939 Y1.098 E3.10023
+G1 X-9.950 Y0.999 E3.10356
+G1 X-9.959 Y0.899 E3.10689
+G1 X-9.968 Y0.800 E3.11022
+G1 X-9.975 Y0.700 E3.11355
+G1 X-9.982 Y0.600 E3.11688
+G1 X-9.987 Y0.500 E3.12021
+G1 X-9.992 Y0.400 E3.12354
+G1 X-9.995 Y0.300 E3.12687
+G1 X-9.998 Y0.200 E3.13020
+G1 X-9.999 Y0.100 E3.13353
+G1 X-10.000 Y0.000 E3.13686
+G1 X-9.999 Y-0.100 E3.14019
+G1 X-9.998 Y-0.200 E3.14352
+G1 X-9.995 Y-0.300 E3.14685
+G1 X-9.992 Y-0.400 E3.15018
+G1 X-9.987 Y-0.500 E3.15351
+G1 X-9.982 Y-0.600 E3.15684
+G1 X-9.975 Y-0.700 E3.16017
+G1 X-9.968 Y-0.800 E3.16350
+G1 X-9.959 Y-0.899 E3.16683
+G1 X-9.950 Y-0.999 E3.17016
+G1 X-9.939 Y-1.098 E3.17349
+G1 X-9.928 Y-1.198 E3.17682
+G1 X-9.916 Y-1.297 E3.18015
+G1 X-9.902 Y-1.396 E3.18348
+G1 X-9.888 Y-1.495 E3.18681
+G1 X-9.872 Y-1.594 E3.19014
+G1 X-9.856 Y-1.693 E3.19347
+G1 X-9.838 Y-1.791 E3.19680
+G1 X-9.820 Y-1.890 E3.20013
+G1 X-9.800 Y-1.988 E3.20346
+G1 X-9.780 Y-2.086 E3.20679
+G1 X-9.759 Y-2.183 E3.21012
+G1 X-9.736 Y-2.281 E3.21345
+G1 X-9.713 Y-2.378 E3.21678
+G1 X-9.689 Y-2.475 E3.22011
+G1 X-9.664 Y-2.572 E3.22344
+G1 X-9.637 Y-2.669 E3.22677
+G1 X-9.610 Y-2.765 E3.23010
+G1 X-9.582 Y-2.861 E3.23343
+G1 X-9.553 Y-2.957 E3.23676
+G1 X-9.523 Y-3.052 E3.24009
+G1 X-9.492 Y-3.147 E3.24342
+G1 X-9.460 Y-3.242 E3.24675
+G1 X-9.427 Y-3.336 E3.25008
+G1 X-9.393 Y-3.431 E3.25341
+G1 X-9.358 Y-3.524 E3.25674
+G1 X-9.323 Y-3.618 E3.26007
+G1 X-9.286 Y-3.711 E3.26340
+G1 X-9.248 Y-3.804 E3.26673
+G1 X-9.210 Y-3.896 E3.27006
+G1 X-9.170 Y-3.988 E3.27339
+G1 X-9.130 Y-4.080 E3.27672
+G1 X-9.089 Y-4.171 E3.28005
+G1 X-9.047 Y-4.261 E3.28338
+G1 X-9.003 Y-4.352 E3.28671
+G1 X-8.959 Y-4.442 E3.29004
+G1 X-8.915 Y-4.531 E3.29337
+G1 X-8.869 Y-4.620 E3.29670
+G1 X-8.822 Y-4.708 E3.30003
+G1 X-8.775 Y-4.796 E3.30336
+G1 X-8.726 Y-4.884 E3.30669
+G1 X-8.677 Y-4.971 E3.31002
+G1 X-8.627 Y-5.058 E3.31335
+G1 X-8.576 Y-5.144 E3.31668
+G1 X-8.524 Y-5.229 E3.32001
+G1 X-8.471 Y-5.314 E3.32334
+G1 X-8.417 Y-5.399 E3.32667
+G1 X-8.363 Y-5.483 E3.33000
+G1 X-8.308 Y-5.566 E3.33333
+G1 X-8.252 Y-5.649 E3.33666
+G1 X-8.195 Y-5.731 E3.33999
+G1 X-8.137 Y-5.813 E3.34332
+G1 X-8.078 Y-5.894 E3.34665
+G1 X-8.019 Y-5.975 E3.34998
+G1 X-7.959 Y-6.054 E3.35331
+G1 X-7.898 Y-6.134 E3.35664
+G1 X-7.836 Y-6.213 E3.35997
+G1 X-7.774 Y-6.291 E3.36330
+G1 X-7.710 Y-6.368 E3.36663
+G1 X-7.646 Y-6.445 E3.36996
+G1 X-7.581 Y-6.521 E3.37329
+G1 X-7.516 Y-6.597 E3.37662
+G1 X-7.449 Y-6.671 E3.37995
+G1 X-7.382 Y-6.746 E3.38328
+G1 X-7.314 Y-6.819 E3.38661
+G1 X-7.246 Y-6.892 E3.38994
+G1 X-7.176 Y-6.964 E3.39327
+G1 X-7.106 Y-7.036 E3.39660
+G1 X-7.036 Y-7.106 E3.39993
+G1 X-6.964 Y-7.176 E3.40326
+G1 X-6.892 Y-7.246 E3.40659
+G1 X-6.819 Y-7.314 E3.40992
+G1 X-6.746 Y-7.382 E3.41325
+G1 X-6.671 Y-7.449 E3.41658
+G1 X-6.597 Y-7.516 E3.41991
+G1 X-6.521 Y-7.581 E3.42324
+G1 X-6.445 Y-7.646 E3.42657
+G1 X-6.368 Y-7.710 E3.42990
+G1 X-6.291 Y-7.774 E3.43323
+G1 X-6.213 Y-7.836 E3.43656
+G1 X-6.134 Y-7.898 E3.43989
+G1 X-6.054 Y-7.959 E3.44322
+G1 X-5.975 Y-8.019 E3.44655
+G1 X-5.894 Y-8.078 E3.44988
+G1 X-5.813 Y-8.137 E3.45321
+G1 X-5.731 Y-8.195 E3.45654
+G1 X-5.649 Y-8.252 E3.45987
+G1 X-5.566 Y-8.308 E3.46320
+G1 X-5.483 Y-8.363 E3.46653
+G1 X-5.399 Y-8.417 E3.46986
+G1 X-5.314 Y-8.471 E3.47319
+G1 X-5.229 Y-8.524 E3.47652
+G1 X-5.144 Y-8.576 E3.47985
+G1 X-5.058 Y-8.627 E3.48318
+G1 X-4.971 Y-8.677 E3.48651
+G1 X-4.884 Y-8.726 E3.48984
+G1 X-4.796 Y-8.775 E3.49317
+G1 X-4.708 Y-8.822 E3.49650
+G1 X-4.620 Y-8.869 E3.49983
+G1 X-4.531 Y-8.915 E3.50316
+G1 X-4.442 Y-8.959 E3.50649
+G1 X-4.352 Y-9.003 E3.50982
+G1 X-4.261 Y-9.047 E3.51315
+G1 X-4.171 Y-9.089 E3.51648
+G1 X-4.080 Y-9.130 E3.51981
+G1 X-3.988 Y-9.170 E3.52314
+G1 X-3.896 Y-9.210 E3.52647
+G1 X-3.804 Y-9.248 E3.52980
+G1 X-3.711 Y-9.286 E3.53313
+G1 X-3.618 Y-9.323 E3.53646
+G1 X-3.524 Y-9.358 E3.53979
+G1 X-3.431 Y-9.393 E3.54312
+G1 X-3.336 Y-9.427 E3.54645
+G1 X-3.242 Y-9.460 E3.54978
+G1 X-3.147 Y-9.492 E3.55311
+G1 X-3.052 Y-9.523 E3.55644
+G1 X-2.957 Y-9.553 E3.55977
+G1 X-2.861 Y-9.582 E3.56310
+G1 X-2.765 Y-9.610 E3.56643
+G1 X-2.669 Y-9.637 E3.56976
+G1 X-2.572 Y-9.664 E3.57309
+G1 X-2.475 Y-9.689 E3.57642
+G1 X-2.378 Y-9.713 E3.57975
+G1 X-2.281 Y-9.736 E3.58308
+G1 X-2.183 Y-9.759 E3.58641
+G1 X-2.086 Y-9.780 E3.58974
+G1 X-1.988 Y-9.800 E3.59307
+G1 X-1.890 Y-9.820 E3.59640
+G1 X-1.791 Y-9.838 E3.59973
+G1 X-1.693 Y-9.856 E3.60306
+G1 X-1.594 Y-9.872 E3.60639
+G1 X-1.495 Y-9.888 E3.60972
+G1 X-1.396 Y-9.902 E3.61305
+G1 X-1.297 Y-9.916 E3.61638
+G1 X-1.198 Y-9.928 E3.61971
+G1 X-1.098 Y-9.939 E3.62304
+G1 X-0.999 Y-9.950 E3.62637
+G1 X-0.899 Y-9.959 E3.62970
+G1 X-0.800 Y-9.968 E3.63303
+G1 X-0.700 Y-9.975 E3.63636
+G1 X-0.600 Y-9.982 E3.63969
+G1 X-0.500 Y-9.987 E3.64302
+G1 X-0.400 Y-9.992 E3.64635
+G1 X-0.300 Y-9.995 E3.64968
+G1 X-0.200 Y-9.998 E3.65301
+G1 X-0.100 Y-9.999 E3.65634
+G1 X-0.000 Y-10.000 E3.65967
+G1 X0.100 Y-9.999 E3.66300
+G1 X0.200 Y-9.998 E3.66633
+G1 X0.300 Y-9.995 E3.66966
+G1 X0.400 Y-9.992 E3.67299
+G1 X0.500 Y-9.987 E3.67632
+G1 X0.600 Y-9.982 E3.67965
+G1 X0.700 Y-9.975 E3.68298
+G1 X0.800 Y-9.968 E3.68631
+G1 X0.899 Y-9.959 E3.68964
+G1 X0.999 Y-9.950 E3.69297
+G1 X1.098 Y-9.939 E3.69630
+G1 X1.198 Y-9.928 E3.69963
+G1 X1.297 Y-9.916 E3.70296
+G1 X1.396 Y-9.902 E3.70629
+G1 X1.495 Y-9.888 E3.70962
+G1 X1.594 Y-9.872 E3.71295
+G1 X1.693 Y-9.856 E3.71628
+G1 X1.791 Y-9.838 E3.71961
+G1 X1.890 Y-9.820 E3.72294
+G1 X1.988 Y-9.800 E3.72627
+G1 X2.086 Y-9.780 E3.72960
+G1 X2.183 Y-9.759 E3.73293
+G1 X2.281 Y-9.736 E3.73626
+G1 X2.378 Y-9.713 E3.73959
+G1 X2.475 Y-9.689 E3.74292
+G1 X2.572 Y-9.664 E3.74625
+G1 X2.669 Y-9.637 E3.74958
+G1 X2.765 Y-9.610 E3.75291
+G1 X2.861 Y-9.582 E3.75624
+G1 X2.957 Y-9.553 E3.75957
+G1 X3.052 Y-9.523 E3.76290
+G1 X3.147 Y-9.492 E3.76623
+G1 X3.242 Y-9.460 E3.76956
+G1 X3.336 Y-9.427 E3.77289
+G1 X3.431 Y-9.393 E3.77622
+G1 X3.524 Y-9.358 E3.77955
+G1 X3.618 Y-9.323 E3.78288
+G1 X3.711 Y-9.286 E3.78621
+G1 X3.804 Y-9.248 E3.78954
+G1 X3.896 Y-9.210 E3.79287
+G1 X3.988 Y-9.170 E3.79620
+G1 X4.080 Y-9.130 E3.79953
+G1 X4.171 Y-9.089 E3.80286
+G1 X4.261 Y-9.047 E3.80619
+G1 X4.352 Y-9.003 E3.80952
+G1 X4.442 Y-8.959 E3.81285
+G1 X4.531 Y-8.915 E3.81618
+G1 X4.620 Y-8.869 E3.81951
+G1 X4.708 Y-8.822 E3.82284
+G1 X4.796 Y-8.775 E3.82617
+G1 X4.884 Y-8.726 E3.82950
+G1 X4.971 Y-8.677 E3.83283
+G1 X5.058 Y-8.627 E3.83616
+G1 X5.144 Y-8.576 E3.83949
+G1 X5.229 Y-8.524 E3.84282
+G1 X5.314 Y-8.471 E3.84615
+G1 X5.399 Y-8.417 E3.84948
+G1 X5.483 Y-8.363 E3.85281
+G1 X5.566 Y-8.308 E3.85614
+G1 X5.649 Y-8.252 E3.85947
+G1 X5.731 Y-8.195 E3.86280
+G1 X5.813 Y-8.137 E3.86613
+G1 X5.894 Y-8.078 E3.86946
+G1 X5.975 Y-8.019 E3.87279
+G1 X6.054 Y-7.959 E3.87612
+G1 X6.134 Y-7.898 E3.87945
+G1 X6.213 Y-7.836 E3.88278
+G1 X6.291 Y-7.774 E3.88611
+G1 X6.368 Y-7.710 E3.88944
+G1 X6.445 Y-7.646 E3.89277
+G1 X6.521 Y-7.581 E3.89610
+G1 X6.597 Y-7.516 E3.89943
+G1 X6.671 Y-7.449 E3.90276
+G1 X6.746 Y-7.382 E3.90609
+G1 X6.819 Y-7.314 E3.90942
+G1 X6.892 Y-7.246 E3.91275
+G1 X6.964 Y-7.176 E3.91608
+G1 X7.036 Y-7.106 E3.91941
+G1 X7.106 Y-7.036 E3.92274
+G1 X7.176 Y-6.964 E3.92607
+G1 X7.246 Y-6.892 E3.92940
+G1 X7.314 Y-6.819 E3.93273
+G1 X7.382 Y-6.746 E3.93606
+G1 X7.449 Y-6.671 E3.93939
+G1 X7.516 Y-6.597 E3.94272
+G1 X7.581 Y-6.521 E3.94605
+G1 X7.646 Y-6.445 E3.94938
+G1 X7.710 Y-6.368 E3.95271
+G1 X7.774 Y-6.291 E3.95604
+G1 X7.836 Y-6.213 E3.95937
+G1 X7.898 Y-6.134 E3.96270
+G1 X7.959 Y-6.054 E3.96603
+G1 X8.019 Y-5.975 E3.96936
+G1 X8.078 Y-5.894 E3.97269
+G1 X8.137 Y-5.813 E3.97602
+G1 X8.195 Y-5.731 E3.97935
+G1 X8.252 Y-5.649 E3.98268
+G1 X8.308 Y-5.566 E3.98601
+G1 X8.363 Y-5.483 E3.98934
+G1 X8.417 Y-5.399 E3.99267
+G1 X8.471 Y-5.314 E3.99600
+G1 X8.524 Y-5.229 E3.99933
+G1 X8.576 Y-5.144 E4.00266
+G1 X8.627 Y-5.058 E4.00599
+G1 X8.677 Y-4.971 E4.00932
+G1 X8.726 Y-4.884 E4.01265
+G1 X8.775 Y-4.796 E4.01598
+G1 X8.822 Y-4.708 E4.01931
+G1 X8.869 Y-4.620 E4.02264
+G1 X8.915 Y-4.531 E4.02597
+G1 X8.959 Y-4.442 E4.02930
+G1 X9.003 Y-4.352 E4.03263
+G1 X9.047 Y-4.261 E4.03596
+G1 X9.089 Y-4.171 E4.03929
+G1 X9.130 Y-4.080 E4.04262
+G1 X9.170 Y-3.988 E4.04595
+G1 X9.210 Y-3.896 E4.04928
+G1 X9.248 Y-3.804 E4.05261
+G1 X9.286 Y-3.711 E4.05594
+G1 X9.323 Y-3.618 E4.05927
+G1 X9.358 Y-3.524 E4.06260
+G1 X9.393 Y-3.431 E4.06593
+G1 X9.427 Y-3.336 E4.06926
+G1 X9.460 Y-3.242 E4.07259
+G1 X9.492 Y-3.147 E4.07592
+G1 X9.523 Y-3.052 E4.07925
+G1 X9.553 Y-2.957 E4.08258
+G1 X9.582 Y-2.861 E4.08591
+G1 X9.610 Y-2.765 E4.08924
+G1 X9.637 Y-2.669 E4.09257
+G1 X9.664 Y-2.572 E4.09590
+G1 X9.689 Y-2.475 E4.09923
+G1 X9.713 Y-2.378 E4.10256
+G1 X9.736 Y-2.281 E4.10589
+G1 X9.759 Y-2.183 E4.10922
+G1 X9.780 Y-2.086 E4.11255
+G1 X9.800 Y-1.988 E4.11588
+G1 X9.820 Y-1.890 E4.11921
+G1 X9.838 Y-1.791 E4.12254
+G1 X9.856 Y-1.693 E4.12587
+G1 X9.872 Y-1.594 E4.12920
+G1 X9.888 Y-1.495 E4.13253
+G1 X9.902 Y-1.396 E4.13586
+G1 X9.916 Y-1.297 E4.13919
+G1 X9.928 Y-1.198 E4.14252
+G1 X9.939 Y-1.098 E4.14585
+G1 X9.950 Y-0.999 E4.14918
+G1 X9.959 Y-0.899 E4.15251
+G1 X9.968 Y-0.800 E4.15584
+G1 X9.975 Y-0.700 E4.15917
+G1 X9.982 Y-0.600 E4.16250
+G1 X9.987 Y-0.500 E4.16583
+G1 X9.992 Y-0.400 E4.16916
+G1 X9.995 Y-0.300 E4.17249
+G1 X9.998 Y-0.200 E4.17582
+G1 X9.999 Y-0.100 E4.17915
+G1 X10.000 Y-0.000 E4.18248
+G1 X9.999 Y0.100 E4.18581
+G1 X9.998 Y0.200 E4.18914
+G1 X9.995 Y0.300 E4.19247
+G1 X9.992 Y0.400 E4.19580
+G1 X9.987 Y0.500 E4.19913
+G1 X9.982 Y0.600 E4.20246
+G1 X9.975 Y0.700 E4.20579
+G1 X9.968 Y0.800 E4.20912
+G1 X9.959 Y0.899 E4.21245
+G1 X9.950 Y0.999 E4.21578
+G1 X9.939 Y1.098 E4.21911
+G1 X9.928 Y1.198 E4.22244
+G1 X9.916 Y1.297 E4.22577
+G1 X9.902 Y1.396 E4.22910
+G1 X9.888 Y1.495 E4.23243
+G1 X9.872 Y1.594 E4.23576
+G1 X9.856 Y1.693 E4.23909
+G1 X9.838 Y1.791 E4.24242
+G1 X9.820 Y1.890 E4.24575
+G1 X9.800 Y1.988 E4.24908
+G1 X9.780 Y2.086 E4.25241
+G1 X9.759 Y2.183 E4.25574
+G1 X9.736 Y2.281 E4.25907
+G1 X9.713 Y2.378 E4.26240
+G1 X9.689 Y2.475 E4.26573
+G1 X9.664 Y2.572 E4.26906
+G1 X9.637 Y2.669 E4.27239
+G1 X9.610 Y2.765 E4.27572
+G1 X9.582 Y2.861 E4.27905
+G1 X9.553 Y2.957 E4.28238
+G1 X9.523 Y3.052 E4.28571
+G1 X9.492 Y3.147 E4.28904
+G1 X9.460 Y3.242 E4.29237
+G1 X9.427 Y3.336 E4.29570
+G1 X9.393 Y3.431 E4.29903
+G1 X9.358 Y3.524 E4.30236
+G1 X9.323 Y3.618 E4.30569
+G1 X9.286 Y3.711 E4.30902
+G1 X9.248 Y3.804 E4.31235
+G1 X9.210 Y3.896 E4.31568
+G1 X9.170 Y3.988 E4.31901
+G1 X9.130 Y4.080 E4.32234
+G1 X9.089 Y4.171 E4.32567
+G1 X9.047 Y4.261 E4.32900
+G1 X9.003 Y4.352 E4.33233
+G1 X8.959 Y4.442 E4.33566
+G1 X8.915 Y4.531 E4.33899
+G1 X8.869 Y4.620 E4.34232
+G1 X8.822 Y4.708 E4.34565
+G1 X8.775 Y4.796 E4.34898
+G1 X8.726 Y4.884 E4.35231
+G1 X8.677 Y4.971 E4.35564
+G1 X8.627 Y5.058 E4.35897
+G1 X8.576 Y5.144 E4.36230
+G1 X8.524 Y5.229 E4.36563
+G1 X8.471 Y5.314 E4.36896
+G1 X8.417 Y5.399 E4.37229
+G1 X8.363 Y5.483 E4.37562
+G1 X8.308 Y5.566 E4.37895
+G1 X8.252 Y5.649 E4.38228
+G1 X8.195 Y5.731 E4.38561
+G1 X8.137 Y5.813 E4.38894
+G1 X8.078 Y5.894 E4.39227
+G1 X8.019 Y5.975 E4.39560
+G1 X7.959 Y6.054 E4.39893
+G1 X7.898 Y6.134 E4.40226
+G1 X7.836 Y6.213 E4.40559
+G1 X7.774 Y6.291 E4.40892
+G1 X7.710 Y6.368 E4.41225
+G1 X7.646 Y6.445 E4.41558
+G1 X7.581 Y6.521 E4.41891
+G1 X7.516 Y6.597 E4.42224
+G1 X7.449 Y6.671 E4.42557
+G1 X7.382 Y6.746 E4.42890
+G1 X7.314 Y6.819 E4.43223
+G1 X7.246 Y6.892 E4.43556
+G1 X7.176 Y6.964 E4.43889
+G1 X7.106 Y7.036 E4.44222
+G1 X7.036 Y7.106 E4.44555
+G1 X6.964 Y7.176 E4.44888
+G1 X6.892 Y7.246 E4.45221
+G1 X6.819 Y7.314 E4.45554
+G1 X6.746 Y7.382 E4.45887
+G1 X6.671 Y7.449 E4.46220
+G1 X6.597 Y7.516 E4.46553
+G1 X6.521 Y7.581 E4.46886
+G1 X6.445 Y7.646 E4.47219
+G1 X6.368 Y7.710 E4.47552
+G1 X6.291 Y7.774 E4.47885
+G1 X6.213 Y7.836 E4.48218
+G1 X6.134 Y7.898 E4.48551
+G1 X6.054 Y7.959 E4.48884
+G1 X5.975 Y8.019 E4.49217
+G1 X5.894 Y8.078 E4.49550
+G1 X5.813 Y8.137 E4.49883
+G1 X5.731 Y8.195 E4.50216
+G1 X5.649 Y8.252 E4.50549
+G1 X5.566 Y8.308 E4.50882
+G1 X5.483 Y8.363 E4.51215
+G1 X5.399 Y8.417 E4.51548
+G1 X5.314 Y8.471 E4.51881
+G1 X5.229 Y8.524 E4.52214
+G1 X5.144 Y8.576 E4.52547
+G1 X5.058 Y8.627 E4.52880
+G1 X4.971 Y8.677 E4.53213
+G1 X4.884 Y8.726 E4.53546
+G1 X4.796 Y8.775 E4.53879
+G1 X4.708 Y8.822 E4.54212
+G1 X4.620 Y8.869 E4.54545
+G1 X4.531 Y8.915 E4.54878
+G1 X4.442 Y8.959 E4.55211
+G1 X4.352 Y9.003 E4.55544
+G1 X4.261 Y9.047 E4.55877
+G1 X4.171 Y9.089 E4.56210
+G1 X4.080 Y9.130 E4.56543
+G1 X3.988 Y9.170 E4.56876
+G1 X3.896 Y9.210 E4.57209
+G1 X3.804 Y9.248 E4.57542
+G1 X3.711 Y9.286 E4.57875
+G1 X3.618 Y9.323 E4.58208
+G1 X3.524 Y9.358 E4.58541
+G1 X3.431 Y9.393 E4.58874
+G1 X3.336 Y9.427 E4.59207
+G1 X3.242 Y9.460 E4.59540
+G1 X3.147 Y9.492 E4.59873
+G1 X3.052 Y9.523 E4.60206
+G1 X2.957 Y9.553 E4.60539
+G1 X2.861 Y9.582 E4.60872
+G1 X2.765 Y9.610 E4.61205
+G1 X2.669 Y9.637 E4.61538
+G1 X2.572 Y9.664 E4.61871
+G1 X2.475 Y9.689 E4.62204
+G1 X2.378 Y9.713 E4.62537
+G1 X2.281 Y9.736 E4.62870
+G1 X2.183 Y9.759 E4.63203
+G1 X2.086 Y9.780 E4.63536
+G1 X1.988 Y9.800 E4.63869
+G1 X1.890 Y9.820 E4.64202
+G1 X1.791 Y9.838 E4.64535
+G1 X1.693 Y9.856 E4.64868
+G1 X1.594 Y9.872 E4.65201
+G1 X1.495 Y9.888 E4.65534
+G1 X1.396 Y9.902 E4.65867
+G1 X1.297 Y9.916 E4.66200
+G1 X1.198 Y9.928 E4.66533
+G1 X1.098 Y9.939 E4.66866
+G1 X0.999 Y9.950 E4.67199
+G1 X0.899 Y9.959 E4.67532
+G1 X0.800 Y9.968 E4.67865
+G1 X0.700 Y9.975 E4.68198
+G1 X0.600 Y9.982 E4.68531
+G1 X0.500 Y9.987 E4.68864
+G1 X0.400 Y9.992 E4.69197
+G1 X0.300 Y9.995 E4.69530
+G1 X0.200 Y9.998 E4.69863
+G1 X0.100 Y9.999 E4.70196
+G1 X0.000 Y10.000 E4.70529
+G1 X-0.100 Y9.999 E4.70862
+G1 X-0.200 Y9.998 E4.71195
+G1 X-0.300 Y9.995 E4.71528
+G1 X-0.400 Y9.992 E4.71861
+G1 X-0.500 Y9.987 E4.72194
+G1 X-0.600 Y9.982 E4.72527
+G1 X-0.700 Y9.975 E4.72860
+G1 X-0.800 Y9.968 E4.73193
+G1 X-0.899 Y9.959 E4.73526
+G1 X-0.999 Y9.950 E4.73859
+G1 X-1.098 Y9.939 E4.74192
+G1 X-1.198 Y9.928 E4.74525
+G1 X-1.297 Y9.916 E4.74858
+G1 X-1.396 Y9.902 E4.75191
+G1 X-1.495 Y9.888 E4.75524
+G1 X-1.594 Y9.872 E4.75857
+G1 X-1.693 Y9.856 E4.76190
+G1 X-1.791 Y9.838 E4.76523
+G1 X-1.890 Y9.820 E4.76856
+G1 X-1.988 Y9.800 E4.77189
+G1 X-2.086 Y9.780 E4.77522
+G1 X-2.183 Y9.759 E4.77855
+G1 X-2.281 Y9.736 E4.78188
+G1 X-2.378 Y9.713 E4.78521
+G1 X-2.475 Y9.689 E4.78854
+G1 X-2.572 Y9.664 E4.79187
+G1 X-2.669 Y9.637 E4.79520
+G1 X-2.765 Y9.610 E4.79853
+G1 X-2.861 Y9.582 E4.80186
+G1 X-2.957 Y9.553 E4.80519
+G1 X-3.052 Y9.523 E4.80852
+G1 X-3.147 Y9.492 E4.81185
+G1 X-3.242 Y9.460 E4.81518
+G1 X-3.336 Y9.427 E4.81851
+G1 X-3.431 Y9.393 E4.82184
+G1 X-3.524 Y9.358 E4.82517
+G1 X-3.618 Y9.323 E4.82850
+G1 X-3.711 Y9.286 E4.83183
+G1 X-3.804 Y9.248 E4.83516
+G1 X-3.896 Y9.210 E4.83849
+G1 X-3.988 Y9.170 E4.84182
+G1 X-4.080 Y9.130 E4.84515
+G1 X-4.171 Y9.089 E4.84848
+G1 X-4.261 Y9.047 E4.85181
+G1 X-4.352 Y9.003 E4.85514
+G1 X-4.442 Y8.959 E4.85847
+G1 X-4.531 Y8.915 E4.86180
+G1 X-4.620 Y8.869 E4.86513
+G1 X-4.708 Y8.822 E4.86846
+G1 X-4.796 Y8.775 E4.87179
+G1 X-4.884 Y8.726 E4.87512
+G1 X-4.971 Y8.677 E4.87845
+G1 X-5.058 Y8.627 E4.88178
+G1 X-5.144 Y8.576 E4.88511
+G1 X-5.229 Y8.524 E4.88844
+G1 X-5.314 Y8.471 E4.89177
+G1 X-5.399 Y8.417 E4.89510
+G1 X-5.483 Y8.363 E4.89843
+G1 X-5.566 Y8.308 E4.90176
+G1 X-5.649 Y8.252 E4.90509
+G1 X-5.731 Y8.195 E4.90842
+G1 X-5.813 Y8.137 E4.91175
+G1 X-5.894 Y8.078 E4.91508
+G1 X-5.975 Y8.019 E4.91841
+G1 X-6.054 Y7.959 E4.92174
+G1 X-6.134 Y7.898 E4.92507
+G1 X-6.213 Y7.836 E4.92840
+G1 X-6.291 Y7.774 E4.93173
+G1 X-6.368 Y7.710 E4.93506
+G1 X-6.445 Y7.646 E4.93839
+G1 X-6.521 Y7.581 E4.94172
+G1 X-6.597 Y7.516 E4.94505
+G1 X-6.671 Y7.449 E4.94838
+G1 X-6.746 Y7.382 E4.95171
+G1 X-6.819 Y7.314 E4.95504
+G1 X-6.892 Y7.246 E4.95837
+G1 X-6.964 Y7.176 E4.96170
+G1 X-7.036 Y7.106 E4.96503
+G1 X-7.106 Y7.036 E4.96836
+G1 X-7.176 Y6.964 E4.97169
+G1 X-7.246 Y6.892 E4.97502
+G1 X-7.314 Y6.819 E4.97835
+G1 X-7.382 Y6.746 E4.98168
+G1 X-7.449 Y6.671 E4.98501
+G1 X-7.516 Y6.597 E4.98834
+G1 X-7.581 Y6.521 E4.99167
+G1 X-7.646 Y6.445 E4.99500
+G1 X-7.710 Y6.368 E4.99833
+G1 X-7.774 Y6.291 E5.00166
+G1 X-7.836 Y6.213 E5.00499
+G1 X-7.898 Y6.134 E5.00832
+G1 X-7.959 Y6.054 E5.01165
+G1 X-8.019 Y5.975 E5.01498
+G1 X-8.078 Y5.894 E5.01831
+G1 X-8.137 Y5.813 E5.02164
+G1 X-8.195 Y5.731 E5.02497
+G1 X-8.252 Y5.649 E5.02830
+G1 X-8.308 Y5.566 E5.03163
+G1 X-8.363 Y5.483 E5.03496
+G1 X-8.417 Y5.399 E5.03829
+G1 X-8.471 Y5.314 E5.04162
+G1 X-8.524 Y5.229 E5.04495
+G1 X-8.576 Y5.144 E5.04828
+G1 X-8.627 Y5.058 E5.05161
+G1 X-8.677 Y4.971 E5.05494
+G1 X-8.726 Y4.884 E5.05827
+G1 X-8.775 Y4.796 E5.06160
+G1 X-8.822 Y4.708 E5.06493
+G1 X-8.869 Y4.620 E5.06826
+G1 X-8.915 Y4.531 E5.07159
+G1 X-8.959 Y4.442 E5.07492
+G1 X-9.003 Y4.352 E5.07825
+G1 X-9.047 Y4.261 E5.08158
+G1 X-9.089 Y4.171 E5.08491
+G1 X-9.130 Y4.080 E5.08824
+G1 X-9.170 Y3.988 E5.09157
+G1 X-9.210 Y3.896 E5.09490
+G1 X-9.248 Y3.804 E5.09823
+G1 X-9.286 Y3.711 E5.10156
+G1 X-9.323 Y3.618 E5.10489
+G1 X-9.358 Y3.524 E5.10822
+G1 X-9.393 Y3.431 E5.11155
+G1 X-9.427 Y3.336 E5.11488
+G1 X-9.460 Y3.242 E5.11821
+G1 X-9.492 Y3.147 E5.12154
+G1 X-9.523 Y3.052 E5.12487
+G1 X-9.553 Y2.957 E5.12820
+G1 X-9.582 Y2.861 E5.13153
+G1 X-9.610 Y2.765 E5.13486
+G1 X-9.637 Y2.669 E5.13819
+G1 X-9.664 Y2.572 E5.14152
+G1 X-9.689 Y2.475 E5.14485
+G1 X-9.713 Y2.378 E5.14818
+G1 X-9.736 Y2.281 E5.15151
+G1 X-9.759 Y2.183 E5.15484
+G1 X-9.780 Y2.086 E5.15817
+G1 X-9.800 Y1.988 E5.16150
+G1 X-9.820 Y1.890 E5.16483
+G1 X-9.838 Y1.791 E5.16816
+G1 X-9.856 Y1.693 E5.17149
+G1 X-9.872 Y1.594 E5.17482
+G1 X-9.888 Y1.495 E5.17815
+G1 X-9.902 Y1.396 E5.18148
+G1 X-9.916 Y1.297 E5.18481
+G1 X-9.928 Y1.198 E5.18814
+G1 X-9.939 Y1.098 E5.19147
+G1 X-9.950 Y0.999 E5.19480
+G1 X-9.959 Y0.899 E5.19813
+G1 X-9.968 Y0.800 E5.20146
+G1 X-9.975 Y0.700 E5.20479
+G1 X-9.982 Y0.600 E5.20812
+G1 X-9.987 Y0.500 E5.21145
+G1 X-9.992 Y0.400 E5.21478
+G1 X-9.995 Y0.300 E5.21811
+G1 X-9.998 Y0.200 E5.22144
+G1 X-9.999 Y0.100 E5.22477
+G1 X-10.000 Y0.000 E5.22810
+G1 X-9.999 Y-0.100 E5.23143
+G1 X-9.998 Y-0.200 E5.23476
+G1 X-9.995 Y-0.300 E5.23809
+G1 X-9.992 Y-0.400 E5.24142
+G1 X-9.987 Y-0.500 E5.24475
+G1 X-9.982 Y-0.600 E5.24808
+G1 X-9.975 Y-0.700 E5.25141
+G1 X-9.968 Y-0.800 E5.25474
+G1 X-9.959 Y-0.899 E5.25807
+G1 X-9.950 Y-0.999 E5.26140
+G1 X-9.939 Y-1.098 E5.26473
+G1 X-9.928 Y-1.198 E5.26806
+G1 X-9.916 Y-1.297 E5.27139
+G1 X-9.902 Y-1.396 E5.27472
+G1 X-9.888 Y-1.495 E5.27805
+G1 X-9.872 Y-1.594 E5.28138
+G1 X-9.856 Y-1.693 E5.28471
+G1 X-9.838 Y-1.791 E5.28804
+G1 X-9.820 Y-1.890 E5.29137
+G1 X-9.800 Y-1.988 E5.29470
+G1 X-9.780 Y-2.086 E5.29803
+G1 X-9.759 Y-2.183 E5.30136
+G1 X-9.736 Y-2.281 E5.30469
+G1 X-9.713 Y-2.378 E5.30802
+G1 X-9.689 Y-2.475 E5.31135
+G1 X-9.664 Y-2.572 E5.31468
+G1 X-9.637 Y-2.669 E5.31801
+G1 X-9.610 Y-2.765 E5.32134
+G1 X-9.582 Y-2.861 E5.32467
+G1 X-9.553 Y-2.957 E5.32800
+G1 X-9.523 Y-3.052 E5.33133
+G1 X-9.492 Y-3.147 E5.33466
+G1 X-9.460 Y-3.242 E5.33799
+G1 X-9.427 Y-3.336 E5.34132
+G1 X-9.393 Y-3.431 E5.34465
+G1 X-9.358 Y-3.524 E5.34798
+G1 X-9.323 Y-3.618 E5.35131
+G1 X-9.286 Y-3.711 E5.35464
+G1 X-9.248 Y-3.804 E5.35797
+G1 X-9.210 Y-3.896 E5.36130
+G1 X-9.170 Y-3.988 E5.36463
+G1 X-9.130 Y-4.080 E5.36796
+G1 X-9.089 Y-4.171 E5.37129
+G1 X-9.047 Y-4.261 E5.37462
+G1 X-9.003 Y-4.352 E5.37795
+G1 X-8.959 Y-4.442 E5.38128
+G1 X-8.915 Y-4.531 E5.38461
+G1 X-8.869 Y-4.620 E5.38794
+G1 X-8.822 Y-4.708 E5.39127
+G1 X-8.775 Y-4.796 E5.39460
+G1 X-8.726 Y-4.884 E5.39793
+G1 X-8.677 Y-4.971 E5.40126
+G1 X-8.627 Y-5.058 E5.40459
+G1 X-8.576 Y-5.144 E5.40792
+G1 X-8.524 Y-5.229 E5.41125
+G1 X-8.471 Y-5.314 E5.41458
+G1 X-8.417 Y-5.399 E5.41791
+G1 X-8.363 Y-5.483 E5.42124
+G1 X-8.308 Y-5.566 E5.42457
+G1 X-8.252 Y-5.649 E5.42790
+G1 X-8.195 Y-5.731 E5.43123
+G1 X-8.137 Y-5.813 E5.43456
+G1 X-8.078 Y-5.894 E5.43789
+G1 X-8.019 Y-5.975 E5.44122
+G1 X-7.959 Y-6.054 E5.44455
+G1 X-7.898 Y-6.134 E5.44788
+G1 X-7.836 Y-6.213 E5.45121
+G1 X-7.774 Y-6.291 E5.45454
+G1 X-7.710 Y-6.368 E5.45787
+G1 X-7.646 Y-6.445 E5.46120
+G1 X-7.581 Y-6.521 E5.46453
+G1 X-7.516 Y-6.597 E5.46786
+G1 X-7.449 Y-6.671 E5.47119
+G1 X-7.382 Y-6.746 E5.47452
+G1 X-7.314 Y-6.819 E5.47785
+G1 X-7.246 Y-6.892 E5.48118
+G1 X-7.176 Y-6.964 E5.48451
+G1 X-7.106 Y-7.036 E5.48784
+G1 X-7.036 Y-7.106 E5.49117
+G1 X-6.964 Y-7.176 E5.49450
+G1 X-6.892 Y-7.246 E5.49783
+G1 X-6.819 Y-7.314 E5.50116
+G1 X-6.746 Y-7.382 E5.50449
+G1 X-6.671 Y-7.449 E5.50782
+G1 X-6.597 Y-7.516 E5.51115
+G1 X-6.521 Y-7.581 E5.51448
+G1 X-6.445 Y-7.646 E5.51781
+G1 X-6.368 Y-7.710 E5.52114
+G1 X-6.291 Y-7.774 E5.52447
+G1 X-6.213 Y-7.836 E5.52780
+G1 X-6.134 Y-7.898 E5.53113
+G1 X-6.054 Y-7.959 E5.53446
+G1 X-5.975 Y-8.019 E5.53779
+G1 X-5.894 Y-8.078 E5.54112
+G1 X-5.813 Y-8.137 E5.54445
+G1 X-5.731 Y-8.195 E5.54778
+G1 X-5.649 Y-8.252 E5.55111
+G1 X-5.566 Y-8.308 E5.55444
+G1 X-5.483 Y-8.363 E5.55777
+G1 X-5.399 Y-8.417 E5.56110
+G1 X-5.314 Y-8.471 E5.56443
+G1 X-5.229 Y-8.524 E5.56776
+G1 X-5.144 Y-8.576 E5.57109
+G1 X-5.058 Y-8.627 E5.57442
+G1 X-4.971 Y-8.677 E5.57775
+G1 X-4.884 Y-8.726 E5.58108
+G1 X-4.796 Y-8.775 E5.58441
+G1 X-4.708 Y-8.822 E5.58774
+G1 X-4.620 Y-8.869 E5.59107
+G1 X-4.531 Y-8.915 E5.59440
+G1 X-4.442 Y-8.959 E5.59773
+G1 X-4.352 Y-9.003 E5.60106
+G1 X-4.261 Y-9.047 E5.60439
+G1 X-4.171 Y-9.089 E5.60772
+G1 X-4.080 Y-9.130 E5.61105
+G1 X-3.988 Y-9.170 E5.61438
+G1 X-3.896 Y-9.210 E5.61771
+G1 X-3.804 Y-9.248 E5.62104
+G1 X-3.711 Y-9.286 E5.62437
+G1 X-3.618 Y-9.323 E5.62770
+G1 X-3.524 Y-9.358 E5.63103
+G1 X-3.431 Y-9.393 E5.63436
+G1 X-3.336 Y-9.427 E5.63769
+G1 X-3.242 Y-9.460 E5.64102
+G1 X-3.147 Y-9.492 E5.64435
+G1 X-3.052 Y-9.523 E5.64768
+G1 X-2.957 Y-9.553 E5.65101
+G1 X-2.861 Y-9.582 E5.65434
+G1 X-2.765 Y-9.610 E5.65767
+G1 X-2.669 Y-9.637 E5.66100
+G1 X-2.572 Y-9.664 E5.66433
+G1 X-2.475 Y-9.689 E5.66766
+G1 X-2.378 Y-9.713 E5.67099
+G1 X-2.281 Y-9.736 E5.67432
+G1 X-2.183 Y-9.759 E5.67765
+G1 X-2.086 Y-9.780 E5.68098
+G1 X-1.988 Y-9.800 E5.68431
+G1 X-1.890 Y-9.820 E5.68764
+G1 X-1.791 Y-9.838 E5.69097
+G1 X-1.693 Y-9.856 E5.69430
+G1 X-1.594 Y-9.872 E5.69763
+G1 X-1.495 Y-9.888 E5.70096
+G1 X-1.396 Y-9.902 E5.70429
+G1 X-1.297 Y-9.916 E5.70762
+G1 X-1.198 Y-9.928 E5.71095
+G1 X-1.098 Y-9.939 E5.71428
+G1 X-0.999 Y-9.950 E5.71761
+G1 X-0.899 Y-9.959 E5.72094
+G1 X-0.800 Y-9.968 E5.72427
+G1 X-0.700 Y-9.975 E5.72760
+G1 X-0.600 Y-9.982 E5.73093
+G1 X-0.500 Y-9.987 E5.73426
+G1 X-0.400 Y-9.992 E5.73759
+G1 X-0.300 Y-9.995 E5.74092
+G1 X-0.200 Y-9.998 E5.74425
+G1 X-0.100 Y-9.999 E5.74758
+G1 X-0.000 Y-10.000 E5.75091
+G1 X0.100 Y-9.999 E5.75424
+G1 X0.200 Y-9.998 E5.75757
+G1 X0.300 Y-9.995 E5.76090
+G1 X0.400 Y-9.992 E5.76423
+G1 X0.500 Y-9.987 E5.76756
+G1 X0.600 Y-9.982 E5.77089
+G1 X0.700 Y-9.975 E5.77422
+G1 X0.800 Y-9.968 E5.77755
+G1 X0.899 Y-9.959 E5.78088
+G1 X0.999 Y-9.950 E5.78421
+G1 X1.098 Y-9.939 E5.78754
+G1 X1.198 Y-9.928 E5.79087
+G1 X1.297 Y-9.916 E5.79420
+G1 X1.396 Y-9.902 E5.79753
+G1 X1.495 Y-9.888 E5.80086
+G1 X1.594 Y-9.872 E5.80419
+G1 X1.693 Y-9.856 E5.80752
+G1 X1.791 Y-9.838 E5.81085
+G1 X1.890 Y-9.820 E5.81418
+G1 X1.988 Y-9.800 E5.81751
+G1 X2.086 Y-9.780 E5.82084
+G1 X2.183 Y-9.759 E5.82417
+G1 X2.281 Y-9.736 E5.82750
+G1 X2.378 Y-9.713 E5.83083
+G1 X2.475 Y-9.689 E5.83416
+G1 X2.572 Y-9.664 E5.83749
+G1 X2.669 Y-9.637 E5.84082
+G1 X2.765 Y-9.610 E5.84415
+G1 X2.861 Y-9.582 E5.84748
+G1 X2.957 Y-9.553 E5.85081
+G1 X3.052 Y-9.523 E5.85414
+G1 X3.147 Y-9.492 E5.85747
+G1 X3.242 Y-9.460 E5.86080
+G1 X3.336 Y-9.427 E5.86413
+G1 X3.431 Y-9.393 E5.86746
+G1 X3.524 Y-9.358 E5.87079
+G1 X3.618 Y-9.323 E5.87412
+G1 X3.711 Y-9.286 E5.87745
+G1 X3.804 Y-9.248 E5.88078
+G1 X3.896 Y-9.210 E5.88411
+G1 X3.988 Y-9.170 E5.88744
+G1 X4.080 Y-9.130 E5.89077
+G1 X4.171 Y-9.089 E5.89410
+G1 X4.261 Y-9.047 E5.89743
+G1 X4.352 Y-9.003 E5.90076
+G1 X4.442 Y-8.959 E5.90409
+G1 X4.531 Y-8.915 E5.90742
+G1 X4.620 Y-8.869 E5.91075
+G1 X4.708 Y-8.822 E5.91408
+G1 X4.796 Y-8.775 E5.91741
+G1 X4.884 Y-8.726 E5.92074
+G1 X4.971 Y-8.677 E5.92407
+G1 X5.058 Y-8.627 E5.92740
+G1 X5.144 Y-8.576 E5.93073
+G1 X5.229 Y-8.524 E5.93406
+G1 X5.314 Y-8.471 E5.93739
+G1 X5.399 Y-8.417 E5.94072
+G1 X5.483 Y-8.363 E5.94405
+G1 X5.566 Y-8.308 E5.94738
+G1 X5.649 Y-8.252 E5.95071
+G1 X5.731 Y-8.195 E5.95404
+G1 X5.813 Y-8.137 E5.95737
+G1 X5.894 Y-8.078 E5.96070
+G1 X5.975 Y-8.019 E5.96403
+G1 X6.054 Y-7.959 E5.96736
+G1 X6.134 Y-7.898 E5.97069
+G1 X6.213 Y-7.836 E5.97402
+G1 X6.291 Y-7.774 E5.97735
+G1 X6.368 Y-7.710 E5.98068
+G1 X6.445 Y-7.646 E5.98401
+G1 X6.521 Y-7.581 E5.98734
+G1 X6.597 Y-7.516 E5.99067
+G1 X6.671 Y-7.449 E5.99400
+G1 X6.746 Y-7.382 E5.99733
+G1 X6.819 Y-7.314 E6.00066
+G1 X6.892 Y-7.246 E6.00399
+G1 X6.964 Y-7.176 E6.00732
+G1 X7.036 Y-7.106 E6.01065
+G1 X7.106 Y-7.036 E6.01398
+G1 X7.176 Y-6.964 E6.01731
+G1 X7.246 Y-6.892 E6.02064
+G1 X7.314 Y-6.819 E6.02397
+G1 X7.382 Y-6.746 E6.02730
+G1 X7.449 Y-6.671 E6.03063
+G1 X7.516 Y-6.597 E6.03396
+G1 X7.581 Y-6.521 E6.03729
+G1 X7.646 Y-6.445 E6.04062
+G1 X7.710 Y-6.368 E6.04395
+G1 X7.774 Y-6.291 E6.04728
+G1 X7.836 Y-6.213 E6.05061
+G1 X7.898 Y-6.134 E6.05394
+G1 X7.959 Y-6.054 E6.05727
+G1 X8.019 Y-5.975 E6.06060
+G1 X8.078 Y-5.894 E6.06393
+G1 X8.137 Y-5.813 E6.06726
+G1 X8.195 Y-5.731 E6.07059
+G1 X8.252 Y-5.649 E6.07392
+G1 X8.308 Y-5.566 E6.07725
+G1 X8.363 Y-5.483 E6.08058
+G1 X8.417 Y-5.399 E6.08391
+G1 X8.471 Y-5.314 E6.08724
+G1 X8.524 Y-5.229 E6.09057
+G1 X8.576 Y-5.144 E6.09390
+G1 X8.627 Y-5.058 E6.09723
+G1 X8.677 Y-4.971 E6.10056
+G1 X8.726 Y-4.884 E6.10389
+G1 X8.775 Y-4.796 E6.10722
+G1 X8.822 Y-4.708 E6.11055
+G1 X8.869 Y-4.620 E6.11388
+G1 X8.915 Y-4.531 E6.11721
+G1 X8.959 Y-4.442 E6.12054
+G1 X9.003 Y-4.352 E6.12387
+G1 X9.047 Y-4.261 E6.12720
+G1 X9.089 Y-4.171 E6.13053
+G1 X9.130 Y-4.080 E6.13386
+G1 X9.170 Y-3.988 E6.13719
+G1 X9.210 Y-3.896 E6.14052
+G1 X9.248 Y-3.804 E6.14385
+G1 X9.286 Y-3.711 E6.14718
+G1 X9.323 Y-3.618 E6.15051
+G1 X9.358 Y-3.524 E6.15384
+G1 X9.393 Y-3.431 E6.15717
+G1 X9.427 Y-3.336 E6.16050
+G1 X9.460 Y-3.242 E6.16383
+G1 X9.492 Y-3.147 E6.16716
+G1 X9.523 Y-3.052 E6.17049
+G1 X9.553 Y-2.957 E6.17382
+G1 X9.582 Y-2.861 E6.17715
+G1 X9.610 Y-2.765 E6.18048
+G1 X9.637 Y-2.669 E6.18381
+G1 X9.664 Y-2.572 E6.18714
+G1 X9.689 Y-2.475 E6.19047
+G1 X9.713 Y-2.378 E6.19380
+G1 X9.736 Y-2.281 E6.19713
+G1 X9.759 Y-2.183 E6.20046
+G1 X9.780 Y-2.086 E6.20379
+G1 X9.800 Y-1.988 E6.20712
+G1 X9.820 Y-1.890 E6.21045
+G1 X9.838 Y-1.791 E6.21378
+G1 X9.856 Y-1.693 E6.21711
+G1 X9.872 Y-1.594 E6.22044
+G1 X9.888 Y-1.495 E6.22377
+G1 X9.902 Y-1.396 E6.22710
+G1 X9.916 Y-1.297 E6.23043
+G1 X9.928 Y-1.198 E6.23376
+G1 X9.939 Y-1.098 E6.23709
+G1 X9.950 Y-0.999 E6.24042
+G1 X9.959 Y-0.899 E6.24375
+G1 X9.968 Y-0.800 E6.24708
+G1 X9.975 Y-0.700 E6.25041
+G1 X9.982 Y-0.600 E6.25374
+G1 X9.987 Y-0.500 E6.25707
+G1 X9.992 Y-0.400 E6.26040
+G1 X9.995 Y-0.300 E6.26373
+G1 X9.998 Y-0.200 E6.26706
+G1 X9.999 Y-0.100 E6.27039
+G1 X10.000 Y-0.000 E6.27372
+G1 X9.999 Y0.100 E6.27705
+G1 X9.998 Y0.200 E6.28038
+G1 X9.995 Y0.300 E6.28371
+G1 X9.992 Y0.400 E6.28704
+G1 X9.987 Y0.500 E6.29037
+G1 X9.982 Y0.600 E6.29370
+G1 X9.975 Y0.700 E6.29703
+G1 X9.968 Y0.800 E6.30036
+G1 X9.959 Y0.899 E6.30369
+G1 X9.950 Y0.999 E6.30702
+G1 X9.939 Y1.098 E6.31035
+G1 X9.928 Y1.198 E6.31368
+G1 X9.916 Y1.297 E6.31701
+G1 X9.902 Y1.396 E6.32034
+G1 X9.888 Y1.495 E6.32367
+G1 X9.872 Y1.594 E6.32700
+G1 X9.856 Y1.693 E6.33033
+G1 X9.838 Y1.791 E6.33366
+G1 X9.820 Y1.890 E6.33699
+G1 X9.800 Y1.988 E6.34032
+G1 X9.780 Y2.086 E6.34365
+G1 X9.759 Y2.183 E6.34698
+G1 X9.736 Y2.281 E6.35031
+G1 X9.713 Y2.378 E6.35364
+G1 X9.689 Y2.475 E6.35697
+G1 X9.664 Y2.572 E6.36030
+G1 X9.637 Y2.669 E6.36363
+G1 X9.610 Y2.765 E6.36696
+G1 X9.582 Y2.861 E6.37029
+G1 X9.553 Y2.957 E6.37362
+G1 X9.523 Y3.052 E6.37695
+G1 X9.492 Y3.147 E6.38028
+G1 X9.460 Y3.242 E6.38361
+G1 X9.427 Y3.336 E6.38694
+G1 X9.393 Y3.431 E6.39027
+G1 X9.358 Y3.524 E6.39360
+G1 X9.323 Y3.618 E6.39693
+G1 X9.286 Y3.711 E6.40026
+G1 X9.248 Y3.804 E6.40359
+G1 X9.210 Y3.896 E6.40692
+G1 X9.170 Y3.988 E6.41025
+G1 X9.130 Y4.080 E6.41358
+G1 X9.089 Y4.171 E6.41691
+G1 X9.047 Y4.261 E6.42024
+G1 X9.003 Y4.352 E6.42357
+G1 X8.959 Y4.442 E6.42690
+G1 X8.915 Y4.531 E6.43023
+G1 X8.869 Y4.620 E6.43356
+G1 X8.822 Y4.708 E6.43689
+G1 X8.775 Y4.796 E6.44022
+G1 X8.726 Y4.884 E6.44355
+G1 X8.677 Y4.971 E6.44688
+G1 X8.627 Y5.058 E6.45021
+G1 X8.576 Y5.144 E6.45354
+G1 X8.524 Y5.229 E6.45687
+G1 X8.471 Y5.314 E6.46020
+G1 X8.417 Y5.399 E6.46353
+G1 X8.363 Y5.483 E6.46686
+G1 X8.308 Y5.566 E6.47019
+G1 X8.252 Y5.649 E6.47352
+G1 X8.195 Y5.731 E6.47685
+G1 X8.137 Y5.813 E6.48018
+G1 X8.078 Y5.894 E6.48351
+G1 X8.019 Y5.975 E6.48684
+G1 X7.959 Y6.054 E6.49017
+G1 X7.898 Y6.134 E6.49350
+G1 X7.836 Y6.213 E6.49683
+G1 X7.774 Y6.291 E6.50016
+G1 X7.710 Y6.368 E6.50349
+G1 X7.646 Y6.445 E6.50682
+G1 X7.581 Y6.521 E6.51015
+G1 X7.516 Y6.597 E6.51348
+G1 X7.449 Y6.671 E6.51681
+G1 X7.382 Y6.746 E6.52014
+G1 X7.314 Y6.819 E6.52347
+G1 X7.246 Y6.892 E6.52680
+G1 X7.176 Y6.964 E6.53013
+G1 X7.106 Y7.036 E6.53346
+G1 X7.036 Y7.106 E6.53679
+G1 X6.964 Y7.176 E6.54012
+G1 X6.892 Y7.246 E6.54345
+G1 X6.819 Y7.314 E6.54678
+G1 X6.746 Y7.382 E6.55011
+G1 X6.671 Y7.449 E6.55344
+G1 X6.597 Y7.516 E6.55677
+G1 X6.521 Y7.581 E6.56010
+G1 X6.445 Y7.646 E6.56343
+G1 X6.368 Y7.710 E6.56676
+G1 X6.291 Y7.774 E6.57009
+G1 X6.213 Y7.836 E6.57342
+G1 X6.134 Y7.898 E6.57675
+G1 X6.054 Y7.959 E6.58008
+G1 X5.975 Y8.019 E6.58341
+G1 X5.894 Y8.078 E6.58674
+G1 X5.813 Y8.137 E6.59007
+G1 X5.731 Y8.195 E6.59340
+G1 X5.649 Y8.252 E6.59673
+G1 X5.566 Y8.308 E6.60006
+G1 X5.483 Y8.363 E6.60339
+G1 X5.399 Y8.417 E6.60672
+G1 X5.314 Y8.471 E6.61005
+G1 X5.229 Y8.524 E6.61338
+G1 X5.144 Y8.576 E6.61671
+G1 X5.058 Y8.627 E6.62004
+G1 X4.971 Y8.677 E6.62337
+G1 X4.884 Y8.726 E6.62670
+G1 X4.796 Y8.775 E6.63003
+G1 X4.708 Y8.822 E6.63336
+G1 X4.620 Y8.869 E6.63669
+G1 X4.531 Y8.915 E6.64002
+G1 X4.442 Y8.959 E6.64335
+G1 X4.352 Y9.003 E6.64668
+G1 X4.261 Y9.047 E6.65001
+G1 X4.171 Y9.089 E6.65334
+G1 X4.080 Y9.130 E6.65667
+G1 X3.988 Y9.170 E6.66000
+G1 X3.896 Y9.210 E6.66333
+G1 X3.804 Y9.248 E6.66666
+G1 X3.711 Y9.286 E6.66999
+G1 X3.618 Y9.323 E6.67332
+G1 X3.524 Y9.358 E6.67665
+G1 X3.431 Y9.393 E6.67998
+G1 X3.336 Y9.427 E6.68331
+G1 X3.242 Y9.460 E6.68664
+G1 X3.147 Y9.492 E6.68997
+G1 X3.052 Y9.523 E6.69330
+G1 X2.957 Y9.553 E6.69663
+G1 X2.861 Y9.582 E6.69996
+G1 X2.765 Y9.610 E6.70329
+G1 X2.669 Y9.637 E6.70662
+G1 X2.572 Y9.664 E6.70995
+G1 X2.475 Y9.689 E6.71328
+G1 X2.378 Y9.713 E6.71661
+G1 X2.281 Y9.736 E6.71994
+G1 X2.183 Y9.759 E6.72327
+G1 X2.086 Y9.780 E6.72660
+G1 X1.988 Y9.800 E6.72993
+G1 X1.890 Y9.820 E6.73326
+G1 X1.791 Y9.838 E6.73659
+G1 X1.693 Y9.856 E6.73992
+G1 X1.594 Y9.872 E6.74325
+G1 X1.495 Y9.888 E6.74658
+G1 X1.396 Y9.902 E6.74991
+G1 X1.297 Y9.916 E6.75324
+G1 X1.198 Y9.928 E6.75657
+G1 X1.098 Y9.939 E6.75990
+G1 X0.999 Y9.950 E6.76323
+G1 X0.899 Y9.959 E6.76656
+G1 X0.800 Y9.968 E6.76989
+G1 X0.700 Y9.975 E6.77322
+G1 X0.600 Y9.982 E6.77655
+G1 X0.500 Y9.987 E6.77988
+G1 X0.400 Y9.992 E6.78321
+G1 X0.300 Y9.995 E6.78654
+G1 X0.200 Y9.998 E6.78987
+G1 X0.100 Y9.999 E6.79320
+G1 X0.000 Y10.000 E6.79653
+G1 X-0.100 Y9.999 E6.79986
+G1 X-0.200 Y9.998 E6.80319
+G1 X-0.300 Y9.995 E6.80652
+G1 X-0.400 Y9.992 E6.80985
+G1 X-0.500 Y9.987 E6.81318
+G1 X-0.600 Y9.982 E6.81651
+G1 X-0.700 Y9.975 E6.81984
+G1 X-0.800 Y9.968 E6.82317
+G1 X-0.899 Y9.959 E6.82650
+G1 X-0.999 Y9.950 E6.82983
+G1 X-1.098 Y9.939 E6.83316
+G1 X-1.198 Y9.928 E6.83649
+G1 X-1.297 Y9.916 E6.83982
+G1 X-1.396 Y9.902 E6.84315
+G1 X-1.495 Y9.888 E6.84648
+G1 X-1.594 Y9.872 E6.84981
+G1 X-1.693 Y9.856 E6.85314
+G1 X-1.791 Y9.838 E6.85647
+G1 X-1.890 Y9.820 E6.85980
+G1 X-1.988 Y9.800 E6.86313
+G1 X-2.086 Y9.780 E6.86646
+G1 X-2.183 Y9.759 E6.86979
+G1 X-2.281 Y9.736 E6.87312
+G1 X-2.378 Y9.713 E6.87645
+G1 X-2.475 Y9.689 E6.87978
+G1 X-2.572 Y9.664 E6.88311
+G1 X-2.669 Y9.637 E6.88644
+G1 X-2.765 Y9.610 E6.88977
+G1 X-2.861 Y9.582 E6.89310
+G1 X-2.957 Y9.553 E6.89643
+G1 X-3.052 Y9.523 E6.89976
+G1 X-3.147 Y9.492 E6.90309
+G1 X-3.242 Y9.460 E6.90642
+G1 X-3.336 Y9.427 E6.90975
+G1 X-3.431 Y9.393 E6.91308
+G1 X-3.524 Y9.358 E6.91641
+G1 X-3.618 Y9.323 E6.91974
+G1 X-3.711 Y9.286 E6.92307
+G1 X-3.804 Y9.248 E6.92640
+G1 X-3.896 Y9.210 E6.92973
+G1 X-3.988 Y9.170 E6.93306
+G1 X-4.080 Y9.130 E6.93639
+G1 X-4.171 Y9.089 E6.93972
+G1 X-4.261 Y9.047 E6.94305
+G1 X-4.352 Y9.003 E6.94638
+G1 X-4.442 Y8.959 E6.94971
+G1 X-4.531 Y8.915 E6.95304
+G1 X-4.620 Y8.869 E6.95637
+G1 X-4.708 Y8.822 E6.95970
+G1 X-4.796 Y8.775 E6.96303
+G1 X-4.884 Y8.726 E6.96636
+G1 X-4.971 Y8.677 E6.96969
+G1 X-5.058 Y8.627 E6.97302
+G1 X-5.144 Y8.576 E6.97635
+G1 X-5.229 Y8.524 E6.97968
+G1 X-5.314 Y8.471 E6.98301
+G1 X-5.399 Y8.417 E6.98634
+G1 X-5.483 Y8.363 E6.98967
+G1 X-5.566 Y8.308 E6.99300
+G1 X-5.649 Y8.252 E6.99633
+G1 X-5.731 Y8.195 E6.99966
+G1 X-5.813 Y8.137 E7.00299
+G1 X-5.894 Y8.078 E7.00632
+G1 X-5.975 Y8.019 E7.00965
+G1 X-6.054 Y7.959 E7.01298
+G1 X-6.134 Y7.898 E7.01631
+G1 X-6.213 Y7.836 E7.01964
+G1 X-6.291 Y7.774 E7.02297
+G1 X-6.368 Y7.710 E7.02630
+G1 X-6.445 Y7.646 E7.02963
+G1 X-6.521 Y7.581 E7.03296
+G1 X-6.597 Y7.516 E7.03629
+G1 X-6.671 Y7.449 E7.03962
+G1 X-6.746 Y7.382 E7.04295
+G1 X-6.819 Y7.314 E7.04628
+G1 X-6.892 Y7.246 E7.04961
+G1 X-6.964 Y7.176 E7.05294
+G1 X-7.036 Y7.106 E7.05627
+G1 X-7.106 Y7.036 E7.05960
+G1 X-7.176 Y6.964 E7.06293
+G1 X-7.246 Y6.892 E7.06626
+G1 X-7.314 Y6.819 E7.06959
+G1 X-7.382 Y6.746 E7.07292
+G1 X-7.449 Y6.671 E7.07625
+G1 X-7.516 Y6.597 E7.07958
+G1 X-7.581 Y6.521 E7.08291
+G1 X-7.646 Y6.445 E7.08624
+G1 X-7.710 Y6.368 E7.08957
+G1 X-7.774 Y6.291 E7.09290
+G1 X-7.836 Y6.213 E7.09623
+G1 X-7.898 Y6.134 E7.09956
+G1 X-7.959 Y6.054 E7.10289
+G1 X-8.019 Y5.975 E7.10622
+G1 X-8.078 Y5.894 E7.10955
+G1 X-8.137 Y5.813 E7.11288
+G1 X-8.195 Y5.731 E7.11621
+G1 X-8.252 Y5.649 E7.11954
+G1 X-8.308 Y5.566 E7.12287
+G1 X-8.363 Y5.483 E7.12620
+G1 X-8.417 Y5.399 E7.12953
+G1 X-8.471 Y5.314 E7.13286
+G1 X-8.524 Y5.229 E7.13619
+G1 X-8.576 Y5.144 E7.13952
+G1 X-8.627 Y5.058 E7.14285
+G1 X-8.677 Y4.971 E7.14618
+G1 X-8.726 Y4.884 E7.14951
+G1 X-8.775 Y4.796 E7.15284
+G1 X-8.822 Y4.708 E7.15617
+G1 X-8.869 Y4.620 E7.15950
+G1 X-8.915 Y4.531 E7.16283
+G1 X-8.959 Y4.442 E7.16616
+G1 X-9.003 Y4.352 E7.16949
+G1 X-9.047 Y4.261 E7.17282
+G1 X-9.089 Y4.171 E7.17615
+G1 X-9.130 Y4.080 E7.17948
+G1 X-9.170 Y3.988 E7.18281
+G1 X-9.210 Y3.896 E7.18614
+G1 X-9.248 Y3.804 E7.18947
+G1 X-9.286 Y3.711 E7.19280
+G1 X-9.323 Y3.618 E7.19613
+G1 X-9.358 Y3.524 E7.19946
+G1 X-9.393 Y3.431 E7.20279
+G1 X-9.427 Y3.336 E7.20612
+G1 X-9.460 Y3.242 E7.20945
+G1 X-9.492 Y3.147 E7.21278
+G1 X-9.523 Y3.052 E7.21611
+G1 X-9.553 Y2.957 E7.21944
+G1 X-9.582 Y2.861 E7.22277
+G1 X-9.610 Y2.765 E7.22610
+G1 X-9.637 Y2.669 E7.22943
+G1 X-9.664 Y2.572 E7.23276
+G1 X-9.689 Y2.475 E7.23609
+G1 X-9.713 Y2.378 E7.23942
+G1 X-9.736 Y2.281 E7.24275
+G1 X-9.759 Y2.183 E7.24608
+G1 X-9.780 Y2.086 E7.24941
+G1 X-9.800 Y1.988 E7.25274
+G1 X-9.820 Y1.890 E7.25607
+G1 X-9.838 Y1.791 E7.25940
+G1 X-9.856 Y1.693 E7.26273
+G1 X-9.872 Y1.594 E7.26606
+G1 X-9.888 Y1.495 E7.26939
+G1 X-9.902 Y1.396 E7.27272
+G1 X-9.916 Y1.297 E7.27605
+G1 X-9.928 Y1.198 E7.27938
+G1 X-9.939 Y1.098 E7.28271
+G1 X-9.950 Y0.999 E7.28604
+G1 X-9.959 Y0.899 E7.28937
+G1 X-9.968 Y0.800 E7.29270
+G1 X-9.975 Y0.700 E7.29603
+G1 X-9.982 Y0.600 E7.29936
+G1 X-9.987 Y0.500 E7.30269
+G1 X-9.992 Y0.400 E7.30602
+G1 X-9.995 Y0.300 E7.30935
+G1 X-9.998 Y0.200 E7.31268
+G1 X-9.999 Y0.100 E7.31601
+G1 X-10.000 Y0.000 E7.31934
+G1 X-9.999 Y-0.100 E7.32267
+G1 X-9.998 Y-0.200 E7.32600
+G1 X-9.995 Y-0.300 E7.32933
+G1 X-9.992 Y-0.400 E7.33266
+G1 X-9.987 Y-0.500 E7.33599
+G1 X-9.982 Y-0.600 E7.33932
+G1 X-9.975 Y-0.700 E7.34265
+G1 X-9.968 Y-0.800 E7.34598
+G1 X-9.959 Y-0.899 E7.34931
+G1 X-9.950 Y-0.999 E7.35264
+G1 X-9.939 Y-1.098 E7.35597
+G1 X-9.928 Y-1.198 E7.35930
+G1 X-9.916 Y-1.297 E7.36263
+G1 X-9.902 Y-1.396 E7.36596
+G1 X-9.888 Y-1.495 E7.36929
+G1 X-9.872 Y-1.594 E7.37262
+G1 X-9.856 Y-1.693 E7.37595
+G1 X-9.838 Y-1.791 E7.37928
+G1 X-9.820 Y-1.890 E7.38261
+G1 X-9.800 Y-1.988 E7.38594
+G1 X-9.780 Y-2.086 E7.38927
+G1 X-9.759 Y-2.183 E7.39260
+G1 X-9.736 Y-2.281 E7.39593
+G1 X-9.713 Y-2.378 E7.39926
+G1 X-9.689 Y-2.475 E7.40259
+G1 X-9.664 Y-2.572 E7.40592
+G1 X-9.637 Y-2.669 E7.40925
+G1 X-9.610 Y-2.765 E7.41258
+G1 X-9.582 Y-2.861 E7.41591
+G1 X-9.553 Y-2.957 E7.41924
+G1 X-9.523 Y-3.052 E7.42257
+G1 X-9.492 Y-3.147 E7.42590
+G1 X-9.460 Y-3.242 E7.42923
+G1 X-9.427 Y-3.336 E7.43256
+G1 X-9.393 Y-3.431 E7.43589
+G1 X-9.358 Y-3.524 E7.43922
+G1 X-9.323 Y-3.618 E7.44255
+G1 X-9.286 Y-3.711 E7.44588
+G1 X-9.248 Y-3.804 E7.44921
+G1 X-9.210 Y-3.896 E7.45254
+G1 X-9.170 Y-3.988 E7.45587
+G1 X-9.130 Y-4.080 E7.45920
+G1 X-9.089 Y-4.171 E7.46253
+G1 X-9.047 Y-4.261 E7.46586
+G1 X-9.003 Y-4.352 E7.46919
+G1 X-8.959 Y-4.442 E7.47252
+G1 X-8.915 Y-4.531 E7.47585
+G1 X-8.869 Y-4.620 E7.47918
+G1 X-8.822 Y-4.708 E7.48251
+G1 X-8.775 Y-4.796 E7.48584
+G1 X-8.726 Y-4.884 E7.48917
+G1 X-8.677 Y-4.971 E7.49250
+G1 X-8.627 Y-5.058 E7.49583
+G1 X-8.576 Y-5.144 E7.49916
+G1 X-8.524 Y-5.229 E7.50249
+G1 X-8.471 Y-5.314 E7.50582
+G1 X-8.417 Y-5.399 E7.50915
+G1 X-8.363 Y-5.483 E7.51248
+G1 X-8.308 Y-5.566 E7.51581
+G1 X-8.252 Y-5.649 E7.51914
+G1 X-8.195 Y-5.731 E7.52247
+G1 X-8.137 Y-5.813 E7.52580
+G1 X-8.078 Y-5.894 E7.52913
+G1 X-8.019 Y-5.975 E7.53246
+G1 X-7.959 Y-6.054 E7.53579
+G1 X-7.898 Y-6.134 E7.53912
+G1 X-7.836 Y-6.213 E7.54245
+G1 X-7.774 Y-6.291 E7.54578
+G1 X-7.710 Y-6.368 E7.54911
+G1 X-7.646 Y-6.445 E7.55244
+G1 X-7.581 Y-6.521 E7.55577
+G1 X-7.516 Y-6.597 E7.55910
+G1 X-7.449 Y-6.671 E7.56243
+G1 X-7.382 Y-6.746 E7.56576
+G1 X-7.314 Y-6.819 E7.56909
+G1 X-7.246 Y-6.892 E7.57242
+G1 X-7.176 Y-6.964 E7.57575
+G1 X-7.106 Y-7.036 E7.57908
+G1 X-7.036 Y-7.106 E7.58241
+G1 X-6.964 Y-7.176 E7.58574
+G1 X-6.892 Y-7.246 E7.58907
+G1 X-6.819 Y-7.314 E7.59240
+G1 X-6.746 Y-7.382 E7.59573
+G1 X-6.671 Y-7.449 E7.59906
+G1 X-6.597 Y-7.516 E7.60239
+G1 X-6.521 Y-7.581 E7.60572
+G1 X-6.445 Y-7.646 E7.60905
+G1 X-6.368 Y-7.710 E7.61238
+G1 X-6.291 Y-7.774 E7.61571
+G1 X-6.213 Y-7.836 E7.61904
+G1 X-6.134 Y-7.898 E7.62237
+G1 X-6.054 Y-7.959 E7.62570
+G1 X-5.975 Y-8.019 E7.62903
+G1 X-5.894 Y-8.078 E7.63236
+G1 X-5.813 Y-8.137 E7.63569
+G1 X-5.731 Y-8.195 E7.63902
+G1 X-5.649 Y-8.252 E7.64235
+G1 X-5.566 Y-8.308 E7.64568
+G1 X-5.483 Y-8.363 E7.64901
+G1 X-5.399 Y-8.417 E7.65234
+G1 X-5.314 Y-8.471 E7.65567
+G1 X-5.229 Y-8.524 E7.65900
+G1 X-5.144 Y-8.576 E7.66233
+G1 X-5.058 Y-8.627 E7.66566
+G1 X-4.971 Y-8.677 E7.66899
+G1 X-4.884 Y-8.726 E7.67232
+G1 X-4.796 Y-8.775 E7.67565
+G1 X-4.708 Y-8.822 E7.67898
+G1 X-4.620 Y-8.869 E7.68231
+G1 X-4.531 Y-8.915 E7.68564
+G1 X-4.442 Y-8.959 E7.68897
+G1 X-4.352 Y-9.003 E7.69230
+G1 X-4.261 Y-9.047 E7.69563
+G1 X-4.171 Y-9.089 E7.69896
+G1 X-4.080 Y-9.130 E7.70229
+G1 X-3.988 Y-9.170 E7.70562
+G1 X-3.896 Y-9.210 E7.70895
+G1 X-3.804 Y-9.248 E7.71228
+G1 X-3.711 Y-9.286 E7.71561
+G1 X-3.618 Y-9.323 E7.71894
+G1 X-3.524 Y-9.358 E7.72227
+G1 X-3.431 Y-9.393 E7.72560
+G1 X-3.336 Y-9.427 E7.72893
+G1 X-3.242 Y-9.460 E7.73226
+G1 X-3.147 Y-9.492 E7.73559
+G1 X-3.052 Y-9.523 E7.73892
+G1 X-2.957 Y-9.553 E7.74225
+G1 X-2.861 Y-9.582 E7.74558
+G1 X-2.765 Y-9.610 E7.74891
+G1 X-2.669 Y-9.637 E7.75224
+G1 X-2.572 Y-9.664 E7.75557
+G1 X-2.475 Y-9.689 E7.75890
+G1 X-2.378 Y-9.713 E7.76223
+G1 X-2.281 Y-9.736 E7.76556
+G1 X-2.183 Y-9.759 E7.76889
+G1 X-2.086 Y-9.780 E7.77222
+G1 X-1.988 Y-9.800 E7.77555
+G1 X-1.890 Y-9.820 E7.77888
+G1 X-1.791 Y-9.838 E7.78221
+G1 X-1.693 Y-9.856 E7.78554
+G1 X-1.594 Y-9.872 E7.78887
+G1 X-1.495 Y-9.888 E7.79220
+G1 X-1.396 Y-9.902 E7.79553
+G1 X-1.297 Y-9.916 E7.79886
+G1 X-1.198 Y-9.928 E7.80219
+G1 X-1.098 Y-9.939 E7.80552
+G1 X-0.999 Y-9.950 E7.80885
+G1 X-0.899 Y-9.959 E7.81218
+G1 X-0.800 Y-9.968 E7.81551
+G1 X-0.700 Y-9.975 E7.81884
+G1 X-0.600 Y-9.982 E7.82217
+G1 X-0.500 Y-9.987 E7.82550
+G1 X-0.400 Y-9.992 E7.82883
+G1 X-0.300 Y-9.995 E7.83216
+G1 X-0.200 Y-9.998 E7.83549
+G1 X-0.100 Y-9.999 E7.83882
+G1 X-0.000 Y-10.000 E7.84215
+G1 X0.100 Y-9.999 E7.84548
+G1 X0.200 Y-9.998 E7.84881
+G1 X0.300 Y-9.995 E7.85214
+G1 X0.400 Y-9.992 E7.85547
+G1 X0.500 Y-9.987 E7.85880
+G1 X0.600 Y-9.982 E7.86213
+G1 X0.700 Y-9.975 E7.86546
+G1 X0.800 Y-9.968 E7.86879
+G1 X0.899 Y-9.959 E7.87212
+G1 X0.999 Y-9.950 E7.87545
+G1 X1.098 Y-9.939 E7.87878
+G1 X1.198 Y-9.928 E7.88211
+G1 X1.297 Y-9.916 E7.88544
+G1 X1.396 Y-9.902 E7.88877
+G1 X1.495 Y-9.888 E7.89210
+G1 X1.594 Y-9.872 E7.89543
+G1 X1.693 Y-9.856 E7.89876
+G1 X1.791 Y-9.838 E7.90209
+G1 X1.890 Y-9.820 E7.90542
+G1 X1.988 Y-9.800 E7.90875
+G1 X2.086 Y-9.780 E7.91208
+G1 X2.183 Y-9.759 E7.91541
+G1 X2.281 Y-9.736 E7.91874
+G1 X2.378 Y-9.713 E7.92207
+G1 X2.475 Y-9.689 E7.92540
+G1 X2.572 Y-9.664 E7.92873
+G1 X2.669 Y-9.637 E7.93206
+G1 X2.765 Y-9.610 E7.93539
+G1 X2.861 Y-9.582 E7.93872
+G1 X2.957 Y-9.553 E7.94205
+G1 X3.052 Y-9.523 E7.94538
+G1 X3.147 Y-9.492 E7.94871
+G1 X3.242 Y-9.460 E7.95204
+G1 X3.336 Y-9.427 E7.95537
+G1 X3.431 Y-9.393 E7.95870
+G1 X3.524 Y-9.358 E7.96203
+G1 X3.618 Y-9.323 E7.96536
+G1 X3.711 Y-9.286 E7.96869
+G1 X3.804 Y-9.248 E7.97202
+G1 X3.896 Y-9.210 E7.97535
+G1 X3.988 Y-9.170 E7.97868
+G1 X4.080 Y-9.130 E7.98201
+G1 X4.171 Y-9.089 E7.98534
+G1 X4.261 Y-9.047 E7.98867
+G1 X4.352 Y-9.003 E7.99200
+G1 X4.442 Y-8.959 E7.99533
+G1 X4.531 Y-8.915 E7.99866
+G1 X4.620 Y-8.869 E8.00199
+G1 X4.708 Y-8.822 E8.00532
+G1 X4.796 Y-8.775 E8.00865
+G1 X4.884 Y-8.726 E8.01198
+G1 X4.971 Y-8.677 E8.01531
+G1 X5.058 Y-8.627 E8.01864
+G1 X5.144 Y-8.576 E8.02197
+G1 X5.229 Y-8.524 E8.02530
+G1 X5.314 Y-8.471 E8.02863
+G1 X5.399 Y-8.417 E8.03196
+G1 X5.483 Y-8.363 E8.03529
+G1 X5.566 Y-8.308 E8.03862
+G1 X5.649 Y-8.252 E8.04195
+G1 X5.731 Y-8.195 E8.04528
+G1 X5.813 Y-8.137 E8.04861
+G1 X5.894 Y-8.078 E8.05194
+G1 X5.975 Y-8.019 E8.05527
+G1 X6.054 Y-7.959 E8.05860
+G1 X6.134 Y-7.898 E8.06193
+G1 X6.213 Y-7.836 E8.06526
+G1 X6.291 Y-7.774 E8.06859
+G1 X6.368 Y-7.710 E8.07192
+G1 X6.445 Y-7.646 E8.07525
+G1 X6.521 Y-7.581 E8.07858
+G1 X6.597 Y-7.516 E8.08191
+G1 X6.671 Y-7.449 E8.08524
+G1 X6.746 Y-7.382 E8.08857
+G1 X6.819 Y-7.314 E8.09190
+G1 X6.892 Y-7.246 E8.09523
+G1 X6.964 Y-7.176 E8.09856
+G1 X7.036 Y-7.106 E8.10189
+G1 X7.106 Y-7.036 E8.10522
+G1 X7.176 Y-6.964 E8.10855
+G1 X7.246 Y-6.892 E8.11188
+G1 X7.314 Y-6.819 E8.11521
+G1 X7.382 Y-6.746 E8.11854
+G1 X7.449 Y-6.671 E8.12187
+G1 X7.516 Y-6.597 E8.12520
+G1 X7.581 Y-6.521 E8.12853
+G1 X7.646 Y-6.445 E8.13186
+G1 X7.710 Y-6.368 E8.13519
+G1 X7.774 Y-6.291 E8.13852
+G1 X7.836 Y-6.213 E8.14185
+G1 X7.898 Y-6.134 E8.14518
+G1 X7.959 Y-6.054 E8.14851
+G1 X8.019 Y-5.975 E8.15184
+G1 X8.078 Y-5.894 E8.15517
+G1 X8.137 Y-5.813 E8.15850
+G1 X8.195 Y-5.731 E8.16183
+G1 X8.252 Y-5.649 E8.16516
+G1 X8.308 Y-5.566 E8.16849
+G1 X8.363 Y-5.483 E8.17182
+G1 X8.417 Y-5.399 E8.17515
+G1 X8.471 Y-5.314 E8.17848
+G1 X8.524 Y-5.229 E8.18181
+G1 X8.576 Y-5.144 E8.18514
+G1 X8.627 Y-5.058 E8.18847
+G1 X8.677 Y-4.971 E8.19180
+G1 X8.726 Y-4.884 E8.19513
+G1 X8.775 Y-4.796 E8.19846
+G1 X8.822 Y-4.708 E8.20179
+G1 X8.869 Y-4.620 E8.20512
+G1 X8.915 Y-4.531 E8.20845
+G1 X8.959 Y-4.442 E8.21178
+G1 X9.003 Y-4.352 E8.21511
+G1 X9.047 Y-4.261 E8.21844
+G1 X9.089 Y-4.171 E8.22177
+G1 X9.130 Y-4.080 E8.22510
+G1 X9.170 Y-3.988 E8.22843
+G1 X9.210 Y-3.896 E8.23176
+G1 X9.248 Y-3.804 E8.23509
+G1 X9.286 Y-3.711 E8.23842
+G1 X9.323 Y-3.618 E8.24175
+G1 X9.358 Y-3.524 E8.24508
+G1 X9.393 Y-3.431 E8.24841
+G1 X9.427 Y-3.336 E8.25174
+G1 X9.460 Y-3.242 E8.25507
+G1 X9.492 Y-3.147 E8.25840
+G1 X9.523 Y-3.052 E8.26173
+G1 X9.553 Y-2.957 E8.26506
+G1 X9.582 Y-2.861 E8.26839
+G1 X9.610 Y-2.765 E8.27172
+G1 X9.637 Y-2.669 E8.27505
+G1 X9.664 Y-2.572 E8.27838
+G1 X9.689 Y-2.475 E8.28171
+G1 X9.713 Y-2.378 E8.28504
+G1 X9.736 Y-2.281 E8.28837
+G1 X9.759 Y-2.183 E8.29170
+G1 X9.780 Y-2.086 E8.29503
+G1 X9.800 Y-1.988 E8.29836
+G1 X9.820 Y-1.890 E8.30169
+G1 X9.838 Y-1.791 E8.30502
+G1 X9.856 Y-1.693 E8.30835
+G1 X9.872 Y-1.594 E8.31168
+G1 X9.888 Y-1.495 E8.31501
+G1 X9.902 Y-1.396 E8.31834
+G1 X9.916 Y-1.297 E8.32167
+G1 X9.928 Y-1.198 E8.32500
+G1 X9.939 Y-1.098 E8.32833
+G1 X9.950 Y-0.999 E8.33166
+G1 X9.959 Y-0.899 E8.33499
+G1 X9.968 Y-0.800 E8.33832
+G1 X9.975 Y-0.700 E8.34165
+G1 X9.982 Y-0.600 E8.34498
+G1 X9.987 Y-0.500 E8.34831
+G1 X9.992 Y-0.400 E8.35164
+G1 X9.995 Y-0.300 E8.35497
+G1 X9.998 Y-0.200 E8.35830
+G1 X9.999 Y-0.100 E8.36163
+G1 X10.000 Y-0.000 E8.36496
+G1 X9.999 Y0.100 E8.36829
+G1 X9.998 Y0.200 E8.37162
+G1 X9.995 Y0.300 E8.37495
+G1 X9.992 Y0.400 E8.37828
+G1 X9.987 Y0.500 E8.38161
+G1 X9.982 Y0.600 E8.38494
+G1 X9.975 Y0.700 E8.38827
+G1 X9.968 Y0.800 E8.39160
+G1 X9.959 Y0.899 E8.39493
+G1 X9.950 Y0.999 E8.39826
+G1 X9.939 Y1.098 E8.40159
+G1 X9.928 Y1.198 E8.40492
+G1 X9.916 Y1.297 E8.40825
+G1 X9.902 Y1.396 E8.41158
+G1 X9.888 Y1.495 E8.41491
+G1 X9.872 Y1.594 E8.41824
+G1 X9.856 Y1.693 E8.42157
+G1 X9.838 Y1.791 E8.42490
+G1 X9.820 Y1.890 E8.42823
+G1 X9.800 Y1.988 E8.43156
+G1 X9.780 Y2.086 E8.43489
+G1 X9.759 Y2.183 E8.43822
+G1 X9.736 Y2.281 E8.44155
+G1 X9.713 Y2.378 E8.44488
+G1 X9.689 Y2.475 E8.44821
+G1 X9.664 Y2.572 E8.45154
+G1 X9.637 Y2.669 E8.45487
+G1 X9.610 Y2.765 E8.45820
+G1 X9.582 Y2.861 E8.46153
+G1 X9.553 Y2.957 E8.46486
+G1 X9.523 Y3.052 E8.46819
+G1 X9.492 Y3.147 E8.47152
+G1 X9.460 Y3.242 E8.47485
+G1 X9.427 Y3.336 E8.47818
+G1 X9.393 Y3.431 E8.48151
+G1 X9.358 Y3.524 E8.48484
+G1 X9.323 Y3.618 E8.48817
+G1 X9.286 Y3.711 E8.49150
+G1 X9.248 Y3.804 E8.49483
+G1 X9.210 Y3.896 E8.49816
+G1 X9.170 Y3.988 E8.50149
+G1 X9.130 Y4.080 E8.50482
+G1 X9.089 Y4.171 E8.50815
+G1 X9.047 Y4.261 E8.51148
+G1 X9.003 Y4.352 E8.51481
+G1 X8.959 Y4.442 E8.51814
+G1 X8.915 Y4.531 E8.52147
+G1 X8.869 Y4.620 E8.52480
+G1 X8.822 Y4.708 E8.52813
+G1 X8.775 Y4.796 E8.53146
+G1 X8.726 Y4.884 E8.53479
+G1 X8.677 Y4.971 E8.53812
+G1 X8.627 Y5.058 E8.54145
+G1 X8.576 Y5.144 E8.54478
+G1 X8.524 Y5.229 E8.54811
+G1 X8.471 Y5.314 E8.55144
+G1 X8.417 Y5.399 E8.55477
+G1 X8.363 Y5.483 E8.55810
+G1 X8.308 Y5.566 E8.56143
+G1 X8.252 Y5.649 E8.56476
+G1 X8.195 Y5.731 E8.56809
+G1 X8.137 Y5.813 E8.57142
+G1 X8.078 Y5.894 E8.57475
+G1 X8.019 Y5.975 E8.57808
+G1 X7.959 Y6.054 E8.58141
+G1 X7.898 Y6.134 E8.58474
+G1 X7.836 Y6.213 E8.58807
+G1 X7.774 Y6.291 E8.59140
+G1 X7.710 Y6.368 E8.59473
+G1 X7.646 Y6.445 E8.59806
+G1 X7.581 Y6.521 E8.60139
+G1 X7.516 Y6.597 E8.60472
+G1 X7.449 Y6.671 E8.60805
+G1 X7.382 Y6.746 E8.61138
+G1 X7.314 Y6.819 E8.61471
+G1 X7.246 Y6.892 E8.61804
+G1 X7.176 Y6.964 E8.62137
+G1 X7.106 Y7.036 E8.62470
+G1 X7.036 Y7.106 E8.62803
+G1 X6.964 Y7.176 E8.63136
+G1 X6.892 Y7.246 E8.63469
+G1 X6.819 Y7.314 E8.63802
+G1 X6.746 Y7.382 E8.64135
+G1 X6.671 Y7.449 E8.64468
+G1 X6.597 Y7.516 E8.64801
+G1 X6.521 Y7.581 E8.65134
+G1 X6.445 Y7.646 E8.65467
+G1 X6.368 Y7.710 E8.65800
+G1 X6.291 Y7.774 E8.66133
+G1 X6.213 Y7.836 E8.66466
+G1 X6.134 Y7.898 E8.66799
+G1 X6.054 Y7.959 E8.67132
+G1 X5.975 Y8.019 E8.67465
+G1 X5.894 Y8.078 E8.67798
+G1 X5.813 Y8.137 E8.68131
+G1 X5.731 Y8.195 E8.68464
+G1 X5.649 Y8.252 E8.68797
+G1 X5.566 Y8.308 E8.69130
+G1 X5.483 Y8.363 E8.69463
+G1 X5.399 Y8.417 E8.69796
+G1 X5.314 Y8.471 E8.70129
+G1 X5.229 Y8.524 E8.70462
+G1 X5.144 Y8.576 E8.70795
+G1 X5.058 Y8.627 E8.71128
+G1 X4.971 Y8.677 E8.71461
+G1 X4.884 Y8.726 E8.71794
+G1 X4.796 Y8.775 E8.72127
+G1 X4.708 Y8.822 E8.72460
+G1 X4.620 Y8.869 E8.72793
+G1 X4.531 Y8.915 E8.73126
+G1 X4.442 Y8.959 E8.73459
+G1 X4.352 Y9.003 E8.73792
+G1 X4.261 Y9.047 E8.74125
+G1 X4.171 Y9.089 E8.74458
+G1 X4.080 Y9.130 E8.74791
+G1 X3.988 Y9.170 E8.75124
+G1 X3.896 Y9.210 E8.75457
+G1 X3.804 Y9.248 E8.75790
+G1 X3.711 Y9.286 E8.76123
+G1 X3.618 Y9.323 E8.76456
+G1 X3.524 Y9.358 E8.76789
+G1 X3.431 Y9.393 E8.77122
+G1 X3.336 Y9.427 E8.77455
+G1 X3.242 Y9.460 E8.77788
+G1 X3.147 Y9.492 E8.78121
+G1 X3.052 Y9.523 E8.78454
+G1 X2.957 Y9.553 E8.78787
+G1 X2.861 Y9.582 E8.79120
+G1 X2.765 Y9.610 E8.79453
+G1 X2.669 Y9.637 E8.79786
+G1 X2.572 Y9.664 E8.80119
+G1 X2.475 Y9.689 E8.80452
+G1 X2.378 Y9.713 E8.80785
+G1 X2.281 Y9.736 E8.81118
+G1 X2.183 Y9.759 E8.81451
+G1 X2.086 Y9.780 E8.81784
+G1 X1.988 Y9.800 E8.82117
+G1 X1.890 Y9.820 E8.82450
+G1 X1.791 Y9.838 E8.82783
+G1 X1.693 Y9.856 E8.83116
+G1 X1.594 Y9.872 E8.83449
+G1 X1.495 Y9.888 E8.83782
+G1 X1.396 Y9.902 E8.84115
+G1 X1.297 Y9.916 E8.84448
+G1 X1.198 Y9.928 E8.84781
+G1 X1.098 Y9.939 E8.85114
+G1 X0.999 Y9.950 E8.85447
+G1 X0.899 Y9.959 E8.85780
+G1 X0.800 Y9.968 E8.86113
+G1 X0.700 Y9.975 E8.86446
+G1 X0.600 Y9.982 E8.86779
+G1 X0.500 Y9.987 E8.87112
+G1 X0.400 Y9.992 E8.87445
+G1 X0.300 Y9.995 E8.87778
+G1 X0.200 Y9.998 E8.88111
+G1 X0.100 Y9.999 E8.88444
+G1 X0.000 Y10.000 E8.88777
+G1 X-0.100 Y9.999 E8.89110
+G1 X-0.200 Y9.998 E8.89443
+G1 X-0.300 Y9.995 E8.89776
+G1 X-0.400 Y9.992 E8.90109
+G1 X-0.500 Y9.987 E8.90442
+G1 X-0.600 Y9.982 E8.90775
+G1 X-0.700 Y9.975 E8.91108
+G1 X-0.800 Y9.968 E8.91441
+G1 X-0.899 Y9.959 E8.91774
+G1 X-0.999 Y9.950 E8.92107
+G1 X-1.098 Y9.939 E8.92440
+G1 X-1.198 Y9.928 E8.92773
+G1 X-1.297 Y9.916 E8.93106
+G1 X-1.396 Y9.902 E8.93439
+G1 X-1.495 Y9.888 E8.93772
+G1 X-1.594 Y9.872 E8.94105
+G1 X-1.693 Y9.856 E8.94438
+G1 X-1.791 Y9.838 E8.94771
+G1 X-1.890 Y9.820 E8.95104
+G1 X-1.988 Y9.800 E8.95437
+G1 X-2.086 Y9.780 E8.95770
+G1 X-2.183 Y9.759 E8.96103
+G1 X-2.281 Y9.736 E8.96436
+G1 X-2.378 Y9.713 E8.96769
+G1 X-2.475 Y9.689 E8.97102
+G1 X-2.572 Y9.664 E8.97435
+G1 X-2.669 Y9.637 E8.97768
+G1 X-2.765 Y9.610 E8.98101
+G1 X-2.861 Y9.582 E8.98434
+G1 X-2.957 Y9.553 E8.98767
+G1 X-3.052 Y9.523 E8.99100
+G1 X-3.147 Y9.492 E8.99433
+G1 X-3.242 Y9.460 E8.99766
+G1 X-3.336 Y9.427 E9.00099
+G1 X-3.431 Y9.393 E9.00432
+G1 X-3.524 Y9.358 E9.00765
+G1 X-3.618 Y9.323 E9.01098
+G1 X-3.711 Y9.286 E9.01431
+G1 X-3.804 Y9.248 E9.01764
+G1 X-3.896 Y9.210 E9.02097
+G1 X-3.988 Y9.170 E9.02430
+G1 X-4.080 Y9.130 E9.02763
+G1 X-4.171 Y9.089 E9.03096
+G1 X-4.261 Y9.047 E9.03429
+G1 X-4.352 Y9.003 E9.03762
+G1 X-4.442 Y8.959 E9.04095
+G1 X-4.531 Y8.915 E9.04428
+G1 X-4.620 Y8.869 E9.04761
+G1 X-4.708 Y8.822 E9.05094
+G1 X-4.796 Y8.775 E9.05427
+G1 X-4.884 Y8.726 E9.05760
+G1 X-4.971 Y8.677 E9.06093
+G1 X-5.058 Y8.627 E9.06426
+G1 X-5.144 Y8.576 E9.06759
+G1 X-5.229 Y8.524 E9.07092
+G1 X-5.314 Y8.471 E9.07425
+G1 X-5.399 Y8.417 E9.07758
+G1 X-5.483 Y8.363 E9.08091
+G1 X-5.566 Y8.308 E9.08424
+G1 X-5.649 Y8.252 E9.08757
+G1 X-5.731 Y8.195 E9.09090
+G1 X-5.813 Y8.137 E9.09423
+G1 X-5.894 Y8.078 E9.09756
+G1 X-5.975 Y8.019 E9.10089
+G1 X-6.054 Y7.959 E9.10422
+G1 X-6.134 Y7.898 E9.10755
+G1 X-6.213 Y7.836 E9.11088
+G1 X-6.291 Y7.774 E9.11421
+G1 X-6.368 Y7.710 E9.11754
+G1 X-6.445 Y7.646 E9.12087
+G1 X-6.521 Y7.581 E9.12420
+G1 X-6.597 Y7.516 E9.12753
+G1 X-6.671 Y7.449 E9.13086
+G1 X-6.746 Y7.382 E9.13419
+G1 X-6.819 Y7.314 E9.13752
+G1 X-6.892 Y7.246 E9.14085
+G1 X-6.964 Y7.176 E9.14418
+G1 X-7.036 Y7.106 E9.14751
+G1 X-7.106 Y7.036 E9.15084
+G1 X-7.176 Y6.964 E9.15417
+G1 X-7.246 Y6.892 E9.15750
+G1 X-7.314 Y6.819 E9.16083
+G1 X-7.382 Y6.746 E9.16416
+G1 X-7.449 Y6.671 E9.16749
+G1 X-7.516 Y6.597 E9.17082
+G1 X-7.581 Y6.521 E9.17415
+G1 X-7.646 Y6.445 E9.17748
+G1 X-7.710 Y6.368 E9.18081
+G1 X-7.774 Y6.291 E9.18414
+G1 X-7.836 Y6.213 E9.18747
+G1 X-7.898 Y6.134 E9.19080
+G1 X-7.959 Y6.054 E9.19413
+G1 X-8.019 Y5.975 E9.19746
+G1 X-8.078 Y5.894 E9.20079
+G1 X-8.137 Y5.813 E9.20412
+G1 X-8.195 Y5.731 E9.20745
+G1 X-8.252 Y5.649 E9.21078
+G1 X-8.308 Y5.566 E9.21411
+G1 X-8.363 Y5.483 E9.21744
+G1 X-8.417 Y5.399 E9.22077
+G1 X-8.471 Y5.314 E9.22410
+G1 X-8.524 Y5.229 E9.22743
+G1 X-8.576 Y5.144 E9.23076
+G1 X-8.627 Y5.058 E9.23409
+G1 X-8.677 Y4.971 E9.23742
+G1 X-8.726 Y4.884 E9.24075
+G1 X-8.775 Y4.796 E9.24408
+G1 X-8.822 Y4.708 E9.24741
+G1 X-8.869 Y4.620 E9.25074
+G1 X-8.915 Y4.531 E9.25407
+G1 X-8.959 Y4.442 E9.25740
+G1 X-9.003 Y4.352 E9.26073
+G1 X-9.047 Y4.261 E9.26406
+G1 X-9.089 Y4.171 E9.26739
+G1 X-9.130 Y4.080 E9.27072
+G1 X-9.170 Y3.988 E9.27405
+G1 X-9.210 Y3.896 E9.27738
+G1 X-9.248 Y3.804 E9.28071
+G1 X-9.286 Y3.711 E9.28404
+G1 X-9.323 Y3.618 E9.28737
+G1 X-9.358 Y3.524 E9.29070
+G1 X-9.393 Y3.431 E9.29403
+G1 X-9.427 Y3.336 E9.29736
+G1 X-9.460 Y3.242 E9.30069
+G1 X-9.492 Y3.147 E9.30402
+G1 X-9.523 Y3.052 E9.30735
+G1 X-9.553 Y2.957 E9.31068
+G1 X-9.582 Y2.861 E9.31401
+G1 X-9.610 Y2.765 E9.31734
+G1 X-9.637 Y2.669 E9.32067
+G1 X-9.664 Y2.572 E9.32400
+G1 X-9.689 Y2.475 E9.32733
+G1 X-9.713 Y2.378 E9.33066
+G1 X-9.736 Y2.281 E9.33399
+G1 X-9.759 Y2.183 E9.33732
+G1 X-9.780 Y2.086 E9.34065
+G1 X-9.800 Y1.988 E9.34398
+G1 X-9.820 Y1.890 E9.34731
+G1 X-9.838 Y1.791 E9.35064
+G1 X-9.856 Y1.693 E9.35397
+G1 X-9.872 Y1.594 E9.35730
+G1 X-9.888 Y1.495 E9.36063
+G1 X-9.902 Y1.396 E9.36396
+G1 X-9.916 Y1.297 E9.36729
+G1 X-9.928 Y1.198 E9.37062
+G1 X-9.939 Y1.098 E9.37395
+G1 X-9.950 Y0.999 E9.37728
+G1 X-9.959 Y0.899 E9.38061
+G1 X-9.968 Y0.800 E9.38394
+G1 X-9.975 Y0.700 E9.38727
+G1 X-9.982 Y0.600 E9.39060
+G1 X-9.987 Y0.500 E9.39393
+G1 X-9.992 Y0.400 E9.39726
+G1 X-9.995 Y0.300 E9.40059
+G1 X-9.998 Y0.200 E9.40392
+G1 X-9.999 Y0.100 E9.40725
+G1 X-10.000 Y0.000 E9.41058
+G1 X-9.999 Y-0.100 E9.41391
+G1 X-9.998 Y-0.200 E9.41724
+G1 X-9.995 Y-0.300 E9.42057
+G1 X-9.992 Y-0.400 E9.42390
+G1 X-9.987 Y-0.500 E9.42723
+G1 X-9.982 Y-0.600 E9.43056
+G1 X-9.975 Y-0.700 E9.43389
+G1 X-9.968 Y-0.800 E9.43722
+G1 X-9.959 Y-0.899 E9.44055
+G1 X-9.950 Y-0.999 E9.44388
+G1 X-9.939 Y-1.098 E9.44721
+G1 X-9.928 Y-1.198 E9.45054
+G1 X-9.916 Y-1.297 E9.45387
+G1 X-9.902 Y-1.396 E9.45720
+G1 X-9.888 Y-1.495 E9.46053
+G1 X-9.872 Y-1.594 E9.46386
+G1 X-9.856 Y-1.693 E9.46719
+G1 X-9.838 Y-1.791 E9.47052
+G1 X-9.820 Y-1.890 E9.47385
+G1 X-9.800 Y-1.988 E9.47718
+G1 X-9.780 Y-2.086 E9.48051
+G1 X-9.759 Y-2.183 E9.48384
+G1 X-9.736 Y-2.281 E9.48717
+G1 X-9.713 Y-2.378 E9.49050
+G1 X-9.689 Y-2.475 E9.49383
+G1 X-9.664 Y-2.572 E9.49716
+G1 X-9.637 Y-2.669 E9.50049
+G1 X-9.610 Y-2.765 E9.50382
+G1 X-9.582 Y-2.861 E9.50715
+G1 X-9.553 Y-2.957 E9.51048
+G1 X-9.523 Y-3.052 E9.51381
+G1 X-9.492 Y-3.147 E9.51714
+G1 X-9.460 Y-3.242 E9.52047
+G1 X-9.427 Y-3.336 E9.52380
+G1 X-9.393 Y-3.431 E9.52713
+G1 X-9.358 Y-3.524 E9.53046
+G1 X-9.323 Y-3.618 E9.53379
+G1 X-9.286 Y-3.711 E9.53712
+G1 X-9.248 Y-3.804 E9.54045
+G1 X-9.210 Y-3.896 E9.54378
+G1 X-9.170 Y-3.988 E9.54711
+G1 X-9.130 Y-4.080 E9.55044
+G1 X-9.089 Y-4.171 E9.55377
+G1 X-9.047 Y-4.261 E9.55710
+G1 X-9.003 Y-4.352 E9.56043
+G1 X-8.959 Y-4.442 E9.56376
+G1 X-8.915 Y-4.531 E9.56709
+G1 X-8.869 Y-4.620 E9.57042
+G1 X-8.822 Y-4.708 E9.57375
+G1 X-8.775 Y-4.796 E9.57708
+G1 X-8.726 Y-4.884 E9.58041
+G1 X-8.677 Y-4.971 E9.58374
+G1 X-8.627 Y-5.058 E9.58707
+G1 X-8.576 Y-5.144 E9.59040
+G1 X-8.524 Y-5.229 E9.59373
+G1 X-8.471 Y-5.314 E9.59706
+G1 X-8.417 Y-5.399 E9.60039
+G1 X-8.363 Y-5.483 E9.60372
+G1 X-8.308 Y-5.566 E9.60705
+G1 X-8.252 Y-5.649 E9.61038
+G1 X-8.195 Y-5.731 E9.61371
+G1 X-8.137 Y-5.813 E9.61704
+G1 X-8.078 Y-5.894 E9.62037
+G1 X-8.019 Y-5.975 E9.62370
+G1 X-7.959 Y-6.054 E9.62703
+G1 X-7.898 Y-6.134 E9.63036
+G1 X-7.836 Y-6.213 E9.63369
+G1 X-7.774 Y-6.291 E9.63702
+G1 X-7.710 Y-6.368 E9.64035
+G1 X-7.646 Y-6.445 E9.64368
+G1 X-7.581 Y-6.521 E9.64701
+G1 X-7.516 Y-6.597 E9.65034
+G1 X-7.449 Y-6.671 E9.65367
+G1 X-7.382 Y-6.746 E9.65700
+G1 X-7.314 Y-6.819 E9.66033
+G1 X-7.246 Y-6.892 E9.66366
+G1 X-7.176 Y-6.964 E9.66699
+G1 X-7.106 Y-7.036 E9.67032
+G1 X-7.036 Y-7.106 E9.67365
+G1 X-6.964 Y-7.176 E9.67698
+G1 X-6.892 Y-7.246 E9.68031
+G1 X-6.819 Y-7.314 E9.68364
+G1 X-6.746 Y-7.382 E9.68697
+G1 X-6.671 Y-7.449 E9.69030
+G1 X-6.597 Y-7.516 E9.69363
+G1 X-6.521 Y-7.581 E9.69696
+G1 X-6.445 Y-7.646 E9.70029
+G1 X-6.368 Y-7.710 E9.70362
+G1 X-6.291 Y-7.774 E9.70695
+G1 X-6.213 Y-7.836 E9.71028
+G1 X-6.134 Y-7.898 E9.71361
+G1 X-6.054 Y-7.959 E9.71694
+G1 X-5.975 Y-8.019 E9.72027
+G1 X-5.894 Y-8.078 E9.72360
+G1 X-5.813 Y-8.137 E9.72693
+G1 X-5.731 Y-8.195 E9.73026
+G1 X-5.649 Y-8.252 E9.73359
+G1 X-5.566 Y-8.308 E9.73692
+G1 X-5.483 Y-8.363 E9.74025
+G1 X-5.399 Y-8.417 E9.74358
+G1 X-5.314 Y-8.471 E9.74691
+G1 X-5.229 Y-8.524 E9.75024
+G1 X-5.144 Y-8.576 E9.75357
+G1 X-5.058 Y-8.627 E9.75690
+G1 X-4.971 Y-8.677 E9.76023
+G1 X-4.884 Y-8.726 E9.76356
+G1 X-4.796 Y-8.775 E9.76689
+G1 X-4.708 Y-8.822 E9.77022
+G1 X-4.620 Y-8.869 E9.77355
+G1 X-4.531 Y-8.915 E9.77688
+G1 X-4.442 Y-8.959 E9.78021
+G1 X-4.352 Y-9.003 E9.78354
+G1 X-4.261 Y-9.047 E9.78687
+G1 X-4.171 Y-9.089 E9.79020
+G1 X-4.080 Y-9.130 E9.79353
+G1 X-3.988 Y-9.170 E9.79686
+G1 X-3.896 Y-9.210 E9.80019
+G1 X-3.804 Y-9.248 E9.80352
+G1 X-3.711 Y-9.286 E9.80685
+G1 X-3.618 Y-9.323 E9.81018
+G1 X-3.524 Y-9.358 E9.81351
+G1 X-3.431 Y-9.393 E9.81684
+G1 X-3.336 Y-9.427 E9.82017
+G1 X-3.242 Y-9.460 E9.82350
+G1 X-3.147 Y-9.492 E9.82683
+G1 X-3.052 Y-9.523 E9.83016
+G1 X-2.957 Y-9.553 E9.83349
+G1 X-2.861 Y-9.582 E9.83682
+G1 X-2.765 Y-9.610 E9.84015
+G1 X-2.669 Y-9.637 E9.84348
+G1 X-2.572 Y-9.664 E9.84681
+G1 X-2.475 Y-9.689 E9.85014
+G1 X-2.378 Y-9.713 E9.85347
+G1 X-2.281 Y-9.736 E9.85680
+G1 X-2.183 Y-9.759 E9.86013
+G1 X-2.086 Y-9.780 E9.86346
+G1 X-1.988 Y-9.800 E9.86679
+G1 X-1.890 Y-9.820 E9.87012
+G1 X-1.791 Y-9.838 E9.87345
+G1 X-1.693 Y-9.856 E9.87678
+G1 X-1.594 Y-9.872 E9.88011
+G1 X-1.495 Y-9.888 E9.88344
+G1 X-1.396 Y-9.902 E9.88677
+G1 X-1.297 Y-9.916 E9.89010
+G1 X-1.198 Y-9.928 E9.89343
+G1 X-1.098 Y-9.939 E9.89676
+G1 X-0.999 Y-9.950 E9.90009
+G1 X-0.899 Y-9.959 E9.90342
+G1 X-0.800 Y-9.968 E9.90675
+G1 X-0.700 Y-9.975 E9.91008
+G1 X-0.600 Y-9.982 E9.91341
+G1 X-0.500 Y-9.987 E9.91674
+G1 X-0.400 Y-9.992 E9.92007
+G1 X-0.300 Y-9.995 E9.92340
+G1 X-0.200 Y-9.998 E9.92673
+G1 X-0.100 Y-9.999 E9.93006
+G1 X-0.000 Y-10.000 E9.93339
+G1 X0.100 Y-9.999 E9.93672
+G1 X0.200 Y-9.998 E9.94005
+G1 X0.300 Y-9.995 E9.94338
+G1 X0.400 Y-9.992 E9.94671
+G1 X0.500 Y-9.987 E9.95004
+G1 X0.600 Y-9.982 E9.95337
+G1 X0.700 Y-9.975 E9.95670
+G1 X0.800 Y-9.968 E9.96003
+G1 X0.899 Y-9.959 E9.96336
+G1 X0.999 Y-9.950 E9.96669
+G1 X1.098 Y-9.939 E9.97002
+G1 X1.198 Y-9.928 E9.97335
+G1 X1.297 Y-9.916 E9.97668
+G1 X1.396 Y-9.902 E9.98001
+G1 X1.495 Y-9.888 E9.98334
+G1 X1.594 Y-9.872 E9.98667
+G1 X1.693 Y-9.856 E9.99000
+G1 X1.791 Y-9.838 E9.99333
+G1 X1.890 Y-9.820 E9.99666
+G1 X1.988 Y-9.800 E9.99999
+G1 X2.086 Y-9.780 E10.00332
+G1 X2.183 Y-9.759 E10.00665
+G1 X2.281 Y-9.736 E10.00998
+G1 X2.378 Y-9.713 E10.01331
+G1 X2.475 Y-9.689 E10.01664
+G1 X2.572 Y-9.664 E10.01997
+G1 X2.669 Y-9.637 E10.02330
+G1 X2.765 Y-9.610 E10.02663
+G1 X2.861 Y-9.582 E10.02996
+G1 X2.957 Y-9.553 E10.03329
+G1 X3.052 Y-9.523 E10.03662
+G1 X3.147 Y-9.492 E10.03995
+G1 X3.242 Y-9.460 E10.04328
+G1 X3.336 Y-9.427 E10.04661
+G1 X3.431 Y-9.393 E10.04994
+G1 X3.524 Y-9.358 E10.05327
+G1 X3.618 Y-9.323 E10.05660
+G1 X3.711 Y-9.286 E10.05993
+G1 X3.804 Y-9.248 E10.06326
+G1 X3.896 Y-9.210 E10.06659
+G1 X3.988 Y-9.170 E10.06992
+G1 X4.080 Y-9.130 E10.07325
+G1 X4.171 Y-9.089 E10.07658
+G1 X4.261 Y-9.047 E10.07991
+G1 X4.352 Y-9.003 E10.08324
+G1 X4.442 Y-8.959 E10.08657
+G1 X4.531 Y-8.915 E10.08990
+G1 X4.620 Y-8.869 E10.09323
+G1 X4.708 Y-8.822 E10.09656
+G1 X4.796 Y-8.775 E10.09989
+G1 X4.884 Y-8.726 E10.10322
+G1 X4.971 Y-8.677 E10.10655
+G1 X5.058 Y-8.627 E10.10988
+G1 X5.144 Y-8.576 E10.11321
+G1 X5.229 Y-8.524 E10.11654
+G1 X5.314 Y-8.471 E10.11987
+G1 X5.399 Y-8.417 E10.12320
+G1 X5.483 Y-8.363 E10.12653
+G1 X5.566 Y-8.308 E10.12986
+G1 X5.649 Y-8.252 E10.13319
+G1 X5.731 Y-8.195 E10.13652
+G1 X5.813 Y-8.137 E10.13985
+G1 X5.894 Y-8.078 E10.14318
+G1 X5.975 Y-8.019 E10.14651
+G1 X6.054 Y-7.959 E10.14984
+G1 X6.134 Y-7.898 E10.15317
+G1 X6.213 Y-7.836 E10.15650
+G1 X6.291 Y-7.774 E10.15983
+G1 X6.368 Y-7.710 E10.16316
+G1 X6.445 Y-7.646 E10.16649
+G1 X6.521 Y-7.581 E10.16982
+G1 X6.597 Y-7.516 E10.17315
+G1 X6.671 Y-7.449 E10.17648
+G1 X6.746 Y-7.382 E10.17981
+G1 X6.819 Y-7.314 E10.18314
+G1 X6.892 Y-7.246 E10.18647
+G1 X6.964 Y-7.176 E10.18980
+G1 X7.036 Y-7.106 E10.19313
+G1 X7.106 Y-7.036 E10.19646
+G1 X7.176 Y-6.964 E10.19979
+G1 X7.246 Y-6.892 E10.20312
+G1 X7.314 Y-6.819 E10.20645
+G1 X7.382 Y-6.746 E10.20978
+G1 X7.449 Y-6.671 E10.21311
+G1 X7.516 Y-6.597 E10.21644
+G1 X7.581 Y-6.521 E10.21977
+G1 X7.646 Y-6.445 E10.22310
+G1 X7.710 Y-6.368 E10.22643
+G1 X7.774 Y-6.291 E10.22976
+G1 X7.836 Y-6.213 E10.23309
+G1 X7.898 Y-6.134 E10.23642
+G1 X7.959 Y-6.054 E10.23975
+G1 X8.019 Y-5.975 E10.24308
+G1 X8.078 Y-5.894 E10.24641
+G1 X8.137 Y-5.813 E10.24974
+G1 X8.195 Y-5.731 E10.25307
+G1 X8.252 Y-5.649 E10.25640
+G1 X8.308 Y-5.566 E10.25973
+G1 X8.363 Y-5.483 E10.26306
+G1 X8.417 Y-5.399 E10.26639
+G1 X8.471 Y-5.314 E10.26972
+G1 X8.524 Y-5.229 E10.27305
+G1 X8.576 Y-5.144 E10.27638
+G1 X8.627 Y-5.058 E10.27971
+G1 X8.677 Y-4.971 E10.28304
+G1 X8.726 Y-4.884 E10.28637
+G1 X8.775 Y-4.796 E10.28970
+G1 X8.822 Y-4.708 E10.29303
+G1 X8.869 Y-4.620 E10.29636
+G1 X8.915 Y-4.531 E10.29969
+G1 X8.959 Y-4.442 E10.30302
+G1 X9.003 Y-4.352 E10.30635
+G1 X9.047 Y-4.261 E10.30968
+G1 X9.089 Y-4.171 E10.31301
+G1 X9.130 Y-4.080 E10.31634
+G1 X9.170 Y-3.988 E10.31967
+G1 X9.210 Y-3.896 E10.32300
+G1 X9.248 Y-3.804 E10.32633
+G1 X9.286 Y-3.711 E10.32966
+G1 X9.323 Y-3.618 E10.33299
+G1 X9.358 Y-3.524 E10.33632
+G1 X9.393 Y-3.431 E10.33965
+G1 X9.427 Y-3.336 E10.34298
+G1 X9.460 Y-3.242 E10.34631
+G1 X9.492 Y-3.147 E10.34964
+G1 X9.523 Y-3.052 E10.35297
+G1 X9.553 Y-2.957 E10.35630
+G1 X9.582 Y-2.861 E10.35963
+G1 X9.610 Y-2.765 E10.36296
+G1 X9.637 Y-2.669 E10.36629
+G1 X9.664 Y-2.572 E10.36962
+G1 X9.689 Y-2.475 E10.37295
+G1 X9.713 Y-2.378 E10.37628
+G1 X9.736 Y-2.281 E10.37961
+G1 X9.759 Y-2.183 E10.38294
+G1 X9.780 Y-2.086 E10.38627
+G1 X9.800 Y-1.988 E10.38960
+G1 X9.820 Y-1.890 E10.39293
+G1 X9.838 Y-1.791 E10.39626
+G1 X9.856 Y-1.693 E10.39959
+G1 X9.872 Y-1.594 E10.40292
+G1 X9.888 Y-1.495 E10.40625
+G1 X9.902 Y-1.396 E10.40958
+G1 X9.916 Y-1.297 E10.41291
+G1 X9.928 Y-1.198 E10.41624
+G1 X9.939 Y-1.098 E10.41957
+G1 X9.950 Y-0.999 E10.42290
+G1 X9.959 Y-0.899 E10.42623
+G1 X9.968 Y-0.800 E10.42956
+G1 X9.975 Y-0.700 E10.43289
+G1 X9.982 Y-0.600 E10.43622
+G1 X9.987 Y-0.500 E10.43955
+G1 X9.992 Y-0.400 E10.44288
+G1 X9.995 Y-0.300 E10.44621
+G1 X9.998 Y-0.200 E10.44954
+G1 X9.999 Y-0.100 E10.45287
+G1 X10.000 Y-0.000 E10.45620
+G1 Z10
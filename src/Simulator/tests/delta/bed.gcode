@@ -0,0 +1,162 @@
+; Delta bed for make bench-delta: lines at 2 mm spacing over a 75 mm radius,
+; the area the delta geometry of SimulatorConfig.h reaches, at 60 mm/s. The
+; queue runs empty while M109 waits, so the simulator knows the tower heights.
+M104 S205
+G28
+M109 S205
+G21
+G90
+M82
+G92 E0
+G1 X-12.207 Y-74.000 Z0.3 F9000
+G1 F3600
+G1 X12.207 Y-74.000 E0.8056
+G1 X21.000 Y-72.000 E0.8716
+G1 X-21.000 Y-72.000 E2.2576
+G1 X-26.926 Y-70.000 E2.3236
+G1 X26.926 Y-70.000 E4.1007
+G1 X31.639 Y-68.000 E4.1667
+G1 X-31.639 Y-68.000 E6.2549
+G1 X-35.623 Y-66.000 E6.3209
+G1 X35.623 Y-66.000 E8.6720
+G1 X39.102 Y-64.000 E8.7380
+G1 X-39.102 Y-64.000 E11.3188
+G1 X-42.202 Y-62.000 E11.3848
+G1 X42.202 Y-62.000 E14.1701
+G1 X45.000 Y-60.000 E14.2361
+G1 X-45.000 Y-60.000 E17.2061
+G1 X-47.550 Y-58.000 E17.2721
+G1 X47.550 Y-58.000 E20.4104
+G1 X49.890 Y-56.000 E20.4764
+G1 X-49.890 Y-56.000 E23.7691
+G1 X-52.048 Y-54.000 E23.8351
+G1 X52.048 Y-54.000 E27.2703
+G1 X54.046 Y-52.000 E27.3363
+G1 X-54.046 Y-52.000 E30.9033
+G1 X-55.902 Y-50.000 E30.9693
+G1 X55.902 Y-50.000 E34.6589
+G1 X57.628 Y-48.000 E34.7249
+G1 X-57.628 Y-48.000 E38.5283
+G1 X-59.237 Y-46.000 E38.5943
+G1 X59.237 Y-46.000 E42.5039
+G1 X60.737 Y-44.000 E42.5699
+G1 X-60.737 Y-44.000 E46.5786
+G1 X-62.137 Y-42.000 E46.6446
+G1 X62.137 Y-42.000 E50.7456
+G1 X63.443 Y-40.000 E50.8116
+G1 X-63.443 Y-40.000 E54.9989
+G1 X-64.661 Y-38.000 E55.0649
+G1 X64.661 Y-38.000 E59.3325
+G1 X65.795 Y-36.000 E59.3985
+G1 X-65.795 Y-36.000 E63.7409
+G1 X-66.851 Y-34.000 E63.8069
+G1 X66.851 Y-34.000 E68.2191
+G1 X67.831 Y-32.000 E68.2851
+G1 X-67.831 Y-32.000 E72.7619
+G1 X-68.739 Y-30.000 E72.8279
+G1 X68.739 Y-30.000 E77.3647
+G1 X69.577 Y-28.000 E77.4307
+G1 X-69.577 Y-28.000 E82.0228
+G1 X-70.349 Y-26.000 E82.0888
+G1 X70.349 Y-26.000 E86.7318
+G1 X71.056 Y-24.000 E86.7978
+G1 X-71.056 Y-24.000 E91.4875
+G1 X-71.701 Y-22.000 E91.5535
+G1 X71.701 Y-22.000 E96.2858
+G1 X72.284 Y-20.000 E96.3518
+G1 X-72.284 Y-20.000 E101.1225
+G1 X-72.808 Y-18.000 E101.1885
+G1 X72.808 Y-18.000 E105.9938
+G1 X73.273 Y-16.000 E106.0598
+G1 X-73.273 Y-16.000 E110.8959
+G1 X-73.682 Y-14.000 E110.9619
+G1 X73.682 Y-14.000 E115.8249
+G1 X74.034 Y-12.000 E115.8909
+G1 X-74.034 Y-12.000 E120.7771
+G1 X-74.330 Y-10.000 E120.8431
+G1 X74.330 Y-10.000 E125.7489
+G1 X74.572 Y-8.000 E125.8149
+G1 X-74.572 Y-8.000 E130.7367
+G1 X-74.760 Y-6.000 E130.8027
+G1 X74.760 Y-6.000 E135.7368
+G1 X74.893 Y-4.000 E135.8028
+G1 X-74.893 Y-4.000 E140.7458
+G1 X-74.973 Y-2.000 E140.8118
+G1 X74.973 Y-2.000 E145.7600
+G1 X75.000 Y0.000 E145.8260
+G1 X-75.000 Y0.000 E150.7760
+G1 X-74.973 Y2.000 E150.8420
+G1 X74.973 Y2.000 E155.7903
+G1 X74.893 Y4.000 E155.8563
+G1 X-74.893 Y4.000 E160.7992
+G1 X-74.760 Y6.000 E160.8652
+G1 X74.760 Y6.000 E165.7993
+G1 X74.572 Y8.000 E165.8653
+G1 X-74.572 Y8.000 E170.7871
+G1 X-74.330 Y10.000 E170.8531
+G1 X74.330 Y10.000 E175.7589
+G1 X74.034 Y12.000 E175.8249
+G1 X-74.034 Y12.000 E180.7111
+G1 X-73.682 Y14.000 E180.7771
+G1 X73.682 Y14.000 E185.6401
+G1 X73.273 Y16.000 E185.7061
+G1 X-73.273 Y16.000 E190.5422
+G1 X-72.808 Y18.000 E190.6082
+G1 X72.808 Y18.000 E195.4135
+G1 X72.284 Y20.000 E195.4795
+G1 X-72.284 Y20.000 E200.2503
+G1 X-71.701 Y22.000 E200.3163
+G1 X71.701 Y22.000 E205.0485
+G1 X71.056 Y24.000 E205.1145
+G1 X-71.056 Y24.000 E209.8042
+G1 X-70.349 Y26.000 E209.8702
+G1 X70.349 Y26.000 E214.5133
+G1 X69.577 Y28.000 E214.5793
+G1 X-69.577 Y28.000 E219.1714
+G1 X-68.739 Y30.000 E219.2374
+G1 X68.739 Y30.000 E223.7741
+G1 X67.831 Y32.000 E223.8401
+G1 X-67.831 Y32.000 E228.3169
+G1 X-66.851 Y34.000 E228.3829
+G1 X66.851 Y34.000 E232.7951
+G1 X65.795 Y36.000 E232.8611
+G1 X-65.795 Y36.000 E237.2036
+G1 X-64.661 Y38.000 E237.2696
+G1 X64.661 Y38.000 E241.5372
+G1 X63.443 Y40.000 E241.6032
+G1 X-63.443 Y40.000 E245.7904
+G1 X-62.137 Y42.000 E245.8564
+G1 X62.137 Y42.000 E249.9574
+G1 X60.737 Y44.000 E250.0234
+G1 X-60.737 Y44.000 E254.0321
+G1 X-59.237 Y46.000 E254.0981
+G1 X59.237 Y46.000 E258.0077
+G1 X57.628 Y48.000 E258.0737
+G1 X-57.628 Y48.000 E261.8772
+G1 X-55.902 Y50.000 E261.9432
+G1 X55.902 Y50.000 E265.6327
+G1 X54.046 Y52.000 E265.6987
+G1 X-54.046 Y52.000 E269.2657
+G1 X-52.048 Y54.000 E269.3317
+G1 X52.048 Y54.000 E272.7669
+G1 X49.890 Y56.000 E272.8329
+G1 X-49.890 Y56.000 E276.1256
+G1 X-47.550 Y58.000 E276.1916
+G1 X47.550 Y58.000 E279.3299
+G1 X45.000 Y60.000 E279.3959
+G1 X-45.000 Y60.000 E282.3659
+G1 X-42.202 Y62.000 E282.4319
+G1 X42.202 Y62.000 E285.2173
+G1 X39.102 Y64.000 E285.2833
+G1 X-39.102 Y64.000 E287.8640
+G1 X-35.623 Y66.000 E287.9300
+G1 X35.623 Y66.000 E290.2811
+G1 X31.639 Y68.000 E290.3471
+G1 X-31.639 Y68.000 E292.4353
+G1 X-26.926 Y70.000 E292.5013
+G1 X26.926 Y70.000 E294.2784
+G1 X21.000 Y72.000 E294.3444
+G1 X-21.000 Y72.000 E295.7304
+G1 X-12.207 Y74.000 E295.7964
+G1 X12.207 Y74.000 E296.6020
+G1 Z10 F9000
@@ -0,0 +1,8 @@
+; Print start directly after homing. Z keeps a rounding step without
+; distance, which made calculateMove divide by zero on the host.
+; expect Steps: X:67652 Y:49938 Z:787410 E0:0
+G28
+G1 X10 F3000
+G1 X20 Y20 F6000
+G28 X0 Y0
+G1 X10 Y5 F3000
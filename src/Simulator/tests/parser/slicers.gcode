@@ -0,0 +1,90 @@
+; Lines in the dialects of common slicers and hosts plus edge cases of the
+; number syntax. make check passes them to repetier-sim -a, which compares
+; GCode::parseAscii with the parser of version 1.0.x.
+; Cura
+;FLAVOR:RepRap
+;LAYER:0
+M140 S60
+M105
+M190 S60
+M104 S200
+M109 S200
+M82 ;absolute extrusion mode
+G28 ;Home
+G92 E0
+G1 F1500 E-6.5
+G0 F3600 X95.582 Y96.183 Z0.3
+G1 F1200 X96.255 Y95.582 E0.02507
+M106 S255
+M107
+; PrusaSlicer
+M73 P0 R12
+M201 X1000 Y1000 Z200 E5000 ; sets maximum accelerations, mm/sec^2
+M203 X200 Y200 Z12 E120 ; sets maximum feedrates, mm/sec
+M204 P1250 R1250 T1250 ; sets acceleration (P, T) and retract acceleration (R), mm/sec^2
+M205 X8.00 Y8.00 Z0.40 E1.50 ; sets the jerk limits, mm/sec
+G1 Z.2 F10800
+G1 X91.235 Y93.416 E.01818
+G1 E-.8 F2100
+G1 X-.5 Y+2.25
+M900 K0.04
+; Simplify3D
+G90
+M83
+G1 X93.649 Y86.917 E1.1038 F1800
+G1 X93.649 Y86.917 E1.1038 F1800.0
+T0
+T1
+M104 S210 T1
+M106 S255 P1
+G1 X0.000 Y0.000 Z0.000 E0.00000
+; Arcs
+G2 X10 Y10 I5 J0
+G3 X10.5 Y-3.25 I-5.125 J2.5 E1.5
+G2 X10 Y10 R5
+; Text arguments
+M117 Hello World
+M117 Printing 50% done
+M118 echo text
+M23 part.gco
+M23 folder/part.gco
+M20
+M28 newfile.g
+M30 oldfile.g
+M32 sub/part.g
+M36 part.gcode
+M531 Model name with spaces
+; Hosts with line numbers and checksums
+N0 M110*35
+N2 G1 X10 Y20 F3000*77
+N3 G1 X11.5 Y-20.25 E0.12345*125
+N4 M117 with checksum*47
+N5 M105*34
+N6 T0*60
+N7 G28 X0 Y0*21
+N8 G1 X5*99 ; wrong checksum
+; Number syntax
+G1 X 10 Y  20
+x10 y20 g1
+G1X10Y20E1F3000
+G1 X.5 Y-.5 Z+.5
+G1 X Y1
+G1 X1e2 Y1.5E1
+G1 X1E-2
+G1 X123456789012 Y0.1234567891234
+G1 X-0 Y-0.0
+G1 X0.1 Y0.2 Z0.3 E0.7 F0.9
+G1 X1234.5678 Y-9876.54321
+G1 X3.4028235e38
+G1 X1e-40
+G0 F12000.000000
+M104 S210.5
+G4 P500
+G4 S1
+M92 X80.00 Y80.00 Z400.00 E93.00
+M206 X-1.5 Y2.5 Z-0.25
+G1 X10 (move) Y20
+G1 X10 %program end
+G1 X10.5	Y20
+G1 X	10 Y 20
+G1 X1e2E3
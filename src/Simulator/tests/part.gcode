@@ -0,0 +1,3272 @@
+; generated by a script in the layout of Slic3r 1.3.0: 10 layers of a ring with a hole,
+; 2 perimeters from 72 and 48 segments, rectilinear infill, retracts on travel
+; expect Steps: X:413749 Y:404477 Z:2289513 E0:120072
+
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+
+M107
+M104 S205 ; set temperature
+G28 ; home all axes
+G1 Z5 F5000 ; lift nozzle
+M109 S205 ; wait for temperature to be reached
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M82 ; use absolute distances for extrusion
+G92 E0
+;LAYER:0
+G1 Z0.200 F7800
+G1 E-2.00000 F2400
+G1 X119.550 Y100.000 F7800
+G1 E0.00000 F2400
+G1 X119.476 Y101.704 E0.06382 F1800
+G1 X119.253 Y103.395 E0.12763
+G1 X118.884 Y105.060 E0.19145
+G1 X118.371 Y106.686 E0.25527
+G1 X117.718 Y108.262 E0.31908
+G1 X116.931 Y109.775 E0.38290
+G1 X116.014 Y111.213 E0.44672
+G1 X114.976 Y112.566 E0.51053
+G1 X113.824 Y113.824 E0.57435
+G1 X112.566 Y114.976 E0.63816
+G1 X111.213 Y116.014 E0.70198
+G1 X109.775 Y116.931 E0.76580
+G1 X108.262 Y117.718 E0.82961
+G1 X106.686 Y118.371 E0.89343
+G1 X105.060 Y118.884 E0.95725
+G1 X103.395 Y119.253 E1.02106
+G1 X101.704 Y119.476 E1.08488
+G1 X100.000 Y119.550 E1.14870
+G1 X98.296 Y119.476 E1.21251
+G1 X96.605 Y119.253 E1.27633
+G1 X94.940 Y118.884 E1.34015
+G1 X93.314 Y118.371 E1.40396
+G1 X91.738 Y117.718 E1.46778
+G1 X90.225 Y116.931 E1.53160
+G1 X88.787 Y116.014 E1.59541
+G1 X87.434 Y114.976 E1.65923
+G1 X86.176 Y113.824 E1.72304
+G1 X85.024 Y112.566 E1.78686
+G1 X83.986 Y111.213 E1.85068
+G1 X83.069 Y109.775 E1.91449
+G1 X82.282 Y108.262 E1.97831
+G1 X81.629 Y106.686 E2.04213
+G1 X81.116 Y105.060 E2.10594
+G1 X80.747 Y103.395 E2.16976
+G1 X80.524 Y101.704 E2.23358
+G1 X80.450 Y100.000 E2.29739
+G1 X80.524 Y98.296 E2.36121
+G1 X80.747 Y96.605 E2.42503
+G1 X81.116 Y94.940 E2.48884
+G1 X81.629 Y93.314 E2.55266
+G1 X82.282 Y91.738 E2.61648
+G1 X83.069 Y90.225 E2.68029
+G1 X83.986 Y88.787 E2.74411
+G1 X85.024 Y87.434 E2.80793
+G1 X86.176 Y86.176 E2.87174
+G1 X87.434 Y85.024 E2.93556
+G1 X88.787 Y83.986 E2.99937
+G1 X90.225 Y83.069 E3.06319
+G1 X91.738 Y82.282 E3.12701
+G1 X93.314 Y81.629 E3.19082
+G1 X94.940 Y81.116 E3.25464
+G1 X96.605 Y80.747 E3.31846
+G1 X98.296 Y80.524 E3.38227
+G1 X100.000 Y80.450 E3.44609
+G1 X101.704 Y80.524 E3.50991
+G1 X103.395 Y80.747 E3.57372
+G1 X105.060 Y81.116 E3.63754
+G1 X106.686 Y81.629 E3.70136
+G1 X108.262 Y82.282 E3.76517
+G1 X109.775 Y83.069 E3.82899
+G1 X111.213 Y83.986 E3.89281
+G1 X112.566 Y85.024 E3.95662
+G1 X113.824 Y86.176 E4.02044
+G1 X114.976 Y87.434 E4.08425
+G1 X116.014 Y88.787 E4.14807
+G1 X116.931 Y90.225 E4.21189
+G1 X117.718 Y91.738 E4.27570
+G1 X118.371 Y93.314 E4.33952
+G1 X118.884 Y94.940 E4.40334
+G1 X119.253 Y96.605 E4.46715
+G1 X119.476 Y98.296 E4.53097
+G1 X119.550 Y100.000 E4.59479
+G1 X120.000 Y100.000 F7800
+G1 X119.924 Y101.743 E4.66007 F1200
+G1 X119.696 Y103.473 E4.72536
+G1 X119.319 Y105.176 E4.79064
+G1 X118.794 Y106.840 E4.85593
+G1 X118.126 Y108.452 E4.92121
+G1 X117.321 Y110.000 E4.98650
+G1 X116.383 Y111.472 E5.05178
+G1 X115.321 Y112.856 E5.11707
+G1 X114.142 Y114.142 E5.18236
+G1 X112.856 Y115.321 E5.24764
+G1 X111.472 Y116.383 E5.31293
+G1 X110.000 Y117.321 E5.37821
+G1 X108.452 Y118.126 E5.44350
+G1 X106.840 Y118.794 E5.50878
+G1 X105.176 Y119.319 E5.57407
+G1 X103.473 Y119.696 E5.63935
+G1 X101.743 Y119.924 E5.70464
+G1 X100.000 Y120.000 E5.76992
+G1 X98.257 Y119.924 E5.83521
+G1 X96.527 Y119.696 E5.90049
+G1 X94.824 Y119.319 E5.96578
+G1 X93.160 Y118.794 E6.03107
+G1 X91.548 Y118.126 E6.09635
+G1 X90.000 Y117.321 E6.16164
+G1 X88.528 Y116.383 E6.22692
+G1 X87.144 Y115.321 E6.29221
+G1 X85.858 Y114.142 E6.35749
+G1 X84.679 Y112.856 E6.42278
+G1 X83.617 Y111.472 E6.48806
+G1 X82.679 Y110.000 E6.55335
+G1 X81.874 Y108.452 E6.61863
+G1 X81.206 Y106.840 E6.68392
+G1 X80.681 Y105.176 E6.74920
+G1 X80.304 Y103.473 E6.81449
+G1 X80.076 Y101.743 E6.87978
+G1 X80.000 Y100.000 E6.94506
+G1 X80.076 Y98.257 E7.01035
+G1 X80.304 Y96.527 E7.07563
+G1 X80.681 Y94.824 E7.14092
+G1 X81.206 Y93.160 E7.20620
+G1 X81.874 Y91.548 E7.27149
+G1 X82.679 Y90.000 E7.33677
+G1 X83.617 Y88.528 E7.40206
+G1 X84.679 Y87.144 E7.46734
+G1 X85.858 Y85.858 E7.53263
+G1 X87.144 Y84.679 E7.59792
+G1 X88.528 Y83.617 E7.66320
+G1 X90.000 Y82.679 E7.72849
+G1 X91.548 Y81.874 E7.79377
+G1 X93.160 Y81.206 E7.85906
+G1 X94.824 Y80.681 E7.92434
+G1 X96.527 Y80.304 E7.98963
+G1 X98.257 Y80.076 E8.05491
+G1 X100.000 Y80.000 E8.12020
+G1 X101.743 Y80.076 E8.18548
+G1 X103.473 Y80.304 E8.25077
+G1 X105.176 Y80.681 E8.31605
+G1 X106.840 Y81.206 E8.38134
+G1 X108.452 Y81.874 E8.44663
+G1 X110.000 Y82.679 E8.51191
+G1 X111.472 Y83.617 E8.57720
+G1 X112.856 Y84.679 E8.64248
+G1 X114.142 Y85.858 E8.70777
+G1 X115.321 Y87.144 E8.77305
+G1 X116.383 Y88.528 E8.83834
+G1 X117.321 Y90.000 E8.90362
+G1 X118.126 Y91.548 E8.96891
+G1 X118.794 Y93.160 E9.03419
+G1 X119.319 Y94.824 E9.09948
+G1 X119.696 Y96.527 E9.16476
+G1 X119.924 Y98.257 E9.23005
+G1 X120.000 Y100.000 E9.29534
+G1 E7.29534 F2400
+G1 X106.450 Y100.000 F7800
+G1 E9.29534 F2400
+G1 X106.395 Y100.842 E9.32690 F1800
+G1 X106.230 Y101.669 E9.35847
+G1 X105.959 Y102.468 E9.39004
+G1 X105.586 Y103.225 E9.42161
+G1 X105.117 Y103.927 E9.45318
+G1 X104.561 Y104.561 E9.48475
+G1 X103.927 Y105.117 E9.51632
+G1 X103.225 Y105.586 E9.54789
+G1 X102.468 Y105.959 E9.57946
+G1 X101.669 Y106.230 E9.61103
+G1 X100.842 Y106.395 E9.64260
+G1 X100.000 Y106.450 E9.67417
+G1 X99.158 Y106.395 E9.70574
+G1 X98.331 Y106.230 E9.73731
+G1 X97.532 Y105.959 E9.76887
+G1 X96.775 Y105.586 E9.80044
+G1 X96.073 Y105.117 E9.83201
+G1 X95.439 Y104.561 E9.86358
+G1 X94.883 Y103.927 E9.89515
+G1 X94.414 Y103.225 E9.92672
+G1 X94.041 Y102.468 E9.95829
+G1 X93.770 Y101.669 E9.98986
+G1 X93.605 Y100.842 E10.02143
+G1 X93.550 Y100.000 E10.05300
+G1 X93.605 Y99.158 E10.08457
+G1 X93.770 Y98.331 E10.11614
+G1 X94.041 Y97.532 E10.14771
+G1 X94.414 Y96.775 E10.17928
+G1 X94.883 Y96.073 E10.21084
+G1 X95.439 Y95.439 E10.24241
+G1 X96.073 Y94.883 E10.27398
+G1 X96.775 Y94.414 E10.30555
+G1 X97.532 Y94.041 E10.33712
+G1 X98.331 Y93.770 E10.36869
+G1 X99.158 Y93.605 E10.40026
+G1 X100.000 Y93.550 E10.43183
+G1 X100.842 Y93.605 E10.46340
+G1 X101.669 Y93.770 E10.49497
+G1 X102.468 Y94.041 E10.52654
+G1 X103.225 Y94.414 E10.55811
+G1 X103.927 Y94.883 E10.58968
+G1 X104.561 Y95.439 E10.62125
+G1 X105.117 Y96.073 E10.65281
+G1 X105.586 Y96.775 E10.68438
+G1 X105.959 Y97.532 E10.71595
+G1 X106.230 Y98.331 E10.74752
+G1 X106.395 Y99.158 E10.77909
+G1 X106.450 Y100.000 E10.81066
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E10.84003 F1200
+G1 X105.796 Y101.553 E10.86939
+G1 X105.543 Y102.296 E10.89876
+G1 X105.196 Y103.000 E10.92813
+G1 X104.760 Y103.653 E10.95750
+G1 X104.243 Y104.243 E10.98686
+G1 X103.653 Y104.760 E11.01623
+G1 X103.000 Y105.196 E11.04560
+G1 X102.296 Y105.543 E11.07496
+G1 X101.553 Y105.796 E11.10433
+G1 X100.783 Y105.949 E11.13370
+G1 X100.000 Y106.000 E11.16306
+G1 X99.217 Y105.949 E11.19243
+G1 X98.447 Y105.796 E11.22180
+G1 X97.704 Y105.543 E11.25116
+G1 X97.000 Y105.196 E11.28053
+G1 X96.347 Y104.760 E11.30990
+G1 X95.757 Y104.243 E11.33926
+G1 X95.240 Y103.653 E11.36863
+G1 X94.804 Y103.000 E11.39800
+G1 X94.457 Y102.296 E11.42736
+G1 X94.204 Y101.553 E11.45673
+G1 X94.051 Y100.783 E11.48610
+G1 X94.000 Y100.000 E11.51546
+G1 X94.051 Y99.217 E11.54483
+G1 X94.204 Y98.447 E11.57420
+G1 X94.457 Y97.704 E11.60356
+G1 X94.804 Y97.000 E11.63293
+G1 X95.240 Y96.347 E11.66230
+G1 X95.757 Y95.757 E11.69166
+G1 X96.347 Y95.240 E11.72103
+G1 X97.000 Y94.804 E11.75040
+G1 X97.704 Y94.457 E11.77977
+G1 X98.447 Y94.204 E11.80913
+G1 X99.217 Y94.051 E11.83850
+G1 X100.000 Y94.000 E11.86787
+G1 X100.783 Y94.051 E11.89723
+G1 X101.553 Y94.204 E11.92660
+G1 X102.296 Y94.457 E11.95597
+G1 X103.000 Y94.804 E11.98533
+G1 X103.653 Y95.240 E12.01470
+G1 X104.243 Y95.757 E12.04407
+G1 X104.760 Y96.347 E12.07343
+G1 X105.196 Y97.000 E12.10280
+G1 X105.543 Y97.704 E12.13217
+G1 X105.796 Y98.447 E12.16153
+G1 X105.949 Y99.217 E12.19090
+G1 X106.000 Y100.000 E12.22027
+G1 E10.22027 F2400
+G1 X108.619 Y82.703 F7800
+G1 E12.22027 F2400
+G1 X117.297 Y91.381 E12.67945 F3600
+G1 E10.67945 F2400
+G1 X119.161 Y97.488 F7800
+G1 E12.67945 F2400
+G1 X102.512 Y80.839 E13.56048 F3600
+G1 E11.56048 F2400
+G1 X98.190 Y80.760 F7800
+G1 E13.56048 F2400
+G1 X119.240 Y101.810 E14.67437 F3600
+G1 E12.67437 F2400
+G1 X118.562 Y105.375 F7800
+G1 E14.67437 F2400
+G1 X94.625 Y81.438 E15.94105 F3600
+G1 E13.94105 F2400
+G1 X91.560 Y82.615 F7800
+G1 E15.94105 F2400
+G1 X102.964 Y94.019 E16.54451 F3600
+G1 E14.54451 F2400
+G1 X105.981 Y97.036 F7800
+G1 E16.54451 F2400
+G1 X117.385 Y108.440 E17.14796 F3600
+G1 E15.14796 F2400
+G1 X115.812 Y111.110 F7800
+G1 E17.14796 F2400
+G1 X106.444 Y101.742 E17.64371 F3600
+G1 E15.64371 F2400
+G1 X98.258 Y93.556 F7800
+G1 E17.64371 F2400
+G1 X88.890 Y84.188 E18.13945 F3600
+G1 E16.13945 F2400
+G1 X86.567 Y86.107 F7800
+G1 E18.13945 F2400
+G1 X95.515 Y95.056 E18.61297 F3600
+G1 E16.61297 F2400
+G1 X104.944 Y104.485 F7800
+G1 E18.61297 F2400
+G1 X113.893 Y113.433 E19.08650 F3600
+G1 E17.08650 F2400
+G1 X111.642 Y115.425 F7800
+G1 E19.08650 F2400
+G1 X102.433 Y106.216 E19.57381 F3600
+G1 E17.57381 F2400
+G1 X93.784 Y97.567 F7800
+G1 E19.57381 F2400
+G1 X84.575 Y88.358 E20.06111 F3600
+G1 E18.06111 F2400
+G1 X82.925 Y90.950 F7800
+G1 E20.06111 F2400
+G1 X93.502 Y101.528 E20.62083 F3600
+G1 E18.62083 F2400
+G1 X98.472 Y106.498 F7800
+G1 E20.62083 F2400
+G1 X109.050 Y117.075 E21.18055 F3600
+G1 E19.18055 F2400
+G1 X106.076 Y118.345 F7800
+G1 E21.18055 F2400
+G1 X81.655 Y93.924 E22.47284 F3600
+G1 E20.47284 F2400
+G1 X80.855 Y97.366 F7800
+G1 E22.47284 F2400
+G1 X102.634 Y119.145 E23.62528 F3600
+G1 E21.62528 F2400
+G1 X98.514 Y119.268 F7800
+G1 E23.62528 F2400
+G1 X80.732 Y101.486 E24.56625 F3600
+G1 E22.56625 F2400
+G1 X81.977 Y106.973 F7800
+G1 E24.56625 F2400
+G1 X93.027 Y118.023 E25.15097 F3600
+;LAYER:1
+G1 Z0.400 F7800
+G1 E23.15097 F2400
+G1 X120.437 Y102.051 F7800
+G1 E25.15097 F2400
+G1 X120.181 Y103.824 E25.21801 F1800
+G1 X119.770 Y105.568 E25.28506
+G1 X119.210 Y107.270 E25.35211
+G1 X118.503 Y108.917 E25.41915
+G1 X117.656 Y110.495 E25.48620
+G1 X116.674 Y111.994 E25.55325
+G1 X115.565 Y113.402 E25.62029
+G1 X114.338 Y114.707 E25.68734
+G1 X113.001 Y115.901 E25.75439
+G1 X111.566 Y116.974 E25.82144
+G1 X110.042 Y117.917 E25.88848
+G1 X108.443 Y118.724 E25.95553
+G1 X106.779 Y119.389 E26.02258
+G1 X105.063 Y119.906 E26.08962
+G1 X103.309 Y120.271 E26.15667
+G1 X101.529 Y120.483 E26.22372
+G1 X99.738 Y120.538 E26.29076
+G1 X97.949 Y120.437 E26.35781
+G1 X96.176 Y120.181 E26.42486
+G1 X94.432 Y119.770 E26.49190
+G1 X92.730 Y119.210 E26.55895
+G1 X91.083 Y118.503 E26.62600
+G1 X89.505 Y117.656 E26.69304
+G1 X88.006 Y116.674 E26.76009
+G1 X86.598 Y115.565 E26.82714
+G1 X85.293 Y114.338 E26.89419
+G1 X84.099 Y113.001 E26.96123
+G1 X83.026 Y111.566 E27.02828
+G1 X82.083 Y110.042 E27.09533
+G1 X81.276 Y108.443 E27.16237
+G1 X80.611 Y106.779 E27.22942
+G1 X80.094 Y105.063 E27.29647
+G1 X79.729 Y103.309 E27.36351
+G1 X79.517 Y101.529 E27.43056
+G1 X79.462 Y99.738 E27.49761
+G1 X79.563 Y97.949 E27.56465
+G1 X79.819 Y96.176 E27.63170
+G1 X80.230 Y94.432 E27.69875
+G1 X80.790 Y92.730 E27.76579
+G1 X81.497 Y91.083 E27.83284
+G1 X82.344 Y89.505 E27.89989
+G1 X83.326 Y88.006 E27.96693
+G1 X84.435 Y86.598 E28.03398
+G1 X85.662 Y85.293 E28.10103
+G1 X86.999 Y84.099 E28.16808
+G1 X88.434 Y83.026 E28.23512
+G1 X89.958 Y82.083 E28.30217
+G1 X91.557 Y81.276 E28.36922
+G1 X93.221 Y80.611 E28.43626
+G1 X94.937 Y80.094 E28.50331
+G1 X96.691 Y79.729 E28.57036
+G1 X98.471 Y79.517 E28.63740
+G1 X100.262 Y79.462 E28.70445
+G1 X102.051 Y79.563 E28.77150
+G1 X103.824 Y79.819 E28.83854
+G1 X105.568 Y80.230 E28.90559
+G1 X107.270 Y80.790 E28.97264
+G1 X108.917 Y81.497 E29.03968
+G1 X110.495 Y82.344 E29.10673
+G1 X111.994 Y83.326 E29.17378
+G1 X113.402 Y84.435 E29.24083
+G1 X114.707 Y85.662 E29.30787
+G1 X115.901 Y86.999 E29.37492
+G1 X116.974 Y88.434 E29.44197
+G1 X117.917 Y89.958 E29.50901
+G1 X118.724 Y91.557 E29.57606
+G1 X119.389 Y93.221 E29.64311
+G1 X119.906 Y94.937 E29.71015
+G1 X120.271 Y96.691 E29.77720
+G1 X120.483 Y98.471 E29.84425
+G1 X120.538 Y100.262 E29.91129
+G1 X120.437 Y102.051 E29.97834
+G1 X120.885 Y102.095 F7800
+G1 X120.623 Y103.908 E30.04686 F1200
+G1 X120.204 Y105.690 E30.11537
+G1 X119.631 Y107.429 E30.18389
+G1 X118.909 Y109.112 E30.25240
+G1 X118.042 Y110.725 E30.32092
+G1 X117.039 Y112.257 E30.38944
+G1 X115.906 Y113.696 E30.45795
+G1 X114.652 Y115.030 E30.52647
+G1 X113.286 Y116.249 E30.59498
+G1 X111.819 Y117.346 E30.66350
+G1 X110.262 Y118.310 E30.73201
+G1 X108.628 Y119.134 E30.80053
+G1 X106.927 Y119.814 E30.86905
+G1 X105.174 Y120.342 E30.93756
+G1 X103.381 Y120.715 E31.00608
+G1 X101.563 Y120.931 E31.07459
+G1 X99.733 Y120.988 E31.14311
+G1 X97.905 Y120.885 E31.21162
+G1 X96.092 Y120.623 E31.28014
+G1 X94.310 Y120.204 E31.34866
+G1 X92.571 Y119.631 E31.41717
+G1 X90.888 Y118.909 E31.48569
+G1 X89.275 Y118.042 E31.55420
+G1 X87.743 Y117.039 E31.62272
+G1 X86.304 Y115.906 E31.69123
+G1 X84.970 Y114.652 E31.75975
+G1 X83.751 Y113.286 E31.82827
+G1 X82.654 Y111.819 E31.89678
+G1 X81.690 Y110.262 E31.96530
+G1 X80.866 Y108.628 E32.03381
+G1 X80.186 Y106.927 E32.10233
+G1 X79.658 Y105.174 E32.17085
+G1 X79.285 Y103.381 E32.23936
+G1 X79.069 Y101.563 E32.30788
+G1 X79.012 Y99.733 E32.37639
+G1 X79.115 Y97.905 E32.44491
+G1 X79.377 Y96.092 E32.51342
+G1 X79.796 Y94.310 E32.58194
+G1 X80.369 Y92.571 E32.65046
+G1 X81.091 Y90.888 E32.71897
+G1 X81.958 Y89.275 E32.78749
+G1 X82.961 Y87.743 E32.85600
+G1 X84.094 Y86.304 E32.92452
+G1 X85.348 Y84.970 E32.99303
+G1 X86.714 Y83.751 E33.06155
+G1 X88.181 Y82.654 E33.13007
+G1 X89.738 Y81.690 E33.19858
+G1 X91.372 Y80.866 E33.26710
+G1 X93.073 Y80.186 E33.33561
+G1 X94.826 Y79.658 E33.40413
+G1 X96.619 Y79.285 E33.47264
+G1 X98.437 Y79.069 E33.54116
+G1 X100.267 Y79.012 E33.60968
+G1 X102.095 Y79.115 E33.67819
+G1 X103.908 Y79.377 E33.74671
+G1 X105.690 Y79.796 E33.81522
+G1 X107.429 Y80.369 E33.88374
+G1 X109.112 Y81.091 E33.95226
+G1 X110.725 Y81.958 E34.02077
+G1 X112.257 Y82.961 E34.08929
+G1 X113.696 Y84.094 E34.15780
+G1 X115.030 Y85.348 E34.22632
+G1 X116.249 Y86.714 E34.29483
+G1 X117.346 Y88.181 E34.36335
+G1 X118.310 Y89.738 E34.43187
+G1 X119.134 Y91.372 E34.50038
+G1 X119.814 Y93.073 E34.56890
+G1 X120.342 Y94.826 E34.63741
+G1 X120.715 Y96.619 E34.70593
+G1 X120.931 Y98.437 E34.77444
+G1 X120.988 Y100.267 E34.84296
+G1 X120.885 Y102.095 E34.91148
+G1 E32.91148 F2400
+G1 X106.450 Y100.000 F7800
+G1 E34.91148 F2400
+G1 X106.395 Y100.842 E34.94305 F1800
+G1 X106.230 Y101.669 E34.97461
+G1 X105.959 Y102.468 E35.00618
+G1 X105.586 Y103.225 E35.03775
+G1 X105.117 Y103.927 E35.06932
+G1 X104.561 Y104.561 E35.10089
+G1 X103.927 Y105.117 E35.13246
+G1 X103.225 Y105.586 E35.16403
+G1 X102.468 Y105.959 E35.19560
+G1 X101.669 Y106.230 E35.22717
+G1 X100.842 Y106.395 E35.25874
+G1 X100.000 Y106.450 E35.29031
+G1 X99.158 Y106.395 E35.32188
+G1 X98.331 Y106.230 E35.35345
+G1 X97.532 Y105.959 E35.38502
+G1 X96.775 Y105.586 E35.41658
+G1 X96.073 Y105.117 E35.44815
+G1 X95.439 Y104.561 E35.47972
+G1 X94.883 Y103.927 E35.51129
+G1 X94.414 Y103.225 E35.54286
+G1 X94.041 Y102.468 E35.57443
+G1 X93.770 Y101.669 E35.60600
+G1 X93.605 Y100.842 E35.63757
+G1 X93.550 Y100.000 E35.66914
+G1 X93.605 Y99.158 E35.70071
+G1 X93.770 Y98.331 E35.73228
+G1 X94.041 Y97.532 E35.76385
+G1 X94.414 Y96.775 E35.79542
+G1 X94.883 Y96.073 E35.82699
+G1 X95.439 Y95.439 E35.85855
+G1 X96.073 Y94.883 E35.89012
+G1 X96.775 Y94.414 E35.92169
+G1 X97.532 Y94.041 E35.95326
+G1 X98.331 Y93.770 E35.98483
+G1 X99.158 Y93.605 E36.01640
+G1 X100.000 Y93.550 E36.04797
+G1 X100.842 Y93.605 E36.07954
+G1 X101.669 Y93.770 E36.11111
+G1 X102.468 Y94.041 E36.14268
+G1 X103.225 Y94.414 E36.17425
+G1 X103.927 Y94.883 E36.20582
+G1 X104.561 Y95.439 E36.23739
+G1 X105.117 Y96.073 E36.26896
+G1 X105.586 Y96.775 E36.30052
+G1 X105.959 Y97.532 E36.33209
+G1 X106.230 Y98.331 E36.36366
+G1 X106.395 Y99.158 E36.39523
+G1 X106.450 Y100.000 E36.42680
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E36.45617 F1200
+G1 X105.796 Y101.553 E36.48554
+G1 X105.543 Y102.296 E36.51490
+G1 X105.196 Y103.000 E36.54427
+G1 X104.760 Y103.653 E36.57364
+G1 X104.243 Y104.243 E36.60300
+G1 X103.653 Y104.760 E36.63237
+G1 X103.000 Y105.196 E36.66174
+G1 X102.296 Y105.543 E36.69110
+G1 X101.553 Y105.796 E36.72047
+G1 X100.783 Y105.949 E36.74984
+G1 X100.000 Y106.000 E36.77920
+G1 X99.217 Y105.949 E36.80857
+G1 X98.447 Y105.796 E36.83794
+G1 X97.704 Y105.543 E36.86730
+G1 X97.000 Y105.196 E36.89667
+G1 X96.347 Y104.760 E36.92604
+G1 X95.757 Y104.243 E36.95540
+G1 X95.240 Y103.653 E36.98477
+G1 X94.804 Y103.000 E37.01414
+G1 X94.457 Y102.296 E37.04350
+G1 X94.204 Y101.553 E37.07287
+G1 X94.051 Y100.783 E37.10224
+G1 X94.000 Y100.000 E37.13160
+G1 X94.051 Y99.217 E37.16097
+G1 X94.204 Y98.447 E37.19034
+G1 X94.457 Y97.704 E37.21971
+G1 X94.804 Y97.000 E37.24907
+G1 X95.240 Y96.347 E37.27844
+G1 X95.757 Y95.757 E37.30781
+G1 X96.347 Y95.240 E37.33717
+G1 X97.000 Y94.804 E37.36654
+G1 X97.704 Y94.457 E37.39591
+G1 X98.447 Y94.204 E37.42527
+G1 X99.217 Y94.051 E37.45464
+G1 X100.000 Y94.000 E37.48401
+G1 X100.783 Y94.051 E37.51337
+G1 X101.553 Y94.204 E37.54274
+G1 X102.296 Y94.457 E37.57211
+G1 X103.000 Y94.804 E37.60147
+G1 X103.653 Y95.240 E37.63084
+G1 X104.243 Y95.757 E37.66021
+G1 X104.760 Y96.347 E37.68957
+G1 X105.196 Y97.000 E37.71894
+G1 X105.543 Y97.704 E37.74831
+G1 X105.796 Y98.447 E37.77767
+G1 X105.949 Y99.217 E37.80704
+G1 X106.000 Y100.000 E37.83641
+G1 E35.83641 F2400
+G1 X81.891 Y90.794 F7800
+G1 E37.83641 F2400
+G1 X90.794 Y81.891 E38.30751 F3600
+G1 E36.30751 F2400
+G1 X97.023 Y79.905 F7800
+G1 E38.30751 F2400
+G1 X79.905 Y97.023 E39.21335 F3600
+G1 E37.21335 F2400
+G1 X79.736 Y101.434 F7800
+G1 E39.21335 F2400
+G1 X101.434 Y79.736 E40.36154 F3600
+G1 E38.36154 F2400
+G1 X105.082 Y80.331 F7800
+G1 E40.36154 F2400
+G1 X80.331 Y105.082 E41.67125 F3600
+G1 E39.67125 F2400
+G1 X81.427 Y108.229 F7800
+G1 E41.67125 F2400
+G1 X108.229 Y81.427 E43.08953 F3600
+G1 E41.08953 F2400
+G1 X110.986 Y82.912 F7800
+G1 E43.08953 F2400
+G1 X100.550 Y93.348 E43.64174 F3600
+G1 E41.64174 F2400
+G1 X93.348 Y100.550 F7800
+G1 E43.64174 F2400
+G1 X82.912 Y110.986 E44.19395 F3600
+G1 E42.19395 F2400
+G1 X84.736 Y113.405 F7800
+G1 E44.19395 F2400
+G1 X94.443 Y103.698 E44.70761 F3600
+G1 E42.70761 F2400
+G1 X103.698 Y94.443 F7800
+G1 E44.70761 F2400
+G1 X113.405 Y84.736 E45.22127 F3600
+G1 E43.22127 F2400
+G1 X115.507 Y86.877 F7800
+G1 E45.22127 F2400
+G1 X105.759 Y96.625 E45.73711 F3600
+G1 E43.73711 F2400
+G1 X96.625 Y105.759 F7800
+G1 E45.73711 F2400
+G1 X86.877 Y115.507 E46.25294 F3600
+G1 E44.25294 F2400
+G1 X89.336 Y117.290 F7800
+G1 E46.25294 F2400
+G1 X99.951 Y106.675 E46.81468 F3600
+G1 E44.81468 F2400
+G1 X106.675 Y99.951 F7800
+G1 E46.81468 F2400
+G1 X117.290 Y89.336 E47.37642 F3600
+G1 E45.37642 F2400
+G1 X118.731 Y92.137 F7800
+G1 E47.37642 F2400
+G1 X92.137 Y118.731 E48.78368 F3600
+G1 E46.78368 F2400
+G1 X95.339 Y119.773 F7800
+G1 E48.78368 F2400
+G1 X119.773 Y95.339 E50.07663 F3600
+G1 E48.07663 F2400
+G1 X120.293 Y99.061 F7800
+G1 E50.07663 F2400
+G1 X99.061 Y120.293 E51.20014 F3600
+G1 E49.20014 F2400
+G1 X103.604 Y119.992 F7800
+G1 E51.20014 F2400
+G1 X119.992 Y103.604 E52.06733 F3600
+;LAYER:2
+G1 Z0.600 F7800
+G1 X121.040 Y104.265 F7800
+G1 X120.588 Y106.082 E52.13741 F1800
+G1 X119.980 Y107.854 E52.20749
+G1 X119.219 Y109.565 E52.27756
+G1 X118.312 Y111.204 E52.34764
+G1 X117.266 Y112.757 E52.41772
+G1 X116.088 Y114.213 E52.48779
+G1 X114.788 Y115.562 E52.55787
+G1 X113.376 Y116.791 E52.62794
+G1 X111.862 Y117.893 E52.69802
+G1 X110.257 Y118.859 E52.76810
+G1 X108.574 Y119.681 E52.83817
+G1 X106.826 Y120.353 E52.90825
+G1 X105.026 Y120.871 E52.97833
+G1 X103.188 Y121.230 E53.04840
+G1 X101.326 Y121.427 E53.11848
+G1 X99.453 Y121.461 E53.18856
+G1 X97.585 Y121.331 E53.25863
+G1 X95.735 Y121.040 E53.32871
+G1 X93.918 Y120.588 E53.39879
+G1 X92.146 Y119.980 E53.46886
+G1 X90.435 Y119.219 E53.53894
+G1 X88.796 Y118.312 E53.60901
+G1 X87.243 Y117.266 E53.67909
+G1 X85.787 Y116.088 E53.74917
+G1 X84.438 Y114.788 E53.81924
+G1 X83.209 Y113.376 E53.88932
+G1 X82.107 Y111.862 E53.95940
+G1 X81.141 Y110.257 E54.02947
+G1 X80.319 Y108.574 E54.09955
+G1 X79.647 Y106.826 E54.16963
+G1 X79.129 Y105.026 E54.23970
+G1 X78.770 Y103.188 E54.30978
+G1 X78.573 Y101.326 E54.37985
+G1 X78.539 Y99.453 E54.44993
+G1 X78.669 Y97.585 E54.52001
+G1 X78.960 Y95.735 E54.59008
+G1 X79.412 Y93.918 E54.66016
+G1 X80.020 Y92.146 E54.73024
+G1 X80.781 Y90.435 E54.80031
+G1 X81.688 Y88.796 E54.87039
+G1 X82.734 Y87.243 E54.94047
+G1 X83.912 Y85.787 E55.01054
+G1 X85.212 Y84.438 E55.08062
+G1 X86.624 Y83.209 E55.15069
+G1 X88.138 Y82.107 E55.22077
+G1 X89.743 Y81.141 E55.29085
+G1 X91.426 Y80.319 E55.36092
+G1 X93.174 Y79.647 E55.43100
+G1 X94.974 Y79.129 E55.50108
+G1 X96.812 Y78.770 E55.57115
+G1 X98.674 Y78.573 E55.64123
+G1 X100.547 Y78.539 E55.71131
+G1 X102.415 Y78.669 E55.78138
+G1 X104.265 Y78.960 E55.85146
+G1 X106.082 Y79.412 E55.92153
+G1 X107.854 Y80.020 E55.99161
+G1 X109.565 Y80.781 E56.06169
+G1 X111.204 Y81.688 E56.13176
+G1 X112.757 Y82.734 E56.20184
+G1 X114.213 Y83.912 E56.27192
+G1 X115.562 Y85.212 E56.34199
+G1 X116.791 Y86.624 E56.41207
+G1 X117.893 Y88.138 E56.48215
+G1 X118.859 Y89.743 E56.55222
+G1 X119.681 Y91.426 E56.62230
+G1 X120.353 Y93.174 E56.69237
+G1 X120.871 Y94.974 E56.76245
+G1 X121.230 Y96.812 E56.83253
+G1 X121.427 Y98.674 E56.90260
+G1 X121.461 Y100.547 E56.97268
+G1 X121.331 Y102.415 E57.04276
+G1 X121.040 Y104.265 E57.11283
+G1 X121.481 Y104.354 F7800
+G1 X121.020 Y106.210 E57.18438 F1200
+G1 X120.398 Y108.018 E57.25592
+G1 X119.622 Y109.766 E57.32747
+G1 X118.696 Y111.439 E57.39901
+G1 X117.628 Y113.025 E57.47056
+G1 X116.426 Y114.511 E57.54210
+G1 X115.098 Y115.888 E57.61365
+G1 X113.656 Y117.143 E57.68520
+G1 X112.110 Y118.268 E57.75674
+G1 X110.472 Y119.254 E57.82829
+G1 X108.754 Y120.094 E57.89983
+G1 X106.969 Y120.780 E57.97138
+G1 X105.132 Y121.308 E58.04292
+G1 X103.255 Y121.675 E58.11447
+G1 X101.354 Y121.876 E58.18601
+G1 X99.442 Y121.911 E58.25756
+G1 X97.534 Y121.779 E58.32910
+G1 X95.646 Y121.481 E58.40065
+G1 X93.790 Y121.020 E58.47219
+G1 X91.982 Y120.398 E58.54374
+G1 X90.234 Y119.622 E58.61528
+G1 X88.561 Y118.696 E58.68683
+G1 X86.975 Y117.628 E58.75838
+G1 X85.489 Y116.426 E58.82992
+G1 X84.112 Y115.098 E58.90147
+G1 X82.857 Y113.656 E58.97301
+G1 X81.732 Y112.110 E59.04456
+G1 X80.746 Y110.472 E59.11610
+G1 X79.906 Y108.754 E59.18765
+G1 X79.220 Y106.969 E59.25919
+G1 X78.692 Y105.132 E59.33074
+G1 X78.325 Y103.255 E59.40228
+G1 X78.124 Y101.354 E59.47383
+G1 X78.089 Y99.442 E59.54537
+G1 X78.221 Y97.534 E59.61692
+G1 X78.519 Y95.646 E59.68846
+G1 X78.980 Y93.790 E59.76001
+G1 X79.602 Y91.982 E59.83155
+G1 X80.378 Y90.234 E59.90310
+G1 X81.304 Y88.561 E59.97465
+G1 X82.372 Y86.975 E60.04619
+G1 X83.574 Y85.489 E60.11774
+G1 X84.902 Y84.112 E60.18928
+G1 X86.344 Y82.857 E60.26083
+G1 X87.890 Y81.732 E60.33237
+G1 X89.528 Y80.746 E60.40392
+G1 X91.246 Y79.906 E60.47546
+G1 X93.031 Y79.220 E60.54701
+G1 X94.868 Y78.692 E60.61855
+G1 X96.745 Y78.325 E60.69010
+G1 X98.646 Y78.124 E60.76164
+G1 X100.558 Y78.089 E60.83319
+G1 X102.466 Y78.221 E60.90473
+G1 X104.354 Y78.519 E60.97628
+G1 X106.210 Y78.980 E61.04782
+G1 X108.018 Y79.602 E61.11937
+G1 X109.766 Y80.378 E61.19092
+G1 X111.439 Y81.304 E61.26246
+G1 X113.025 Y82.372 E61.33401
+G1 X114.511 Y83.574 E61.40555
+G1 X115.888 Y84.902 E61.47710
+G1 X117.143 Y86.344 E61.54864
+G1 X118.268 Y87.890 E61.62019
+G1 X119.254 Y89.528 E61.69173
+G1 X120.094 Y91.246 E61.76328
+G1 X120.780 Y93.031 E61.83482
+G1 X121.308 Y94.868 E61.90637
+G1 X121.675 Y96.745 E61.97791
+G1 X121.876 Y98.646 E62.04946
+G1 X121.911 Y100.558 E62.12100
+G1 X121.779 Y102.466 E62.19255
+G1 X121.481 Y104.354 E62.26409
+G1 E60.26409 F2400
+G1 X106.450 Y100.000 F7800
+G1 E62.26409 F2400
+G1 X106.395 Y100.842 E62.29566 F1800
+G1 X106.230 Y101.669 E62.32723
+G1 X105.959 Y102.468 E62.35880
+G1 X105.586 Y103.225 E62.39037
+G1 X105.117 Y103.927 E62.42194
+G1 X104.561 Y104.561 E62.45351
+G1 X103.927 Y105.117 E62.48508
+G1 X103.225 Y105.586 E62.51665
+G1 X102.468 Y105.959 E62.54822
+G1 X101.669 Y106.230 E62.57979
+G1 X100.842 Y106.395 E62.61136
+G1 X100.000 Y106.450 E62.64293
+G1 X99.158 Y106.395 E62.67450
+G1 X98.331 Y106.230 E62.70606
+G1 X97.532 Y105.959 E62.73763
+G1 X96.775 Y105.586 E62.76920
+G1 X96.073 Y105.117 E62.80077
+G1 X95.439 Y104.561 E62.83234
+G1 X94.883 Y103.927 E62.86391
+G1 X94.414 Y103.225 E62.89548
+G1 X94.041 Y102.468 E62.92705
+G1 X93.770 Y101.669 E62.95862
+G1 X93.605 Y100.842 E62.99019
+G1 X93.550 Y100.000 E63.02176
+G1 X93.605 Y99.158 E63.05333
+G1 X93.770 Y98.331 E63.08490
+G1 X94.041 Y97.532 E63.11647
+G1 X94.414 Y96.775 E63.14803
+G1 X94.883 Y96.073 E63.17960
+G1 X95.439 Y95.439 E63.21117
+G1 X96.073 Y94.883 E63.24274
+G1 X96.775 Y94.414 E63.27431
+G1 X97.532 Y94.041 E63.30588
+G1 X98.331 Y93.770 E63.33745
+G1 X99.158 Y93.605 E63.36902
+G1 X100.000 Y93.550 E63.40059
+G1 X100.842 Y93.605 E63.43216
+G1 X101.669 Y93.770 E63.46373
+G1 X102.468 Y94.041 E63.49530
+G1 X103.225 Y94.414 E63.52687
+G1 X103.927 Y94.883 E63.55844
+G1 X104.561 Y95.439 E63.59000
+G1 X105.117 Y96.073 E63.62157
+G1 X105.586 Y96.775 E63.65314
+G1 X105.959 Y97.532 E63.68471
+G1 X106.230 Y98.331 E63.71628
+G1 X106.395 Y99.158 E63.74785
+G1 X106.450 Y100.000 E63.77942
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E63.80879 F1200
+G1 X105.796 Y101.553 E63.83815
+G1 X105.543 Y102.296 E63.86752
+G1 X105.196 Y103.000 E63.89689
+G1 X104.760 Y103.653 E63.92625
+G1 X104.243 Y104.243 E63.95562
+G1 X103.653 Y104.760 E63.98499
+G1 X103.000 Y105.196 E64.01435
+G1 X102.296 Y105.543 E64.04372
+G1 X101.553 Y105.796 E64.07309
+G1 X100.783 Y105.949 E64.10246
+G1 X100.000 Y106.000 E64.13182
+G1 X99.217 Y105.949 E64.16119
+G1 X98.447 Y105.796 E64.19056
+G1 X97.704 Y105.543 E64.21992
+G1 X97.000 Y105.196 E64.24929
+G1 X96.347 Y104.760 E64.27866
+G1 X95.757 Y104.243 E64.30802
+G1 X95.240 Y103.653 E64.33739
+G1 X94.804 Y103.000 E64.36676
+G1 X94.457 Y102.296 E64.39612
+G1 X94.204 Y101.553 E64.42549
+G1 X94.051 Y100.783 E64.45486
+G1 X94.000 Y100.000 E64.48422
+G1 X94.051 Y99.217 E64.51359
+G1 X94.204 Y98.447 E64.54296
+G1 X94.457 Y97.704 E64.57232
+G1 X94.804 Y97.000 E64.60169
+G1 X95.240 Y96.347 E64.63106
+G1 X95.757 Y95.757 E64.66042
+G1 X96.347 Y95.240 E64.68979
+G1 X97.000 Y94.804 E64.71916
+G1 X97.704 Y94.457 E64.74852
+G1 X98.447 Y94.204 E64.77789
+G1 X99.217 Y94.051 E64.80726
+G1 X100.000 Y94.000 E64.83662
+G1 X100.783 Y94.051 E64.86599
+G1 X101.553 Y94.204 E64.89536
+G1 X102.296 Y94.457 E64.92472
+G1 X103.000 Y94.804 E64.95409
+G1 X103.653 Y95.240 E64.98346
+G1 X104.243 Y95.757 E65.01283
+G1 X104.760 Y96.347 E65.04219
+G1 X105.196 Y97.000 E65.07156
+G1 X105.543 Y97.704 E65.10093
+G1 X105.796 Y98.447 E65.13029
+G1 X105.949 Y99.217 E65.15966
+G1 X106.000 Y100.000 E65.18903
+G1 E63.18903 F2400
+G1 X109.759 Y81.132 F7800
+G1 E65.18903 F2400
+G1 X118.868 Y90.241 E65.67103 F3600
+G1 E63.67103 F2400
+G1 X120.966 Y96.581 F7800
+G1 E65.67103 F2400
+G1 X103.419 Y79.034 E66.59954 F3600
+G1 E64.59954 F2400
+G1 X98.927 Y78.784 F7800
+G1 E66.59954 F2400
+G1 X121.216 Y101.073 E67.77899 F3600
+G1 E65.77899 F2400
+G1 X120.694 Y104.795 F7800
+G1 E67.77899 F2400
+G1 X95.205 Y79.306 E69.12780 F3600
+G1 E67.12780 F2400
+G1 X91.985 Y80.328 F7800
+G1 E69.12780 F2400
+G1 X119.672 Y108.015 E70.59295 F3600
+G1 E68.59295 F2400
+G1 X118.263 Y110.849 F7800
+G1 E70.59295 F2400
+G1 X106.629 Y99.214 E71.20862 F3600
+G1 E69.20862 F2400
+G1 X100.786 Y93.371 F7800
+G1 E71.20862 F2400
+G1 X89.151 Y81.737 E71.82429 F3600
+G1 E69.82429 F2400
+G1 X86.649 Y83.477 F7800
+G1 E71.82429 F2400
+G1 X97.140 Y93.969 E72.37946 F3600
+G1 E70.37946 F2400
+G1 X106.031 Y102.860 F7800
+G1 E72.37946 F2400
+G1 X116.523 Y113.351 E72.93463 F3600
+G1 E70.93463 F2400
+G1 X114.476 Y115.547 F7800
+G1 E72.93463 F2400
+G1 X104.154 Y105.225 E73.48082 F3600
+G1 E71.48082 F2400
+G1 X94.775 Y95.846 F7800
+G1 E73.48082 F2400
+G1 X84.453 Y85.524 E74.02702 F3600
+G1 E72.02702 F2400
+G1 X82.559 Y87.873 F7800
+G1 E74.02702 F2400
+G1 X93.442 Y98.756 E74.60290 F3600
+G1 E72.60290 F2400
+G1 X101.244 Y106.558 F7800
+G1 E74.60290 F2400
+G1 X112.127 Y117.441 E75.17879 F3600
+G1 E73.17879 F2400
+G1 X109.463 Y119.019 F7800
+G1 E75.17879 F2400
+G1 X80.981 Y90.537 E76.68592 F3600
+G1 E74.68592 F2400
+G1 X79.758 Y93.557 F7800
+G1 E76.68592 F2400
+G1 X106.443 Y120.242 E78.09800 F3600
+G1 E76.09800 F2400
+G1 X102.990 Y121.031 F7800
+G1 E78.09800 F2400
+G1 X78.969 Y97.010 E79.36911 F3600
+G1 E77.36911 F2400
+G1 X78.784 Y101.068 F7800
+G1 E79.36911 F2400
+G1 X98.932 Y121.216 E80.43524 F3600
+G1 E78.43524 F2400
+G1 X93.787 Y120.314 F7800
+G1 E80.43524 F2400
+G1 X79.686 Y106.213 E81.18141 F3600
+;LAYER:3
+G1 Z0.800 F7800
+G1 E79.18141 F2400
+G1 X121.282 Y106.583 F7800
+G1 E81.18141 F2400
+G1 X120.627 Y108.413 E81.25412 F1800
+G1 X119.815 Y110.179 E81.32684
+G1 X118.853 Y111.867 E81.39956
+G1 X117.747 Y113.465 E81.47227
+G1 X116.506 Y114.960 E81.54499
+G1 X115.139 Y116.342 E81.61771
+G1 X113.657 Y117.599 E81.69042
+G1 X112.071 Y118.723 E81.76314
+G1 X110.393 Y119.703 E81.83586
+G1 X108.637 Y120.534 E81.90857
+G1 X106.814 Y121.209 E81.98129
+G1 X104.940 Y121.722 E82.05401
+G1 X103.028 Y122.070 E82.12672
+G1 X101.093 Y122.250 E82.19944
+G1 X99.149 Y122.260 E82.27216
+G1 X97.212 Y122.101 E82.34487
+G1 X95.297 Y121.774 E82.41759
+G1 X93.417 Y121.282 E82.49031
+G1 X91.587 Y120.627 E82.56302
+G1 X89.821 Y119.815 E82.63574
+G1 X88.133 Y118.853 E82.70846
+G1 X86.535 Y117.747 E82.78117
+G1 X85.040 Y116.506 E82.85389
+G1 X83.658 Y115.139 E82.92661
+G1 X82.401 Y113.657 E82.99932
+G1 X81.277 Y112.071 E83.07204
+G1 X80.297 Y110.393 E83.14476
+G1 X79.466 Y108.637 E83.21747
+G1 X78.791 Y106.814 E83.29019
+G1 X78.278 Y104.940 E83.36291
+G1 X77.930 Y103.028 E83.43562
+G1 X77.750 Y101.093 E83.50834
+G1 X77.740 Y99.149 E83.58106
+G1 X77.899 Y97.212 E83.65377
+G1 X78.226 Y95.297 E83.72649
+G1 X78.718 Y93.417 E83.79921
+G1 X79.373 Y91.587 E83.87192
+G1 X80.185 Y89.821 E83.94464
+G1 X81.147 Y88.133 E84.01736
+G1 X82.253 Y86.535 E84.09007
+G1 X83.494 Y85.040 E84.16279
+G1 X84.861 Y83.658 E84.23551
+G1 X86.343 Y82.401 E84.30822
+G1 X87.929 Y81.277 E84.38094
+G1 X89.607 Y80.297 E84.45366
+G1 X91.363 Y79.466 E84.52637
+G1 X93.186 Y78.791 E84.59909
+G1 X95.060 Y78.278 E84.67181
+G1 X96.972 Y77.930 E84.74452
+G1 X98.907 Y77.750 E84.81724
+G1 X100.851 Y77.740 E84.88996
+G1 X102.788 Y77.899 E84.96267
+G1 X104.703 Y78.226 E85.03539
+G1 X106.583 Y78.718 E85.10811
+G1 X108.413 Y79.373 E85.18082
+G1 X110.179 Y80.185 E85.25354
+G1 X111.867 Y81.147 E85.32626
+G1 X113.465 Y82.253 E85.39897
+G1 X114.960 Y83.494 E85.47169
+G1 X116.342 Y84.861 E85.54441
+G1 X117.599 Y86.343 E85.61712
+G1 X118.723 Y87.929 E85.68984
+G1 X119.703 Y89.607 E85.76256
+G1 X120.534 Y91.363 E85.83528
+G1 X121.209 Y93.186 E85.90799
+G1 X121.722 Y95.060 E85.98071
+G1 X122.070 Y96.972 E86.05343
+G1 X122.250 Y98.907 E86.12614
+G1 X122.260 Y100.851 E86.19886
+G1 X122.101 Y102.788 E86.27158
+G1 X121.774 Y104.703 E86.34429
+G1 X121.282 Y106.583 E86.41701
+G1 X121.712 Y106.716 F7800
+G1 X121.044 Y108.583 E86.49119 F1200
+G1 X120.215 Y110.384 E86.56538
+G1 X119.233 Y112.107 E86.63957
+G1 X118.105 Y113.737 E86.71375
+G1 X116.839 Y115.263 E86.78794
+G1 X115.445 Y116.672 E86.86212
+G1 X113.933 Y117.955 E86.93631
+G1 X112.315 Y119.101 E87.01049
+G1 X110.603 Y120.101 E87.08468
+G1 X108.811 Y120.949 E87.15886
+G1 X106.952 Y121.637 E87.23305
+G1 X105.039 Y122.161 E87.30724
+G1 X103.089 Y122.516 E87.38142
+G1 X101.115 Y122.699 E87.45561
+G1 X99.132 Y122.710 E87.52979
+G1 X97.156 Y122.548 E87.60398
+G1 X95.202 Y122.214 E87.67816
+G1 X93.284 Y121.712 E87.75235
+G1 X91.417 Y121.044 E87.82654
+G1 X89.616 Y120.215 E87.90072
+G1 X87.893 Y119.233 E87.97491
+G1 X86.263 Y118.105 E88.04909
+G1 X84.737 Y116.839 E88.12328
+G1 X83.328 Y115.445 E88.19746
+G1 X82.045 Y113.933 E88.27165
+G1 X80.899 Y112.315 E88.34583
+G1 X79.899 Y110.603 E88.42002
+G1 X79.051 Y108.811 E88.49421
+G1 X78.363 Y106.952 E88.56839
+G1 X77.839 Y105.039 E88.64258
+G1 X77.484 Y103.089 E88.71676
+G1 X77.301 Y101.115 E88.79095
+G1 X77.290 Y99.132 E88.86513
+G1 X77.452 Y97.156 E88.93932
+G1 X77.786 Y95.202 E89.01351
+G1 X78.288 Y93.284 E89.08769
+G1 X78.956 Y91.417 E89.16188
+G1 X79.785 Y89.616 E89.23606
+G1 X80.767 Y87.893 E89.31025
+G1 X81.895 Y86.263 E89.38443
+G1 X83.161 Y84.737 E89.45862
+G1 X84.555 Y83.328 E89.53280
+G1 X86.067 Y82.045 E89.60699
+G1 X87.685 Y80.899 E89.68118
+G1 X89.397 Y79.899 E89.75536
+G1 X91.189 Y79.051 E89.82955
+G1 X93.048 Y78.363 E89.90373
+G1 X94.961 Y77.839 E89.97792
+G1 X96.911 Y77.484 E90.05210
+G1 X98.885 Y77.301 E90.12629
+G1 X100.868 Y77.290 E90.20047
+G1 X102.844 Y77.452 E90.27466
+G1 X104.798 Y77.786 E90.34885
+G1 X106.716 Y78.288 E90.42303
+G1 X108.583 Y78.956 E90.49722
+G1 X110.384 Y79.785 E90.57140
+G1 X112.107 Y80.767 E90.64559
+G1 X113.737 Y81.895 E90.71977
+G1 X115.263 Y83.161 E90.79396
+G1 X116.672 Y84.555 E90.86815
+G1 X117.955 Y86.067 E90.94233
+G1 X119.101 Y87.685 E91.01652
+G1 X120.101 Y89.397 E91.09070
+G1 X120.949 Y91.189 E91.16489
+G1 X121.637 Y93.048 E91.23907
+G1 X122.161 Y94.961 E91.31326
+G1 X122.516 Y96.911 E91.38744
+G1 X122.699 Y98.885 E91.46163
+G1 X122.710 Y100.868 E91.53582
+G1 X122.548 Y102.844 E91.61000
+G1 X122.214 Y104.798 E91.68419
+G1 X121.712 Y106.716 E91.75837
+G1 E89.75837 F2400
+G1 X106.450 Y100.000 F7800
+G1 E91.75837 F2400
+G1 X106.395 Y100.842 E91.78994 F1800
+G1 X106.230 Y101.669 E91.82151
+G1 X105.959 Y102.468 E91.85308
+G1 X105.586 Y103.225 E91.88465
+G1 X105.117 Y103.927 E91.91622
+G1 X104.561 Y104.561 E91.94779
+G1 X103.927 Y105.117 E91.97936
+G1 X103.225 Y105.586 E92.01093
+G1 X102.468 Y105.959 E92.04250
+G1 X101.669 Y106.230 E92.07407
+G1 X100.842 Y106.395 E92.10563
+G1 X100.000 Y106.450 E92.13720
+G1 X99.158 Y106.395 E92.16877
+G1 X98.331 Y106.230 E92.20034
+G1 X97.532 Y105.959 E92.23191
+G1 X96.775 Y105.586 E92.26348
+G1 X96.073 Y105.117 E92.29505
+G1 X95.439 Y104.561 E92.32662
+G1 X94.883 Y103.927 E92.35819
+G1 X94.414 Y103.225 E92.38976
+G1 X94.041 Y102.468 E92.42133
+G1 X93.770 Y101.669 E92.45290
+G1 X93.605 Y100.842 E92.48447
+G1 X93.550 Y100.000 E92.51604
+G1 X93.605 Y99.158 E92.54761
+G1 X93.770 Y98.331 E92.57917
+G1 X94.041 Y97.532 E92.61074
+G1 X94.414 Y96.775 E92.64231
+G1 X94.883 Y96.073 E92.67388
+G1 X95.439 Y95.439 E92.70545
+G1 X96.073 Y94.883 E92.73702
+G1 X96.775 Y94.414 E92.76859
+G1 X97.532 Y94.041 E92.80016
+G1 X98.331 Y93.770 E92.83173
+G1 X99.158 Y93.605 E92.86330
+G1 X100.000 Y93.550 E92.89487
+G1 X100.842 Y93.605 E92.92644
+G1 X101.669 Y93.770 E92.95801
+G1 X102.468 Y94.041 E92.98958
+G1 X103.225 Y94.414 E93.02114
+G1 X103.927 Y94.883 E93.05271
+G1 X104.561 Y95.439 E93.08428
+G1 X105.117 Y96.073 E93.11585
+G1 X105.586 Y96.775 E93.14742
+G1 X105.959 Y97.532 E93.17899
+G1 X106.230 Y98.331 E93.21056
+G1 X106.395 Y99.158 E93.24213
+G1 X106.450 Y100.000 E93.27370
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E93.30307 F1200
+G1 X105.796 Y101.553 E93.33243
+G1 X105.543 Y102.296 E93.36180
+G1 X105.196 Y103.000 E93.39117
+G1 X104.760 Y103.653 E93.42053
+G1 X104.243 Y104.243 E93.44990
+G1 X103.653 Y104.760 E93.47927
+G1 X103.000 Y105.196 E93.50863
+G1 X102.296 Y105.543 E93.53800
+G1 X101.553 Y105.796 E93.56737
+G1 X100.783 Y105.949 E93.59673
+G1 X100.000 Y106.000 E93.62610
+G1 X99.217 Y105.949 E93.65547
+G1 X98.447 Y105.796 E93.68483
+G1 X97.704 Y105.543 E93.71420
+G1 X97.000 Y105.196 E93.74357
+G1 X96.347 Y104.760 E93.77293
+G1 X95.757 Y104.243 E93.80230
+G1 X95.240 Y103.653 E93.83167
+G1 X94.804 Y103.000 E93.86103
+G1 X94.457 Y102.296 E93.89040
+G1 X94.204 Y101.553 E93.91977
+G1 X94.051 Y100.783 E93.94913
+G1 X94.000 Y100.000 E93.97850
+G1 X94.051 Y99.217 E94.00787
+G1 X94.204 Y98.447 E94.03723
+G1 X94.457 Y97.704 E94.06660
+G1 X94.804 Y97.000 E94.09597
+G1 X95.240 Y96.347 E94.12534
+G1 X95.757 Y95.757 E94.15470
+G1 X96.347 Y95.240 E94.18407
+G1 X97.000 Y94.804 E94.21344
+G1 X97.704 Y94.457 E94.24280
+G1 X98.447 Y94.204 E94.27217
+G1 X99.217 Y94.051 E94.30154
+G1 X100.000 Y94.000 E94.33090
+G1 X100.783 Y94.051 E94.36027
+G1 X101.553 Y94.204 E94.38964
+G1 X102.296 Y94.457 E94.41900
+G1 X103.000 Y94.804 E94.44837
+G1 X103.653 Y95.240 E94.47774
+G1 X104.243 Y95.757 E94.50710
+G1 X104.760 Y96.347 E94.53647
+G1 X105.196 Y97.000 E94.56584
+G1 X105.543 Y97.704 E94.59520
+G1 X105.796 Y98.447 E94.62457
+G1 X105.949 Y99.217 E94.65394
+G1 X106.000 Y100.000 E94.68330
+G1 E92.68330 F2400
+G1 X80.472 Y89.757 F7800
+G1 E94.68330 F2400
+G1 X89.757 Y80.472 E95.17462 F3600
+G1 E93.17462 F2400
+G1 X96.191 Y78.280 F7800
+G1 E95.17462 F2400
+G1 X78.280 Y96.191 E96.12244 F3600
+G1 E94.12244 F2400
+G1 X77.961 Y100.753 F7800
+G1 E96.12244 F2400
+G1 X100.753 Y77.961 E97.32848 F3600
+G1 E95.32848 F2400
+G1 X104.536 Y78.420 F7800
+G1 E97.32848 F2400
+G1 X78.420 Y104.536 E98.71046 F3600
+G1 E96.71046 F2400
+G1 X79.381 Y107.818 F7800
+G1 E98.71046 F2400
+G1 X107.818 Y79.381 E100.21527 F3600
+G1 E98.21527 F2400
+G1 X110.715 Y80.727 F7800
+G1 E100.21527 F2400
+G1 X97.713 Y93.729 E100.90331 F3600
+G1 E98.90331 F2400
+G1 X93.729 Y97.713 F7800
+G1 E100.90331 F2400
+G1 X80.727 Y110.715 E101.59135 F3600
+G1 E99.59135 F2400
+G1 X82.399 Y113.285 F7800
+G1 E101.59135 F2400
+G1 X93.644 Y102.040 E102.18639 F3600
+G1 E100.18639 F2400
+G1 X102.040 Y93.644 F7800
+G1 E102.18639 F2400
+G1 X113.285 Y82.399 E102.78144 F3600
+G1 E100.78144 F2400
+G1 X115.556 Y84.371 F7800
+G1 E102.78144 F2400
+G1 X104.683 Y95.244 E103.35680 F3600
+G1 E101.35680 F2400
+G1 X95.244 Y104.683 F7800
+G1 E103.35680 F2400
+G1 X84.371 Y115.556 E103.93216 F3600
+G1 E101.93216 F2400
+G1 X86.632 Y117.538 F7800
+G1 E103.93216 F2400
+G1 X97.850 Y106.319 E104.52579 F3600
+G1 E102.52579 F2400
+G1 X106.319 Y97.850 F7800
+G1 E104.52579 F2400
+G1 X117.538 Y86.632 E105.11942 F3600
+G1 E103.11942 F2400
+G1 X119.221 Y89.191 F7800
+G1 E105.11942 F2400
+G1 X106.348 Y102.065 E105.80063 F3600
+G1 E103.80063 F2400
+G1 X102.065 Y106.348 F7800
+G1 E105.80063 F2400
+G1 X89.191 Y119.221 E106.48185 F3600
+G1 E104.48185 F2400
+G1 X92.076 Y120.579 F7800
+G1 E106.48185 F2400
+G1 X120.579 Y92.076 E107.99010 F3600
+G1 E105.99010 F2400
+G1 X121.554 Y95.343 F7800
+G1 E107.99010 F2400
+G1 X95.343 Y121.554 E109.37709 F3600
+G1 E107.37709 F2400
+G1 X99.107 Y122.033 F7800
+G1 E109.37709 F2400
+G1 X122.033 Y99.107 E110.59029 F3600
+G1 E108.59029 F2400
+G1 X121.750 Y103.633 F7800
+G1 E110.59029 F2400
+G1 X103.633 Y121.750 E111.54901 F3600
+G1 E109.54901 F2400
+G1 X109.943 Y119.683 F7800
+G1 E111.54901 F2400
+G1 X119.683 Y109.943 E112.06442 F3600
+;LAYER:4
+G1 Z1.000 F7800
+G1 X121.107 Y108.924 F7800
+G1 X120.249 Y110.729 E112.13922 F1800
+G1 X119.237 Y112.453 E112.21403
+G1 X118.078 Y114.083 E112.28883
+G1 X116.782 Y115.605 E112.36363
+G1 X115.358 Y117.008 E112.43844
+G1 X113.817 Y118.282 E112.51324
+G1 X112.171 Y119.416 E112.58804
+G1 X110.433 Y120.403 E112.66285
+G1 X108.615 Y121.235 E112.73765
+G1 X106.731 Y121.905 E112.81246
+G1 X104.796 Y122.408 E112.88726
+G1 X102.825 Y122.741 E112.96206
+G1 X100.832 Y122.901 E113.03687
+G1 X98.833 Y122.886 E113.11167
+G1 X96.843 Y122.697 E113.18647
+G1 X94.877 Y122.336 E113.26128
+G1 X92.950 Y121.804 E113.33608
+G1 X91.076 Y121.107 E113.41088
+G1 X89.271 Y120.249 E113.48569
+G1 X87.547 Y119.237 E113.56049
+G1 X85.917 Y118.078 E113.63530
+G1 X84.395 Y116.782 E113.71010
+G1 X82.992 Y115.358 E113.78490
+G1 X81.718 Y113.817 E113.85971
+G1 X80.584 Y112.171 E113.93451
+G1 X79.597 Y110.433 E114.00931
+G1 X78.765 Y108.615 E114.08412
+G1 X78.095 Y106.731 E114.15892
+G1 X77.592 Y104.796 E114.23372
+G1 X77.259 Y102.825 E114.30853
+G1 X77.099 Y100.832 E114.38333
+G1 X77.114 Y98.833 E114.45814
+G1 X77.303 Y96.843 E114.53294
+G1 X77.664 Y94.877 E114.60774
+G1 X78.196 Y92.950 E114.68255
+G1 X78.893 Y91.076 E114.75735
+G1 X79.751 Y89.271 E114.83215
+G1 X80.763 Y87.547 E114.90696
+G1 X81.922 Y85.917 E114.98176
+G1 X83.218 Y84.395 E115.05656
+G1 X84.642 Y82.992 E115.13137
+G1 X86.183 Y81.718 E115.20617
+G1 X87.829 Y80.584 E115.28098
+G1 X89.567 Y79.597 E115.35578
+G1 X91.385 Y78.765 E115.43058
+G1 X93.269 Y78.095 E115.50539
+G1 X95.204 Y77.592 E115.58019
+G1 X97.175 Y77.259 E115.65499
+G1 X99.168 Y77.099 E115.72980
+G1 X101.167 Y77.114 E115.80460
+G1 X103.157 Y77.303 E115.87940
+G1 X105.123 Y77.664 E115.95421
+G1 X107.050 Y78.196 E116.02901
+G1 X108.924 Y78.893 E116.10382
+G1 X110.729 Y79.751 E116.17862
+G1 X112.453 Y80.763 E116.25342
+G1 X114.083 Y81.922 E116.32823
+G1 X115.605 Y83.218 E116.40303
+G1 X117.008 Y84.642 E116.47783
+G1 X118.282 Y86.183 E116.55264
+G1 X119.416 Y87.829 E116.62744
+G1 X120.403 Y89.567 E116.70224
+G1 X121.235 Y91.385 E116.77705
+G1 X121.905 Y93.269 E116.85185
+G1 X122.408 Y95.204 E116.92666
+G1 X122.741 Y97.175 E117.00146
+G1 X122.901 Y99.168 E117.07626
+G1 X122.886 Y101.167 E117.15107
+G1 X122.697 Y103.157 E117.22587
+G1 X122.336 Y105.123 E117.30067
+G1 X121.804 Y107.050 E117.37548
+G1 X121.107 Y108.924 E117.45028
+G1 X121.521 Y109.099 F7800
+G1 X120.646 Y110.940 E117.52655 F1200
+G1 X119.614 Y112.698 E117.60283
+G1 X118.433 Y114.359 E117.67910
+G1 X117.111 Y115.911 E117.75537
+G1 X115.660 Y117.342 E117.83164
+G1 X114.089 Y118.641 E117.90792
+G1 X112.410 Y119.798 E117.98419
+G1 X110.638 Y120.804 E118.06046
+G1 X108.784 Y121.652 E118.13673
+G1 X106.863 Y122.335 E118.21301
+G1 X104.891 Y122.848 E118.28928
+G1 X102.881 Y123.188 E118.36555
+G1 X100.849 Y123.350 E118.44182
+G1 X98.810 Y123.336 E118.51810
+G1 X96.781 Y123.143 E118.59437
+G1 X94.776 Y122.774 E118.67064
+G1 X92.811 Y122.233 E118.74691
+G1 X90.901 Y121.521 E118.82319
+G1 X89.060 Y120.646 E118.89946
+G1 X87.302 Y119.614 E118.97573
+G1 X85.641 Y118.433 E119.05200
+G1 X84.089 Y117.111 E119.12828
+G1 X82.658 Y115.660 E119.20455
+G1 X81.359 Y114.089 E119.28082
+G1 X80.202 Y112.410 E119.35709
+G1 X79.196 Y110.638 E119.43337
+G1 X78.348 Y108.784 E119.50964
+G1 X77.665 Y106.863 E119.58591
+G1 X77.152 Y104.891 E119.66218
+G1 X76.812 Y102.881 E119.73846
+G1 X76.650 Y100.849 E119.81473
+G1 X76.664 Y98.810 E119.89100
+G1 X76.857 Y96.781 E119.96727
+G1 X77.226 Y94.776 E120.04355
+G1 X77.767 Y92.811 E120.11982
+G1 X78.479 Y90.901 E120.19609
+G1 X79.354 Y89.060 E120.27237
+G1 X80.386 Y87.302 E120.34864
+G1 X81.567 Y85.641 E120.42491
+G1 X82.889 Y84.089 E120.50118
+G1 X84.340 Y82.658 E120.57746
+G1 X85.911 Y81.359 E120.65373
+G1 X87.590 Y80.202 E120.73000
+G1 X89.362 Y79.196 E120.80627
+G1 X91.216 Y78.348 E120.88255
+G1 X93.137 Y77.665 E120.95882
+G1 X95.109 Y77.152 E121.03509
+G1 X97.119 Y76.812 E121.11136
+G1 X99.151 Y76.650 E121.18764
+G1 X101.190 Y76.664 E121.26391
+G1 X103.219 Y76.857 E121.34018
+G1 X105.224 Y77.226 E121.41645
+G1 X107.189 Y77.767 E121.49273
+G1 X109.099 Y78.479 E121.56900
+G1 X110.940 Y79.354 E121.64527
+G1 X112.698 Y80.386 E121.72154
+G1 X114.359 Y81.567 E121.79782
+G1 X115.911 Y82.889 E121.87409
+G1 X117.342 Y84.340 E121.95036
+G1 X118.641 Y85.911 E122.02663
+G1 X119.798 Y87.590 E122.10291
+G1 X120.804 Y89.362 E122.17918
+G1 X121.652 Y91.216 E122.25545
+G1 X122.335 Y93.137 E122.33172
+G1 X122.848 Y95.109 E122.40800
+G1 X123.188 Y97.119 E122.48427
+G1 X123.350 Y99.151 E122.56054
+G1 X123.336 Y101.190 E122.63681
+G1 X123.143 Y103.219 E122.71309
+G1 X122.774 Y105.224 E122.78936
+G1 X122.233 Y107.189 E122.86563
+G1 X121.521 Y109.099 E122.94190
+G1 E120.94190 F2400
+G1 X106.450 Y100.000 F7800
+G1 E122.94190 F2400
+G1 X106.395 Y100.842 E122.97347 F1800
+G1 X106.230 Y101.669 E123.00504
+G1 X105.959 Y102.468 E123.03661
+G1 X105.586 Y103.225 E123.06818
+G1 X105.117 Y103.927 E123.09975
+G1 X104.561 Y104.561 E123.13132
+G1 X103.927 Y105.117 E123.16289
+G1 X103.225 Y105.586 E123.19446
+G1 X102.468 Y105.959 E123.22603
+G1 X101.669 Y106.230 E123.25760
+G1 X100.842 Y106.395 E123.28917
+G1 X100.000 Y106.450 E123.32074
+G1 X99.158 Y106.395 E123.35231
+G1 X98.331 Y106.230 E123.38387
+G1 X97.532 Y105.959 E123.41544
+G1 X96.775 Y105.586 E123.44701
+G1 X96.073 Y105.117 E123.47858
+G1 X95.439 Y104.561 E123.51015
+G1 X94.883 Y103.927 E123.54172
+G1 X94.414 Y103.225 E123.57329
+G1 X94.041 Y102.468 E123.60486
+G1 X93.770 Y101.669 E123.63643
+G1 X93.605 Y100.842 E123.66800
+G1 X93.550 Y100.000 E123.69957
+G1 X93.605 Y99.158 E123.73114
+G1 X93.770 Y98.331 E123.76271
+G1 X94.041 Y97.532 E123.79428
+G1 X94.414 Y96.775 E123.82584
+G1 X94.883 Y96.073 E123.85741
+G1 X95.439 Y95.439 E123.88898
+G1 X96.073 Y94.883 E123.92055
+G1 X96.775 Y94.414 E123.95212
+G1 X97.532 Y94.041 E123.98369
+G1 X98.331 Y93.770 E124.01526
+G1 X99.158 Y93.605 E124.04683
+G1 X100.000 Y93.550 E124.07840
+G1 X100.842 Y93.605 E124.10997
+G1 X101.669 Y93.770 E124.14154
+G1 X102.468 Y94.041 E124.17311
+G1 X103.225 Y94.414 E124.20468
+G1 X103.927 Y94.883 E124.23625
+G1 X104.561 Y95.439 E124.26781
+G1 X105.117 Y96.073 E124.29938
+G1 X105.586 Y96.775 E124.33095
+G1 X105.959 Y97.532 E124.36252
+G1 X106.230 Y98.331 E124.39409
+G1 X106.395 Y99.158 E124.42566
+G1 X106.450 Y100.000 E124.45723
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E124.48660 F1200
+G1 X105.796 Y101.553 E124.51596
+G1 X105.543 Y102.296 E124.54533
+G1 X105.196 Y103.000 E124.57470
+G1 X104.760 Y103.653 E124.60406
+G1 X104.243 Y104.243 E124.63343
+G1 X103.653 Y104.760 E124.66280
+G1 X103.000 Y105.196 E124.69216
+G1 X102.296 Y105.543 E124.72153
+G1 X101.553 Y105.796 E124.75090
+G1 X100.783 Y105.949 E124.78026
+G1 X100.000 Y106.000 E124.80963
+G1 X99.217 Y105.949 E124.83900
+G1 X98.447 Y105.796 E124.86837
+G1 X97.704 Y105.543 E124.89773
+G1 X97.000 Y105.196 E124.92710
+G1 X96.347 Y104.760 E124.95647
+G1 X95.757 Y104.243 E124.98583
+G1 X95.240 Y103.653 E125.01520
+G1 X94.804 Y103.000 E125.04457
+G1 X94.457 Y102.296 E125.07393
+G1 X94.204 Y101.553 E125.10330
+G1 X94.051 Y100.783 E125.13267
+G1 X94.000 Y100.000 E125.16203
+G1 X94.051 Y99.217 E125.19140
+G1 X94.204 Y98.447 E125.22077
+G1 X94.457 Y97.704 E125.25013
+G1 X94.804 Y97.000 E125.27950
+G1 X95.240 Y96.347 E125.30887
+G1 X95.757 Y95.757 E125.33823
+G1 X96.347 Y95.240 E125.36760
+G1 X97.000 Y94.804 E125.39697
+G1 X97.704 Y94.457 E125.42633
+G1 X98.447 Y94.204 E125.45570
+G1 X99.217 Y94.051 E125.48507
+G1 X100.000 Y94.000 E125.51443
+G1 X100.783 Y94.051 E125.54380
+G1 X101.553 Y94.204 E125.57317
+G1 X102.296 Y94.457 E125.60253
+G1 X103.000 Y94.804 E125.63190
+G1 X103.653 Y95.240 E125.66127
+G1 X104.243 Y95.757 E125.69063
+G1 X104.760 Y96.347 E125.72000
+G1 X105.196 Y97.000 E125.74937
+G1 X105.543 Y97.704 E125.77874
+G1 X105.796 Y98.447 E125.80810
+G1 X105.949 Y99.217 E125.83747
+G1 X106.000 Y100.000 E125.86684
+G1 E123.86684 F2400
+G1 X110.627 Y79.952 F7800
+G1 E125.86684 F2400
+G1 X120.048 Y89.373 E126.36539 F3600
+G1 E124.36539 F2400
+G1 X122.314 Y95.881 F7800
+G1 E126.36539 F2400
+G1 X104.119 Y77.686 E127.32820 F3600
+G1 E125.32820 F2400
+G1 X99.505 Y77.315 F7800
+G1 E127.32820 F2400
+G1 X122.685 Y100.495 E128.55484 F3600
+G1 E126.55484 F2400
+G1 X122.275 Y104.327 F7800
+G1 E128.55484 F2400
+G1 X95.673 Y77.725 E129.96249 F3600
+G1 E127.96249 F2400
+G1 X92.345 Y78.640 F7800
+G1 E129.96249 F2400
+G1 X121.360 Y107.655 E131.49792 F3600
+G1 E129.49792 F2400
+G1 X120.063 Y110.600 F7800
+G1 E131.49792 F2400
+G1 X89.400 Y79.937 E133.12050 F3600
+G1 E131.12050 F2400
+G1 X86.779 Y81.559 F7800
+G1 E133.12050 F2400
+G1 X98.677 Y93.457 E133.75012 F3600
+G1 E131.75012 F2400
+G1 X106.543 Y101.323 F7800
+G1 E133.75012 F2400
+G1 X118.441 Y113.221 E134.37975 F3600
+G1 E132.37975 F2400
+G1 X116.526 Y115.549 F7800
+G1 E134.37975 F2400
+G1 X105.183 Y104.206 E134.97997 F3600
+G1 E132.97997 F2400
+G1 X95.794 Y94.817 F7800
+G1 E134.97997 F2400
+G1 X84.451 Y83.474 E135.58020 F3600
+G1 E133.58020 F2400
+G1 X82.406 Y85.671 F7800
+G1 E135.58020 F2400
+G1 X93.939 Y97.204 E136.19049 F3600
+G1 E134.19049 F2400
+G1 X102.796 Y106.061 F7800
+G1 E136.19049 F2400
+G1 X114.329 Y117.594 E136.80078 F3600
+G1 E134.80078 F2400
+G1 X111.845 Y119.354 F7800
+G1 E136.80078 F2400
+G1 X99.107 Y106.615 E137.47486 F3600
+G1 E135.47486 F2400
+G1 X93.385 Y100.893 F7800
+G1 E137.47486 F2400
+G1 X80.646 Y88.155 E138.14895 F3600
+G1 E136.14895 F2400
+G1 X79.194 Y90.945 F7800
+G1 E138.14895 F2400
+G1 X109.055 Y120.806 E139.72908 F3600
+G1 E137.72908 F2400
+G1 X105.913 Y121.907 F7800
+G1 E139.72908 F2400
+G1 X78.093 Y94.087 E141.20123 F3600
+G1 E139.20123 F2400
+G1 X77.430 Y97.666 F7800
+G1 E141.20123 F2400
+G1 X102.334 Y122.570 E142.51910 F3600
+G1 E140.51910 F2400
+G1 X98.135 Y122.614 F7800
+G1 E142.51910 F2400
+G1 X77.386 Y101.865 E143.61710 F3600
+G1 E141.61710 F2400
+G1 X78.483 Y107.205 F7800
+G1 E143.61710 F2400
+G1 X92.795 Y121.517 E144.37443 F3600
+;LAYER:5
+G1 Z1.200 F7800
+G1 E142.37443 F2400
+G1 X120.488 Y111.193 F7800
+G1 E144.37443 F2400
+G1 X119.435 Y112.936 E144.45064 F1800
+G1 X118.233 Y114.580 E144.52685
+G1 X116.893 Y116.114 E144.60306
+G1 X115.424 Y117.525 E144.67926
+G1 X113.838 Y118.803 E144.75547
+G1 X112.147 Y119.937 E144.83168
+G1 X110.363 Y120.920 E144.90789
+G1 X108.500 Y121.743 E144.98409
+G1 X106.573 Y122.402 E145.06030
+G1 X104.595 Y122.889 E145.13651
+G1 X102.583 Y123.203 E145.21272
+G1 X100.551 Y123.339 E145.28892
+G1 X98.515 Y123.299 E145.36513
+G1 X96.490 Y123.081 E145.44134
+G1 X94.491 Y122.687 E145.51755
+G1 X92.535 Y122.120 E145.59375
+G1 X90.636 Y121.386 E145.66996
+G1 X88.807 Y120.488 E145.74617
+G1 X87.064 Y119.435 E145.82238
+G1 X85.420 Y118.233 E145.89858
+G1 X83.886 Y116.893 E145.97479
+G1 X82.475 Y115.424 E146.05100
+G1 X81.197 Y113.838 E146.12721
+G1 X80.063 Y112.147 E146.20341
+G1 X79.080 Y110.363 E146.27962
+G1 X78.257 Y108.500 E146.35583
+G1 X77.598 Y106.573 E146.43204
+G1 X77.111 Y104.595 E146.50824
+G1 X76.797 Y102.583 E146.58445
+G1 X76.661 Y100.551 E146.66066
+G1 X76.701 Y98.515 E146.73687
+G1 X76.919 Y96.490 E146.81307
+G1 X77.313 Y94.491 E146.88928
+G1 X77.880 Y92.535 E146.96549
+G1 X78.614 Y90.636 E147.04170
+G1 X79.512 Y88.807 E147.11790
+G1 X80.565 Y87.064 E147.19411
+G1 X81.767 Y85.420 E147.27032
+G1 X83.107 Y83.886 E147.34653
+G1 X84.576 Y82.475 E147.42273
+G1 X86.162 Y81.197 E147.49894
+G1 X87.853 Y80.063 E147.57515
+G1 X89.637 Y79.080 E147.65135
+G1 X91.500 Y78.257 E147.72756
+G1 X93.427 Y77.598 E147.80377
+G1 X95.405 Y77.111 E147.87998
+G1 X97.417 Y76.797 E147.95618
+G1 X99.449 Y76.661 E148.03239
+G1 X101.485 Y76.701 E148.10860
+G1 X103.510 Y76.919 E148.18481
+G1 X105.509 Y77.313 E148.26101
+G1 X107.465 Y77.880 E148.33722
+G1 X109.364 Y78.614 E148.41343
+G1 X111.193 Y79.512 E148.48964
+G1 X112.936 Y80.565 E148.56584
+G1 X114.580 Y81.767 E148.64205
+G1 X116.114 Y83.107 E148.71826
+G1 X117.525 Y84.576 E148.79447
+G1 X118.803 Y86.162 E148.87067
+G1 X119.937 Y87.853 E148.94688
+G1 X120.920 Y89.637 E149.02309
+G1 X121.743 Y91.500 E149.09930
+G1 X122.402 Y93.427 E149.17550
+G1 X122.889 Y95.405 E149.25171
+G1 X123.203 Y97.417 E149.32792
+G1 X123.339 Y99.449 E149.40413
+G1 X123.299 Y101.485 E149.48033
+G1 X123.081 Y103.510 E149.55654
+G1 X122.687 Y105.509 E149.63275
+G1 X122.120 Y107.465 E149.70896
+G1 X121.386 Y109.364 E149.78516
+G1 X120.488 Y111.193 E149.86137
+G1 X120.883 Y111.408 F7800
+G1 X119.809 Y113.185 E149.93905 F1200
+G1 X118.585 Y114.861 E150.01672
+G1 X117.219 Y116.425 E150.09440
+G1 X115.722 Y117.863 E150.17208
+G1 X114.105 Y119.165 E150.24975
+G1 X112.381 Y120.321 E150.32743
+G1 X110.563 Y121.323 E150.40511
+G1 X108.664 Y122.163 E150.48278
+G1 X106.699 Y122.833 E150.56046
+G1 X104.684 Y123.330 E150.63813
+G1 X102.633 Y123.650 E150.71581
+G1 X100.562 Y123.789 E150.79349
+G1 X98.486 Y123.748 E150.87116
+G1 X96.422 Y123.525 E150.94884
+G1 X94.385 Y123.124 E151.02652
+G1 X92.391 Y122.547 E151.10419
+G1 X90.455 Y121.798 E151.18187
+G1 X88.592 Y120.883 E151.25955
+G1 X86.815 Y119.809 E151.33722
+G1 X85.139 Y118.585 E151.41490
+G1 X83.575 Y117.219 E151.49257
+G1 X82.137 Y115.722 E151.57025
+G1 X80.835 Y114.105 E151.64793
+G1 X79.679 Y112.381 E151.72560
+G1 X78.677 Y110.563 E151.80328
+G1 X77.837 Y108.664 E151.88096
+G1 X77.167 Y106.699 E151.95863
+G1 X76.670 Y104.684 E152.03631
+G1 X76.350 Y102.633 E152.11399
+G1 X76.211 Y100.562 E152.19166
+G1 X76.252 Y98.486 E152.26934
+G1 X76.475 Y96.422 E152.34701
+G1 X76.876 Y94.385 E152.42469
+G1 X77.453 Y92.391 E152.50237
+G1 X78.202 Y90.455 E152.58004
+G1 X79.117 Y88.592 E152.65772
+G1 X80.191 Y86.815 E152.73540
+G1 X81.415 Y85.139 E152.81307
+G1 X82.781 Y83.575 E152.89075
+G1 X84.278 Y82.137 E152.96843
+G1 X85.895 Y80.835 E153.04610
+G1 X87.619 Y79.679 E153.12378
+G1 X89.437 Y78.677 E153.20145
+G1 X91.336 Y77.837 E153.27913
+G1 X93.301 Y77.167 E153.35681
+G1 X95.316 Y76.670 E153.43448
+G1 X97.367 Y76.350 E153.51216
+G1 X99.438 Y76.211 E153.58984
+G1 X101.514 Y76.252 E153.66751
+G1 X103.578 Y76.475 E153.74519
+G1 X105.615 Y76.876 E153.82287
+G1 X107.609 Y77.453 E153.90054
+G1 X109.545 Y78.202 E153.97822
+G1 X111.408 Y79.117 E154.05589
+G1 X113.185 Y80.191 E154.13357
+G1 X114.861 Y81.415 E154.21125
+G1 X116.425 Y82.781 E154.28892
+G1 X117.863 Y84.278 E154.36660
+G1 X119.165 Y85.895 E154.44428
+G1 X120.321 Y87.619 E154.52195
+G1 X121.323 Y89.437 E154.59963
+G1 X122.163 Y91.336 E154.67731
+G1 X122.833 Y93.301 E154.75498
+G1 X123.330 Y95.316 E154.83266
+G1 X123.650 Y97.367 E154.91034
+G1 X123.789 Y99.438 E154.98801
+G1 X123.748 Y101.514 E155.06569
+G1 X123.525 Y103.578 E155.14336
+G1 X123.124 Y105.615 E155.22104
+G1 X122.547 Y107.609 E155.29872
+G1 X121.798 Y109.545 E155.37639
+G1 X120.883 Y111.408 E155.45407
+G1 E153.45407 F2400
+G1 X106.450 Y100.000 F7800
+G1 E155.45407 F2400
+G1 X106.395 Y100.842 E155.48564 F1800
+G1 X106.230 Y101.669 E155.51721
+G1 X105.959 Y102.468 E155.54878
+G1 X105.586 Y103.225 E155.58035
+G1 X105.117 Y103.927 E155.61192
+G1 X104.561 Y104.561 E155.64349
+G1 X103.927 Y105.117 E155.67505
+G1 X103.225 Y105.586 E155.70662
+G1 X102.468 Y105.959 E155.73819
+G1 X101.669 Y106.230 E155.76976
+G1 X100.842 Y106.395 E155.80133
+G1 X100.000 Y106.450 E155.83290
+G1 X99.158 Y106.395 E155.86447
+G1 X98.331 Y106.230 E155.89604
+G1 X97.532 Y105.959 E155.92761
+G1 X96.775 Y105.586 E155.95918
+G1 X96.073 Y105.117 E155.99075
+G1 X95.439 Y104.561 E156.02232
+G1 X94.883 Y103.927 E156.05389
+G1 X94.414 Y103.225 E156.08546
+G1 X94.041 Y102.468 E156.11702
+G1 X93.770 Y101.669 E156.14859
+G1 X93.605 Y100.842 E156.18016
+G1 X93.550 Y100.000 E156.21173
+G1 X93.605 Y99.158 E156.24330
+G1 X93.770 Y98.331 E156.27487
+G1 X94.041 Y97.532 E156.30644
+G1 X94.414 Y96.775 E156.33801
+G1 X94.883 Y96.073 E156.36958
+G1 X95.439 Y95.439 E156.40115
+G1 X96.073 Y94.883 E156.43272
+G1 X96.775 Y94.414 E156.46429
+G1 X97.532 Y94.041 E156.49586
+G1 X98.331 Y93.770 E156.52743
+G1 X99.158 Y93.605 E156.55899
+G1 X100.000 Y93.550 E156.59056
+G1 X100.842 Y93.605 E156.62213
+G1 X101.669 Y93.770 E156.65370
+G1 X102.468 Y94.041 E156.68527
+G1 X103.225 Y94.414 E156.71684
+G1 X103.927 Y94.883 E156.74841
+G1 X104.561 Y95.439 E156.77998
+G1 X105.117 Y96.073 E156.81155
+G1 X105.586 Y96.775 E156.84312
+G1 X105.959 Y97.532 E156.87469
+G1 X106.230 Y98.331 E156.90626
+G1 X106.395 Y99.158 E156.93783
+G1 X106.450 Y100.000 E156.96940
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E156.99876 F1200
+G1 X105.796 Y101.553 E157.02813
+G1 X105.543 Y102.296 E157.05750
+G1 X105.196 Y103.000 E157.08686
+G1 X104.760 Y103.653 E157.11623
+G1 X104.243 Y104.243 E157.14560
+G1 X103.653 Y104.760 E157.17496
+G1 X103.000 Y105.196 E157.20433
+G1 X102.296 Y105.543 E157.23370
+G1 X101.553 Y105.796 E157.26306
+G1 X100.783 Y105.949 E157.29243
+G1 X100.000 Y106.000 E157.32180
+G1 X99.217 Y105.949 E157.35116
+G1 X98.447 Y105.796 E157.38053
+G1 X97.704 Y105.543 E157.40990
+G1 X97.000 Y105.196 E157.43926
+G1 X96.347 Y104.760 E157.46863
+G1 X95.757 Y104.243 E157.49800
+G1 X95.240 Y103.653 E157.52736
+G1 X94.804 Y103.000 E157.55673
+G1 X94.457 Y102.296 E157.58610
+G1 X94.204 Y101.553 E157.61546
+G1 X94.051 Y100.783 E157.64483
+G1 X94.000 Y100.000 E157.67420
+G1 X94.051 Y99.217 E157.70356
+G1 X94.204 Y98.447 E157.73293
+G1 X94.457 Y97.704 E157.76230
+G1 X94.804 Y97.000 E157.79167
+G1 X95.240 Y96.347 E157.82103
+G1 X95.757 Y95.757 E157.85040
+G1 X96.347 Y95.240 E157.87977
+G1 X97.000 Y94.804 E157.90913
+G1 X97.704 Y94.457 E157.93850
+G1 X98.447 Y94.204 E157.96787
+G1 X99.217 Y94.051 E157.99723
+G1 X100.000 Y94.000 E158.02660
+G1 X100.783 Y94.051 E158.05597
+G1 X101.553 Y94.204 E158.08533
+G1 X102.296 Y94.457 E158.11470
+G1 X103.000 Y94.804 E158.14407
+G1 X103.653 Y95.240 E158.17343
+G1 X104.243 Y95.757 E158.20280
+G1 X104.760 Y96.347 E158.23217
+G1 X105.196 Y97.000 E158.26153
+G1 X105.543 Y97.704 E158.29090
+G1 X105.796 Y98.447 E158.32027
+G1 X105.949 Y99.217 E158.34963
+G1 X106.000 Y100.000 E158.37900
+G1 E156.37900 F2400
+G1 X79.602 Y89.114 F7800
+G1 E158.37900 F2400
+G1 X89.114 Y79.602 E158.88236 F3600
+G1 E156.88236 F2400
+G1 X95.671 Y77.288 F7800
+G1 E158.88236 F2400
+G1 X77.288 Y95.671 E159.85512 F3600
+G1 E157.85512 F2400
+G1 X76.881 Y100.320 F7800
+G1 E159.85512 F2400
+G1 X100.320 Y76.881 E161.09543 F3600
+G1 E159.09543 F2400
+G1 X104.183 Y77.261 F7800
+G1 E161.09543 F2400
+G1 X77.261 Y104.183 E162.52010 F3600
+G1 E160.52010 F2400
+G1 X78.144 Y107.543 F7800
+G1 E162.52010 F2400
+G1 X107.543 Y78.144 E164.07578 F3600
+G1 E162.07578 F2400
+G1 X110.519 Y79.410 F7800
+G1 E164.07578 F2400
+G1 X79.410 Y110.519 E165.72193 F3600
+G1 E163.72193 F2400
+G1 X80.999 Y113.173 F7800
+G1 E165.72193 F2400
+G1 X93.373 Y100.799 E166.37673 F3600
+G1 E164.37673 F2400
+G1 X100.799 Y93.373 F7800
+G1 E166.37673 F2400
+G1 X113.173 Y80.999 E167.03153 F3600
+G1 E165.03153 F2400
+G1 X115.537 Y82.878 F7800
+G1 E167.03153 F2400
+G1 X103.860 Y94.554 E167.64943 F3600
+G1 E165.64943 F2400
+G1 X94.554 Y103.860 F7800
+G1 E167.64943 F2400
+G1 X82.878 Y115.537 E168.26732 F3600
+G1 E166.26732 F2400
+G1 X85.034 Y117.624 F7800
+G1 E168.26732 F2400
+G1 X96.800 Y105.858 E168.88993 F3600
+G1 E166.88993 F2400
+G1 X105.858 Y96.800 F7800
+G1 E168.88993 F2400
+G1 X117.624 Y85.034 E169.51254 F3600
+G1 E167.51254 F2400
+G1 X119.431 Y87.469 F7800
+G1 E169.51254 F2400
+G1 X106.671 Y100.229 E170.18774 F3600
+G1 E168.18774 F2400
+G1 X100.229 Y106.671 F7800
+G1 E170.18774 F2400
+G1 X87.469 Y119.431 E170.86294 F3600
+G1 E168.86294 F2400
+G1 X90.201 Y120.942 F7800
+G1 E170.86294 F2400
+G1 X120.942 Y90.201 E172.48964 F3600
+G1 E170.48964 F2400
+G1 X122.119 Y93.267 F7800
+G1 E172.48964 F2400
+G1 X93.267 Y122.119 E174.01640 F3600
+G1 E172.01640 F2400
+G1 X96.738 Y122.890 F7800
+G1 E174.01640 F2400
+G1 X122.890 Y96.738 E175.40024 F3600
+G1 E173.40024 F2400
+G1 X123.108 Y100.762 F7800
+G1 E175.40024 F2400
+G1 X100.762 Y123.108 E176.58272 F3600
+G1 E174.58272 F2400
+G1 X105.708 Y122.405 F7800
+G1 E176.58272 F2400
+G1 X122.405 Y105.708 E177.46629 F3600
+;LAYER:6
+G1 Z1.400 F7800
+G1 E175.46629 F2400
+G1 X119.428 Y113.292 F7800
+G1 E177.46629 F2400
+G1 X118.196 Y114.934 E177.54313 F1800
+G1 X116.825 Y116.463 E177.61997
+G1 X115.326 Y117.867 E177.69681
+G1 X113.711 Y119.135 E177.77365
+G1 X111.991 Y120.257 E177.85049
+G1 X110.180 Y121.225 E177.92733
+G1 X108.291 Y122.032 E178.00418
+G1 X106.339 Y122.670 E178.08102
+G1 X104.339 Y123.137 E178.15786
+G1 X102.306 Y123.427 E178.23470
+G1 X100.256 Y123.539 E178.31154
+G1 X98.203 Y123.471 E178.38838
+G1 X96.164 Y123.225 E178.46522
+G1 X94.155 Y122.803 E178.54206
+G1 X92.190 Y122.207 E178.61890
+G1 X90.284 Y121.441 E178.69574
+G1 X88.452 Y120.513 E178.77258
+G1 X86.708 Y119.428 E178.84943
+G1 X85.066 Y118.196 E178.92627
+G1 X83.537 Y116.825 E179.00311
+G1 X82.133 Y115.326 E179.07995
+G1 X80.865 Y113.711 E179.15679
+G1 X79.743 Y111.991 E179.23363
+G1 X78.775 Y110.180 E179.31047
+G1 X77.968 Y108.291 E179.38731
+G1 X77.330 Y106.339 E179.46415
+G1 X76.863 Y104.339 E179.54099
+G1 X76.573 Y102.306 E179.61783
+G1 X76.461 Y100.256 E179.69467
+G1 X76.529 Y98.203 E179.77152
+G1 X76.775 Y96.164 E179.84836
+G1 X77.197 Y94.155 E179.92520
+G1 X77.793 Y92.190 E180.00204
+G1 X78.559 Y90.284 E180.07888
+G1 X79.487 Y88.452 E180.15572
+G1 X80.572 Y86.708 E180.23256
+G1 X81.804 Y85.066 E180.30940
+G1 X83.175 Y83.537 E180.38624
+G1 X84.674 Y82.133 E180.46308
+G1 X86.289 Y80.865 E180.53992
+G1 X88.009 Y79.743 E180.61676
+G1 X89.820 Y78.775 E180.69361
+G1 X91.709 Y77.968 E180.77045
+G1 X93.661 Y77.330 E180.84729
+G1 X95.661 Y76.863 E180.92413
+G1 X97.694 Y76.573 E181.00097
+G1 X99.744 Y76.461 E181.07781
+G1 X101.797 Y76.529 E181.15465
+G1 X103.836 Y76.775 E181.23149
+G1 X105.845 Y77.197 E181.30833
+G1 X107.810 Y77.793 E181.38517
+G1 X109.716 Y78.559 E181.46201
+G1 X111.548 Y79.487 E181.53885
+G1 X113.292 Y80.572 E181.61570
+G1 X114.934 Y81.804 E181.69254
+G1 X116.463 Y83.175 E181.76938
+G1 X117.867 Y84.674 E181.84622
+G1 X119.135 Y86.289 E181.92306
+G1 X120.257 Y88.009 E181.99990
+G1 X121.225 Y89.820 E182.07674
+G1 X122.032 Y91.709 E182.15358
+G1 X122.670 Y93.661 E182.23042
+G1 X123.137 Y95.661 E182.30726
+G1 X123.427 Y97.694 E182.38410
+G1 X123.539 Y99.744 E182.46095
+G1 X123.471 Y101.797 E182.53779
+G1 X123.225 Y103.836 E182.61463
+G1 X122.803 Y105.845 E182.69147
+G1 X122.207 Y107.810 E182.76831
+G1 X121.441 Y109.716 E182.84515
+G1 X120.513 Y111.548 E182.92199
+G1 X119.428 Y113.292 E182.99883
+G1 X119.800 Y113.546 F7800
+G1 X118.544 Y115.220 E183.07714 F1200
+G1 X117.147 Y116.778 E183.15545
+G1 X115.619 Y118.209 E183.23376
+G1 X113.973 Y119.501 E183.31207
+G1 X112.220 Y120.644 E183.39038
+G1 X110.374 Y121.631 E183.46869
+G1 X108.450 Y122.453 E183.54700
+G1 X106.460 Y123.104 E183.62531
+G1 X104.422 Y123.579 E183.70362
+G1 X102.350 Y123.875 E183.78193
+G1 X100.261 Y123.989 E183.86024
+G1 X98.169 Y123.920 E183.93855
+G1 X96.091 Y123.669 E184.01686
+G1 X94.043 Y123.239 E184.09517
+G1 X92.040 Y122.631 E184.17348
+G1 X90.098 Y121.851 E184.25179
+G1 X88.231 Y120.905 E184.33010
+G1 X86.454 Y119.800 E184.40841
+G1 X84.780 Y118.544 E184.48672
+G1 X83.222 Y117.147 E184.56503
+G1 X81.791 Y115.619 E184.64334
+G1 X80.499 Y113.973 E184.72165
+G1 X79.356 Y112.220 E184.79996
+G1 X78.369 Y110.374 E184.87827
+G1 X77.547 Y108.450 E184.95658
+G1 X76.896 Y106.460 E185.03489
+G1 X76.421 Y104.422 E185.11320
+G1 X76.125 Y102.350 E185.19150
+G1 X76.011 Y100.261 E185.26981
+G1 X76.080 Y98.169 E185.34812
+G1 X76.331 Y96.091 E185.42643
+G1 X76.761 Y94.043 E185.50474
+G1 X77.369 Y92.040 E185.58305
+G1 X78.149 Y90.098 E185.66136
+G1 X79.095 Y88.231 E185.73967
+G1 X80.200 Y86.454 E185.81798
+G1 X81.456 Y84.780 E185.89629
+G1 X82.853 Y83.222 E185.97460
+G1 X84.381 Y81.791 E186.05291
+G1 X86.027 Y80.499 E186.13122
+G1 X87.780 Y79.356 E186.20953
+G1 X89.626 Y78.369 E186.28784
+G1 X91.550 Y77.547 E186.36615
+G1 X93.540 Y76.896 E186.44446
+G1 X95.578 Y76.421 E186.52277
+G1 X97.650 Y76.125 E186.60108
+G1 X99.739 Y76.011 E186.67939
+G1 X101.831 Y76.080 E186.75770
+G1 X103.909 Y76.331 E186.83601
+G1 X105.957 Y76.761 E186.91432
+G1 X107.960 Y77.369 E186.99263
+G1 X109.902 Y78.149 E187.07094
+G1 X111.769 Y79.095 E187.14925
+G1 X113.546 Y80.200 E187.22756
+G1 X115.220 Y81.456 E187.30587
+G1 X116.778 Y82.853 E187.38418
+G1 X118.209 Y84.381 E187.46249
+G1 X119.501 Y86.027 E187.54080
+G1 X120.644 Y87.780 E187.61911
+G1 X121.631 Y89.626 E187.69742
+G1 X122.453 Y91.550 E187.77573
+G1 X123.104 Y93.540 E187.85404
+G1 X123.579 Y95.578 E187.93235
+G1 X123.875 Y97.650 E188.01066
+G1 X123.989 Y99.739 E188.08897
+G1 X123.920 Y101.831 E188.16728
+G1 X123.669 Y103.909 E188.24559
+G1 X123.239 Y105.957 E188.32390
+G1 X122.631 Y107.960 E188.40221
+G1 X121.851 Y109.902 E188.48052
+G1 X120.905 Y111.769 E188.55883
+G1 X119.800 Y113.546 E188.63713
+G1 E186.63713 F2400
+G1 X106.450 Y100.000 F7800
+G1 E188.63713 F2400
+G1 X106.395 Y100.842 E188.66870 F1800
+G1 X106.230 Y101.669 E188.70027
+G1 X105.959 Y102.468 E188.73184
+G1 X105.586 Y103.225 E188.76341
+G1 X105.117 Y103.927 E188.79498
+G1 X104.561 Y104.561 E188.82655
+G1 X103.927 Y105.117 E188.85812
+G1 X103.225 Y105.586 E188.88969
+G1 X102.468 Y105.959 E188.92126
+G1 X101.669 Y106.230 E188.95283
+G1 X100.842 Y106.395 E188.98440
+G1 X100.000 Y106.450 E189.01597
+G1 X99.158 Y106.395 E189.04754
+G1 X98.331 Y106.230 E189.07910
+G1 X97.532 Y105.959 E189.11067
+G1 X96.775 Y105.586 E189.14224
+G1 X96.073 Y105.117 E189.17381
+G1 X95.439 Y104.561 E189.20538
+G1 X94.883 Y103.927 E189.23695
+G1 X94.414 Y103.225 E189.26852
+G1 X94.041 Y102.468 E189.30009
+G1 X93.770 Y101.669 E189.33166
+G1 X93.605 Y100.842 E189.36323
+G1 X93.550 Y100.000 E189.39480
+G1 X93.605 Y99.158 E189.42637
+G1 X93.770 Y98.331 E189.45794
+G1 X94.041 Y97.532 E189.48951
+G1 X94.414 Y96.775 E189.52107
+G1 X94.883 Y96.073 E189.55264
+G1 X95.439 Y95.439 E189.58421
+G1 X96.073 Y94.883 E189.61578
+G1 X96.775 Y94.414 E189.64735
+G1 X97.532 Y94.041 E189.67892
+G1 X98.331 Y93.770 E189.71049
+G1 X99.158 Y93.605 E189.74206
+G1 X100.000 Y93.550 E189.77363
+G1 X100.842 Y93.605 E189.80520
+G1 X101.669 Y93.770 E189.83677
+G1 X102.468 Y94.041 E189.86834
+G1 X103.225 Y94.414 E189.89991
+G1 X103.927 Y94.883 E189.93148
+G1 X104.561 Y95.439 E189.96304
+G1 X105.117 Y96.073 E189.99461
+G1 X105.586 Y96.775 E190.02618
+G1 X105.959 Y97.532 E190.05775
+G1 X106.230 Y98.331 E190.08932
+G1 X106.395 Y99.158 E190.12089
+G1 X106.450 Y100.000 E190.15246
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E190.18183 F1200
+G1 X105.796 Y101.553 E190.21119
+G1 X105.543 Y102.296 E190.24056
+G1 X105.196 Y103.000 E190.26993
+G1 X104.760 Y103.653 E190.29929
+G1 X104.243 Y104.243 E190.32866
+G1 X103.653 Y104.760 E190.35803
+G1 X103.000 Y105.196 E190.38739
+G1 X102.296 Y105.543 E190.41676
+G1 X101.553 Y105.796 E190.44613
+G1 X100.783 Y105.949 E190.47550
+G1 X100.000 Y106.000 E190.50486
+G1 X99.217 Y105.949 E190.53423
+G1 X98.447 Y105.796 E190.56360
+G1 X97.704 Y105.543 E190.59296
+G1 X97.000 Y105.196 E190.62233
+G1 X96.347 Y104.760 E190.65170
+G1 X95.757 Y104.243 E190.68106
+G1 X95.240 Y103.653 E190.71043
+G1 X94.804 Y103.000 E190.73980
+G1 X94.457 Y102.296 E190.76916
+G1 X94.204 Y101.553 E190.79853
+G1 X94.051 Y100.783 E190.82790
+G1 X94.000 Y100.000 E190.85726
+G1 X94.051 Y99.217 E190.88663
+G1 X94.204 Y98.447 E190.91600
+G1 X94.457 Y97.704 E190.94536
+G1 X94.804 Y97.000 E190.97473
+G1 X95.240 Y96.347 E191.00410
+G1 X95.757 Y95.757 E191.03346
+G1 X96.347 Y95.240 E191.06283
+G1 X97.000 Y94.804 E191.09220
+G1 X97.704 Y94.457 E191.12156
+G1 X98.447 Y94.204 E191.15093
+G1 X99.217 Y94.051 E191.18030
+G1 X100.000 Y94.000 E191.20966
+G1 X100.783 Y94.051 E191.23903
+G1 X101.553 Y94.204 E191.26840
+G1 X102.296 Y94.457 E191.29777
+G1 X103.000 Y94.804 E191.32713
+G1 X103.653 Y95.240 E191.35650
+G1 X104.243 Y95.757 E191.38587
+G1 X104.760 Y96.347 E191.41523
+G1 X105.196 Y97.000 E191.44460
+G1 X105.543 Y97.704 E191.47397
+G1 X105.796 Y98.447 E191.50333
+G1 X105.949 Y99.217 E191.53270
+G1 X106.000 Y100.000 E191.56207
+G1 E189.56207 F2400
+G1 X111.003 Y79.444 F7800
+G1 E191.56207 F2400
+G1 X120.556 Y88.997 E192.06758 F3600
+G1 E190.06758 F2400
+G1 X122.891 Y95.576 F7800
+G1 E192.06758 F2400
+G1 X104.424 Y77.109 E193.04480 F3600
+G1 E191.04480 F2400
+G1 X99.759 Y76.686 F7800
+G1 E193.04480 F2400
+G1 X123.314 Y100.241 E194.29123 F3600
+G1 E192.29123 F2400
+G1 X122.948 Y104.118 F7800
+G1 E194.29123 F2400
+G1 X95.882 Y77.052 E195.72350 F3600
+G1 E193.72350 F2400
+G1 X92.509 Y77.921 F7800
+G1 E195.72350 F2400
+G1 X122.079 Y107.491 E197.28824 F3600
+G1 E195.28824 F2400
+G1 X120.826 Y110.481 F7800
+G1 E197.28824 F2400
+G1 X89.519 Y79.174 E198.94492 F3600
+G1 E196.94492 F2400
+G1 X86.850 Y80.747 F7800
+G1 E198.94492 F2400
+G1 X99.450 Y93.348 E199.61168 F3600
+G1 E197.61168 F2400
+G1 X106.652 Y100.550 F7800
+G1 E199.61168 F2400
+G1 X119.253 Y113.150 E200.27844 F3600
+G1 E198.27844 F2400
+G1 X117.390 Y115.530 F7800
+G1 E200.27844 F2400
+G1 X105.557 Y103.698 E200.90458 F3600
+G1 E198.90458 F2400
+G1 X96.302 Y94.443 F7800
+G1 E200.90458 F2400
+G1 X84.470 Y82.610 E201.53071 F3600
+G1 E199.53071 F2400
+G1 X82.365 Y84.748 F7800
+G1 E201.53071 F2400
+G1 X94.241 Y96.624 E202.15915 F3600
+G1 E200.15915 F2400
+G1 X103.376 Y105.759 F7800
+G1 E202.15915 F2400
+G1 X115.252 Y117.635 E202.78759 F3600
+G1 E200.78759 F2400
+G1 X112.837 Y119.463 F7800
+G1 E202.78759 F2400
+G1 X100.049 Y106.675 E203.46428 F3600
+G1 E201.46428 F2400
+G1 X93.325 Y99.951 F7800
+G1 E203.46428 F2400
+G1 X80.537 Y87.163 E204.14097 F3600
+G1 E202.14097 F2400
+G1 X79.001 Y89.869 F7800
+G1 E204.14097 F2400
+G1 X110.131 Y120.999 E205.78824 F3600
+G1 E203.78824 F2400
+G1 X107.098 Y122.208 F7800
+G1 E205.78824 F2400
+G1 X77.792 Y92.902 E207.33901 F3600
+G1 E205.33901 F2400
+G1 X76.976 Y96.329 F7800
+G1 E207.33901 F2400
+G1 X103.671 Y123.024 E208.75161 F3600
+G1 E206.75161 F2400
+G1 X99.717 Y123.313 F7800
+G1 E208.75161 F2400
+G1 X76.687 Y100.283 E209.97030 F3600
+G1 E207.97030 F2400
+G1 X77.246 Y105.085 F7800
+G1 E209.97030 F2400
+G1 X94.915 Y122.754 E210.90526 F3600
+;LAYER:7
+G1 Z1.600 F7800
+G1 E208.90526 F2400
+G1 X117.963 Y115.130 F7800
+G1 E210.90526 F2400
+G1 X116.576 Y116.638 E210.98192 F1800
+G1 X115.063 Y118.019 E211.05859
+G1 X113.435 Y119.264 E211.13525
+G1 X111.705 Y120.361 E211.21191
+G1 X109.886 Y121.304 E211.28858
+G1 X107.991 Y122.085 E211.36524
+G1 X106.036 Y122.697 E211.44191
+G1 X104.035 Y123.137 E211.51857
+G1 X102.003 Y123.400 E211.59524
+G1 X99.956 Y123.486 E211.67190
+G1 X97.909 Y123.393 E211.74857
+G1 X95.879 Y123.121 E211.82523
+G1 X93.879 Y122.674 E211.90189
+G1 X91.926 Y122.055 E211.97856
+G1 X90.035 Y121.267 E212.05522
+G1 X88.219 Y120.317 E212.13189
+G1 X86.493 Y119.213 E212.20855
+G1 X84.870 Y117.963 E212.28522
+G1 X83.362 Y116.576 E212.36188
+G1 X81.981 Y115.063 E212.43855
+G1 X80.736 Y113.435 E212.51521
+G1 X79.639 Y111.705 E212.59188
+G1 X78.696 Y109.886 E212.66854
+G1 X77.915 Y107.991 E212.74520
+G1 X77.303 Y106.036 E212.82187
+G1 X76.863 Y104.035 E212.89853
+G1 X76.600 Y102.003 E212.97520
+G1 X76.514 Y99.956 E213.05186
+G1 X76.607 Y97.909 E213.12853
+G1 X76.879 Y95.879 E213.20519
+G1 X77.326 Y93.879 E213.28186
+G1 X77.945 Y91.926 E213.35852
+G1 X78.733 Y90.035 E213.43518
+G1 X79.683 Y88.219 E213.51185
+G1 X80.787 Y86.493 E213.58851
+G1 X82.037 Y84.870 E213.66518
+G1 X83.424 Y83.362 E213.74184
+G1 X84.937 Y81.981 E213.81851
+G1 X86.565 Y80.736 E213.89517
+G1 X88.295 Y79.639 E213.97184
+G1 X90.114 Y78.696 E214.04850
+G1 X92.009 Y77.915 E214.12516
+G1 X93.964 Y77.303 E214.20183
+G1 X95.965 Y76.863 E214.27849
+G1 X97.997 Y76.600 E214.35516
+G1 X100.044 Y76.514 E214.43182
+G1 X102.091 Y76.607 E214.50849
+G1 X104.121 Y76.879 E214.58515
+G1 X106.121 Y77.326 E214.66182
+G1 X108.074 Y77.945 E214.73848
+G1 X109.965 Y78.733 E214.81514
+G1 X111.781 Y79.683 E214.89181
+G1 X113.507 Y80.787 E214.96847
+G1 X115.130 Y82.037 E215.04514
+G1 X116.638 Y83.424 E215.12180
+G1 X118.019 Y84.937 E215.19847
+G1 X119.264 Y86.565 E215.27513
+G1 X120.361 Y88.295 E215.35180
+G1 X121.304 Y90.114 E215.42846
+G1 X122.085 Y92.009 E215.50512
+G1 X122.697 Y93.964 E215.58179
+G1 X123.137 Y95.965 E215.65845
+G1 X123.400 Y97.997 E215.73512
+G1 X123.486 Y100.044 E215.81178
+G1 X123.393 Y102.091 E215.88845
+G1 X123.121 Y104.121 E215.96511
+G1 X122.674 Y106.121 E216.04178
+G1 X122.055 Y108.074 E216.11844
+G1 X121.267 Y109.965 E216.19510
+G1 X120.317 Y111.781 E216.27177
+G1 X119.213 Y113.507 E216.34843
+G1 X117.963 Y115.130 E216.42510
+G1 X118.307 Y115.420 F7800
+G1 X116.894 Y116.957 E216.50323 F1200
+G1 X115.351 Y118.365 E216.58137
+G1 X113.692 Y119.633 E216.65950
+G1 X111.929 Y120.751 E216.73763
+G1 X110.075 Y121.712 E216.81577
+G1 X108.145 Y122.508 E216.89390
+G1 X106.152 Y123.132 E216.97203
+G1 X104.112 Y123.580 E217.05017
+G1 X102.042 Y123.849 E217.12830
+G1 X99.955 Y123.936 E217.20643
+G1 X97.869 Y123.841 E217.28457
+G1 X95.800 Y123.564 E217.36270
+G1 X93.762 Y123.109 E217.44083
+G1 X91.771 Y122.477 E217.51897
+G1 X89.844 Y121.674 E217.59710
+G1 X87.993 Y120.707 E217.67523
+G1 X86.234 Y119.581 E217.75337
+G1 X84.580 Y118.307 E217.83150
+G1 X83.043 Y116.894 E217.90963
+G1 X81.635 Y115.351 E217.98777
+G1 X80.367 Y113.692 E218.06590
+G1 X79.249 Y111.929 E218.14403
+G1 X78.288 Y110.075 E218.22217
+G1 X77.492 Y108.145 E218.30030
+G1 X76.868 Y106.152 E218.37843
+G1 X76.420 Y104.112 E218.45657
+G1 X76.151 Y102.042 E218.53470
+G1 X76.064 Y99.955 E218.61283
+G1 X76.159 Y97.869 E218.69097
+G1 X76.436 Y95.800 E218.76910
+G1 X76.891 Y93.762 E218.84723
+G1 X77.523 Y91.771 E218.92537
+G1 X78.326 Y89.844 E219.00350
+G1 X79.293 Y87.993 E219.08163
+G1 X80.419 Y86.234 E219.15977
+G1 X81.693 Y84.580 E219.23790
+G1 X83.106 Y83.043 E219.31603
+G1 X84.649 Y81.635 E219.39417
+G1 X86.308 Y80.367 E219.47230
+G1 X88.071 Y79.249 E219.55043
+G1 X89.925 Y78.288 E219.62857
+G1 X91.855 Y77.492 E219.70670
+G1 X93.848 Y76.868 E219.78483
+G1 X95.888 Y76.420 E219.86297
+G1 X97.958 Y76.151 E219.94110
+G1 X100.045 Y76.064 E220.01923
+G1 X102.131 Y76.159 E220.09737
+G1 X104.200 Y76.436 E220.17550
+G1 X106.238 Y76.891 E220.25363
+G1 X108.229 Y77.523 E220.33177
+G1 X110.156 Y78.326 E220.40990
+G1 X112.007 Y79.293 E220.48803
+G1 X113.766 Y80.419 E220.56617
+G1 X115.420 Y81.693 E220.64430
+G1 X116.957 Y83.106 E220.72243
+G1 X118.365 Y84.649 E220.80057
+G1 X119.633 Y86.308 E220.87870
+G1 X120.751 Y88.071 E220.95683
+G1 X121.712 Y89.925 E221.03497
+G1 X122.508 Y91.855 E221.11310
+G1 X123.132 Y93.848 E221.19123
+G1 X123.580 Y95.888 E221.26937
+G1 X123.849 Y97.958 E221.34750
+G1 X123.936 Y100.045 E221.42564
+G1 X123.841 Y102.131 E221.50377
+G1 X123.564 Y104.200 E221.58190
+G1 X123.109 Y106.238 E221.66004
+G1 X122.477 Y108.229 E221.73817
+G1 X121.674 Y110.156 E221.81630
+G1 X120.707 Y112.007 E221.89444
+G1 X119.581 Y113.766 E221.97257
+G1 X118.307 Y115.420 E222.05070
+G1 E220.05070 F2400
+G1 X106.450 Y100.000 F7800
+G1 E222.05070 F2400
+G1 X106.395 Y100.842 E222.08227 F1800
+G1 X106.230 Y101.669 E222.11384
+G1 X105.959 Y102.468 E222.14541
+G1 X105.586 Y103.225 E222.17698
+G1 X105.117 Y103.927 E222.20855
+G1 X104.561 Y104.561 E222.24012
+G1 X103.927 Y105.117 E222.27169
+G1 X103.225 Y105.586 E222.30326
+G1 X102.468 Y105.959 E222.33483
+G1 X101.669 Y106.230 E222.36640
+G1 X100.842 Y106.395 E222.39796
+G1 X100.000 Y106.450 E222.42953
+G1 X99.158 Y106.395 E222.46110
+G1 X98.331 Y106.230 E222.49267
+G1 X97.532 Y105.959 E222.52424
+G1 X96.775 Y105.586 E222.55581
+G1 X96.073 Y105.117 E222.58738
+G1 X95.439 Y104.561 E222.61895
+G1 X94.883 Y103.927 E222.65052
+G1 X94.414 Y103.225 E222.68209
+G1 X94.041 Y102.468 E222.71366
+G1 X93.770 Y101.669 E222.74523
+G1 X93.605 Y100.842 E222.77680
+G1 X93.550 Y100.000 E222.80837
+G1 X93.605 Y99.158 E222.83993
+G1 X93.770 Y98.331 E222.87150
+G1 X94.041 Y97.532 E222.90307
+G1 X94.414 Y96.775 E222.93464
+G1 X94.883 Y96.073 E222.96621
+G1 X95.439 Y95.439 E222.99778
+G1 X96.073 Y94.883 E223.02935
+G1 X96.775 Y94.414 E223.06092
+G1 X97.532 Y94.041 E223.09249
+G1 X98.331 Y93.770 E223.12406
+G1 X99.158 Y93.605 E223.15563
+G1 X100.000 Y93.550 E223.18720
+G1 X100.842 Y93.605 E223.21877
+G1 X101.669 Y93.770 E223.25034
+G1 X102.468 Y94.041 E223.28190
+G1 X103.225 Y94.414 E223.31347
+G1 X103.927 Y94.883 E223.34504
+G1 X104.561 Y95.439 E223.37661
+G1 X105.117 Y96.073 E223.40818
+G1 X105.586 Y96.775 E223.43975
+G1 X105.959 Y97.532 E223.47132
+G1 X106.230 Y98.331 E223.50289
+G1 X106.395 Y99.158 E223.53446
+G1 X106.450 Y100.000 E223.56603
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E223.59539 F1200
+G1 X105.796 Y101.553 E223.62476
+G1 X105.543 Y102.296 E223.65413
+G1 X105.196 Y103.000 E223.68350
+G1 X104.760 Y103.653 E223.71286
+G1 X104.243 Y104.243 E223.74223
+G1 X103.653 Y104.760 E223.77160
+G1 X103.000 Y105.196 E223.80096
+G1 X102.296 Y105.543 E223.83033
+G1 X101.553 Y105.796 E223.85970
+G1 X100.783 Y105.949 E223.88906
+G1 X100.000 Y106.000 E223.91843
+G1 X99.217 Y105.949 E223.94780
+G1 X98.447 Y105.796 E223.97716
+G1 X97.704 Y105.543 E224.00653
+G1 X97.000 Y105.196 E224.03590
+G1 X96.347 Y104.760 E224.06526
+G1 X95.757 Y104.243 E224.09463
+G1 X95.240 Y103.653 E224.12400
+G1 X94.804 Y103.000 E224.15336
+G1 X94.457 Y102.296 E224.18273
+G1 X94.204 Y101.553 E224.21210
+G1 X94.051 Y100.783 E224.24146
+G1 X94.000 Y100.000 E224.27083
+G1 X94.051 Y99.217 E224.30020
+G1 X94.204 Y98.447 E224.32956
+G1 X94.457 Y97.704 E224.35893
+G1 X94.804 Y97.000 E224.38830
+G1 X95.240 Y96.347 E224.41766
+G1 X95.757 Y95.757 E224.44703
+G1 X96.347 Y95.240 E224.47640
+G1 X97.000 Y94.804 E224.50576
+G1 X97.704 Y94.457 E224.53513
+G1 X98.447 Y94.204 E224.56450
+G1 X99.217 Y94.051 E224.59387
+G1 X100.000 Y94.000 E224.62323
+G1 X100.783 Y94.051 E224.65260
+G1 X101.553 Y94.204 E224.68197
+G1 X102.296 Y94.457 E224.71133
+G1 X103.000 Y94.804 E224.74070
+G1 X103.653 Y95.240 E224.77007
+G1 X104.243 Y95.757 E224.79943
+G1 X104.760 Y96.347 E224.82880
+G1 X105.196 Y97.000 E224.85817
+G1 X105.543 Y97.704 E224.88753
+G1 X105.796 Y98.447 E224.91690
+G1 X105.949 Y99.217 E224.94627
+G1 X106.000 Y100.000 E224.97563
+G1 E222.97563 F2400
+G1 X79.488 Y89.030 F7800
+G1 E224.97563 F2400
+G1 X89.030 Y79.488 E225.48055 F3600
+G1 E223.48055 F2400
+G1 X95.602 Y77.159 F7800
+G1 E225.48055 F2400
+G1 X77.159 Y95.602 E226.45653 F3600
+G1 E224.45653 F2400
+G1 X76.741 Y100.263 F7800
+G1 E226.45653 F2400
+G1 X100.263 Y76.741 E227.70126 F3600
+G1 E225.70126 F2400
+G1 X104.136 Y77.110 F7800
+G1 E227.70126 F2400
+G1 X77.110 Y104.136 E229.13141 F3600
+G1 E227.13141 F2400
+G1 X77.983 Y107.506 F7800
+G1 E229.13141 F2400
+G1 X107.506 Y77.983 E230.69363 F3600
+G1 E228.69363 F2400
+G1 X110.492 Y79.240 F7800
+G1 E230.69363 F2400
+G1 X79.240 Y110.492 E232.34739 F3600
+G1 E230.34739 F2400
+G1 X80.817 Y113.157 F7800
+G1 E232.34739 F2400
+G1 X93.354 Y100.620 E233.01078 F3600
+G1 E231.01078 F2400
+G1 X100.620 Y93.354 F7800
+G1 E233.01078 F2400
+G1 X113.157 Y80.817 E233.67417 F3600
+G1 E231.67417 F2400
+G1 X115.532 Y82.685 F7800
+G1 E233.67417 F2400
+G1 X103.743 Y94.473 E234.29799 F3600
+G1 E232.29799 F2400
+G1 X94.473 Y103.743 F7800
+G1 E234.29799 F2400
+G1 X82.685 Y115.532 E234.92182 F3600
+G1 E232.92182 F2400
+G1 X84.828 Y117.632 F7800
+G1 E234.92182 F2400
+G1 X96.673 Y105.787 E235.54861 F3600
+G1 E233.54861 F2400
+G1 X105.787 Y96.673 F7800
+G1 E235.54861 F2400
+G1 X117.632 Y84.828 E236.17541 F3600
+G1 E234.17541 F2400
+G1 X119.454 Y87.248 F7800
+G1 E236.17541 F2400
+G1 X106.675 Y100.027 E236.85163 F3600
+G1 E234.85163 F2400
+G1 X100.027 Y106.675 F7800
+G1 E236.85163 F2400
+G1 X87.248 Y119.454 E237.52786 F3600
+G1 E235.52786 F2400
+G1 X89.961 Y120.983 F7800
+G1 E237.52786 F2400
+G1 X120.983 Y89.961 E239.16943 F3600
+G1 E237.16943 F2400
+G1 X122.184 Y93.004 F7800
+G1 E239.16943 F2400
+G1 X93.004 Y122.184 E240.71355 F3600
+G1 E238.71355 F2400
+G1 X96.443 Y122.987 F7800
+G1 E240.71355 F2400
+G1 X122.987 Y96.443 E242.11820 F3600
+G1 E240.11820 F2400
+G1 X123.257 Y100.415 F7800
+G1 E242.11820 F2400
+G1 X100.415 Y123.257 E243.32691 F3600
+G1 E241.32691 F2400
+G1 X105.256 Y122.659 F7800
+G1 E243.32691 F2400
+G1 X122.659 Y105.256 E244.24785 F3600
+;LAYER:8
+G1 Z1.800 F7800
+G1 E242.24785 F2400
+G1 X116.155 Y116.633 F7800
+G1 E244.24785 F2400
+G1 X114.643 Y117.978 E244.32354 F1800
+G1 X113.021 Y119.186 E244.39923
+G1 X111.299 Y120.248 E244.47492
+G1 X109.491 Y121.156 E244.55061
+G1 X107.611 Y121.902 E244.62629
+G1 X105.674 Y122.482 E244.70198
+G1 X103.693 Y122.891 E244.77767
+G1 X101.683 Y123.126 E244.85336
+G1 X99.661 Y123.185 E244.92905
+G1 X97.642 Y123.067 E245.00474
+G1 X95.641 Y122.774 E245.08043
+G1 X93.672 Y122.307 E245.15612
+G1 X91.752 Y121.671 E245.23181
+G1 X89.895 Y120.869 E245.30750
+G1 X88.114 Y119.909 E245.38319
+G1 X86.424 Y118.798 E245.45888
+G1 X84.838 Y117.543 E245.53457
+G1 X83.367 Y116.155 E245.61025
+G1 X82.022 Y114.643 E245.68594
+G1 X80.814 Y113.021 E245.76163
+G1 X79.752 Y111.299 E245.83732
+G1 X78.844 Y109.491 E245.91301
+G1 X78.098 Y107.611 E245.98870
+G1 X77.518 Y105.674 E246.06439
+G1 X77.109 Y103.693 E246.14008
+G1 X76.874 Y101.683 E246.21577
+G1 X76.815 Y99.661 E246.29146
+G1 X76.933 Y97.642 E246.36715
+G1 X77.226 Y95.641 E246.44284
+G1 X77.693 Y93.672 E246.51853
+G1 X78.329 Y91.752 E246.59421
+G1 X79.131 Y89.895 E246.66990
+G1 X80.091 Y88.114 E246.74559
+G1 X81.202 Y86.424 E246.82128
+G1 X82.457 Y84.838 E246.89697
+G1 X83.845 Y83.367 E246.97266
+G1 X85.357 Y82.022 E247.04835
+G1 X86.979 Y80.814 E247.12404
+G1 X88.701 Y79.752 E247.19973
+G1 X90.509 Y78.844 E247.27542
+G1 X92.389 Y78.098 E247.35111
+G1 X94.326 Y77.518 E247.42680
+G1 X96.307 Y77.109 E247.50249
+G1 X98.317 Y76.874 E247.57818
+G1 X100.339 Y76.815 E247.65386
+G1 X102.358 Y76.933 E247.72955
+G1 X104.359 Y77.226 E247.80524
+G1 X106.328 Y77.693 E247.88093
+G1 X108.248 Y78.329 E247.95662
+G1 X110.105 Y79.131 E248.03231
+G1 X111.886 Y80.091 E248.10800
+G1 X113.576 Y81.202 E248.18369
+G1 X115.162 Y82.457 E248.25938
+G1 X116.633 Y83.845 E248.33507
+G1 X117.978 Y85.357 E248.41076
+G1 X119.186 Y86.979 E248.48645
+G1 X120.248 Y88.701 E248.56214
+G1 X121.156 Y90.509 E248.63782
+G1 X121.902 Y92.389 E248.71351
+G1 X122.482 Y94.326 E248.78920
+G1 X122.891 Y96.307 E248.86489
+G1 X123.126 Y98.317 E248.94058
+G1 X123.185 Y100.339 E249.01627
+G1 X123.067 Y102.358 E249.09196
+G1 X122.774 Y104.359 E249.16765
+G1 X122.307 Y106.328 E249.24334
+G1 X121.671 Y108.248 E249.31903
+G1 X120.869 Y110.105 E249.39472
+G1 X119.909 Y111.886 E249.47041
+G1 X118.798 Y113.576 E249.54610
+G1 X117.543 Y115.162 E249.62178
+G1 X116.155 Y116.633 E249.69747
+G1 X116.468 Y116.956 F7800
+G1 X114.928 Y118.327 E249.77463 F1200
+G1 X113.274 Y119.558 E249.85179
+G1 X111.518 Y120.641 E249.92895
+G1 X109.676 Y121.566 E250.00611
+G1 X107.759 Y122.327 E250.08327
+G1 X105.784 Y122.919 E250.16042
+G1 X103.764 Y123.336 E250.23758
+G1 X101.716 Y123.575 E250.31474
+G1 X99.655 Y123.635 E250.39190
+G1 X97.596 Y123.515 E250.46906
+G1 X95.556 Y123.216 E250.54621
+G1 X93.550 Y122.740 E250.62337
+G1 X91.592 Y122.091 E250.70053
+G1 X89.699 Y121.274 E250.77769
+G1 X87.884 Y120.296 E250.85485
+G1 X86.161 Y119.162 E250.93200
+G1 X84.544 Y117.883 E251.00916
+G1 X83.044 Y116.468 E251.08632
+G1 X81.673 Y114.928 E251.16348
+G1 X80.442 Y113.274 E251.24064
+G1 X79.359 Y111.518 E251.31780
+G1 X78.434 Y109.676 E251.39495
+G1 X77.673 Y107.759 E251.47211
+G1 X77.081 Y105.784 E251.54927
+G1 X76.664 Y103.764 E251.62643
+G1 X76.425 Y101.716 E251.70359
+G1 X76.365 Y99.655 E251.78074
+G1 X76.485 Y97.596 E251.85790
+G1 X76.784 Y95.556 E251.93506
+G1 X77.260 Y93.550 E252.01222
+G1 X77.909 Y91.592 E252.08938
+G1 X78.726 Y89.699 E252.16654
+G1 X79.704 Y87.884 E252.24369
+G1 X80.838 Y86.161 E252.32085
+G1 X82.117 Y84.544 E252.39801
+G1 X83.532 Y83.044 E252.47517
+G1 X85.072 Y81.673 E252.55233
+G1 X86.726 Y80.442 E252.62948
+G1 X88.482 Y79.359 E252.70664
+G1 X90.324 Y78.434 E252.78380
+G1 X92.241 Y77.673 E252.86096
+G1 X94.216 Y77.081 E252.93812
+G1 X96.236 Y76.664 E253.01528
+G1 X98.284 Y76.425 E253.09243
+G1 X100.345 Y76.365 E253.16959
+G1 X102.404 Y76.485 E253.24675
+G1 X104.444 Y76.784 E253.32391
+G1 X106.450 Y77.260 E253.40107
+G1 X108.408 Y77.909 E253.47822
+G1 X110.301 Y78.726 E253.55538
+G1 X112.116 Y79.704 E253.63254
+G1 X113.839 Y80.838 E253.70970
+G1 X115.456 Y82.117 E253.78686
+G1 X116.956 Y83.532 E253.86402
+G1 X118.327 Y85.072 E253.94117
+G1 X119.558 Y86.726 E254.01833
+G1 X120.641 Y88.482 E254.09549
+G1 X121.566 Y90.324 E254.17265
+G1 X122.327 Y92.241 E254.24981
+G1 X122.919 Y94.216 E254.32696
+G1 X123.336 Y96.236 E254.40412
+G1 X123.575 Y98.284 E254.48128
+G1 X123.635 Y100.345 E254.55844
+G1 X123.515 Y102.404 E254.63560
+G1 X123.216 Y104.444 E254.71276
+G1 X122.740 Y106.450 E254.78991
+G1 X122.091 Y108.408 E254.86707
+G1 X121.274 Y110.301 E254.94423
+G1 X120.296 Y112.116 E255.02139
+G1 X119.162 Y113.839 E255.09855
+G1 X117.883 Y115.456 E255.17570
+G1 X116.468 Y116.956 E255.25286
+G1 E253.25286 F2400
+G1 X106.450 Y100.000 F7800
+G1 E255.25286 F2400
+G1 X106.395 Y100.842 E255.28443 F1800
+G1 X106.230 Y101.669 E255.31600
+G1 X105.959 Y102.468 E255.34757
+G1 X105.586 Y103.225 E255.37914
+G1 X105.117 Y103.927 E255.41071
+G1 X104.561 Y104.561 E255.44228
+G1 X103.927 Y105.117 E255.47385
+G1 X103.225 Y105.586 E255.50542
+G1 X102.468 Y105.959 E255.53699
+G1 X101.669 Y106.230 E255.56856
+G1 X100.842 Y106.395 E255.60012
+G1 X100.000 Y106.450 E255.63169
+G1 X99.158 Y106.395 E255.66326
+G1 X98.331 Y106.230 E255.69483
+G1 X97.532 Y105.959 E255.72640
+G1 X96.775 Y105.586 E255.75797
+G1 X96.073 Y105.117 E255.78954
+G1 X95.439 Y104.561 E255.82111
+G1 X94.883 Y103.927 E255.85268
+G1 X94.414 Y103.225 E255.88425
+G1 X94.041 Y102.468 E255.91582
+G1 X93.770 Y101.669 E255.94739
+G1 X93.605 Y100.842 E255.97896
+G1 X93.550 Y100.000 E256.01053
+G1 X93.605 Y99.158 E256.04209
+G1 X93.770 Y98.331 E256.07366
+G1 X94.041 Y97.532 E256.10523
+G1 X94.414 Y96.775 E256.13680
+G1 X94.883 Y96.073 E256.16837
+G1 X95.439 Y95.439 E256.19994
+G1 X96.073 Y94.883 E256.23151
+G1 X96.775 Y94.414 E256.26308
+G1 X97.532 Y94.041 E256.29465
+G1 X98.331 Y93.770 E256.32622
+G1 X99.158 Y93.605 E256.35779
+G1 X100.000 Y93.550 E256.38936
+G1 X100.842 Y93.605 E256.42093
+G1 X101.669 Y93.770 E256.45250
+G1 X102.468 Y94.041 E256.48406
+G1 X103.225 Y94.414 E256.51563
+G1 X103.927 Y94.883 E256.54720
+G1 X104.561 Y95.439 E256.57877
+G1 X105.117 Y96.073 E256.61034
+G1 X105.586 Y96.775 E256.64191
+G1 X105.959 Y97.532 E256.67348
+G1 X106.230 Y98.331 E256.70505
+G1 X106.395 Y99.158 E256.73662
+G1 X106.450 Y100.000 E256.76819
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E256.79756 F1200
+G1 X105.796 Y101.553 E256.82692
+G1 X105.543 Y102.296 E256.85629
+G1 X105.196 Y103.000 E256.88566
+G1 X104.760 Y103.653 E256.91502
+G1 X104.243 Y104.243 E256.94439
+G1 X103.653 Y104.760 E256.97376
+G1 X103.000 Y105.196 E257.00312
+G1 X102.296 Y105.543 E257.03249
+G1 X101.553 Y105.796 E257.06186
+G1 X100.783 Y105.949 E257.09122
+G1 X100.000 Y106.000 E257.12059
+G1 X99.217 Y105.949 E257.14996
+G1 X98.447 Y105.796 E257.17932
+G1 X97.704 Y105.543 E257.20869
+G1 X97.000 Y105.196 E257.23806
+G1 X96.347 Y104.760 E257.26742
+G1 X95.757 Y104.243 E257.29679
+G1 X95.240 Y103.653 E257.32616
+G1 X94.804 Y103.000 E257.35552
+G1 X94.457 Y102.296 E257.38489
+G1 X94.204 Y101.553 E257.41426
+G1 X94.051 Y100.783 E257.44362
+G1 X94.000 Y100.000 E257.47299
+G1 X94.051 Y99.217 E257.50236
+G1 X94.204 Y98.447 E257.53172
+G1 X94.457 Y97.704 E257.56109
+G1 X94.804 Y97.000 E257.59046
+G1 X95.240 Y96.347 E257.61982
+G1 X95.757 Y95.757 E257.64919
+G1 X96.347 Y95.240 E257.67856
+G1 X97.000 Y94.804 E257.70793
+G1 X97.704 Y94.457 E257.73729
+G1 X98.447 Y94.204 E257.76666
+G1 X99.217 Y94.051 E257.79603
+G1 X100.000 Y94.000 E257.82539
+G1 X100.783 Y94.051 E257.85476
+G1 X101.553 Y94.204 E257.88413
+G1 X102.296 Y94.457 E257.91349
+G1 X103.000 Y94.804 E257.94286
+G1 X103.653 Y95.240 E257.97223
+G1 X104.243 Y95.757 E258.00159
+G1 X104.760 Y96.347 E258.03096
+G1 X105.196 Y97.000 E258.06033
+G1 X105.543 Y97.704 E258.08969
+G1 X105.796 Y98.447 E258.11906
+G1 X105.949 Y99.217 E258.14843
+G1 X106.000 Y100.000 E258.17779
+G1 E256.17779 F2400
+G1 X110.790 Y79.731 F7800
+G1 E258.17779 F2400
+G1 X120.269 Y89.210 E258.67938 F3600
+G1 E256.67938 F2400
+G1 X122.565 Y95.749 F7800
+G1 E258.67938 F2400
+G1 X104.251 Y77.435 E259.64848 F3600
+G1 E257.64848 F2400
+G1 X99.615 Y77.041 F7800
+G1 E259.64848 F2400
+G1 X122.959 Y100.385 E260.88377 F3600
+G1 E258.88377 F2400
+G1 X122.568 Y104.237 F7800
+G1 E260.88377 F2400
+G1 X95.763 Y77.432 E262.30218 F3600
+G1 E260.30218 F2400
+G1 X92.415 Y78.327 F7800
+G1 E262.30218 F2400
+G1 X121.673 Y107.585 E263.85041 F3600
+G1 E261.85041 F2400
+G1 X120.395 Y110.549 F7800
+G1 E263.85041 F2400
+G1 X89.451 Y79.605 E265.48790 F3600
+G1 E263.48790 F2400
+G1 X86.809 Y81.205 F7800
+G1 E265.48790 F2400
+G1 X99.003 Y93.400 E266.13320 F3600
+G1 E264.13320 F2400
+G1 X106.600 Y100.997 F7800
+G1 E266.13320 F2400
+G1 X118.795 Y113.191 E266.77851 F3600
+G1 E264.77851 F2400
+G1 X116.903 Y115.542 F7800
+G1 E266.77851 F2400
+G1 X105.351 Y103.990 E267.38979 F3600
+G1 E265.38979 F2400
+G1 X96.010 Y94.649 F7800
+G1 E267.38979 F2400
+G1 X84.458 Y83.097 E268.00107 F3600
+G1 E266.00107 F2400
+G1 X82.386 Y85.268 F7800
+G1 E268.00107 F2400
+G1 X94.064 Y96.946 E268.61903 F3600
+G1 E266.61903 F2400
+G1 X103.054 Y105.936 F7800
+G1 E268.61903 F2400
+G1 X114.732 Y117.614 E269.23700 F3600
+G1 E267.23700 F2400
+G1 X112.279 Y119.403 F7800
+G1 E269.23700 F2400
+G1 X99.534 Y106.659 E269.91140 F3600
+G1 E267.91140 F2400
+G1 X93.341 Y100.466 F7800
+G1 E269.91140 F2400
+G1 X80.597 Y87.721 E270.58580 F3600
+G1 E268.58580 F2400
+G1 X79.107 Y90.474 F7800
+G1 E270.58580 F2400
+G1 X109.526 Y120.893 E272.19547 F3600
+G1 E270.19547 F2400
+G1 X106.433 Y122.043 F7800
+G1 E272.19547 F2400
+G1 X77.957 Y93.567 E273.70230 F3600
+G1 E271.70230 F2400
+G1 X77.225 Y97.077 F7800
+G1 E273.70230 F2400
+G1 X102.923 Y122.775 E275.06216 F3600
+G1 E273.06216 F2400
+G1 X98.838 Y122.933 F7800
+G1 E275.06216 F2400
+G1 X77.067 Y101.162 E276.21418 F3600
+G1 E274.21418 F2400
+G1 X77.902 Y106.240 F7800
+G1 E276.21418 F2400
+G1 X93.760 Y122.098 E277.05336 F3600
+;LAYER:9
+G1 Z2.000 F7800
+G1 E275.05336 F2400
+G1 X114.087 Y117.752 F7800
+G1 E277.05336 F2400
+G1 X112.486 Y118.912 E277.12734 F1800
+G1 X110.790 Y119.928 E277.20131
+G1 X109.013 Y120.793 E277.27529
+G1 X107.166 Y121.499 E277.34927
+G1 X105.265 Y122.042 E277.42324
+G1 X103.324 Y122.417 E277.49722
+G1 X101.357 Y122.622 E277.57119
+G1 X99.381 Y122.654 E277.64517
+G1 X97.409 Y122.514 E277.71915
+G1 X95.456 Y122.202 E277.79312
+G1 X93.538 Y121.722 E277.86710
+G1 X91.670 Y121.076 E277.94107
+G1 X89.865 Y120.270 E278.01505
+G1 X88.137 Y119.309 E278.08903
+G1 X86.499 Y118.202 E278.16300
+G1 X84.964 Y116.956 E278.23698
+G1 X83.543 Y115.581 E278.31095
+G1 X82.248 Y114.087 E278.38493
+G1 X81.088 Y112.486 E278.45890
+G1 X80.072 Y110.790 E278.53288
+G1 X79.207 Y109.013 E278.60686
+G1 X78.501 Y107.166 E278.68083
+G1 X77.958 Y105.265 E278.75481
+G1 X77.583 Y103.324 E278.82878
+G1 X77.378 Y101.357 E278.90276
+G1 X77.346 Y99.381 E278.97674
+G1 X77.486 Y97.409 E279.05071
+G1 X77.798 Y95.456 E279.12469
+G1 X78.278 Y93.538 E279.19866
+G1 X78.924 Y91.670 E279.27264
+G1 X79.730 Y89.865 E279.34661
+G1 X80.691 Y88.137 E279.42059
+G1 X81.798 Y86.499 E279.49457
+G1 X83.044 Y84.964 E279.56854
+G1 X84.419 Y83.543 E279.64252
+G1 X85.913 Y82.248 E279.71649
+G1 X87.514 Y81.088 E279.79047
+G1 X89.210 Y80.072 E279.86445
+G1 X90.987 Y79.207 E279.93842
+G1 X92.834 Y78.501 E280.01240
+G1 X94.735 Y77.958 E280.08637
+G1 X96.676 Y77.583 E280.16035
+G1 X98.643 Y77.378 E280.23432
+G1 X100.619 Y77.346 E280.30830
+G1 X102.591 Y77.486 E280.38228
+G1 X104.544 Y77.798 E280.45625
+G1 X106.462 Y78.278 E280.53023
+G1 X108.330 Y78.924 E280.60420
+G1 X110.135 Y79.730 E280.67818
+G1 X111.863 Y80.691 E280.75216
+G1 X113.501 Y81.798 E280.82613
+G1 X115.036 Y83.044 E280.90011
+G1 X116.457 Y84.419 E280.97408
+G1 X117.752 Y85.913 E281.04806
+G1 X118.912 Y87.514 E281.12203
+G1 X119.928 Y89.210 E281.19601
+G1 X120.793 Y90.987 E281.26999
+G1 X121.499 Y92.834 E281.34396
+G1 X122.042 Y94.735 E281.41794
+G1 X122.417 Y96.676 E281.49191
+G1 X122.622 Y98.643 E281.56589
+G1 X122.654 Y100.619 E281.63987
+G1 X122.514 Y102.591 E281.71384
+G1 X122.202 Y104.544 E281.78782
+G1 X121.722 Y106.462 E281.86179
+G1 X121.076 Y108.330 E281.93577
+G1 X120.270 Y110.135 E282.00974
+G1 X119.309 Y111.863 E282.08372
+G1 X118.202 Y113.501 E282.15770
+G1 X116.956 Y115.036 E282.23167
+G1 X115.581 Y116.457 E282.30565
+G1 X114.087 Y117.752 E282.37962
+G1 X114.367 Y118.104 F7800
+G1 X112.734 Y119.288 E282.45507 F1200
+G1 X111.005 Y120.324 E282.53051
+G1 X109.192 Y121.206 E282.60596
+G1 X107.308 Y121.926 E282.68140
+G1 X105.369 Y122.480 E282.75685
+G1 X103.390 Y122.862 E282.83229
+G1 X101.384 Y123.071 E282.90774
+G1 X99.368 Y123.104 E282.98318
+G1 X97.357 Y122.961 E283.05863
+G1 X95.366 Y122.643 E283.13407
+G1 X93.410 Y122.153 E283.20952
+G1 X91.504 Y121.494 E283.28496
+G1 X89.663 Y120.672 E283.36041
+G1 X87.901 Y119.693 E283.43585
+G1 X86.231 Y118.563 E283.51130
+G1 X84.665 Y117.292 E283.58674
+G1 X83.217 Y115.890 E283.66219
+G1 X81.896 Y114.367 E283.73763
+G1 X80.712 Y112.734 E283.81307
+G1 X79.676 Y111.005 E283.88852
+G1 X78.794 Y109.192 E283.96396
+G1 X78.074 Y107.308 E284.03941
+G1 X77.520 Y105.369 E284.11485
+G1 X77.138 Y103.390 E284.19030
+G1 X76.929 Y101.384 E284.26574
+G1 X76.896 Y99.368 E284.34119
+G1 X77.039 Y97.357 E284.41663
+G1 X77.357 Y95.366 E284.49208
+G1 X77.847 Y93.410 E284.56752
+G1 X78.506 Y91.504 E284.64297
+G1 X79.328 Y89.663 E284.71841
+G1 X80.307 Y87.901 E284.79386
+G1 X81.437 Y86.231 E284.86930
+G1 X82.708 Y84.665 E284.94475
+G1 X84.110 Y83.217 E285.02019
+G1 X85.633 Y81.896 E285.09564
+G1 X87.266 Y80.712 E285.17108
+G1 X88.995 Y79.676 E285.24653
+G1 X90.808 Y78.794 E285.32197
+G1 X92.692 Y78.074 E285.39741
+G1 X94.631 Y77.520 E285.47286
+G1 X96.610 Y77.138 E285.54830
+G1 X98.616 Y76.929 E285.62375
+G1 X100.632 Y76.896 E285.69919
+G1 X102.643 Y77.039 E285.77464
+G1 X104.634 Y77.357 E285.85008
+G1 X106.590 Y77.847 E285.92553
+G1 X108.496 Y78.506 E286.00097
+G1 X110.337 Y79.328 E286.07642
+G1 X112.099 Y80.307 E286.15186
+G1 X113.769 Y81.437 E286.22731
+G1 X115.335 Y82.708 E286.30275
+G1 X116.783 Y84.110 E286.37820
+G1 X118.104 Y85.633 E286.45364
+G1 X119.288 Y87.266 E286.52909
+G1 X120.324 Y88.995 E286.60453
+G1 X121.206 Y90.808 E286.67998
+G1 X121.926 Y92.692 E286.75542
+G1 X122.480 Y94.631 E286.83087
+G1 X122.862 Y96.610 E286.90631
+G1 X123.071 Y98.616 E286.98175
+G1 X123.104 Y100.632 E287.05720
+G1 X122.961 Y102.643 E287.13264
+G1 X122.643 Y104.634 E287.20809
+G1 X122.153 Y106.590 E287.28353
+G1 X121.494 Y108.496 E287.35898
+G1 X120.672 Y110.337 E287.43442
+G1 X119.693 Y112.099 E287.50987
+G1 X118.563 Y113.769 E287.58531
+G1 X117.292 Y115.335 E287.66076
+G1 X115.890 Y116.783 E287.73620
+G1 X114.367 Y118.104 E287.81165
+G1 E285.81165 F2400
+G1 X106.450 Y100.000 F7800
+G1 E287.81165 F2400
+G1 X106.395 Y100.842 E287.84322 F1800
+G1 X106.230 Y101.669 E287.87479
+G1 X105.959 Y102.468 E287.90636
+G1 X105.586 Y103.225 E287.93792
+G1 X105.117 Y103.927 E287.96949
+G1 X104.561 Y104.561 E288.00106
+G1 X103.927 Y105.117 E288.03263
+G1 X103.225 Y105.586 E288.06420
+G1 X102.468 Y105.959 E288.09577
+G1 X101.669 Y106.230 E288.12734
+G1 X100.842 Y106.395 E288.15891
+G1 X100.000 Y106.450 E288.19048
+G1 X99.158 Y106.395 E288.22205
+G1 X98.331 Y106.230 E288.25362
+G1 X97.532 Y105.959 E288.28519
+G1 X96.775 Y105.586 E288.31676
+G1 X96.073 Y105.117 E288.34833
+G1 X95.439 Y104.561 E288.37989
+G1 X94.883 Y103.927 E288.41146
+G1 X94.414 Y103.225 E288.44303
+G1 X94.041 Y102.468 E288.47460
+G1 X93.770 Y101.669 E288.50617
+G1 X93.605 Y100.842 E288.53774
+G1 X93.550 Y100.000 E288.56931
+G1 X93.605 Y99.158 E288.60088
+G1 X93.770 Y98.331 E288.63245
+G1 X94.041 Y97.532 E288.66402
+G1 X94.414 Y96.775 E288.69559
+G1 X94.883 Y96.073 E288.72716
+G1 X95.439 Y95.439 E288.75873
+G1 X96.073 Y94.883 E288.79030
+G1 X96.775 Y94.414 E288.82186
+G1 X97.532 Y94.041 E288.85343
+G1 X98.331 Y93.770 E288.88500
+G1 X99.158 Y93.605 E288.91657
+G1 X100.000 Y93.550 E288.94814
+G1 X100.842 Y93.605 E288.97971
+G1 X101.669 Y93.770 E289.01128
+G1 X102.468 Y94.041 E289.04285
+G1 X103.225 Y94.414 E289.07442
+G1 X103.927 Y94.883 E289.10599
+G1 X104.561 Y95.439 E289.13756
+G1 X105.117 Y96.073 E289.16913
+G1 X105.586 Y96.775 E289.20070
+G1 X105.959 Y97.532 E289.23227
+G1 X106.230 Y98.331 E289.26383
+G1 X106.395 Y99.158 E289.29540
+G1 X106.450 Y100.000 E289.32697
+G1 X106.000 Y100.000 F7800
+G1 X105.949 Y100.783 E289.35634 F1200
+G1 X105.796 Y101.553 E289.38571
+G1 X105.543 Y102.296 E289.41507
+G1 X105.196 Y103.000 E289.44444
+G1 X104.760 Y103.653 E289.47381
+G1 X104.243 Y104.243 E289.50317
+G1 X103.653 Y104.760 E289.53254
+G1 X103.000 Y105.196 E289.56191
+G1 X102.296 Y105.543 E289.59127
+G1 X101.553 Y105.796 E289.62064
+G1 X100.783 Y105.949 E289.65001
+G1 X100.000 Y106.000 E289.67937
+G1 X99.217 Y105.949 E289.70874
+G1 X98.447 Y105.796 E289.73811
+G1 X97.704 Y105.543 E289.76747
+G1 X97.000 Y105.196 E289.79684
+G1 X96.347 Y104.760 E289.82621
+G1 X95.757 Y104.243 E289.85557
+G1 X95.240 Y103.653 E289.88494
+G1 X94.804 Y103.000 E289.91431
+G1 X94.457 Y102.296 E289.94368
+G1 X94.204 Y101.553 E289.97304
+G1 X94.051 Y100.783 E290.00241
+G1 X94.000 Y100.000 E290.03178
+G1 X94.051 Y99.217 E290.06114
+G1 X94.204 Y98.447 E290.09051
+G1 X94.457 Y97.704 E290.11988
+G1 X94.804 Y97.000 E290.14924
+G1 X95.240 Y96.347 E290.17861
+G1 X95.757 Y95.757 E290.20798
+G1 X96.347 Y95.240 E290.23734
+G1 X97.000 Y94.804 E290.26671
+G1 X97.704 Y94.457 E290.29608
+G1 X98.447 Y94.204 E290.32544
+G1 X99.217 Y94.051 E290.35481
+G1 X100.000 Y94.000 E290.38418
+G1 X100.783 Y94.051 E290.41354
+G1 X101.553 Y94.204 E290.44291
+G1 X102.296 Y94.457 E290.47228
+G1 X103.000 Y94.804 E290.50164
+G1 X103.653 Y95.240 E290.53101
+G1 X104.243 Y95.757 E290.56038
+G1 X104.760 Y96.347 E290.58974
+G1 X105.196 Y97.000 E290.61911
+G1 X105.543 Y97.704 E290.64848
+G1 X105.796 Y98.447 E290.67784
+G1 X105.949 Y99.217 E290.70721
+G1 X106.000 Y100.000 E290.73658
+G1 E288.73658 F2400
+G1 X80.158 Y89.525 F7800
+G1 E290.73658 F2400
+G1 X89.525 Y80.158 E291.23227 F3600
+G1 E289.23227 F2400
+G1 X96.004 Y77.921 F7800
+G1 E291.23227 F2400
+G1 X77.921 Y96.004 E292.18916 F3600
+G1 E290.18916 F2400
+G1 X77.571 Y100.598 F7800
+G1 E292.18916 F2400
+G1 X100.598 Y77.571 E293.40768 F3600
+G1 E291.40768 F2400
+G1 X104.411 Y78.000 F7800
+G1 E293.40768 F2400
+G1 X78.000 Y104.411 E294.80521 F3600
+G1 E292.80521 F2400
+G1 X78.933 Y107.721 F7800
+G1 E294.80521 F2400
+G1 X107.721 Y78.933 E296.32856 F3600
+G1 E294.32856 F2400
+G1 X110.647 Y80.250 F7800
+G1 E296.32856 F2400
+G1 X96.697 Y94.200 E297.06675 F3600
+G1 E295.06675 F2400
+G1 X94.200 Y96.697 F7800
+G1 E297.06675 F2400
+G1 X80.250 Y110.647 E297.80495 F3600
+G1 E295.80495 F2400
+G1 X81.891 Y113.248 F7800
+G1 E297.80495 F2400
+G1 X93.523 Y101.615 E298.42049 F3600
+G1 E296.42049 F2400
+G1 X101.615 Y93.523 F7800
+G1 E298.42049 F2400
+G1 X113.248 Y81.891 E299.03603 F3600
+G1 E297.03603 F2400
+G1 X115.553 Y83.828 F7800
+G1 E299.03603 F2400
+G1 X104.401 Y94.981 E299.62619 F3600
+G1 E297.62619 F2400
+G1 X94.981 Y104.401 F7800
+G1 E299.62619 F2400
+G1 X83.828 Y115.553 E300.21636 F3600
+G1 E298.21636 F2400
+G1 X86.050 Y117.574 F7800
+G1 E300.21636 F2400
+G1 X97.454 Y106.170 E300.81979 F3600
+G1 E298.81979 F2400
+G1 X106.170 Y97.454 F7800
+G1 E300.81979 F2400
+G1 X117.574 Y86.050 E301.42323 F3600
+G1 E299.42323 F2400
+G1 X119.304 Y88.563 F7800
+G1 E301.42323 F2400
+G1 X106.542 Y101.325 E302.09852 F3600
+G1 E300.09852 F2400
+G1 X101.325 Y106.542 F7800
+G1 E302.09852 F2400
+G1 X88.563 Y119.304 E302.77381 F3600
+G1 E300.77381 F2400
+G1 X91.390 Y120.720 F7800
+G1 E302.77381 F2400
+G1 X120.720 Y91.390 E304.32583 F3600
+G1 E302.32583 F2400
+G1 X121.773 Y94.579 F7800
+G1 E304.32583 F2400
+G1 X94.579 Y121.773 E305.76480 F3600
+G1 E303.76480 F2400
+G1 X98.228 Y122.367 F7800
+G1 E305.76480 F2400
+G1 X122.367 Y98.228 E307.04218 F3600
+G1 E305.04218 F2400
+G1 X122.292 Y102.545 F7800
+G1 E307.04218 F2400
+G1 X102.545 Y122.292 E308.08716 F3600
+G1 E306.08716 F2400
+G1 X108.192 Y120.889 F7800
+G1 E308.08716 F2400
+G1 X120.889 Y108.192 E308.75904 F3600
+M107
+M104 S0 ; turn off temperature
+G28 X0  ; home X axis
+M84     ; disable motors
+
+; filament used = 308.8mm (0.7cm3)
+; layer_height = 0.2
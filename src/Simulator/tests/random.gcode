@@ -0,0 +1,4008 @@
+; 4000 moves of 0.2 to 5 mm in random directions with changing feedrates,
+; so that junctions change often. make bench-planner compares the step
+; timing with the planner variant that stops at the first unchanged junction.
+; expect Steps: X:465808 Y:480253 Z:2284649 E0:36598
+G28
+G1 Z0.3 F3000
+G1 X100 Y100 F9000
+G92 E0
+G1 X100.212 Y102.804 E0.09365 F4800
+G1 X102.351 Y101.557 E0.17608 F9000
+G1 X102.592 Y101.662 E0.18485 F6000
+G1 X102.514 Y102.985 E0.22896 F6000
+G1 X99.769 Y102.262 E0.32348 F6000
+G1 X99.177 Y101.554 E0.35421 F3000
+G1 X101.008 Y99.555 E0.44450 F1800
+G1 X100.768 Y99.108 E0.46139 F9000
+G1 X104.571 Y100.156 E0.59274 F4800
+G1 X100.974 Y100.778 E0.71429 F6000
+G1 X99.941 Y96.274 E0.86818 F6000
+G1 X99.534 Y93.333 E0.96706 F3000
+G1 X100.018 Y92.872 E0.98929 F3000
+G1 X98.580 Y92.918 E1.03719 F6000
+G1 X99.359 Y88.684 E1.18055 F6000
+G1 X97.309 Y88.591 E1.24889 F4800
+G1 X95.202 Y88.132 E1.32069 F3000
+G1 X98.065 Y86.166 E1.43636 F1800
+G1 X101.138 Y82.276 E1.60142 F3000
+G1 X100.577 Y80.601 E1.66025 F9000
+G1 X102.999 Y78.948 E1.75788 F3000
+G1 X99.683 Y75.282 E1.92247 F4800
+G1 X99.573 Y75.775 E1.93927 F6000
+G1 X103.007 Y77.909 E2.07390 F6000
+G1 X103.244 Y77.730 E2.08378 F6000
+G1 X103.761 Y73.372 E2.22994 F1800
+G1 X100.714 Y71.009 E2.35834 F6000
+G1 X100.361 Y69.255 E2.41790 F4800
+G1 X95.371 Y69.085 E2.58416 F4800
+G1 X96.090 Y69.118 E2.60810 F9000
+G1 X97.215 Y69.343 E2.64631 F6000
+G1 X96.836 Y70.757 E2.69507 F1800
+G1 X98.653 Y70.526 E2.75605 F4800
+G1 X103.006 Y69.369 E2.90603 F6000
+G1 X99.878 Y72.429 E3.05173 F6000
+G1 X97.986 Y70.025 E3.15360 F9000
+G1 X101.879 Y72.951 E3.31577 F9000
+G1 X101.446 Y76.166 E3.42381 F3000
+G1 X103.565 Y75.272 E3.50039 F4800
+G1 X100.758 Y74.897 E3.59471 F1800
+G1 X101.938 Y70.101 E3.75921 F4800
+G1 X105.069 Y70.497 E3.86430 F3000
+G1 X108.054 Y71.681 E3.97123 F6000
+G1 X105.280 Y75.355 E4.12452 F9000
+G1 X104.280 Y71.748 E4.24915 F1800
+G1 X100.232 Y69.201 E4.40843 F1800
+G1 X101.600 Y68.880 E4.45523 F6000
+G1 X100.671 Y71.824 E4.55802 F3000
+G1 X99.555 Y73.107 E4.61466 F4800
+G1 X100.371 Y71.887 E4.66354 F6000
+G1 X103.615 Y74.399 E4.80016 F9000
+G1 X103.279 Y73.639 E4.82783 F9000
+G1 X103.975 Y77.637 E4.96297 F3000
+G1 X102.353 Y80.687 E5.07801 F1800
+G1 X103.753 Y81.730 E5.13613 F4800
+G1 X103.173 Y80.592 E5.17867 F3000
+G1 X106.470 Y82.403 E5.30394 F3000
+G1 X108.243 Y80.838 E5.38271 F3000
+G1 X108.327 Y80.485 E5.39479 F3000
+G1 X106.650 Y84.350 E5.53511 F9000
+G1 X107.273 Y85.756 E5.58630 F1800
+G1 X107.916 Y84.013 E5.64815 F3000
+G1 X105.550 Y85.289 E5.73767 F4800
+G1 X102.385 Y86.003 E5.84569 F4800
+G1 X100.489 Y87.049 E5.91781 F6000
+G1 X100.613 Y87.233 E5.92522 F9000
+G1 X102.890 Y87.046 E6.00130 F3000
+G1 X105.233 Y87.528 E6.08096 F9000
+G1 X107.969 Y86.887 E6.17455 F3000
+G1 X110.754 Y83.586 E6.31835 F4800
+G1 X111.755 Y84.527 E6.36409 F1800
+G1 X114.657 Y82.517 E6.48164 F3000
+G1 X118.255 Y79.783 E6.63210 F9000
+G1 X120.644 Y80.549 E6.71565 F1800
+G1 X121.417 Y81.994 E6.77025 F1800
+G1 X119.258 Y81.653 E6.84304 F9000
+G1 X119.864 Y82.178 E6.86974 F9000
+G1 X115.950 Y82.742 E7.00145 F4800
+G1 X116.093 Y83.516 E7.02765 F1800
+G1 X117.991 Y87.037 E7.16085 F3000
+G1 X118.097 Y86.826 E7.16871 F9000
+G1 X118.382 Y86.491 E7.18335 F4800
+G1 X118.417 Y89.658 E7.28880 F9000
+G1 X116.231 Y90.807 E7.37105 F1800
+G1 X118.673 Y87.739 E7.50163 F1800
+G1 X119.048 Y88.112 E7.51922 F1800
+G1 X119.422 Y87.626 E7.53965 F9000
+G1 X118.470 Y87.686 E7.57141 F1800
+G1 X116.506 Y90.344 E7.68147 F9000
+G1 X116.015 Y91.732 E7.73048 F4800
+G1 X115.282 Y92.084 E7.75754 F1800
+G1 X114.854 Y90.104 E7.82497 F1800
+G1 X114.483 Y89.939 E7.83850 F6000
+G1 X111.348 Y87.525 E7.97026 F6000
+G1 X111.081 Y87.216 E7.98386 F6000
+G1 X114.116 Y88.267 E8.09081 F4800
+G1 X111.015 Y89.958 E8.20842 F6000
+G1 X112.257 Y90.099 E8.25003 F4800
+G1 X112.073 Y89.587 E8.26813 F6000
+G1 X112.205 Y90.402 E8.29563 F1800
+G1 X114.045 Y89.627 E8.36210 F9000
+G1 X114.416 Y88.216 E8.41067 F6000
+G1 X112.698 Y83.833 E8.56743 F9000
+G1 X113.596 Y80.549 E8.68079 F4800
+G1 X112.956 Y80.278 E8.70394 F9000
+G1 X112.440 Y77.859 E8.78629 F3000
+G1 X112.503 Y77.451 E8.80003 F1800
+G1 X109.410 Y76.128 E8.91206 F6000
+G1 X109.545 Y76.411 E8.92248 F1800
+G1 X110.287 Y76.531 E8.94753 F6000
+G1 X112.747 Y72.442 E9.10643 F9000
+G1 X112.556 Y73.038 E9.12728 F9000
+G1 X108.932 Y72.780 E9.24825 F1800
+G1 X108.292 Y72.552 E9.27088 F9000
+G1 X109.920 Y73.210 E9.32937 F9000
+G1 X110.162 Y73.727 E9.34839 F3000
+G1 X108.715 Y71.838 E9.42764 F6000
+G1 X108.659 Y74.915 E9.53011 F4800
+G1 X104.124 Y73.229 E9.69123 F6000
+G1 X99.253 Y73.220 E9.85342 F6000
+G1 X101.939 Y69.191 E10.01466 F6000
+G1 X100.549 Y65.623 E10.14218 F9000
+G1 X100.174 Y64.751 E10.17380 F6000
+G1 X100.907 Y64.200 E10.20433 F1800
+G1 X98.387 Y64.232 E10.28828 F9000
+G1 X101.258 Y63.313 E10.38868 F3000
+G1 X103.755 Y66.191 E10.51554 F3000
+G1 X102.285 Y65.314 E10.57253 F3000
+G1 X103.942 Y63.078 E10.66519 F4800
+G1 X101.900 Y59.287 E10.80856 F9000
+G1 X103.722 Y56.896 E10.90867 F4800
+G1 X105.009 Y55.824 E10.96444 F4800
+G1 X102.989 Y56.086 E11.03228 F3000
+G1 X101.770 Y55.514 E11.07711 F6000
+G1 X101.905 Y54.634 E11.10672 F6000
+G1 X101.548 Y53.502 E11.14627 F9000
+G1 X103.649 Y49.930 E11.28426 F9000
+G1 X108.539 Y50.792 E11.44961 F1800
+G1 X109.856 Y49.129 E11.52024 F1800
+G1 X108.581 Y49.394 E11.56360 F3000
+G1 X106.236 Y46.239 E11.69451 F1800
+G1 X110.391 Y45.137 E11.83766 F3000
+G1 X113.417 Y42.639 E11.96832 F3000
+G1 X114.794 Y45.946 E12.08763 F1800
+G1 X115.945 Y45.107 E12.13505 F1800
+G1 X115.079 Y47.164 E12.20937 F1800
+G1 X116.162 Y48.155 E12.25825 F4800
+G1 X118.473 Y48.689 E12.33722 F4800
+G1 X120.278 Y48.767 E12.39739 F6000
+G1 X119.860 Y49.161 E12.41651 F9000
+G1 X119.738 Y46.612 E12.50149 F3000
+G1 X118.996 Y46.400 E12.52720 F4800
+G1 X121.016 Y47.449 E12.60300 F6000
+G1 X124.479 Y44.479 E12.75492 F1800
+G1 X120.969 Y43.863 E12.87358 F4800
+G1 X121.044 Y42.246 E12.92748 F4800
+G1 X124.744 Y45.198 E13.08510 F4800
+G1 X123.451 Y42.744 E13.17746 F1800
+G1 X122.133 Y40.454 E13.26543 F1800
+G1 X122.822 Y43.842 E13.38055 F9000
+G1 X122.662 Y40.546 E13.49044 F3000
+G1 X124.588 Y44.581 E13.63934 F6000
+G1 X127.931 Y47.846 E13.79495 F3000
+G1 X130.827 Y46.273 E13.90470 F9000
+G1 X129.387 Y47.063 E13.95940 F3000
+G1 X127.747 Y47.510 E14.01600 F3000
+G1 X127.549 Y46.822 E14.03983 F3000
+G1 X127.628 Y44.016 E14.13331 F6000
+G1 X126.693 Y45.158 E14.18246 F6000
+G1 X127.501 Y45.440 E14.21094 F6000
+G1 X126.115 Y45.399 E14.25711 F9000
+G1 X125.021 Y46.825 E14.31698 F6000
+G1 X121.151 Y48.131 E14.45297 F1800
+G1 X118.582 Y51.535 E14.59500 F1800
+G1 X120.340 Y54.006 E14.69598 F1800
+G1 X116.141 Y52.209 E14.84809 F1800
+G1 X116.582 Y53.225 E14.88499 F6000
+G1 X115.582 Y51.404 E14.95417 F3000
+G1 X114.826 Y50.911 E14.98425 F6000
+G1 X115.665 Y48.224 E15.07797 F3000
+G1 X114.601 Y47.737 E15.11693 F4800
+G1 X113.505 Y48.911 E15.17043 F6000
+G1 X117.193 Y45.906 E15.32883 F6000
+G1 X115.361 Y50.071 E15.48033 F4800
+G1 X112.096 Y46.431 E15.64315 F4800
+G1 X114.796 Y44.356 E15.75653 F1800
+G1 X111.830 Y42.162 E15.87936 F1800
+G1 X114.818 Y44.556 E16.00686 F3000
+G1 X112.108 Y44.694 E16.09722 F6000
+G1 X113.356 Y48.447 E16.22890 F3000
+G1 X115.888 Y49.047 E16.31555 F6000
+G1 X117.080 Y50.053 E16.36748 F3000
+G1 X119.716 Y53.066 E16.50080 F9000
+G1 X120.002 Y52.917 E16.51153 F9000
+G1 X120.062 Y53.487 E16.53064 F9000
+G1 X121.879 Y53.704 E16.59158 F4800
+G1 X124.307 Y51.136 E16.70928 F3000
+G1 X128.005 Y53.184 E16.85006 F1800
+G1 X127.209 Y49.519 E16.97495 F4800
+G1 X128.393 Y49.503 E17.01440 F1800
+G1 X129.874 Y47.746 E17.09091 F3000
+G1 X129.153 Y47.814 E17.11501 F1800
+G1 X125.581 Y50.130 E17.25678 F3000
+G1 X123.662 Y51.687 E17.33909 F1800
+G1 X121.497 Y51.168 E17.41322 F6000
+G1 X120.679 Y53.456 E17.49411 F6000
+G1 X118.470 Y54.357 E17.57355 F1800
+G1 X118.099 Y52.431 E17.63886 F4800
+G1 X116.267 Y53.055 E17.70331 F6000
+G1 X116.301 Y53.265 E17.71040 F3000
+G1 X116.194 Y55.236 E17.77614 F6000
+G1 X115.252 Y55.033 E17.80823 F1800
+G1 X116.273 Y56.912 E17.87943 F3000
+G1 X115.706 Y56.254 E17.90835 F9000
+G1 X116.960 Y58.478 E17.99337 F1800
+G1 X118.122 Y56.687 E18.06447 F4800
+G1 X115.130 Y58.646 E18.18356 F1800
+G1 X115.156 Y59.033 E18.19648 F6000
+G1 X119.923 Y59.839 E18.35747 F3000
+G1 X120.033 Y61.903 E18.42632 F3000
+G1 X121.659 Y64.645 E18.53247 F4800
+G1 X124.265 Y63.053 E18.63414 F4800
+G1 X123.640 Y66.985 E18.76673 F6000
+G1 X124.816 Y62.315 E18.92711 F6000
+G1 X124.816 Y63.791 E18.97625 F4800
+G1 X123.539 Y62.446 E19.03802 F1800
+G1 X125.685 Y63.245 E19.11427 F1800
+G1 X125.503 Y63.125 E19.12151 F1800
+G1 X125.380 Y62.861 E19.13122 F9000
+G1 X125.827 Y62.966 E19.14651 F9000
+G1 X126.769 Y62.284 E19.18524 F6000
+G1 X125.431 Y64.392 E19.26841 F4800
+G1 X125.770 Y64.259 E19.28054 F4800
+G1 X125.802 Y61.028 E19.38814 F6000
+G1 X127.172 Y61.870 E19.44170 F6000
+G1 X128.729 Y63.237 E19.51067 F4800
+G1 X124.896 Y62.342 E19.64174 F6000
+G1 X126.606 Y65.680 E19.76665 F6000
+G1 X128.070 Y63.228 E19.86176 F3000
+G1 X126.644 Y64.891 E19.93471 F3000
+G1 X123.286 Y66.112 E20.05369 F4800
+G1 X123.163 Y67.119 E20.08748 F9000
+G1 X126.215 Y65.316 E20.20554 F6000
+G1 X127.202 Y65.587 E20.23964 F1800
+G1 X127.485 Y65.012 E20.26101 F1800
+G1 X126.171 Y67.801 E20.36368 F1800
+G1 X129.341 Y64.768 E20.50976 F6000
+G1 X125.068 Y65.683 E20.65529 F4800
+G1 X125.276 Y65.679 E20.66221 F3000
+G1 X121.415 Y68.509 E20.82163 F1800
+G1 X120.521 Y69.948 E20.87805 F6000
+G1 X123.417 Y71.562 E20.98847 F3000
+G1 X121.565 Y67.034 E21.15140 F3000
+G1 X121.345 Y66.903 E21.15992 F3000
+G1 X121.064 Y68.071 E21.19995 F9000
+G1 X118.453 Y67.815 E21.28732 F9000
+G1 X116.591 Y71.843 E21.43510 F3000
+G1 X113.470 Y72.490 E21.54124 F1800
+G1 X113.808 Y71.832 E21.56589 F1800
+G1 X114.242 Y71.299 E21.58876 F4800
+G1 X116.330 Y72.548 E21.66978 F3000
+G1 X117.913 Y69.464 E21.78524 F1800
+G1 X115.490 Y66.466 E21.91360 F4800
+G1 X112.726 Y68.399 E22.02592 F1800
+G1 X111.494 Y72.973 E22.18364 F6000
+G1 X111.965 Y71.881 E22.22323 F9000
+G1 X113.599 Y71.959 E22.27773 F1800
+G1 X112.989 Y72.899 E22.31507 F1800
+G1 X116.092 Y71.292 E22.43143 F4800
+G1 X113.161 Y72.836 E22.54174 F9000
+G1 X111.772 Y72.672 E22.58834 F1800
+G1 X110.615 Y74.622 E22.66386 F1800
+G1 X110.604 Y76.374 E22.72219 F3000
+G1 X109.953 Y72.024 E22.86866 F9000
+G1 X106.434 Y72.844 E22.98901 F6000
+G1 X105.680 Y73.669 E23.02622 F9000
+G1 X108.079 Y72.883 E23.11028 F6000
+G1 X105.114 Y73.460 E23.21085 F1800
+G1 X103.891 Y77.982 E23.36683 F3000
+G1 X104.153 Y77.772 E23.37801 F3000
+G1 X103.413 Y80.362 E23.46770 F6000
+G1 X107.068 Y81.314 E23.59347 F4800
+G1 X106.688 Y81.334 E23.60615 F6000
+G1 X106.500 Y77.554 E23.73217 F4800
+G1 X107.952 Y79.377 E23.80981 F6000
+G1 X106.838 Y79.788 E23.84934 F6000
+G1 X107.123 Y76.237 E23.96795 F6000
+G1 X111.493 Y75.675 E24.11466 F4800
+G1 X113.618 Y74.877 E24.19026 F6000
+G1 X108.691 Y75.686 E24.35653 F3000
+G1 X105.960 Y78.998 E24.49948 F4800
+G1 X107.919 Y79.365 E24.56584 F4800
+G1 X108.491 Y77.841 E24.62004 F3000
+G1 X110.929 Y76.696 E24.70975 F1800
+G1 X112.792 Y78.717 E24.80126 F9000
+G1 X117.511 Y79.339 E24.95978 F1800
+G1 X118.623 Y83.073 E25.08952 F6000
+G1 X115.662 Y86.895 E25.25053 F4800
+G1 X116.028 Y86.847 E25.26280 F3000
+G1 X116.136 Y88.372 E25.31371 F4800
+G1 X117.721 Y85.712 E25.41683 F1800
+G1 X116.336 Y86.162 E25.46532 F6000
+G1 X115.074 Y86.874 E25.51360 F1800
+G1 X115.446 Y86.944 E25.52622 F3000
+G1 X118.927 Y84.812 E25.66212 F3000
+G1 X122.537 Y83.727 E25.78765 F6000
+G1 X118.354 Y83.495 E25.92714 F9000
+G1 X118.541 Y83.703 E25.93645 F1800
+G1 X121.809 Y84.055 E26.04590 F6000
+G1 X118.485 Y84.743 E26.15894 F9000
+G1 X116.513 Y84.554 E26.22490 F3000
+G1 X116.363 Y85.087 E26.24335 F3000
+G1 X119.186 Y84.947 E26.33745 F6000
+G1 X119.538 Y82.642 E26.41510 F4800
+G1 X120.313 Y80.400 E26.49409 F9000
+G1 X121.272 Y81.818 E26.55108 F9000
+G1 X123.732 Y82.412 E26.63536 F3000
+G1 X125.920 Y78.286 E26.79088 F9000
+G1 X125.668 Y79.987 E26.84813 F9000
+G1 X123.251 Y79.206 E26.93273 F4800
+G1 X124.096 Y75.482 E27.05987 F4800
+G1 X126.823 Y77.529 E27.17341 F4800
+G1 X129.305 Y78.062 E27.25791 F6000
+G1 X130.867 Y82.409 E27.41174 F3000
+G1 X128.187 Y78.524 E27.56889 F6000
+G1 X127.581 Y79.897 E27.61885 F1800
+G1 X129.198 Y79.301 E27.67624 F6000
+G1 X128.849 Y79.175 E27.68859 F6000
+G1 X128.842 Y84.080 E27.85192 F1800
+G1 X124.052 Y84.224 E28.01151 F1800
+G1 X123.811 Y83.511 E28.03657 F1800
+G1 X121.008 Y80.484 E28.17395 F1800
+G1 X125.566 Y78.749 E28.33635 F1800
+G1 X121.095 Y80.810 E28.50029 F6000
+G1 X120.779 Y83.614 E28.59425 F1800
+G1 X121.935 Y85.871 E28.67868 F3000
+G1 X124.740 Y89.449 E28.83008 F3000
+G1 X123.840 Y87.178 E28.91143 F6000
+G1 X123.308 Y86.474 E28.94083 F1800
+G1 X124.668 Y89.379 E29.04764 F4800
+G1 X126.205 Y93.232 E29.18580 F3000
+G1 X130.793 Y94.685 E29.34603 F9000
+G1 X131.669 Y98.524 E29.47717 F6000
+G1 X127.866 Y101.676 E29.64168 F4800
+G1 X128.462 Y102.136 E29.66673 F4800
+G1 X129.783 Y103.489 E29.72972 F9000
+G1 X130.776 Y104.010 E29.76707 F4800
+G1 X135.679 Y103.915 E29.93036 F3000
+G1 X138.273 Y105.024 E30.02430 F6000
+G1 X141.662 Y107.612 E30.16632 F6000
+G1 X143.503 Y107.861 E30.22819 F6000
+G1 X141.299 Y106.843 E30.30902 F9000
+G1 X140.987 Y107.704 E30.33952 F6000
+G1 X141.566 Y106.696 E30.37822 F9000
+G1 X140.493 Y110.340 E30.50470 F3000
+G1 X139.139 Y114.444 E30.64863 F3000
+G1 X137.412 Y118.307 E30.78954 F3000
+G1 X142.038 Y119.910 E30.95259 F6000
+G1 X141.245 Y119.216 E30.98768 F9000
+G1 X145.603 Y119.598 E31.13336 F6000
+G1 X149.089 Y119.413 E31.24959 F9000
+G1 X148.592 Y117.976 E31.30023 F6000
+G1 X146.348 Y117.394 E31.37741 F3000
+G1 X145.296 Y116.722 E31.41900 F6000
+G1 X143.304 Y116.642 E31.48536 F4800
+G1 X140.301 Y114.708 E31.60431 F4800
+G1 X143.029 Y111.502 E31.74447 F4800
+G1 X144.639 Y111.258 E31.79870 F3000
+G1 X146.501 Y113.078 E31.88541 F4800
+G1 X146.316 Y111.697 E31.93181 F6000
+G1 X148.639 Y111.208 E32.01086 F6000
+G1 X146.621 Y114.644 E32.14358 F3000
+G1 X149.347 Y114.413 E32.23471 F6000
+G1 X149.795 Y114.397 E32.24961 F6000
+G1 X145.986 Y116.324 E32.39173 F4800
+G1 X149.992 Y117.891 E32.53497 F6000
+G1 X150.127 Y118.433 E32.55359 F9000
+G1 X150.751 Y121.198 E32.64796 F1800
+G1 X146.790 Y123.028 E32.79327 F9000
+G1 X145.731 Y124.284 E32.84798 F9000
+G1 X144.139 Y125.956 E32.92485 F1800
+G1 X143.361 Y125.500 E32.95488 F3000
+G1 X143.870 Y125.500 E32.97182 F1800
+G1 X144.248 Y125.955 E32.99151 F4800
+G1 X143.197 Y126.408 E33.02964 F1800
+G1 X138.712 Y125.293 E33.18356 F9000
+G1 X136.882 Y125.959 E33.24840 F3000
+G1 X133.639 Y127.210 E33.36414 F1800
+G1 X128.994 Y126.933 E33.51910 F3000
+G1 X124.574 Y127.623 E33.66807 F4800
+G1 X123.852 Y127.375 E33.69348 F3000
+G1 X123.359 Y127.021 E33.71370 F1800
+G1 X123.939 Y125.068 E33.78155 F6000
+G1 X124.474 Y124.128 E33.81757 F4800
+G1 X125.225 Y125.036 E33.85678 F6000
+G1 X121.146 Y122.586 E34.01524 F4800
+G1 X120.533 Y122.846 E34.03741 F1800
+G1 X124.587 Y124.581 E34.18427 F4800
+G1 X124.812 Y124.680 E34.19245 F6000
+G1 X127.568 Y122.995 E34.30003 F1800
+G1 X128.396 Y121.407 E34.35969 F6000
+G1 X129.342 Y120.536 E34.40247 F4800
+G1 X129.961 Y122.523 E34.47177 F1800
+G1 X132.506 Y123.384 E34.56123 F9000
+G1 X129.584 Y122.945 E34.65962 F1800
+G1 X131.347 Y126.691 E34.79749 F9000
+G1 X129.877 Y127.815 E34.85911 F6000
+G1 X128.432 Y125.492 E34.95023 F3000
+G1 X126.778 Y124.674 E35.01167 F9000
+G1 X128.625 Y126.714 E35.10330 F9000
+G1 X126.925 Y126.520 E35.16028 F9000
+G1 X129.265 Y123.600 E35.28491 F3000
+G1 X125.804 Y124.796 E35.40686 F4800
+G1 X124.041 Y122.927 E35.49241 F3000
+G1 X124.323 Y123.565 E35.51563 F6000
+G1 X127.671 Y126.698 E35.66831 F6000
+G1 X128.609 Y125.264 E35.72539 F1800
+G1 X127.965 Y126.490 E35.77151 F1800
+G1 X128.128 Y128.444 E35.83682 F3000
+G1 X128.744 Y129.705 E35.88355 F4800
+G1 X133.315 Y131.282 E36.04457 F1800
+G1 X133.752 Y132.881 E36.09979 F3000
+G1 X132.486 Y132.335 E36.14569 F3000
+G1 X133.223 Y135.675 E36.25957 F9000
+G1 X133.609 Y139.136 E36.37556 F9000
+G1 X131.413 Y140.857 E36.46846 F9000
+G1 X132.141 Y142.336 E36.52336 F4800
+G1 X135.874 Y143.706 E36.65577 F6000
+G1 X132.900 Y143.890 E36.75497 F4800
+G1 X130.703 Y143.617 E36.82870 F6000
+G1 X131.428 Y147.676 E36.96602 F6000
+G1 X128.605 Y151.777 E37.13181 F6000
+G1 X128.643 Y151.027 E37.15682 F6000
+G1 X126.675 Y154.178 E37.28054 F9000
+G1 X125.862 Y155.868 E37.34298 F3000
+G1 X127.338 Y153.858 E37.42601 F9000
+G1 X130.011 Y157.633 E37.58003 F4800
+G1 X127.017 Y157.771 E37.67985 F3000
+G1 X124.466 Y155.273 E37.79872 F9000
+G1 X121.960 Y153.618 E37.89875 F4800
+G1 X117.182 Y152.344 E38.06340 F4800
+G1 X119.161 Y151.316 E38.13767 F9000
+G1 X118.985 Y149.441 E38.20038 F6000
+G1 X118.252 Y150.221 E38.23604 F4800
+G1 X117.315 Y147.477 E38.33262 F6000
+G1 X116.911 Y145.768 E38.39107 F3000
+G1 X115.351 Y149.101 E38.51360 F3000
+G1 X112.998 Y148.478 E38.59464 F6000
+G1 X111.149 Y147.841 E38.65976 F1800
+G1 X108.350 Y145.627 E38.77860 F3000
+G1 X107.348 Y145.595 E38.81198 F1800
+G1 X106.626 Y145.350 E38.83739 F6000
+G1 X108.439 Y143.384 E38.92645 F6000
+G1 X108.060 Y145.857 E39.00976 F4800
+G1 X108.238 Y147.298 E39.05811 F3000
+G1 X110.594 Y146.499 E39.14097 F6000
+G1 X111.779 Y148.076 E39.20666 F3000
+G1 X111.415 Y152.004 E39.33804 F3000
+G1 X110.725 Y150.803 E39.38417 F4800
+G1 X111.668 Y147.204 E39.50806 F1800
+G1 X114.581 Y149.281 E39.62718 F1800
+G1 X114.950 Y151.646 E39.70690 F1800
+G1 X113.160 Y155.065 E39.83541 F3000
+G1 X115.625 Y155.741 E39.92053 F9000
+G1 X118.656 Y159.094 E40.07103 F6000
+G1 X118.571 Y156.475 E40.15827 F9000
+G1 X114.923 Y158.258 E40.29349 F4800
+G1 X114.499 Y159.704 E40.34368 F6000
+G1 X114.699 Y159.993 E40.35537 F6000
+G1 X113.927 Y159.055 E40.39581 F3000
+G1 X109.154 Y158.908 E40.55482 F4800
+G1 X109.297 Y155.696 E40.66190 F9000
+G1 X109.171 Y151.076 E40.81578 F3000
+G1 X110.088 Y151.916 E40.85720 F1800
+G1 X106.361 Y152.278 E40.98189 F3000
+G1 X107.711 Y153.494 E41.04239 F9000
+G1 X107.537 Y152.061 E41.09046 F1800
+G1 X104.390 Y148.921 E41.23848 F3000
+G1 X107.322 Y150.923 E41.35669 F9000
+G1 X105.474 Y152.436 E41.43620 F9000
+G1 X104.496 Y152.804 E41.47101 F1800
+G1 X107.641 Y154.283 E41.58675 F6000
+G1 X107.812 Y154.597 E41.59863 F9000
+G1 X107.189 Y150.439 E41.73864 F4800
+G1 X110.442 Y152.853 E41.87352 F6000
+G1 X113.205 Y153.055 E41.96579 F4800
+G1 X111.590 Y151.393 E42.04296 F3000
+G1 X112.166 Y149.628 E42.10481 F3000
+G1 X113.308 Y151.370 E42.17417 F6000
+G1 X112.124 Y154.072 E42.27239 F9000
+G1 X111.437 Y152.886 E42.31801 F1800
+G1 X111.760 Y152.937 E42.32891 F4800
+G1 X112.158 Y155.283 E42.40816 F9000
+G1 X111.786 Y159.122 E42.53660 F9000
+G1 X115.099 Y156.061 E42.68681 F3000
+G1 X112.873 Y155.757 E42.76166 F4800
+G1 X113.198 Y154.756 E42.79673 F6000
+G1 X112.519 Y154.755 E42.81933 F9000
+G1 X113.363 Y154.413 E42.84964 F9000
+G1 X116.872 Y157.972 E43.01607 F3000
+G1 X116.461 Y155.277 E43.10682 F4800
+G1 X118.331 Y157.080 E43.19332 F6000
+G1 X119.546 Y153.528 E43.31833 F6000
+G1 X119.854 Y153.568 E43.32867 F9000
+G1 X123.453 Y153.674 E43.44858 F6000
+G1 X123.810 Y153.434 E43.46290 F4800
+G1 X122.978 Y155.758 E43.54511 F4800
+G1 X123.705 Y151.776 E43.67992 F4800
+G1 X123.265 Y151.331 E43.70074 F1800
+G1 X125.885 Y153.603 E43.81624 F3000
+G1 X129.153 Y155.494 E43.94195 F9000
+G1 X129.117 Y151.825 E44.06411 F3000
+G1 X128.710 Y151.389 E44.08398 F4800
+G1 X123.906 Y151.012 E44.24444 F1800
+G1 X121.968 Y151.062 E44.30901 F6000
+G1 X123.957 Y150.067 E44.38308 F4800
+G1 X122.029 Y149.296 E44.45222 F6000
+G1 X119.426 Y153.212 E44.60881 F4800
+G1 X118.144 Y156.729 E44.73344 F4800
+G1 X119.011 Y153.040 E44.85963 F3000
+G1 X116.931 Y155.632 E44.97027 F6000
+G1 X119.329 Y154.965 E45.05314 F3000
+G1 X118.747 Y151.940 E45.15571 F3000
+G1 X119.180 Y151.935 E45.17013 F6000
+G1 X119.238 Y153.005 E45.20582 F1800
+G1 X116.639 Y149.227 E45.35850 F6000
+G1 X116.495 Y153.666 E45.50642 F9000
+G1 X114.715 Y152.732 E45.57336 F1800
+G1 X112.000 Y155.830 E45.71053 F6000
+G1 X109.589 Y158.613 E45.83316 F4800
+G1 X108.737 Y158.473 E45.86188 F3000
+G1 X108.772 Y158.126 E45.87349 F6000
+G1 X108.674 Y157.434 E45.89674 F6000
+G1 X106.676 Y157.709 E45.96390 F9000
+G1 X103.745 Y156.579 E46.06850 F6000
+G1 X101.136 Y158.602 E46.17843 F3000
+G1 X102.112 Y158.026 E46.21616 F1800
+G1 X102.966 Y157.915 E46.24486 F9000
+G1 X103.600 Y157.451 E46.27103 F9000
+G1 X102.579 Y152.956 E46.42452 F9000
+G1 X105.374 Y149.365 E46.57605 F6000
+G1 X106.329 Y149.317 E46.60791 F6000
+G1 X103.124 Y149.361 E46.71466 F9000
+G1 X104.401 Y148.742 E46.76191 F1800
+G1 X102.846 Y147.747 E46.82340 F9000
+G1 X99.173 Y150.965 E46.98604 F4800
+G1 X99.550 Y152.097 E47.02575 F6000
+G1 X99.599 Y153.359 E47.06783 F4800
+G1 X100.184 Y157.847 E47.21853 F4800
+G1 X96.531 Y156.439 E47.34889 F9000
+G1 X95.553 Y152.870 E47.47213 F1800
+G1 X93.924 Y152.794 E47.52644 F3000
+G1 X97.414 Y151.254 E47.65347 F9000
+G1 X98.679 Y151.857 E47.70015 F3000
+G1 X98.210 Y153.650 E47.76187 F3000
+G1 X102.009 Y151.078 E47.91465 F9000
+G1 X102.474 Y148.743 E47.99392 F4800
+G1 X106.735 Y150.314 E48.14518 F4800
+G1 X103.056 Y148.342 E48.28421 F9000
+G1 X104.472 Y152.748 E48.43834 F4800
+G1 X104.106 Y153.256 E48.45917 F6000
+G1 X105.803 Y151.996 E48.52955 F4800
+G1 X106.901 Y148.215 E48.66066 F3000
+G1 X106.896 Y149.011 E48.68717 F9000
+G1 X107.638 Y149.727 E48.72152 F4800
+G1 X107.075 Y150.570 E48.75529 F4800
+G1 X110.840 Y151.730 E48.88650 F9000
+G1 X108.766 Y151.152 E48.95820 F4800
+G1 X108.488 Y151.050 E48.96806 F6000
+G1 X108.901 Y148.786 E49.04469 F3000
+G1 X108.128 Y148.871 E49.07058 F3000
+G1 X105.196 Y152.016 E49.21377 F4800
+G1 X103.218 Y153.817 E49.30285 F6000
+G1 X101.846 Y155.183 E49.36730 F4800
+G1 X101.309 Y150.531 E49.52325 F4800
+G1 X98.751 Y150.868 E49.60916 F6000
+G1 X99.305 Y150.904 E49.62766 F4800
+G1 X101.223 Y155.424 E49.79119 F1800
+G1 X100.668 Y154.554 E49.82557 F4800
+G1 X99.910 Y156.341 E49.89020 F1800
+G1 X102.168 Y152.731 E50.03200 F1800
+G1 X102.620 Y152.673 E50.04716 F6000
+G1 X104.286 Y155.493 E50.15625 F9000
+G1 X100.688 Y156.625 E50.28184 F1800
+G1 X104.137 Y156.603 E50.39669 F9000
+G1 X104.097 Y155.881 E50.42077 F1800
+G1 X103.507 Y154.873 E50.45964 F1800
+G1 X102.862 Y158.190 E50.57218 F1800
+G1 X102.996 Y157.774 E50.58674 F6000
+G1 X105.573 Y158.396 E50.67502 F3000
+G1 X106.650 Y156.322 E50.75282 F9000
+G1 X106.072 Y157.968 E50.81090 F1800
+G1 X108.346 Y155.216 E50.92978 F1800
+G1 X108.968 Y158.168 E51.03024 F3000
+G1 X108.404 Y156.381 E51.09263 F9000
+G1 X105.023 Y155.911 E51.20628 F3000
+G1 X101.674 Y152.774 E51.35911 F4800
+G1 X102.659 Y151.576 E51.41075 F3000
+G1 X102.810 Y148.765 E51.50450 F4800
+G1 X100.894 Y149.551 E51.57347 F9000
+G1 X103.209 Y148.030 E51.66573 F4800
+G1 X101.208 Y151.351 E51.79486 F3000
+G1 X101.050 Y151.882 E51.81330 F6000
+G1 X100.662 Y148.854 E51.91494 F6000
+G1 X103.250 Y148.286 E52.00315 F3000
+G1 X106.071 Y146.768 E52.10985 F1800
+G1 X104.500 Y145.615 E52.17478 F1800
+G1 X103.087 Y143.675 E52.25468 F9000
+G1 X103.037 Y148.144 E52.40349 F9000
+G1 X100.506 Y147.775 E52.48867 F3000
+G1 X103.374 Y143.688 E52.65493 F1800
+G1 X103.693 Y143.241 E52.67323 F6000
+G1 X104.123 Y141.186 E52.74314 F3000
+G1 X104.553 Y142.581 E52.79175 F3000
+G1 X108.961 Y141.437 E52.94341 F4800
+G1 X110.015 Y141.440 E52.97850 F3000
+G1 X109.067 Y140.491 E53.02317 F9000
+G1 X110.511 Y141.825 E53.08861 F3000
+G1 X111.830 Y138.667 E53.20256 F1800
+G1 X111.080 Y140.135 E53.25743 F9000
+G1 X114.916 Y141.238 E53.39035 F4800
+G1 X115.134 Y140.203 E53.42556 F6000
+G1 X112.909 Y138.891 E53.51157 F9000
+G1 X111.569 Y139.094 E53.55669 F3000
+G1 X109.731 Y138.460 E53.62145 F9000
+G1 X113.434 Y140.321 E53.75947 F3000
+G1 X114.365 Y140.547 E53.79137 F1800
+G1 X115.296 Y142.260 E53.85631 F3000
+G1 X112.682 Y142.648 E53.94430 F9000
+G1 X116.203 Y144.094 E54.07104 F3000
+G1 X115.455 Y142.534 E54.12867 F9000
+G1 X115.143 Y143.894 E54.17515 F4800
+G1 X114.339 Y143.456 E54.20562 F6000
+G1 X113.307 Y141.577 E54.27702 F6000
+G1 X117.033 Y139.557 E54.41816 F9000
+G1 X121.062 Y141.793 E54.57161 F6000
+G1 X120.792 Y142.537 E54.59796 F3000
+G1 X124.714 Y141.612 E54.73216 F6000
+G1 X124.637 Y139.512 E54.80216 F6000
+G1 X124.848 Y136.021 E54.91860 F6000
+G1 X126.270 Y136.411 E54.96769 F4800
+G1 X128.114 Y140.577 E55.11941 F4800
+G1 X130.836 Y137.995 E55.24436 F3000
+G1 X130.199 Y136.193 E55.30800 F9000
+G1 X130.716 Y140.929 E55.46664 F6000
+G1 X129.412 Y142.319 E55.53010 F9000
+G1 X130.464 Y143.954 E55.59485 F1800
+G1 X130.495 Y144.908 E55.62662 F4800
+G1 X131.490 Y147.671 E55.72442 F6000
+G1 X135.303 Y147.185 E55.85244 F9000
+G1 X131.553 Y144.916 E55.99838 F3000
+G1 X131.570 Y142.774 E56.06974 F4800
+G1 X135.409 Y142.552 E56.19782 F6000
+G1 X137.093 Y143.655 E56.26484 F1800
+G1 X138.030 Y147.373 E56.39254 F9000
+G1 X135.439 Y150.425 E56.52585 F4800
+G1 X133.955 Y154.717 E56.67707 F6000
+G1 X131.564 Y151.619 E56.80738 F3000
+G1 X129.894 Y149.522 E56.89664 F4800
+G1 X131.633 Y149.365 E56.95480 F9000
+G1 X131.717 Y147.832 E57.00593 F3000
+G1 X132.950 Y151.142 E57.12358 F6000
+G1 X132.248 Y150.139 E57.16436 F3000
+G1 X130.277 Y149.849 E57.23070 F9000
+G1 X130.160 Y151.228 E57.27677 F1800
+G1 X130.889 Y151.148 E57.30120 F9000
+G1 X131.171 Y151.070 E57.31095 F9000
+G1 X127.522 Y153.289 E57.45317 F9000
+G1 X123.019 Y151.928 E57.60980 F4800
+G1 X122.432 Y151.382 E57.63650 F9000
+G1 X125.524 Y154.759 E57.78895 F3000
+G1 X126.356 Y152.433 E57.87119 F6000
+G1 X126.262 Y153.782 E57.91622 F9000
+G1 X126.601 Y149.949 E58.04436 F1800
+G1 X127.259 Y151.736 E58.10776 F9000
+G1 X125.203 Y147.867 E58.25366 F9000
+G1 X121.273 Y149.972 E58.40211 F9000
+G1 X119.586 Y151.341 E58.47446 F4800
+G1 X116.815 Y154.894 E58.62451 F6000
+G1 X118.312 Y152.981 E58.70536 F3000
+G1 X119.588 Y153.592 E58.75247 F1800
+G1 X119.538 Y154.118 E58.77005 F3000
+G1 X117.958 Y153.116 E58.83235 F3000
+G1 X115.139 Y151.581 E58.93922 F4800
+G1 X115.427 Y151.254 E58.95371 F1800
+G1 X115.632 Y151.217 E58.96064 F3000
+G1 X113.267 Y148.858 E59.07188 F1800
+G1 X113.576 Y149.823 E59.10561 F1800
+G1 X115.963 Y154.092 E59.26849 F6000
+G1 X116.655 Y154.195 E59.29180 F4800
+G1 X117.711 Y158.023 E59.42404 F6000
+G1 X117.848 Y157.313 E59.44812 F1800
+G1 X117.010 Y154.544 E59.54445 F4800
+G1 X115.033 Y150.760 E59.68663 F3000
+G1 X114.451 Y150.970 E59.70724 F4800
+G1 X116.726 Y152.084 E59.79159 F3000
+G1 X117.532 Y153.081 E59.83429 F6000
+G1 X116.759 Y157.472 E59.98276 F1800
+G1 X117.735 Y156.601 E60.02631 F4800
+G1 X118.568 Y154.894 E60.08959 F1800
+G1 X117.955 Y154.147 E60.12174 F9000
+G1 X118.675 Y154.265 E60.14601 F3000
+G1 X121.779 Y151.277 E60.28952 F3000
+G1 X117.639 Y149.785 E60.43608 F3000
+G1 X115.540 Y148.993 E60.51078 F1800
+G1 X114.903 Y151.205 E60.58743 F9000
+G1 X114.145 Y151.395 E60.61344 F9000
+G1 X111.959 Y149.189 E60.71687 F3000
+G1 X112.621 Y153.593 E60.86517 F9000
+G1 X112.533 Y154.391 E60.89189 F6000
+G1 X114.557 Y154.734 E60.96023 F3000
+G1 X110.362 Y153.544 E61.10544 F3000
+G1 X114.312 Y156.009 E61.26047 F1800
+G1 X114.702 Y155.041 E61.29523 F4800
+G1 X116.432 Y151.294 E61.43264 F4800
+G1 X112.940 Y151.956 E61.55100 F4800
+G1 X116.975 Y154.064 E61.70258 F4800
+G1 X116.559 Y153.791 E61.71914 F4800
+G1 X116.346 Y154.274 E61.73669 F4800
+G1 X119.518 Y157.232 E61.88111 F9000
+G1 X122.740 Y156.999 E61.98869 F6000
+G1 X122.290 Y155.004 E62.05679 F4800
+G1 X119.931 Y158.542 E62.19837 F4800
+G1 X118.865 Y154.944 E62.32330 F4800
+G1 X119.196 Y153.341 E62.37783 F6000
+G1 X119.997 Y154.525 E62.42545 F9000
+G1 X120.783 Y157.857 E62.53944 F1800
+G1 X124.477 Y154.767 E62.69981 F9000
+G1 X127.072 Y152.131 E62.82298 F9000
+G1 X127.133 Y148.655 E62.93874 F3000
+G1 X127.796 Y152.267 E63.06103 F6000
+G1 X124.516 Y153.030 E63.17318 F4800
+G1 X125.658 Y149.093 E63.30966 F3000
+G1 X127.652 Y151.953 E63.42576 F9000
+G1 X128.679 Y151.970 E63.45998 F6000
+G1 X126.184 Y154.546 E63.57942 F9000
+G1 X127.499 Y151.018 E63.70482 F9000
+G1 X122.941 Y149.142 E63.86896 F9000
+G1 X119.428 Y152.420 E64.02896 F1800
+G1 X118.690 Y149.407 E64.13227 F4800
+G1 X119.114 Y149.007 E64.15169 F6000
+G1 X118.000 Y148.083 E64.19987 F6000
+G1 X116.545 Y152.860 E64.36616 F6000
+G1 X118.438 Y149.782 E64.48649 F6000
+G1 X118.814 Y150.395 E64.51044 F6000
+G1 X118.554 Y149.208 E64.55090 F6000
+G1 X117.436 Y152.776 E64.67541 F9000
+G1 X120.875 Y152.420 E64.79055 F4800
+G1 X123.597 Y153.779 E64.89187 F3000
+G1 X123.529 Y153.383 E64.90525 F6000
+G1 X120.413 Y152.992 E65.00982 F6000
+G1 X121.874 Y151.260 E65.08527 F1800
+G1 X122.001 Y151.444 E65.09269 F6000
+G1 X120.695 Y151.867 E65.13840 F3000
+G1 X120.238 Y151.283 E65.16311 F9000
+G1 X118.237 Y153.954 E65.27423 F4800
+G1 X117.050 Y152.757 E65.33037 F1800
+G1 X115.263 Y150.325 E65.43086 F6000
+G1 X115.161 Y150.513 E65.43796 F6000
+G1 X114.046 Y145.745 E65.60102 F1800
+G1 X117.487 Y142.512 E65.75826 F1800
+G1 X121.071 Y144.555 E65.89564 F9000
+G1 X118.605 Y144.941 E65.97877 F6000
+G1 X122.877 Y145.146 E66.12118 F4800
+G1 X118.248 Y146.586 E66.28260 F9000
+G1 X119.644 Y148.201 E66.35367 F3000
+G1 X117.257 Y149.233 E66.44026 F1800
+G1 X117.935 Y149.571 E66.46548 F1800
+G1 X117.967 Y151.322 E66.52377 F6000
+G1 X118.070 Y150.911 E66.53786 F3000
+G1 X119.805 Y150.313 E66.59896 F6000
+G1 X117.783 Y147.367 E66.71795 F6000
+G1 X119.720 Y151.109 E66.85828 F4800
+G1 X121.976 Y155.297 E67.01667 F4800
+G1 X120.722 Y156.584 E67.07654 F1800
+G1 X121.605 Y156.003 E67.11176 F1800
+G1 X121.032 Y156.880 E67.14665 F3000
+G1 X125.024 Y159.542 E67.30644 F6000
+G1 X122.012 Y158.466 E67.41296 F9000
+G1 X121.842 Y159.121 E67.43547 F1800
+G1 X120.357 Y155.255 E67.57336 F9000
+G1 X120.453 Y156.971 E67.63058 F3000
+G1 X118.189 Y152.646 E67.79315 F9000
+G1 X114.659 Y152.079 E67.91220 F3000
+G1 X115.730 Y155.145 E68.02036 F4800
+G1 X116.732 Y151.451 E68.14782 F1800
+G1 X116.219 Y150.555 E68.18220 F1800
+G1 X116.259 Y152.104 E68.23379 F4800
+G1 X118.534 Y152.805 E68.31305 F4800
+G1 X117.715 Y154.242 E68.36813 F9000
+G1 X113.060 Y156.044 E68.53432 F1800
+G1 X115.326 Y153.255 E68.65399 F3000
+G1 X114.861 Y151.881 E68.70227 F6000
+G1 X115.214 Y154.199 E68.78033 F3000
+G1 X113.502 Y149.662 E68.94181 F1800
+G1 X112.749 Y149.775 E68.96714 F6000
+G1 X111.928 Y148.141 E69.02802 F3000
+G1 X112.398 Y148.295 E69.04448 F9000
+G1 X111.713 Y152.823 E69.19695 F4800
+G1 X110.722 Y153.882 E69.24524 F9000
+G1 X109.955 Y154.165 E69.27249 F3000
+G1 X107.991 Y158.691 E69.43678 F9000
+G1 X106.787 Y158.402 E69.47804 F4800
+G1 X108.381 Y156.832 E69.55257 F1800
+G1 X108.715 Y155.556 E69.59648 F9000
+G1 X110.798 Y157.617 E69.69407 F1800
+G1 X112.307 Y155.411 E69.78309 F6000
+G1 X108.297 Y157.023 E69.92700 F4800
+G1 X108.838 Y159.070 E69.99749 F1800
+G1 X109.461 Y158.618 E70.02311 F6000
+G1 X107.138 Y157.181 E70.11406 F3000
+G1 X106.968 Y156.225 E70.14641 F9000
+G1 X105.522 Y156.664 E70.19676 F9000
+G1 X101.167 Y158.770 E70.35783 F6000
+G1 X101.039 Y156.766 E70.42469 F9000
+G1 X99.574 Y156.238 E70.47657 F4800
+G1 X101.897 Y159.756 E70.61697 F1800
+G1 X101.795 Y159.189 E70.63617 F3000
+G1 X102.540 Y156.162 E70.73998 F1800
+G1 X100.525 Y157.326 E70.81745 F9000
+G1 X100.659 Y155.979 E70.86251 F4800
+G1 X101.019 Y152.736 E70.97118 F9000
+G1 X100.320 Y153.736 E71.01181 F3000
+G1 X96.508 Y152.218 E71.14844 F9000
+G1 X94.187 Y153.045 E71.23049 F9000
+G1 X91.705 Y150.110 E71.35850 F6000
+G1 X89.914 Y150.538 E71.41982 F4800
+G1 X89.992 Y148.657 E71.48250 F1800
+G1 X89.970 Y151.413 E71.57426 F4800
+G1 X89.498 Y151.887 E71.59654 F9000
+G1 X88.653 Y151.615 E71.62610 F9000
+G1 X90.583 Y152.927 E71.70384 F4800
+G1 X90.011 Y153.123 E71.72399 F4800
+G1 X89.462 Y154.959 E71.78782 F4800
+G1 X93.422 Y152.402 E71.94478 F4800
+G1 X94.186 Y153.516 E71.98975 F3000
+G1 X93.716 Y153.339 E72.00646 F1800
+G1 X96.241 Y153.694 E72.09135 F6000
+G1 X95.643 Y156.628 E72.19106 F6000
+G1 X95.005 Y154.724 E72.25793 F4800
+G1 X91.890 Y155.643 E72.36610 F1800
+G1 X93.045 Y153.729 E72.44052 F1800
+G1 X93.610 Y155.004 E72.48695 F4800
+G1 X92.953 Y155.916 E72.52437 F4800
+G1 X89.079 Y155.861 E72.65338 F4800
+G1 X88.042 Y157.268 E72.71160 F3000
+G1 X88.330 Y157.281 E72.72121 F6000
+G1 X90.902 Y158.892 E72.82227 F4800
+G1 X92.000 Y156.898 E72.89808 F1800
+G1 X94.405 Y159.499 E73.01603 F4800
+G1 X94.876 Y158.569 E73.05074 F3000
+G1 X98.210 Y156.403 E73.18315 F9000
+G1 X101.050 Y156.008 E73.27863 F6000
+G1 X98.568 Y152.467 E73.42263 F6000
+G1 X98.168 Y153.596 E73.46251 F9000
+G1 X97.481 Y155.118 E73.51812 F4800
+G1 X96.410 Y152.564 E73.61034 F3000
+G1 X95.045 Y153.941 E73.67493 F4800
+G1 X97.676 Y152.116 E73.78157 F4800
+G1 X97.441 Y149.919 E73.85517 F4800
+G1 X93.988 Y150.716 E73.97318 F1800
+G1 X94.223 Y150.848 E73.98217 F6000
+G1 X90.132 Y152.116 E74.12477 F9000
+G1 X88.622 Y152.660 E74.17822 F6000
+G1 X86.221 Y155.589 E74.30434 F3000
+G1 X86.577 Y154.899 E74.33020 F1800
+G1 X88.072 Y155.359 E74.38231 F6000
+G1 X85.106 Y154.796 E74.48287 F4800
+G1 X89.317 Y154.910 E74.62318 F3000
+G1 X88.141 Y157.888 E74.72979 F4800
+G1 X90.661 Y156.445 E74.82648 F3000
+G1 X89.268 Y155.402 E74.88441 F4800
+G1 X89.465 Y154.253 E74.92322 F6000
+G1 X90.717 Y153.779 E74.96779 F3000
+G1 X86.729 Y153.706 E75.10058 F3000
+G1 X89.419 Y156.562 E75.23121 F4800
+G1 X89.168 Y154.183 E75.31087 F3000
+G1 X86.703 Y154.052 E75.39305 F1800
+G1 X84.934 Y155.017 E75.46016 F6000
+G1 X84.829 Y155.419 E75.47401 F1800
+G1 X85.261 Y155.065 E75.49261 F3000
+G1 X85.087 Y150.568 E75.64249 F6000
+G1 X86.458 Y152.096 E75.71083 F1800
+G1 X87.993 Y148.826 E75.83113 F6000
+G1 X89.939 Y147.675 E75.90639 F1800
+G1 X89.302 Y147.226 E75.93236 F9000
+G1 X88.871 Y150.226 E76.03331 F4800
+G1 X92.044 Y148.830 E76.14874 F9000
+G1 X90.361 Y150.912 E76.23788 F9000
+G1 X93.351 Y147.671 E76.38472 F6000
+G1 X93.332 Y148.239 E76.40366 F9000
+G1 X91.068 Y145.769 E76.51526 F1800
+G1 X90.428 Y147.393 E76.57340 F4800
+G1 X87.317 Y149.539 E76.69925 F4800
+G1 X85.236 Y151.871 E76.80335 F9000
+G1 X84.327 Y152.130 E76.83483 F4800
+G1 X84.870 Y150.855 E76.88098 F9000
+G1 X87.381 Y152.351 E76.97831 F4800
+G1 X87.906 Y150.780 E77.03346 F3000
+G1 X87.600 Y150.722 E77.04380 F1800
+G1 X87.843 Y148.005 E77.13464 F9000
+G1 X85.053 Y147.867 E77.22765 F1800
+G1 X85.501 Y147.743 E77.24314 F3000
+G1 X83.094 Y146.861 E77.32852 F6000
+G1 X81.988 Y145.337 E77.39122 F3000
+G1 X81.530 Y141.051 E77.53475 F9000
+G1 X78.467 Y143.256 E77.66045 F6000
+G1 X75.754 Y145.956 E77.78788 F6000
+G1 X71.964 Y146.573 E77.91578 F4800
+G1 X71.357 Y142.809 E78.04272 F1800
+G1 X71.699 Y141.001 E78.10401 F1800
+G1 X72.660 Y144.586 E78.22763 F3000
+G1 X72.461 Y146.323 E78.28583 F4800
+G1 X69.958 Y149.823 E78.42911 F6000
+G1 X67.616 Y145.923 E78.58059 F9000
+G1 X66.714 Y146.541 E78.61697 F4800
+G1 X66.745 Y143.722 E78.71082 F6000
+G1 X65.307 Y139.383 E78.86304 F1800
+G1 X67.834 Y140.627 E78.95682 F1800
+G1 X71.826 Y143.484 E79.12030 F4800
+G1 X70.396 Y143.572 E79.16801 F9000
+G1 X70.226 Y144.782 E79.20870 F1800
+G1 X74.257 Y144.261 E79.34404 F9000
+G1 X70.490 Y144.685 E79.47026 F9000
+G1 X71.291 Y143.318 E79.52303 F6000
+G1 X74.123 Y142.467 E79.62151 F1800
+G1 X75.122 Y141.558 E79.66648 F6000
+G1 X72.992 Y143.953 E79.77322 F6000
+G1 X72.703 Y143.073 E79.80409 F9000
+G1 X72.230 Y145.008 E79.87041 F3000
+G1 X73.426 Y144.159 E79.91926 F9000
+G1 X69.951 Y146.340 E80.05588 F1800
+G1 X68.336 Y145.050 E80.12470 F4800
+G1 X68.963 Y149.037 E80.25909 F6000
+G1 X69.103 Y148.672 E80.27213 F3000
+G1 X67.830 Y144.515 E80.41689 F1800
+G1 X64.540 Y141.659 E80.56197 F9000
+G1 X64.993 Y141.329 E80.58065 F9000
+G1 X66.647 Y140.583 E80.64107 F6000
+G1 X70.972 Y139.589 E80.78883 F1800
+G1 X71.593 Y137.212 E80.87065 F9000
+G1 X71.727 Y132.970 E81.01198 F1800
+G1 X73.241 Y135.300 E81.10451 F9000
+G1 X69.272 Y138.278 E81.26974 F1800
+G1 X71.532 Y138.720 E81.34642 F4800
+G1 X70.648 Y138.860 E81.37622 F4800
+G1 X68.507 Y135.216 E81.51698 F4800
+G1 X64.934 Y136.226 E81.64060 F9000
+G1 X66.219 Y134.742 E81.70598 F6000
+G1 X66.091 Y134.314 E81.72085 F6000
+G1 X65.489 Y134.031 E81.74301 F9000
+G1 X64.934 Y134.630 E81.77020 F4800
+G1 X65.393 Y133.550 E81.80927 F1800
+G1 X66.540 Y132.623 E81.85839 F3000
+G1 X66.069 Y131.345 E81.90377 F9000
+G1 X63.392 Y129.673 E82.00884 F1800
+G1 X60.245 Y129.031 E82.11580 F4800
+G1 X57.100 Y126.255 E82.25551 F1800
+G1 X55.016 Y124.805 E82.34004 F9000
+G1 X55.804 Y127.325 E82.42796 F6000
+G1 X55.792 Y125.880 E82.47606 F1800
+G1 X53.879 Y126.468 E82.54272 F4800
+G1 X58.713 Y126.054 E82.70429 F3000
+G1 X58.606 Y125.299 E82.72968 F3000
+G1 X59.152 Y125.613 E82.75065 F1800
+G1 X60.391 Y129.919 E82.89988 F9000
+G1 X59.777 Y130.193 E82.92226 F3000
+G1 X63.275 Y130.039 E83.03886 F9000
+G1 X63.547 Y130.525 E83.05742 F4800
+G1 X63.242 Y131.393 E83.08805 F4800
+G1 X67.840 Y129.607 E83.25229 F3000
+G1 X71.253 Y127.040 E83.39451 F9000
+G1 X69.842 Y128.935 E83.47319 F9000
+G1 X71.741 Y126.386 E83.57902 F6000
+G1 X68.913 Y126.167 E83.67347 F1800
+G1 X68.787 Y126.342 E83.68066 F6000
+G1 X69.006 Y125.790 E83.70043 F3000
+G1 X68.421 Y125.194 E83.72826 F4800
+G1 X72.541 Y127.472 E83.88506 F3000
+G1 X69.649 Y128.330 E83.98551 F6000
+G1 X73.062 Y130.880 E84.12739 F1800
+G1 X72.360 Y134.668 E84.25565 F6000
+G1 X69.858 Y132.945 E84.35682 F9000
+G1 X69.529 Y132.710 E84.37028 F3000
+G1 X69.092 Y136.001 E84.48083 F6000
+G1 X64.717 Y137.056 E84.63072 F4800
+G1 X65.342 Y136.206 E84.66588 F3000
+G1 X64.479 Y135.551 E84.70195 F1800
+G1 X61.751 Y135.475 E84.79285 F4800
+G1 X60.297 Y131.410 E84.93661 F3000
+G1 X60.879 Y135.941 E85.08873 F6000
+G1 X61.941 Y135.447 E85.12773 F9000
+G1 X62.764 Y134.446 E85.17090 F4800
+G1 X61.996 Y135.856 E85.22438 F1800
+G1 X61.612 Y137.392 E85.27710 F9000
+G1 X62.670 Y134.942 E85.36595 F9000
+G1 X66.932 Y133.027 E85.52156 F6000
+G1 X65.280 Y132.535 E85.57896 F3000
+G1 X64.945 Y130.445 E85.64943 F3000
+G1 X62.682 Y133.206 E85.76830 F3000
+G1 X60.661 Y135.939 E85.88149 F1800
+G1 X60.471 Y140.531 E86.03454 F6000
+G1 X61.205 Y140.392 E86.05944 F3000
+G1 X63.180 Y142.819 E86.16361 F3000
+G1 X65.363 Y139.867 E86.28586 F4800
+G1 X63.948 Y143.625 E86.41958 F3000
+G1 X65.364 Y138.977 E86.58136 F3000
+G1 X69.431 Y140.204 E86.72282 F4800
+G1 X68.907 Y141.105 E86.75754 F6000
+G1 X71.392 Y140.248 E86.84508 F3000
+G1 X70.441 Y139.167 E86.89304 F3000
+G1 X72.267 Y138.623 E86.95650 F9000
+G1 X70.608 Y135.798 E87.06561 F6000
+G1 X67.075 Y137.141 E87.19147 F4800
+G1 X66.532 Y137.985 E87.22486 F6000
+G1 X62.266 Y138.763 E87.36924 F4800
+G1 X59.635 Y141.028 E87.48486 F3000
+G1 X57.713 Y139.668 E87.56329 F9000
+G1 X62.284 Y141.235 E87.72421 F3000
+G1 X62.726 Y136.288 E87.88963 F4800
+G1 X63.007 Y137.863 E87.94290 F3000
+G1 X62.626 Y138.888 E87.97933 F9000
+G1 X66.608 Y138.030 E88.11496 F4800
+G1 X68.141 Y133.411 E88.27702 F1800
+G1 X67.065 Y135.381 E88.35176 F4800
+G1 X66.174 Y131.306 E88.49068 F4800
+G1 X66.852 Y128.944 E88.57249 F6000
+G1 X68.066 Y126.166 E88.67345 F4800
+G1 X67.983 Y125.456 E88.69728 F3000
+G1 X71.632 Y124.463 E88.82320 F3000
+G1 X68.996 Y122.555 E88.93156 F6000
+G1 X69.693 Y121.107 E88.98506 F3000
+G1 X72.301 Y123.592 E89.10502 F9000
+G1 X70.566 Y126.392 E89.21470 F6000
+G1 X70.316 Y124.991 E89.26211 F3000
+G1 X70.556 Y122.268 E89.35313 F1800
+G1 X73.115 Y120.442 E89.45778 F6000
+G1 X70.620 Y119.929 E89.54260 F4800
+G1 X71.730 Y115.766 E89.68606 F9000
+G1 X71.844 Y116.344 E89.70568 F6000
+G1 X68.935 Y115.656 E89.80523 F4800
+G1 X68.845 Y117.213 E89.85715 F4800
+G1 X68.303 Y116.052 E89.89981 F3000
+G1 X66.010 Y116.122 E89.97620 F9000
+G1 X67.139 Y112.961 E90.08798 F3000
+G1 X65.033 Y115.765 E90.20475 F6000
+G1 X66.952 Y116.965 E90.28011 F1800
+G1 X63.409 Y117.995 E90.40297 F3000
+G1 X62.944 Y121.479 E90.52004 F3000
+G1 X62.708 Y121.389 E90.52847 F4800
+G1 X64.272 Y122.141 E90.58628 F1800
+G1 X64.880 Y123.373 E90.63201 F4800
+G1 X66.272 Y121.934 E90.69866 F9000
+G1 X65.427 Y121.914 E90.72679 F9000
+G1 X66.622 Y125.270 E90.84542 F1800
+G1 X67.314 Y125.065 E90.86946 F3000
+G1 X66.825 Y124.922 E90.88644 F3000
+G1 X66.140 Y121.057 E91.01715 F3000
+G1 X66.375 Y118.297 E91.10939 F4800
+G1 X66.084 Y118.425 E91.11998 F1800
+G1 X69.347 Y119.413 E91.23351 F3000
+G1 X66.927 Y121.876 E91.34849 F1800
+G1 X66.358 Y121.361 E91.37402 F6000
+G1 X68.084 Y119.822 E91.45101 F9000
+G1 X64.544 Y117.387 E91.59408 F3000
+G1 X63.394 Y115.576 E91.66550 F1800
+G1 X64.218 Y112.161 E91.78250 F1800
+G1 X59.932 Y112.936 E91.92755 F3000
+G1 X59.830 Y111.461 E91.97679 F4800
+G1 X62.293 Y111.292 E92.05901 F9000
+G1 X60.815 Y114.431 E92.17456 F6000
+G1 X57.336 Y112.903 E92.30111 F9000
+G1 X58.447 Y110.946 E92.37608 F6000
+G1 X56.189 Y109.589 E92.46379 F9000
+G1 X58.934 Y108.582 E92.56112 F6000
+G1 X57.824 Y111.841 E92.67577 F4800
+G1 X56.146 Y110.453 E92.74828 F3000
+G1 X60.595 Y108.937 E92.90480 F4800
+G1 X58.475 Y108.031 E92.98156 F4800
+G1 X58.242 Y108.037 E92.98934 F1800
+G1 X59.205 Y110.723 E93.08437 F9000
+G1 X59.001 Y110.910 E93.09356 F3000
+G1 X60.727 Y113.690 E93.20252 F1800
+G1 X61.409 Y118.551 E93.36598 F4800
+G1 X57.736 Y116.325 E93.50900 F6000
+G1 X55.780 Y112.355 E93.65638 F3000
+G1 X54.408 Y109.907 E93.74982 F1800
+G1 X56.366 Y108.165 E93.83709 F9000
+G1 X56.466 Y109.193 E93.87149 F9000
+G1 X59.246 Y105.142 E94.03509 F9000
+G1 X59.234 Y105.395 E94.04350 F9000
+G1 X59.096 Y104.772 E94.06473 F4800
+G1 X59.311 Y108.574 E94.19153 F4800
+G1 X62.539 Y112.317 E94.35610 F6000
+G1 X62.165 Y110.617 E94.41407 F6000
+G1 X63.094 Y111.454 E94.45573 F6000
+G1 X63.624 Y110.555 E94.49049 F3000
+G1 X60.188 Y110.957 E94.60569 F9000
+G1 X62.296 Y109.105 E94.69913 F6000
+G1 X65.355 Y110.993 E94.81884 F1800
+G1 X61.958 Y112.411 E94.94143 F6000
+G1 X62.994 Y112.621 E94.97663 F6000
+G1 X65.562 Y109.821 E95.10315 F3000
+G1 X67.430 Y110.824 E95.17377 F1800
+G1 X65.603 Y113.137 E95.27192 F3000
+G1 X63.864 Y112.776 E95.33108 F6000
+G1 X61.202 Y115.925 E95.46838 F1800
+G1 X60.976 Y114.857 E95.50476 F3000
+G1 X60.279 Y115.108 E95.52944 F6000
+G1 X61.454 Y116.619 E95.59316 F9000
+G1 X64.999 Y114.731 E95.72688 F1800
+G1 X60.523 Y115.892 E95.88084 F4800
+G1 X64.408 Y116.585 E96.01228 F4800
+G1 X67.231 Y114.088 E96.13779 F4800
+G1 X67.037 Y115.920 E96.19914 F6000
+G1 X69.304 Y115.298 E96.27742 F1800
+G1 X68.163 Y115.910 E96.32052 F4800
+G1 X69.661 Y115.977 E96.37045 F3000
+G1 X69.391 Y116.146 E96.38107 F6000
+G1 X69.335 Y116.826 E96.40379 F9000
+G1 X70.518 Y116.026 E96.45136 F9000
+G1 X70.446 Y116.334 E96.46188 F1800
+G1 X69.893 Y117.106 E96.49349 F1800
+G1 X69.159 Y120.502 E96.60919 F3000
+G1 X70.532 Y123.501 E96.71902 F3000
+G1 X73.529 Y124.050 E96.82049 F1800
+G1 X72.948 Y123.922 E96.84031 F9000
+G1 X72.478 Y123.368 E96.86451 F1800
+G1 X70.926 Y126.613 E96.98432 F6000
+G1 X66.841 Y128.030 E97.12828 F4800
+G1 X65.767 Y128.234 E97.16468 F4800
+G1 X63.153 Y128.522 E97.25225 F3000
+G1 X64.591 Y130.453 E97.33243 F9000
+G1 X68.245 Y132.635 E97.47415 F4800
+G1 X70.202 Y128.672 E97.62134 F6000
+G1 X73.370 Y131.076 E97.75376 F9000
+G1 X71.114 Y130.238 E97.83391 F6000
+G1 X69.527 Y129.137 E97.89825 F9000
+G1 X71.383 Y128.513 E97.96346 F3000
+G1 X72.002 Y130.920 E98.04621 F4800
+G1 X74.592 Y130.407 E98.13414 F3000
+G1 X74.445 Y130.833 E98.14913 F1800
+G1 X76.647 Y130.993 E98.22267 F9000
+G1 X77.431 Y127.517 E98.34130 F9000
+G1 X77.512 Y129.083 E98.39352 F6000
+G1 X77.339 Y124.864 E98.53413 F3000
+G1 X73.628 Y124.553 E98.65814 F4800
+G1 X73.762 Y124.319 E98.66713 F3000
+G1 X70.872 Y125.664 E98.77329 F1800
+G1 X69.921 Y121.040 E98.93050 F6000
+G1 X69.733 Y121.509 E98.94735 F9000
+G1 X65.454 Y123.297 E99.10177 F9000
+G1 X66.598 Y125.396 E99.18140 F6000
+G1 X64.811 Y124.997 E99.24236 F1800
+G1 X65.861 Y127.655 E99.33751 F1800
+G1 X67.473 Y126.544 E99.40271 F3000
+G1 X67.402 Y121.944 E99.55593 F3000
+G1 X69.797 Y120.307 E99.65253 F4800
+G1 X70.233 Y121.578 E99.69728 F6000
+G1 X70.082 Y121.758 E99.70510 F1800
+G1 X69.788 Y119.667 E99.77542 F3000
+G1 X71.766 Y122.946 E99.90294 F9000
+G1 X73.253 Y120.179 E100.00755 F3000
+G1 X71.186 Y121.156 E100.08368 F9000
+G1 X70.949 Y121.676 E100.10273 F1800
+G1 X71.494 Y125.298 E100.22470 F3000
+G1 X74.178 Y126.434 E100.32176 F3000
+G1 X76.674 Y127.442 E100.41140 F3000
+G1 X76.903 Y129.655 E100.48548 F1800
+G1 X79.878 Y126.455 E100.63097 F1800
+G1 X82.194 Y127.631 E100.71748 F3000
+G1 X82.736 Y126.215 E100.76795 F6000
+G1 X83.082 Y126.182 E100.77955 F1800
+G1 X82.479 Y125.955 E100.80102 F9000
+G1 X78.935 Y123.849 E100.93831 F1800
+G1 X78.838 Y124.064 E100.94619 F1800
+G1 X78.530 Y123.288 E100.97400 F4800
+G1 X77.412 Y126.630 E101.09136 F4800
+G1 X77.760 Y124.916 E101.14960 F6000
+G1 X78.638 Y121.507 E101.26682 F1800
+G1 X80.615 Y124.447 E101.38479 F1800
+G1 X80.084 Y123.351 E101.42535 F1800
+G1 X79.773 Y122.318 E101.46126 F1800
+G1 X79.993 Y126.656 E101.60589 F4800
+G1 X79.742 Y125.902 E101.63235 F3000
+G1 X78.426 Y124.500 E101.69638 F1800
+G1 X76.915 Y125.877 E101.76447 F4800
+G1 X74.052 Y121.937 E101.92664 F4800
+G1 X76.479 Y121.719 E102.00778 F4800
+G1 X78.256 Y118.298 E102.13616 F3000
+G1 X77.776 Y118.508 E102.15361 F9000
+G1 X73.512 Y118.300 E102.29576 F1800
+G1 X75.020 Y116.921 E102.36381 F6000
+G1 X79.451 Y116.884 E102.51137 F1800
+G1 X79.748 Y116.979 E102.52175 F1800
+G1 X75.903 Y115.188 E102.66302 F3000
+G1 X77.282 Y113.421 E102.73767 F1800
+G1 X78.919 Y109.443 E102.88090 F9000
+G1 X80.348 Y107.814 E102.95307 F6000
+G1 X78.631 Y107.824 E103.01025 F1800
+G1 X79.194 Y104.858 E103.11079 F3000
+G1 X79.570 Y104.916 E103.12347 F4800
+G1 X80.204 Y104.086 E103.15825 F4800
+G1 X82.453 Y100.934 E103.28721 F4800
+G1 X85.610 Y98.470 E103.42057 F4800
+G1 X83.795 Y97.914 E103.48378 F1800
+G1 X80.548 Y97.693 E103.59214 F4800
+G1 X78.107 Y93.494 E103.75387 F1800
+G1 X75.702 Y96.744 E103.88848 F3000
+G1 X74.737 Y94.740 E103.96254 F6000
+G1 X75.330 Y94.455 E103.98445 F4800
+G1 X74.528 Y94.444 E104.01118 F1800
+G1 X76.015 Y89.678 E104.17743 F1800
+G1 X76.504 Y90.293 E104.20358 F1800
+G1 X77.086 Y90.294 E104.22296 F3000
+G1 X78.609 Y90.866 E104.27714 F6000
+G1 X76.084 Y92.066 E104.37024 F1800
+G1 X77.176 Y92.350 E104.40781 F6000
+G1 X76.893 Y90.805 E104.46012 F6000
+G1 X76.661 Y91.656 E104.48949 F3000
+G1 X76.419 Y92.084 E104.50587 F3000
+G1 X77.381 Y92.151 E104.53800 F9000
+G1 X75.996 Y93.237 E104.59660 F4800
+G1 X78.344 Y89.172 E104.75292 F1800
+G1 X77.701 Y90.023 E104.78843 F6000
+G1 X74.264 Y92.563 E104.93074 F6000
+G1 X73.523 Y89.990 E105.01992 F4800
+G1 X71.240 Y91.656 E105.11401 F3000
+G1 X67.277 Y92.316 E105.24780 F1800
+G1 X66.703 Y94.356 E105.31839 F4800
+G1 X65.381 Y95.697 E105.38109 F9000
+G1 X63.162 Y96.891 E105.46500 F4800
+G1 X63.194 Y100.963 E105.60060 F1800
+G1 X63.411 Y96.949 E105.73448 F9000
+G1 X61.588 Y101.312 E105.89194 F3000
+G1 X61.335 Y102.133 E105.92055 F6000
+G1 X62.082 Y99.548 E106.01016 F1800
+G1 X61.901 Y103.988 E106.15813 F6000
+G1 X62.172 Y102.003 E106.22483 F4800
+G1 X59.574 Y103.741 E106.32891 F6000
+G1 X57.514 Y104.390 E106.40083 F1800
+G1 X55.014 Y100.415 E106.55721 F3000
+G1 X52.754 Y99.981 E106.63385 F9000
+G1 X52.852 Y100.827 E106.66218 F3000
+G1 X53.310 Y101.445 E106.68782 F1800
+G1 X49.506 Y101.636 E106.81466 F9000
+G1 X51.053 Y101.647 E106.86620 F9000
+G1 X51.522 Y105.027 E106.97985 F6000
+G1 X51.267 Y106.738 E107.03744 F4800
+G1 X53.699 Y109.704 E107.16516 F4800
+G1 X53.640 Y110.462 E107.19049 F3000
+G1 X52.967 Y111.883 E107.24284 F4800
+G1 X53.209 Y110.572 E107.28723 F3000
+G1 X51.900 Y111.659 E107.34389 F1800
+G1 X53.814 Y113.953 E107.44338 F6000
+G1 X53.264 Y113.994 E107.46177 F6000
+G1 X51.342 Y115.571 E107.54455 F9000
+G1 X51.587 Y119.373 E107.67141 F9000
+G1 X50.378 Y119.013 E107.71340 F4800
+G1 X49.950 Y119.793 E107.74302 F1800
+G1 X48.529 Y123.313 E107.86943 F3000
+G1 X48.764 Y123.672 E107.88372 F4800
+G1 X49.897 Y122.338 E107.94200 F4800
+G1 X50.427 Y121.177 E107.98450 F9000
+G1 X54.400 Y123.203 E108.13301 F4800
+G1 X53.472 Y125.248 E108.20780 F4800
+G1 X54.816 Y126.660 E108.27272 F9000
+G1 X59.291 Y127.142 E108.42261 F4800
+G1 X61.396 Y127.281 E108.49286 F4800
+G1 X58.116 Y124.658 E108.63270 F6000
+G1 X62.367 Y123.789 E108.77717 F9000
+G1 X62.459 Y122.482 E108.82080 F3000
+G1 X59.215 Y120.900 E108.94099 F9000
+G1 X57.306 Y121.680 E109.00967 F1800
+G1 X57.937 Y124.611 E109.10951 F1800
+G1 X56.078 Y124.847 E109.17191 F9000
+G1 X55.279 Y125.985 E109.21823 F3000
+G1 X51.533 Y123.145 E109.37476 F4800
+G1 X55.869 Y125.020 E109.53208 F3000
+G1 X56.668 Y124.844 E109.55930 F3000
+G1 X54.501 Y123.793 E109.63950 F4800
+G1 X56.306 Y124.580 E109.70506 F6000
+G1 X55.220 Y121.291 E109.82040 F9000
+G1 X54.309 Y122.582 E109.87299 F3000
+G1 X53.780 Y122.348 E109.89227 F4800
+G1 X55.442 Y126.702 E110.04746 F1800
+G1 X53.445 Y128.581 E110.13876 F1800
+G1 X54.491 Y125.711 E110.24049 F4800
+G1 X55.034 Y125.515 E110.25970 F6000
+G1 X55.235 Y125.200 E110.27217 F3000
+G1 X53.989 Y124.446 E110.32069 F3000
+G1 X55.952 Y120.466 E110.46847 F4800
+G1 X58.815 Y122.215 E110.58018 F9000
+G1 X58.772 Y121.028 E110.61971 F3000
+G1 X56.578 Y121.413 E110.69388 F6000
+G1 X56.198 Y119.322 E110.76463 F1800
+G1 X58.347 Y122.099 E110.88157 F6000
+G1 X59.256 Y122.269 E110.91234 F4800
+G1 X60.098 Y123.202 E110.95419 F6000
+G1 X61.355 Y124.392 E111.01185 F1800
+G1 X60.186 Y121.391 E111.11909 F3000
+G1 X60.716 Y125.048 E111.24214 F4800
+G1 X62.608 Y123.353 E111.32674 F4800
+G1 X64.903 Y121.191 E111.43173 F6000
+G1 X66.192 Y119.344 E111.50673 F6000
+G1 X64.772 Y123.328 E111.64758 F3000
+G1 X68.548 Y120.801 E111.79888 F6000
+G1 X65.573 Y119.461 E111.90753 F6000
+G1 X61.882 Y120.303 E112.03361 F6000
+G1 X61.757 Y118.681 E112.08780 F4800
+G1 X65.454 Y121.582 E112.24427 F3000
+G1 X63.761 Y121.781 E112.30106 F9000
+G1 X64.390 Y125.040 E112.41161 F1800
+G1 X63.679 Y125.629 E112.44236 F4800
+G1 X66.341 Y125.857 E112.53133 F3000
+G1 X62.840 Y122.912 E112.68364 F9000
+G1 X63.232 Y122.905 E112.69669 F4800
+G1 X62.383 Y125.614 E112.79123 F3000
+G1 X63.054 Y127.680 E112.86356 F6000
+G1 X60.944 Y123.652 E113.01497 F4800
+G1 X59.853 Y120.471 E113.12696 F6000
+G1 X60.773 Y117.716 E113.22368 F1800
+G1 X59.232 Y121.515 E113.36019 F4800
+G1 X55.753 Y118.626 E113.51080 F4800
+G1 X58.556 Y118.988 E113.60492 F1800
+G1 X57.142 Y120.982 E113.68634 F3000
+G1 X60.488 Y117.489 E113.84741 F4800
+G1 X59.726 Y117.270 E113.87380 F3000
+G1 X60.162 Y116.645 E113.89918 F4800
+G1 X61.252 Y116.561 E113.93559 F6000
+G1 X58.672 Y113.086 E114.07971 F1800
+G1 X61.109 Y112.696 E114.16192 F3000
+G1 X61.326 Y112.416 E114.17372 F6000
+G1 X61.462 Y112.606 E114.18148 F6000
+G1 X59.783 Y114.750 E114.27216 F1800
+G1 X64.048 Y113.087 E114.42461 F9000
+G1 X62.084 Y110.428 E114.53468 F6000
+G1 X61.502 Y110.591 E114.55483 F1800
+G1 X64.227 Y107.622 E114.68905 F3000
+G1 X63.571 Y108.739 E114.73217 F9000
+G1 X60.404 Y112.289 E114.89059 F4800
+G1 X58.462 Y111.154 E114.96552 F3000
+G1 X55.264 Y109.517 E115.08514 F3000
+G1 X54.925 Y107.298 E115.15989 F1800
+G1 X56.092 Y107.430 E115.19902 F3000
+G1 X54.980 Y106.843 E115.24089 F1800
+G1 X54.514 Y106.852 E115.25640 F4800
+G1 X55.710 Y108.216 E115.31681 F3000
+G1 X58.282 Y107.041 E115.41098 F4800
+G1 X58.872 Y107.657 E115.43936 F9000
+G1 X58.257 Y110.817 E115.54657 F4800
+G1 X57.772 Y107.234 E115.66696 F3000
+G1 X57.217 Y111.547 E115.81177 F4800
+G1 X60.857 Y111.601 E115.93298 F1800
+G1 X63.313 Y114.202 E116.05211 F6000
+G1 X65.982 Y114.800 E116.14319 F6000
+G1 X66.056 Y115.091 E116.15321 F3000
+G1 X67.703 Y113.699 E116.22502 F4800
+G1 X66.113 Y118.232 E116.38499 F9000
+G1 X66.036 Y121.090 E116.48018 F9000
+G1 X65.566 Y118.151 E116.57927 F4800
+G1 X66.317 Y118.582 E116.60809 F9000
+G1 X64.871 Y121.561 E116.71836 F3000
+G1 X62.084 Y124.902 E116.86324 F9000
+G1 X63.300 Y125.293 E116.90577 F3000
+G1 X64.378 Y126.030 E116.94924 F4800
+G1 X64.031 Y127.276 E116.99231 F3000
+G1 X60.908 Y125.959 E117.10518 F1800
+G1 X60.652 Y125.851 E117.11442 F9000
+G1 X60.977 Y124.002 E117.17695 F9000
+G1 X60.506 Y124.429 E117.19811 F3000
+G1 X62.369 Y122.419 E117.28937 F9000
+G1 X62.264 Y126.063 E117.41077 F3000
+G1 X66.865 Y125.188 E117.56674 F6000
+G1 X68.866 Y122.114 E117.68887 F4800
+G1 X68.628 Y121.894 E117.69967 F1800
+G1 X70.056 Y120.397 E117.76854 F9000
+G1 X71.176 Y120.803 E117.80824 F6000
+G1 X72.831 Y122.695 E117.89194 F6000
+G1 X73.978 Y123.021 E117.93163 F1800
+G1 X75.943 Y122.397 E118.00029 F3000
+G1 X77.968 Y121.379 E118.07575 F4800
+G1 X74.082 Y123.312 E118.22025 F4800
+G1 X74.175 Y123.656 E118.23211 F1800
+G1 X73.582 Y119.376 E118.37599 F6000
+G1 X72.611 Y117.570 E118.44427 F4800
+G1 X72.203 Y121.573 E118.57828 F1800
+G1 X75.396 Y118.579 E118.72405 F6000
+G1 X73.266 Y118.970 E118.79616 F9000
+G1 X70.467 Y121.923 E118.93165 F3000
+G1 X72.149 Y118.016 E119.07328 F6000
+G1 X71.944 Y118.196 E119.08236 F1800
+G1 X74.356 Y114.384 E119.23257 F6000
+G1 X71.702 Y110.166 E119.39854 F4800
+G1 X71.869 Y110.570 E119.41310 F6000
+G1 X68.981 Y107.904 E119.54398 F6000
+G1 X68.886 Y108.227 E119.55519 F6000
+G1 X67.750 Y105.735 E119.64640 F3000
+G1 X66.463 Y109.956 E119.79336 F3000
+G1 X64.772 Y108.001 E119.87945 F9000
+G1 X62.290 Y106.343 E119.97884 F9000
+G1 X63.118 Y110.973 E120.13548 F6000
+G1 X63.814 Y107.435 E120.25556 F1800
+G1 X61.632 Y111.813 E120.41843 F6000
+G1 X63.737 Y115.316 E120.55454 F6000
+G1 X65.582 Y111.860 E120.68500 F3000
+G1 X61.109 Y111.351 E120.83490 F9000
+G1 X63.387 Y113.006 E120.92866 F9000
+G1 X67.649 Y111.726 E121.07687 F1800
+G1 X63.823 Y114.465 E121.23356 F3000
+G1 X66.452 Y118.195 E121.38552 F1800
+G1 X64.479 Y120.354 E121.48291 F1800
+G1 X62.529 Y123.744 E121.61313 F6000
+G1 X61.395 Y120.726 E121.72047 F3000
+G1 X61.355 Y121.846 E121.75777 F3000
+G1 X62.218 Y122.103 E121.78778 F4800
+G1 X64.427 Y124.902 E121.90648 F4800
+G1 X63.412 Y127.581 E122.00188 F9000
+G1 X64.575 Y129.559 E122.07831 F4800
+G1 X66.459 Y130.325 E122.14601 F6000
+G1 X69.073 Y126.823 E122.29153 F4800
+G1 X69.455 Y126.852 E122.30428 F3000
+G1 X67.604 Y128.270 E122.38192 F9000
+G1 X67.434 Y131.068 E122.47526 F1800
+G1 X66.746 Y131.050 E122.49820 F9000
+G1 X62.796 Y129.889 E122.63528 F6000
+G1 X60.441 Y131.470 E122.72972 F3000
+G1 X58.829 Y127.171 E122.88261 F9000
+G1 X60.767 Y125.061 E122.97800 F4800
+G1 X60.562 Y125.077 E122.98484 F3000
+G1 X59.439 Y122.963 E123.06454 F1800
+G1 X59.650 Y125.787 E123.15883 F1800
+G1 X64.383 Y127.234 E123.32363 F3000
+G1 X66.288 Y124.643 E123.43075 F6000
+G1 X65.313 Y122.839 E123.49901 F1800
+G1 X68.937 Y119.470 E123.66379 F6000
+G1 X70.854 Y118.526 E123.73493 F4800
+G1 X72.305 Y117.748 E123.78975 F9000
+G1 X72.035 Y118.127 E123.80525 F6000
+G1 X71.037 Y118.820 E123.84571 F9000
+G1 X72.710 Y114.925 E123.98689 F9000
+G1 X71.346 Y119.288 E124.13913 F1800
+G1 X69.932 Y122.401 E124.25297 F6000
+G1 X73.598 Y119.224 E124.41449 F3000
+G1 X76.486 Y119.090 E124.51077 F9000
+G1 X74.767 Y119.323 E124.56852 F3000
+G1 X76.294 Y118.311 E124.62953 F3000
+G1 X74.951 Y122.130 E124.76432 F3000
+G1 X75.505 Y120.386 E124.82526 F4800
+G1 X78.086 Y121.816 E124.92353 F3000
+G1 X77.564 Y119.734 E124.99501 F3000
+G1 X79.680 Y121.972 E125.09758 F9000
+G1 X79.741 Y122.372 E125.11106 F3000
+G1 X79.434 Y125.728 E125.22328 F4800
+G1 X77.843 Y128.427 E125.32760 F4800
+G1 X79.034 Y129.205 E125.37496 F3000
+G1 X79.660 Y124.731 E125.52542 F9000
+G1 X79.331 Y126.844 E125.59664 F3000
+G1 X80.094 Y126.976 E125.62242 F6000
+G1 X79.632 Y124.243 E125.71474 F6000
+G1 X79.745 Y123.522 E125.73903 F1800
+G1 X79.567 Y122.229 E125.78247 F4800
+G1 X80.373 Y121.014 E125.83103 F4800
+G1 X79.001 Y123.952 E125.93901 F9000
+G1 X75.829 Y121.885 E126.06511 F6000
+G1 X73.228 Y121.687 E126.15198 F4800
+G1 X72.604 Y118.997 E126.24395 F3000
+G1 X75.188 Y117.635 E126.34121 F4800
+G1 X77.684 Y115.892 E126.44257 F9000
+G1 X78.402 Y120.286 E126.59083 F3000
+G1 X75.231 Y123.259 E126.73559 F6000
+G1 X73.395 Y120.508 E126.84573 F3000
+G1 X70.476 Y120.111 E126.94383 F3000
+G1 X71.702 Y122.077 E127.02099 F9000
+G1 X68.444 Y120.578 E127.14042 F1800
+G1 X68.066 Y121.884 E127.18571 F3000
+G1 X68.101 Y122.126 E127.19384 F1800
+G1 X72.273 Y124.053 E127.34689 F3000
+G1 X72.850 Y122.053 E127.41622 F9000
+G1 X71.916 Y123.151 E127.46424 F3000
+G1 X76.053 Y122.110 E127.60630 F6000
+G1 X78.847 Y120.325 E127.71673 F6000
+G1 X76.155 Y123.497 E127.85529 F4800
+G1 X76.332 Y122.410 E127.89198 F3000
+G1 X77.084 Y123.076 E127.92543 F1800
+G1 X77.993 Y121.338 E127.99076 F4800
+G1 X81.277 Y122.118 E128.10316 F3000
+G1 X80.943 Y124.857 E128.19504 F9000
+G1 X79.360 Y127.436 E128.29580 F9000
+G1 X79.882 Y126.343 E128.33614 F4800
+G1 X82.145 Y127.508 E128.42089 F6000
+G1 X83.737 Y126.440 E128.48473 F1800
+G1 X80.552 Y126.187 E128.59112 F1800
+G1 X76.218 Y126.133 E128.73543 F9000
+G1 X78.537 Y122.550 E128.87755 F3000
+G1 X79.509 Y121.502 E128.92514 F3000
+G1 X82.823 Y119.363 E129.05650 F3000
+G1 X87.512 Y119.220 E129.21271 F1800
+G1 X87.543 Y120.539 E129.25666 F6000
+G1 X88.153 Y115.836 E129.41459 F3000
+G1 X87.716 Y115.977 E129.42988 F6000
+G1 X89.013 Y117.053 E129.48597 F1800
+G1 X85.465 Y113.830 E129.64559 F9000
+G1 X85.821 Y114.064 E129.65978 F4800
+G1 X83.376 Y114.550 E129.74279 F6000
+G1 X86.884 Y115.150 E129.86132 F1800
+G1 X86.580 Y119.020 E129.99059 F1800
+G1 X86.541 Y119.751 E130.01497 F1800
+G1 X88.540 Y122.478 E130.12757 F1800
+G1 X87.357 Y123.636 E130.18268 F6000
+G1 X86.058 Y125.503 E130.25841 F3000
+G1 X85.173 Y128.088 E130.34942 F6000
+G1 X83.332 Y131.166 E130.46884 F6000
+G1 X85.695 Y135.193 E130.62436 F3000
+G1 X88.569 Y137.606 E130.74932 F3000
+G1 X87.489 Y136.827 E130.79366 F4800
+G1 X88.204 Y140.735 E130.92596 F1800
+G1 X92.175 Y137.785 E131.09069 F6000
+G1 X94.093 Y141.427 E131.22777 F1800
+G1 X93.901 Y141.505 E131.23467 F6000
+G1 X94.156 Y141.803 E131.24774 F4800
+G1 X91.068 Y138.479 E131.39883 F1800
+G1 X93.578 Y137.515 E131.48837 F3000
+G1 X96.888 Y135.448 E131.61829 F4800
+G1 X98.010 Y132.871 E131.71190 F3000
+G1 X99.670 Y131.685 E131.77983 F6000
+G1 X96.662 Y129.319 E131.90729 F1800
+G1 X93.100 Y130.334 E132.03063 F6000
+G1 X94.964 Y132.403 E132.12338 F3000
+G1 X96.027 Y133.749 E132.18046 F9000
+G1 X98.638 Y137.685 E132.33776 F1800
+G1 X97.195 Y140.454 E132.44175 F3000
+G1 X97.628 Y141.015 E132.46532 F4800
+G1 X97.064 Y141.376 E132.48762 F3000
+G1 X94.350 Y141.230 E132.57813 F4800
+G1 X93.207 Y145.807 E132.73523 F4800
+G1 X91.671 Y148.474 E132.83769 F3000
+G1 X91.885 Y150.480 E132.90489 F9000
+G1 X88.341 Y148.887 E133.03428 F4800
+G1 X88.217 Y148.180 E133.05816 F6000
+G1 X87.531 Y148.012 E133.08170 F6000
+G1 X85.928 Y145.045 E133.19399 F1800
+G1 X84.298 Y143.790 E133.26250 F9000
+G1 X84.822 Y146.111 E133.34173 F4800
+G1 X89.388 Y145.657 E133.49451 F6000
+G1 X88.180 Y146.873 E133.55157 F3000
+G1 X88.415 Y147.102 E133.56250 F1800
+G1 X89.540 Y145.496 E133.62780 F6000
+G1 X92.095 Y143.221 E133.74172 F1800
+G1 X92.869 Y143.213 E133.76747 F3000
+G1 X94.090 Y139.847 E133.88670 F6000
+G1 X95.258 Y138.786 E133.93927 F4800
+G1 X95.295 Y142.825 E134.07378 F4800
+G1 X95.769 Y142.280 E134.09785 F9000
+G1 X99.114 Y143.748 E134.21950 F4800
+G1 X101.076 Y146.431 E134.33018 F4800
+G1 X101.986 Y149.289 E134.43005 F1800
+G1 X101.885 Y153.832 E134.58138 F4800
+G1 X103.924 Y154.921 E134.65835 F6000
+G1 X105.220 Y154.261 E134.70677 F6000
+G1 X103.801 Y150.522 E134.83993 F6000
+G1 X103.078 Y152.362 E134.90575 F6000
+G1 X100.566 Y155.331 E135.03524 F3000
+G1 X96.133 Y156.965 E135.19258 F3000
+G1 X95.284 Y156.021 E135.23486 F1800
+G1 X92.621 Y151.831 E135.40017 F4800
+G1 X92.072 Y152.071 E135.42012 F1800
+G1 X91.279 Y152.106 E135.44656 F9000
+G1 X90.924 Y152.292 E135.45990 F9000
+G1 X89.944 Y154.783 E135.54905 F1800
+G1 X88.830 Y158.012 E135.66278 F4800
+G1 X87.690 Y157.140 E135.71054 F1800
+G1 X88.055 Y152.315 E135.87168 F3000
+G1 X85.967 Y153.411 E135.95022 F4800
+G1 X85.612 Y153.631 E135.96410 F9000
+G1 X89.097 Y152.455 E136.08655 F9000
+G1 X87.833 Y152.965 E136.13194 F4800
+G1 X89.899 Y150.027 E136.25155 F9000
+G1 X88.488 Y148.823 E136.31331 F4800
+G1 X88.586 Y149.815 E136.34648 F1800
+G1 X87.092 Y152.660 E136.45350 F3000
+G1 X88.879 Y148.156 E136.61488 F1800
+G1 X91.225 Y152.357 E136.77510 F1800
+G1 X95.376 Y150.864 E136.92200 F3000
+G1 X92.574 Y153.418 E137.04825 F4800
+G1 X89.977 Y153.931 E137.13641 F1800
+G1 X87.579 Y154.724 E137.22052 F4800
+G1 X86.340 Y153.143 E137.28740 F3000
+G1 X86.962 Y155.858 E137.38017 F9000
+G1 X91.716 Y156.202 E137.53888 F3000
+G1 X93.231 Y154.784 E137.60798 F3000
+G1 X92.795 Y153.424 E137.65554 F9000
+G1 X94.150 Y155.798 E137.74655 F9000
+G1 X94.387 Y156.212 E137.76245 F6000
+G1 X95.834 Y159.779 E137.89063 F6000
+G1 X95.877 Y156.469 E138.00088 F1800
+G1 X94.863 Y157.519 E138.04950 F6000
+G1 X96.648 Y157.394 E138.10910 F1800
+G1 X98.782 Y154.764 E138.22188 F4800
+G1 X98.861 Y156.870 E138.29205 F4800
+G1 X99.843 Y157.202 E138.32658 F9000
+G1 X96.782 Y158.684 E138.43984 F4800
+G1 X97.021 Y159.007 E138.45324 F9000
+G1 X96.919 Y157.516 E138.50302 F1800
+G1 X94.411 Y153.417 E138.66305 F4800
+G1 X95.251 Y149.621 E138.79251 F3000
+G1 X93.785 Y149.931 E138.84241 F3000
+G1 X91.624 Y146.389 E138.98059 F6000
+G1 X90.643 Y148.659 E139.06295 F6000
+G1 X91.833 Y147.985 E139.10847 F4800
+G1 X90.373 Y151.134 E139.22404 F4800
+G1 X91.743 Y151.339 E139.27017 F3000
+G1 X88.414 Y148.994 E139.40578 F9000
+G1 X87.982 Y149.355 E139.42451 F1800
+G1 X86.198 Y146.895 E139.52569 F9000
+G1 X82.365 Y145.962 E139.65705 F1800
+G1 X82.203 Y148.856 E139.75356 F9000
+G1 X84.960 Y146.816 E139.86778 F1800
+G1 X86.458 Y147.811 E139.92764 F3000
+G1 X85.058 Y147.912 E139.97439 F1800
+G1 X84.281 Y148.857 E140.01515 F9000
+G1 X85.238 Y147.146 E140.08045 F6000
+G1 X83.612 Y147.153 E140.13458 F1800
+G1 X79.520 Y144.961 E140.28919 F6000
+G1 X75.768 Y141.688 E140.45497 F6000
+G1 X79.107 Y140.114 E140.57787 F3000
+G1 X81.635 Y137.246 E140.70519 F4800
+G1 X81.194 Y135.376 E140.76917 F6000
+G1 X83.239 Y135.704 E140.83813 F3000
+G1 X82.543 Y138.199 E140.92438 F4800
+G1 X82.744 Y137.901 E140.93636 F9000
+G1 X84.760 Y138.693 E141.00850 F6000
+G1 X85.142 Y139.125 E141.02767 F9000
+G1 X84.111 Y139.096 E141.06201 F4800
+G1 X79.986 Y139.620 E141.20050 F1800
+G1 X79.633 Y143.901 E141.34352 F1800
+G1 X80.381 Y141.331 E141.43265 F1800
+G1 X80.469 Y144.291 E141.53126 F4800
+G1 X79.381 Y141.746 E141.62343 F3000
+G1 X76.518 Y142.609 E141.72298 F1800
+G1 X73.620 Y143.959 E141.82947 F4800
+G1 X69.498 Y146.182 E141.98541 F9000
+G1 X70.624 Y144.408 E142.05538 F4800
+G1 X72.200 Y143.683 E142.11314 F1800
+G1 X71.923 Y143.024 E142.13695 F3000
+G1 X72.335 Y144.191 E142.17815 F6000
+G1 X72.828 Y144.630 E142.20014 F1800
+G1 X70.146 Y145.853 E142.29829 F4800
+G1 X68.855 Y145.914 E142.34133 F3000
+G1 X68.749 Y145.617 E142.35183 F9000
+G1 X71.632 Y148.737 E142.49328 F3000
+G1 X73.357 Y146.730 E142.58140 F1800
+G1 X72.646 Y144.035 E142.67422 F9000
+G1 X74.526 Y147.498 E142.80543 F1800
+G1 X74.513 Y145.501 E142.87195 F6000
+G1 X74.441 Y147.057 E142.92382 F3000
+G1 X73.517 Y147.999 E142.96775 F3000
+G1 X73.497 Y148.509 E142.98476 F9000
+G1 X72.470 Y149.744 E143.03824 F3000
+G1 X70.406 Y148.891 E143.11259 F4800
+G1 X72.185 Y146.078 E143.22341 F6000
+G1 X73.540 Y147.444 E143.28752 F9000
+G1 X73.423 Y150.359 E143.38464 F1800
+G1 X72.335 Y150.784 E143.42355 F3000
+G1 X69.379 Y153.058 E143.54774 F4800
+G1 X68.318 Y155.456 E143.63506 F4800
+G1 X69.607 Y154.250 E143.69383 F1800
+G1 X70.656 Y151.619 E143.78815 F4800
+G1 X68.729 Y150.108 E143.86971 F4800
+G1 X71.625 Y147.690 E143.99535 F4800
+G1 X69.505 Y145.462 E144.09775 F1800
+G1 X70.429 Y148.776 E144.21232 F6000
+G1 X70.649 Y148.566 E144.22242 F4800
+G1 X74.645 Y149.512 E144.35918 F4800
+G1 X76.880 Y152.221 E144.47612 F9000
+G1 X72.566 Y150.966 E144.62573 F3000
+G1 X71.167 Y147.490 E144.75052 F9000
+G1 X71.306 Y148.138 E144.77260 F1800
+G1 X76.150 Y147.993 E144.93397 F4800
+G1 X77.721 Y151.133 E145.05089 F1800
+G1 X79.660 Y155.614 E145.21351 F9000
+G1 X79.161 Y154.339 E145.25914 F1800
+G1 X78.543 Y156.438 E145.33202 F4800
+G1 X76.498 Y153.501 E145.45121 F6000
+G1 X75.143 Y156.027 E145.54669 F4800
+G1 X74.362 Y151.623 E145.69565 F9000
+G1 X76.726 Y155.902 E145.85846 F3000
+G1 X78.554 Y153.919 E145.94827 F4800
+G1 X81.956 Y153.838 E146.06158 F4800
+G1 X82.860 Y156.320 E146.14953 F6000
+G1 X82.721 Y157.631 E146.19345 F1800
+G1 X83.534 Y159.398 E146.25820 F3000
+G1 X83.809 Y158.471 E146.29040 F9000
+G1 X83.175 Y155.866 E146.37967 F1800
+G1 X82.753 Y155.687 E146.39493 F1800
+G1 X78.933 Y157.338 E146.53350 F3000
+G1 X81.121 Y154.878 E146.64311 F6000
+G1 X82.899 Y153.546 E146.71710 F4800
+G1 X82.003 Y153.646 E146.74711 F1800
+G1 X79.627 Y150.189 E146.88680 F1800
+G1 X78.230 Y145.530 E147.04878 F4800
+G1 X77.032 Y144.345 E147.10489 F1800
+G1 X80.266 Y142.389 E147.23077 F1800
+G1 X76.393 Y142.372 E147.35975 F1800
+G1 X76.461 Y142.834 E147.37529 F9000
+G1 X72.413 Y140.105 E147.53787 F4800
+G1 X67.907 Y140.096 E147.68791 F4800
+G1 X68.513 Y141.122 E147.72757 F4800
+G1 X68.604 Y136.852 E147.86979 F3000
+G1 X69.217 Y137.398 E147.89712 F1800
+G1 X65.610 Y138.350 E148.02134 F4800
+G1 X65.702 Y138.595 E148.03007 F1800
+G1 X65.850 Y139.027 E148.04526 F3000
+G1 X68.003 Y141.573 E148.15629 F6000
+G1 X72.434 Y139.742 E148.31595 F3000
+G1 X73.552 Y135.614 E148.45835 F6000
+G1 X74.712 Y136.016 E148.49923 F1800
+G1 X75.671 Y135.366 E148.53781 F9000
+G1 X75.015 Y136.232 E148.57397 F1800
+G1 X76.553 Y138.484 E148.66479 F4800
+G1 X75.957 Y138.675 E148.68562 F9000
+G1 X76.784 Y134.382 E148.83118 F1800
+G1 X75.473 Y132.187 E148.91631 F3000
+G1 X79.245 Y131.189 E149.04624 F6000
+G1 X80.519 Y131.207 E149.08864 F4800
+G1 X81.768 Y133.958 E149.18925 F4800
+G1 X84.757 Y131.881 E149.31046 F3000
+G1 X83.870 Y131.865 E149.33999 F1800
+G1 X81.964 Y128.787 E149.46055 F9000
+G1 X79.296 Y128.488 E149.54994 F1800
+G1 X80.693 Y131.410 E149.65779 F6000
+G1 X80.357 Y131.459 E149.66911 F4800
+G1 X81.191 Y132.055 E149.70325 F3000
+G1 X78.667 Y132.463 E149.78838 F4800
+G1 X78.668 Y130.144 E149.86560 F1800
+G1 X76.224 Y132.042 E149.96864 F6000
+G1 X72.907 Y131.239 E150.08229 F4800
+G1 X73.815 Y130.193 E150.12845 F4800
+G1 X73.562 Y130.590 E150.14413 F6000
+G1 X75.754 Y130.978 E150.21826 F3000
+G1 X73.253 Y129.674 E150.31219 F4800
+G1 X72.149 Y128.568 E150.36422 F1800
+G1 X69.288 Y128.747 E150.45968 F4800
+G1 X67.809 Y130.122 E150.52691 F4800
+G1 X68.821 Y130.127 E150.56060 F4800
+G1 X72.622 Y129.726 E150.68786 F1800
+G1 X70.811 Y131.613 E150.77495 F6000
+G1 X72.364 Y130.005 E150.84940 F9000
+G1 X69.854 Y131.837 E150.95288 F3000
+G1 X67.133 Y131.221 E151.04580 F3000
+G1 X67.669 Y128.909 E151.12481 F4800
+G1 X69.213 Y131.141 E151.21519 F6000
+G1 X70.601 Y132.267 E151.27471 F9000
+G1 X68.870 Y131.556 E151.33705 F1800
+G1 X72.339 Y130.760 E151.45557 F4800
+G1 X75.984 Y129.965 E151.57981 F6000
+G1 X79.210 Y128.250 E151.70148 F1800
+G1 X78.943 Y127.506 E151.72783 F6000
+G1 X78.245 Y131.354 E151.85806 F3000
+G1 X82.460 Y131.666 E151.99882 F9000
+G1 X82.014 Y134.831 E152.10525 F4800
+G1 X79.832 Y133.394 E152.19223 F6000
+G1 X79.438 Y133.481 E152.20568 F1800
+G1 X79.890 Y134.635 E152.24696 F6000
+G1 X80.119 Y132.069 E152.33273 F4800
+G1 X81.271 Y127.975 E152.47434 F6000
+G1 X79.136 Y127.434 E152.54766 F6000
+G1 X79.698 Y125.285 E152.62161 F1800
+G1 X79.158 Y123.193 E152.69356 F4800
+G1 X82.893 Y124.436 E152.82465 F3000
+G1 X85.687 Y127.952 E152.97419 F6000
+G1 X82.852 Y131.532 E153.12629 F9000
+G1 X81.384 Y131.723 E153.17556 F1800
+G1 X80.949 Y131.839 E153.19055 F9000
+G1 X80.593 Y131.490 E153.20716 F3000
+G1 X78.560 Y133.069 E153.29291 F3000
+G1 X79.010 Y133.841 E153.32267 F3000
+G1 X78.446 Y134.570 E153.35336 F3000
+G1 X77.431 Y130.128 E153.50509 F4800
+G1 X77.684 Y130.207 E153.51393 F4800
+G1 X76.946 Y133.818 E153.63665 F3000
+G1 X79.676 Y133.916 E153.72759 F4800
+G1 X80.187 Y133.873 E153.74469 F4800
+G1 X78.041 Y135.358 E153.83159 F6000
+G1 X77.341 Y133.427 E153.90000 F9000
+G1 X80.621 Y133.861 E154.01016 F3000
+G1 X81.912 Y137.749 E154.14660 F9000
+G1 X83.506 Y140.334 E154.24773 F1800
+G1 X81.225 Y137.829 E154.36055 F9000
+G1 X81.366 Y137.529 E154.37160 F6000
+G1 X78.748 Y133.500 E154.53159 F4800
+G1 X81.492 Y134.791 E154.63259 F3000
+G1 X80.246 Y134.397 E154.67613 F3000
+G1 X82.111 Y136.506 E154.76990 F6000
+G1 X83.342 Y133.379 E154.88184 F1800
+G1 X85.185 Y133.090 E154.94397 F3000
+G1 X87.203 Y130.811 E155.04533 F9000
+G1 X83.006 Y133.329 E155.20831 F9000
+G1 X83.769 Y132.702 E155.24120 F4800
+G1 X82.051 Y129.611 E155.35896 F4800
+G1 X82.158 Y130.377 E155.38469 F9000
+G1 X79.666 Y126.403 E155.54089 F6000
+G1 X81.801 Y125.088 E155.62441 F4800
+G1 X78.347 Y122.073 E155.77708 F9000
+G1 X78.242 Y121.534 E155.79538 F4800
+G1 X78.166 Y122.274 E155.82016 F1800
+G1 X78.999 Y121.327 E155.86215 F4800
+G1 X80.577 Y118.447 E155.97149 F1800
+G1 X78.651 Y119.852 E156.05088 F3000
+G1 X75.439 Y120.989 E156.16434 F4800
+G1 X77.563 Y120.816 E156.23532 F6000
+G1 X77.088 Y118.889 E156.30142 F4800
+G1 X77.648 Y117.995 E156.33655 F1800
+G1 X77.132 Y114.741 E156.44625 F3000
+G1 X75.015 Y110.862 E156.59342 F9000
+G1 X74.117 Y110.857 E156.62330 F6000
+G1 X71.922 Y106.403 E156.78864 F1800
+G1 X70.421 Y109.588 E156.90588 F6000
+G1 X67.478 Y111.859 E157.02966 F3000
+G1 X65.390 Y112.396 E157.10146 F4800
+G1 X65.765 Y116.791 E157.24835 F4800
+G1 X64.332 Y118.854 E157.33198 F1800
+G1 X69.115 Y119.697 E157.49368 F4800
+G1 X71.349 Y117.943 E157.58828 F3000
+G1 X72.350 Y118.936 E157.63521 F9000
+G1 X72.703 Y119.075 E157.64785 F3000
+G1 X73.139 Y119.637 E157.67154 F4800
+G1 X77.608 Y121.049 E157.82761 F1800
+G1 X77.763 Y121.279 E157.83684 F9000
+G1 X79.270 Y121.758 E157.88951 F6000
+G1 X78.210 Y121.968 E157.92552 F1800
+G1 X78.103 Y121.357 E157.94617 F9000
+G1 X76.651 Y123.478 E158.03176 F6000
+G1 X74.368 Y121.643 E158.12929 F4800
+G1 X78.421 Y118.787 E158.29438 F4800
+G1 X81.084 Y114.959 E158.44968 F6000
+G1 X83.528 Y115.869 E158.53654 F6000
+G1 X84.509 Y115.556 E158.57083 F1800
+G1 X84.408 Y114.920 E158.59228 F9000
+G1 X86.740 Y111.597 E158.72744 F1800
+G1 X83.019 Y110.525 E158.85639 F6000
+G1 X85.595 Y107.856 E158.97995 F3000
+G1 X84.521 Y107.584 E159.01683 F3000
+G1 X84.739 Y107.366 E159.02710 F4800
+G1 X84.948 Y108.162 E159.05448 F1800
+G1 X86.734 Y106.325 E159.13980 F1800
+G1 X83.935 Y106.437 E159.23310 F4800
+G1 X87.240 Y104.810 E159.35578 F4800
+G1 X84.001 Y107.289 E159.49159 F4800
+G1 X85.082 Y109.666 E159.57855 F9000
+G1 X82.917 Y108.294 E159.66389 F3000
+G1 X80.882 Y108.646 E159.73267 F3000
+G1 X78.344 Y106.015 E159.85438 F9000
+G1 X79.485 Y103.655 E159.94168 F4800
+G1 X82.169 Y104.767 E160.03841 F6000
+G1 X83.091 Y106.172 E160.09437 F1800
+G1 X83.460 Y104.447 E160.15311 F9000
+G1 X84.957 Y105.066 E160.20706 F9000
+G1 X86.204 Y109.888 E160.37291 F4800
+G1 X84.459 Y107.540 E160.47034 F3000
+G1 X83.256 Y104.943 E160.56565 F3000
+G1 X82.506 Y100.921 E160.70188 F6000
+G1 X79.281 Y103.064 E160.83083 F6000
+G1 X84.112 Y104.063 E160.99509 F1800
+G1 X85.641 Y101.934 E161.08239 F4800
+G1 X82.644 Y99.250 E161.21635 F6000
+G1 X82.826 Y97.818 E161.26440 F6000
+G1 X83.168 Y100.798 E161.36430 F9000
+G1 X80.197 Y101.105 E161.46375 F1800
+G1 X77.345 Y105.171 E161.62913 F1800
+G1 X77.812 Y101.840 E161.74111 F9000
+G1 X78.867 Y101.964 E161.77647 F4800
+G1 X79.874 Y104.341 E161.86243 F9000
+G1 X76.973 Y104.282 E161.95906 F4800
+G1 X74.265 Y103.812 E162.05058 F6000
+G1 X75.043 Y107.952 E162.19084 F6000
+G1 X73.640 Y106.708 E162.25328 F3000
+G1 X73.491 Y111.282 E162.40568 F6000
+G1 X70.020 Y108.741 E162.54894 F3000
+G1 X69.555 Y110.983 E162.62520 F4800
+G1 X67.402 Y114.065 E162.75040 F1800
+G1 X66.862 Y119.027 E162.91661 F1800
+G1 X63.956 Y118.833 E163.01359 F6000
+G1 X62.478 Y117.215 E163.08657 F9000
+G1 X64.714 Y121.001 E163.23300 F3000
+G1 X64.206 Y121.318 E163.25294 F9000
+G1 X61.983 Y125.430 E163.40860 F4800
+G1 X63.219 Y126.786 E163.46966 F3000
+G1 X67.517 Y128.413 E163.62271 F9000
+G1 X67.863 Y129.653 E163.66559 F6000
+G1 X69.852 Y129.755 E163.73190 F3000
+G1 X69.833 Y130.254 E163.74852 F4800
+G1 X71.241 Y132.035 E163.82413 F3000
+G1 X70.477 Y134.652 E163.91493 F4800
+G1 X70.949 Y134.412 E163.93259 F1800
+G1 X74.292 Y132.707 E164.05753 F3000
+G1 X72.975 Y131.163 E164.12511 F3000
+G1 X74.359 Y127.680 E164.24992 F1800
+G1 X69.834 Y127.403 E164.40087 F1800
+G1 X69.638 Y127.023 E164.41511 F3000
+G1 X70.492 Y129.373 E164.49836 F1800
+G1 X73.147 Y125.485 E164.65512 F6000
+G1 X71.967 Y126.047 E164.69863 F4800
+G1 X70.373 Y125.425 E164.75562 F3000
+G1 X68.510 Y127.048 E164.83787 F6000
+G1 X68.935 Y130.625 E164.95785 F4800
+G1 X65.329 Y129.340 E165.08535 F4800
+G1 X65.702 Y129.220 E165.09842 F4800
+G1 X66.857 Y131.535 E165.18458 F1800
+G1 X67.298 Y134.126 E165.27209 F6000
+G1 X68.489 Y129.420 E165.43373 F4800
+G1 X70.278 Y132.487 E165.55195 F4800
+G1 X69.318 Y132.952 E165.58749 F3000
+G1 X69.581 Y133.080 E165.59721 F1800
+G1 X68.328 Y136.946 E165.73256 F9000
+G1 X67.216 Y140.897 E165.86924 F1800
+G1 X66.836 Y141.273 E165.88702 F4800
+G1 X65.298 Y136.833 E166.04347 F3000
+G1 X64.087 Y138.207 E166.10445 F9000
+G1 X63.635 Y138.870 E166.13116 F4800
+G1 X64.777 Y139.622 E166.17668 F6000
+G1 X63.687 Y141.406 E166.24631 F3000
+G1 X60.441 Y143.242 E166.37050 F6000
+G1 X61.160 Y139.340 E166.50262 F6000
+G1 X58.771 Y143.709 E166.66845 F9000
+G1 X56.382 Y146.758 E166.79743 F6000
+G1 X57.616 Y142.726 E166.93784 F6000
+G1 X56.497 Y144.694 E167.01323 F9000
+G1 X55.891 Y143.520 E167.05724 F9000
+G1 X58.187 Y141.013 E167.17043 F4800
+G1 X54.517 Y141.006 E167.29263 F4800
+G1 X52.435 Y141.563 E167.36441 F4800
+G1 X47.626 Y140.777 E167.52666 F3000
+G1 X48.942 Y139.466 E167.58849 F9000
+G1 X51.081 Y138.537 E167.66617 F1800
+G1 X50.524 Y138.272 E167.68671 F6000
+G1 X53.783 Y135.031 E167.83975 F3000
+G1 X56.482 Y138.720 E167.99196 F1800
+G1 X56.764 Y138.365 E168.00705 F4800
+G1 X57.900 Y138.104 E168.04586 F1800
+G1 X54.094 Y137.185 E168.17625 F6000
+G1 X50.466 Y135.960 E168.30376 F4800
+G1 X49.542 Y135.915 E168.33454 F3000
+G1 X52.555 Y136.083 E168.43504 F9000
+G1 X51.427 Y136.401 E168.47407 F4800
+G1 X49.823 Y138.133 E168.55268 F3000
+G1 X47.409 Y139.068 E168.63889 F1800
+G1 X44.445 Y137.993 E168.74385 F6000
+G1 X41.604 Y138.061 E168.83848 F3000
+G1 X40.323 Y142.534 E168.99343 F4800
+G1 X43.473 Y145.032 E169.12729 F1800
+G1 X43.100 Y147.782 E169.21972 F4800
+G1 X45.100 Y147.067 E169.29046 F4800
+G1 X46.254 Y147.971 E169.33925 F6000
+G1 X45.346 Y148.791 E169.38000 F6000
+G1 X44.696 Y147.483 E169.42861 F3000
+G1 X48.089 Y146.656 E169.54488 F9000
+G1 X47.741 Y146.745 E169.55682 F9000
+G1 X51.097 Y144.632 E169.68889 F9000
+G1 X47.648 Y147.792 E169.84468 F1800
+G1 X45.256 Y149.905 E169.95096 F3000
+G1 X43.585 Y148.567 E170.02227 F3000
+G1 X42.331 Y151.725 E170.13543 F6000
+G1 X41.428 Y152.509 E170.17525 F9000
+G1 X41.184 Y151.894 E170.19725 F9000
+G1 X42.758 Y153.133 E170.26394 F1800
+G1 X41.395 Y153.049 E170.30943 F6000
+G1 X40.381 Y149.034 E170.44734 F4800
+G1 X44.176 Y148.869 E170.57383 F9000
+G1 X44.023 Y148.346 E170.59199 F4800
+G1 X41.946 Y151.389 E170.71470 F6000
+G1 X43.972 Y151.377 E170.78218 F6000
+G1 X43.724 Y150.947 E170.79871 F1800
+G1 X43.619 Y150.683 E170.80817 F1800
+G1 X45.950 Y150.944 E170.88627 F4800
+G1 X44.235 Y151.148 E170.94376 F9000
+G1 X46.215 Y149.992 E171.02012 F1800
+G1 X50.066 Y147.901 E171.16602 F3000
+G1 X53.119 Y148.345 E171.26876 F4800
+G1 X53.834 Y146.038 E171.34918 F4800
+G1 X51.066 Y146.623 E171.44338 F4800
+G1 X51.304 Y150.899 E171.58600 F9000
+G1 X55.211 Y149.719 E171.72190 F6000
+G1 X58.540 Y150.198 E171.83390 F1800
+G1 X62.339 Y150.273 E171.96041 F6000
+G1 X59.190 Y148.946 E172.07419 F9000
+G1 X56.859 Y145.217 E172.22063 F6000
+G1 X59.993 Y146.985 E172.34048 F1800
+G1 X58.965 Y148.996 E172.41569 F3000
+G1 X57.293 Y148.844 E172.47159 F1800
+G1 X60.548 Y148.856 E172.57999 F3000
+G1 X64.225 Y146.383 E172.72754 F3000
+G1 X63.436 Y147.637 E172.77686 F1800
+G1 X63.048 Y152.377 E172.93525 F1800
+G1 X64.120 Y148.417 E173.07187 F3000
+G1 X61.989 Y146.507 E173.16717 F4800
+G1 X60.731 Y150.695 E173.31277 F4800
+G1 X57.687 Y153.247 E173.44506 F6000
+G1 X61.562 Y150.384 E173.60550 F9000
+G1 X63.050 Y152.276 E173.68566 F3000
+G1 X61.922 Y152.697 E173.72575 F6000
+G1 X62.645 Y150.920 E173.78965 F9000
+G1 X62.436 Y150.789 E173.79787 F6000
+G1 X60.467 Y154.150 E173.92758 F9000
+G1 X58.978 Y155.921 E174.00462 F1800
+G1 X60.207 Y158.092 E174.08769 F3000
+G1 X60.864 Y153.688 E174.23597 F4800
+G1 X65.333 Y152.023 E174.39479 F1800
+G1 X65.419 Y154.377 E174.47322 F6000
+G1 X65.013 Y150.437 E174.60512 F1800
+G1 X64.124 Y151.022 E174.64056 F3000
+G1 X67.237 Y149.645 E174.75391 F9000
+G1 X71.794 Y149.084 E174.90680 F4800
+G1 X71.821 Y148.234 E174.93513 F9000
+G1 X72.894 Y152.188 E175.07157 F4800
+G1 X69.806 Y148.937 E175.22088 F6000
+G1 X69.920 Y148.477 E175.23665 F1800
+G1 X72.272 Y146.270 E175.34403 F3000
+G1 X70.218 Y146.485 E175.41279 F4800
+G1 X67.556 Y148.540 E175.52478 F1800
+G1 X68.115 Y150.725 E175.59988 F4800
+G1 X68.446 Y150.574 E175.61199 F6000
+G1 X68.717 Y152.623 E175.68084 F4800
+G1 X69.888 Y151.346 E175.73853 F3000
+G1 X67.674 Y154.704 E175.87247 F4800
+G1 X70.800 Y156.992 E176.00144 F3000
+G1 X70.232 Y156.409 E176.02855 F1800
+G1 X67.508 Y154.126 E176.14687 F9000
+G1 X71.268 Y152.514 E176.28311 F9000
+G1 X71.489 Y156.730 E176.42370 F1800
+G1 X71.109 Y157.822 E176.46221 F1800
+G1 X70.820 Y155.918 E176.52634 F6000
+G1 X73.297 Y153.439 E176.64304 F9000
+G1 X72.275 Y149.603 E176.77523 F3000
+G1 X76.748 Y149.690 E176.92419 F1800
+G1 X75.615 Y149.986 E176.96318 F1800
+G1 X77.530 Y147.568 E177.06591 F9000
+G1 X73.577 Y148.339 E177.20001 F3000
+G1 X72.173 Y146.551 E177.27573 F3000
+G1 X74.657 Y146.172 E177.35943 F1800
+G1 X76.479 Y145.010 E177.43139 F6000
+G1 X77.889 Y145.734 E177.48418 F4800
+G1 X78.040 Y144.691 E177.51926 F4800
+G1 X76.013 Y144.171 E177.58894 F6000
+G1 X74.899 Y141.282 E177.69204 F6000
+G1 X73.550 Y141.437 E177.73728 F6000
+G1 X73.285 Y138.389 E177.83916 F9000
+G1 X73.572 Y138.456 E177.84899 F6000
+G1 X74.044 Y140.083 E177.90542 F1800
+G1 X72.886 Y139.349 E177.95108 F6000
+G1 X73.739 Y138.092 E178.00165 F1800
+G1 X69.282 Y137.422 E178.15173 F9000
+G1 X68.394 Y139.455 E178.22561 F1800
+G1 X68.015 Y138.614 E178.25631 F3000
+G1 X66.421 Y134.727 E178.39621 F1800
+G1 X66.668 Y135.890 E178.43580 F3000
+G1 X65.758 Y135.522 E178.46847 F6000
+G1 X65.526 Y134.892 E178.49085 F6000
+G1 X66.670 Y139.505 E178.64913 F3000
+G1 X63.502 Y138.784 E178.75731 F3000
+G1 X62.949 Y140.886 E178.82970 F1800
+G1 X65.148 Y143.318 E178.93889 F1800
+G1 X66.453 Y142.103 E178.99826 F6000
+G1 X64.540 Y137.709 E179.15784 F9000
+G1 X65.771 Y135.493 E179.24226 F9000
+G1 X66.891 Y135.796 E179.28090 F6000
+G1 X69.134 Y134.494 E179.36726 F3000
+G1 X69.446 Y135.043 E179.38827 F9000
+G1 X73.876 Y136.030 E179.53942 F3000
+G1 X76.714 Y137.404 E179.64441 F6000
+G1 X74.127 Y138.175 E179.73432 F4800
+G1 X74.568 Y142.896 E179.89220 F1800
+G1 X73.267 Y145.750 E179.99665 F3000
+G1 X75.545 Y147.142 E180.08555 F4800
+G1 X75.257 Y146.841 E180.09940 F4800
+G1 X75.053 Y146.916 E180.10665 F3000
+G1 X76.979 Y146.089 E180.17643 F6000
+G1 X80.607 Y148.069 E180.31406 F6000
+G1 X79.048 Y150.004 E180.39680 F6000
+G1 X77.385 Y152.036 E180.48424 F9000
+G1 X78.969 Y154.888 E180.59288 F3000
+G1 X78.216 Y155.685 E180.62938 F1800
+G1 X74.670 Y154.516 E180.75371 F6000
+G1 X73.741 Y153.608 E180.79698 F6000
+G1 X72.264 Y151.824 E180.87413 F4800
+G1 X70.900 Y149.579 E180.96159 F4800
+G1 X70.305 Y150.987 E181.01251 F3000
+G1 X67.286 Y151.024 E181.11303 F1800
+G1 X67.559 Y151.044 E181.12212 F4800
+G1 X68.660 Y149.951 E181.17379 F9000
+G1 X70.133 Y151.447 E181.24370 F6000
+G1 X69.242 Y154.808 E181.35948 F4800
+G1 X67.319 Y158.362 E181.49407 F9000
+G1 X66.269 Y155.459 E181.59689 F9000
+G1 X68.800 Y153.354 E181.70650 F9000
+G1 X68.578 Y151.778 E181.75949 F1800
+G1 X67.998 Y151.662 E181.77918 F9000
+G1 X63.984 Y149.295 E181.93436 F1800
+G1 X62.742 Y150.905 E182.00209 F3000
+G1 X62.803 Y151.233 E182.01320 F1800
+G1 X65.097 Y147.755 E182.15194 F4800
+G1 X61.736 Y147.582 E182.26402 F1800
+G1 X60.335 Y146.815 E182.31719 F3000
+G1 X57.807 Y144.693 E182.42710 F1800
+G1 X60.507 Y147.933 E182.56755 F6000
+G1 X60.724 Y150.785 E182.66282 F1800
+G1 X55.941 Y149.725 E182.82597 F6000
+G1 X58.696 Y147.377 E182.94653 F6000
+G1 X58.770 Y145.654 E183.00393 F4800
+G1 X61.395 Y142.720 E183.13503 F6000
+G1 X61.433 Y137.774 E183.29976 F1800
+G1 X61.556 Y135.567 E183.37336 F6000
+G1 X64.548 Y139.288 E183.53236 F6000
+G1 X64.055 Y138.763 E183.55634 F4800
+G1 X65.087 Y139.601 E183.60062 F9000
+G1 X61.742 Y142.430 E183.74649 F4800
+G1 X60.551 Y145.993 E183.87162 F9000
+G1 X60.958 Y147.493 E183.92337 F6000
+G1 X58.141 Y146.181 E184.02686 F3000
+G1 X58.132 Y144.452 E184.08445 F4800
+G1 X60.324 Y144.630 E184.15767 F3000
+G1 X63.214 Y147.550 E184.29451 F4800
+G1 X64.803 Y149.929 E184.38974 F4800
+G1 X64.964 Y150.322 E184.40389 F4800
+G1 X66.135 Y151.694 E184.46395 F3000
+G1 X64.498 Y150.857 E184.52519 F4800
+G1 X66.478 Y152.849 E184.61873 F4800
+G1 X63.582 Y155.097 E184.74082 F4800
+G1 X62.325 Y159.389 E184.88973 F3000
+G1 X61.156 Y159.650 E184.92965 F1800
+G1 X58.509 Y158.575 E185.02478 F9000
+G1 X56.329 Y158.304 E185.09794 F1800
+G1 X54.782 Y158.075 E185.14999 F9000
+G1 X58.428 Y155.114 E185.30638 F6000
+G1 X58.088 Y157.029 E185.37113 F6000
+G1 X62.918 Y156.219 E185.53424 F3000
+G1 X61.777 Y157.498 E185.59131 F9000
+G1 X64.296 Y154.409 E185.72404 F1800
+G1 X63.863 Y154.355 E185.73856 F6000
+G1 X65.136 Y155.114 E185.78792 F4800
+G1 X68.102 Y154.008 E185.89333 F9000
+G1 X69.991 Y155.093 E185.96586 F1800
+G1 X71.689 Y155.639 E186.02528 F3000
+G1 X75.903 Y157.645 E186.18068 F6000
+G1 X71.733 Y157.842 E186.31971 F1800
+G1 X71.152 Y156.854 E186.35785 F9000
+G1 X72.504 Y156.540 E186.40410 F3000
+G1 X75.486 Y157.309 E186.50664 F9000
+G1 X76.546 Y158.303 E186.55501 F4800
+G1 X74.428 Y158.437 E186.62570 F9000
+G1 X73.077 Y158.648 E186.67120 F9000
+G1 X73.940 Y156.961 E186.73429 F9000
+G1 X73.497 Y156.876 E186.74930 F3000
+G1 X73.577 Y156.561 E186.76013 F6000
+G1 X76.686 Y155.343 E186.87131 F1800
+G1 X78.489 Y153.050 E186.96845 F4800
+G1 X77.268 Y152.207 E187.01785 F4800
+G1 X77.198 Y147.851 E187.16294 F1800
+G1 X79.004 Y149.331 E187.24068 F3000
+G1 X81.056 Y147.095 E187.34176 F3000
+G1 X81.971 Y147.179 E187.37235 F9000
+G1 X79.457 Y149.323 E187.48239 F6000
+G1 X78.671 Y148.439 E187.52177 F4800
+G1 X80.941 Y150.414 E187.62194 F3000
+G1 X81.533 Y150.255 E187.64238 F9000
+G1 X84.301 Y146.331 E187.80227 F4800
+G1 X83.868 Y150.855 E187.95358 F6000
+G1 X82.792 Y154.312 E188.07414 F9000
+G1 X79.769 Y153.790 E188.17629 F6000
+G1 X77.734 Y156.652 E188.29324 F1800
+G1 X79.895 Y156.183 E188.36689 F4800
+G1 X81.359 Y153.251 E188.47603 F6000
+G1 X86.129 Y153.453 E188.63502 F6000
+G1 X85.886 Y156.155 E188.72538 F1800
+G1 X83.649 Y152.860 E188.85802 F4800
+G1 X84.291 Y153.229 E188.88266 F1800
+G1 X81.431 Y155.993 E189.01511 F6000
+G1 X81.005 Y156.108 E189.02981 F4800
+G1 X81.202 Y155.087 E189.06445 F1800
+G1 X82.652 Y154.333 E189.11888 F9000
+G1 X79.446 Y152.165 E189.24774 F1800
+G1 X80.860 Y156.648 E189.40428 F4800
+G1 X80.866 Y152.889 E189.52946 F1800
+G1 X84.411 Y154.742 E189.66265 F9000
+G1 X85.877 Y154.002 E189.71733 F4800
+G1 X86.774 Y158.111 E189.85738 F3000
+G1 X85.914 Y155.795 E189.93965 F3000
+G1 X90.367 Y154.343 E190.09562 F1800
+G1 X91.292 Y154.816 E190.13022 F3000
+G1 X91.226 Y159.602 E190.28959 F1800
+G1 X88.055 Y159.065 E190.39667 F4800
+G1 X89.740 Y158.261 E190.45882 F6000
+G1 X90.578 Y158.983 E190.49567 F3000
+G1 X90.964 Y158.813 E190.50973 F1800
+G1 X89.641 Y158.695 E190.55396 F9000
+G1 X91.592 Y156.659 E190.64785 F1800
+G1 X93.512 Y154.294 E190.74930 F9000
+G1 X93.999 Y152.708 E190.80453 F9000
+G1 X94.406 Y154.574 E190.86812 F1800
+G1 X96.548 Y157.800 E190.99707 F9000
+G1 X98.426 Y154.452 E191.12491 F4800
+G1 X95.197 Y151.001 E191.28230 F4800
+G1 X90.470 Y149.916 E191.44378 F3000
+G1 X89.787 Y152.693 E191.53901 F9000
+G1 X90.116 Y152.277 E191.55668 F9000
+G1 X92.007 Y156.444 E191.70907 F4800
+G1 X92.342 Y154.050 E191.78958 F4800
+G1 X96.903 Y153.533 E191.94243 F3000
+G1 X92.423 Y154.863 E192.09805 F9000
+G1 X92.343 Y153.270 E192.15114 F4800
+G1 X90.163 Y151.049 E192.25479 F1800
+G1 X91.173 Y153.353 E192.33858 F3000
+G1 X90.240 Y153.894 E192.37448 F3000
+G1 X90.829 Y153.471 E192.39862 F1800
+G1 X89.516 Y153.782 E192.44356 F6000
+G1 X85.073 Y154.151 E192.59200 F1800
+G1 X87.469 Y153.170 E192.67821 F3000
+G1 X86.585 Y155.405 E192.75825 F3000
+G1 X82.345 Y154.009 E192.90688 F3000
+G1 X81.225 Y151.656 E192.99368 F3000
+G1 X82.936 Y152.502 E193.05723 F1800
+G1 X84.925 Y151.513 E193.13121 F4800
+G1 X80.772 Y153.066 E193.27885 F4800
+G1 X80.230 Y153.178 E193.29729 F6000
+G1 X78.347 Y153.061 E193.36010 F4800
+G1 X81.966 Y151.495 E193.49141 F3000
+G1 X82.031 Y150.209 E193.53429 F1800
+G1 X82.862 Y150.072 E193.56234 F6000
+G1 X82.092 Y150.613 E193.59367 F4800
+G1 X80.972 Y149.727 E193.64123 F9000
+G1 X81.224 Y149.993 E193.65343 F9000
+G1 X83.252 Y149.741 E193.72147 F9000
+G1 X83.682 Y150.937 E193.76378 F1800
+G1 X85.061 Y150.954 E193.80971 F1800
+G1 X83.501 Y146.416 E193.96951 F3000
+G1 X82.137 Y146.725 E194.01607 F1800
+G1 X83.232 Y147.698 E194.06486 F1800
+G1 X85.264 Y147.389 E194.13330 F6000
+G1 X81.128 Y146.698 E194.27295 F9000
+G1 X76.448 Y146.338 E194.42923 F9000
+G1 X74.678 Y148.394 E194.51959 F1800
+G1 X74.728 Y149.983 E194.57253 F9000
+G1 X77.129 Y147.091 E194.69771 F4800
+G1 X79.894 Y146.746 E194.79049 F3000
+G1 X82.345 Y148.637 E194.89357 F6000
+G1 X82.010 Y148.377 E194.90768 F1800
+G1 X81.886 Y147.706 E194.93042 F9000
+G1 X79.212 Y146.395 E195.02958 F4800
+G1 X77.804 Y146.229 E195.07678 F1800
+G1 X77.509 Y147.222 E195.11126 F4800
+G1 X74.124 Y149.888 E195.25475 F3000
+G1 X74.512 Y149.308 E195.27800 F9000
+G1 X75.240 Y150.549 E195.32589 F6000
+G1 X77.548 Y153.707 E195.45618 F9000
+G1 X77.666 Y153.268 E195.47133 F4800
+G1 X76.798 Y151.619 E195.53339 F4800
+G1 X74.742 Y153.658 E195.62981 F1800
+G1 X73.899 Y154.291 E195.66492 F9000
+G1 X74.990 Y154.505 E195.70194 F9000
+G1 X75.689 Y154.545 E195.72527 F3000
+G1 X74.785 Y150.780 E195.85420 F6000
+G1 X73.920 Y150.210 E195.88871 F4800
+G1 X74.151 Y154.674 E196.03758 F3000
+G1 X71.136 Y156.108 E196.14874 F4800
+G1 X71.687 Y158.491 E196.23021 F9000
+G1 X72.210 Y157.403 E196.27042 F3000
+G1 X72.091 Y152.448 E196.43546 F6000
+G1 X71.232 Y147.727 E196.59525 F6000
+G1 X72.812 Y143.406 E196.74847 F4800
+G1 X76.863 Y145.836 E196.90578 F4800
+G1 X76.454 Y146.543 E196.93298 F4800
+G1 X75.668 Y149.393 E197.03142 F3000
+G1 X75.306 Y149.060 E197.04781 F4800
+G1 X75.760 Y148.874 E197.06415 F6000
+G1 X79.105 Y146.189 E197.20696 F6000
+G1 X79.295 Y142.953 E197.31492 F6000
+G1 X78.447 Y144.213 E197.36552 F9000
+G1 X77.235 Y145.040 E197.41437 F4800
+G1 X77.600 Y140.986 E197.54989 F4800
+G1 X77.514 Y137.508 E197.66576 F4800
+G1 X78.380 Y137.852 E197.69676 F6000
+G1 X75.347 Y137.501 E197.79841 F3000
+G1 X78.970 Y135.272 E197.94005 F6000
+G1 X78.599 Y137.519 E198.01588 F9000
+G1 X80.628 Y138.614 E198.09269 F3000
+G1 X81.414 Y139.323 E198.12792 F3000
+G1 X77.509 Y140.334 E198.26225 F1800
+G1 X76.664 Y139.627 E198.29893 F1800
+G1 X77.196 Y143.107 E198.41617 F9000
+G1 X77.107 Y142.305 E198.44307 F9000
+G1 X78.840 Y142.649 E198.50190 F4800
+G1 X79.627 Y141.934 E198.53731 F1800
+G1 X82.855 Y142.447 E198.64615 F3000
+G1 X84.008 Y143.915 E198.70830 F6000
+G1 X87.078 Y146.326 E198.83829 F9000
+G1 X87.027 Y148.715 E198.91788 F6000
+G1 X84.840 Y152.434 E199.06152 F3000
+G1 X88.638 Y153.342 E199.19156 F4800
+G1 X87.784 Y150.168 E199.30103 F1800
+G1 X90.947 Y146.682 E199.45779 F1800
+G1 X89.063 Y146.471 E199.52092 F1800
+G1 X89.881 Y151.247 E199.68227 F9000
+G1 X90.252 Y155.051 E199.80955 F9000
+G1 X94.371 Y154.694 E199.94722 F3000
+G1 X95.019 Y153.845 E199.98280 F4800
+G1 X92.696 Y157.473 E200.12625 F9000
+G1 X93.093 Y154.153 E200.23760 F6000
+G1 X90.659 Y150.747 E200.37697 F1800
+G1 X91.464 Y153.761 E200.48082 F6000
+G1 X94.466 Y156.489 E200.61592 F3000
+G1 X96.195 Y152.390 E200.76404 F9000
+G1 X93.422 Y154.658 E200.88333 F3000
+G1 X94.384 Y157.649 E200.98796 F6000
+G1 X93.639 Y158.802 E201.03370 F6000
+G1 X94.159 Y158.787 E201.05103 F1800
+G1 X95.245 Y159.190 E201.08962 F4800
+G1 X93.696 Y158.330 E201.14862 F1800
+G1 X95.397 Y153.720 E201.31224 F9000
+G1 X98.268 Y156.535 E201.44612 F3000
+G1 X97.228 Y159.202 E201.54147 F4800
+G1 X97.195 Y158.070 E201.57921 F9000
+G1 X94.441 Y157.076 E201.67667 F9000
+G1 X93.668 Y152.639 E201.82666 F4800
+G1 X91.523 Y154.312 E201.91724 F1800
+G1 X93.267 Y157.210 E202.02986 F3000
+G1 X92.868 Y155.939 E202.07423 F6000
+G1 X92.176 Y153.303 E202.16497 F9000
+G1 X89.430 Y153.527 E202.25672 F4800
+G1 X84.719 Y154.215 E202.41527 F1800
+G1 X82.582 Y152.217 E202.51269 F1800
+G1 X79.125 Y151.361 E202.63130 F9000
+G1 X80.597 Y151.287 E202.68039 F1800
+G1 X81.306 Y152.358 E202.72316 F6000
+G1 X80.572 Y149.807 E202.81153 F1800
+G1 X82.048 Y151.124 E202.87739 F6000
+G1 X78.377 Y150.738 E203.00029 F4800
+G1 X76.126 Y152.657 E203.09881 F9000
+G1 X73.144 Y155.758 E203.24206 F3000
+G1 X73.769 Y153.841 E203.30922 F9000
+G1 X72.086 Y154.389 E203.36816 F9000
+G1 X69.272 Y157.175 E203.50004 F6000
+G1 X65.823 Y158.857 E203.62780 F4800
+G1 X65.973 Y159.683 E203.65576 F1800
+G1 X66.377 Y157.741 E203.72180 F3000
+G1 X65.649 Y155.941 E203.78646 F1800
+G1 X63.981 Y158.682 E203.89334 F6000
+G1 X65.180 Y156.759 E203.96881 F4800
+G1 X60.800 Y157.372 E204.11610 F1800
+G1 X60.069 Y157.145 E204.14157 F4800
+G1 X60.850 Y157.809 E204.17569 F9000
+G1 X62.645 Y159.412 E204.25582 F3000
+G1 X62.956 Y159.022 E204.27242 F4800
+G1 X60.923 Y157.184 E204.36368 F6000
+G1 X60.031 Y157.503 E204.39524 F6000
+G1 X60.362 Y152.752 E204.55384 F4800
+G1 X64.144 Y154.831 E204.69755 F3000
+G1 X60.465 Y158.026 E204.85982 F9000
+G1 X61.995 Y155.458 E204.95936 F9000
+G1 X61.818 Y154.619 E204.98791 F9000
+G1 X58.944 Y154.732 E205.08370 F6000
+G1 X60.167 Y153.823 E205.13445 F6000
+G1 X56.307 Y155.812 E205.27906 F3000
+G1 X58.637 Y152.611 E205.41091 F6000
+G1 X59.277 Y152.624 E205.43223 F6000
+G1 X58.724 Y154.628 E205.50144 F4800
+G1 X58.732 Y155.020 E205.51452 F4800
+G1 X58.875 Y155.285 E205.52454 F3000
+G1 X58.357 Y154.877 E205.54648 F4800
+G1 X58.009 Y155.004 E205.55881 F9000
+G1 X58.042 Y157.520 E205.64263 F6000
+G1 X58.555 Y155.778 E205.70310 F9000
+G1 X60.608 Y153.105 E205.81535 F3000
+G1 X61.113 Y152.442 E205.84310 F3000
+G1 X60.782 Y151.434 E205.87843 F4800
+G1 X60.315 Y151.336 E205.89430 F3000
+G1 X58.087 Y146.891 E206.05989 F1800
+G1 X54.645 Y150.255 E206.22016 F3000
+G1 X52.724 Y151.402 E206.29464 F3000
+G1 X54.594 Y151.721 E206.35780 F3000
+G1 X56.618 Y154.511 E206.47258 F3000
+G1 X56.656 Y154.049 E206.48802 F9000
+G1 X56.661 Y154.275 E206.49555 F9000
+G1 X57.708 Y154.839 E206.53513 F1800
+G1 X59.258 Y154.471 E206.58820 F9000
+G1 X61.379 Y150.932 E206.72559 F3000
+G1 X60.122 Y149.838 E206.78108 F4800
+G1 X61.207 Y150.148 E206.81865 F4800
+G1 X64.049 Y151.931 E206.93037 F4800
+G1 X64.258 Y155.267 E207.04170 F6000
+G1 X62.866 Y150.802 E207.19747 F3000
+G1 X61.973 Y153.801 E207.30170 F4800
+G1 X63.879 Y154.388 E207.36809 F1800
+G1 X64.266 Y156.355 E207.43484 F1800
+G1 X60.493 Y156.843 E207.56152 F9000
+G1 X59.911 Y156.756 E207.58110 F1800
+G1 X58.948 Y155.775 E207.62687 F4800
+G1 X55.804 Y159.254 E207.78303 F3000
+G1 X53.545 Y159.764 E207.86015 F9000
+G1 X53.991 Y158.691 E207.89884 F4800
+G1 X51.631 Y156.788 E207.99978 F1800
+G1 X51.295 Y155.536 E208.04294 F9000
+G1 X48.602 Y158.392 E208.17364 F6000
+G1 X49.735 Y159.192 E208.21981 F1800
+G1 X51.796 Y157.228 E208.31461 F4800
+G1 X51.390 Y157.351 E208.32874 F9000
+G1 X49.291 Y153.050 E208.48809 F1800
+G1 X46.583 Y152.185 E208.58277 F6000
+G1 X46.094 Y152.638 E208.60496 F4800
+G1 X41.927 Y154.798 E208.76126 F1800
+G1 X45.233 Y156.363 E208.88309 F6000
+G1 X45.645 Y158.252 E208.94746 F9000
+G1 X46.459 Y159.271 E208.99088 F1800
+G1 X45.604 Y158.404 E209.03141 F4800
+G1 X42.482 Y154.742 E209.19166 F1800
+G1 X42.869 Y156.644 E209.25629 F3000
+G1 X40.058 Y158.297 E209.36487 F9000
+G1 X41.193 Y161.353 E209.47340 F1800
+G1 X40.265 Y161.903 E209.50934 F9000
+G1 X41.492 Y159.891 E209.58784 F9000
+G1 X40.997 Y159.626 E209.60656 F1800
+G1 X40.826 Y155.964 E209.72864 F6000
+G1 X42.068 Y157.584 E209.79664 F4800
+G1 X43.258 Y153.927 E209.92469 F4800
+G1 X40.504 Y154.522 E210.01851 F6000
+G1 X40.818 Y158.792 E210.16107 F1800
+G1 X41.720 Y158.097 E210.19898 F6000
+G1 X43.549 Y154.326 E210.33855 F4800
+G1 X43.737 Y154.407 E210.34538 F9000
+G1 X47.914 Y153.712 E210.48637 F4800
+G1 X43.914 Y151.838 E210.63348 F3000
+G1 X42.002 Y154.142 E210.73317 F1800
+G1 X44.078 Y150.131 E210.88358 F1800
+G1 X46.169 Y148.879 E210.96473 F4800
+G1 X46.747 Y148.276 E210.99255 F3000
+G1 X48.630 Y149.738 E211.07192 F3000
+G1 X44.802 Y147.077 E211.22715 F9000
+G1 X47.504 Y150.320 E211.36769 F3000
+G1 X48.331 Y152.396 E211.44212 F9000
+G1 X44.674 Y149.410 E211.59934 F4800
+G1 X42.948 Y153.282 E211.74053 F1800
+G1 X45.936 Y154.052 E211.84327 F3000
+G1 X44.174 Y153.618 E211.90368 F3000
+G1 X46.639 Y149.828 E212.05423 F3000
+G1 X47.549 Y151.360 E212.11357 F9000
+G1 X51.793 Y152.775 E212.26253 F9000
+G1 X50.167 Y156.936 E212.41131 F6000
+G1 X48.432 Y159.709 E212.52024 F6000
+G1 X47.761 Y158.457 E212.56756 F3000
+G1 X45.606 Y155.536 E212.68842 F1800
+G1 X45.682 Y155.329 E212.69576 F3000
+G1 X43.686 Y154.369 E212.76952 F3000
+G1 X44.490 Y154.322 E212.79633 F3000
+G1 X42.901 Y155.495 E212.86208 F4800
+G1 X43.004 Y152.899 E212.94860 F6000
+G1 X44.574 Y151.663 E213.01516 F9000
+G1 X41.010 Y149.833 E213.14858 F9000
+G1 X45.968 Y150.410 E213.31479 F1800
+G1 X44.012 Y147.449 E213.43296 F4800
+G1 X43.286 Y147.812 E213.46000 F4800
+G1 X41.840 Y151.675 E213.59736 F9000
+G1 X42.708 Y149.545 E213.67395 F3000
+G1 X42.155 Y154.390 E213.83635 F6000
+G1 X42.943 Y154.400 E213.86258 F6000
+G1 X46.935 Y152.434 E214.01077 F1800
+G1 X50.470 Y152.819 E214.12918 F1800
+G1 X50.743 Y152.758 E214.13849 F4800
+G1 X54.206 Y152.928 E214.25395 F3000
+G1 X56.274 Y150.878 E214.35093 F6000
+G1 X51.769 Y150.245 E214.50244 F3000
+G1 X54.757 Y146.923 E214.65123 F9000
+G1 X55.231 Y146.408 E214.67452 F4800
+G1 X54.876 Y147.629 E214.71686 F9000
+G1 X50.932 Y145.714 E214.86285 F4800
+G1 X50.357 Y146.335 E214.89103 F3000
+G1 X48.620 Y150.969 E215.05585 F4800
+G1 X46.208 Y151.757 E215.14033 F1800
+G1 X48.311 Y153.102 E215.22347 F4800
+G1 X50.433 Y155.445 E215.32872 F3000
+G1 X50.252 Y153.295 E215.40057 F1800
+G1 X48.767 Y149.789 E215.52737 F3000
+G1 X52.085 Y147.638 E215.65903 F4800
+G1 X53.135 Y151.090 E215.77919 F1800
+G1 X56.882 Y152.218 E215.90949 F1800
+G1 X57.822 Y151.376 E215.95150 F3000
+G1 X55.809 Y153.116 E216.04009 F6000
+G1 X58.693 Y152.910 E216.13638 F9000
+G1 X55.153 Y154.141 E216.26120 F3000
+G1 X52.532 Y153.976 E216.34863 F6000
+G1 X53.636 Y154.119 E216.38568 F4800
+G1 X48.963 Y155.124 E216.54485 F6000
+G1 X51.569 Y152.936 E216.65816 F1800
+G1 X51.491 Y154.677 E216.71621 F6000
+G1 X49.535 Y152.326 E216.81807 F1800
+G1 X53.743 Y153.318 E216.96203 F3000
+G1 X55.433 Y154.498 E217.03069 F1800
+G1 X57.054 Y151.279 E217.15070 F3000
+G1 X55.284 Y152.626 E217.22478 F6000
+G1 X52.716 Y150.417 E217.33758 F9000
+G1 X52.876 Y150.287 E217.34446 F4800
+G1 X52.495 Y151.431 E217.38463 F6000
+G1 X48.893 Y152.615 E217.51089 F6000
+G1 X46.407 Y155.919 E217.64856 F4800
+G1 X46.186 Y156.342 E217.66446 F9000
+G1 X47.334 Y156.409 E217.70277 F6000
+G1 X46.644 Y157.770 E217.75360 F3000
+G1 X46.195 Y155.048 E217.84548 F9000
+G1 X46.581 Y154.935 E217.85887 F1800
+G1 X49.196 Y156.002 E217.95294 F9000
+G1 X49.275 Y152.018 E218.08564 F4800
+G1 X45.743 Y155.364 E218.24765 F9000
+G1 X43.119 Y158.408 E218.38149 F6000
+G1 X44.509 Y155.622 E218.48516 F1800
+G1 X44.942 Y151.605 E218.61972 F6000
+G1 X45.710 Y146.916 E218.77795 F6000
+G1 X45.566 Y148.675 E218.83671 F4800
+G1 X45.851 Y146.817 E218.89930 F1800
+G1 X48.350 Y148.250 E218.99523 F9000
+G1 X46.026 Y146.236 E219.09765 F1800
+G1 X50.012 Y145.862 E219.23096 F9000
+G1 X49.857 Y145.325 E219.24958 F4800
+G1 X49.477 Y145.643 E219.26606 F3000
+G1 X49.132 Y146.687 E219.30270 F1800
+G1 X45.538 Y146.525 E219.42251 F3000
+G1 X45.951 Y146.412 E219.43676 F1800
+G1 X49.861 Y145.059 E219.57455 F3000
+G1 X52.233 Y142.811 E219.68338 F4800
+G1 X50.088 Y141.749 E219.76311 F6000
+G1 X54.791 Y142.923 E219.92456 F9000
+G1 X51.726 Y146.190 E220.07373 F4800
+G1 X53.171 Y149.339 E220.18912 F3000
+G1 X54.098 Y144.784 E220.34395 F9000
+G1 X53.510 Y148.161 E220.45810 F6000
+G1 X54.313 Y148.330 E220.48544 F3000
+G1 X55.297 Y151.643 E220.60051 F1800
+G1 X55.723 Y155.014 E220.71367 F9000
+G1 X53.117 Y157.779 E220.84018 F9000
+G1 X52.331 Y158.350 E220.87253 F9000
+G1 X52.681 Y158.151 E220.88592 F1800
+G1 X51.653 Y156.145 E220.96099 F9000
+G1 X52.554 Y157.075 E221.00410 F3000
+G1 X51.070 Y157.712 E221.05787 F1800
+G1 X49.621 Y159.041 E221.12334 F1800
+G1 X49.766 Y158.546 E221.14049 F6000
+G1 X54.393 Y159.801 E221.30015 F3000
+G1 X56.851 Y159.261 E221.38395 F9000
+G1 X55.482 Y157.737 E221.45216 F6000
+G1 X56.830 Y155.034 E221.55276 F4800
+G1 X53.486 Y157.310 E221.68748 F3000
+G1 X54.372 Y156.945 E221.71939 F9000
+G1 X54.673 Y157.034 E221.72985 F1800
+G1 X50.096 Y156.550 E221.88312 F6000
+G1 X54.003 Y158.832 E222.03379 F6000
+G1 X54.025 Y158.322 E222.05076 F6000
+G1 X54.785 Y156.017 E222.13161 F6000
+G1 X56.241 Y152.481 E222.25892 F3000
+G1 X56.642 Y150.480 E222.32690 F6000
+G1 X57.291 Y149.955 E222.35469 F6000
+G1 X54.881 Y146.066 E222.50703 F6000
+G1 X52.224 Y143.779 E222.62380 F3000
+G1 X50.407 Y144.687 E222.69144 F3000
+G1 X49.813 Y141.753 E222.79110 F4800
+G1 X53.726 Y141.575 E222.92155 F3000
+G1 X53.975 Y141.928 E222.93591 F3000
+G1 X50.445 Y141.201 E223.05592 F1800
+G1 X50.268 Y143.114 E223.11989 F3000
+G1 X52.283 Y140.996 E223.21724 F9000
+G1 X55.844 Y143.311 E223.35867 F3000
+G1 X55.860 Y144.744 E223.40642 F3000
+G1 X54.409 Y146.098 E223.47248 F9000
+G1 X55.236 Y145.020 E223.51774 F3000
+G1 X53.478 Y144.840 E223.57660 F9000
+G1 X54.024 Y144.611 E223.59635 F3000
+G1 X53.824 Y144.525 E223.60363 F3000
+G1 X49.187 Y144.602 E223.75805 F4800
+G1 X49.352 Y144.352 E223.76801 F6000
+G1 X49.624 Y143.500 E223.79781 F6000
+G1 X48.980 Y145.141 E223.85654 F6000
+G1 X48.076 Y144.558 E223.89235 F9000
+G1 X48.397 Y145.587 E223.92825 F4800
+G1 X47.406 Y146.967 E223.98483 F4800
+G1 X52.021 Y147.225 E224.13877 F9000
+G1 X50.568 Y147.742 E224.19014 F4800
+G1 X50.639 Y142.783 E224.35529 F4800
+G1 X52.054 Y141.397 E224.42125 F4800
+G1 X54.825 Y137.954 E224.56842 F1800
+G1 X55.593 Y134.366 E224.69063 F3000
+G1 X58.882 Y133.108 E224.80789 F3000
+G1 X58.832 Y132.376 E224.83234 F3000
+G1 X59.168 Y132.062 E224.84766 F9000
+G1 X58.700 Y131.225 E224.87957 F6000
+G1 X56.962 Y127.141 E225.02737 F4800
+G1 X56.130 Y125.902 E225.07707 F4800
+G1 X60.808 Y126.547 E225.23432 F9000
+G1 X58.233 Y125.491 E225.32701 F3000
+G1 X60.715 Y128.271 E225.45110 F3000
+G1 X55.922 Y128.659 E225.61120 F6000
+G1 X52.988 Y132.248 E225.76558 F9000
+G1 X53.267 Y128.718 E225.88351 F4800
+G1 X51.571 Y128.326 E225.94144 F4800
+G1 X49.820 Y129.442 E226.01060 F4800
+G1 X50.114 Y129.536 E226.02088 F3000
+G1 X52.980 Y129.852 E226.11689 F6000
+G1 X53.170 Y132.492 E226.20502 F4800
+G1 X54.473 Y132.826 E226.24980 F9000
+G1 X53.132 Y132.288 E226.29792 F1800
+G1 X54.369 Y131.808 E226.34209 F6000
+G1 X52.169 Y134.412 E226.45559 F6000
+G1 X54.997 Y131.888 E226.58179 F3000
+G1 X55.230 Y131.626 E226.59347 F6000
+G1 X50.513 Y132.839 E226.75565 F3000
+G1 X52.622 Y135.083 E226.85819 F6000
+G1 X52.432 Y134.940 E226.86610 F4800
+G1 X49.285 Y137.313 E226.99736 F9000
+G1 X52.128 Y139.961 E227.12676 F9000
+G1 X52.875 Y137.984 E227.19715 F9000
+G1 X53.583 Y138.203 E227.22180 F4800
+G1 X56.138 Y137.057 E227.31505 F4800
+G1 X55.055 Y134.143 E227.41854 F3000
+G1 X53.160 Y132.583 E227.50030 F3000
+G1 X48.480 Y131.806 E227.65826 F3000
+G1 X50.481 Y132.345 E227.72726 F3000
+G1 X54.081 Y130.283 E227.86539 F1800
+G1 X55.676 Y133.520 E227.98557 F4800
+G1 X57.175 Y128.875 E228.14811 F3000
+G1 X53.260 Y131.744 E228.30973 F1800
+G1 X50.811 Y135.832 E228.46843 F3000
+G1 X53.517 Y134.324 E228.57161 F1800
+G1 X51.798 Y134.604 E228.62963 F1800
+G1 X55.586 Y131.718 E228.78822 F4800
+G1 X52.455 Y132.988 E228.90075 F3000
+G1 X52.815 Y130.043 E228.99955 F3000
+G1 X53.942 Y125.215 E229.16466 F3000
+G1 X53.009 Y126.230 E229.21057 F9000
+G1 X50.845 Y127.987 E229.30342 F4800
+G1 X51.428 Y129.427 E229.35517 F3000
+G1 X51.196 Y129.372 E229.36314 F3000
+G1 X53.479 Y131.657 E229.47071 F1800
+G1 X52.058 Y131.624 E229.51802 F3000
+G1 X51.917 Y128.231 E229.63112 F3000
+G1 X50.085 Y130.752 E229.73490 F6000
+G1 X45.151 Y130.903 E229.89929 F4800
+G1 X48.572 Y133.174 E230.03603 F3000
+G1 X48.656 Y133.648 E230.05208 F4800
+G1 X50.898 Y137.680 E230.20571 F3000
+G1 X49.568 Y136.440 E230.26629 F1800
+G1 X47.658 Y135.400 E230.33870 F1800
+G1 X44.493 Y135.223 E230.44426 F1800
+G1 X41.025 Y137.888 E230.58989 F4800
+G1 X43.013 Y139.995 E230.68633 F3000
+G1 X43.644 Y139.780 E230.70854 F4800
+G1 X42.217 Y136.362 E230.83189 F4800
+G1 X41.513 Y139.855 E230.95052 F6000
+G1 X41.899 Y139.366 E230.97125 F6000
+G1 X43.898 Y138.108 E231.04990 F6000
+G1 X42.043 Y138.142 E231.11169 F1800
+G1 X44.726 Y141.230 E231.24791 F6000
+G1 X48.014 Y141.638 E231.35823 F4800
+G1 X48.682 Y144.499 E231.45607 F6000
+G1 X48.110 Y147.002 E231.54157 F9000
+G1 X47.860 Y145.110 E231.60513 F6000
+G1 X43.829 Y146.775 E231.75037 F9000
+G1 X45.761 Y143.389 E231.88018 F4800
+G1 X44.353 Y146.203 E231.98497 F1800
+G1 X44.938 Y144.425 E232.04730 F9000
+G1 X48.786 Y146.627 E232.19495 F6000
+G1 X48.162 Y148.658 E232.26569 F4800
+G1 X46.447 Y150.155 E232.34149 F1800
+G1 X48.352 Y148.647 E232.42240 F4800
+G1 X47.433 Y150.869 E232.50248 F1800
+G1 X46.432 Y147.175 E232.62993 F1800
+G1 X49.572 Y149.084 E232.75232 F4800
+G1 X50.165 Y149.609 E232.77869 F4800
+G1 X51.477 Y149.703 E232.82247 F6000
+G1 X51.704 Y151.105 E232.86978 F6000
+G1 X51.435 Y147.868 E232.97794 F1800
+G1 X54.614 Y146.002 E233.10069 F6000
+G1 X57.216 Y144.545 E233.20000 F9000
+G1 X57.910 Y147.418 E233.29844 F9000
+G1 X61.550 Y144.153 E233.46127 F6000
+G1 X63.946 Y146.695 E233.57761 F3000
+G1 X62.592 Y143.617 E233.68958 F3000
+G1 X59.020 Y144.157 E233.80988 F9000
+G1 X60.417 Y146.944 E233.91369 F9000
+G1 X62.010 Y151.118 E234.06246 F6000
+G1 X61.672 Y151.488 E234.07914 F4800
+G1 X63.218 Y155.889 E234.23447 F1800
+G1 X66.116 Y155.075 E234.33469 F1800
+G1 X64.041 Y157.112 E234.43150 F1800
+G1 X63.411 Y157.855 E234.46395 F3000
+G1 X64.555 Y156.512 E234.52269 F1800
+G1 X61.100 Y159.288 E234.67030 F9000
+G1 X58.427 Y158.174 E234.76673 F9000
+G1 X55.115 Y158.189 E234.87702 F4800
+G1 X52.732 Y155.089 E235.00721 F6000
+G1 X48.843 Y157.005 E235.15155 F4800
+G1 X49.531 Y153.273 E235.27792 F6000
+G1 X53.377 Y154.711 E235.41466 F9000
+G1 X54.380 Y154.576 E235.44836 F1800
+G1 X55.187 Y152.749 E235.51487 F3000
+G1 X57.777 Y153.012 E235.60156 F6000
+G1 X60.326 Y155.151 E235.71237 F1800
+G1 X60.781 Y153.053 E235.78384 F9000
+G1 X61.052 Y151.401 E235.83960 F9000
+G1 X60.449 Y151.032 E235.86312 F4800
+G1 X60.204 Y150.911 E235.87223 F9000
+G1 X63.398 Y151.999 E235.98461 F3000
+G1 X62.889 Y150.625 E236.03340 F6000
+G1 X62.163 Y149.329 E236.08286 F9000
+G1 X60.603 Y151.991 E236.18560 F9000
+G1 X58.566 Y155.299 E236.31497 F4800
+G1 X58.609 Y154.016 E236.35772 F3000
+G1 X59.876 Y156.252 E236.44331 F1800
+G1 X57.403 Y156.928 E236.52868 F4800
+G1 X57.886 Y158.650 E236.58825 F1800
+G1 X57.670 Y158.859 E236.59825 F9000
+G1 X58.254 Y158.624 E236.61922 F9000
+G1 X55.015 Y156.633 E236.74583 F4800
+G1 X55.622 Y152.201 E236.89477 F9000
+G1 X56.830 Y151.316 E236.94465 F6000
+G1 X54.031 Y154.066 E237.07532 F3000
+G1 X51.216 Y156.955 E237.20965 F9000
+G1 X52.348 Y155.743 E237.26487 F4800
+G1 X52.385 Y156.053 E237.27524 F9000
+G1 X52.321 Y156.492 E237.29001 F3000
+G1 X56.784 Y155.128 E237.44540 F9000
+G1 X54.390 Y155.548 E237.52631 F4800
+G1 X53.276 Y158.304 E237.62531 F3000
+G1 X49.703 Y156.006 E237.76680 F1800
+G1 X49.255 Y151.047 E237.93261 F6000
+G1 X48.795 Y151.771 E237.96118 F9000
+G1 X48.110 Y152.383 E237.99177 F6000
+G1 X51.755 Y154.138 E238.12648 F1800
+G1 X50.574 Y156.007 E238.20011 F6000
+G1 X52.370 Y157.771 E238.28393 F1800
+G1 X54.368 Y154.855 E238.40165 F6000
+G1 X53.535 Y155.269 E238.43260 F6000
+G1 X54.709 Y154.808 E238.47458 F3000
+G1 X58.783 Y154.367 E238.61106 F4800
+G1 X57.411 Y157.822 E238.73488 F4800
+G1 X61.835 Y157.783 E238.88222 F6000
+G1 X60.785 Y157.424 E238.91918 F3000
+G1 X61.073 Y157.040 E238.93516 F9000
+G1 X62.583 Y157.156 E238.98557 F3000
+G1 X62.232 Y155.341 E239.04713 F6000
+G1 X60.002 Y155.060 E239.12197 F4800
+G1 X60.329 Y156.514 E239.17159 F3000
+G1 X60.265 Y156.052 E239.18713 F3000
+G1 X61.637 Y156.807 E239.23928 F9000
+G1 X61.725 Y157.012 E239.24670 F4800
+G1 X60.646 Y156.784 E239.28342 F3000
+G1 X63.056 Y153.387 E239.42212 F1800
+G1 X59.393 Y154.558 E239.55018 F9000
+G1 X58.976 Y153.341 E239.59302 F9000
+G1 X61.434 Y154.781 E239.68790 F1800
+G1 X63.798 Y152.497 E239.79736 F4800
+G1 X62.433 Y155.688 E239.91290 F1800
+G1 X66.385 Y155.490 E240.04464 F1800
+G1 X65.045 Y154.791 E240.09495 F3000
+G1 X65.413 Y153.940 E240.12584 F4800
+G1 X65.739 Y149.821 E240.26344 F9000
+G1 X64.708 Y147.737 E240.34087 F4800
+G1 X62.896 Y149.650 E240.42861 F6000
+G1 X67.622 Y148.595 E240.58987 F4800
+G1 X70.691 Y146.865 E240.70721 F3000
+G1 X69.945 Y147.698 E240.74445 F1800
+G1 X71.077 Y148.816 E240.79745 F9000
+G1 X73.403 Y148.807 E240.87490 F1800
+G1 X76.484 Y146.117 E241.01112 F6000
+G1 X75.835 Y146.425 E241.03507 F9000
+G1 X74.515 Y142.117 E241.18511 F9000
+G1 X74.826 Y143.485 E241.23184 F4800
+G1 X75.614 Y142.523 E241.27326 F1800
+G1 X72.470 Y142.569 E241.37796 F4800
+G1 X75.120 Y145.276 E241.50408 F9000
+G1 X77.919 Y149.123 E241.66252 F6000
+G1 X74.813 Y148.730 E241.76679 F9000
+G1 X74.046 Y148.453 E241.79392 F4800
+G1 X75.328 Y150.896 E241.88578 F6000
+G1 X75.500 Y150.491 E241.90043 F3000
+G1 X79.057 Y150.341 E242.01898 F1800
+G1 X81.296 Y148.839 E242.10875 F9000
+G1 X81.919 Y149.049 E242.13063 F6000
+G1 X79.170 Y145.526 E242.27943 F1800
+G1 X79.163 Y148.432 E242.37621 F9000
+G1 X77.814 Y149.348 E242.43050 F4800
+G1 X78.405 Y147.110 E242.50761 F3000
+G1 X74.227 Y144.946 E242.66431 F4800
+G1 X74.118 Y147.207 E242.73971 F9000
+G1 X72.942 Y149.163 E242.81570 F1800
+G1 X73.303 Y146.362 E242.90974 F6000
+G1 X72.749 Y147.247 E242.94449 F9000
+G1 X73.096 Y147.368 E242.95674 F6000
+G1 X77.680 Y146.997 E243.10988 F6000
+G1 X77.391 Y146.445 E243.13061 F3000
+G1 X80.954 Y147.145 E243.25152 F3000
+G1 X82.167 Y150.239 E243.36219 F3000
+G1 X82.016 Y147.603 E243.45012 F1800
+G1 X83.107 Y149.946 E243.53615 F4800
+G1 X82.307 Y150.594 E243.57042 F4800
+G1 X81.947 Y153.290 E243.66100 F6000
+G1 X80.294 Y153.893 E243.71958 F9000
+G1 X81.258 Y154.687 E243.76118 F1800
+G1 X78.873 Y154.609 E243.84064 F3000
+G1 X79.450 Y150.251 E243.98705 F1800
+G1 X79.393 Y147.446 E244.08048 F9000
+G1 X82.679 Y146.846 E244.19172 F1800
+G1 X80.574 Y145.971 E244.26766 F6000
+G1 X75.874 Y144.716 E244.42963 F6000
+G1 X78.156 Y148.744 E244.58380 F1800
+G1 X77.875 Y145.309 E244.69858 F4800
+G1 X80.212 Y145.663 E244.77727 F4800
+G1 X80.462 Y146.574 E244.80871 F3000
+G1 X81.596 Y141.963 E244.96682 F4800
+G1 X84.149 Y143.890 E245.07333 F9000
+G1 X84.262 Y139.393 E245.22313 F6000
+G1 X84.001 Y139.566 E245.23358 F3000
+G1 X82.272 Y142.921 E245.35927 F4800
+G1 X83.086 Y142.935 E245.38639 F4800
+G1 X81.432 Y140.477 E245.48505 F6000
+G1 X82.379 Y141.442 E245.53007 F6000
+G1 X83.472 Y144.927 E245.65168 F6000
+G1 X81.513 Y144.499 E245.71848 F6000
+G1 X82.205 Y147.093 E245.80788 F3000
+G1 X85.685 Y144.047 E245.96189 F4800
+G1 X87.255 Y144.637 E246.01775 F6000
+G1 X86.080 Y142.440 E246.10072 F6000
+G1 X86.286 Y142.362 E246.10806 F9000
+G1 X88.607 Y143.823 E246.19937 F3000
+G1 X89.681 Y141.724 E246.27787 F1800
+G1 X88.933 Y140.967 E246.31332 F1800
+G1 X87.652 Y138.029 E246.42005 F1800
+G1 X87.235 Y133.646 E246.56666 F4800
+G1 X89.845 Y132.308 E246.66433 F4800
+G1 X88.438 Y134.809 E246.75990 F9000
+G1 X87.850 Y136.816 E246.82954 F9000
+G1 X87.955 Y137.748 E246.86076 F6000
+G1 X87.024 Y137.764 E246.89175 F6000
+G1 X84.286 Y139.656 E247.00257 F3000
+G1 X84.469 Y142.166 E247.08635 F4800
+G1 X85.662 Y139.272 E247.19057 F1800
+G1 X86.708 Y140.082 E247.23462 F9000
+G1 X84.712 Y141.022 E247.30807 F1800
+G1 X85.010 Y141.259 E247.32073 F9000
+G1 X83.716 Y142.396 E247.37808 F6000
+G1 X84.569 Y144.612 E247.45715 F6000
+G1 X84.170 Y144.291 E247.47419 F6000
+G1 X83.384 Y143.742 E247.50611 F3000
+G1 X84.304 Y143.114 E247.54320 F9000
+G1 X84.508 Y143.204 E247.55065 F4800
+G1 X84.922 Y140.812 E247.63149 F3000
+G1 X83.895 Y140.113 E247.67286 F4800
+G1 X82.675 Y144.139 E247.81296 F4800
+G1 X79.538 Y147.071 E247.95593 F9000
+G1 X81.141 Y144.328 E248.06171 F4800
+G1 X80.856 Y144.118 E248.07348 F3000
+G1 X84.323 Y143.630 E248.19005 F3000
+G1 X86.259 Y140.521 E248.31204 F1800
+G1 X86.828 Y138.305 E248.38822 F3000
+G1 X90.934 Y138.766 E248.52581 F6000
+G1 X92.713 Y138.858 E248.58512 F1800
+G1 X94.518 Y141.376 E248.68830 F4800
+G1 X94.061 Y141.509 E248.70416 F6000
+G1 X94.820 Y139.303 E248.78186 F3000
+G1 X96.994 Y135.346 E248.93221 F9000
+G1 X97.903 Y137.280 E249.00336 F4800
+G1 X97.992 Y137.541 E249.01253 F6000
+G1 X97.842 Y137.733 E249.02066 F9000
+G1 X98.516 Y138.775 E249.06197 F9000
+G1 X98.793 Y137.643 E249.10077 F1800
+G1 X100.212 Y140.820 E249.21661 F4800
+G1 X99.514 Y140.973 E249.24041 F9000
+G1 X99.277 Y137.158 E249.36770 F6000
+G1 X98.910 Y135.298 E249.43082 F4800
+G1 X98.260 Y136.653 E249.48085 F6000
+G1 X98.782 Y137.906 E249.52605 F6000
+G1 X95.737 Y136.119 E249.64361 F1800
+G1 X99.979 Y135.405 E249.78685 F1800
+G1 X100.796 Y136.473 E249.83163 F3000
+G1 X103.885 Y134.040 E249.96260 F6000
+G1 X102.410 Y132.941 E250.02385 F6000
+G1 X101.175 Y137.766 E250.18972 F3000
+G1 X101.035 Y137.264 E250.20710 F4800
+G1 X103.092 Y135.023 E250.30836 F4800
+G1 X100.821 Y136.336 E250.39570 F3000
+G1 X100.456 Y133.938 E250.47648 F4800
+G1 X100.034 Y135.536 E250.53155 F9000
+G1 X100.056 Y135.223 E250.54200 F4800
+G1 X104.110 Y134.782 E250.67781 F3000
+G1 X100.755 Y137.419 E250.81993 F1800
+G1 X100.894 Y137.243 E250.82740 F9000
+G1 X100.887 Y138.579 E250.87190 F1800
+G1 X99.408 Y142.036 E250.99711 F4800
+G1 X99.035 Y141.902 E251.01033 F9000
+G1 X98.429 Y142.722 E251.04428 F4800
+G1 X97.449 Y140.692 E251.11935 F6000
+G1 X97.580 Y138.140 E251.20442 F4800
+G1 X96.390 Y137.058 E251.25799 F6000
+G1 X94.168 Y140.120 E251.38398 F3000
+G1 X98.261 Y139.273 E251.52315 F9000
+G1 X98.147 Y138.280 E251.55644 F4800
+G1 X99.188 Y134.952 E251.67254 F9000
+G1 X99.284 Y135.180 E251.68078 F3000
+G1 X99.878 Y135.102 E251.70073 F9000
+G1 X100.138 Y134.614 E251.71915 F3000
+G1 X100.544 Y131.736 E251.81593 F4800
+G1 X102.822 Y132.830 E251.90010 F3000
+G1 X99.976 Y136.761 E252.06170 F1800
+G1 X96.195 Y136.636 E252.18768 F4800
+G1 X95.719 Y137.056 E252.20881 F9000
+G1 X91.379 Y136.283 E252.35562 F4800
+G1 X91.774 Y136.673 E252.37413 F6000
+G1 X89.975 Y137.206 E252.43661 F6000
+G1 X90.244 Y137.419 E252.44803 F6000
+G1 X92.202 Y137.672 E252.51376 F3000
+G1 X89.264 Y139.311 E252.62578 F4800
+G1 X88.121 Y143.428 E252.76807 F4800
+G1 X91.210 Y146.721 E252.91841 F1800
+G1 X92.049 Y146.470 E252.94755 F4800
+G1 X95.512 Y149.848 E253.10866 F9000
+G1 X95.506 Y148.763 E253.14481 F1800
+G1 X92.402 Y151.561 E253.28397 F3000
+G1 X92.882 Y147.182 E253.43065 F9000
+G1 X93.258 Y142.627 E253.58286 F3000
+G1 X94.354 Y142.669 E253.61938 F4800
+G1 X97.663 Y146.383 E253.78504 F3000
+G1 X99.555 Y144.323 E253.87821 F3000
+G1 X100.259 Y143.418 E253.91639 F6000
+G1 X100.806 Y144.750 E253.96434 F4800
+G1 X99.889 Y147.134 E254.04941 F9000
+G1 X100.400 Y147.862 E254.07901 F4800
+G1 X96.207 Y146.693 E254.22397 F6000
+G1 X96.815 Y150.495 E254.35217 F9000
+G1 X99.330 Y153.421 E254.48066 F1800
+G1 X97.492 Y157.299 E254.62357 F9000
+G1 X97.736 Y156.612 E254.64784 F1800
+G1 X99.528 Y156.519 E254.70759 F4800
+G1 X100.786 Y156.948 E254.75184 F1800
+G1 X99.749 Y156.525 E254.78913 F3000
+G1 X101.939 Y152.766 E254.93399 F1800
+G1 X99.015 Y153.320 E255.03308 F6000
+G1 X100.209 Y149.006 E255.18214 F6000
+G1 X101.509 Y148.872 E255.22564 F3000
+G1 X101.572 Y150.874 E255.29235 F9000
+G1 X102.169 Y146.646 E255.43455 F9000
+G1 X102.264 Y147.350 E255.45820 F3000
+G1 X102.791 Y147.942 E255.48461 F9000
+G1 X101.446 Y147.470 E255.53208 F1800
+G1 X98.334 Y143.584 E255.69786 F9000
+G1 X97.810 Y144.574 E255.73515 F4800
+G1 X98.465 Y143.906 E255.76629 F6000
+G1 X99.229 Y143.607 E255.79363 F4800
+G1 X103.640 Y142.628 E255.94410 F1800
+G1 X99.544 Y141.403 E256.08647 F3000
+G1 X103.397 Y142.486 E256.21973 F6000
+G1 X104.247 Y139.940 E256.30910 F4800
+G1 X103.341 Y144.723 E256.47122 F1800
+G1 X104.476 Y147.594 E256.57402 F1800
+G1 X105.671 Y145.295 E256.66032 F3000
+G1 X104.396 Y143.338 E256.73811 F6000
+G1 X106.014 Y142.065 E256.80668 F9000
+G1 X105.388 Y146.150 E256.94432 F9000
+G1 X106.887 Y148.383 E257.03387 F9000
+G1 X109.814 Y152.381 E257.19887 F9000
+G1 X105.316 Y151.451 E257.35183 F6000
+G1 X109.481 Y150.158 E257.49705 F4800
+G1 X107.568 Y149.348 E257.56621 F3000
+G1 X107.504 Y149.681 E257.57749 F4800
+G1 X110.558 Y148.848 E257.68290 F6000
+G1 X111.130 Y148.848 E257.70195 F6000
+G1 X109.603 Y147.340 E257.77342 F9000
+G1 X111.086 Y144.878 E257.86912 F6000
+G1 X110.310 Y148.133 E257.98056 F3000
+G1 X106.667 Y149.286 E258.10780 F3000
+G1 X106.019 Y146.854 E258.19160 F9000
+G1 X108.587 Y147.647 E258.28111 F6000
+G1 X110.546 Y148.820 E258.35713 F4800
+G1 X106.744 Y146.429 E258.50669 F4800
+G1 X103.780 Y149.054 E258.63854 F3000
+G1 X103.986 Y150.389 E258.68355 F3000
+G1 X99.143 Y150.485 E258.84483 F9000
+G1 X99.486 Y150.627 E258.85719 F4800
+G1 X100.307 Y152.930 E258.93860 F4800
+G1 X100.457 Y151.207 E258.99619 F9000
+G1 X100.810 Y151.503 E259.01152 F6000
+G1 X100.191 Y149.095 E259.09431 F6000
+G1 X96.288 Y149.444 E259.22481 F1800
+G1 X100.141 Y148.634 E259.35590 F1800
+G1 X97.240 Y150.181 E259.46537 F3000
+G1 X94.433 Y146.540 E259.61846 F1800
+G1 X95.165 Y143.679 E259.71680 F6000
+G1 X99.765 Y143.557 E259.87006 F9000
+G1 X96.069 Y140.731 E260.02502 F9000
+G1 X98.516 Y142.794 E260.13161 F9000
+G1 X101.546 Y142.674 E260.23261 F3000
+G1 X98.905 Y143.251 E260.32264 F9000
+G1 X97.687 Y142.883 E260.36501 F1800
+G1 X98.705 Y141.860 E260.41305 F4800
+G1 X99.906 Y141.464 E260.45517 F4800
+G1 X104.570 Y142.135 E260.61209 F4800
+G1 X105.478 Y145.001 E260.71223 F3000
+G1 X105.056 Y142.930 E260.78263 F4800
+G1 X105.413 Y144.697 E260.84269 F3000
+G1 X104.994 Y148.052 E260.95528 F1800
+G1 X104.908 Y147.501 E260.97388 F1800
+G1 X102.282 Y149.465 E261.08309 F6000
+G1 X100.850 Y151.539 E261.16700 F6000
+G1 X99.034 Y150.950 E261.23061 F4800
+G1 X97.734 Y150.883 E261.27394 F4800
+G1 X94.215 Y150.585 E261.39154 F9000
+G1 X93.891 Y151.023 E261.40968 F6000
+G1 X95.202 Y150.339 E261.45889 F4800
+G1 X97.349 Y150.410 E261.53044 F9000
+G1 X101.937 Y151.712 E261.68924 F1800
+G1 X101.840 Y154.252 E261.77388 F9000
+G1 X104.449 Y154.103 E261.86090 F3000
+G1 X101.814 Y156.590 E261.98157 F6000
+G1 X98.370 Y156.128 E262.09729 F3000
+G1 X93.783 Y154.296 E262.26177 F6000
+G1 X95.379 Y155.277 E262.32415 F6000
+G1 X97.621 Y151.926 E262.45843 F1800
+G1 X97.457 Y147.464 E262.60709 F6000
+G1 X95.788 Y147.872 E262.66431 F6000
+G1 X92.987 Y149.181 E262.76726 F4800
+G1 X96.375 Y151.949 E262.91294 F6000
+G1 X92.122 Y154.008 E263.07027 F4800
+G1 X91.967 Y156.239 E263.14475 F6000
+G1 X93.507 Y157.047 E263.20266 F3000
+G1 X93.470 Y158.040 E263.23577 F6000
+G1 X91.606 Y156.040 E263.32682 F4800
+G1 X91.969 Y155.239 E263.35608 F1800
+G1 X96.263 Y155.400 E263.49916 F9000
+G1 X97.343 Y157.670 E263.58289 F4800
+G1 X98.234 Y157.144 E263.61734 F6000
+G1 X99.983 Y156.923 E263.67603 F6000
+G1 X104.377 Y157.832 E263.82546 F4800
+G1 X104.216 Y157.482 E263.83829 F4800
+G1 X105.131 Y155.836 E263.90102 F6000
+G1 X104.362 Y154.866 E263.94226 F1800
+G1 X106.919 Y154.859 E264.02741 F1800
+G1 X102.036 Y155.276 E264.19061 F4800
+G1 X100.928 Y156.107 E264.23673 F3000
+G1 X99.200 Y156.096 E264.29427 F9000
+G1 X98.782 Y156.278 E264.30946 F4800
+G1 X101.837 Y154.942 E264.42050 F1800
+G1 X102.082 Y157.289 E264.49911 F6000
+G1 X103.053 Y157.763 E264.53507 F1800
+G1 X103.666 Y158.039 E264.55746 F3000
+G1 X107.630 Y156.958 E264.69429 F3000
+G1 X110.680 Y156.024 E264.80049 F6000
+G1 X107.803 Y157.067 E264.90240 F1800
+G1 X107.367 Y156.914 E264.91779 F4800
+G1 X104.705 Y154.506 E265.03731 F1800
+G1 X105.916 Y154.929 E265.08005 F3000
+G1 X106.283 Y155.826 E265.11233 F9000
+G1 X105.377 Y153.227 E265.20399 F1800
+G1 X105.278 Y152.922 E265.21468 F6000
+G1 X106.476 Y154.916 E265.29215 F6000
+G1 X107.888 Y155.481 E265.34277 F1800
+G1 X103.429 Y154.578 E265.49425 F6000
+G1 X103.621 Y156.659 E265.56383 F9000
+G1 X99.864 Y156.788 E265.68901 F1800
+G1 X96.955 Y159.437 E265.82000 F6000
+G1 X97.611 Y154.962 E265.97061 F1800
+G1 X97.389 Y154.524 E265.98695 F9000
+G1 X95.517 Y154.793 E266.04996 F3000
+G1 X95.983 Y154.763 E266.06554 F6000
+G1 X95.333 Y159.047 E266.20985 F1800
+G1 X99.480 Y157.474 E266.35756 F4800
+G1 X99.668 Y156.400 E266.39386 F3000
+G1 X100.679 Y156.622 E266.42830 F3000
+G1 X102.784 Y152.464 E266.58350 F3000
+G1 X104.805 Y150.776 E266.67119 F1800
+G1 X106.076 Y151.460 E266.71928 F6000
+G1 X109.779 Y152.014 E266.84397 F4800
+G1 X112.927 Y152.400 E266.94957 F4800
+G1 X109.658 Y150.590 E267.07402 F6000
+G1 X109.800 Y150.072 E267.09190 F4800
+G1 X112.384 Y151.202 E267.18582 F9000
+G1 X116.832 Y149.000 E267.35108 F1800
+G1 X117.482 Y144.112 E267.51529 F4800
+G1 X118.421 Y139.952 E267.65732 F4800
+G1 X121.644 Y139.817 E267.76472 F4800
+G1 X122.894 Y139.871 E267.80641 F3000
+G1 X122.849 Y136.914 E267.90489 F9000
+G1 X122.502 Y135.066 E267.96751 F6000
+G1 X126.916 Y136.311 E268.12025 F9000
+G1 X123.103 Y139.277 E268.28114 F4800
+G1 X123.411 Y140.017 E268.30783 F9000
+G1 X124.109 Y139.745 E268.33274 F6000
+G1 X121.818 Y136.829 E268.45622 F3000
+G1 X120.740 Y135.993 E268.50165 F3000
+G1 X121.547 Y140.880 E268.66660 F4800
+G1 X121.047 Y139.571 E268.71326 F4800
+G1 X120.498 Y139.222 E268.73493 F3000
+G1 X119.845 Y139.299 E268.75681 F6000
+G1 X121.396 Y138.792 E268.81114 F1800
+G1 X123.146 Y134.224 E268.97404 F1800
+G1 X125.000 Y136.012 E269.05981 F9000
+G1 X125.986 Y136.084 E269.09275 F6000
+G1 X128.319 Y137.682 E269.18692 F3000
+G1 X128.401 Y139.078 E269.23350 F4800
+G1 X127.185 Y141.339 E269.31899 F6000
+G1 X125.485 Y141.669 E269.37665 F6000
+G1 X125.845 Y143.890 E269.45157 F4800
+G1 X123.755 Y143.782 E269.52127 F3000
+G1 X122.629 Y140.162 E269.64754 F6000
+G1 X121.294 Y139.738 E269.69416 F1800
+G1 X124.048 Y142.009 E269.81303 F1800
+G1 X124.552 Y141.637 E269.83390 F3000
+G1 X128.604 Y144.156 E269.99279 F6000
+G1 X130.371 Y147.268 E270.11194 F4800
+G1 X127.139 Y143.760 E270.27078 F1800
+G1 X128.315 Y148.140 E270.42179 F3000
+G1 X128.891 Y144.541 E270.54314 F3000
+G1 X129.068 Y140.679 E270.67190 F3000
+G1 X127.545 Y138.194 E270.76895 F1800
+G1 X125.761 Y139.860 E270.85024 F3000
+G1 X122.037 Y142.822 E271.00869 F1800
+G1 X121.769 Y142.606 E271.02016 F9000
+G1 X121.240 Y146.211 E271.14150 F1800
+G1 X123.107 Y146.849 E271.20722 F3000
+G1 X121.217 Y143.578 E271.33304 F6000
+G1 X119.828 Y144.263 E271.38464 F9000
+G1 X118.341 Y143.419 E271.44156 F1800
+G1 X117.823 Y144.307 E271.47581 F9000
+G1 X119.326 Y148.402 E271.62106 F9000
+G1 X119.877 Y149.096 E271.65055 F9000
+G1 X117.065 Y146.337 E271.78171 F1800
+G1 X120.253 Y143.936 E271.91459 F4800
+G1 X122.451 Y142.140 E272.00912 F6000
+G1 X120.400 Y140.378 E272.09914 F4800
+G1 X120.469 Y141.530 E272.13757 F3000
+G1 X122.508 Y145.494 E272.28601 F9000
+G1 X120.196 Y148.682 E272.41715 F3000
+G1 X120.940 Y147.672 E272.45894 F3000
+G1 X121.144 Y147.822 E272.46736 F6000
+G1 X125.549 Y148.399 E272.61530 F1800
+G1 X127.206 Y150.918 E272.71570 F4800
+G1 X127.254 Y155.438 E272.86624 F6000
+G1 X125.381 Y156.860 E272.94454 F3000
+G1 X123.367 Y155.610 E273.02349 F4800
+G1 X123.630 Y155.915 E273.03690 F3000
+G1 X122.544 Y156.257 E273.07479 F4800
+G1 X120.740 Y155.144 E273.14539 F3000
+G1 X120.336 Y156.354 E273.18786 F6000
+G1 X121.113 Y155.681 E273.22208 F1800
+G1 X122.305 Y154.794 E273.27156 F3000
+G1 X126.172 Y153.309 E273.40949 F6000
+G1 X128.145 Y157.353 E273.55933 F9000
+G1 X127.959 Y152.431 E273.72335 F1800
+G1 X125.826 Y151.135 E273.80647 F3000
+G1 X122.530 Y149.401 E273.93049 F4800
+G1 X122.040 Y149.383 E273.94681 F4800
+G1 X120.512 Y152.387 E274.05904 F3000
+G1 X119.075 Y153.251 E274.11487 F6000
+G1 X120.007 Y154.432 E274.16495 F9000
+G1 X118.882 Y156.945 E274.25666 F3000
+G1 X117.104 Y157.399 E274.31778 F3000
+G1 X114.944 Y154.156 E274.44751 F9000
+G1 X114.349 Y156.225 E274.51917 F6000
+G1 X119.002 Y157.246 E274.67781 F3000
+G1 X118.723 Y159.368 E274.74906 F9000
+G1 X121.445 Y158.361 E274.84570 F1800
+G1 X123.597 Y154.051 E275.00613 F6000
+G1 X123.658 Y155.192 E275.04418 F4800
+G1 X122.788 Y155.179 E275.07314 F9000
+G1 X122.447 Y155.662 E275.09285 F1800
+G1 X125.133 Y159.019 E275.23601 F4800
+G1 X120.600 Y157.427 E275.39600 F6000
+G1 X122.647 Y156.079 E275.47763 F4800
+G1 X119.471 Y155.246 E275.58697 F9000
+G1 X121.056 Y156.563 E275.65559 F6000
+G1 X120.834 Y159.070 E275.73942 F6000
+G1 X116.642 Y159.105 E275.87899 F9000
+G1 X114.170 Y157.721 E275.97334 F1800
+G1 X113.421 Y155.926 E276.03812 F1800
+G1 X113.419 Y155.395 E276.05581 F4800
+G1 X115.225 Y156.281 E276.12280 F1800
+G1 X114.541 Y155.462 E276.15833 F9000
+G1 X114.261 Y155.018 E276.17580 F1800
+G1 X114.656 Y155.775 E276.20425 F6000
+G1 X117.362 Y152.994 E276.33347 F9000
+G1 X119.034 Y155.350 E276.42967 F3000
+G1 X122.512 Y156.575 E276.55244 F9000
+G1 X121.503 Y159.473 E276.65462 F4800
+G1 X124.506 Y157.279 E276.77844 F9000
+G1 X127.497 Y155.729 E276.89064 F6000
+G1 X129.855 Y156.354 E276.97187 F3000
+G1 X127.164 Y158.990 E277.09731 F1800
+G1 X125.463 Y158.067 E277.16173 F1800
+G1 X126.095 Y158.424 E277.18590 F1800
+G1 X126.234 Y159.064 E277.20768 F3000
+G1 X126.696 Y157.977 E277.24701 F4800
+G1 X128.072 Y158.716 E277.29903 F9000
+G1 X128.887 Y159.144 E277.32965 F6000
+G1 X129.214 Y158.989 E277.34172 F6000
+G1 X130.592 Y155.813 E277.45699 F6000
+G1 X130.783 Y155.455 E277.47051 F4800
+G1 X133.758 Y152.060 E277.62083 F6000
+G1 X133.467 Y150.351 E277.67859 F1800
+G1 X133.006 Y150.276 E277.69417 F9000
+G1 X131.101 Y149.887 E277.75890 F9000
+G1 X126.525 Y151.693 E277.92274 F1800
+G1 X126.543 Y150.442 E277.96440 F1800
+G1 X128.129 Y153.590 E278.08175 F3000
+G1 X125.535 Y150.691 E278.21128 F9000
+G1 X126.410 Y150.047 E278.24747 F4800
+G1 X126.947 Y146.157 E278.37823 F1800
+G1 X128.023 Y144.564 E278.44226 F4800
+G1 X128.267 Y144.830 E278.45427 F6000
+G1 X124.845 Y141.754 E278.60749 F3000
+G1 X126.494 Y142.256 E278.66489 F9000
+G1 X125.494 Y145.410 E278.77509 F3000
+G1 X122.196 Y146.237 E278.88832 F9000
+G1 X120.853 Y145.952 E278.93403 F4800
+G1 X121.652 Y144.496 E278.98935 F1800
+G1 X121.311 Y144.028 E279.00862 F6000
+G1 X122.283 Y143.958 E279.04106 F9000
+G1 X123.064 Y143.935 E279.06710 F1800
+G1 X120.997 Y140.864 E279.19036 F1800
+G1 X123.461 Y143.365 E279.30725 F3000
+G1 X122.738 Y139.949 E279.42353 F9000
+G1 X122.221 Y138.090 E279.48779 F4800
+G1 X124.452 Y139.246 E279.57146 F6000
+G1 X124.086 Y138.458 E279.60038 F6000
+G1 X122.057 Y140.112 E279.68755 F3000
+G1 X122.030 Y139.807 E279.69773 F4800
+G1 X123.431 Y135.010 E279.86415 F6000
+G1 X126.043 Y132.328 E279.98883 F3000
+G1 X128.248 Y134.425 E280.09017 F1800
+G1 X128.639 Y133.223 E280.13226 F6000
+G1 X125.395 Y136.314 E280.28147 F9000
+G1 X128.462 Y135.895 E280.38458 F6000
+G1 X128.732 Y135.913 E280.39356 F9000
+G1 X130.957 Y136.052 E280.46782 F9000
+G1 X130.887 Y131.694 E280.61296 F1800
+G1 X130.743 Y130.378 E280.65707 F1800
+G1 X131.334 Y133.264 E280.75519 F3000
+G1 X135.762 Y131.596 E280.91274 F1800
+G1 X137.714 Y130.144 E280.99374 F4800
+G1 X140.592 Y126.788 E281.14099 F6000
+G1 X143.881 Y127.150 E281.25116 F9000
+G1 X142.749 Y126.565 E281.29360 F3000
+G1 X146.853 Y129.200 E281.45601 F6000
+G1 X146.746 Y131.715 E281.53981 F1800
+G1 X143.850 Y134.160 E281.66601 F4800
+G1 X145.278 Y135.823 E281.73900 F3000
+G1 X149.009 Y138.548 E281.89285 F9000
+G1 X152.718 Y136.951 E282.02733 F1800
+G1 X152.305 Y132.535 E282.17500 F1800
+G1 X154.238 Y132.503 E282.23938 F9000
+G1 X156.149 Y128.823 E282.37746 F9000
+G1 X156.978 Y132.786 E282.51227 F6000
+G1 X155.442 Y134.891 E282.59906 F3000
+G1 X155.486 Y138.909 E282.73285 F9000
+G1 X156.082 Y139.437 E282.75937 F1800
+G1 X156.080 Y139.094 E282.77080 F6000
+G1 X154.786 Y139.684 E282.81818 F3000
+G1 X157.654 Y143.657 E282.98133 F9000
+G1 X158.309 Y144.239 E283.01053 F4800
+G1 X158.110 Y140.073 E283.14942 F6000
+G1 X154.505 Y140.888 E283.27248 F3000
+G1 X153.256 Y137.213 E283.40174 F6000
+G1 X156.469 Y134.995 E283.53173 F3000
+G1 X154.270 Y135.123 E283.60506 F1800
+G1 X156.517 Y132.635 E283.71671 F1800
+G1 X154.327 Y134.163 E283.80563 F6000
+G1 X153.746 Y134.436 E283.82700 F1800
+G1 X158.310 Y136.199 E283.98992 F9000
+G1 X158.890 Y135.927 E284.01124 F6000
+G1 X156.724 Y137.048 E284.09243 F6000
+G1 X157.335 Y138.019 E284.13063 F9000
+G1 X157.067 Y138.775 E284.15733 F3000
+G1 X158.070 Y137.971 E284.20012 F3000
+G1 X158.112 Y138.225 E284.20866 F9000
+G1 X156.639 Y135.632 E284.30796 F3000
+G1 X155.776 Y134.632 E284.35195 F6000
+G1 X158.746 Y134.306 E284.45145 F3000
+G1 X154.038 Y133.809 E284.60911 F3000
+G1 X157.530 Y135.651 E284.74058 F6000
+G1 X157.976 Y135.104 E284.76410 F3000
+G1 X155.249 Y136.983 E284.87438 F6000
+G1 X156.960 Y141.381 E285.03152 F9000
+G1 X156.076 Y141.015 E285.06339 F1800
+G1 X154.000 Y145.515 E285.22843 F9000
+G1 X153.908 Y149.498 E285.36110 F4800
+G1 X154.245 Y149.431 E285.37255 F9000
+G1 X153.488 Y148.661 E285.40850 F4800
+G1 X152.557 Y144.697 E285.54409 F1800
+G1 X155.299 Y148.652 E285.70432 F3000
+G1 X153.036 Y146.676 E285.80436 F9000
+G1 X154.803 Y147.654 E285.87161 F9000
+G1 X151.192 Y149.559 E286.00754 F1800
+G1 X151.437 Y149.525 E286.01578 F6000
+G1 X149.850 Y151.185 E286.09225 F3000
+G1 X145.978 Y149.127 E286.23829 F1800
+G1 X142.146 Y150.395 E286.37269 F3000
+G1 X142.266 Y151.545 E286.41118 F3000
+G1 X146.339 Y154.116 E286.57157 F6000
+G1 X146.908 Y155.241 E286.61356 F4800
+G1 X145.774 Y153.289 E286.68872 F3000
+G1 X145.394 Y153.428 E286.70219 F6000
+G1 X144.563 Y153.020 E286.73303 F6000
+G1 X146.996 Y150.941 E286.83960 F1800
+G1 X148.599 Y152.779 E286.92081 F3000
+G1 X148.118 Y153.377 E286.94637 F3000
+G1 X148.630 Y151.772 E287.00248 F1800
+G1 X148.691 Y151.995 E287.01017 F6000
+G1 X152.896 Y149.618 E287.17102 F3000
+G1 X152.058 Y153.609 E287.30681 F4800
+G1 X149.720 Y155.026 E287.39786 F3000
+G1 X151.979 Y152.724 E287.50530 F3000
+G1 X150.049 Y152.270 E287.57133 F6000
+G1 X152.335 Y153.278 E287.65453 F6000
+G1 X151.718 Y153.882 E287.68328 F9000
+G1 X149.539 Y150.948 E287.80497 F6000
+G1 X150.690 Y149.506 E287.86643 F9000
+G1 X149.092 Y150.921 E287.93750 F3000
+G1 X145.902 Y154.459 E288.09616 F4800
+G1 X148.179 Y153.070 E288.18496 F4800
+G1 X150.534 Y151.446 E288.28022 F1800
+G1 X151.421 Y150.981 E288.31359 F9000
+G1 X149.519 Y148.931 E288.40669 F9000
+G1 X149.791 Y147.498 E288.45526 F1800
+G1 X150.896 Y145.398 E288.53428 F3000
+G1 X154.576 Y146.227 E288.65992 F9000
+G1 X150.132 Y147.464 E288.81352 F4800
+G1 X148.288 Y147.115 E288.87600 F3000
+G1 X149.845 Y148.688 E288.94970 F4800
+G1 X149.378 Y150.490 E289.01169 F3000
+G1 X151.923 Y154.035 E289.15700 F3000
+G1 X151.659 Y154.154 E289.16664 F9000
+G1 X148.825 Y155.808 E289.27590 F6000
+G1 X150.831 Y155.527 E289.34334 F4800
+G1 X151.717 Y155.120 E289.37581 F3000
+G1 X152.259 Y159.107 E289.50980 F1800
+G1 X152.756 Y154.440 E289.66609 F6000
+G1 X153.871 Y153.019 E289.72624 F9000
+G1 X156.329 Y154.149 E289.81635 F1800
+G1 X156.395 Y154.730 E289.83584 F3000
+G1 X154.600 Y156.620 E289.92260 F9000
+G1 X156.982 Y158.676 E290.02739 F1800
+G1 X158.395 Y156.880 E290.10349 F6000
+G1 X155.665 Y154.466 E290.22484 F4800
+G1 X153.582 Y155.027 E290.29665 F1800
+G1 X151.995 Y159.482 E290.45415 F1800
+G1 X152.110 Y158.899 E290.47392 F3000
+G1 X153.494 Y154.947 E290.61337 F1800
+G1 X150.300 Y156.717 E290.73498 F4800
+G1 X145.984 Y154.679 E290.89391 F9000
+G1 X146.851 Y151.620 E290.99978 F9000
+G1 X148.268 Y155.177 E291.12727 F1800
+G1 X148.619 Y155.177 E291.13898 F4800
+G1 X148.410 Y155.414 E291.14951 F3000
+G1 X147.819 Y154.956 E291.17440 F3000
+G1 X150.109 Y152.452 E291.28739 F1800
+G1 X154.002 Y152.578 E291.41707 F4800
+G1 X156.245 Y148.469 E291.57296 F6000
+G1 X155.016 Y147.417 E291.62683 F6000
+G1 X155.090 Y146.593 E291.65438 F6000
+G1 X151.622 Y146.521 E291.76988 F6000
+G1 X155.042 Y143.350 E291.92519 F4800
+G1 X154.280 Y142.291 E291.96865 F3000
+G1 X153.640 Y142.311 E291.98996 F6000
+G1 X153.390 Y141.993 E292.00345 F4800
+G1 X152.763 Y142.448 E292.02925 F1800
+G1 X152.073 Y138.076 E292.17662 F3000
+G1 X152.288 Y137.992 E292.18430 F4800
+G1 X148.791 Y140.339 E292.32453 F9000
+G1 X152.770 Y138.573 E292.46949 F4800
+G1 X152.881 Y141.729 E292.57465 F4800
+G1 X153.709 Y141.539 E292.60294 F1800
+G1 X154.119 Y143.767 E292.67838 F4800
+G1 X153.994 Y140.551 E292.78556 F6000
+G1 X154.261 Y140.195 E292.80038 F6000
+G1 X155.942 Y138.742 E292.87436 F1800
+G1 X153.159 Y141.192 E292.99781 F9000
+G1 X155.108 Y141.781 E293.06561 F4800
+G1 X156.727 Y143.634 E293.14757 F4800
+G1 X157.563 Y141.481 E293.22447 F3000
+G1 X154.856 Y140.655 E293.31872 F3000
+G1 X153.026 Y143.082 E293.41994 F3000
+G1 X153.176 Y146.354 E293.52901 F6000
+G1 X154.318 Y148.038 E293.59675 F4800
+G1 X158.119 Y146.339 E293.73538 F1800
+G1 X156.224 Y147.364 E293.80709 F9000
+G1 X155.713 Y147.403 E293.82415 F9000
+G1 X158.502 Y150.103 E293.95341 F3000
+G1 X158.878 Y150.109 E293.96593 F4800
+G1 X159.946 Y150.491 E294.00372 F1800
+G1 X157.838 Y150.462 E294.07394 F9000
+G1 X158.741 Y149.775 E294.11173 F1800
+G1 X157.605 Y151.143 E294.17094 F1800
+G1 X153.895 Y153.159 E294.31153 F3000
+G1 X154.568 Y153.557 E294.33756 F6000
+G1 X154.887 Y155.525 E294.40393 F3000
+G1 X153.485 Y151.845 E294.53506 F9000
+G1 X156.287 Y150.815 E294.63446 F4800
+G1 X157.602 Y151.627 E294.68594 F3000
+G1 X159.755 Y149.102 E294.79645 F9000
+G1 X158.585 Y152.674 E294.92162 F1800
+G1 X159.527 Y152.152 E294.95748 F6000
+G1 X156.820 Y153.494 E295.05809 F4800
+G1 X156.486 Y152.544 E295.09163 F3000
+G1 X159.002 Y150.327 E295.20328 F1800
+G1 X159.646 Y150.283 E295.22478 F9000
+G1 X159.075 Y150.860 E295.25180 F9000
+G1 X159.745 Y150.339 E295.28006 F4800
+G1 X157.600 Y152.597 E295.38376 F6000
+G1 X154.439 Y152.731 E295.48911 F6000
+G1 X155.483 Y155.548 E295.58914 F4800
+G1 X154.337 Y157.163 E295.65508 F3000
+G1 X154.567 Y156.516 E295.67793 F3000
+G1 X153.822 Y152.236 E295.82262 F9000
+G1 X152.435 Y155.090 E295.92831 F4800
+G1 X153.573 Y150.732 E296.07830 F6000
+G1 X152.568 Y147.936 E296.17724 F9000
+G1 X151.516 Y150.120 E296.25797 F6000
+G1 X146.817 Y150.075 E296.41444 F3000
+G1 X145.471 Y148.813 E296.47587 F3000
+G1 X148.854 Y148.273 E296.58993 F6000
+G1 X150.849 Y150.057 E296.67906 F3000
+G1 X151.302 Y149.097 E296.71443 F9000
+G1 X151.591 Y149.086 E296.72406 F1800
+G1 X150.357 Y149.194 E296.76534 F9000
+G1 X150.536 Y146.758 E296.84668 F9000
+G1 X152.520 Y146.941 E296.91302 F6000
+G1 X152.279 Y147.802 E296.94282 F1800
+G1 X150.888 Y147.236 E296.99282 F6000
+G1 X148.885 Y145.089 E297.09060 F4800
+G1 X149.922 Y145.831 E297.13308 F3000
+G1 X146.787 Y149.553 E297.29512 F6000
+G1 X147.190 Y149.410 E297.30935 F6000
+G1 X148.024 Y144.572 E297.47282 F3000
+G1 X144.977 Y146.779 E297.59810 F4800
+G1 X148.442 Y146.193 E297.71512 F6000
+G1 X145.733 Y143.197 E297.84963 F4800
+G1 X144.598 Y139.701 E297.97204 F3000
+G1 X146.773 Y142.029 E298.07815 F9000
+G1 X144.643 Y145.154 E298.20406 F3000
+G1 X144.522 Y144.204 E298.23595 F1800
+G1 X144.516 Y147.569 E298.34802 F6000
+G1 X142.219 Y147.240 E298.42529 F3000
+G1 X143.819 Y150.687 E298.55183 F1800
+G1 X143.979 Y151.816 E298.58979 F1800
+G1 X144.399 Y146.969 E298.75178 F9000
+G1 X143.468 Y143.206 E298.88087 F6000
+G1 X145.335 Y143.661 E298.94485 F3000
+G1 X144.927 Y144.905 E298.98847 F6000
+G1 X142.398 Y146.512 E299.08827 F9000
+G1 X144.014 Y147.737 E299.15579 F9000
+G1 X142.002 Y149.844 E299.25283 F4800
+G1 X143.853 Y150.105 E299.31508 F4800
+G1 X141.132 Y146.853 E299.45626 F6000
+G1 X140.209 Y150.369 E299.57731 F6000
+G1 X138.997 Y150.598 E299.61836 F3000
+G1 X137.736 Y147.054 E299.74362 F6000
+G1 X136.257 Y144.805 E299.83328 F9000
+G1 X135.491 Y146.783 E299.90392 F4800
+G1 X134.916 Y144.100 E299.99528 F1800
+G1 X135.578 Y142.251 E300.06067 F4800
+G1 X136.702 Y137.581 E300.22064 F1800
+G1 X135.741 Y137.231 E300.25470 F3000
+G1 X136.183 Y137.539 E300.27266 F9000
+G1 X132.830 Y139.816 E300.40763 F3000
+G1 X135.119 Y137.872 E300.50760 F9000
+G1 X134.248 Y135.487 E300.59216 F1800
+G1 X136.399 Y134.899 E300.66643 F3000
+G1 X136.937 Y131.949 E300.76627 F9000
+G1 X136.523 Y135.368 E300.88096 F4800
+G1 X136.367 Y136.114 E300.90635 F6000
+G1 X138.327 Y133.659 E301.01096 F4800
+G1 X137.543 Y131.684 E301.08172 F1800
+G1 X137.639 Y128.668 E301.18221 F6000
+G1 X136.179 Y129.734 E301.24240 F4800
+G1 X135.704 Y130.109 E301.26256 F1800
+G1 X133.854 Y131.547 E301.34058 F3000
+G1 X135.898 Y133.430 E301.43314 F4800
+G1 X136.010 Y132.733 E301.45664 F1800
+G1 X134.574 Y132.587 E301.50470 F6000
+G1 X132.301 Y130.811 E301.60076 F4800
+G1 X132.240 Y132.113 E301.64416 F6000
+G1 X131.542 Y130.753 E301.69506 F4800
+G1 X131.195 Y131.020 E301.70961 F9000
+G1 X129.812 Y129.245 E301.78454 F3000
+G1 X126.026 Y130.840 E301.92135 F9000
+G1 X126.374 Y131.352 E301.94197 F6000
+G1 X127.835 Y129.107 E302.03119 F1800
+G1 X128.138 Y131.908 E302.12503 F6000
+G1 X130.124 Y130.544 E302.20527 F1800
+G1 X129.620 Y129.626 E302.24014 F6000
+G1 X129.806 Y130.977 E302.28557 F3000
+G1 X126.417 Y130.496 E302.39956 F6000
+G1 X126.753 Y133.774 E302.50929 F1800
+G1 X126.996 Y134.063 E302.52190 F1800
+G1 X125.413 Y138.105 E302.66646 F1800
+G1 X126.955 Y134.666 E302.79197 F1800
+G1 X127.124 Y134.471 E302.80056 F4800
+G1 X126.016 Y133.953 E302.84127 F3000
+G1 X124.028 Y132.998 E302.91473 F1800
+G1 X124.528 Y131.488 E302.96770 F1800
+G1 X124.082 Y130.877 E302.99290 F6000
+G1 X124.562 Y130.580 E303.01171 F9000
+G1 X127.158 Y134.080 E303.15683 F3000
+G1 X129.512 Y134.968 E303.24060 F3000
+G1 X132.793 Y137.096 E303.37083 F4800
+G1 X131.594 Y139.941 E303.47363 F9000
+G1 X132.864 Y137.448 E303.56681 F1800
+G1 X132.063 Y133.928 E303.68703 F9000
+G1 X131.857 Y138.076 E303.82535 F3000
+G1 X129.904 Y138.774 E303.89440 F4800
+G1 X132.008 Y138.101 E303.96793 F4800
+G1 X133.164 Y141.999 E304.10331 F1800
+G1 X132.854 Y143.469 E304.15333 F1800
+G1 X129.715 Y143.087 E304.25863 F9000
+G1 X130.287 Y144.394 E304.30614 F4800
+G1 X128.389 Y147.904 E304.43904 F1800
+G1 X127.275 Y149.238 E304.49690 F6000
+G1 X127.362 Y144.867 E304.64247 F1800
+G1 X128.647 Y146.205 E304.70427 F1800
+G1 X132.022 Y143.338 E304.85173 F9000
+G1 X133.499 Y143.741 E304.90273 F4800
+G1 X131.677 Y143.718 E304.96341 F3000
+G1 X130.973 Y146.934 E305.07303 F6000
+G1 X131.414 Y146.868 E305.08787 F3000
+G1 X133.867 Y145.406 E305.18298 F4800
+G1 X135.997 Y143.753 E305.27275 F1800
+G1 X135.690 Y144.096 E305.28810 F9000
+G1 X137.921 Y142.751 E305.37485 F9000
+G1 X136.305 Y143.244 E305.43111 F4800
+G1 X134.316 Y147.812 E305.59701 F1800
+G1 X133.392 Y150.409 E305.68879 F6000
+G1 X130.343 Y150.885 E305.79157 F6000
+G1 X130.495 Y151.797 E305.82236 F9000
+G1 X133.589 Y150.207 E305.93819 F4800
+G1 X137.204 Y149.137 E306.06374 F4800
+G1 X139.042 Y144.524 E306.22910 F9000
+G1 X142.492 Y142.388 E306.36425 F4800
+G1 X144.261 Y145.024 E306.46996 F3000
+G1 X144.434 Y144.402 E306.49146 F1800
+G1 X140.810 Y141.641 E306.64319 F4800
+G1 X144.838 Y138.969 E306.80413 F1800
+G1 X145.801 Y142.138 E306.91442 F3000
+G1 X143.879 Y143.011 E306.98472 F6000
+G1 X141.754 Y144.057 E307.06357 F9000
+G1 X139.661 Y141.334 E307.17793 F3000
+G1 X139.799 Y142.886 E307.22978 F1800
+G1 X140.329 Y147.375 E307.38030 F6000
+G1 X136.265 Y146.252 E307.52070 F9000
+G1 X138.379 Y148.723 E307.62899 F4800
+G1 X140.222 Y148.904 E307.69068 F3000
+G1 X140.007 Y149.103 E307.70042 F3000
+G1 X136.173 Y150.242 E307.83359 F6000
+G1 X136.486 Y150.574 E307.84878 F4800
+G1 X139.027 Y146.587 E308.00621 F9000
+G1 X138.543 Y144.358 E308.08217 F4800
+G1 X134.332 Y146.412 E308.23818 F4800
+G1 X134.523 Y146.689 E308.24937 F3000
+G1 X138.699 Y145.492 E308.39402 F4800
+G1 X134.858 Y147.916 E308.54525 F9000
+G1 X135.256 Y148.618 E308.57214 F6000
+G1 X131.421 Y147.010 E308.71063 F6000
+G1 X129.678 Y151.644 E308.87551 F6000
+G1 X128.859 Y151.054 E308.90912 F4800
+G1 X128.941 Y151.333 E308.91880 F9000
+G1 X129.909 Y150.124 E308.97036 F4800
+G1 X130.575 Y149.485 E309.00109 F4800
+G1 X130.888 Y150.198 E309.02703 F6000
+G1 X131.019 Y150.668 E309.04327 F1800
+G1 X131.077 Y152.322 E309.09839 F1800
+G1 X131.139 Y147.821 E309.24829 F6000
+G1 X131.459 Y147.991 E309.26034 F3000
+G1 X135.294 Y149.149 E309.39377 F6000
+G1 X136.825 Y150.948 E309.47242 F1800
+G1 X137.667 Y151.619 E309.50827 F4800
+G1 X136.193 Y152.752 E309.57019 F1800
+G1 X132.943 Y154.213 E309.68885 F9000
+G1 X128.593 Y154.917 E309.83556 F6000
+G1 X129.054 Y155.220 E309.85393 F9000
+G1 X127.285 Y155.513 E309.91366 F1800
+G1 X127.000 Y156.593 E309.95085 F6000
+G1 X126.986 Y156.797 E309.95766 F3000
+G1 X125.367 Y159.746 E310.06970 F6000
+G1 X125.800 Y159.342 E310.08944 F1800
+G1 X125.403 Y159.492 E310.10356 F3000
+G1 X125.241 Y158.002 E310.15347 F3000
+G1 X128.386 Y155.569 E310.28587 F9000
+G1 X131.076 Y155.515 E310.37546 F6000
+G1 X128.503 Y155.270 E310.46153 F3000
+G1 X126.723 Y157.371 E310.55325 F6000
+G1 X125.179 Y157.145 E310.60521 F9000
+G1 X124.278 Y156.373 E310.64471 F9000
+G1 X126.968 Y155.797 E310.73631 F3000
+G1 X126.651 Y155.439 E310.75222 F9000
+G1 X128.555 Y155.641 E310.81598 F1800
+G1 X129.526 Y156.124 E310.85209 F1800
+G1 X129.357 Y156.006 E310.85892 F1800
+G1 X126.713 Y159.846 E311.01416 F1800
+G1 X123.015 Y158.960 E311.14077 F3000
+G1 X122.615 Y156.358 E311.22845 F9000
+G1 X124.611 Y157.863 E311.31169 F6000
+G1 X125.470 Y157.685 E311.34090 F3000
+G1 X123.614 Y157.876 E311.40302 F4800
+G1 X125.551 Y156.484 E311.48248 F9000
+G1 X126.349 Y157.533 E311.52636 F4800
+G1 X126.750 Y158.828 E311.57149 F6000
+G1 X126.481 Y156.778 E311.64032 F6000
+G1 X127.576 Y159.771 E311.74643 F3000
+G1 X129.466 Y157.831 E311.83660 F1800
+G1 X130.133 Y157.926 E311.85904 F3000
+G1 X128.019 Y153.973 E312.00835 F1800
+G1 X132.614 Y153.432 E312.16243 F1800
+G1 X133.250 Y153.752 E312.18613 F3000
+G1 X130.711 Y151.152 E312.30714 F9000
+G1 X132.306 Y150.341 E312.36672 F6000
+G1 X135.905 Y150.330 E312.48659 F1800
+G1 X139.199 Y150.981 E312.59837 F9000
+G1 X139.044 Y152.385 E312.64539 F6000
+G1 X138.656 Y153.479 E312.68405 F3000
+G1 X136.847 Y153.839 E312.74548 F9000
+G1 X135.914 Y154.164 E312.77837 F9000
+G1 X134.703 Y153.525 E312.82398 F1800
+G1 X131.466 Y153.801 E312.93217 F6000
+G1 X133.583 Y154.132 E313.00353 F3000
+G1 X133.300 Y155.320 E313.04419 F3000
+G1 X132.050 Y156.344 E313.09801 F6000
+G1 X131.359 Y157.326 E313.13799 F3000
+G1 X128.743 Y156.322 E313.23131 F1800
+G1 X130.559 Y153.222 E313.35093 F4800
+G1 X131.472 Y151.337 E313.42068 F1800
+G1 X130.595 Y151.320 E313.44989 F6000
+G1 X130.605 Y155.491 E313.58878 F9000
+G1 X127.069 Y155.749 E313.70683 F1800
+G1 X125.483 Y151.959 E313.84363 F4800
+G1 X125.223 Y149.438 E313.92802 F6000
+G1 X126.165 Y150.186 E313.96807 F9000
+G1 X126.682 Y151.691 E314.02106 F9000
+G1 X125.829 Y154.203 E314.10939 F9000
+G1 X121.702 Y156.010 E314.25941 F3000
+G1 X123.328 Y153.525 E314.35829 F1800
+G1 X121.049 Y152.354 E314.44361 F1800
+G1 X121.577 Y153.510 E314.48594 F9000
+G1 X122.477 Y153.755 E314.51698 F9000
+G1 X122.327 Y155.555 E314.57711 F6000
+G1 X125.587 Y155.640 E314.68570 F9000
+G1 X125.294 Y154.541 E314.72357 F4800
+G1 X123.151 Y156.175 E314.81333 F6000
+G1 X123.712 Y153.447 E314.90608 F3000
+G1 X125.370 Y150.407 E315.02139 F6000
+G1 X124.107 Y152.193 E315.09423 F9000
+G1 X120.871 Y149.755 E315.22915 F3000
+G1 X118.320 Y152.242 E315.34781 F3000
+G1 X120.473 Y149.389 E315.46686 F9000
+G1 X121.388 Y149.973 E315.50301 F6000
+G1 X122.762 Y153.522 E315.62976 F6000
+G1 X124.190 Y150.818 E315.73159 F4800
+G1 X124.696 Y150.340 E315.75477 F3000
+G1 X120.918 Y147.473 E315.91273 F6000
+G1 X124.218 Y150.457 E316.06088 F1800
+G1 X122.260 Y152.624 E316.15813 F4800
+G1 X122.956 Y151.829 E316.19331 F9000
+G1 X122.190 Y150.035 E316.25828 F6000
+G1 X121.542 Y151.410 E316.30890 F4800
+G1 X122.977 Y155.904 E316.46602 F9000
+G1 X119.342 Y153.537 E316.61049 F4800
+G1 X117.269 Y156.182 E316.72239 F6000
+G1 X118.069 Y156.097 E316.74918 F9000
+G1 X117.568 Y158.175 E316.82035 F6000
+G1 X118.761 Y156.064 E316.90109 F3000
+G1 X118.121 Y154.890 E316.94561 F4800
+G1 X119.913 Y155.788 E317.01236 F1800
+G1 X118.842 Y154.366 E317.07163 F4800
+G1 X120.430 Y153.769 E317.12811 F6000
+G1 X118.082 Y153.220 E317.20840 F4800
+G1 X121.723 Y151.143 E317.34799 F3000
+G1 X122.712 Y150.350 E317.39022 F3000
+G1 X122.758 Y150.117 E317.39813 F9000
+G1 X124.062 Y151.519 E317.46193 F1800
+G1 X120.950 Y150.945 E317.56731 F3000
+G1 X118.110 Y149.209 E317.67816 F3000
+G1 X119.873 Y151.067 E317.76344 F1800
+G1 X122.998 Y152.030 E317.87234 F9000
+G1 X122.766 Y153.359 E317.91726 F6000
+G1 X121.299 Y153.227 E317.96632 F4800
+G1 X125.526 Y154.916 E318.11791 F4800
+G1 X127.925 Y153.635 E318.20849 F9000
+G1 X126.490 Y155.320 E318.28218 F6000
+G1 X127.522 Y152.764 E318.37393 F3000
+G1 X131.110 Y149.449 E318.53661 F3000
+G1 X131.447 Y149.393 E318.54801 F6000
+G1 X129.792 Y151.607 E318.64006 F6000
+G1 X129.626 Y152.134 E318.65847 F9000
+G1 X131.492 Y153.298 E318.73172 F4800
+G1 X130.226 Y152.972 E318.77528 F6000
+G1 X128.730 Y155.180 E318.86410 F4800
+G1 X131.981 Y151.605 E319.02501 F1800
+G1 X131.407 Y154.390 E319.11971 F6000
+G1 X131.204 Y151.142 E319.22807 F9000
+G1 X131.855 Y151.939 E319.26233 F9000
+G1 X132.765 Y153.839 E319.33248 F9000
+G1 X132.973 Y155.970 E319.40378 F6000
+G1 X134.514 Y152.615 E319.52672 F3000
+G1 X136.820 Y155.995 E319.66298 F1800
+G1 X138.106 Y156.875 E319.71487 F1800
+G1 X138.834 Y155.888 E319.75572 F6000
+G1 X137.924 Y155.039 E319.79717 F3000
+G1 X139.792 Y153.429 E319.87929 F9000
+G1 X140.538 Y153.710 E319.90584 F1800
+G1 X141.295 Y155.037 E319.95670 F1800
+G1 X140.100 Y154.911 E319.99671 F9000
+G1 X136.604 Y153.824 E320.11863 F3000
+G1 X136.579 Y149.746 E320.25443 F4800
+G1 X134.185 Y145.669 E320.41189 F1800
+G1 X134.149 Y146.185 E320.42913 F3000
+G1 X134.407 Y149.536 E320.54106 F3000
+G1 X135.435 Y147.403 E320.61990 F3000
+G1 X131.724 Y145.429 E320.75990 F4800
+G1 X129.872 Y145.386 E320.82158 F6000
+G1 X128.970 Y146.180 E320.86160 F9000
+G1 X133.859 Y146.904 E321.02616 F9000
+G1 X133.291 Y146.650 E321.04686 F3000
+G1 X135.377 Y145.546 E321.12545 F4800
+G1 X135.617 Y146.586 E321.16099 F1800
+G1 X133.143 Y150.328 E321.31038 F3000
+G1 X134.366 Y148.984 E321.37092 F9000
+G1 X133.678 Y147.657 E321.42071 F6000
+G1 X132.809 Y149.710 E321.49494 F9000
+G1 X129.181 Y149.177 E321.61704 F3000
+G1 X128.923 Y152.198 E321.71802 F6000
+G1 X125.856 Y153.987 E321.83627 F6000
+G1 X129.649 Y154.017 E321.96261 F3000
+G1 X129.973 Y152.893 E322.00156 F1800
+G1 X129.492 Y152.759 E322.01817 F1800
+G1 X125.947 Y153.277 E322.13747 F9000
+G1 X124.034 Y153.487 E322.20156 F4800
+G1 X122.312 Y151.079 E322.30016 F1800
+G1 X119.722 Y150.861 E322.38671 F4800
+G1 X124.183 Y152.866 E322.54960 F4800
+G1 X123.886 Y149.056 E322.67686 F9000
+G1 X126.083 Y152.976 E322.82650 F6000
+G1 X124.319 Y151.882 E322.89561 F6000
+G1 X125.147 Y148.624 E323.00757 F9000
+G1 X124.960 Y149.704 E323.04409 F4800
+G1 X125.720 Y149.879 E323.07004 F3000
+G1 X124.372 Y151.076 E323.13007 F6000
+G1 X124.141 Y151.081 E323.13775 F9000
+G1 X120.190 Y152.273 E323.27519 F3000
+G1 X124.335 Y150.650 E323.42343 F4800
+G1 X122.503 Y153.841 E323.54597 F3000
+G1 X122.878 Y153.249 E323.56930 F1800
+G1 X119.708 Y153.910 E323.67711 F1800
+G1 X120.614 Y154.094 E323.70787 F3000
+G1 X120.410 Y155.488 E323.75477 F1800
+G1 X122.079 Y157.106 E323.83216 F3000
+G1 X120.591 Y156.247 E323.88938 F9000
+G1 X122.386 Y151.855 E324.04736 F6000
+G1 X122.586 Y149.326 E324.13183 F9000
+G1 X125.314 Y153.392 E324.29489 F6000
+G1 X121.312 Y154.473 E324.43292 F4800
+G1 X121.080 Y154.381 E324.44125 F9000
+G1 X118.018 Y153.213 E324.55036 F3000
+G1 X117.175 Y157.477 E324.69509 F3000
+G1 X118.230 Y153.417 E324.83476 F3000
+G1 X121.063 Y149.587 E324.99340 F4800
+G1 X119.073 Y148.172 E325.07472 F3000
+G1 X119.578 Y148.073 E325.09189 F6000
+G1 X120.937 Y146.271 E325.16706 F3000
+G1 X119.488 Y144.910 E325.23325 F4800
+G1 X119.489 Y145.831 E325.26394 F3000
+G1 X122.433 Y142.842 E325.40367 F1800
+G1 X125.235 Y143.090 E325.49732 F9000
+G1 X122.788 Y143.589 E325.58046 F4800
+G1 X124.176 Y145.941 E325.67143 F1800
+G1 X122.442 Y148.082 E325.76319 F3000
+G1 X123.451 Y144.216 E325.89627 F6000
+G1 X122.525 Y145.056 E325.93790 F3000
+G1 X124.059 Y147.127 E326.02372 F3000
+G1 X121.910 Y147.581 E326.09685 F4800
+G1 X120.659 Y143.430 E326.24122 F4800
+G1 X118.809 Y146.512 E326.36092 F4800
+G1 X121.878 Y146.114 E326.46398 F9000
+G1 X119.649 Y144.785 E326.55038 F9000
+G1 X121.834 Y142.749 E326.64983 F9000
+G1 X118.551 Y141.600 E326.76566 F9000
+G1 X116.329 Y140.679 E326.84575 F3000
+G1 X118.051 Y140.544 E326.90325 F1800
+G1 X115.195 Y143.794 E327.04733 F3000
+G1 X114.909 Y147.534 E327.17225 F6000
+G1 X119.044 Y147.959 E327.31066 F9000
+G1 X118.607 Y149.637 E327.36838 F9000
+G1 X116.192 Y153.702 E327.52583 F6000
+G1 X117.006 Y153.558 E327.55336 F6000
+G1 X118.715 Y151.681 E327.63789 F9000
+G1 X121.897 Y151.124 E327.74545 F1800
+G1 X120.613 Y148.720 E327.83623 F9000
+G1 X120.759 Y149.387 E327.85897 F6000
+G1 X121.056 Y145.937 E327.97427 F9000
+G1 X121.361 Y143.235 E328.06481 F9000
+G1 X123.388 Y140.995 E328.16540 F6000
+G1 X121.820 Y140.510 E328.22006 F4800
+G1 X122.643 Y140.216 E328.24916 F6000
+G1 X123.565 Y136.792 E328.36724 F4800
+G1 X125.322 Y139.549 E328.47609 F1800
+G1 X125.570 Y139.685 E328.48550 F4800
+G1 X124.454 Y140.071 E328.52482 F1800
+G1 X122.283 Y139.567 E328.59902 F9000
+G1 X126.585 Y141.854 E328.76126 F3000
+G1 X126.157 Y144.608 E328.85406 F3000
+G1 X124.363 Y144.742 E328.91395 F9000
+G1 X120.844 Y147.586 E329.06463 F1800
+G1 X120.490 Y148.437 E329.09533 F1800
+G1 X122.224 Y149.180 E329.15814 F3000
+G1 X121.772 Y148.884 E329.17614 F3000
+G1 X125.578 Y147.962 E329.30656 F1800
+G1 X123.172 Y148.028 E329.38670 F4800
+G1 X120.782 Y147.525 E329.46804 F1800
+G1 X123.357 Y143.468 E329.62807 F6000
+G1 X120.649 Y145.210 E329.73530 F9000
+G1 X120.200 Y145.140 E329.75042 F9000
+G1 X120.943 Y143.799 E329.80148 F4800
+G1 X122.130 Y142.483 E329.86048 F9000
+G1 X119.241 Y143.710 E329.96501 F9000
+G1 X120.634 Y140.607 E330.07830 F4800
+G1 X120.957 Y140.182 E330.09609 F6000
+G1 X120.362 Y141.506 E330.14444 F9000
+G1 X118.521 Y138.638 E330.25792 F6000
+G1 X116.209 Y139.558 E330.34077 F9000
+G1 X116.989 Y137.376 E330.41794 F6000
+G1 X121.045 Y138.545 E330.55850 F9000
+G1 X122.122 Y134.934 E330.68398 F6000
+G1 X127.117 Y135.007 E330.85035 F3000
+G1 X125.594 Y132.593 E330.94539 F4800
+G1 X127.379 Y130.779 E331.03015 F9000
+G1 X123.946 Y131.955 E331.15099 F3000
+G1 X128.687 Y131.685 E331.30913 F1800
+G1 X129.081 Y131.071 E331.33342 F4800
+G1 X128.944 Y131.230 E331.34044 F4800
+G1 X128.992 Y126.701 E331.49126 F9000
+G1 X131.198 Y128.709 E331.59057 F4800
+G1 X136.039 Y129.344 E331.75315 F6000
+G1 X134.755 Y127.968 E331.81581 F3000
+G1 X134.142 Y123.251 E331.97420 F4800
+G1 X135.520 Y127.159 E332.11218 F6000
+G1 X136.655 Y126.280 E332.16000 F4800
+G1 X133.769 Y128.132 E332.27421 F1800
+G1 X134.012 Y126.786 E332.31976 F4800
+G1 X133.386 Y124.472 E332.39958 F4800
+G1 X134.314 Y125.000 E332.43512 F4800
+G1 X136.667 Y121.417 E332.57788 F1800
+G1 X134.261 Y124.285 E332.70255 F3000
+G1 X135.115 Y119.632 E332.86010 F3000
+G1 X135.334 Y120.953 E332.90469 F4800
+G1 X131.310 Y119.960 E333.04269 F9000
+G1 X129.633 Y120.700 E333.10373 F6000
+G1 X129.848 Y120.676 E333.11092 F6000
+G1 X131.570 Y123.458 E333.21986 F4800
+G1 X129.523 Y123.265 E333.28834 F1800
+G1 X130.782 Y122.815 E333.33285 F6000
+G1 X130.227 Y124.468 E333.39089 F3000
+G1 X129.491 Y123.564 E333.42968 F9000
+G1 X129.751 Y127.040 E333.54575 F9000
+G1 X133.129 Y130.475 E333.70617 F9000
+G1 X128.624 Y130.014 E333.85698 F3000
+G1 X128.227 Y134.118 E333.99427 F9000
+G1 X127.489 Y136.489 E334.07698 F3000
+G1 X124.600 Y135.357 E334.18029 F1800
+G1 X128.356 Y135.785 E334.30619 F1800
+G1 X131.289 Y133.667 E334.42664 F1800
+G1 X130.368 Y134.016 E334.45946 F3000
+G1 X133.389 Y137.895 E334.62319 F1800
+G1 X133.391 Y133.203 E334.77943 F4800
+G1 X133.336 Y133.655 E334.79459 F4800
+G1 X133.714 Y132.722 E334.82813 F6000
+G1 X128.795 Y133.199 E334.99272 F4800
+G1 X128.513 Y133.404 E335.00433 F4800
+G1 X128.809 Y133.723 E335.01881 F9000
+G1 X132.072 Y136.600 E335.16367 F3000
+G1 X133.614 Y139.884 E335.28447 F6000
+G1 X131.691 Y139.661 E335.34895 F6000
+G1 X134.686 Y136.396 E335.49651 F6000
+G1 X133.248 Y140.022 E335.62641 F6000
+G1 X131.931 Y141.799 E335.70008 F3000
+G1 X131.084 Y145.638 E335.83099 F1800
+G1 X131.006 Y145.191 E335.84610 F3000
+G1 X131.181 Y144.727 E335.86263 F4800
+G1 X129.319 Y143.082 E335.94537 F9000
+G1 X129.000 Y143.147 E335.95619 F1800
+G1 X128.938 Y144.275 E335.99380 F9000
+G1 X128.105 Y143.135 E336.04080 F9000
+G1 X126.410 Y140.421 E336.14737 F9000
+G1 X125.946 Y140.418 E336.16281 F9000
+G1 X125.355 Y141.905 E336.21610 F4800
+G1 X122.287 Y144.704 E336.35439 F6000
+G1 X125.675 Y145.054 E336.46780 F4800
+G1 X128.321 Y142.250 E336.59618 F3000
+G1 X127.281 Y142.290 E336.63086 F4800
+G1 X126.350 Y144.312 E336.70497 F9000
+G1 X126.479 Y142.454 E336.76695 F6000
+G1 X129.247 Y141.997 E336.86037 F4800
+G1 X132.640 Y144.539 E337.00156 F6000
+G1 X134.331 Y142.621 E337.08671 F4800
+G1 X136.304 Y144.612 E337.18004 F1800
+G1 X134.393 Y147.639 E337.29924 F1800
+G1 X132.155 Y145.134 E337.41107 F3000
+G1 X136.238 Y147.189 E337.56328 F3000
+G1 X136.984 Y149.461 E337.64290 F4800
+G1 X134.330 Y146.414 E337.77745 F6000
+G1 X135.888 Y149.634 E337.89656 F3000
+G1 X134.800 Y149.309 E337.93437 F3000
+G1 X131.956 Y147.814 E338.04137 F9000
+G1 X132.537 Y147.371 E338.06568 F3000
+G1 X129.827 Y143.888 E338.21264 F4800
+G1 X130.861 Y146.421 E338.30375 F4800
+G1 X131.195 Y150.186 E338.42962 F9000
+G1 X134.226 Y149.986 E338.53078 F4800
+G1 X135.827 Y150.073 E338.58418 F9000
+G1 X136.788 Y153.421 E338.70016 F4800
+G1 X137.224 Y153.851 E338.72057 F9000
+G1 X139.598 Y152.424 E338.81280 F4800
+G1 X140.761 Y150.876 E338.87728 F1800
+G1 X137.566 Y150.227 E338.98588 F1800
+G1 X138.971 Y150.007 E339.03327 F6000
+G1 X140.432 Y149.873 E339.08209 F1800
+G1 X137.818 Y146.989 E339.21168 F6000
+G1 X138.156 Y149.752 E339.30439 F9000
+G1 X138.098 Y147.023 E339.39532 F3000
+G1 X140.677 Y149.276 E339.50935 F6000
+G1 X141.090 Y149.537 E339.52564 F3000
+G1 X141.175 Y147.798 E339.58362 F6000
+G1 X142.158 Y147.872 E339.61647 F1800
+G1 X143.085 Y144.265 E339.74047 F3000
+G1 X143.782 Y141.611 E339.83187 F6000
+G1 X142.551 Y142.284 E339.87859 F6000
+G1 X143.620 Y141.744 E339.91848 F6000
+G1 X144.308 Y138.620 E340.02502 F9000
+G1 X147.808 Y140.896 E340.16405 F6000
+G1 X147.754 Y140.560 E340.17539 F9000
+G1 X147.522 Y140.368 E340.18543 F1800
+G1 X143.786 Y138.304 E340.32755 F1800
+G1 X139.844 Y141.250 E340.49145 F4800
+G1 X140.047 Y141.474 E340.50154 F1800
+G1 X142.382 Y142.774 E340.59053 F9000
+G1 X144.159 Y145.151 E340.68936 F9000
+G1 X147.186 Y148.947 E340.85102 F1800
+G1 X145.428 Y148.197 E340.91466 F9000
+G1 X143.305 Y144.376 E341.06022 F9000
+G1 X143.446 Y144.763 E341.07391 F3000
+G1 X141.475 Y146.199 E341.15513 F1800
+G1 X142.907 Y144.118 E341.23926 F3000
+G1 X144.842 Y143.430 E341.30762 F4800
+G1 X146.538 Y142.382 E341.37402 F4800
+G1 X143.465 Y142.241 E341.47644 F1800
+G1 X143.276 Y142.590 E341.48967 F4800
+G1 X142.549 Y143.371 E341.52521 F1800
+G1 X143.383 Y147.427 E341.66310 F6000
+G1 X143.060 Y147.555 E341.67467 F1800
+G1 X144.736 Y147.943 E341.73197 F3000
+G1 X148.196 Y144.634 E341.89140 F9000
+G1 X146.558 Y149.176 E342.05221 F9000
+G1 X144.977 Y148.854 E342.10593 F6000
+G1 X145.726 Y149.748 E342.14476 F6000
+G1 X147.218 Y149.276 E342.19685 F9000
+G1 X149.111 Y146.571 E342.30680 F9000
+G1 X148.029 Y144.125 E342.39586 F1800
+G1 X147.526 Y144.506 E342.41687 F4800
+G1 X144.492 Y143.102 E342.52820 F6000
+G1 X144.301 Y143.533 E342.54393 F3000
+G1 X147.671 Y141.553 E342.67409 F6000
+G1 X151.236 Y141.397 E342.79290 F9000
+G1 X152.585 Y145.147 E342.92562 F1800
+G1 X155.297 Y141.420 E343.07911 F6000
+G1 X153.047 Y143.680 E343.18530 F6000
+G1 X151.348 Y142.956 E343.24680 F4800
+G1 X152.766 Y147.209 E343.39608 F6000
+G1 X148.959 Y146.413 E343.52560 F3000
+G1 X146.961 Y147.829 E343.60714 F9000
+G1 X147.219 Y147.730 E343.61634 F6000
+G1 X150.612 Y146.291 E343.73907 F3000
+G1 X151.027 Y146.387 E343.75324 F4800
+G1 X149.999 Y145.086 E343.80845 F1800
+G1 X149.290 Y149.511 E343.95767 F9000
+G1 X149.553 Y149.640 E343.96744 F1800
+G1 X148.734 Y150.164 E343.99983 F6000
+G1 X150.290 Y151.110 E344.06045 F3000
+G1 X152.414 Y152.624 E344.14732 F1800
+G1 X150.558 Y155.171 E344.25226 F3000
+G1 X150.872 Y155.231 E344.26288 F6000
+G1 X148.783 Y159.258 E344.41392 F4800
+G1 X147.907 Y158.929 E344.44508 F1800
+G1 X149.518 Y159.575 E344.50287 F1800
+G1 X149.283 Y159.012 E344.52321 F3000
+G1 X151.018 Y155.131 E344.66476 F6000
+G1 X149.644 Y154.906 E344.71113 F9000
+G1 X147.724 Y155.414 E344.77726 F6000
+G1 X147.444 Y154.742 E344.80147 F4800
+G1 X149.595 Y155.389 E344.87626 F3000
+G1 X150.673 Y156.343 E344.92419 F4800
+G1 X151.971 Y153.623 E345.02454 F6000
+G1 X155.215 Y152.440 E345.13953 F4800
+G1 X158.901 Y153.437 E345.26668 F1800
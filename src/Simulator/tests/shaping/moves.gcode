@@ -0,0 +1,54 @@
+; Stop to stop moves at 150 mm/s for make bench-shaping: 10 and 50 mm along
+; X, Y and the diagonal, each followed by a dwell so the vibration dies out
+; at rest, then a 40 mm square 5 times without stops.
+G28
+G21
+G90
+G1 Z5 F3000
+G1 X50 Y50 F9000
+G4 P300
+G1 X60 Y50
+G4 P300
+G1 X50 Y50
+G4 P300
+G1 X50 Y60
+G4 P300
+G1 X50 Y50
+G4 P300
+G1 X60 Y60
+G4 P300
+G1 X50 Y50
+G4 P300
+G1 X100 Y50
+G4 P300
+G1 X50 Y50
+G4 P300
+G1 X50 Y100
+G4 P300
+G1 X50 Y50
+G4 P300
+G1 X100 Y100
+G4 P300
+G1 X50 Y50
+G4 P300
+G1 X90 Y50
+G1 X90 Y90
+G1 X50 Y90
+G1 X50 Y50
+G1 X90 Y50
+G1 X90 Y90
+G1 X50 Y90
+G1 X50 Y50
+G1 X90 Y50
+G1 X90 Y90
+G1 X50 Y90
+G1 X50 Y50
+G1 X90 Y50
+G1 X90 Y90
+G1 X50 Y90
+G1 X50 Y50
+G1 X90 Y50
+G1 X90 Y90
+G1 X50 Y90
+G1 X50 Y50
+G4 P300